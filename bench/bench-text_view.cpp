@@ -0,0 +1,803 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+// Throughput benchmarks.  Each benchmark is run repeatedly for a fixed
+// duration and reports the number of input bytes, or for property lookup
+// benchmarks the number of lookups, processed per second.  A
+// substring given as the first argument limits the benchmarks that are run to
+// those with a name containing it.
+//
+// usage: bench-text_view [<filter>]
+
+#include <text_view>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+
+
+using namespace std;
+using namespace std::experimental;
+
+
+namespace {
+
+const char *benchmark_filter = nullptr;
+
+// Prevents the optimizer from discarding benchmark results.
+volatile std::size_t benchmark_sink;
+
+template<typename F>
+void run_benchmark(
+    const char *name,
+    std::size_t bytes,
+    F f,
+    const char *unit = "MB")
+{
+    if (benchmark_filter && !strstr(name, benchmark_filter)) {
+        return;
+    }
+    using clock = chrono::steady_clock;
+    const auto min_duration = chrono::milliseconds(500);
+    std::size_t iterations = 0;
+    auto start = clock::now();
+    auto elapsed = clock::duration{};
+    do {
+        benchmark_sink = f();
+        ++iterations;
+        elapsed = clock::now() - start;
+    } while (elapsed < min_duration);
+    double seconds = chrono::duration<double>(elapsed).count();
+    printf("%-40s %10.1f %s/s\n",
+           name, double(bytes) * iterations / seconds / 1e6, unit);
+}
+
+// A linear congruential generator; the benchmarks want deterministic input
+// rather than good randomness.
+struct lcg {
+    unsigned long state = 1;
+    unsigned operator()(unsigned n) {
+        state = state * 6364136223846793005UL + 1442695040888963407UL;
+        return unsigned(state >> 33) % n;
+    }
+};
+
+// Returns a sequence of approximately 'bytes' code units encoded by 'ET'.  Code
+// points are drawn from printable ASCII 'ascii_percent' percent of the time and
+// from 'code_points' otherwise.
+template<TextEncoding ET>
+string make_input(
+    std::size_t bytes,
+    const vector<char32_t> &code_points,
+    unsigned ascii_percent)
+{
+    string s;
+    auto it = make_otext_iterator<ET>(back_inserter(s));
+    lcg random;
+    while (s.size() < bytes) {
+        char32_t cp;
+        if (random(100) < ascii_percent) {
+            cp = U' ' + random(95);
+        } else {
+            cp = code_points[random(code_points.size())];
+        }
+        *it++ = character_type_t<ET>{cp};
+    }
+    return s;
+}
+
+// Benchmarks iterating a text view and bulk decoding to UTF-8 for 'input'.
+template<TextEncoding ET>
+void bench_decode(const char *encoding_name, const string &input) {
+    string name;
+    name = string(encoding_name) + " text_view iteration";
+    run_benchmark(name.c_str(), input.size(), [&] {
+        std::size_t sum = 0;
+        for (auto c : make_text_view<ET>(input)) {
+            sum += c.get_code_point();
+        }
+        return sum;
+    });
+
+    string utf8(4 * input.size(), '\0');
+    name = string(encoding_name) + " decode_to_utf8";
+    run_benchmark(name.c_str(), input.size(), [&] {
+        char *end = ET::decode_to_utf8(
+            input.data(), input.data() + input.size(), &utf8[0]);
+        return std::size_t(end - utf8.data());
+    });
+}
+
+void bench_single_byte_encodings() {
+    vector<char32_t> latin1;
+    for (char32_t cp = 0xA0; cp <= 0xFF; ++cp) {
+        latin1.push_back(cp);
+    }
+    bench_decode<windows_1252_encoding>(
+        "windows-1252 (90% ascii)",
+        make_input<windows_1252_encoding>(1 << 20, latin1, 90));
+}
+
+void bench_multi_byte_encodings() {
+    // Common CJK ideographs (all are in GB2312 and so encode as two code
+    // units) and a few code points that require four code units.
+    vector<char32_t> hanzi;
+    for (char32_t cp = 0x4E00; cp <= 0x9FA5; ++cp) {
+        hanzi.push_back(cp);
+    }
+    for (char32_t cp = 0x20000; cp < 0x20010; ++cp) {
+        hanzi.push_back(cp);
+    }
+    bench_decode<gb18030_encoding>(
+        "gb18030 (20% ascii)",
+        make_input<gb18030_encoding>(1 << 20, hanzi, 20));
+
+    // Hiragana and the JIS X 0208 level 1 kanji.
+    vector<char32_t> japanese;
+    for (char32_t cp = 0x3041; cp <= 0x3093; ++cp) {
+        japanese.push_back(cp);
+    }
+    for (const auto &row : text_detail::jis_x_0208_charmap::to_unicode) {
+        for (char16_t cp : row) {
+            if (cp >= 0x4E00 && cp <= 0x9FFF) {
+                japanese.push_back(cp);
+            }
+        }
+    }
+    bench_decode<shift_jis_encoding>(
+        "shift_jis (20% ascii)",
+        make_input<shift_jis_encoding>(1 << 20, japanese, 20));
+
+    // ISO-2022-JP is measured on long runs of JIS X 0208 characters without
+    // escape sequences, where the cost of tracking the shift state should be
+    // negligible, and on Shift_JIS encoded input of the same characters for
+    // comparison.
+    bench_decode<iso_2022_jp_encoding>(
+        "iso-2022-jp (no escapes)",
+        make_input<iso_2022_jp_encoding>(1 << 20, japanese, 0));
+    bench_decode<shift_jis_encoding>(
+        "shift_jis (no ascii)",
+        make_input<shift_jis_encoding>(1 << 20, japanese, 0));
+}
+
+void bench_unicode_encodings() {
+    // Latin, CJK, and supplementary plane code points; the latter are where
+    // CESU-8 and modified UTF-8 differ from UTF-8.
+    vector<char32_t> mixed;
+    for (char32_t cp = 0xC0; cp <= 0xFF; ++cp) {
+        mixed.push_back(cp);
+    }
+    for (char32_t cp = 0x4E00; cp < 0x4F00; ++cp) {
+        mixed.push_back(cp);
+    }
+    for (char32_t cp = 0x1F600; cp < 0x1F640; ++cp) {
+        mixed.push_back(cp);
+    }
+    bench_decode<modified_utf8_encoding>(
+        "modified utf-8 (80% ascii)",
+        make_input<modified_utf8_encoding>(1 << 20, mixed, 80));
+    bench_decode<cesu8_encoding>(
+        "cesu-8 (20% ascii)",
+        make_input<cesu8_encoding>(1 << 20, mixed, 20));
+
+    string utf8 = make_input<utf8_encoding>(1 << 20, mixed, 80);
+    string encoded(2 * utf8.size(), '\0');
+    run_benchmark("modified utf-8 (80% ascii) encode_from_utf8",
+                  utf8.size(), [&] {
+        char *end = modified_utf8_encoding::encode_from_utf8(
+            utf8.data(), utf8.data() + utf8.size(), &encoded[0]);
+        return std::size_t(end - encoded.data());
+    });
+
+    // UTF-16 with occasional unpaired surrogates, as in file names.
+    u16string utf16;
+    lcg random;
+    for (char c : utf8) {
+        utf16 += random(100) == 0 ? char16_t(0xD800) : char16_t(c & 0x7F);
+    }
+    string wtf8(3 * utf16.size(), '\0');
+    run_benchmark("wtf-8 encode_from_utf16", 2 * utf16.size(), [&] {
+        char *end = wtf8_encoding::encode_from_utf16(
+            utf16.data(), utf16.data() + utf16.size(), &wtf8[0]);
+        return std::size_t(end - wtf8.data());
+    });
+    wtf8.resize(wtf8_encoding::encode_from_utf16(
+        utf16.data(), utf16.data() + utf16.size(), &wtf8[0]) - wtf8.data());
+    run_benchmark("wtf-8 decode_to_utf16", wtf8.size(), [&] {
+        char16_t *end = wtf8_encoding::decode_to_utf16(
+            wtf8.data(), wtf8.data() + wtf8.size(), &utf16[0]);
+        return std::size_t(end - utf16.data());
+    });
+}
+
+// Benchmarks counting the segments of 'input', encoded with 'ET', presented
+// by the segmentation view returned by 'make_view'.
+template<TextEncoding ET = utf8_encoding, typename String, typename F>
+void bench_segments(const char *name, const String &input, F make_view) {
+    auto tv = make_text_view<ET>(input);
+    run_benchmark(name, input.size() * sizeof(input[0]), [&] {
+        std::size_t segments = 0;
+        for (auto segment : make_view(tv)) {
+            (void)segment;
+            ++segments;
+        }
+        return segments;
+    });
+}
+
+// Returns multilingual prose of at least 'length' code points: words in
+// Latin, Greek, Cyrillic, Hebrew, and Hangul separated by spaces and
+// punctuation, numbers, and runs of CJK ideographs without spaces.
+u32string make_multilingual_text(std::size_t length) {
+    struct script { char32_t first; unsigned count; };
+    static const script scripts[] = {
+        { U'a', 26 }, { U'a', 26 }, { 0xE0, 32 }, { 0x3B1, 25 },
+        { 0x430, 32 }, { 0x5D0, 27 }, { 0xAC00, 11172 } };
+    u32string text;
+    lcg random;
+    while (text.size() < length) {
+        unsigned r = random(10);
+        if (r < 7) {
+            const script &s = scripts[random(7)];
+            for (unsigned i = 0, n = 2 + random(8); i < n; ++i) {
+                text += char32_t(s.first + random(s.count));
+            }
+        } else if (r < 8) {
+            for (unsigned i = 0, n = 1 + random(5); i < n; ++i) {
+                text += char32_t(U'0' + random(10));
+            }
+            text += U".5";
+        } else {
+            for (unsigned i = 0, n = 4 + random(20); i < n; ++i) {
+                text += char32_t(0x4E00 + random(0x5000));
+            }
+            text += random(2) ? U'\u3002' : U'\u3001';
+            continue;
+        }
+        unsigned p = random(20);
+        text += p == 0 ? U". " : p == 1 ? U", " : p == 2 ? U"\n" : U" ";
+    }
+    return text;
+}
+
+void bench_segmentation_views() {
+    // Latin text, which is classified without trie lookups, and text with
+    // combining marks, Hangul, and emoji sequences, which is not.
+    vector<char32_t> latin;
+    for (char32_t cp = 0xC0; cp <= 0x17F; ++cp) {
+        latin.push_back(cp);
+    }
+    vector<char32_t> mixed{
+        0x0301, 0x0308, 0x093F, 0x1100, 0x1161, 0x11A8, 0xAC00, 0x200D,
+        0xFE0F, 0x1F1FA, 0x1F1F8, 0x1F44D, 0x1F3FD, 0x1F469, 0x2764, 0x4E00 };
+    string latin_input = make_input<utf8_encoding>(1 << 20, latin, 80);
+    string mixed_input = make_input<utf8_encoding>(1 << 20, mixed, 20);
+
+    // Prose-like ASCII text for the word and sentence views: words of two to
+    // nine letters separated by spaces and occasional punctuation.
+    string ascii_input;
+    lcg random;
+    while (ascii_input.size() < (1 << 20)) {
+        unsigned length = 2 + random(8);
+        for (unsigned i = 0; i < length; ++i) {
+            ascii_input += char('a' + random(26));
+        }
+        unsigned r = random(20);
+        ascii_input += r == 0 ? ". " : r == 1 ? ", " : r == 2 ? "'s " : " ";
+    }
+
+    auto graphemes = [](auto tv) { return make_grapheme_view(tv); };
+    auto words = [](auto tv) { return make_word_view(tv); };
+    auto sentences = [](auto tv) { return make_sentence_view(tv); };
+    auto lines = [](auto tv) { return make_line_break_view(tv); };
+    bench_segments("grapheme_view latin (80% ascii)", latin_input, graphemes);
+    bench_segments("grapheme_view mixed (20% ascii)", mixed_input, graphemes);
+    bench_segments("word_view ascii", ascii_input, words);
+    bench_segments("word_view latin (80% ascii)", latin_input, words);
+    bench_segments("word_view mixed (20% ascii)", mixed_input, words);
+    bench_segments("sentence_view ascii", ascii_input, sentences);
+
+    // Line break opportunities in large multilingual documents.
+    u32string multilingual = make_multilingual_text(1 << 19);
+    string multilingual_utf8;
+    u16string multilingual_utf16;
+    auto out8 = make_otext_iterator<utf8_encoding>(
+        back_inserter(multilingual_utf8));
+    auto out16 = make_otext_iterator<utf16_encoding>(
+        back_inserter(multilingual_utf16));
+    for (char32_t cp : multilingual) {
+        *out8++ = character_type_t<utf8_encoding>{cp};
+        *out16++ = character_type_t<utf16_encoding>{cp};
+    }
+    bench_segments("line_break_view ascii", ascii_input, lines);
+    bench_segments("line_break_view multilingual utf-8",
+                   multilingual_utf8, lines);
+    bench_segments<utf16_encoding>("line_break_view multilingual utf-16",
+                                   multilingual_utf16, lines);
+}
+
+void bench_normalization() {
+    // Latin text in NFC, as most text is, and the same text in NFD.
+    vector<char32_t> latin;
+    for (char32_t cp = 0xC0; cp <= 0x17F; ++cp) {
+        if (cp != 0xD7 && cp != 0xF7) {
+            latin.push_back(cp);
+        }
+    }
+    string nfc_input = make_input<utf8_encoding>(1 << 20, latin, 80);
+    string nfd_input;
+    auto out = make_otext_iterator<utf8_encoding>(back_inserter(nfd_input));
+    for (auto c : make_nfd_view(make_text_view<utf8_encoding>(nfc_input))) {
+        *out++ = character_type_t<utf8_encoding>{c.get_code_point()};
+    }
+
+    auto nfc_tv = make_text_view<utf8_encoding>(nfc_input);
+    auto nfd_tv = make_text_view<utf8_encoding>(nfd_input);
+    run_benchmark("is_normalized nfc latin (80% ascii)", nfc_input.size(), [&] {
+        return std::size_t(is_normalized<normalization_form::nfc>(nfc_tv));
+    });
+    run_benchmark("is_normalized nfc latin nfd input", nfd_input.size(), [&] {
+        return std::size_t(is_normalized<normalization_form::nfc>(nfd_tv));
+    });
+    auto bench_view = [](const char *name, const string &input, auto make_view) {
+        auto tv = make_text_view<utf8_encoding>(input);
+        run_benchmark(name, input.size(), [&] {
+            std::size_t sum = 0;
+            for (auto c : make_view(tv)) {
+                sum += c.get_code_point();
+            }
+            return sum;
+        });
+    };
+    auto nfc = [](auto tv) { return make_nfc_view(tv); };
+    auto nfd = [](auto tv) { return make_nfd_view(tv); };
+    bench_view("nfc_view latin (80% ascii)", nfc_input, nfc);
+    bench_view("nfc_view latin nfd input", nfd_input, nfc);
+    bench_view("nfd_view latin (80% ascii)", nfc_input, nfd);
+}
+
+void bench_case_mapping() {
+    vector<char32_t> latin;
+    for (char32_t cp = 0xC0; cp <= 0x17F; ++cp) {
+        latin.push_back(cp);
+    }
+    string ascii_input = make_input<utf8_encoding>(1 << 20, latin, 100);
+    string latin_input = make_input<utf8_encoding>(1 << 20, latin, 80);
+
+    // Case folding a text view, writing the result as UTF-8 through the
+    // view, and through case_fold(), which maps ASCII characters a block at
+    // a time.
+    auto bench_fold = [](const char *name, const string &input, auto fold) {
+        auto tv = make_text_view<utf8_encoding>(input);
+        string output(input.size() * 3, '\0');
+        run_benchmark(name, input.size(), [&] {
+            auto out = make_otext_iterator<utf8_encoding>(&output[0]);
+            return std::size_t(fold(tv, out).base() - &output[0]);
+        });
+    };
+    auto fold_view = [](auto tv, auto out) {
+        for (auto c : make_case_fold_view(tv)) {
+            *out++ = c;
+        }
+        return out;
+    };
+    auto fold = [](auto tv, auto out) {
+        return case_fold(tv, out);
+    };
+    bench_fold("case_fold_view ascii", ascii_input, fold_view);
+    bench_fold("case_fold_view latin (80% ascii)", latin_input, fold_view);
+    bench_fold("case_fold ascii", ascii_input, fold);
+    bench_fold("case_fold latin (80% ascii)", latin_input, fold);
+}
+
+void bench_unicode_properties() {
+    // Property lookups over multilingual prose and over CJK text; each
+    // character requires one lookup.
+    u32string multilingual = make_multilingual_text(1 << 20);
+    u32string cjk;
+    lcg random;
+    while (cjk.size() < (1 << 20)) {
+        cjk += char32_t(0x4E00 + random(0x5000));
+        if (random(20) == 0) {
+            cjk += U'\u3002';
+        }
+    }
+    auto bench_lookups = [](const char *name, const u32string &text) {
+        auto tv = make_text_view<utf32_encoding>(text);
+        run_benchmark(name, text.size(), [&] {
+            std::size_t sum = 0;
+            for (auto c : tv) {
+                auto properties = get_unicode_properties(c);
+                sum += std::size_t(properties.get_general_category())
+                     + std::size_t(properties.get_script())
+                     + properties.is_alphabetic();
+            }
+            return sum;
+        }, "M lookups");
+    };
+    bench_lookups("unicode_properties multilingual", multilingual);
+    bench_lookups("unicode_properties cjk", cjk);
+}
+
+void bench_display_width() {
+    // Display widths of log lines of ASCII text, which are measured a code
+    // unit at a time, and of multilingual text in UTF-8.
+    vector<char32_t> emoji;
+    for (char32_t cp = 0x1F600; cp < 0x1F650; ++cp) {
+        emoji.push_back(cp);
+    }
+    string ascii_input = make_input<utf8_encoding>(1 << 20, emoji, 100);
+    string mixed_input = make_input<utf8_encoding>(1 << 20, emoji, 95);
+    string multilingual_input;
+    auto out = make_otext_iterator<utf8_encoding>(
+        back_inserter(multilingual_input));
+    for (char32_t cp : make_multilingual_text(1 << 19)) {
+        *out++ = character_type_t<utf8_encoding>{cp};
+    }
+    auto bench_width = [](const char *name, const string &input) {
+        auto tv = make_text_view<utf8_encoding>(input);
+        run_benchmark(name, input.size(), [&] {
+            return display_width(tv);
+        });
+    };
+    bench_width("display_width ascii", ascii_input);
+    bench_width("display_width emoji (95% ascii)", mixed_input);
+    bench_width("display_width multilingual", multilingual_input);
+}
+
+void bench_collation() {
+    // Sort keys of short lines, as for sorting report rows, of ASCII text,
+    // which are computed from code units, and of Latin and multilingual text.
+    auto make_lines = [](const string &text) {
+        vector<string> lines;
+        lcg random;
+        for (std::size_t i = 0; i < text.size(); ) {
+            std::size_t n = 16 + random(48);
+            while (i + n < text.size()
+                   && (static_cast<unsigned char>(text[i + n]) & 0xC0) == 0x80)
+            {
+                ++n;
+            }
+            lines.push_back(text.substr(i, n));
+            i += n;
+        }
+        return lines;
+    };
+    vector<char32_t> latin;
+    for (char32_t cp = 0xC0; cp <= 0x17F; ++cp) {
+        latin.push_back(cp);
+    }
+    string multilingual;
+    auto out = make_otext_iterator<utf8_encoding>(back_inserter(multilingual));
+    for (char32_t cp : make_multilingual_text(1 << 18)) {
+        *out++ = character_type_t<utf8_encoding>{cp};
+    }
+    auto bench_keys = [](const char *name, const vector<string> &lines) {
+        std::size_t bytes = 0;
+        for (const auto &line : lines) {
+            bytes += line.size();
+        }
+        string key;
+        run_benchmark(name, bytes, [&] {
+            std::size_t size = 0;
+            for (const auto &line : lines) {
+                key.clear();
+                make_sort_key(make_text_view<utf8_encoding>(line),
+                              back_inserter(key));
+                size += key.size();
+            }
+            return size;
+        });
+    };
+    bench_keys("make_sort_key ascii",
+               make_lines(make_input<utf8_encoding>(1 << 20, latin, 100)));
+    bench_keys("make_sort_key latin (80% ascii)",
+               make_lines(make_input<utf8_encoding>(1 << 20, latin, 80)));
+    bench_keys("make_sort_key multilingual", make_lines(multilingual));
+}
+
+void bench_caseless_search() {
+    // Searching for a name that does not occur, so that the whole text is
+    // searched; runs of ASCII characters that cannot begin a match are
+    // skipped by examining code units.
+    vector<char32_t> latin;
+    for (char32_t cp = 0xC0; cp <= 0x17F; ++cp) {
+        latin.push_back(cp);
+    }
+    string ascii_input = make_input<utf8_encoding>(1 << 20, latin, 100);
+    string latin_input = make_input<utf8_encoding>(1 << 20, latin, 80);
+    string needle{u8"Zo\u00EB"};
+    auto bench_search = [&](const char *name, const string &input,
+                            auto search) {
+        auto tv = make_text_view<utf8_encoding>(input);
+        auto pattern = make_text_view<utf8_encoding>(needle);
+        run_benchmark(name, input.size(), [&] {
+            auto match = search(tv, pattern);
+            return std::size_t(match.begin().base() - input.cbegin());
+        });
+    };
+    auto search = [](auto tv, auto pattern) {
+        return caseless_search(tv, pattern);
+    };
+    auto canonical_search = [](auto tv, auto pattern) {
+        return caseless_search<caseless_matching::canonical_caseless>(
+            tv, pattern);
+    };
+    bench_search("caseless_search ascii", ascii_input, search);
+    bench_search("caseless_search latin (80% ascii)", latin_input, search);
+    bench_search("caseless_search canonical latin (80% ascii)", latin_input,
+                 canonical_search);
+}
+
+void bench_hash_text() {
+    // Hashing the same text as UTF-8, which is hashed from its code units,
+    // and as UTF-16 and UTF-32, which are decoded and hashed as UTF-8.
+    u32string text = make_multilingual_text(1 << 18);
+    string u8_input;
+    auto out = make_otext_iterator<utf8_encoding>(back_inserter(u8_input));
+    for (char32_t cp : text) {
+        *out++ = character_type_t<utf8_encoding>{cp};
+    }
+    u16string u16_input;
+    auto out16 =
+        make_otext_iterator<utf16_encoding>(back_inserter(u16_input));
+    for (char32_t cp : text) {
+        *out16++ = character_type_t<utf16_encoding>{cp};
+    }
+    run_benchmark("hash_text utf8", u8_input.size(), [&] {
+        return hash_text(make_text_view<utf8_encoding>(u8_input));
+    });
+    run_benchmark("hash_text utf8 (array)", u8_input.size(), [&] {
+        return hash_text(make_text_view<utf8_encoding>(
+            u8_input.data(), u8_input.data() + u8_input.size()));
+    });
+    run_benchmark("hash_text utf16", u16_input.size() * 2, [&] {
+        return hash_text(make_text_view<utf16_encoding>(u16_input));
+    });
+    run_benchmark("hash_text utf32", text.size() * 4, [&] {
+        return hash_text(make_text_view<utf32_encoding>(text));
+    });
+}
+
+void bench_regex() {
+    // Searching for patterns that do not occur, so that the whole text is
+    // searched: one whose matches begin with literal text, which is found
+    // first, and one whose matches do not, which is searched for with a DFA.
+    // UTF-8 text is matched on its code units; UTF-32 text is decoded.
+    vector<char32_t> latin;
+    for (char32_t cp = 0xC0; cp <= 0x17F; ++cp) {
+        latin.push_back(cp);
+    }
+    string input = make_input<utf8_encoding>(1 << 20, latin, 80);
+    u32string u32_input;
+    for (auto c : make_text_view<utf8_encoding>(input)) {
+        u32_input += c.get_code_point();
+    }
+    auto bench_search = [&](const char *name, const string &pattern) {
+        text_regex re{make_text_view<utf8_encoding>(pattern)};
+        auto tv = make_text_view<utf8_encoding>(input);
+        run_benchmark((string{"regex_search utf8 "} + name).c_str(),
+                      input.size(), [&] {
+            auto match = regex_search(tv, re);
+            return std::size_t(match.begin().base() - input.cbegin());
+        });
+        auto tv32 = make_text_view<utf32_encoding>(u32_input);
+        run_benchmark((string{"regex_search utf32 "} + name).c_str(),
+                      u32_input.size() * 4, [&] {
+            auto match = regex_search(tv32, re);
+            return std::size_t(match.begin().base() - u32_input.cbegin());
+        });
+    };
+    bench_search("literal prefix", u8"Zo\u00EB\\d{3}");
+    bench_search("no prefix", "\\p{Greek}+\\d");
+}
+
+void bench_edit_distance() {
+    // Distances between consecutive names of about 20 characters, in ASCII
+    // and with 20% Latin letters, and a fuzzy search for a name that does
+    // not occur, so that the whole text is searched.
+    vector<char32_t> latin;
+    for (char32_t cp = 0xC0; cp <= 0x17F; ++cp) {
+        latin.push_back(cp);
+    }
+    auto bench_distances = [&](const char *name, const string &input) {
+        vector<string> names;
+        for (std::size_t i = 0; i + 20 <= input.size(); i += 20) {
+            std::size_t next = i + 20;
+            while (next < input.size()
+                   && (static_cast<unsigned char>(input[next]) & 0xC0)
+                       == 0x80)
+            {
+                ++next;
+            }
+            names.emplace_back(input.begin() + i, input.begin() + next);
+            i = next - 20;
+        }
+        run_benchmark(name, input.size(), [&] {
+            std::size_t total = 0;
+            for (std::size_t i = 1; i < names.size(); ++i) {
+                total += edit_distance(
+                    make_text_view<utf8_encoding>(names[i - 1]),
+                    make_text_view<utf8_encoding>(names[i]));
+            }
+            return total;
+        });
+    };
+    bench_distances("edit_distance ascii",
+                    make_input<utf8_encoding>(1 << 20, latin, 100));
+    bench_distances("edit_distance latin (80% ascii)",
+                    make_input<utf8_encoding>(1 << 20, latin, 80));
+    string input = make_input<utf8_encoding>(1 << 20, latin, 80);
+    string needle{u8"Zoë Smith"};
+    run_benchmark("fuzzy_search latin (80% ascii)", input.size(), [&] {
+        auto tv = make_text_view<utf8_encoding>(input);
+        auto match = fuzzy_search(
+            tv, make_text_view<utf8_encoding>(needle), 2);
+        return std::size_t(match.begin().base() - input.cbegin());
+    });
+}
+
+void bench_diff() {
+    // Diffs of a text of lines of about 100 characters, with 20% Latin
+    // letters, and a copy of it with an ASCII character changed every 4 KiB.
+    vector<char32_t> latin;
+    for (char32_t cp = 0xC0; cp <= 0x17F; ++cp) {
+        latin.push_back(cp);
+    }
+    string input = make_input<utf8_encoding>(1 << 22, latin, 80);
+    std::replace(input.begin(), input.end(), '~', '\n');
+    string edited = input;
+    for (std::size_t i = 0; i < edited.size(); i += 4096) {
+        if (edited[i] >= ' ' && edited[i] < '~') {
+            edited[i] = edited[i] == '#' ? '$' : '#';
+        }
+    }
+    auto bench = [&](const char *name, diff_granularity granularity) {
+        run_benchmark(name, input.size() + edited.size(), [&] {
+            return diff_text(make_text_view<utf8_encoding>(input),
+                             make_text_view<utf8_encoding>(edited),
+                             granularity).size();
+        });
+    };
+    bench("diff_text lines", diff_granularity::line);
+    bench("diff_text code points", diff_granularity::code_point);
+    bench("diff_text graphemes", diff_granularity::grapheme);
+}
+
+void bench_bpe_tokenizer() {
+    // Text of words drawn from a small vocabulary, with some punctuation,
+    // numbers, and Latin letters, tokenized with merges that form each word,
+    // with and without a leading space, a byte at a time.
+    const char *words[] = {
+        "the", "of", "and", "text", "view", "encoding", "character",
+        "iterator", "unicode", "string", "tokenizer", "merge", "byte",
+        u8"caf\u00E9", u8"na\u00EFve", "2016", "'s", ",", "."
+    };
+    vector<pair<string, string>> merges;
+    std::set<string> tokens;
+    for (const char *word : words) {
+        for (string w : { string(word), " " + string(word) }) {
+            for (std::size_t i = 2; i <= w.size(); ++i) {
+                if (tokens.insert(w.substr(0, i)).second) {
+                    merges.emplace_back(w.substr(0, i - 1),
+                                        w.substr(i - 1, 1));
+                }
+            }
+        }
+    }
+    bpe_tokenizer tokenizer{merges};
+    string input;
+    lcg random;
+    while (input.size() < (1 << 22)) {
+        input += ' ';
+        input += words[random(sizeof(words) / sizeof(words[0]))];
+    }
+    run_benchmark("bpe_tokenizer encode", input.size(), [&] {
+        return tokenizer.encode(u8text_view{input}).size();
+    });
+    vector<string> documents;
+    for (std::size_t i = 0; i < input.size(); i += 4096) {
+        documents.push_back(input.substr(i, 4096));
+    }
+    vector<u8text_view> views;
+    for (const string &document : documents) {
+        views.push_back(u8text_view{document});
+    }
+    run_benchmark("bpe_tokenizer encode_batch", input.size(), [&] {
+        return tokenizer.encode_batch(views).size();
+    });
+}
+
+void bench_line_index() {
+    // Lines of 0 to 99 characters, a tenth of which are not ASCII, ending
+    // with LF or CR LF, in UTF-8 and UTF-16.
+    u32string text;
+    lcg random;
+    while (text.size() < (1 << 22)) {
+        for (std::size_t n = random(100); n > 0; --n) {
+            text += random(10) == 0 ? char32_t(0xC0 + random(0x100))
+                                    : char32_t(U'a' + random(26));
+        }
+        if (random(4) == 0) {
+            text += U'\r';
+        }
+        text += U'\n';
+    }
+    string u8_text;
+    u16string u16_text;
+    auto u8_out = make_otext_iterator<utf8_encoding>(back_inserter(u8_text));
+    auto u16_out = make_otext_iterator<utf16_encoding>(
+        back_inserter(u16_text));
+    for (char32_t cp : text) {
+        *u8_out++ = character<unicode_character_set>{cp};
+        *u16_out++ = character<unicode_character_set>{cp};
+    }
+    u8text_view u8_tv{u8_text};
+    u16text_view u16_tv{u16_text};
+    run_benchmark("line_index build utf-8", u8_text.size(), [&] {
+        return make_line_index(u8_tv).line_count();
+    });
+    run_benchmark("line_index build utf-8 unicode", u8_text.size(), [&] {
+        return make_line_index(u8_tv, line_separators::unicode)
+            .line_count();
+    });
+    run_benchmark("line_index build utf-16", u16_text.size() * 2, [&] {
+        return make_line_index(u16_tv).line_count();
+    });
+
+    auto index = make_line_index(u8_tv);
+    vector<std::size_t> offsets;
+    vector<text_position> positions;
+    for (int i = 0; i < (1 << 16); ++i) {
+        offsets.push_back(random(u8_text.size()));
+        positions.push_back(index.position(u8_tv, offsets.back()));
+    }
+    run_benchmark("line_index position utf-8", offsets.size(), [&] {
+        std::size_t sum = 0;
+        for (std::size_t offset : offsets) {
+            sum += index.position(u8_tv, offset).column;
+        }
+        return sum;
+    }, "M lookups");
+    run_benchmark("line_index offset utf-8", positions.size(), [&] {
+        std::size_t sum = 0;
+        for (const text_position &p : positions) {
+            sum += index.offset(u8_tv, p);
+        }
+        return sum;
+    }, "M lookups");
+}
+
+} // unnamed namespace
+
+
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        benchmark_filter = argv[1];
+    }
+
+    bench_unicode_encodings();
+    bench_single_byte_encodings();
+    bench_multi_byte_encodings();
+    bench_segmentation_views();
+    bench_normalization();
+    bench_case_mapping();
+    bench_unicode_properties();
+    bench_display_width();
+    bench_collation();
+    bench_caseless_search();
+    bench_hash_text();
+    bench_regex();
+    bench_edit_distance();
+    bench_diff();
+    bench_bpe_tokenizer();
+    bench_line_index();
+
+    return 0;
+}
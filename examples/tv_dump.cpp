@@ -4,14 +4,17 @@
 // LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
 // and conditions.
 
+#include <cerrno>
 #include <cstdint>
 #include <cstring>
-#include <fstream>
-#include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <text_view>
-#include <text_view_detail/range_based_for.hpp>
 
 using namespace std;
 using namespace std::experimental;
@@ -27,7 +30,8 @@ void usage(
     const char *progname = strrchr(progpath, '/');
     progname = (progname ? progname+1 : progpath);
     os << "usage: " << progpath << endl;
-    os << progname << " --encoding <encoding> <file>" << endl;
+    os << progname << " [--format <format>] --encoding <encoding> <file>"
+       << endl;
     os << "    -h, --help:" << endl;
     os << "        Displays program help." << endl;
     os << "    <file>:" << endl;
@@ -45,25 +49,260 @@ void usage(
     os << "            utf-32-bom  (big endian if no BOM is present)" << endl;
     os << "            utf-32-be" << endl;
     os << "            utf-32-le" << endl;
+    os << "    -f, --format <format>:" << endl;
+    os << "        Specifies the format of the line written for each code"
+       << endl;
+    os << "        point.  Valid formats are:" << endl;
+    os << "            code-point  (the default)" << endl;
+    os << "                0x000000f8 (unicode_character_set)" << endl;
+    os << "            offsets     (code unit offset, code units, code point)"
+       << endl;
+    os << "                12 c3b8 U+00F8" << endl;
+    os << "            json        (a JSON object per line)" << endl;
+    os << "                {\"offset\":12,\"code_units\":\"c3b8\","
+       << "\"code_point\":248}" << endl;
 }
 
+enum class dump_format {
+    code_point,
+    offsets,
+    json
+};
+
+/*
+ * mapped_file
+ * A read only memory mapping of the contents of a file.  Files that cannot be
+ * mapped, such as pipes, are read into memory instead.
+ */
+class mapped_file {
+public:
+    explicit mapped_file(
+        const char *file_name)
+    {
+        int fd = open(file_name, O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                madvise(p, st.st_size, MADV_SEQUENTIAL);
+                data = static_cast<const char *>(p);
+                size = st.st_size;
+                mapped = true;
+            }
+        }
+        if (! mapped) {
+            read_all(fd);
+        }
+        close(fd);
+    }
+    mapped_file(const mapped_file &) = delete;
+    mapped_file& operator=(const mapped_file &) = delete;
+    ~mapped_file() {
+        if (mapped) {
+            munmap(const_cast<char *>(data), size);
+        }
+    }
+
+    explicit operator bool() const noexcept {
+        return data != nullptr;
+    }
+
+    const char *data = nullptr;
+    size_t size = 0;
+
+private:
+    void read_all(
+        int fd)
+    {
+        for (;;) {
+            contents.resize(size + (size_t{1} << 16));
+            ssize_t n = read(fd, &contents[size], contents.size() - size);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0) {
+                return;
+            }
+            if (n == 0) {
+                break;
+            }
+            size += n;
+        }
+        contents.resize(size);
+        data = contents.data();
+    }
+
+    bool mapped = false;
+    string contents;
+};
+
+/*
+ * output_buffer
+ * Formats output into a large buffer that is written to a file descriptor
+ * with a single write(2) call whenever it fills, and when it is destroyed.
+ * Numbers are formatted by hand rather than with iostreams or printf(), so
+ * that formatting a line costs little more than copying its characters.
+ */
+class output_buffer {
+public:
+    explicit output_buffer(
+        int fd)
+    :
+        fd{fd}
+    {}
+    output_buffer(const output_buffer &) = delete;
+    output_buffer& operator=(const output_buffer &) = delete;
+    ~output_buffer() {
+        flush();
+    }
+
+    // Ensures that at least 'n' characters may be written to the buffer
+    // without flushing it.  'n' must not exceed max_line.
+    void reserve(
+        size_t n)
+    {
+        if (next + n > buffer + sizeof(buffer)) {
+            flush();
+        }
+    }
+
+    void put(
+        char c)
+    {
+        *next++ = c;
+    }
+
+    void put(
+        const char *s)
+    {
+        size_t n = strlen(s);
+        memcpy(next, s, n);
+        next += n;
+    }
+
+    // Writes the 'digits' least significant hexadecimal digits of 'value'.
+    void put_hex(
+        uint_least32_t value,
+        int digits)
+    {
+        static const char hex_digits[] = "0123456789abcdef";
+        for (int i = digits - 1; i >= 0; --i) {
+            next[i] = hex_digits[value & 0xF];
+            value >>= 4;
+        }
+        next += digits;
+    }
+
+    void put_upper_hex(
+        uint_least32_t value,
+        int digits)
+    {
+        static const char hex_digits[] = "0123456789ABCDEF";
+        for (int i = digits - 1; i >= 0; --i) {
+            next[i] = hex_digits[value & 0xF];
+            value >>= 4;
+        }
+        next += digits;
+    }
+
+    void put_decimal(
+        uint64_t value)
+    {
+        char digits[20];
+        int n = 0;
+        do {
+            digits[n++] = '0' + value % 10;
+            value /= 10;
+        } while (value);
+        while (n) {
+            *next++ = digits[--n];
+        }
+    }
+
+    void flush() {
+        const char *p = buffer;
+        while (p != next) {
+            ssize_t written = write(fd, p, next - p);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                // Further output is discarded, as by a failed ostream.
+                break;
+            }
+            p += written;
+        }
+        next = buffer;
+    }
+
+    // The length of the longest line written by dump_code_points(), with
+    // room to spare for long character set names.
+    static const size_t max_line = 256;
+
+private:
+    int fd;
+    char buffer[1 << 16];
+    char *next = buffer;
+};
+
+// Writes the code point of each character of the 'size' code units at
+// 'data', decoded in the encoding 'ET', to 'out' in the format 'format'.
 template<TextEncoding ET>
 void dump_code_points(
-    ifstream &ifs)
+    const char *data,
+    size_t size,
+    dump_format format,
+    output_buffer &out)
 {
     using CUT = code_unit_type_t<ET>;
-    istream_iterator<CUT> ifs_in(ifs), ifs_end;
-
-    // FIXME: The C++11 range-based-for requires that the begin and end types
-    // FIXME: be identical.  The RANGE_BASED_FOR macro is used to work around
-    // FIXME: this limitation.
-    auto tv = make_text_view<ET>(ifs_in, ifs_end);
-    RANGE_BASED_FOR (const auto &ch, tv) {
-        auto csid = ch.get_character_set_id();
-        cout << "0x" << hex << setw(8) << setfill('0')
-             << (uint_least32_t)ch.get_code_point()
-             << " (" << get_character_set_info(csid).get_name() << ")"
-             << endl;
+    static_assert(sizeof(CUT) == 1, "code units must be bytes");
+
+    // The name of the character set is looked up only when it changes.
+    const character_set_info *csinfo = nullptr;
+
+    auto tv = make_text_view<ET>(data, data + size);
+    for (auto it = tv.begin(); it != tv.end(); ++it) {
+        out.reserve(output_buffer::max_line);
+        uint_least32_t cp = (*it).get_code_point();
+        const auto &code_units = it.base_range();
+        switch (format) {
+        case dump_format::code_point: {
+            auto csid = (*it).get_character_set_id();
+            if (! csinfo || csinfo->get_id() != csid) {
+                csinfo = &get_character_set_info(csid);
+            }
+            out.put("0x");
+            out.put_hex(cp, 8);
+            out.put(" (");
+            out.put(csinfo->get_name());
+            out.put(")\n");
+            break;
+        }
+        case dump_format::offsets:
+            out.put_decimal(code_units.begin() - data);
+            out.put(' ');
+            for (CUT cu : code_units) {
+                out.put_hex((unsigned char)cu, 2);
+            }
+            out.put(" U+");
+            out.put_upper_hex(cp, cp > 0xFFFF ? (cp > 0xFFFFF ? 6 : 5) : 4);
+            out.put('\n');
+            break;
+        case dump_format::json:
+            out.put("{\"offset\":");
+            out.put_decimal(code_units.begin() - data);
+            out.put(",\"code_units\":\"");
+            for (CUT cu : code_units) {
+                out.put_hex((unsigned char)cu, 2);
+            }
+            out.put("\",\"code_point\":");
+            out.put_decimal(cp);
+            out.put("}\n");
+            break;
+        }
     }
 }
 
@@ -73,6 +312,7 @@ int main(
 {
     const char *file_name = nullptr;
     const char *encoding = nullptr;
+    const char *format_name = nullptr;
 
     for (int i = 1; i < argc; ++i) {
         if (strcmp(argv[i], "-h") == 0 ||
@@ -96,6 +336,21 @@ int main(
             }
             encoding = argv[i];
         }
+        else if (strcmp(argv[i], "-f") == 0 ||
+                 strcmp(argv[i], "--format") == 0)
+        {
+            if (++i >= argc) {
+                cerr << "error: --format operand missing." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            if (format_name) {
+                cerr << "error: --format already specified." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            format_name = argv[i];
+        }
         else {
             if (file_name) {
                 cerr << "error: <file> already specified." << endl;
@@ -118,55 +373,73 @@ int main(
         return exit_user_error;
     }
 
-    ifstream ifs(file_name, ios_base::binary);
-    if (! ifs) {
+    dump_format format = dump_format::code_point;
+    if (! format_name || strcmp(format_name, "code-point") == 0) {
+        format = dump_format::code_point;
+    }
+    else if (strcmp(format_name, "offsets") == 0) {
+        format = dump_format::offsets;
+    }
+    else if (strcmp(format_name, "json") == 0) {
+        format = dump_format::json;
+    }
+    else {
+        cerr << "error: unrecognized format: '" << format_name << "'." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    mapped_file file(file_name);
+    if (! file) {
         cerr << "error: failed to open file " << file_name << "." << endl;
         return exit_failure;
     }
-    ifs >> noskipws;
+    const char *data = file.data;
+    size_t size = file.size;
+    output_buffer out(STDOUT_FILENO);
 
     try {
         if (strcmp(encoding, "utf-8") == 0) {
-            dump_code_points<utf8_encoding>(ifs);
+            dump_code_points<utf8_encoding>(data, size, format, out);
         }
         else if (strcmp(encoding, "utf-8-bom") == 0) {
-            dump_code_points<utf8bom_encoding>(ifs);
+            dump_code_points<utf8bom_encoding>(data, size, format, out);
         }
         else if (strcmp(encoding, "utf-16") == 0) {
             // This endianness detection requires sizeof(char16_t) == 2.
             static_assert(sizeof(char16_t) == 2);
             if (*((unsigned char*)u"\ufeff") == 0xFF) {
-                dump_code_points<utf16le_encoding>(ifs);
+                dump_code_points<utf16le_encoding>(data, size, format, out);
             } else {
-                dump_code_points<utf16be_encoding>(ifs);
+                dump_code_points<utf16be_encoding>(data, size, format, out);
             }
         }
         else if (strcmp(encoding, "utf-16-bom") == 0) {
-            dump_code_points<utf16bom_encoding>(ifs);
+            dump_code_points<utf16bom_encoding>(data, size, format, out);
         }
         else if (strcmp(encoding, "utf-16-be") == 0) {
-            dump_code_points<utf16be_encoding>(ifs);
+            dump_code_points<utf16be_encoding>(data, size, format, out);
         }
         else if (strcmp(encoding, "utf-16-le") == 0) {
-            dump_code_points<utf16le_encoding>(ifs);
+            dump_code_points<utf16le_encoding>(data, size, format, out);
         }
         else if (strcmp(encoding, "utf-32") == 0) {
             // This endianness detection requires sizeof(char32_t) == 4.
             static_assert(sizeof(char32_t) == 4);
             if (*((unsigned char*)U"\U0000feff") == 0xFF) {
-                dump_code_points<utf32le_encoding>(ifs);
+                dump_code_points<utf32le_encoding>(data, size, format, out);
             } else {
-                dump_code_points<utf32be_encoding>(ifs);
+                dump_code_points<utf32be_encoding>(data, size, format, out);
             }
         }
         else if (strcmp(encoding, "utf-32-bom") == 0) {
-            dump_code_points<utf32bom_encoding>(ifs);
+            dump_code_points<utf32bom_encoding>(data, size, format, out);
         }
         else if (strcmp(encoding, "utf-32-be") == 0) {
-            dump_code_points<utf32be_encoding>(ifs);
+            dump_code_points<utf32be_encoding>(data, size, format, out);
         }
         else if (strcmp(encoding, "utf-32-le") == 0) {
-            dump_code_points<utf32le_encoding>(ifs);
+            dump_code_points<utf32le_encoding>(data, size, format, out);
         }
         else {
             cerr << "error: unrecognized encoding: '" << encoding << "'." << endl;
@@ -174,6 +447,7 @@ int main(
             return exit_user_error;
         }
     } catch (const text_runtime_error &tre) {
+        out.flush();
         cerr << "error: " << tre.what() << endl;
         return exit_failure;
     }
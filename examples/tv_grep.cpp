@@ -0,0 +1,604 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+// This program writes the lines of files that contain a literal pattern, in
+// the manner of grep, for files in any of the Unicode encoding forms.  The
+// pattern, given as UTF-8, is encoded in the encoding of each file, and the
+// code units of the file, mapped into memory, are searched for the encoded
+// pattern without decoding them.  Only the lines that contain a match are
+// decoded: to find the column of the match in code points, and to write the
+// line as UTF-8.
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include <text_view>
+
+using namespace std;
+using namespace std::experimental;
+
+static const int exit_match = 0;
+static const int exit_no_match = 1;
+static const int exit_user_error = 2;
+static const int exit_failure = 2;
+
+void usage(
+    ostream &os,
+    const char *progpath)
+{
+    const char *progname = strrchr(progpath, '/');
+    progname = (progname ? progname+1 : progpath);
+    os << "usage: " << progpath << endl;
+    os << progname << " [--encoding <encoding>] [--count] <pattern> <file>..."
+       << endl;
+    os << "    -h, --help:" << endl;
+    os << "        Displays program help." << endl;
+    os << "    <pattern>:" << endl;
+    os << "        Specifies the text to search for, encoded as UTF-8."
+       << endl;
+    os << "    <file>:" << endl;
+    os << "        Specifies a file to search." << endl;
+    os << "    -e, --encoding <encoding>:" << endl;
+    os << "        Specifies the character encoding of the files; defaults"
+       << endl;
+    os << "        to utf-8.  Valid encodings are:" << endl;
+    os << "            utf-8" << endl;
+    os << "            utf-8-bom   (BOM ignored if present)" << endl;
+    os << "            utf-16      (native endian)" << endl;
+    os << "            utf-16-bom  (big endian if no BOM is present)" << endl;
+    os << "            utf-16-be" << endl;
+    os << "            utf-16-le" << endl;
+    os << "            utf-32      (native endian)" << endl;
+    os << "            utf-32-bom  (big endian if no BOM is present)" << endl;
+    os << "            utf-32-be" << endl;
+    os << "            utf-32-le" << endl;
+    os << "    -c, --count:" << endl;
+    os << "        Writes the number of matching lines instead of the lines."
+       << endl;
+    os << "Each matching line is written as <line>:<column>:<text>, preceded"
+       << endl;
+    os << "by <file>: if more than one file is searched.  Lines and columns"
+       << endl;
+    os << "are numbered from 1, and columns count code points.  The exit"
+       << endl;
+    os << "status is 0 if a line matched, 1 if none did, and 2 on error."
+       << endl;
+}
+
+/*
+ * mapped_file
+ * A read only memory mapping of the contents of a file.  Files that cannot be
+ * mapped, such as pipes, are read into memory instead.
+ */
+class mapped_file {
+public:
+    explicit mapped_file(
+        const char *file_name)
+    {
+        int fd = open(file_name, O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                madvise(p, st.st_size, MADV_SEQUENTIAL);
+                data = static_cast<const char *>(p);
+                size = st.st_size;
+                mapped = true;
+            }
+        }
+        if (! mapped) {
+            read_all(fd);
+        }
+        close(fd);
+    }
+    mapped_file(const mapped_file &) = delete;
+    mapped_file& operator=(const mapped_file &) = delete;
+    ~mapped_file() {
+        if (mapped) {
+            munmap(const_cast<char *>(data), size);
+        }
+    }
+
+    explicit operator bool() const noexcept {
+        return data != nullptr;
+    }
+
+    const char *data = nullptr;
+    size_t size = 0;
+
+private:
+    void read_all(
+        int fd)
+    {
+        for (;;) {
+            contents.resize(size + (size_t{1} << 16));
+            ssize_t n = read(fd, &contents[size], contents.size() - size);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0) {
+                return;
+            }
+            if (n == 0) {
+                break;
+            }
+            size += n;
+        }
+        contents.resize(size);
+        data = contents.data();
+    }
+
+    bool mapped = false;
+    string contents;
+};
+
+/*
+ * output_buffer
+ * Accumulates output that is written to standard output with a single
+ * write(2) call whenever it grows large, and when it is destroyed.
+ */
+class output_buffer {
+public:
+    output_buffer() = default;
+    output_buffer(const output_buffer &) = delete;
+    output_buffer& operator=(const output_buffer &) = delete;
+    ~output_buffer() {
+        flush();
+    }
+
+    string& text() {
+        return buffer;
+    }
+
+    void flush_if_full() {
+        if (buffer.size() >= (size_t{1} << 16)) {
+            flush();
+        }
+    }
+
+    void flush() {
+        const char *p = buffer.data();
+        size_t n = buffer.size();
+        while (n) {
+            ssize_t written = write(STDOUT_FILENO, p, n);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+            p += written;
+            n -= written;
+        }
+        buffer.clear();
+    }
+
+private:
+    string buffer;
+};
+
+// Returns a pointer to the first occurrence of the 'n' bytes at 'pattern' in
+// ['first', 'last'), or 'last' if there is none.  With SSE2, sixteen
+// candidate positions are tested at a time by comparing their first and last
+// bytes with those of the pattern, and only positions at which both match
+// are compared in full.
+const char* find_literal(
+    const char *first,
+    const char *last,
+    const char *pattern,
+    size_t n)
+{
+    if (n == 0) {
+        return first;
+    }
+    if (size_t(last - first) < n) {
+        return last;
+    }
+    // Matches begin in ['first', 'stop').
+    const char *stop = last - n + 1;
+#if defined(__SSE2__)
+    const __m128i firsts = _mm_set1_epi8(pattern[0]);
+    const __m128i lasts = _mm_set1_epi8(pattern[n - 1]);
+    while (stop - first >= 16) {
+        __m128i head = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(first));
+        __m128i tail = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(first + n - 1));
+        int mask = _mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(head, firsts),
+                          _mm_cmpeq_epi8(tail, lasts)));
+        while (mask) {
+            const char *candidate = first + __builtin_ctz(mask);
+            if (memcmp(candidate, pattern, n) == 0) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+        first += 16;
+    }
+#endif
+    while (first != stop) {
+        first = static_cast<const char *>(
+            memchr(first, pattern[0], stop - first));
+        if (! first) {
+            return last;
+        }
+        if (memcmp(first, pattern, n) == 0) {
+            return first;
+        }
+        ++first;
+    }
+    return last;
+}
+
+/*
+ * encoded_text
+ * A literal encoded in the encoding of a file, and the size of the code
+ * units of that encoding.  Occurrences of the literal are found only at
+ * offsets from 'base' that are multiples of the code unit size; for UTF-8,
+ * in which no code unit sequence occurs within another, any occurrence
+ * begins on a code point boundary.
+ */
+struct encoded_text {
+    string code_units;
+    size_t unit_size;
+    const char *base;
+
+    // Returns the first occurrence in ['first', 'last'), or 'last'.
+    const char* find(
+        const char *first,
+        const char *last) const
+    {
+        for (;;) {
+            const char *p = find_literal(first, last, code_units.data(),
+                                         code_units.size());
+            if (p == last || (p - base) % unit_size == 0) {
+                return p;
+            }
+            first = p + 1;
+        }
+    }
+
+    // Returns the end of the last occurrence in ['first', 'last'), or
+    // 'first'.  Lines are short, so the occurrence is searched for one code
+    // unit at a time.
+    const char* rfind_end(
+        const char *first,
+        const char *last) const
+    {
+        size_t n = code_units.size();
+        for (const char *p = last; size_t(p - first) >= n; p -= unit_size) {
+            if (memcmp(p - n, code_units.data(), n) == 0) {
+                return p;
+            }
+        }
+        return first;
+    }
+};
+
+// Returns the text view 'tv' encoded in the encoding 'ET'.
+template<TextEncoding ET, TextView TVT>
+string encode_text(
+    const TVT &tv)
+{
+    string code_units;
+    auto out = make_otext_iterator<ET>(back_inserter(code_units));
+    for (auto c : tv) {
+        *out++ = c;
+    }
+    return code_units;
+}
+
+// Decodes the code units ['first', 'last') in the encoding 'ET', and calls
+// 'f' with each code point.  Invalid code unit sequences are decoded as
+// U+FFFD, one code unit at a time.
+template<TextEncoding ET, typename F>
+void decode_leniently(
+    const char *first,
+    const char *last,
+    F f)
+{
+    auto state = ET::initial_state();
+    character_type_t<ET> c;
+    while (first != last) {
+        const char *start = first;
+        try {
+            int decoded_code_units;
+            if (ET::decode(state, first, last, c, decoded_code_units)) {
+                f(c.get_code_point());
+            }
+        } catch (const text_runtime_error &) {
+            first = min(last, start + ET::min_code_units);
+            f(U'\uFFFD');
+        }
+    }
+}
+
+// Writes the lines of the 'size' bytes at 'data', which are code units of
+// the encoding 'ET' beginning at 'offset', that contain 'pattern' to 'out',
+// and returns their number.
+template<TextEncoding ET>
+size_t grep_file(
+    const char *path,
+    const char *data,
+    size_t size,
+    size_t offset,
+    const char *pattern,
+    bool count_only,
+    output_buffer &out)
+{
+    const char *base = data + offset;
+    const char *last = data + size;
+    auto pattern_tv = make_text_view<utf8_encoding>(
+        pattern, pattern + strlen(pattern));
+    encoded_text needle{encode_text<ET>(pattern_tv),
+                        sizeof(code_unit_type_t<ET>) * ET::min_code_units,
+                        base};
+    const char lf[] = "\n";
+    encoded_text newline{encode_text<ET>(make_text_view<utf8_encoding>(
+                             lf, lf + 1)),
+                         needle.unit_size, base};
+
+    size_t matches = 0;
+    size_t line_number = 1;
+    const char *counted = base;
+    const char *next = base;
+    while (next != last) {
+        const char *match = needle.find(next, last);
+        if (match == last) {
+            break;
+        }
+        ++matches;
+        const char *line_first = newline.rfind_end(next, match);
+        const char *line_last = newline.find(match, last);
+        if (! count_only) {
+            // Lines are numbered by counting the newlines that precede
+            // this line and follow the previous one found.
+            for (const char *nl = counted;
+                 (nl = newline.find(nl, line_first)) != line_first;
+                 nl += newline.code_units.size())
+            {
+                ++line_number;
+            }
+            counted = line_first;
+
+            size_t column = 1;
+            decode_leniently<ET>(line_first, match,
+                                 [&](char32_t) { ++column; });
+            string &text = out.text();
+            if (path) {
+                text.append(path).append(1, ':');
+            }
+            text.append(to_string(line_number)).append(1, ':')
+                .append(to_string(column)).append(1, ':');
+            auto utf8_out = make_otext_iterator<utf8_encoding>(
+                back_inserter(text));
+            decode_leniently<ET>(line_first, line_last, [&](char32_t cp) {
+                // Surrogate code points, which only an encoding that
+                // preserves them could produce, cannot be encoded.
+                if (cp >= 0xD800 && cp <= 0xDFFF) {
+                    cp = U'\uFFFD';
+                }
+                *utf8_out++ = character<unicode_character_set>{cp};
+            });
+            if (! text.empty() && text.back() == '\r') {
+                text.pop_back();
+            }
+            text.append(1, '\n');
+            out.flush_if_full();
+        }
+        next = line_last == last ? last
+                                 : line_last + newline.code_units.size();
+    }
+
+    if (count_only) {
+        string &text = out.text();
+        if (path) {
+            text.append(path).append(1, ':');
+        }
+        text.append(to_string(matches)).append(1, '\n');
+    }
+    return matches;
+}
+
+// Returns the length of the BOM 'bom' of 'length' bytes at the start of the
+// 'size' bytes at 'data', or 0 if it is not present.
+size_t bom_length(
+    const char *data,
+    size_t size,
+    const char *bom,
+    size_t length)
+{
+    return size >= length && memcmp(data, bom, length) == 0 ? length : 0;
+}
+
+// Searches the 'size' bytes at 'data' in the encoding named 'encoding', and
+// returns the number of matching lines, or -1 if the encoding is not
+// recognized.  BOMs are read here, and the byte order they specify selected.
+long long grep_encoded_file(
+    const char *encoding,
+    const char *path,
+    const char *data,
+    size_t size,
+    const char *pattern,
+    bool count_only,
+    output_buffer &out)
+{
+    size_t n;
+    if (strcmp(encoding, "utf-8") == 0) {
+        return grep_file<utf8_encoding>(
+            path, data, size, 0, pattern, count_only, out);
+    }
+    if (strcmp(encoding, "utf-8-bom") == 0) {
+        return grep_file<utf8_encoding>(
+            path, data, size, bom_length(data, size, "\xEF\xBB\xBF", 3),
+            pattern, count_only, out);
+    }
+    if (strcmp(encoding, "utf-16") == 0) {
+        // This endianness detection requires sizeof(char16_t) == 2.
+        static_assert(sizeof(char16_t) == 2);
+        if (*((unsigned char*)u"\ufeff") == 0xFF) {
+            return grep_file<utf16le_encoding>(
+                path, data, size, 0, pattern, count_only, out);
+        }
+        return grep_file<utf16be_encoding>(
+            path, data, size, 0, pattern, count_only, out);
+    }
+    if (strcmp(encoding, "utf-16-bom") == 0) {
+        if ((n = bom_length(data, size, "\xFF\xFE", 2))) {
+            return grep_file<utf16le_encoding>(
+                path, data, size, n, pattern, count_only, out);
+        }
+        return grep_file<utf16be_encoding>(
+            path, data, size, bom_length(data, size, "\xFE\xFF", 2),
+            pattern, count_only, out);
+    }
+    if (strcmp(encoding, "utf-16-be") == 0) {
+        return grep_file<utf16be_encoding>(
+            path, data, size, 0, pattern, count_only, out);
+    }
+    if (strcmp(encoding, "utf-16-le") == 0) {
+        return grep_file<utf16le_encoding>(
+            path, data, size, 0, pattern, count_only, out);
+    }
+    if (strcmp(encoding, "utf-32") == 0) {
+        // This endianness detection requires sizeof(char32_t) == 4.
+        static_assert(sizeof(char32_t) == 4);
+        if (*((unsigned char*)U"\U0000feff") == 0xFF) {
+            return grep_file<utf32le_encoding>(
+                path, data, size, 0, pattern, count_only, out);
+        }
+        return grep_file<utf32be_encoding>(
+            path, data, size, 0, pattern, count_only, out);
+    }
+    if (strcmp(encoding, "utf-32-bom") == 0) {
+        if ((n = bom_length(data, size, "\xFF\xFE\0\0", 4))) {
+            return grep_file<utf32le_encoding>(
+                path, data, size, n, pattern, count_only, out);
+        }
+        return grep_file<utf32be_encoding>(
+            path, data, size, bom_length(data, size, "\0\0\xFE\xFF", 4),
+            pattern, count_only, out);
+    }
+    if (strcmp(encoding, "utf-32-be") == 0) {
+        return grep_file<utf32be_encoding>(
+            path, data, size, 0, pattern, count_only, out);
+    }
+    if (strcmp(encoding, "utf-32-le") == 0) {
+        return grep_file<utf32le_encoding>(
+            path, data, size, 0, pattern, count_only, out);
+    }
+    return -1;
+}
+
+int main(
+    int argc,
+    char *argv[])
+{
+    const char *encoding = nullptr;
+    const char *pattern = nullptr;
+    bool count_only = false;
+    int first_file = argc;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-h") == 0 ||
+            strcmp(argv[i], "--help") == 0)
+        {
+            usage(cout, argv[0]);
+            return exit_match;
+        }
+        else if (strcmp(argv[i], "-e") == 0 ||
+                 strcmp(argv[i], "--encoding") == 0)
+        {
+            if (++i >= argc) {
+                cerr << "error: --encoding operand missing." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            if (encoding) {
+                cerr << "error: --encoding already specified." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            encoding = argv[i];
+        }
+        else if (strcmp(argv[i], "-c") == 0 ||
+                 strcmp(argv[i], "--count") == 0)
+        {
+            count_only = true;
+        }
+        else if (! pattern) {
+            pattern = argv[i];
+        }
+        else {
+            first_file = i;
+            break;
+        }
+    }
+
+    if (! pattern) {
+        cerr << "error: <pattern> not specified." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    if (first_file == argc) {
+        cerr << "error: <file> not specified." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    if (! encoding) {
+        encoding = "utf-8";
+    }
+
+    int status = exit_no_match;
+    output_buffer out;
+    for (int i = first_file; i < argc; ++i) {
+        const char *path = argc - first_file > 1 ? argv[i] : nullptr;
+        mapped_file file(argv[i]);
+        if (! file) {
+            out.flush();
+            cerr << "error: failed to open file " << argv[i] << "." << endl;
+            status = exit_failure;
+            continue;
+        }
+        long long matches;
+        try {
+            matches = grep_encoded_file(encoding, path, file.data, file.size,
+                                        pattern, count_only, out);
+        } catch (const text_runtime_error &tre) {
+            out.flush();
+            cerr << "error: invalid pattern: " << tre.what() << endl;
+            return exit_user_error;
+        }
+        if (matches < 0) {
+            out.flush();
+            cerr << "error: unrecognized encoding: '" << encoding << "'."
+                 << endl;
+            usage(cerr, argv[0]);
+            return exit_user_error;
+        }
+        if (matches > 0 && status == exit_no_match) {
+            status = exit_match;
+        }
+    }
+
+    return status;
+}
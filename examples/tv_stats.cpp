@@ -0,0 +1,722 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+// This program reports statistics of the code points of a file: the number of
+// occurrences of each code point, Unicode plane, and script, and the number of
+// invalid code unit sequences.  The file is mapped into memory and divided
+// into chunks that begin on code point boundaries, which are decoded
+// concurrently by a pool of threads.  Each thread counts code points in its
+// own histogram; the histograms are summed once all chunks are decoded, and
+// the plane and script counts are derived from the sum.
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <text_view>
+
+using namespace std;
+using namespace std::experimental;
+
+static const int exit_success = 0;
+static const int exit_failure = 1;
+static const int exit_user_error = 2;
+
+void usage(
+    ostream &os,
+    const char *progpath)
+{
+    const char *progname = strrchr(progpath, '/');
+    progname = (progname ? progname+1 : progpath);
+    os << "usage: " << progpath << endl;
+    os << progname << " [--threads <n>] [--top <n>] --encoding <encoding>"
+       << " <file>" << endl;
+    os << "    -h, --help:" << endl;
+    os << "        Displays program help." << endl;
+    os << "    <file>:" << endl;
+    os << "        Specifies the file to analyze." << endl;
+    os << "    -e, --encoding <encoding>:" << endl;
+    os << "        Specifies the character encoding of <file>." << endl;
+    os << "        Valid encodings are:" << endl;
+    os << "            utf-8" << endl;
+    os << "            utf-8-bom   (BOM ignored if present)" << endl;
+    os << "            utf-16      (native endian)" << endl;
+    os << "            utf-16-bom  (big endian if no BOM is present)" << endl;
+    os << "            utf-16-be" << endl;
+    os << "            utf-16-le" << endl;
+    os << "            utf-32      (native endian)" << endl;
+    os << "            utf-32-bom  (big endian if no BOM is present)" << endl;
+    os << "            utf-32-be" << endl;
+    os << "            utf-32-le" << endl;
+    os << "    -t, --threads <n>:" << endl;
+    os << "        Specifies the number of threads; defaults to the number"
+       << endl;
+    os << "        of hardware threads." << endl;
+    os << "    --top <n>:" << endl;
+    os << "        Specifies the number of most frequent code points to list;"
+       << endl;
+    os << "        defaults to 10." << endl;
+}
+
+/*
+ * mapped_file
+ * A read only memory mapping of the contents of a file.  Files that cannot be
+ * mapped, such as pipes, are read into memory instead.
+ */
+class mapped_file {
+public:
+    explicit mapped_file(
+        const char *file_name)
+    {
+        int fd = open(file_name, O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                madvise(p, st.st_size, MADV_SEQUENTIAL);
+                data = static_cast<const unsigned char *>(p);
+                size = st.st_size;
+                mapped = true;
+            }
+        }
+        if (! mapped) {
+            read_all(fd);
+        }
+        close(fd);
+    }
+    mapped_file(const mapped_file &) = delete;
+    mapped_file& operator=(const mapped_file &) = delete;
+    ~mapped_file() {
+        if (mapped) {
+            munmap(const_cast<unsigned char *>(data), size);
+        }
+    }
+
+    explicit operator bool() const noexcept {
+        return data != nullptr;
+    }
+
+    const unsigned char *data = nullptr;
+    size_t size = 0;
+
+private:
+    void read_all(
+        int fd)
+    {
+        for (;;) {
+            contents.resize(size + (size_t{1} << 16));
+            ssize_t n = read(fd, &contents[size], contents.size() - size);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0) {
+                return;
+            }
+            if (n == 0) {
+                break;
+            }
+            size += n;
+        }
+        contents.resize(size);
+        data = reinterpret_cast<const unsigned char *>(contents.data());
+    }
+
+    bool mapped = false;
+    string contents;
+};
+
+/*
+ * code_point_histogram
+ * Counts of occurrences of code points, held in pages of 256 code points that
+ * are allocated when a code point of the page is first counted, so that text
+ * in a few scripts needs only a few kilobytes per thread.
+ */
+class code_point_histogram {
+public:
+    static const char32_t code_point_limit = 0x110000;
+    static const int page_bits = 8;
+    static const size_t page_size = size_t{1} << page_bits;
+    static const size_t page_count = code_point_limit >> page_bits;
+
+    void add(
+        char32_t cp,
+        uint64_t n = 1)
+    {
+        auto &page = pages[cp >> page_bits];
+        if (! page) {
+            page.reset(new uint64_t[page_size]());
+        }
+        page[cp & (page_size - 1)] += n;
+    }
+
+    uint64_t count(
+        char32_t cp) const noexcept
+    {
+        const auto &page = pages[cp >> page_bits];
+        return page ? page[cp & (page_size - 1)] : 0;
+    }
+
+    void merge(
+        const code_point_histogram &other)
+    {
+        for (size_t p = 0; p < page_count; ++p) {
+            if (! other.pages[p]) {
+                continue;
+            }
+            for (size_t i = 0; i < page_size; ++i) {
+                if (other.pages[p][i]) {
+                    add(char32_t(p << page_bits | i), other.pages[p][i]);
+                }
+            }
+        }
+    }
+
+    // Calls 'f' with each code point that has a count, and its count, in
+    // code point order.
+    template<typename F>
+    void for_each(
+        F f) const
+    {
+        for (size_t p = 0; p < page_count; ++p) {
+            if (! pages[p]) {
+                continue;
+            }
+            for (size_t i = 0; i < page_size; ++i) {
+                if (pages[p][i]) {
+                    f(char32_t(p << page_bits | i), pages[p][i]);
+                }
+            }
+        }
+    }
+
+private:
+    unique_ptr<uint64_t[]> pages[page_count];
+};
+
+/*
+ * text_stats
+ * The statistics gathered by one thread.  'first_error' is the offset of the
+ * first invalid code unit sequence, or the file size if there is none.
+ */
+struct text_stats {
+    code_point_histogram code_points;
+    uint64_t code_point_count = 0;
+    uint64_t error_count = 0;
+    size_t first_error = SIZE_MAX;
+
+    void merge(
+        const text_stats &other)
+    {
+        code_points.merge(other.code_points);
+        code_point_count += other.code_point_count;
+        error_count += other.error_count;
+        first_error = min(first_error, other.first_error);
+    }
+};
+
+// The chunk boundary functions return the offset of the first code point
+// boundary at or after 'offset' in the 'size' bytes at 'data'.  Each encoding
+// is self synchronizing, so a boundary is found by inspecting at most a few
+// code units.
+size_t chunk_boundary(
+    utf8_encoding,
+    const unsigned char *data,
+    size_t size,
+    size_t offset)
+{
+    // Skip at most three continuation code units; a longer run is invalid
+    // and is reported by whichever chunk decodes it.
+    for (int i = 0; i < 3 && offset < size && (data[offset] & 0xC0) == 0x80;
+         ++i)
+    {
+        ++offset;
+    }
+    return offset;
+}
+
+size_t utf16_chunk_boundary(
+    const unsigned char *data,
+    size_t size,
+    size_t offset,
+    bool big_endian)
+{
+    offset &= ~size_t{1};
+    if (offset + 1 < size) {
+        unsigned char high = data[offset + (big_endian ? 0 : 1)];
+        if (high >= 0xDC && high <= 0xDF) {
+            // A low surrogate belongs to the code point before it.
+            offset += 2;
+        }
+    }
+    return offset;
+}
+
+size_t chunk_boundary(
+    utf16be_encoding,
+    const unsigned char *data,
+    size_t size,
+    size_t offset)
+{
+    return utf16_chunk_boundary(data, size, offset, true);
+}
+
+size_t chunk_boundary(
+    utf16le_encoding,
+    const unsigned char *data,
+    size_t size,
+    size_t offset)
+{
+    return utf16_chunk_boundary(data, size, offset, false);
+}
+
+size_t chunk_boundary(
+    utf32be_encoding,
+    const unsigned char *,
+    size_t,
+    size_t offset)
+{
+    return offset & ~size_t{3};
+}
+
+size_t chunk_boundary(
+    utf32le_encoding,
+    const unsigned char *,
+    size_t,
+    size_t offset)
+{
+    return offset & ~size_t{3};
+}
+
+// Decodes the code point at 'next' in the chunk ending at 'last' of the file
+// that begins at 'data', counts it, and advances 'next' past it.  An invalid
+// code unit sequence is counted as an error and decoding resumes after its
+// first code unit, or for an incomplete sequence at the end of the chunk, at
+// the end of the chunk.
+template<TextEncoding ET>
+void count_code_point(
+    const unsigned char *data,
+    const unsigned char *&next,
+    const unsigned char *last,
+    typename ET::state_type &state,
+    text_stats &stats)
+{
+    const unsigned char *start = next;
+    try {
+        character_type_t<ET> c;
+        int decoded_code_units;
+        if (ET::decode(state, next, last, c, decoded_code_units)) {
+            char32_t cp = c.get_code_point();
+            if (cp >= code_point_histogram::code_point_limit) {
+                throw text_decode_error("Invalid code point");
+            }
+            stats.code_points.add(cp);
+            ++stats.code_point_count;
+        }
+    } catch (const text_decode_error &) {
+        ++stats.error_count;
+        stats.first_error = min<size_t>(stats.first_error, start - data);
+        next = start + ET::min_code_units;
+    } catch (const text_decode_underflow_error &) {
+        ++stats.error_count;
+        stats.first_error = min<size_t>(stats.first_error, start - data);
+        next = last;
+    }
+}
+
+// Counts the code points of the chunk ['first', 'last') of the file that
+// begins at 'data'.
+template<TextEncoding ET>
+void collect_stats(
+    const unsigned char *data,
+    const unsigned char *first,
+    const unsigned char *last,
+    text_stats &stats)
+{
+    auto state = ET::initial_state();
+    while (first != last) {
+        count_code_point<ET>(data, first, last, state, stats);
+    }
+}
+
+// ASCII code units, which dominate most UTF-8 text, are counted in a local
+// array without decoding them; only other code units are decoded.
+template<>
+void collect_stats<utf8_encoding>(
+    const unsigned char *data,
+    const unsigned char *first,
+    const unsigned char *last,
+    text_stats &stats)
+{
+    auto state = utf8_encoding::initial_state();
+    uint64_t ascii_counts[0x80] = {};
+    uint64_t ascii_count = 0;
+    while (first != last) {
+        const unsigned char *run = first;
+        while (first != last && *first < 0x80) {
+            ++ascii_counts[*first++];
+        }
+        ascii_count += first - run;
+        if (first != last) {
+            count_code_point<utf8_encoding>(data, first, last, state, stats);
+        }
+    }
+    for (char32_t cp = 0; cp < 0x80; ++cp) {
+        if (ascii_counts[cp]) {
+            stats.code_points.add(cp, ascii_counts[cp]);
+        }
+    }
+    stats.code_point_count += ascii_count;
+}
+
+const char* plane_name(
+    unsigned plane)
+{
+    static const char *names[] = {
+        "Basic Multilingual Plane",
+        "Supplementary Multilingual Plane",
+        "Supplementary Ideographic Plane",
+        "Tertiary Ideographic Plane",
+        "Supplementary Special-purpose Plane",
+        "Supplementary Private Use Area-A",
+        "Supplementary Private Use Area-B"
+    };
+    if (plane == 0) {
+        return names[0];
+    }
+    if (plane <= 3) {
+        return names[plane];
+    }
+    if (plane == 14) {
+        return names[4];
+    }
+    if (plane >= 15) {
+        return names[plane - 10];
+    }
+    return "Unassigned plane";
+}
+
+void print_percentage(
+    ostream &os,
+    uint64_t n,
+    uint64_t total)
+{
+    os << fixed << setprecision(2) << setw(7)
+       << (total ? 100.0 * n / total : 0.0) << '%';
+}
+
+void print_stats(
+    ostream &os,
+    const text_stats &stats,
+    size_t size,
+    size_t top,
+    double seconds)
+{
+    using table_type = text_detail::unicode_property_table;
+    const size_t script_count = extent<decltype(table_type::script_names)>();
+
+    uint64_t plane_counts[17] = {};
+    vector<uint64_t> script_counts(script_count);
+    vector<pair<uint64_t, char32_t>> frequent;
+    uint64_t distinct = 0;
+    stats.code_points.for_each([&](char32_t cp, uint64_t n) {
+        ++distinct;
+        plane_counts[cp >> 16] += n;
+        script_counts[static_cast<size_t>(
+            get_unicode_properties(cp).get_script())] += n;
+        frequent.emplace_back(n, cp);
+    });
+
+    os << "bytes:                " << size << '\n';
+    os << "code points:          " << stats.code_point_count << '\n';
+    os << "distinct code points: " << distinct << '\n';
+    os << "decode errors:        " << stats.error_count << '\n';
+    if (stats.error_count) {
+        os << "first error offset:   " << stats.first_error << '\n';
+    }
+    os << "elapsed seconds:      " << fixed << setprecision(3) << seconds
+       << '\n';
+    os << "throughput (MB/s):    " << fixed << setprecision(1)
+       << (seconds > 0 ? size / seconds / 1e6 : 0.0) << '\n';
+
+    os << "\nplanes:\n";
+    for (unsigned plane = 0; plane < 17; ++plane) {
+        if (plane_counts[plane]) {
+            os << "  " << setw(2) << plane << "  " << setw(14)
+               << plane_counts[plane] << ' ';
+            print_percentage(os, plane_counts[plane],
+                             stats.code_point_count);
+            os << "  " << plane_name(plane) << '\n';
+        }
+    }
+
+    vector<pair<uint64_t, size_t>> scripts;
+    for (size_t s = 0; s < script_count; ++s) {
+        if (script_counts[s]) {
+            scripts.emplace_back(script_counts[s], s);
+        }
+    }
+    sort(scripts.begin(), scripts.end(),
+         [](const auto &a, const auto &b) {
+             return a.first != b.first ? a.first > b.first
+                                       : a.second < b.second;
+         });
+    os << "\nscripts:\n";
+    for (const auto &s : scripts) {
+        os << "  " << setw(14) << s.first << ' ';
+        print_percentage(os, s.first, stats.code_point_count);
+        os << "  " << table_type::script_names[s.second] << '\n';
+    }
+
+    top = min(top, frequent.size());
+    partial_sort(frequent.begin(), frequent.begin() + top, frequent.end(),
+                 [](const auto &a, const auto &b) {
+                     return a.first != b.first ? a.first > b.first
+                                               : a.second < b.second;
+                 });
+    os << "\nmost frequent code points:\n";
+    for (size_t i = 0; i < top; ++i) {
+        os << "  U+" << hex << uppercase << setw(4) << setfill('0')
+           << (uint_least32_t)frequent[i].second << dec << nouppercase
+           << setfill(' ') << "  " << setw(14) << frequent[i].first << ' ';
+        print_percentage(os, frequent[i].first, stats.code_point_count);
+        os << '\n';
+    }
+}
+
+// Gathers the statistics of the bytes ['offset', 'size') of 'data' in the
+// encoding 'ET' with 'threads' threads and prints them.
+template<TextEncoding ET>
+void analyze(
+    const unsigned char *data,
+    size_t size,
+    size_t offset,
+    unsigned threads,
+    size_t top)
+{
+    auto start_time = chrono::steady_clock::now();
+
+    // Chunks are small enough that threads that finish early take over the
+    // remaining work, but large enough that finding their boundaries and
+    // scheduling them is negligible.
+    const size_t chunk_size = size_t{1} << 22;
+    vector<size_t> boundaries{offset};
+    for (size_t b = offset + chunk_size; b < size; b += chunk_size) {
+        size_t boundary = chunk_boundary(ET{}, data, size, b);
+        if (boundary > boundaries.back() && boundary < size) {
+            boundaries.push_back(boundary);
+        }
+    }
+    boundaries.push_back(size);
+    size_t chunk_count = boundaries.size() - 1;
+
+    threads = min<size_t>(threads, max<size_t>(chunk_count, 1));
+    vector<text_stats> thread_stats(threads);
+    atomic<size_t> next_chunk{0};
+    auto work = [&](text_stats &stats) {
+        for (size_t i; (i = next_chunk++) < chunk_count; ) {
+            collect_stats<ET>(data, data + boundaries[i],
+                              data + boundaries[i + 1], stats);
+        }
+    };
+    vector<thread> workers;
+    for (unsigned t = 1; t < threads; ++t) {
+        workers.emplace_back(work, ref(thread_stats[t]));
+    }
+    work(thread_stats[0]);
+    for (thread &worker : workers) {
+        worker.join();
+    }
+    for (unsigned t = 1; t < threads; ++t) {
+        thread_stats[0].merge(thread_stats[t]);
+    }
+    if (thread_stats[0].first_error == SIZE_MAX) {
+        thread_stats[0].first_error = size;
+    }
+
+    chrono::duration<double> elapsed =
+        chrono::steady_clock::now() - start_time;
+    print_stats(cout, thread_stats[0], size, top, elapsed.count());
+}
+
+// Returns the offset of the first code unit after a BOM of 'length' bytes
+// matching 'bom' at the start of 'data', or 0 if there is none.
+size_t bom_length(
+    const unsigned char *data,
+    size_t size,
+    const char *bom,
+    size_t length)
+{
+    return size >= length && memcmp(data, bom, length) == 0 ? length : 0;
+}
+
+int main(
+    int argc,
+    char *argv[])
+{
+    const char *file_name = nullptr;
+    const char *encoding = nullptr;
+    unsigned threads = 0;
+    size_t top = 10;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-h") == 0 ||
+            strcmp(argv[i], "--help") == 0)
+        {
+            usage(cout, argv[0]);
+            return exit_success;
+        }
+        else if (strcmp(argv[i], "-e") == 0 ||
+                 strcmp(argv[i], "--encoding") == 0)
+        {
+            if (++i >= argc) {
+                cerr << "error: --encoding operand missing." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            if (encoding) {
+                cerr << "error: --encoding already specified." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            encoding = argv[i];
+        }
+        else if (strcmp(argv[i], "-t") == 0 ||
+                 strcmp(argv[i], "--threads") == 0)
+        {
+            if (++i >= argc || atoi(argv[i]) <= 0) {
+                cerr << "error: --threads requires a positive number."
+                     << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            threads = atoi(argv[i]);
+        }
+        else if (strcmp(argv[i], "--top") == 0) {
+            if (++i >= argc || atoi(argv[i]) < 0) {
+                cerr << "error: --top requires a number." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            top = atoi(argv[i]);
+        }
+        else {
+            if (file_name) {
+                cerr << "error: <file> already specified." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            file_name = argv[i];
+        }
+    }
+
+    if (! file_name) {
+        cerr << "error: <file> not specified." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    if (! encoding) {
+        cerr << "error: --encoding not specified." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    if (threads == 0) {
+        threads = max(1u, thread::hardware_concurrency());
+    }
+
+    mapped_file file(file_name);
+    if (! file) {
+        cerr << "error: failed to open file " << file_name << "." << endl;
+        return exit_failure;
+    }
+    const unsigned char *data = file.data;
+    size_t size = file.size;
+
+    // BOMs are skipped here, and the byte order they specify selected, so
+    // that every chunk is decoded with a stateless encoding.
+    if (strcmp(encoding, "utf-8") == 0) {
+        analyze<utf8_encoding>(data, size, 0, threads, top);
+    }
+    else if (strcmp(encoding, "utf-8-bom") == 0) {
+        analyze<utf8_encoding>(
+            data, size, bom_length(data, size, "\xEF\xBB\xBF", 3),
+            threads, top);
+    }
+    else if (strcmp(encoding, "utf-16") == 0) {
+        // This endianness detection requires sizeof(char16_t) == 2.
+        static_assert(sizeof(char16_t) == 2);
+        if (*((unsigned char*)u"\ufeff") == 0xFF) {
+            analyze<utf16le_encoding>(data, size, 0, threads, top);
+        } else {
+            analyze<utf16be_encoding>(data, size, 0, threads, top);
+        }
+    }
+    else if (strcmp(encoding, "utf-16-bom") == 0) {
+        if (size_t n = bom_length(data, size, "\xFF\xFE", 2)) {
+            analyze<utf16le_encoding>(data, size, n, threads, top);
+        } else {
+            analyze<utf16be_encoding>(
+                data, size, bom_length(data, size, "\xFE\xFF", 2),
+                threads, top);
+        }
+    }
+    else if (strcmp(encoding, "utf-16-be") == 0) {
+        analyze<utf16be_encoding>(data, size, 0, threads, top);
+    }
+    else if (strcmp(encoding, "utf-16-le") == 0) {
+        analyze<utf16le_encoding>(data, size, 0, threads, top);
+    }
+    else if (strcmp(encoding, "utf-32") == 0) {
+        // This endianness detection requires sizeof(char32_t) == 4.
+        static_assert(sizeof(char32_t) == 4);
+        if (*((unsigned char*)U"\U0000feff") == 0xFF) {
+            analyze<utf32le_encoding>(data, size, 0, threads, top);
+        } else {
+            analyze<utf32be_encoding>(data, size, 0, threads, top);
+        }
+    }
+    else if (strcmp(encoding, "utf-32-bom") == 0) {
+        if (size_t n = bom_length(data, size, "\xFF\xFE\0\0", 4)) {
+            analyze<utf32le_encoding>(data, size, n, threads, top);
+        } else {
+            analyze<utf32be_encoding>(
+                data, size, bom_length(data, size, "\0\0\xFE\xFF", 4),
+                threads, top);
+        }
+    }
+    else if (strcmp(encoding, "utf-32-be") == 0) {
+        analyze<utf32be_encoding>(data, size, 0, threads, top);
+    }
+    else if (strcmp(encoding, "utf-32-le") == 0) {
+        analyze<utf32le_encoding>(data, size, 0, threads, top);
+    }
+    else {
+        cerr << "error: unrecognized encoding: '" << encoding << "'." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    return exit_success;
+}
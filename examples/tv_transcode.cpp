@@ -0,0 +1,1087 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+// This program converts a file from one Unicode encoding to another, in the
+// manner of iconv.  The file is mapped into memory and divided into chunks
+// that begin on code point boundaries, which is possible because each of the
+// supported encodings is self synchronizing once a BOM, if any, has been
+// read.  Chunks are converted concurrently by a pool of threads, each into its
+// own output buffer, and the buffers are written in order.  Within a chunk,
+// code points are decoded a block at a time into an array, and the array is
+// then encoded, so that each pair of encodings does not require its own
+// conversion loop.
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <text_view>
+
+using namespace std;
+using namespace std::experimental;
+
+static const int exit_success = 0;
+static const int exit_failure = 1;
+static const int exit_user_error = 2;
+
+void usage(
+    ostream &os,
+    const char *progpath)
+{
+    const char *progname = strrchr(progpath, '/');
+    progname = (progname ? progname+1 : progpath);
+    os << "usage: " << progpath << endl;
+    os << progname << " --from <encoding> --to <encoding> [--bom]" << endl;
+    os << "    [--errors <mode>] [--threads <n>] [--output <file>] <file>"
+       << endl;
+    os << "    -h, --help:" << endl;
+    os << "        Displays program help." << endl;
+    os << "    <file>:" << endl;
+    os << "        Specifies the file to convert." << endl;
+    os << "    -f, --from <encoding>:" << endl;
+    os << "        Specifies the character encoding of <file>." << endl;
+    os << "    -t, --to <encoding>:" << endl;
+    os << "        Specifies the character encoding to convert to." << endl;
+    os << "        Valid encodings are:" << endl;
+    os << "            utf-8" << endl;
+    os << "            utf-8-bom        (BOM ignored if present)" << endl;
+    os << "            cesu-8" << endl;
+    os << "            modified-utf-8" << endl;
+    os << "            wtf-8" << endl;
+    os << "            utf-16           (native endian)" << endl;
+    os << "            utf-16-bom       (big endian if no BOM is present)"
+       << endl;
+    os << "            utf-16-be" << endl;
+    os << "            utf-16-le" << endl;
+    os << "            utf-16-lossless  (native endian, unpaired surrogates)"
+       << endl;
+    os << "            utf-32           (native endian)" << endl;
+    os << "            utf-32-bom       (big endian if no BOM is present)"
+       << endl;
+    os << "            utf-32-be" << endl;
+    os << "            utf-32-le" << endl;
+    os << "    -b, --bom:" << endl;
+    os << "        Writes a BOM at the start of the output; valid for the"
+       << endl;
+    os << "        UTF-8, UTF-16, and UTF-32 encodings." << endl;
+    os << "    -e, --errors <mode>:" << endl;
+    os << "        Specifies the handling of code unit sequences that are"
+       << endl;
+    os << "        invalid in the input encoding, and code points that are"
+       << endl;
+    os << "        not representable in the output encoding:" << endl;
+    os << "            strict   (the default) stops at the first error"
+       << endl;
+    os << "            replace  writes U+FFFD in their place" << endl;
+    os << "    -j, --threads <n>:" << endl;
+    os << "        Specifies the number of threads; defaults to the number"
+       << endl;
+    os << "        of hardware threads." << endl;
+    os << "    -o, --output <file>:" << endl;
+    os << "        Specifies the file to write; defaults to standard output."
+       << endl;
+}
+
+enum class error_mode {
+    strict,
+    replace
+};
+
+// The BOM written at the start of the output.  'written' writes the BOM that
+// the encoding writes by default, big endian for UTF-16 and UTF-32.
+enum class bom_mode {
+    none,
+    written,
+    big_endian,
+    little_endian
+};
+
+/*
+ * mapped_file
+ * A read only memory mapping of the contents of a file.  Files that cannot be
+ * mapped, such as pipes, are read into memory instead.
+ */
+class mapped_file {
+public:
+    explicit mapped_file(
+        const char *file_name)
+    {
+        int fd = open(file_name, O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                madvise(p, st.st_size, MADV_SEQUENTIAL);
+                data = static_cast<const char *>(p);
+                size = st.st_size;
+                mapped = true;
+            }
+        }
+        if (! mapped) {
+            read_all(fd);
+        }
+        close(fd);
+    }
+    mapped_file(const mapped_file &) = delete;
+    mapped_file& operator=(const mapped_file &) = delete;
+    ~mapped_file() {
+        if (mapped) {
+            munmap(const_cast<char *>(data), size);
+        }
+    }
+
+    explicit operator bool() const noexcept {
+        return data != nullptr;
+    }
+
+    const char *data = nullptr;
+    size_t size = 0;
+
+private:
+    void read_all(
+        int fd)
+    {
+        for (;;) {
+            contents.resize(size + (size_t{1} << 16));
+            ssize_t n = read(fd, &contents[size], contents.size() - size);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0) {
+                return;
+            }
+            if (n == 0) {
+                break;
+            }
+            size += n;
+        }
+        contents.resize(size);
+        data = contents.data();
+    }
+
+    bool mapped = false;
+    string contents;
+};
+
+// Writes the 'size' bytes at 'data' to 'fd'.  Returns false if an error
+// occurs.
+bool write_all(
+    int fd,
+    const char *data,
+    size_t size)
+{
+    while (size) {
+        ssize_t written = write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+/*
+ * code_point_block
+ * Code points decoded from a chunk, with the offset in the file of the first
+ * code unit of each, which is reported if the code point cannot be encoded.
+ */
+struct code_point_block {
+    static const size_t capacity = 4096;
+    char32_t code_points[capacity];
+    size_t offsets[capacity];
+    size_t size = 0;
+};
+
+/*
+ * chunk_result
+ * The converted contents of a chunk.  'error_offset' is the offset in the
+ * file of the error that stopped conversion in strict mode, or SIZE_MAX.
+ */
+struct chunk_result {
+    unique_ptr<char[]> data;
+    size_t size = 0;
+    size_t error_offset = SIZE_MAX;
+};
+
+// The chunk boundary functions return the index of the first code point
+// boundary at or after the code unit 'index' of the 'count' code units at
+// 'units'.
+size_t utf8_chunk_boundary(
+    const char *units,
+    size_t count,
+    size_t index)
+{
+    auto is_continuation = [&](size_t i) {
+        return ((unsigned char)units[i] & 0xC0) == 0x80;
+    };
+    for (int i = 0; i < 3 && index < count && is_continuation(index); ++i) {
+        ++index;
+    }
+    // CESU-8 and modified UTF-8 encode supplementary code points as a pair
+    // of surrogate code points; a low surrogate belongs to the code point
+    // before it.
+    if (index + 2 < count && (unsigned char)units[index] == 0xED &&
+        ((unsigned char)units[index + 1] & 0xF0) == 0xB0)
+    {
+        index += 3;
+    }
+    return index;
+}
+
+size_t chunk_boundary(
+    utf8_encoding,
+    const char *units,
+    size_t count,
+    size_t index)
+{
+    return utf8_chunk_boundary(units, count, index);
+}
+
+size_t chunk_boundary(
+    cesu8_encoding,
+    const char *units,
+    size_t count,
+    size_t index)
+{
+    return utf8_chunk_boundary(units, count, index);
+}
+
+size_t chunk_boundary(
+    modified_utf8_encoding,
+    const char *units,
+    size_t count,
+    size_t index)
+{
+    return utf8_chunk_boundary(units, count, index);
+}
+
+size_t chunk_boundary(
+    wtf8_encoding,
+    const char *units,
+    size_t count,
+    size_t index)
+{
+    return utf8_chunk_boundary(units, count, index);
+}
+
+size_t utf16_chunk_boundary(
+    const char16_t *units,
+    size_t count,
+    size_t index)
+{
+    if (index < count && units[index] >= 0xDC00 && units[index] <= 0xDFFF) {
+        ++index;
+    }
+    return index;
+}
+
+size_t chunk_boundary(
+    utf16_encoding,
+    const char16_t *units,
+    size_t count,
+    size_t index)
+{
+    return utf16_chunk_boundary(units, count, index);
+}
+
+size_t chunk_boundary(
+    utf16_lossless_encoding,
+    const char16_t *units,
+    size_t count,
+    size_t index)
+{
+    return utf16_chunk_boundary(units, count, index);
+}
+
+size_t utf16_byte_chunk_boundary(
+    const char *units,
+    size_t count,
+    size_t index,
+    bool big_endian)
+{
+    index &= ~size_t{1};
+    if (index + 1 < count) {
+        unsigned char high = units[index + (big_endian ? 0 : 1)];
+        if (high >= 0xDC && high <= 0xDF) {
+            index += 2;
+        }
+    }
+    return index;
+}
+
+size_t chunk_boundary(
+    utf16be_encoding,
+    const char *units,
+    size_t count,
+    size_t index)
+{
+    return utf16_byte_chunk_boundary(units, count, index, true);
+}
+
+size_t chunk_boundary(
+    utf16le_encoding,
+    const char *units,
+    size_t count,
+    size_t index)
+{
+    return utf16_byte_chunk_boundary(units, count, index, false);
+}
+
+size_t chunk_boundary(
+    utf32_encoding,
+    const char32_t *,
+    size_t,
+    size_t index)
+{
+    return index;
+}
+
+size_t chunk_boundary(
+    utf32be_encoding,
+    const char *,
+    size_t,
+    size_t index)
+{
+    return index & ~size_t{3};
+}
+
+size_t chunk_boundary(
+    utf32le_encoding,
+    const char *,
+    size_t,
+    size_t index)
+{
+    return index & ~size_t{3};
+}
+
+// The BOM transition functions return the state transition that writes, or
+// if 'assume' is true, that assumes to have been written, the BOM specified
+// by 'bom'.
+trivial_encoding_state_transition bom_transition(
+    trivial_encoding_state_transition stt,
+    bom_mode,
+    bool)
+{
+    return stt;
+}
+
+utf8bom_encoding_state_transition bom_transition(
+    utf8bom_encoding_state_transition,
+    bom_mode,
+    bool assume)
+{
+    using STT = utf8bom_encoding_state_transition;
+    return assume ? STT::to_assume_bom_written_state()
+                  : STT::to_bom_written_state();
+}
+
+template<typename STT>
+STT bom_transition(
+    STT,
+    bom_mode bom,
+    bool assume)
+{
+    switch (bom) {
+    case bom_mode::big_endian:
+        return assume ? STT::to_assume_be_bom_written_state()
+                      : STT::to_be_bom_written_state();
+    case bom_mode::little_endian:
+        return assume ? STT::to_assume_le_bom_written_state()
+                      : STT::to_le_bom_written_state();
+    default:
+        return assume ? STT::to_assume_bom_written_state()
+                      : STT::to_bom_written_state();
+    }
+}
+
+// Decodes code points from the code units at 'next', which is advanced, to
+// 'last' of the file that begins at 'data' into 'block' until it is full.
+// Returns false if an error stops decoding in strict mode, in which case
+// 'error_offset' is set.  In replace mode, an invalid code unit sequence is
+// decoded as U+FFFD, and decoding resumes after its first code unit, or for
+// an incomplete sequence at the end of the chunk, at the end of the chunk.
+template<TextEncoding ET>
+bool decode_block(
+    const char *data,
+    const code_unit_type_t<ET> *&next,
+    const code_unit_type_t<ET> *last,
+    error_mode errors,
+    code_point_block &block,
+    size_t &error_offset)
+{
+    auto state = ET::initial_state();
+    character_type_t<ET> c;
+    block.size = 0;
+    while (next != last && block.size != block.capacity) {
+        auto start = next;
+        size_t offset = reinterpret_cast<const char *>(start) - data;
+        try {
+            int decoded_code_units;
+            if (ET::decode(state, next, last, c, decoded_code_units)) {
+                block.code_points[block.size] = c.get_code_point();
+                block.offsets[block.size] = offset;
+                ++block.size;
+            }
+            continue;
+        } catch (const text_decode_error &) {
+            next = start + ET::min_code_units;
+        } catch (const text_decode_underflow_error &) {
+            next = last;
+        }
+        if (errors == error_mode::strict) {
+            error_offset = offset;
+            return false;
+        }
+        block.code_points[block.size] = U'\uFFFD';
+        block.offsets[block.size] = offset;
+        ++block.size;
+    }
+    return true;
+}
+
+// Encodes the code points of 'block' to 'out', which is advanced.  Returns
+// false if an error stops encoding in strict mode, in which case
+// 'error_offset' is set.  In replace mode, code points that the encoding
+// cannot represent are encoded as U+FFFD.
+template<TextEncoding ET>
+bool encode_block(
+    typename ET::state_type &state,
+    const code_point_block &block,
+    error_mode errors,
+    code_unit_type_t<ET> *&out,
+    size_t &error_offset)
+{
+    character_type_t<ET> c;
+    for (size_t i = 0; i < block.size; ++i) {
+        auto start = out;
+        int encoded_code_units;
+        try {
+            c.set_code_point(block.code_points[i]);
+            ET::encode(state, out, c, encoded_code_units);
+            continue;
+        } catch (const text_encode_error &) {
+            out = start;
+        }
+        if (errors == error_mode::strict) {
+            error_offset = block.offsets[i];
+            return false;
+        }
+        c.set_code_point(U'\uFFFD');
+        ET::encode(state, out, c, encoded_code_units);
+    }
+    return true;
+}
+
+/*
+ * transcoder
+ * The functions that convert a chunk, selected at run time from the input
+ * encoding, and the functions that they call to encode code points, selected
+ * from the output encoding.
+ */
+struct transcoder;
+
+using boundary_function = size_t (*)(const char *, size_t, size_t);
+using chunk_function =
+    void (*)(const transcoder &, const char *, size_t, size_t, bool,
+             chunk_result &);
+using encode_function =
+    bool (*)(const code_point_block &, bool, const transcoder &, char *&,
+             size_t &);
+
+struct transcoder {
+    boundary_function boundary;
+    chunk_function convert_chunk;
+    encode_function encode;
+    size_t input_unit_size;
+    size_t max_output_bytes;
+    size_t min_input_units;
+    bom_mode bom;
+    error_mode errors;
+};
+
+// Returns the byte offset of the first code point boundary at or after the
+// byte offset 'offset' of the 'size' bytes at 'data'.
+template<TextEncoding ET>
+size_t find_chunk_boundary(
+    const char *data,
+    size_t size,
+    size_t offset)
+{
+    using CUT = code_unit_type_t<ET>;
+    return chunk_boundary(
+        ET{}, reinterpret_cast<const CUT *>(data), size / sizeof(CUT),
+        offset / sizeof(CUT)) * sizeof(CUT);
+}
+
+// Encodes the code points of 'block' to 'out' in the encoding 'ET'.  The
+// encoding state is initialized for each block; the only state of the
+// supported encodings is whether a BOM was written and its byte order, which
+// is restored by assuming that the BOM requested by the transcoder was
+// written, unless 'write_bom' is true.
+template<TextEncoding ET>
+bool encode_code_points(
+    const code_point_block &block,
+    bool write_bom,
+    const transcoder &t,
+    char *&out,
+    size_t &error_offset)
+{
+    using CUT = code_unit_type_t<ET>;
+    auto state = ET::initial_state();
+    CUT *next = reinterpret_cast<CUT *>(out);
+    if (t.bom != bom_mode::none) {
+        int encoded_code_units;
+        ET::encode_state_transition(
+            state, next,
+            bom_transition(typename ET::state_transition_type{}, t.bom,
+                           ! write_bom),
+            encoded_code_units);
+    }
+    bool ok = encode_block<ET>(state, block, t.errors, next, error_offset);
+    out = reinterpret_cast<char *>(next);
+    return ok;
+}
+
+// Converts the bytes ['first', 'last') of the file that begins at 'data',
+// which are code units of the encoding 'ET', to 'result'.  Bytes at the end
+// of the chunk that do not form a whole code unit are an error.
+template<TextEncoding ET>
+void convert_chunk(
+    const transcoder &t,
+    const char *data,
+    size_t first,
+    size_t last,
+    bool first_chunk,
+    chunk_result &result)
+{
+    using CUT = code_unit_type_t<ET>;
+    const CUT *next = reinterpret_cast<const CUT *>(data + first);
+    const CUT *end = next + (last - first) / sizeof(CUT);
+    size_t trailing = (last - first) % sizeof(CUT);
+
+    // Each code point decoded from at least min_input_units code units is
+    // encoded in at most max_output_bytes bytes; the BOM and a replaced
+    // trailing partial code unit need a few bytes more.
+    size_t capacity = ((last - first) / t.input_unit_size / t.min_input_units
+                       + 1) * t.max_output_bytes + 8;
+    result.data.reset(new char[capacity]);
+    char *out = result.data.get();
+
+    code_point_block block;
+    bool first_block = true;
+    do {
+        size_t error_offset;
+        bool ok = decode_block<ET>(data, next, end, t.errors, block,
+                                   error_offset);
+        if (! t.encode(block, first_chunk && first_block, t, out,
+                       result.error_offset))
+        {
+            break;
+        }
+        first_block = false;
+        if (! ok) {
+            result.error_offset = error_offset;
+            break;
+        }
+    } while (next != end);
+
+    if (trailing && result.error_offset == SIZE_MAX) {
+        if (t.errors == error_mode::strict) {
+            result.error_offset = last - trailing;
+        } else {
+            block.code_points[0] = U'\uFFFD';
+            block.offsets[0] = last - trailing;
+            block.size = 1;
+            t.encode(block, first_chunk && first_block, t, out,
+                     result.error_offset);
+        }
+    }
+    result.size = out - result.data.get();
+}
+
+// Sets the input functions of 't' for the encoding 'ET'.
+template<TextEncoding ET>
+void set_input_encoding(
+    transcoder &t)
+{
+    t.boundary = find_chunk_boundary<ET>;
+    t.convert_chunk = convert_chunk<ET>;
+    t.input_unit_size = sizeof(code_unit_type_t<ET>);
+    t.min_input_units = ET::min_code_units;
+}
+
+// Sets the output functions of 't' for the encoding 'ET'.
+template<TextEncoding ET>
+void set_output_encoding(
+    transcoder &t)
+{
+    t.encode = encode_code_points<ET>;
+    t.max_output_bytes = ET::max_code_units * sizeof(code_unit_type_t<ET>);
+}
+
+// Returns the length of the BOM 'bom' of 'length' bytes at the start of the
+// 'size' bytes at 'data', or 0 if it is not present.
+size_t bom_length(
+    const char *data,
+    size_t size,
+    const char *bom,
+    size_t length)
+{
+    return size >= length && memcmp(data, bom, length) == 0 ? length : 0;
+}
+
+// Sets the input functions of 't' for the encoding named 'name' and returns
+// the offset of the first code unit of the 'size' bytes at 'data' after a
+// BOM.  BOMs are read here, and the byte order they specify selected, so
+// that every chunk is decoded with a stateless encoding.  Returns SIZE_MAX if
+// the name is not recognized.
+size_t select_input_encoding(
+    transcoder &t,
+    const char *name,
+    const char *data,
+    size_t size)
+{
+    size_t n;
+    if (strcmp(name, "utf-8") == 0) {
+        set_input_encoding<utf8_encoding>(t);
+        return 0;
+    }
+    if (strcmp(name, "utf-8-bom") == 0) {
+        set_input_encoding<utf8_encoding>(t);
+        return bom_length(data, size, "\xEF\xBB\xBF", 3);
+    }
+    if (strcmp(name, "cesu-8") == 0) {
+        set_input_encoding<cesu8_encoding>(t);
+        return 0;
+    }
+    if (strcmp(name, "modified-utf-8") == 0) {
+        set_input_encoding<modified_utf8_encoding>(t);
+        return 0;
+    }
+    if (strcmp(name, "wtf-8") == 0) {
+        set_input_encoding<wtf8_encoding>(t);
+        return 0;
+    }
+    if (strcmp(name, "utf-16") == 0) {
+        set_input_encoding<utf16_encoding>(t);
+        return 0;
+    }
+    if (strcmp(name, "utf-16-bom") == 0) {
+        if ((n = bom_length(data, size, "\xFF\xFE", 2))) {
+            set_input_encoding<utf16le_encoding>(t);
+            return n;
+        }
+        set_input_encoding<utf16be_encoding>(t);
+        return bom_length(data, size, "\xFE\xFF", 2);
+    }
+    if (strcmp(name, "utf-16-be") == 0) {
+        set_input_encoding<utf16be_encoding>(t);
+        return 0;
+    }
+    if (strcmp(name, "utf-16-le") == 0) {
+        set_input_encoding<utf16le_encoding>(t);
+        return 0;
+    }
+    if (strcmp(name, "utf-16-lossless") == 0) {
+        set_input_encoding<utf16_lossless_encoding>(t);
+        return 0;
+    }
+    if (strcmp(name, "utf-32") == 0) {
+        set_input_encoding<utf32_encoding>(t);
+        return 0;
+    }
+    if (strcmp(name, "utf-32-bom") == 0) {
+        if ((n = bom_length(data, size, "\xFF\xFE\0\0", 4))) {
+            set_input_encoding<utf32le_encoding>(t);
+            return n;
+        }
+        set_input_encoding<utf32be_encoding>(t);
+        return bom_length(data, size, "\0\0\xFE\xFF", 4);
+    }
+    if (strcmp(name, "utf-32-be") == 0) {
+        set_input_encoding<utf32be_encoding>(t);
+        return 0;
+    }
+    if (strcmp(name, "utf-32-le") == 0) {
+        set_input_encoding<utf32le_encoding>(t);
+        return 0;
+    }
+    return SIZE_MAX;
+}
+
+// Sets the output functions of 't' for the encoding named 'name'.  If
+// 'bom' is true, the output is encoded with the BOM variant of the encoding,
+// and the BOM that specifies its byte order is written.  Returns false if
+// the name is not recognized, or if a BOM is requested for an encoding
+// without one.
+bool select_output_encoding(
+    transcoder &t,
+    const char *name,
+    bool bom)
+{
+    // Native byte order BOMs require sizeof(char16_t) == 2.
+    static_assert(sizeof(char16_t) == 2);
+    bom_mode native_bom = *((const unsigned char *)u"\ufeff") == 0xFF
+                        ? bom_mode::little_endian
+                        : bom_mode::big_endian;
+
+    t.bom = bom_mode::none;
+    if (strcmp(name, "utf-8") == 0) {
+        if (bom) {
+            set_output_encoding<utf8bom_encoding>(t);
+            t.bom = bom_mode::written;
+        } else {
+            set_output_encoding<utf8_encoding>(t);
+        }
+    }
+    else if (strcmp(name, "utf-8-bom") == 0) {
+        set_output_encoding<utf8bom_encoding>(t);
+        t.bom = bom_mode::written;
+    }
+    else if (strcmp(name, "cesu-8") == 0 && ! bom) {
+        set_output_encoding<cesu8_encoding>(t);
+    }
+    else if (strcmp(name, "modified-utf-8") == 0 && ! bom) {
+        set_output_encoding<modified_utf8_encoding>(t);
+    }
+    else if (strcmp(name, "wtf-8") == 0 && ! bom) {
+        set_output_encoding<wtf8_encoding>(t);
+    }
+    else if (strcmp(name, "utf-16") == 0) {
+        if (bom) {
+            set_output_encoding<utf16bom_encoding>(t);
+            t.bom = native_bom;
+        } else {
+            set_output_encoding<utf16_encoding>(t);
+        }
+    }
+    else if (strcmp(name, "utf-16-bom") == 0) {
+        set_output_encoding<utf16bom_encoding>(t);
+        t.bom = bom_mode::written;
+    }
+    else if (strcmp(name, "utf-16-be") == 0) {
+        if (bom) {
+            set_output_encoding<utf16bom_encoding>(t);
+            t.bom = bom_mode::big_endian;
+        } else {
+            set_output_encoding<utf16be_encoding>(t);
+        }
+    }
+    else if (strcmp(name, "utf-16-le") == 0) {
+        if (bom) {
+            set_output_encoding<utf16bom_encoding>(t);
+            t.bom = bom_mode::little_endian;
+        } else {
+            set_output_encoding<utf16le_encoding>(t);
+        }
+    }
+    else if (strcmp(name, "utf-16-lossless") == 0 && ! bom) {
+        set_output_encoding<utf16_lossless_encoding>(t);
+    }
+    else if (strcmp(name, "utf-32") == 0) {
+        if (bom) {
+            set_output_encoding<utf32bom_encoding>(t);
+            t.bom = native_bom;
+        } else {
+            set_output_encoding<utf32_encoding>(t);
+        }
+    }
+    else if (strcmp(name, "utf-32-bom") == 0) {
+        set_output_encoding<utf32bom_encoding>(t);
+        t.bom = bom_mode::written;
+    }
+    else if (strcmp(name, "utf-32-be") == 0) {
+        if (bom) {
+            set_output_encoding<utf32bom_encoding>(t);
+            t.bom = bom_mode::big_endian;
+        } else {
+            set_output_encoding<utf32be_encoding>(t);
+        }
+    }
+    else if (strcmp(name, "utf-32-le") == 0) {
+        if (bom) {
+            set_output_encoding<utf32bom_encoding>(t);
+            t.bom = bom_mode::little_endian;
+        } else {
+            set_output_encoding<utf32le_encoding>(t);
+        }
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+// Converts the bytes ['offset', 'size') of 'data' with 't' using 'threads'
+// threads and writes the result to 'fd'.  Returns the offset of the error
+// that stopped conversion in strict mode, or SIZE_MAX.
+size_t transcode(
+    const transcoder &t,
+    const char *data,
+    size_t size,
+    size_t offset,
+    unsigned threads,
+    int fd)
+{
+    // Chunks are small enough that threads that finish early take over the
+    // remaining work, but large enough that finding their boundaries and
+    // scheduling them is negligible.  An empty input is converted as one
+    // empty chunk, so that a BOM is still written.
+    const size_t chunk_size = size_t{1} << 22;
+    vector<size_t> boundaries{offset};
+    for (size_t b = offset + chunk_size; b < size; b += chunk_size) {
+        size_t boundary = t.boundary(data, size, b);
+        if (boundary > boundaries.back() && boundary < size) {
+            boundaries.push_back(boundary);
+        }
+    }
+    boundaries.push_back(size);
+    size_t chunk_count = boundaries.size() - 1;
+
+    // Chunks are converted in rounds of a few per thread, which bounds the
+    // memory held by converted chunks that have not been written yet.
+    threads = min<size_t>(threads, chunk_count);
+    size_t round_size = threads * 2;
+    vector<chunk_result> results(round_size);
+    for (size_t round = 0; round < chunk_count; round += round_size) {
+        size_t round_end = min(chunk_count, round + round_size);
+        atomic<size_t> next_chunk{round};
+        auto work = [&] {
+            for (size_t i; (i = next_chunk++) < round_end; ) {
+                chunk_result &result = results[i - round];
+                result.error_offset = SIZE_MAX;
+                t.convert_chunk(t, data, boundaries[i], boundaries[i + 1],
+                                i == 0, result);
+            }
+        };
+        vector<thread> workers;
+        for (unsigned w = 1; w < threads && round + w < round_end; ++w) {
+            workers.emplace_back(work);
+        }
+        work();
+        for (thread &worker : workers) {
+            worker.join();
+        }
+        for (size_t i = round; i < round_end; ++i) {
+            chunk_result &result = results[i - round];
+            if (! write_all(fd, result.data.get(), result.size)) {
+                throw system_error(errno, system_category(),
+                                   "failed to write output");
+            }
+            if (result.error_offset != SIZE_MAX) {
+                return result.error_offset;
+            }
+        }
+    }
+    return SIZE_MAX;
+}
+
+int main(
+    int argc,
+    char *argv[])
+{
+    const char *file_name = nullptr;
+    const char *output_name = nullptr;
+    const char *from = nullptr;
+    const char *to = nullptr;
+    bool bom = false;
+    error_mode errors = error_mode::strict;
+    unsigned threads = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-h") == 0 ||
+            strcmp(argv[i], "--help") == 0)
+        {
+            usage(cout, argv[0]);
+            return exit_success;
+        }
+        else if (strcmp(argv[i], "-f") == 0 ||
+                 strcmp(argv[i], "--from") == 0)
+        {
+            if (++i >= argc) {
+                cerr << "error: --from operand missing." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            if (from) {
+                cerr << "error: --from already specified." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            from = argv[i];
+        }
+        else if (strcmp(argv[i], "-t") == 0 ||
+                 strcmp(argv[i], "--to") == 0)
+        {
+            if (++i >= argc) {
+                cerr << "error: --to operand missing." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            if (to) {
+                cerr << "error: --to already specified." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            to = argv[i];
+        }
+        else if (strcmp(argv[i], "-o") == 0 ||
+                 strcmp(argv[i], "--output") == 0)
+        {
+            if (++i >= argc) {
+                cerr << "error: --output operand missing." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            if (output_name) {
+                cerr << "error: --output already specified." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            output_name = argv[i];
+        }
+        else if (strcmp(argv[i], "-b") == 0 ||
+                 strcmp(argv[i], "--bom") == 0)
+        {
+            bom = true;
+        }
+        else if (strcmp(argv[i], "-e") == 0 ||
+                 strcmp(argv[i], "--errors") == 0)
+        {
+            if (++i >= argc) {
+                cerr << "error: --errors operand missing." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            if (strcmp(argv[i], "strict") == 0) {
+                errors = error_mode::strict;
+            } else if (strcmp(argv[i], "replace") == 0) {
+                errors = error_mode::replace;
+            } else {
+                cerr << "error: unrecognized error mode: '" << argv[i]
+                     << "'." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+        }
+        else if (strcmp(argv[i], "-j") == 0 ||
+                 strcmp(argv[i], "--threads") == 0)
+        {
+            if (++i >= argc || atoi(argv[i]) <= 0) {
+                cerr << "error: --threads requires a positive number."
+                     << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            threads = atoi(argv[i]);
+        }
+        else {
+            if (file_name) {
+                cerr << "error: <file> already specified." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            file_name = argv[i];
+        }
+    }
+
+    if (! file_name) {
+        cerr << "error: <file> not specified." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    if (! from) {
+        cerr << "error: --from not specified." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    if (! to) {
+        cerr << "error: --to not specified." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    if (threads == 0) {
+        threads = max(1u, thread::hardware_concurrency());
+    }
+
+    transcoder t;
+    t.errors = errors;
+    if (! select_output_encoding(t, to, bom)) {
+        cerr << "error: unrecognized output encoding: '" << to << "'";
+        if (bom) {
+            cerr << " or encoding without a BOM";
+        }
+        cerr << "." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    mapped_file file(file_name);
+    if (! file) {
+        cerr << "error: failed to open file " << file_name << "." << endl;
+        return exit_failure;
+    }
+
+    size_t offset = select_input_encoding(t, from, file.data, file.size);
+    if (offset == SIZE_MAX) {
+        cerr << "error: unrecognized input encoding: '" << from << "'."
+             << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    int fd = STDOUT_FILENO;
+    if (output_name) {
+        fd = open(output_name, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        if (fd < 0) {
+            cerr << "error: failed to open file " << output_name << "."
+                 << endl;
+            return exit_failure;
+        }
+    }
+
+    try {
+        size_t error_offset =
+            transcode(t, file.data, file.size, offset, threads, fd);
+        if (error_offset != SIZE_MAX) {
+            cerr << "error: cannot convert the character at offset "
+                 << error_offset << "." << endl;
+            return exit_failure;
+        }
+    } catch (const system_error &se) {
+        cerr << "error: " << se.what() << endl;
+        return exit_failure;
+    }
+
+    if (output_name && close(fd) != 0) {
+        cerr << "error: failed to write file " << output_name << "." << endl;
+        return exit_failure;
+    }
+
+    return exit_success;
+}
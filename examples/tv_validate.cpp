@@ -0,0 +1,697 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+// This program validates that files are well formed in an encoding, and
+// reports the offset of the first invalid code unit sequence of each file
+// that is not.  Files are validated by a pool of threads, each of which owns
+// a queue of tasks and takes tasks from the queues of other threads when its
+// own is empty.  Paths are queued in batches, so that small files cost little
+// more than opening and reading them; a file larger than a chunk is mapped
+// into memory and split into chunks that begin on code point boundaries,
+// which are queued as tasks of their own so that idle threads validate the
+// chunks of a large file concurrently.
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <text_view>
+
+using namespace std;
+using namespace std::experimental;
+
+static const int exit_success = 0;
+static const int exit_failure = 1;
+static const int exit_user_error = 2;
+
+void usage(
+    ostream &os,
+    const char *progpath)
+{
+    const char *progname = strrchr(progpath, '/');
+    progname = (progname ? progname+1 : progpath);
+    os << "usage: " << progpath << endl;
+    os << progname << " [--encoding <encoding>] [--threads <n>] [--quiet]"
+       << endl;
+    os << "    [--files-from <file>] <file>..." << endl;
+    os << "    -h, --help:" << endl;
+    os << "        Displays program help." << endl;
+    os << "    <file>:" << endl;
+    os << "        Specifies a file to validate." << endl;
+    os << "    -e, --encoding <encoding>:" << endl;
+    os << "        Specifies the character encoding of the files; defaults"
+       << endl;
+    os << "        to utf-8.  Valid encodings are:" << endl;
+    os << "            utf-8" << endl;
+    os << "            utf-8-bom   (BOM ignored if present)" << endl;
+    os << "            utf-16      (native endian)" << endl;
+    os << "            utf-16-bom  (big endian if no BOM is present)" << endl;
+    os << "            utf-16-be" << endl;
+    os << "            utf-16-le" << endl;
+    os << "            utf-32      (native endian)" << endl;
+    os << "            utf-32-bom  (big endian if no BOM is present)" << endl;
+    os << "            utf-32-be" << endl;
+    os << "            utf-32-le" << endl;
+    os << "    -f, --files-from <file>:" << endl;
+    os << "        Validates the files named on the lines of <file>, or of"
+       << endl;
+    os << "        standard input if <file> is -." << endl;
+    os << "    -j, --threads <n>:" << endl;
+    os << "        Specifies the number of threads; defaults to the number"
+       << endl;
+    os << "        of hardware threads." << endl;
+    os << "    -q, --quiet:" << endl;
+    os << "        Reports only files that are invalid or cannot be read."
+       << endl;
+    os << "The exit status is 0 if every file is valid, and 1 otherwise."
+       << endl;
+}
+
+// Files larger than this are split into chunks of this size.
+static const size_t chunk_size = size_t{1} << 22;
+
+// The number of paths queued as a single task.
+static const size_t batch_size = 32;
+
+// The functions that validate the code units of a file in an encoding, and
+// that find code point boundaries at which to split it.
+using validate_function = size_t (*)(const char *, size_t, size_t);
+using boundary_function = size_t (*)(const char *, size_t, size_t);
+
+/*
+ * file_state
+ * The progress and result of the validation of a file.  'first_error' is the
+ * offset of the first invalid code unit sequence found so far, or SIZE_MAX;
+ * chunks of a file that begin after it are not validated.  'remaining' counts
+ * the chunks not yet validated, and the thread that validates the last one
+ * unmaps the file.
+ */
+struct file_state {
+    const char *path;
+    atomic<size_t> first_error{SIZE_MAX};
+    int error_number = 0;
+
+    validate_function validate = nullptr;
+    const char *data = nullptr;
+    size_t size = 0;
+    atomic<size_t> remaining{0};
+
+    void record_error(
+        size_t offset)
+    {
+        size_t current = first_error.load();
+        while (offset < current &&
+               ! first_error.compare_exchange_weak(current, offset))
+        {
+        }
+    }
+};
+
+/*
+ * task
+ * A batch of paths, given as a range of indexes of files, or a chunk of a
+ * file, given as the index of the file and a range of offsets.
+ */
+struct task {
+    enum { batch, chunk } kind;
+    size_t first;
+    size_t last;
+    size_t file;
+};
+
+// The chunk boundary functions return the offset of the first code point
+// boundary at or after 'offset' in the 'size' bytes at 'data'.
+size_t chunk_boundary(
+    utf8_encoding,
+    const char *data,
+    size_t size,
+    size_t offset)
+{
+    for (int i = 0; i < 3 && offset < size &&
+                    ((unsigned char)data[offset] & 0xC0) == 0x80; ++i)
+    {
+        ++offset;
+    }
+    return offset;
+}
+
+size_t utf16_chunk_boundary(
+    const char *data,
+    size_t size,
+    size_t offset,
+    bool big_endian)
+{
+    offset &= ~size_t{1};
+    if (offset + 1 < size) {
+        unsigned char high = data[offset + (big_endian ? 0 : 1)];
+        if (high >= 0xDC && high <= 0xDF) {
+            offset += 2;
+        }
+    }
+    return offset;
+}
+
+size_t chunk_boundary(
+    utf16be_encoding,
+    const char *data,
+    size_t size,
+    size_t offset)
+{
+    return utf16_chunk_boundary(data, size, offset, true);
+}
+
+size_t chunk_boundary(
+    utf16le_encoding,
+    const char *data,
+    size_t size,
+    size_t offset)
+{
+    return utf16_chunk_boundary(data, size, offset, false);
+}
+
+size_t chunk_boundary(
+    utf32be_encoding,
+    const char *,
+    size_t,
+    size_t offset)
+{
+    return offset & ~size_t{3};
+}
+
+size_t chunk_boundary(
+    utf32le_encoding,
+    const char *,
+    size_t,
+    size_t offset)
+{
+    return offset & ~size_t{3};
+}
+
+template<TextEncoding ET>
+size_t find_chunk_boundary(
+    const char *data,
+    size_t size,
+    size_t offset)
+{
+    return chunk_boundary(ET{}, data, size, offset);
+}
+
+// Returns the offset of the first code unit sequence of the code units
+// ['first', 'last') of the file that begins at 'data' that the encoding 'ET'
+// does not decode, or SIZE_MAX if they are all decoded.
+template<TextEncoding ET>
+size_t validate(
+    const char *data,
+    size_t first,
+    size_t last)
+{
+    auto state = ET::initial_state();
+    character_type_t<ET> c;
+    const char *next = data + first;
+    const char *end = data + last;
+    while (next != end) {
+        const char *start = next;
+        try {
+            int decoded_code_units;
+            ET::decode(state, next, end, c, decoded_code_units);
+        } catch (const text_runtime_error &) {
+            return start - data;
+        }
+    }
+    return SIZE_MAX;
+}
+
+// UTF-8 text is scanned eight code units at a time for code units that are
+// not ASCII, and only the sequences that begin with them are decoded.
+template<>
+size_t validate<utf8_encoding>(
+    const char *data,
+    size_t first,
+    size_t last)
+{
+    auto state = utf8_encoding::initial_state();
+    character_type_t<utf8_encoding> c;
+    const char *next = data + first;
+    const char *end = data + last;
+    while (next != end) {
+        while (end - next >= 8) {
+            uint64_t word;
+            memcpy(&word, next, 8);
+            if (word & 0x8080808080808080) {
+                break;
+            }
+            next += 8;
+        }
+        while (next != end && (unsigned char)*next < 0x80) {
+            ++next;
+        }
+        if (next == end) {
+            break;
+        }
+        const char *start = next;
+        try {
+            int decoded_code_units;
+            utf8_encoding::decode(state, next, end, c, decoded_code_units);
+        } catch (const text_runtime_error &) {
+            return start - data;
+        }
+    }
+    return SIZE_MAX;
+}
+
+// Returns the length of the BOM 'bom' of 'length' bytes at the start of the
+// 'size' bytes at 'data', or 0 if it is not present.
+size_t bom_length(
+    const char *data,
+    size_t size,
+    const char *bom,
+    size_t length)
+{
+    return size >= length && memcmp(data, bom, length) == 0 ? length : 0;
+}
+
+/*
+ * file_encoding
+ * The functions that validate a file, selected from the name of the encoding
+ * and, for the encodings that begin with a BOM, from the BOM that the file
+ * begins with.  'offset' is the offset of the first code unit after the BOM.
+ */
+struct file_encoding {
+    validate_function validate;
+    boundary_function boundary;
+    size_t offset;
+};
+
+template<TextEncoding ET>
+file_encoding make_file_encoding(
+    size_t offset)
+{
+    return file_encoding{validate<ET>, find_chunk_boundary<ET>, offset};
+}
+
+// Returns the functions that validate the 'size' bytes at 'data' in the
+// encoding named 'name', or a file_encoding with null functions if the name
+// is not recognized.  BOMs are read here, and the byte order they specify
+// selected, so that every chunk is decoded with a stateless encoding.
+file_encoding select_encoding(
+    const char *name,
+    const char *data,
+    size_t size)
+{
+    size_t n;
+    if (strcmp(name, "utf-8") == 0) {
+        return make_file_encoding<utf8_encoding>(0);
+    }
+    if (strcmp(name, "utf-8-bom") == 0) {
+        return make_file_encoding<utf8_encoding>(
+            bom_length(data, size, "\xEF\xBB\xBF", 3));
+    }
+    if (strcmp(name, "utf-16") == 0) {
+        // This endianness detection requires sizeof(char16_t) == 2.
+        static_assert(sizeof(char16_t) == 2);
+        if (*((unsigned char*)u"\ufeff") == 0xFF) {
+            return make_file_encoding<utf16le_encoding>(0);
+        }
+        return make_file_encoding<utf16be_encoding>(0);
+    }
+    if (strcmp(name, "utf-16-bom") == 0) {
+        if ((n = bom_length(data, size, "\xFF\xFE", 2))) {
+            return make_file_encoding<utf16le_encoding>(n);
+        }
+        return make_file_encoding<utf16be_encoding>(
+            bom_length(data, size, "\xFE\xFF", 2));
+    }
+    if (strcmp(name, "utf-16-be") == 0) {
+        return make_file_encoding<utf16be_encoding>(0);
+    }
+    if (strcmp(name, "utf-16-le") == 0) {
+        return make_file_encoding<utf16le_encoding>(0);
+    }
+    if (strcmp(name, "utf-32") == 0) {
+        // This endianness detection requires sizeof(char32_t) == 4.
+        static_assert(sizeof(char32_t) == 4);
+        if (*((unsigned char*)U"\U0000feff") == 0xFF) {
+            return make_file_encoding<utf32le_encoding>(0);
+        }
+        return make_file_encoding<utf32be_encoding>(0);
+    }
+    if (strcmp(name, "utf-32-bom") == 0) {
+        if ((n = bom_length(data, size, "\xFF\xFE\0\0", 4))) {
+            return make_file_encoding<utf32le_encoding>(n);
+        }
+        return make_file_encoding<utf32be_encoding>(
+            bom_length(data, size, "\0\0\xFE\xFF", 4));
+    }
+    return file_encoding{nullptr, nullptr, 0};
+}
+
+/*
+ * validator
+ * A pool of threads that validates files.  Each thread owns a double ended
+ * queue of tasks; it takes tasks from the back of its own queue, and when
+ * that is empty, steals tasks from the front of the queues of other threads.
+ * Chunks of a large file are pushed onto the queue of the thread that opened
+ * it, which validates them last in first out while the first ones are
+ * stolen.  The pool finishes when no task is queued or running.
+ */
+class validator {
+public:
+    validator(
+        vector<file_state> &files,
+        const char *encoding,
+        unsigned threads)
+    :
+        files(files),
+        encoding(encoding),
+        queues(threads)
+    {
+        // Batches are dealt to the queues in turn, so that threads start
+        // with a share of the files and steal only to balance the load.
+        size_t q = 0;
+        for (size_t first = 0; first < files.size(); first += batch_size) {
+            size_t last = min(files.size(), first + batch_size);
+            queues[q].tasks.push_back(task{task::batch, first, last, 0});
+            ++pending;
+            q = (q + 1) % queues.size();
+        }
+    }
+
+    void run() {
+        vector<thread> workers;
+        for (size_t t = 1; t < queues.size(); ++t) {
+            workers.emplace_back([this, t] { work(t); });
+        }
+        work(0);
+        for (thread &worker : workers) {
+            worker.join();
+        }
+    }
+
+private:
+    struct task_queue {
+        mutex m;
+        deque<task> tasks;
+    };
+
+    void push(
+        size_t q,
+        const task &t)
+    {
+        ++pending;
+        lock_guard<mutex> lock{queues[q].m};
+        queues[q].tasks.push_back(t);
+    }
+
+    bool pop(
+        size_t q,
+        task &t)
+    {
+        lock_guard<mutex> lock{queues[q].m};
+        if (queues[q].tasks.empty()) {
+            return false;
+        }
+        t = queues[q].tasks.back();
+        queues[q].tasks.pop_back();
+        return true;
+    }
+
+    bool steal(
+        size_t q,
+        task &t)
+    {
+        for (size_t i = 1; i < queues.size(); ++i) {
+            task_queue &victim = queues[(q + i) % queues.size()];
+            lock_guard<mutex> lock{victim.m};
+            if (! victim.tasks.empty()) {
+                t = victim.tasks.front();
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void work(
+        size_t q)
+    {
+        vector<char> buffer;
+        task t;
+        while (pending) {
+            if (! pop(q, t) && ! steal(q, t)) {
+                this_thread::yield();
+                continue;
+            }
+            if (t.kind == task::batch) {
+                for (size_t f = t.first; f < t.last; ++f) {
+                    open_file(q, files[f], f, buffer);
+                }
+            } else {
+                validate_chunk(files[t.file], t.first, t.last);
+            }
+            --pending;
+        }
+    }
+
+    // Validates a file that is no larger than a chunk, which is read into
+    // 'buffer', or maps a larger one into memory and queues its chunks.
+    void open_file(
+        size_t q,
+        file_state &file,
+        size_t index,
+        vector<char> &buffer)
+    {
+        int fd = open(file.path, O_RDONLY);
+        struct stat st;
+        if (fd < 0 || fstat(fd, &st) != 0) {
+            file.error_number = errno;
+            if (fd >= 0) {
+                close(fd);
+            }
+            return;
+        }
+
+        if (! S_ISREG(st.st_mode) || size_t(st.st_size) <= chunk_size) {
+            size_t size = 0;
+            for (;;) {
+                if (buffer.size() < size + (size_t{1} << 16)) {
+                    buffer.resize(size + (size_t{1} << 16));
+                }
+                ssize_t n = read(fd, &buffer[size], buffer.size() - size);
+                if (n < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (n < 0) {
+                    file.error_number = errno;
+                    close(fd);
+                    return;
+                }
+                if (n == 0) {
+                    break;
+                }
+                size += n;
+            }
+            close(fd);
+            file_encoding fe = select_encoding(encoding, buffer.data(), size);
+            file.record_error(fe.validate(buffer.data(), fe.offset, size));
+            return;
+        }
+
+        size_t size = st.st_size;
+        void *p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            file.error_number = errno;
+            close(fd);
+            return;
+        }
+        close(fd);
+        madvise(p, size, MADV_SEQUENTIAL);
+        file.data = static_cast<const char *>(p);
+        file.size = size;
+
+        file_encoding fe = select_encoding(encoding, file.data, size);
+        file.validate = fe.validate;
+        vector<size_t> boundaries{fe.offset};
+        for (size_t b = fe.offset + chunk_size; b < size; b += chunk_size) {
+            size_t boundary = fe.boundary(file.data, size, b);
+            if (boundary > boundaries.back() && boundary < size) {
+                boundaries.push_back(boundary);
+            }
+        }
+        boundaries.push_back(size);
+        file.remaining = boundaries.size() - 1;
+        // Chunks are pushed last to first, so that the first chunk is the
+        // next one this thread validates and the last chunks are stolen.
+        for (size_t i = boundaries.size() - 1; i > 0; --i) {
+            push(q, task{task::chunk, boundaries[i - 1], boundaries[i],
+                         index});
+        }
+    }
+
+    void validate_chunk(
+        file_state &file,
+        size_t first,
+        size_t last)
+    {
+        if (first < file.first_error) {
+            file.record_error(file.validate(file.data, first, last));
+        }
+        if (--file.remaining == 0) {
+            munmap(const_cast<char *>(file.data), file.size);
+            file.data = nullptr;
+        }
+    }
+
+    vector<file_state> &files;
+    const char *encoding;
+    vector<task_queue> queues;
+    atomic<size_t> pending{0};
+};
+
+int main(
+    int argc,
+    char *argv[])
+{
+    const char *encoding = nullptr;
+    const char *files_from = nullptr;
+    unsigned threads = 0;
+    bool quiet = false;
+    vector<string> paths;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-h") == 0 ||
+            strcmp(argv[i], "--help") == 0)
+        {
+            usage(cout, argv[0]);
+            return exit_success;
+        }
+        else if (strcmp(argv[i], "-e") == 0 ||
+                 strcmp(argv[i], "--encoding") == 0)
+        {
+            if (++i >= argc) {
+                cerr << "error: --encoding operand missing." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            if (encoding) {
+                cerr << "error: --encoding already specified." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            encoding = argv[i];
+        }
+        else if (strcmp(argv[i], "-f") == 0 ||
+                 strcmp(argv[i], "--files-from") == 0)
+        {
+            if (++i >= argc) {
+                cerr << "error: --files-from operand missing." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            if (files_from) {
+                cerr << "error: --files-from already specified." << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            files_from = argv[i];
+        }
+        else if (strcmp(argv[i], "-j") == 0 ||
+                 strcmp(argv[i], "--threads") == 0)
+        {
+            if (++i >= argc || atoi(argv[i]) <= 0) {
+                cerr << "error: --threads requires a positive number."
+                     << endl;
+                usage(cerr, argv[0]);
+                return exit_user_error;
+            }
+            threads = atoi(argv[i]);
+        }
+        else if (strcmp(argv[i], "-q") == 0 ||
+                 strcmp(argv[i], "--quiet") == 0)
+        {
+            quiet = true;
+        }
+        else {
+            paths.push_back(argv[i]);
+        }
+    }
+
+    if (files_from) {
+        ifstream ifs;
+        istream *is = &cin;
+        if (strcmp(files_from, "-") != 0) {
+            ifs.open(files_from);
+            if (! ifs) {
+                cerr << "error: failed to open file " << files_from << "."
+                     << endl;
+                return exit_failure;
+            }
+            is = &ifs;
+        }
+        for (string path; getline(*is, path); ) {
+            if (! path.empty()) {
+                paths.push_back(path);
+            }
+        }
+    }
+
+    if (paths.empty()) {
+        cerr << "error: <file> not specified." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    if (! encoding) {
+        encoding = "utf-8";
+    }
+    if (! select_encoding(encoding, "", 0).validate) {
+        cerr << "error: unrecognized encoding: '" << encoding << "'." << endl;
+        usage(cerr, argv[0]);
+        return exit_user_error;
+    }
+
+    if (threads == 0) {
+        threads = max(1u, thread::hardware_concurrency());
+    }
+
+    vector<file_state> files(paths.size());
+    for (size_t f = 0; f < paths.size(); ++f) {
+        files[f].path = paths[f].c_str();
+    }
+    validator{files, encoding, threads}.run();
+
+    int status = exit_success;
+    string report;
+    for (const file_state &file : files) {
+        if (file.error_number) {
+            report.append(file.path).append(": error: ")
+                  .append(strerror(file.error_number)).append("\n");
+            status = exit_failure;
+        } else if (file.first_error != SIZE_MAX) {
+            report.append(file.path).append(": invalid at offset ")
+                  .append(to_string(file.first_error.load())).append("\n");
+            status = exit_failure;
+        } else if (! quiet) {
+            report.append(file.path).append(": valid\n");
+        }
+    }
+    cout << report << flush;
+
+    return status;
+}
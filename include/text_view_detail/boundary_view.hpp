@@ -0,0 +1,186 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_BOUNDARY_VIEW_HPP) // {
+#define TEXT_VIEW_BOUNDARY_VIEW_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/encodings.hpp>
+#include <text_view_detail/text_view.hpp>
+#include <cstddef>
+#include <iterator>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+// True for encodings in which every ASCII character is encoded, in every
+// encoding state, as the single code unit with the value of its code point,
+// and in which code units with those values occur in no other code unit
+// sequence.  Boundary rules and case mappings may process the ASCII
+// characters of text in such encodings by examining code units directly.
+// Modified UTF-8 is not such an encoding, since it encodes U+0000 as C0 80.
+template<typename ET>
+constexpr bool is_ascii_transparent_encoding = false;
+template<>
+constexpr bool is_ascii_transparent_encoding<utf8_encoding> = true;
+template<>
+constexpr bool is_ascii_transparent_encoding<cesu8_encoding> = true;
+template<>
+constexpr bool is_ascii_transparent_encoding<wtf8_encoding> = true;
+
+
+/*
+ * Boundary view
+ * The common implementation of the view adapters that present the text of a
+ * text view as a range of text views, each of which spans the characters
+ * between two adjacent boundaries.  'Rules' provides a static member function
+ * template next_boundary(first, last, range) that returns an iterator to the
+ * first character that follows the segment that begins at 'first', where
+ * 'first' is not equal to 'last' and 'range' is the range of the underlying
+ * text view.  A segment never depends on characters that precede it, so each
+ * character is examined once, apart from any lookahead the rules require.
+ */
+template<TextView TVT, typename Rules>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+class boundary_view {
+public:
+    using view_type = TVT;
+    using text_iterator = origin::Iterator_type<const view_type>;
+    using text_sentinel = origin::Sentinel_type<const view_type>;
+    using segment_type = decltype(make_text_view(
+        std::declval<text_iterator>(), std::declval<text_iterator>()));
+
+    class sentinel;
+
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = segment_type;
+        using reference = value_type;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        iterator(
+            const typename view_type::range_type *range,
+            text_iterator first,
+            text_sentinel last)
+        :
+            range{range}, first{first}, next{first}, last{last}
+        {
+            // Locating the first boundary through operator++ keeps a single
+            // call site for Rules::next_boundary, which allows it to be
+            // inlined into the loop that advances the iterator.
+            ++*this;
+        }
+
+        reference operator*() const {
+            return make_text_view(first, next);
+        }
+
+        iterator& operator++() {
+            first = next;
+            find_next();
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator it{*this};
+            ++*this;
+            return it;
+        }
+
+        // Returns an iterator to the first character of the current segment
+        // in the underlying text view.
+        text_iterator base() const {
+            return first;
+        }
+
+        friend bool operator==(const iterator &l, const iterator &r) {
+            return l.first == r.first;
+        }
+        friend bool operator!=(const iterator &l, const iterator &r) {
+            return !(l == r);
+        }
+
+    private:
+        void find_next() {
+            if (first != last) {
+                next = Rules::next_boundary(first, last, range);
+            }
+        }
+
+        const typename view_type::range_type *range = nullptr;
+        text_iterator first;
+        text_iterator next;
+        text_sentinel last;
+    };
+
+    class sentinel {
+    public:
+        sentinel() = default;
+
+        explicit sentinel(text_sentinel last)
+            : last{last} {}
+
+        text_sentinel base() const {
+            return last;
+        }
+
+        friend bool operator==(const iterator &it, const sentinel &s) {
+            return it.base() == s.base();
+        }
+        friend bool operator!=(const iterator &it, const sentinel &s) {
+            return !(it == s);
+        }
+        friend bool operator==(const sentinel &s, const iterator &it) {
+            return it == s;
+        }
+        friend bool operator!=(const sentinel &s, const iterator &it) {
+            return !(it == s);
+        }
+
+    private:
+        text_sentinel last;
+    };
+
+    boundary_view() = default;
+
+    explicit boundary_view(view_type tv)
+        : tv{tv} {}
+
+    const view_type& base() const noexcept {
+        return tv;
+    }
+
+    iterator begin() const {
+        return iterator{&tv.base(),
+                        text_detail::adl_begin(tv),
+                        text_detail::adl_end(tv)};
+    }
+    sentinel end() const {
+        return sentinel{text_detail::adl_end(tv)};
+    }
+
+private:
+    view_type tv;
+};
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_BOUNDARY_VIEW_HPP
@@ -0,0 +1,638 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_BPE_TOKENIZER_HPP) // {
+#define TEXT_VIEW_BPE_TOKENIZER_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/encodings.hpp>
+#include <text_view_detail/exceptions.hpp>
+#include <text_view_detail/unicode_properties.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+namespace text_detail {
+
+/*
+ * Pretokenization
+ * Text is divided into pieces, to which BPE merges are applied separately,
+ * as by the regular expression of the GPT-2 tokenizer:
+ *     '(?:[sdmt]|ll|ve|re)| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+
+ * Each character is classified as a letter, number, white space, or other
+ * character; a piece is a contraction, or a run of characters of the same
+ * class, optionally preceded by a space.  A run of white space that is
+ * followed by another character leaves its last character to that
+ * character's piece.
+ */
+enum class pretoken_class : unsigned char {
+    letter,
+    number,
+    space,
+    other
+};
+
+inline pretoken_class ascii_pretoken_class(unsigned char c) noexcept {
+    if (unsigned((c | 0x20) - 'a') < 26) {
+        return pretoken_class::letter;
+    }
+    if (unsigned(c - '0') < 10) {
+        return pretoken_class::number;
+    }
+    if (c == ' ' || unsigned(c - '\t') < 5) {
+        return pretoken_class::space;
+    }
+    return pretoken_class::other;
+}
+
+inline pretoken_class unicode_pretoken_class(char32_t cp) noexcept {
+    unicode_properties properties = get_unicode_properties(cp);
+    general_category gc = properties.get_general_category();
+    if (gc >= general_category::lu && gc <= general_category::lo) {
+        return pretoken_class::letter;
+    }
+    if (gc >= general_category::nd && gc <= general_category::no) {
+        return pretoken_class::number;
+    }
+    if (properties.is_white_space()) {
+        return pretoken_class::space;
+    }
+    return pretoken_class::other;
+}
+
+// Returns the class of the character whose code units begin at 'p', which
+// is not 'last', and sets 'length' to its number of code units.  Code units
+// that do not begin a well formed UTF-8 code unit sequence are classified
+// one at a time as other characters, since byte-level tokenization must
+// accept any sequence of bytes.
+template<typename CUIT>
+pretoken_class peek_pretoken_class(CUIT p, CUIT last, int &length) {
+    unsigned char lead = *p;
+    length = 1;
+    if (lead < 0x80) {
+        return ascii_pretoken_class(lead);
+    }
+    int trail;
+    char32_t cp, min;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        trail = 1;
+        cp = lead & 0x1F;
+        min = 0x80;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        trail = 2;
+        cp = lead & 0x0F;
+        min = 0x800;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        trail = 3;
+        cp = lead & 0x07;
+        min = 0x10000;
+    } else {
+        return pretoken_class::other;
+    }
+    if (last - p <= trail) {
+        return pretoken_class::other;
+    }
+    for (int i = 1; i <= trail; ++i) {
+        unsigned char cu = p[i];
+        if ((cu & 0xC0) != 0x80) {
+            return pretoken_class::other;
+        }
+        cp = cp << 6 | (cu & 0x3F);
+    }
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+        return pretoken_class::other;
+    }
+    length = trail + 1;
+    return unicode_pretoken_class(cp);
+}
+
+// Returns the number of code units of the contraction that begins with the
+// apostrophe at 'p', or 0 if there is none.
+template<typename CUIT>
+int contraction_length(CUIT p, CUIT last) {
+    std::ptrdiff_t available = last - p;
+    if (available >= 2) {
+        char c = p[1];
+        if (c == 's' || c == 'd' || c == 'm' || c == 't') {
+            return 2;
+        }
+        if (available >= 3) {
+            char d = p[2];
+            if ((c == 'l' && d == 'l') || (c == 'v' && d == 'e')
+                || (c == 'r' && d == 'e'))
+            {
+                return 3;
+            }
+        }
+    }
+    return 0;
+}
+
+// Calls 'f' with the first and last code unit iterators of each piece of
+// the UTF-8 code units in ['first', 'last'), in order.  Each character is
+// classified once; ASCII characters are classified by their code units.
+template<typename CUIT, typename F>
+void pretokenize(CUIT first, CUIT last, F f) {
+    CUIT p = first;
+    while (p != last) {
+        CUIT start = p;
+        if (*p == '\'') {
+            int length = contraction_length(p, last);
+            if (length) {
+                p += length;
+                f(start, p);
+                continue;
+            }
+        }
+        int length;
+        pretoken_class c = peek_pretoken_class(p, last, length);
+        if (c == pretoken_class::space && *p == ' ' && last - p > 1) {
+            int next_length;
+            pretoken_class next =
+                peek_pretoken_class(p + 1, last, next_length);
+            if (next != pretoken_class::space) {
+                ++p;
+                c = next;
+                length = next_length;
+            }
+        }
+        if (c == pretoken_class::space) {
+            CUIT last_space = p;
+            bool several = false;
+            for (;;) {
+                last_space = p;
+                p += length;
+                if (p == last) {
+                    break;
+                }
+                if (peek_pretoken_class(p, last, length)
+                    != pretoken_class::space)
+                {
+                    if (several) {
+                        p = last_space;
+                    }
+                    break;
+                }
+                several = true;
+            }
+            f(start, p);
+            continue;
+        }
+        do {
+            p += length;
+        } while (p != last && peek_pretoken_class(p, last, length) == c);
+        f(start, p);
+    }
+}
+
+/*
+ * merge_table
+ * A perfect hash table, built with the hash and displace algorithm, that
+ * maps each pair of tokens that is merged to the rank of the merge and the
+ * token that it forms.  Keys are divided into buckets of about four by one
+ * hash; the buckets are placed, largest first, by finding for each a
+ * displacement that maps its keys to free slots.  A lookup reads one
+ * displacement and one slot, which holds the key so that pairs that are
+ * not merged are rejected.
+ */
+class merge_table {
+public:
+    static constexpr unsigned no_merge = ~0u;
+
+    struct entry {
+        std::uint64_t pair;
+        unsigned rank;
+        unsigned token;
+    };
+
+    // Constructs a table of the merges 'merges', the pairs of which must be
+    // distinct and are made with make_pair().
+    explicit merge_table(const std::vector<entry> &merges) {
+        std::size_t slot_count = 1;
+        while (slot_count < merges.size() + merges.size() / 4 + 1) {
+            slot_count *= 2;
+        }
+        std::size_t bucket_count = 1;
+        while (bucket_count * 4 < merges.size()) {
+            bucket_count *= 2;
+        }
+        for (seed = 0; ! build(merges, slot_count, bucket_count); ++seed) {
+        }
+    }
+
+    static std::uint64_t make_pair(unsigned left, unsigned right) noexcept {
+        return std::uint64_t{left} << 32 | right;
+    }
+
+    // Returns the entry for the merge of the tokens 'left' and 'right', or
+    // an entry with the rank no_merge if they are not merged.
+    const entry& find(unsigned left, unsigned right) const noexcept {
+        static const entry none{empty, no_merge, no_merge};
+        std::uint64_t pair = make_pair(left, right);
+        std::uint64_t h = hash(pair, seed);
+        const entry &e = slots[slot(h, displacements[bucket(h)])];
+        return e.pair == pair ? e : none;
+    }
+
+private:
+    static constexpr std::uint64_t empty = ~std::uint64_t{0};
+
+    static std::uint64_t hash(std::uint64_t key, std::uint64_t salt) noexcept
+    {
+        key ^= salt * 0x9E3779B97F4A7C15;
+        key ^= key >> 33;
+        key *= 0xFF51AFD7ED558CCD;
+        key ^= key >> 33;
+        key *= 0xC4CEB9FE1A85EC53;
+        key ^= key >> 33;
+        return key;
+    }
+
+    std::size_t bucket(std::uint64_t h) const noexcept {
+        return (h >> 32) & (displacements.size() - 1);
+    }
+
+    std::size_t slot(std::uint64_t h, std::uint32_t d) const noexcept {
+        return (std::uint32_t(h) + d * ((h >> 32) | 1)) & (slots.size() - 1);
+    }
+
+    // Places the keys of 'merges' with the current seed and returns true, or
+    // returns false if a bucket cannot be placed.
+    bool build(
+        const std::vector<entry> &merges,
+        std::size_t slot_count,
+        std::size_t bucket_count)
+    {
+        constexpr std::uint32_t max_displacement = 1 << 16;
+        slots.assign(slot_count, entry{empty, no_merge, no_merge});
+        displacements.assign(bucket_count, 0);
+        std::vector<std::vector<std::size_t>> buckets(bucket_count);
+        for (std::size_t i = 0; i < merges.size(); ++i) {
+            buckets[bucket(hash(merges[i].pair, seed))].push_back(i);
+        }
+        std::vector<std::size_t> order(bucket_count);
+        for (std::size_t b = 0; b < bucket_count; ++b) {
+            order[b] = b;
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [&](std::size_t l, std::size_t r) {
+                             return buckets[l].size() > buckets[r].size();
+                         });
+        std::vector<std::size_t> placed;
+        for (std::size_t b : order) {
+            if (buckets[b].empty()) {
+                break;
+            }
+            std::uint32_t d = 0;
+            for (; d < max_displacement; ++d) {
+                placed.clear();
+                for (std::size_t i : buckets[b]) {
+                    std::size_t s = slot(hash(merges[i].pair, seed), d);
+                    if (slots[s].pair != empty) {
+                        break;
+                    }
+                    slots[s] = merges[i];
+                    placed.push_back(s);
+                }
+                if (placed.size() == buckets[b].size()) {
+                    break;
+                }
+                for (std::size_t s : placed) {
+                    slots[s].pair = empty;
+                }
+            }
+            if (d == max_displacement) {
+                return false;
+            }
+            displacements[b] = d;
+        }
+        return true;
+    }
+
+    std::uint64_t seed;
+    std::vector<std::uint32_t> displacements;
+    std::vector<entry> slots;
+};
+
+} // namespace text_detail
+
+
+/*
+ * bpe_tokenizer
+ * A byte-level byte pair encoding (BPE) tokenizer for UTF-8 text.  Tokens
+ * are sequences of bytes; the 256 single byte tokens have the identifiers 0
+ * through 255, and each merge of two tokens forms a token with the next
+ * identifier unless a token with its bytes already exists.  Text is divided
+ * into pieces as by the pretokenization regular expression of the GPT-2
+ * tokenizer, and within each piece, the adjacent pair of tokens with the
+ * lowest ranked merge, the leftmost of any ties, is merged until no pair
+ * has a merge.  Merges are given as raw bytes, not in the printable
+ * character mapping of the GPT-2 merges file.
+ */
+class bpe_tokenizer {
+public:
+    // Constructs a tokenizer with the merges 'merges', in order of rank,
+    // each of which is a pair of the bytes of the tokens it merges.  Throws
+    // text_tokenizer_error if a merge names a token that neither is a single
+    // byte nor is formed by an earlier merge.  A pair after its first
+    // occurrence is ignored.
+    explicit bpe_tokenizer(
+        const std::vector<std::pair<std::string, std::string>> &merges)
+    :
+        table{make_merges(merges, tokens)}
+    {}
+
+    // Returns the number of tokens.
+    std::size_t vocabulary_size() const noexcept {
+        return tokens.size();
+    }
+
+    // Returns the bytes of the token with the identifier 'id'.
+    const std::string& token(unsigned id) const {
+        return tokens.at(id);
+    }
+
+    // Writes the identifiers of the tokens of the text view 'tv' to 'out'
+    // and returns 'out'.  Pieces are found and merged in one pass over the
+    // code units of the text; characters are decoded only to classify those
+    // that are not ASCII.  Pieces of at most 64 bytes are merged in place
+    // with a scan for the lowest ranked pair after each merge, and longer
+    // pieces with a priority queue.
+    template<TextView TVT, typename OIT>
+    requires std::is_same<encoding_type_t<TVT>, utf8_encoding>::value
+          && origin::Random_access_iterator<
+                 origin::Iterator_type<const typename TVT::range_type>>()
+    OIT encode(
+        const TVT &tv,
+        OIT out) const
+    {
+        text_detail::pretokenize(
+            text_detail::adl_begin(tv.base()),
+            text_detail::adl_end(tv.base()),
+            [&](auto first, auto last) {
+                out = this->encode_piece(first, last, out);
+            });
+        return out;
+    }
+
+    // Returns the identifiers of the tokens of the text view 'tv'.
+    template<TextView TVT>
+    requires std::is_same<encoding_type_t<TVT>, utf8_encoding>::value
+          && origin::Random_access_iterator<
+                 origin::Iterator_type<const typename TVT::range_type>>()
+    std::vector<unsigned> encode(
+        const TVT &tv) const
+    {
+        std::vector<unsigned> ids;
+        encode(tv, std::back_inserter(ids));
+        return ids;
+    }
+
+    // Returns the identifiers of the tokens of each text view of the random
+    // access range 'documents', which are encoded concurrently by 'threads'
+    // threads, or if 'threads' is 0, as many as the hardware supports.
+    // Threads take documents from a shared counter, so long documents do not
+    // hold up the others.  An exception thrown while encoding a document is
+    // rethrown once all threads have finished.
+    template<typename RT>
+    requires origin::Random_access_iterator<origin::Iterator_type<const RT>>()
+    std::vector<std::vector<unsigned>> encode_batch(
+        const RT &documents,
+        unsigned threads = 0) const
+    {
+        auto first = text_detail::adl_begin(documents);
+        std::size_t count = text_detail::adl_end(documents) - first;
+        std::vector<std::vector<unsigned>> results(count);
+        if (threads == 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        threads = std::min<std::size_t>(threads, std::max<std::size_t>(
+            count, 1));
+        std::atomic<std::size_t> next{0};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+        auto work = [&] {
+            try {
+                for (std::size_t i; (i = next++) < count; ) {
+                    results[i] = encode(first[i]);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{error_mutex};
+                if (! error) {
+                    error = std::current_exception();
+                }
+                next = count;
+            }
+        };
+        std::vector<std::thread> workers;
+        for (unsigned t = 1; t < threads; ++t) {
+            workers.emplace_back(work);
+        }
+        work();
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return results;
+    }
+
+    // Returns the bytes of the tokens with the identifiers in ['first',
+    // 'last').
+    template<typename IT>
+    requires origin::Input_iterator<IT>()
+    std::string decode(
+        IT first,
+        IT last) const
+    {
+        std::string s;
+        for (; first != last; ++first) {
+            s += token(*first);
+        }
+        return s;
+    }
+
+private:
+    static constexpr std::size_t small_piece = 64;
+
+    static text_detail::merge_table make_merges(
+        const std::vector<std::pair<std::string, std::string>> &merges,
+        std::vector<std::string> &tokens)
+    {
+        std::unordered_map<std::string, unsigned> ids;
+        for (unsigned b = 0; b < 256; ++b) {
+            tokens.emplace_back(1, char(b));
+            ids.emplace(tokens.back(), b);
+        }
+        std::vector<text_detail::merge_table::entry> entries;
+        std::unordered_map<std::uint64_t, unsigned> ranks;
+        for (const auto &merge : merges) {
+            auto left = ids.find(merge.first);
+            auto right = ids.find(merge.second);
+            if (left == ids.end() || right == ids.end()) {
+                throw text_tokenizer_error("BPE merge of an unknown token");
+            }
+            std::uint64_t pair = text_detail::merge_table::make_pair(
+                left->second, right->second);
+            if (! ranks.emplace(pair, entries.size()).second) {
+                continue;
+            }
+            auto merged = ids.emplace(merge.first + merge.second,
+                                      tokens.size());
+            if (merged.second) {
+                tokens.push_back(merged.first->first);
+            }
+            entries.push_back({pair, unsigned(entries.size()),
+                               merged.first->second});
+        }
+        return text_detail::merge_table{entries};
+    }
+
+    // Writes the identifiers of the tokens of the piece of code units
+    // ['first', 'last') to 'out' and returns 'out'.
+    template<typename CUIT, typename OIT>
+    OIT encode_piece(CUIT first, CUIT last, OIT out) const {
+        std::size_t n = last - first;
+        if (n == 1) {
+            *out++ = static_cast<unsigned char>(*first);
+            return out;
+        }
+        if (n > small_piece) {
+            return encode_long_piece(first, last, out);
+        }
+        unsigned ids[small_piece], ranks[small_piece], merged[small_piece];
+        auto find_pair = [&](std::size_t i) {
+            const text_detail::merge_table::entry &e =
+                table.find(ids[i], ids[i + 1]);
+            ranks[i] = e.rank;
+            merged[i] = e.token;
+        };
+        for (std::size_t i = 0; i < n; ++i) {
+            ids[i] = static_cast<unsigned char>(first[i]);
+        }
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            find_pair(i);
+        }
+        while (n > 1) {
+            std::size_t best = 0;
+            for (std::size_t i = 1; i + 1 < n; ++i) {
+                if (ranks[i] < ranks[best]) {
+                    best = i;
+                }
+            }
+            if (ranks[best] == text_detail::merge_table::no_merge) {
+                break;
+            }
+            ids[best] = merged[best];
+            std::copy(ids + best + 2, ids + n, ids + best + 1);
+            if (best + 2 < n) {
+                std::copy(ranks + best + 2, ranks + n - 1, ranks + best + 1);
+                std::copy(merged + best + 2, merged + n - 1,
+                          merged + best + 1);
+            }
+            --n;
+            if (best > 0) {
+                find_pair(best - 1);
+            }
+            if (best + 1 < n) {
+                find_pair(best);
+            }
+        }
+        return std::copy(ids, ids + n, out);
+    }
+
+    // Pieces longer than small_piece are merged with a priority queue of the
+    // pairs of adjacent tokens, ordered by rank and then position, in a
+    // linked list of tokens.  Entries for pairs that have since been merged
+    // are discarded when they reach the top of the queue.
+    template<typename CUIT, typename OIT>
+    OIT encode_long_piece(CUIT first, CUIT last, OIT out) const {
+        std::size_t n = last - first;
+        std::vector<unsigned> ids(n);
+        std::vector<std::size_t> next(n), previous(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            ids[i] = static_cast<unsigned char>(first[i]);
+            next[i] = i + 1;
+            previous[i] = i ? i - 1 : 0;
+        }
+        using candidate = std::pair<unsigned, std::size_t>;
+        std::priority_queue<candidate, std::vector<candidate>,
+                            std::greater<candidate>> queue;
+        auto push = [&](std::size_t i) {
+            unsigned rank = table.find(ids[i], ids[next[i]]).rank;
+            if (rank != text_detail::merge_table::no_merge) {
+                queue.push({rank, i});
+            }
+        };
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            push(i);
+        }
+        const unsigned removed = text_detail::merge_table::no_merge;
+        while (! queue.empty()) {
+            candidate c = queue.top();
+            queue.pop();
+            std::size_t i = c.second;
+            if (ids[i] == removed || next[i] == n) {
+                continue;
+            }
+            const text_detail::merge_table::entry &e =
+                table.find(ids[i], ids[next[i]]);
+            if (e.rank != c.first) {
+                continue;
+            }
+            std::size_t j = next[i];
+            ids[i] = e.token;
+            ids[j] = removed;
+            next[i] = next[j];
+            if (next[j] != n) {
+                previous[next[j]] = i;
+            }
+            if (i != 0) {
+                push(previous[i]);
+            }
+            if (next[i] != n) {
+                push(i);
+            }
+        }
+        for (std::size_t i = 0; i != n; i = next[i]) {
+            *out++ = ids[i];
+        }
+        return out;
+    }
+
+    std::vector<std::string> tokens;
+    text_detail::merge_table table;
+};
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_BPE_TOKENIZER_HPP
@@ -0,0 +1,502 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_CASE_MAPPING_VIEW_HPP) // {
+#define TEXT_VIEW_CASE_MAPPING_VIEW_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/boundary_view.hpp>
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/charsets.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/text_iterator.hpp>
+#include <text_view_detail/unicode/unicode_trie.hpp>
+#include <text_view_detail/unicode/case_tables.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <origin/core/traits.hpp>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+/*
+ * Case mappings
+ * The full, language independent case mappings of the Unicode Standard
+ * (section 3.13): lowercase, uppercase, and default case folding.
+ */
+enum class case_mapping {
+    lower,
+    upper,
+    fold
+};
+
+
+namespace text_detail {
+
+// Returns the case_table entry for 'cp'.
+inline const case_table::entry&
+case_entry(char32_t cp) noexcept {
+    return case_table::entries[trie_lookup<case_table>(cp)];
+}
+
+// Returns the delta of the simple case mapping 'cm' in 'entry'.
+constexpr int case_delta(
+    case_mapping cm,
+    const case_table::entry &entry) noexcept
+{
+    return cm == case_mapping::lower ? entry.lower
+         : cm == case_mapping::upper ? entry.upper
+         : entry.fold;
+}
+
+// Returns the case mapping 'cm' of the ASCII character 'c'.
+constexpr char32_t map_ascii_case(case_mapping cm, char32_t c) noexcept {
+    return cm == case_mapping::upper
+         ? (c - U'a' < 26 ? c - 0x20 : c)
+         : (c - U'A' < 26 ? c + 0x20 : c);
+}
+
+// Returns the case_table flags of the ASCII character 'c'.
+constexpr unsigned char ascii_case_flags(char32_t c) noexcept {
+    return (c | 0x20) - U'a' < 26 ? case_table::cased
+         : c == U'\'' || c == U'.' || c == U':' || c == U'^' || c == U'`'
+         ? case_table::case_ignorable
+         : 0;
+}
+
+// Updates 'cased_before', which is true if the characters seen so far end
+// with a cased character followed by zero or more case-ignorable characters,
+// for a following character with case_table flags 'flags'.
+inline void update_cased_before(
+    bool &cased_before,
+    unsigned char flags) noexcept
+{
+    if (flags & case_table::cased) {
+        cased_before = true;
+    } else if (! (flags & case_table::case_ignorable)) {
+        cased_before = false;
+    }
+}
+
+// Returns true if the characters that follow 'it' begin with zero or more
+// case-ignorable characters followed by a cased character; the lookahead of
+// the Final_Sigma condition.
+template<typename TIT, typename TST>
+bool is_followed_by_cased(TIT it, TST last) {
+    for (++it; it != last; ++it) {
+        unsigned char flags = case_entry((*it).get_code_point()).flags;
+        if (flags & case_table::cased) {
+            return true;
+        }
+        if (! (flags & case_table::case_ignorable)) {
+            return false;
+        }
+    }
+    return false;
+}
+
+// Writes the full case mapping 'cm' of a code point with the special flag to
+// 'mapped' and returns the number of code points written.
+inline int map_special_case(
+    case_mapping cm,
+    char32_t cp,
+    char32_t *mapped) noexcept
+{
+    const case_table::special_mapping *special = std::lower_bound(
+        std::begin(case_table::special_mappings),
+        std::end(case_table::special_mappings),
+        cp,
+        [](const case_table::special_mapping &s, char32_t cp) {
+            return s.code_point < cp;
+        });
+    const char32_t *mapping = cm == case_mapping::lower ? special->lower
+                            : cm == case_mapping::upper ? special->upper
+                            : special->fold;
+    int length = 0;
+    while (length < case_table::max_mapping && mapping[length]) {
+        mapped[length] = mapping[length];
+        ++length;
+    }
+    return length;
+}
+
+// Writes the full case mapping 'CM' of the character at 'it', with code point
+// 'cp', to 'mapped' and returns the number of code points written.
+// 'cased_before' holds the context for the Final_Sigma condition and is
+// updated to reflect the character; the characters that follow 'it' are only
+// examined to evaluate Final_Sigma.
+template<case_mapping CM, typename TIT, typename TST>
+int map_character_case(
+    char32_t cp,
+    bool &cased_before,
+    const TIT &it,
+    TST last,
+    char32_t *mapped)
+{
+    if (cp < 0x80) {
+        update_cased_before(cased_before, ascii_case_flags(cp));
+        mapped[0] = map_ascii_case(CM, cp);
+        return 1;
+    }
+    const case_table::entry &entry = case_entry(cp);
+    bool final_sigma = CM == case_mapping::lower && cp == 0x03A3
+                    && cased_before && ! is_followed_by_cased(it, last);
+    update_cased_before(cased_before, entry.flags);
+    if (entry.flags & case_table::special) {
+        return map_special_case(CM, cp, mapped);
+    }
+    mapped[0] = final_sigma ? 0x03C2 : cp + case_delta(CM, entry);
+    return 1;
+}
+
+// Writes the case mapping 'CM' of blocks of 16 code units at the start of
+// [in, in_end) that begin with ASCII characters to 'out', advancing both and
+// updating 'cased_before' as map_character_case() does.  Stops after the
+// ASCII characters of the first block that contains a non-ASCII code unit or
+// at the last partial block.  Returns true if any code units were written.
+template<case_mapping CM, typename CUIT, typename CUOIT>
+bool map_ascii_case_blocks(
+    CUIT &in,
+    CUIT in_end,
+    CUOIT &out,
+    bool &cased_before)
+{
+    bool written = false;
+#if defined(__SSE2__)
+    const char first = CM == case_mapping::upper ? 'a' : 'A';
+    const __m128i below = _mm_set1_epi8(char(first - 1));
+    const __m128i above = _mm_set1_epi8(char(first + 26));
+    const __m128i delta = _mm_set1_epi8(0x20);
+    while (in_end - in >= 16) {
+        unsigned char block[16];
+        std::copy(in, in + 16, block);
+        __m128i octets = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(block));
+        int non_ascii = _mm_movemask_epi8(octets);
+        int length = non_ascii ? __builtin_ctz(non_ascii) : 16;
+        if (length == 0) {
+            break;
+        }
+        // Code units of non-ASCII characters compare as negative values and
+        // so are never in the range of letters to be mapped.
+        __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(octets, below),
+                                        _mm_cmplt_epi8(octets, above));
+        __m128i deltas = _mm_and_si128(letters, delta);
+        unsigned char mapped[16];
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i *>(mapped),
+            CM == case_mapping::upper ? _mm_sub_epi8(octets, deltas)
+                                      : _mm_add_epi8(octets, deltas));
+        out = std::copy(mapped, mapped + length, out);
+        for (int i = length; i > 0; --i) {
+            unsigned char flags = ascii_case_flags(block[i - 1]);
+            if (! (flags & case_table::case_ignorable)) {
+                cased_before = flags & case_table::cased;
+                break;
+            }
+        }
+        in += length;
+        written = true;
+        if (length < 16) {
+            break;
+        }
+    }
+#endif
+    return written;
+}
+
+} // namespace text_detail
+
+
+/*
+ * case_mapping_view
+ * A view adapter over a text view that presents the characters of the full
+ * case mapping 'CM' of the underlying text.  Characters are mapped lazily as
+ * the view is iterated; a character whose mapping consists of more than one
+ * code point, such as U+00DF LATIN SMALL LETTER SHARP S, which uppercases and
+ * case folds to "ss", is held in a small fixed size buffer in the iterator,
+ * so iteration performs no allocations.  Lowercase mapping evaluates the
+ * Final_Sigma condition, which looks ahead past any case-ignorable characters
+ * that follow U+03A3 GREEK CAPITAL LETTER SIGMA.  The underlying text view
+ * must provide forward iterators and its characters must have Unicode code
+ * points.
+ */
+template<case_mapping CM, TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+class case_mapping_view {
+public:
+    using view_type = TVT;
+    using text_iterator = origin::Iterator_type<const view_type>;
+    using text_sentinel = origin::Sentinel_type<const view_type>;
+    using character_type = character<unicode_character_set>;
+
+    class sentinel;
+
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = character_type;
+        using reference = value_type;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        iterator(text_iterator first, text_sentinel last)
+        :
+            first{first}, last{last}
+        {
+            // Mapping the first character through operator++ keeps a single
+            // call site for map_character_case, which allows it to be
+            // inlined into the loop that advances the iterator.  A length of
+            // zero indicates that there is no mapped character to advance
+            // past.
+            ++*this;
+        }
+
+        reference operator*() const {
+            return character_type{mapped[index]};
+        }
+
+        iterator& operator++() {
+            if (++index >= length) {
+                if (length) {
+                    ++first;
+                }
+                index = 0;
+                if (first != last) {
+                    length = text_detail::map_character_case<CM>(
+                        (*first).get_code_point(), cased_before, first, last,
+                        mapped);
+                }
+            }
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator it{*this};
+            ++*this;
+            return it;
+        }
+
+        // Returns an iterator to the character in the underlying text view
+        // whose mapping holds the current character.
+        text_iterator base() const {
+            return first;
+        }
+
+        friend bool operator==(const iterator &l, const iterator &r) {
+            return l.first == r.first && l.index == r.index;
+        }
+        friend bool operator!=(const iterator &l, const iterator &r) {
+            return !(l == r);
+        }
+
+    private:
+        text_iterator first;
+        text_sentinel last;
+        char32_t mapped[text_detail::case_table::max_mapping] = {};
+        unsigned char length = 0;
+        unsigned char index = 0;
+        bool cased_before = false;
+    };
+
+    class sentinel {
+    public:
+        sentinel() = default;
+
+        explicit sentinel(text_sentinel last)
+            : last{last} {}
+
+        text_sentinel base() const {
+            return last;
+        }
+
+        friend bool operator==(const iterator &it, const sentinel &s) {
+            return it.base() == s.base();
+        }
+        friend bool operator!=(const iterator &it, const sentinel &s) {
+            return !(it == s);
+        }
+        friend bool operator==(const sentinel &s, const iterator &it) {
+            return it == s;
+        }
+        friend bool operator!=(const sentinel &s, const iterator &it) {
+            return !(it == s);
+        }
+
+    private:
+        text_sentinel last;
+    };
+
+    case_mapping_view() = default;
+
+    explicit case_mapping_view(view_type tv)
+        : tv{tv} {}
+
+    const view_type& base() const noexcept {
+        return tv;
+    }
+
+    iterator begin() const {
+        return iterator{text_detail::adl_begin(tv), text_detail::adl_end(tv)};
+    }
+    sentinel end() const {
+        return sentinel{text_detail::adl_end(tv)};
+    }
+
+private:
+    view_type tv;
+};
+
+template<TextView TVT>
+using to_lower_view = case_mapping_view<case_mapping::lower, TVT>;
+template<TextView TVT>
+using to_upper_view = case_mapping_view<case_mapping::upper, TVT>;
+template<TextView TVT>
+using case_fold_view = case_mapping_view<case_mapping::fold, TVT>;
+
+
+/*
+ * make_case_mapping_view
+ */
+// Constructs a view of the case mapping 'CM' of an existing text view.
+template<case_mapping CM, TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_case_mapping_view(
+    TVT tv)
+{
+    return case_mapping_view<CM, TVT>{tv};
+}
+
+// Constructs a view of the lowercase mapping of an existing text view.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_to_lower_view(
+    TVT tv)
+{
+    return to_lower_view<TVT>{tv};
+}
+
+// Constructs a view of the uppercase mapping of an existing text view.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_to_upper_view(
+    TVT tv)
+{
+    return to_upper_view<TVT>{tv};
+}
+
+// Constructs a view of the case folding of an existing text view.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_case_fold_view(
+    TVT tv)
+{
+    return case_fold_view<TVT>{tv};
+}
+
+
+/*
+ * map_case
+ */
+// Writes the characters of the case mapping 'CM' of a text view to an output
+// iterator and returns the output iterator.
+template<case_mapping CM, TextView TVT, typename OIT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+      && origin::Output_iterator<OIT, character<unicode_character_set>>()
+OIT map_case(
+    const TVT &tv,
+    OIT out)
+{
+    for (auto c : make_case_mapping_view<CM>(tv)) {
+        *out++ = c;
+    }
+    return out;
+}
+
+// Overload for text views and output text iterators in ASCII transparent
+// encodings over random access code unit iterators.  Runs of ASCII characters
+// are mapped and written as code units a block at a time.
+template<case_mapping CM, TextView TVT, TextEncoding ET, typename CUIT>
+requires origin::Random_access_iterator<typename TVT::code_unit_iterator>()
+      && text_detail::is_ascii_transparent_encoding<encoding_type_t<TVT>>
+      && text_detail::is_ascii_transparent_encoding<ET>
+otext_iterator<ET, CUIT> map_case(
+    const TVT &tv,
+    otext_iterator<ET, CUIT> out)
+{
+    using text_iterator = origin::Iterator_type<const TVT>;
+    auto cu_last = text_detail::adl_end(tv.base());
+    auto first = text_detail::adl_begin(tv);
+    auto last = text_detail::adl_end(tv);
+    bool cased_before = false;
+    while (first != last) {
+        auto cu_first = first.base();
+        CUIT cu_out = out.base();
+        if (text_detail::map_ascii_case_blocks<CM>(
+                cu_first, cu_last, cu_out, cased_before))
+        {
+            first = text_iterator{first.state(), &tv.base(), cu_first};
+            out = otext_iterator<ET, CUIT>{out.state(), cu_out};
+            continue;
+        }
+        char32_t mapped[text_detail::case_table::max_mapping];
+        int length = text_detail::map_character_case<CM>(
+            (*first).get_code_point(), cased_before, first, last, mapped);
+        for (int i = 0; i < length; ++i) {
+            *out++ = character<unicode_character_set>{mapped[i]};
+        }
+        ++first;
+    }
+    return out;
+}
+
+// Writes the characters of the lowercase mapping of a text view to an output
+// iterator and returns the output iterator.
+template<TextView TVT, typename OIT>
+auto to_lower(
+    const TVT &tv,
+    OIT out)
+{
+    return map_case<case_mapping::lower>(tv, out);
+}
+
+// Writes the characters of the uppercase mapping of a text view to an output
+// iterator and returns the output iterator.
+template<TextView TVT, typename OIT>
+auto to_upper(
+    const TVT &tv,
+    OIT out)
+{
+    return map_case<case_mapping::upper>(tv, out);
+}
+
+// Writes the characters of the case folding of a text view to an output
+// iterator and returns the output iterator.
+template<TextView TVT, typename OIT>
+auto case_fold(
+    const TVT &tv,
+    OIT out)
+{
+    return map_case<case_mapping::fold>(tv, out);
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CASE_MAPPING_VIEW_HPP
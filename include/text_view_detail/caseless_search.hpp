@@ -0,0 +1,293 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_CASELESS_SEARCH_HPP) // {
+#define TEXT_VIEW_CASELESS_SEARCH_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/boundary_view.hpp>
+#include <text_view_detail/case_mapping_view.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/normalization_view.hpp>
+#include <text_view_detail/text_view.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <origin/core/traits.hpp>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+/*
+ * Caseless matching
+ * The caseless matching relations of the Unicode Standard (section 3.13):
+ * default caseless matching (D144), under which text matches if its full
+ * case foldings are identical, and canonical caseless matching (D145), under
+ * which text matches if the NFD normalizations of the case foldings of its
+ * NFD normalizations are identical.
+ */
+enum class caseless_matching {
+    default_caseless,
+    canonical_caseless
+};
+
+
+namespace text_detail {
+
+// Writes the full case folding of 'cp' to 'mapped' and returns the number of
+// code points written.
+inline int fold_code_point(char32_t cp, char32_t *mapped) noexcept {
+    if (cp < 0x80) {
+        mapped[0] = map_ascii_case(case_mapping::fold, cp);
+        return 1;
+    }
+    const case_table::entry &entry = case_entry(cp);
+    if (entry.flags & case_table::special) {
+        return map_special_case(case_mapping::fold, cp, mapped);
+    }
+    mapped[0] = cp + entry.fold;
+    return 1;
+}
+
+// Appends the full canonical decompositions of the case foldings of the code
+// points in ['first', 'last') to 'out'.  The result is in NFD only once the
+// Canonical Ordering Algorithm has been applied to it.
+inline void append_folded_decomposition(
+    const char32_t *first,
+    const char32_t *last,
+    std::u32string &out)
+{
+    char32_t mapped[case_table::max_mapping];
+    for (; first != last; ++first) {
+        int length = fold_code_point(*first, mapped);
+        for (int i = 0; i < length; ++i) {
+            decompose(mapped[i], normalization_properties(mapped[i]), false,
+                      out);
+        }
+    }
+}
+
+// Returns the text of the text view 'tv' in the form that caseless matching
+// 'CM' compares: its full case folding, or for canonical caseless matching,
+// the NFD normalization of the case folding of its NFD normalization.
+template<caseless_matching CM, TextView TVT>
+std::u32string caseless_form(const TVT &tv) {
+    std::u32string s;
+    if (CM == caseless_matching::default_caseless) {
+        char32_t mapped[case_table::max_mapping];
+        for (auto c : tv) {
+            s.append(mapped, fold_code_point(c.get_code_point(), mapped));
+        }
+        return s;
+    }
+    std::u32string nfd;
+    for (auto c : tv) {
+        char32_t cp = c.get_code_point();
+        decompose(cp, normalization_properties(cp), false, nfd);
+    }
+    canonical_order(nfd);
+    append_folded_decomposition(nfd.data(), nfd.data() + nfd.size(), s);
+    canonical_order(s);
+    return s;
+}
+
+// Returns true if the full case folding of the characters in
+// ['first', 'next') is 'pattern' for some 'next', and if so, sets 'next'.
+// Case foldings are compared as each character is decoded, so characters are
+// examined only until the first code point that differs.
+template<typename TIT, typename TST>
+bool match_default_caseless(
+    TIT first,
+    TST last,
+    const std::u32string &pattern,
+    TIT &next)
+{
+    char32_t mapped[case_table::max_mapping];
+    std::size_t matched = 0;
+    while (first != last) {
+        char32_t cp = (*first).get_code_point();
+        std::size_t length = fold_code_point(cp, mapped);
+        ++first;
+        if (length > pattern.size() - matched
+            || ! std::equal(mapped, mapped + length, &pattern[matched]))
+        {
+            return false;
+        }
+        matched += length;
+        if (matched == pattern.size()) {
+            next = first;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns true if the NFD normalization of the case folding of the NFD
+// normalization of the characters in ['first', 'next') is 'pattern' for some
+// 'next', and if so, sets 'next' to the first such position.  'nfd' and
+// 'folded' are used as temporary storage.  As each character is decoded, its
+// decomposition is added to the NFD normalization of the characters before it,
+// and the folded form is recomputed.  Combining marks that follow may still
+// be reordered into the final canonical sequence of either, so only the
+// folded form of the code points before the last starter of the NFD text is
+// compared with the pattern until the whole folded form matches; a starter's
+// folded form always begins with a starter.
+template<typename TIT, typename TST>
+bool match_canonical_caseless(
+    TIT first,
+    TST last,
+    const std::u32string &pattern,
+    std::u32string &nfd,
+    std::u32string &folded,
+    TIT &next)
+{
+    nfd.clear();
+    while (first != last) {
+        char32_t cp = (*first).get_code_point();
+        ++first;
+        decompose(cp, normalization_properties(cp), false, nfd);
+        canonical_order(nfd);
+        std::size_t starter = nfd.size();
+        while (starter > 0
+               && canonical_combining_class(
+                   normalization_properties(nfd[--starter])) != 0)
+        {
+        }
+        folded.clear();
+        append_folded_decomposition(nfd.data(), nfd.data() + starter, folded);
+        std::size_t stable = folded.size();
+        append_folded_decomposition(
+            nfd.data() + starter, nfd.data() + nfd.size(), folded);
+        canonical_order(folded);
+        if (folded.size() > pattern.size()
+            || folded.compare(0, stable, pattern, 0, stable) != 0)
+        {
+            return false;
+        }
+        if (folded == pattern) {
+            next = first;
+            return true;
+        }
+    }
+    return false;
+}
+
+// In general, a match is attempted at each character.  See below for text in
+// ASCII transparent encodings.
+template<typename TIT, typename TST, typename RT>
+void skip_caseless_mismatches(TIT &, TST, const RT *, char32_t) {}
+
+// For text in ASCII transparent encodings, code units are scanned, 16 at a
+// time where SSE2 is available, for the first that might begin a match of a
+// pattern whose caseless form begins with 'initial'.  ASCII characters only
+// fold to ASCII characters, so a match can only begin with an ASCII character
+// that folds to 'initial', if 'initial' is ASCII, or with the lead code unit,
+// 0xC0 or above, of a non-ASCII character.  'first' is updated to that code
+// unit, or to the end of the text if there is none.
+template<typename TIT, typename TST, typename RT>
+requires is_ascii_transparent_encoding<encoding_type_t<TIT>>
+      && origin::Random_access_iterator<origin::Iterator_type<const RT>>()
+void skip_caseless_mismatches(
+    TIT &first,
+    TST,
+    const RT *range,
+    char32_t initial)
+{
+    auto cu_first = first.base();
+    auto cu_last = text_detail::adl_end(*range);
+    unsigned char lower = initial < 0x80 ? initial : 0xC0;
+    unsigned char upper = map_ascii_case(case_mapping::upper, lower);
+#if defined(__SSE2__)
+    const __m128i lower_octets = _mm_set1_epi8(char(lower));
+    const __m128i upper_octets = _mm_set1_epi8(char(upper));
+    // Lead code units compare as the signed values -64 through -1.
+    const __m128i below_lead = _mm_set1_epi8(char(0xBF));
+    const __m128i zero = _mm_setzero_si128();
+    while (cu_last - cu_first >= 16) {
+        unsigned char block[16];
+        std::copy(cu_first, cu_first + 16, block);
+        __m128i octets = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(block));
+        __m128i candidates = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(octets, lower_octets),
+                         _mm_cmpeq_epi8(octets, upper_octets)),
+            _mm_and_si128(_mm_cmpgt_epi8(octets, below_lead),
+                          _mm_cmplt_epi8(octets, zero)));
+        int mask = _mm_movemask_epi8(candidates);
+        if (mask) {
+            cu_first += __builtin_ctz(mask);
+            break;
+        }
+        cu_first += 16;
+    }
+#endif
+    cu_first = std::find_if(cu_first, cu_last, [=](unsigned char cu) {
+            return cu == lower || cu == upper || cu >= 0xC0;
+        });
+    first = TIT{first.state(), range, cu_first};
+}
+
+} // namespace text_detail
+
+
+/*
+ * caseless_search
+ */
+// Returns a text view of the first, and shortest, sequence of characters of
+// the text view 'tv' that matches the text view 'pattern' under the caseless
+// matching relation 'CM', or an empty text view at the end of 'tv' if there
+// is none.  An empty pattern matches at the beginning of 'tv'.  The text is
+// case folded, and for canonical caseless matching normalized, as it is
+// compared with the pattern; no folded copy of it is made.  For text in
+// ASCII transparent encodings, runs of ASCII characters that cannot begin a
+// match are skipped by examining code units directly.
+template<caseless_matching CM = caseless_matching::default_caseless,
+         TextView TVT, TextView PTVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+      && origin::Forward_iterator<origin::Iterator_type<const PTVT>>()
+auto caseless_search(
+    const TVT &tv,
+    const PTVT &pattern)
+{
+    auto first = text_detail::adl_begin(tv);
+    auto last = text_detail::adl_end(tv);
+    std::u32string p = text_detail::caseless_form<CM>(pattern);
+    if (p.empty()) {
+        return make_text_view(first, first);
+    }
+    std::u32string nfd, folded;
+    for (; first != last; ++first) {
+        text_detail::skip_caseless_mismatches(first, last, &tv.base(), p[0]);
+        if (first == last) {
+            break;
+        }
+        auto next = first;
+        if (CM == caseless_matching::default_caseless
+            ? text_detail::match_default_caseless(first, last, p, next)
+            : text_detail::match_canonical_caseless(
+                  first, last, p, nfd, folded, next))
+        {
+            return make_text_view(first, next);
+        }
+    }
+    return make_text_view(first, first);
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CASELESS_SEARCH_HPP
@@ -24,7 +24,7 @@ public:
     using code_point_type = code_point_type_t<character_set_type>;
 
     character() = default;
-    explicit character(code_point_type code_point)
+    constexpr explicit character(code_point_type code_point)
         : code_point{code_point} {}
 
     friend bool operator==(
@@ -43,7 +43,7 @@ public:
     void set_code_point(code_point_type code_point) {
         this->code_point = code_point;
     }
-    code_point_type get_code_point() const {
+    constexpr code_point_type get_code_point() const {
         return code_point;
     }
 
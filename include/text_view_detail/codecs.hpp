@@ -11,13 +11,21 @@
 #include <text_view_detail/codecs/trivial_codec.hpp>
 #include <text_view_detail/codecs/utf8_codec.hpp>
 #include <text_view_detail/codecs/utf8bom_codec.hpp>
+#include <text_view_detail/codecs/cesu8_codec.hpp>
+#include <text_view_detail/codecs/modified_utf8_codec.hpp>
+#include <text_view_detail/codecs/wtf8_codec.hpp>
 #include <text_view_detail/codecs/utf16_codec.hpp>
 #include <text_view_detail/codecs/utf16be_codec.hpp>
 #include <text_view_detail/codecs/utf16le_codec.hpp>
 #include <text_view_detail/codecs/utf16bom_codec.hpp>
+#include <text_view_detail/codecs/utf16_lossless_codec.hpp>
 #include <text_view_detail/codecs/utf32be_codec.hpp>
 #include <text_view_detail/codecs/utf32le_codec.hpp>
 #include <text_view_detail/codecs/utf32bom_codec.hpp>
+#include <text_view_detail/codecs/single_byte_codec.hpp>
+#include <text_view_detail/codecs/gb18030_codec.hpp>
+#include <text_view_detail/codecs/shift_jis_codec.hpp>
+#include <text_view_detail/codecs/iso_2022_jp_codec.hpp>
 
 
 #endif // } TEXT_VIEW_CODECS_HPP
@@ -0,0 +1,155 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_CODECS_BULK_UTF8_HPP) // {
+#define TEXT_VIEW_CODECS_BULK_UTF8_HPP
+
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * Helpers for the bulk transcoding functions provided by codecs for ASCII
+ * compatible encodings.
+ */
+
+// Copies blocks of 16 ASCII code units at the start of [in, in_end) to 'out',
+// advancing both.  Stops at the first block that contains a non-ASCII code
+// unit or at the last partial block; the caller is expected to translate at
+// least one such block before calling this function again.
+inline void copy_ascii_blocks(
+    const unsigned char *&in,
+    const unsigned char *in_end,
+    char *&out)
+{
+#if defined(__SSE2__)
+    while (in_end - in >= 16) {
+        __m128i octets = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(in));
+        if (_mm_movemask_epi8(octets)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), octets);
+        in += 16;
+        out += 16;
+    }
+#endif
+}
+
+// As above, but also stops at the first block that contains the code unit
+// 'stop'; used by encodings in which an ASCII code unit introduces a shift
+// sequence.
+inline void copy_ascii_blocks(
+    const unsigned char *&in,
+    const unsigned char *in_end,
+    char *&out,
+    unsigned char stop)
+{
+#if defined(__SSE2__)
+    const __m128i stops = _mm_set1_epi8(char(stop));
+    while (in_end - in >= 16) {
+        __m128i octets = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(in));
+        if (_mm_movemask_epi8(
+                _mm_or_si128(octets, _mm_cmpeq_epi8(octets, stops))))
+        {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), octets);
+        in += 16;
+        out += 16;
+    }
+#endif
+}
+
+// Copies blocks of 8 ASCII UTF-16 code units at the start of [in, in_end) to
+// 'out' as UTF-8, advancing both.  Stops as copy_ascii_blocks() does.
+inline void narrow_ascii_blocks(
+    const char16_t *&in,
+    const char16_t *in_end,
+    char *&out)
+{
+#if defined(__SSE2__)
+    const __m128i non_ascii = _mm_set1_epi16(short(0xFF80));
+    while (in_end - in >= 8) {
+        __m128i units = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(in));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(
+                _mm_and_si128(units, non_ascii), _mm_setzero_si128()))
+            != 0xFFFF)
+        {
+            break;
+        }
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out),
+                         _mm_packus_epi16(units, units));
+        in += 8;
+        out += 8;
+    }
+#endif
+}
+
+// Copies blocks of 16 ASCII code units at the start of [in, in_end) to 'out'
+// as UTF-16, advancing both.  Stops as copy_ascii_blocks() does.
+inline void widen_ascii_blocks(
+    const unsigned char *&in,
+    const unsigned char *in_end,
+    char16_t *&out)
+{
+#if defined(__SSE2__)
+    while (in_end - in >= 16) {
+        __m128i octets = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(in));
+        if (_mm_movemask_epi8(octets)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         _mm_unpacklo_epi8(octets, _mm_setzero_si128()));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 8),
+                         _mm_unpackhi_epi8(octets, _mm_setzero_si128()));
+        in += 16;
+        out += 16;
+    }
+#endif
+}
+
+// Writes the UTF-8 encoding of the Unicode scalar value 'cp' to 'out' and
+// returns the end of the written sequence.  Surrogate code points are written
+// as three code unit sequences, as WTF-8 requires.
+inline char* put_utf8(char32_t cp, char *out) {
+    if (cp <= 0x7F) {
+        *out++ = char(cp);
+    } else if (cp <= 0x7FF) {
+        *out++ = char(0xC0 + (cp >> 6));
+        *out++ = char(0x80 + (cp & 0x3F));
+    } else if (cp <= 0xFFFF) {
+        *out++ = char(0xE0 + (cp >> 12));
+        *out++ = char(0x80 + ((cp >> 6) & 0x3F));
+        *out++ = char(0x80 + (cp & 0x3F));
+    } else {
+        *out++ = char(0xF0 + (cp >> 18));
+        *out++ = char(0x80 + ((cp >> 12) & 0x3F));
+        *out++ = char(0x80 + ((cp >> 6) & 0x3F));
+        *out++ = char(0x80 + (cp & 0x3F));
+    }
+    return out;
+}
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CODECS_BULK_UTF8_HPP
@@ -0,0 +1,472 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_CODECS_CESU8_CODEC_HPP) // {
+#define TEXT_VIEW_CODECS_CESU8_CODEC_HPP
+
+
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/exceptions.hpp>
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/trivial_encoding_state.hpp>
+#include <text_view_detail/codecs/bulk_utf8.hpp>
+#include <climits>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * CESU-8 codec
+ * CESU-8 encodes code points in the BMP as UTF-8 does and encodes code points
+ * outside of the BMP as a UTF-16 surrogate pair, each surrogate encoded in
+ * three code units.  When MUTF8 is true, the codec implements the modified
+ * UTF-8 encoding used by Java and JNI, which additionally encodes U+0000 as
+ * the two code unit sequence 0xC0 0x80 so that encoded text contains no NUL
+ * code units.  Overlong sequences (other than 0xC0 0x80 for modified UTF-8),
+ * four code unit sequences, and unpaired surrogates are rejected.
+ */
+template<Character CT, CodeUnit CUT, bool MUTF8 = false>
+class cesu8_codec {
+public:
+    using state_type = trivial_encoding_state;
+    using state_transition_type = trivial_encoding_state_transition;
+    using character_type = CT;
+    using code_unit_type = CUT;
+    static constexpr int min_code_units = 1;
+    static constexpr int max_code_units = 6;
+
+    static_assert(sizeof(code_unit_type) * CHAR_BIT >= 8);
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode_state_transition(
+        state_type &state,
+        CUIT &out,
+        const state_transition_type &stt,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+    }
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode(
+        state_type &state,
+        CUIT &out,
+        character_type c,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+        code_point_type cp{c.get_code_point()};
+
+        if (MUTF8 && cp == 0) {
+            *out++ = unsigned_code_unit_type(0xC0);
+            ++encoded_code_units;
+            *out++ = unsigned_code_unit_type(0x80);
+            ++encoded_code_units;
+        } else if (cp <= 0x7F) {
+            *out++ = unsigned_code_unit_type(cp);
+            ++encoded_code_units;
+        } else if (cp <= 0x7FF) {
+            *out++ = unsigned_code_unit_type(0xC0 + ((cp >> 6) & 0x1F));
+            ++encoded_code_units;
+            *out++ = unsigned_code_unit_type(0x80 + (cp & 0x3F));
+            ++encoded_code_units;
+        } else if (cp >= 0xD800 && cp <= 0xDFFF) {
+            throw text_encode_error("Invalid Unicode code point");
+        } else if (cp <= 0xFFFF) {
+            encode_three(out, cp, encoded_code_units);
+        } else if (cp <= 0x10FFFF) {
+            encode_three(out, 0xD7C0 + (cp >> 10), encoded_code_units);
+            encode_three(out, 0xDC00 + (cp & 0x3FF), encoded_code_units);
+        } else {
+            throw text_encode_error("Invalid Unicode code point");
+        }
+    }
+
+    template<CodeUnitIterator CUIT, typename CUST>
+    requires origin::Input_iterator<CUIT>()
+          && origin::Convertible<
+                 origin::Value_type<CUIT>,
+                 std::make_unsigned_t<code_unit_type>>()
+          && origin::Sentinel<CUST, CUIT>()
+    static bool decode(
+        state_type &state,
+        CUIT &in_next,
+        CUST in_end,
+        character_type &c,
+        int &decoded_code_units)
+    {
+        decoded_code_units = 0;
+
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+
+        char32_t unit = decode_one(in_next, in_end, decoded_code_units);
+        if (unit >= 0xDC00 && unit <= 0xDFFF) {
+            throw text_decode_error("Unpaired surrogate code point");
+        }
+        if (unit >= 0xD800 && unit <= 0xDBFF) {
+            char32_t low = decode_one(in_next, in_end, decoded_code_units);
+            if (low < 0xDC00 || low > 0xDFFF) {
+                throw text_decode_error("Unpaired surrogate code point");
+            }
+            unit = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+        }
+        c.set_code_point(code_point_type(unit));
+        return true;
+    }
+
+    template<CodeUnitIterator CUIT, typename CUST>
+    requires origin::Input_iterator<CUIT>()
+          && origin::Convertible<
+                 origin::Value_type<CUIT>,
+                 std::make_unsigned_t<code_unit_type>>()
+          && origin::Sentinel<CUST, CUIT>()
+    static bool rdecode(
+        state_type &state,
+        CUIT &in_next,
+        CUST in_end,
+        character_type &c,
+        int &decoded_code_units)
+    {
+        decoded_code_units = 0;
+
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+
+        char32_t unit = rdecode_one(in_next, in_end, decoded_code_units);
+        if (unit >= 0xD800 && unit <= 0xDBFF) {
+            throw text_decode_error("Unpaired surrogate code point");
+        }
+        if (unit >= 0xDC00 && unit <= 0xDFFF) {
+            char32_t high = rdecode_one(in_next, in_end, decoded_code_units);
+            if (high < 0xD800 || high > 0xDBFF) {
+                throw text_decode_error("Unpaired surrogate code point");
+            }
+            unit = 0x10000 + ((high - 0xD800) << 10) + (unit - 0xDC00);
+        }
+        c.set_code_point(code_point_type(unit));
+        return true;
+    }
+
+    // Bulk transcoding of the code unit sequence [first, last) to UTF-8.
+    // UTF-8 never requires more code units than this encoding, so 'out' must
+    // have room for (last - first) code units and may be equal to 'first' to
+    // transcode in place.  Returns the end of the written sequence.  Throws
+    // text_decode_error if an invalid code unit sequence is encountered, or
+    // text_decode_underflow_error if the input ends within a sequence.
+    static char* decode_to_utf8(
+        const code_unit_type *first,
+        const code_unit_type *last,
+        char *out)
+    {
+        const unsigned char *in =
+            reinterpret_cast<const unsigned char *>(first);
+        const unsigned char *in_end =
+            reinterpret_cast<const unsigned char *>(last);
+        while (in != in_end) {
+            copy_ascii_blocks(in, in_end, out);
+            const unsigned char *block_end =
+                in_end - in > 16 ? in + 16 : in_end;
+            while (in < block_end) {
+                unsigned char cu1 = in[0];
+                if (cu1 <= 0x7F) {
+                    *out++ = char(cu1);
+                    ++in;
+                    continue;
+                }
+                if (cu1 < 0xC0 || cu1 > 0xEF) {
+                    throw text_decode_error(
+                        "Invalid CESU-8 code unit sequence");
+                }
+                if (cu1 <= 0xDF) {
+                    if (in_end - in < 2)
+                        throw text_decode_underflow_error(
+                            "text decode underflow error");
+                    unsigned char cu2 = in[1];
+                    if ((cu2 & 0xC0) != 0x80) {
+                        throw text_decode_error(
+                            "Invalid CESU-8 code unit sequence");
+                    }
+                    if (cu1 < 0xC2) {
+                        if (!MUTF8 || cu1 != 0xC0 || cu2 != 0x80) {
+                            throw text_decode_error(
+                                "Invalid CESU-8 code unit sequence");
+                        }
+                        *out++ = '\0';
+                    } else {
+                        *out++ = char(cu1);
+                        *out++ = char(cu2);
+                    }
+                    in += 2;
+                    continue;
+                }
+                if (in_end - in < 3)
+                    throw text_decode_underflow_error(
+                        "text decode underflow error");
+                char32_t unit = three_unit(in);
+                if (unit < 0xD800 || unit > 0xDFFF) {
+                    // Identical in UTF-8; copy forward so that in place
+                    // transcoding is safe.
+                    unsigned char cu2 = in[1];
+                    unsigned char cu3 = in[2];
+                    *out++ = char(cu1);
+                    *out++ = char(cu2);
+                    *out++ = char(cu3);
+                    in += 3;
+                    continue;
+                }
+                if (unit > 0xDBFF) {
+                    throw text_decode_error("Unpaired surrogate code point");
+                }
+                if (in_end - in > 3 && (in[3] < 0xE0 || in[3] > 0xEF)) {
+                    throw text_decode_error("Unpaired surrogate code point");
+                }
+                if (in_end - in < 6)
+                    throw text_decode_underflow_error(
+                        "text decode underflow error");
+                char32_t low = three_unit(in + 3);
+                if (low < 0xDC00 || low > 0xDFFF) {
+                    throw text_decode_error("Unpaired surrogate code point");
+                }
+                in += 6;
+                out = put_utf8(
+                    0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00), out);
+            }
+        }
+        return out;
+    }
+
+    // Bulk transcoding of the UTF-8 code unit sequence [first, last) to this
+    // encoding.  'out' must have room for 2 * (last - first) code units.
+    // Returns the end of the written sequence.  Throws text_decode_error if
+    // an invalid UTF-8 code unit sequence is encountered, or
+    // text_decode_underflow_error if the input ends within a sequence.
+    static code_unit_type* encode_from_utf8(
+        const char *first,
+        const char *last,
+        code_unit_type *out_first)
+    {
+        const unsigned char *in =
+            reinterpret_cast<const unsigned char *>(first);
+        const unsigned char *in_end =
+            reinterpret_cast<const unsigned char *>(last);
+        char *out = reinterpret_cast<char *>(out_first);
+        while (in != in_end) {
+            if (MUTF8) {
+                copy_ascii_blocks(in, in_end, out, 0x00);
+            } else {
+                copy_ascii_blocks(in, in_end, out);
+            }
+            const unsigned char *block_end =
+                in_end - in > 16 ? in + 16 : in_end;
+            while (in < block_end) {
+                unsigned char cu1 = in[0];
+                if (cu1 <= 0x7F) {
+                    if (MUTF8 && cu1 == 0) {
+                        *out++ = char(0xC0);
+                        *out++ = char(0x80);
+                    } else {
+                        *out++ = char(cu1);
+                    }
+                    ++in;
+                    continue;
+                }
+                if (cu1 < 0xC2 || cu1 > 0xF4) {
+                    throw text_decode_error("Invalid UTF-8 code unit sequence");
+                }
+                int length = cu1 <= 0xDF ? 2 : cu1 <= 0xEF ? 3 : 4;
+                if (in_end - in < length)
+                    throw text_decode_underflow_error(
+                        "text decode underflow error");
+                char32_t cp = cu1 & (0x7F >> length);
+                for (int i = 1; i < length; ++i) {
+                    if ((in[i] & 0xC0) != 0x80) {
+                        throw text_decode_error(
+                            "Invalid UTF-8 code unit sequence");
+                    }
+                    cp = (cp << 6) + (in[i] & 0x3F);
+                }
+                if ((length == 3 && cp < 0x800) ||
+                    (length == 4 && (cp < 0x10000 || cp > 0x10FFFF)) ||
+                    (cp >= 0xD800 && cp <= 0xDFFF))
+                {
+                    throw text_decode_error("Invalid UTF-8 code unit sequence");
+                }
+                if (length < 4) {
+                    for (int i = 0; i < length; ++i) {
+                        *out++ = char(in[i]);
+                    }
+                } else {
+                    out = put_three(out, 0xD7C0 + (cp >> 10));
+                    out = put_three(out, 0xDC00 + (cp & 0x3FF));
+                }
+                in += length;
+            }
+        }
+        return reinterpret_cast<code_unit_type *>(out);
+    }
+
+private:
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode_three(
+        CUIT &out,
+        char32_t unit,
+        int &encoded_code_units)
+    {
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+
+        *out++ = unsigned_code_unit_type(0xE0 + ((unit >> 12) & 0x0F));
+        ++encoded_code_units;
+        *out++ = unsigned_code_unit_type(0x80 + ((unit >> 6) & 0x3F));
+        ++encoded_code_units;
+        *out++ = unsigned_code_unit_type(0x80 + (unit & 0x3F));
+        ++encoded_code_units;
+    }
+
+    static char* put_three(char *out, char32_t unit) {
+        *out++ = char(0xE0 + ((unit >> 12) & 0x0F));
+        *out++ = char(0x80 + ((unit >> 6) & 0x3F));
+        *out++ = char(0x80 + (unit & 0x3F));
+        return out;
+    }
+
+    // Returns the 16-bit unit encoded by the three code units at 'in', the
+    // first of which is known to be a three code unit lead.
+    static char32_t three_unit(const unsigned char *in) {
+        if ((in[1] & 0xC0) != 0x80 || (in[2] & 0xC0) != 0x80) {
+            throw text_decode_error("Invalid CESU-8 code unit sequence");
+        }
+        char32_t unit =
+            ((in[0] & 0x0F) << 12) + ((in[1] & 0x3F) << 6) + (in[2] & 0x3F);
+        if (unit < 0x800) {
+            throw text_decode_error("Invalid CESU-8 code unit sequence");
+        }
+        return unit;
+    }
+
+    // Decodes a one, two, or three code unit sequence to a 16-bit unit,
+    // which may be a surrogate code point.
+    template<CodeUnitIterator CUIT, typename CUST>
+    static char32_t decode_one(
+        CUIT &in_next,
+        CUST in_end,
+        int &decoded_code_units)
+    {
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu1 = *in_next++;
+        ++decoded_code_units;
+        if (cu1 <= 0x7F) {
+            return cu1;
+        }
+        if (cu1 < 0xC0 || cu1 > 0xEF) {
+            throw text_decode_error("Invalid CESU-8 code unit sequence");
+        }
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu2 = *in_next++;
+        ++decoded_code_units;
+        if ((cu2 & 0xC0) != 0x80) {
+            throw text_decode_error("Invalid CESU-8 code unit sequence");
+        }
+        if (cu1 <= 0xDF) {
+            char32_t unit = ((cu1 & 0x1F) << 6) + (cu2 & 0x3F);
+            if (unit < 0x80 && !(MUTF8 && unit == 0)) {
+                throw text_decode_error("Invalid CESU-8 code unit sequence");
+            }
+            return unit;
+        }
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu3 = *in_next++;
+        ++decoded_code_units;
+        if ((cu3 & 0xC0) != 0x80) {
+            throw text_decode_error("Invalid CESU-8 code unit sequence");
+        }
+        char32_t unit =
+            ((cu1 & 0x0F) << 12) + ((cu2 & 0x3F) << 6) + (cu3 & 0x3F);
+        if (unit < 0x800) {
+            throw text_decode_error("Invalid CESU-8 code unit sequence");
+        }
+        return unit;
+    }
+
+    // Decodes a one, two, or three code unit sequence in reverse to a 16-bit
+    // unit, which may be a surrogate code point.
+    template<CodeUnitIterator CUIT, typename CUST>
+    static char32_t rdecode_one(
+        CUIT &in_next,
+        CUST in_end,
+        int &decoded_code_units)
+    {
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type rcu1 = *in_next++;
+        ++decoded_code_units;
+        if (rcu1 <= 0x7F) {
+            return rcu1;
+        }
+        if ((rcu1 & 0xC0) != 0x80) {
+            throw text_decode_error("Invalid CESU-8 code unit sequence");
+        }
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type rcu2 = *in_next++;
+        ++decoded_code_units;
+        if ((rcu2 & 0xE0) == 0xC0) {
+            char32_t unit = ((rcu2 & 0x1F) << 6) + (rcu1 & 0x3F);
+            if (unit < 0x80 && !(MUTF8 && unit == 0)) {
+                throw text_decode_error("Invalid CESU-8 code unit sequence");
+            }
+            return unit;
+        }
+        if ((rcu2 & 0xC0) != 0x80) {
+            throw text_decode_error("Invalid CESU-8 code unit sequence");
+        }
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type rcu3 = *in_next++;
+        ++decoded_code_units;
+        if ((rcu3 & 0xF0) != 0xE0) {
+            throw text_decode_error("Invalid CESU-8 code unit sequence");
+        }
+        char32_t unit =
+            ((rcu3 & 0x0F) << 12) + ((rcu2 & 0x3F) << 6) + (rcu1 & 0x3F);
+        if (unit < 0x800) {
+            throw text_decode_error("Invalid CESU-8 code unit sequence");
+        }
+        return unit;
+    }
+};
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CODECS_CESU8_CODEC_HPP
@@ -0,0 +1,269 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_CODECS_GB18030_CODEC_HPP) // {
+#define TEXT_VIEW_CODECS_GB18030_CODEC_HPP
+
+
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/exceptions.hpp>
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/trivial_encoding_state.hpp>
+#include <text_view_detail/codecs/bulk_utf8.hpp>
+#include <text_view_detail/codecs/multi_byte_charmaps.hpp>
+#include <algorithm>
+#include <climits>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * GB18030 codec
+ * Code points are encoded as one, two, or four code units.  Two-code-unit
+ * sequences are mapped by table.  Four-code-unit sequences are numbered by a
+ * linear index; the indexes below 39420 map to the remaining BMP code points
+ * by a table of ranges and the indexes starting at 189000 map to the
+ * supplementary planes in order.  GB18030 sequences can not be decoded in
+ * reverse, so this codec only provides forward decoding.
+ */
+template<Character CT, CodeUnit CUT>
+class gb18030_codec {
+public:
+    using state_type = trivial_encoding_state;
+    using state_transition_type = trivial_encoding_state_transition;
+    using character_type = CT;
+    using code_unit_type = CUT;
+    using charmap_type = gb18030_charmap;
+    static constexpr int min_code_units = 1;
+    static constexpr int max_code_units = 4;
+
+    static_assert(sizeof(code_unit_type) * CHAR_BIT >= 8);
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode_state_transition(
+        state_type &state,
+        CUIT &out,
+        const state_transition_type &stt,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+    }
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode(
+        state_type &state,
+        CUIT &out,
+        character_type c,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+        code_point_type cp{c.get_code_point()};
+
+        if (cp <= 0x7F) {
+            *out++ = unsigned_code_unit_type(cp);
+            ++encoded_code_units;
+            return;
+        }
+
+        unsigned long linear;
+        if (cp >= 0xD800 && cp <= 0xDFFF) {
+            throw text_encode_error("Invalid Unicode code point");
+        } else if (cp <= 0xFFFF) {
+            unsigned short dbcs =
+                charmap_type::from_unicode_blocks
+                    [charmap_type::from_unicode_index[
+                         cp >> charmap_type::block_bits]]
+                    [cp & ((1 << charmap_type::block_bits) - 1)];
+            if (dbcs != 0) {
+                *out++ = unsigned_code_unit_type(dbcs >> 8);
+                ++encoded_code_units;
+                *out++ = unsigned_code_unit_type(dbcs & 0xFF);
+                ++encoded_code_units;
+                return;
+            }
+            const auto *first = charmap_type::four_byte_ranges;
+            const auto *last = first + charmap_type::four_byte_range_count;
+            const auto *range = std::upper_bound(
+                first, last, cp,
+                [](code_point_type cp,
+                   const typename charmap_type::four_byte_range &r)
+                {
+                    return cp < r.code_point;
+                });
+            if (range == first) {
+                throw text_encode_error("Unmappable code point");
+            }
+            --range;
+            unsigned long offset = cp - range->code_point;
+            if (offset >= unsigned((range + 1)->linear - range->linear)) {
+                throw text_encode_error("Unmappable code point");
+            }
+            linear = range->linear + offset;
+        } else if (cp <= 0x10FFFF) {
+            linear = cp - 0x10000 + 189000;
+        } else {
+            throw text_encode_error("Invalid Unicode code point");
+        }
+
+        unsigned_code_unit_type cu4 = 0x30 + linear % 10;
+        linear /= 10;
+        unsigned_code_unit_type cu3 = 0x81 + linear % 126;
+        linear /= 126;
+        unsigned_code_unit_type cu2 = 0x30 + linear % 10;
+        linear /= 10;
+        unsigned_code_unit_type cu1 = 0x81 + linear;
+        *out++ = cu1;
+        ++encoded_code_units;
+        *out++ = cu2;
+        ++encoded_code_units;
+        *out++ = cu3;
+        ++encoded_code_units;
+        *out++ = cu4;
+        ++encoded_code_units;
+    }
+
+    template<CodeUnitIterator CUIT, typename CUST>
+    requires origin::Input_iterator<CUIT>()
+          && origin::Convertible<
+                 origin::Value_type<CUIT>,
+                 std::make_unsigned_t<code_unit_type>>()
+          && origin::Sentinel<CUST, CUIT>()
+    static bool decode(
+        state_type &state,
+        CUIT &in_next,
+        CUST in_end,
+        character_type &c,
+        int &decoded_code_units)
+    {
+        decoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu1 = *in_next++;
+        ++decoded_code_units;
+        if (cu1 <= 0x7F) {
+            c.set_code_point(code_point_type(cu1));
+            return true;
+        }
+        if (cu1 == 0x80 || cu1 == 0xFF) {
+            throw text_decode_error("Invalid GB18030 code unit sequence");
+        }
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu2 = *in_next++;
+        ++decoded_code_units;
+        if ((cu2 >= 0x40 && cu2 <= 0x7E) || (cu2 >= 0x80 && cu2 <= 0xFE)) {
+            char16_t u = charmap_type::two_byte_to_unicode[
+                (cu1 - 0x81) * 190 + (cu2 - 0x40) - (cu2 > 0x7F)];
+            if (u == 0xFFFF) {
+                throw text_decode_error("Unmapped GB18030 code unit sequence");
+            }
+            c.set_code_point(code_point_type(u));
+            return true;
+        }
+        if (cu2 < 0x30 || cu2 > 0x39) {
+            throw text_decode_error("Invalid GB18030 code unit sequence");
+        }
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu3 = *in_next++;
+        ++decoded_code_units;
+        if (cu3 < 0x81 || cu3 > 0xFE) {
+            throw text_decode_error("Invalid GB18030 code unit sequence");
+        }
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu4 = *in_next++;
+        ++decoded_code_units;
+        if (cu4 < 0x30 || cu4 > 0x39) {
+            throw text_decode_error("Invalid GB18030 code unit sequence");
+        }
+
+        unsigned long linear =
+            (((cu1 - 0x81) * 10UL + (cu2 - 0x30)) * 126 + (cu3 - 0x81)) * 10
+            + (cu4 - 0x30);
+        const auto *first = charmap_type::four_byte_ranges;
+        const auto *last = first + charmap_type::four_byte_range_count;
+        if (linear < last->linear) {
+            const auto *range = std::upper_bound(
+                first, last, linear,
+                [](unsigned long linear,
+                   const typename charmap_type::four_byte_range &r)
+                {
+                    return linear < r.linear;
+                }) - 1;
+            c.set_code_point(
+                code_point_type(range->code_point + (linear - range->linear)));
+            return true;
+        }
+        if (linear >= 189000 && linear < 189000 + 0x100000) {
+            c.set_code_point(code_point_type(linear - 189000 + 0x10000));
+            return true;
+        }
+        throw text_decode_error("Unmapped GB18030 code unit sequence");
+    }
+
+    // Bulk decoding of the code unit sequence [first, last) to UTF-8.  'out'
+    // must have room for 2 * (last - first) code units.  Returns the end of
+    // the written sequence.  Throws text_decode_error if an invalid or
+    // unmapped code unit sequence is encountered, or
+    // text_decode_underflow_error if the input ends within a sequence.
+    static char* decode_to_utf8(
+        const code_unit_type *first,
+        const code_unit_type *last,
+        char *out)
+    {
+        const unsigned char *in =
+            reinterpret_cast<const unsigned char *>(first);
+        const unsigned char *in_end =
+            reinterpret_cast<const unsigned char *>(last);
+        state_type state;
+        character_type c;
+        int decoded_code_units;
+        while (in != in_end) {
+            copy_ascii_blocks(in, in_end, out);
+            // Translate at least a block of code units before looking for
+            // another run of ASCII.
+            const unsigned char *block_end =
+                in_end - in > 16 ? in + 16 : in_end;
+            while (in < block_end) {
+                if (*in <= 0x7F) {
+                    *out++ = char(*in++);
+                    continue;
+                }
+                decode(state, in, in_end, c, decoded_code_units);
+                out = put_utf8(c.get_code_point(), out);
+            }
+        }
+        return out;
+    }
+};
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CODECS_GB18030_CODEC_HPP
@@ -0,0 +1,371 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_CODECS_ISO_2022_JP_CODEC_HPP) // {
+#define TEXT_VIEW_CODECS_ISO_2022_JP_CODEC_HPP
+
+
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/exceptions.hpp>
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/codecs/bulk_utf8.hpp>
+#include <text_view_detail/codecs/multi_byte_charmaps.hpp>
+#include <climits>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+/*
+ *                       to_initial, to_ascii (ESC ( B)
+ *          +------------------>+---------------+<------------------+
+ *          |                   | initial state |                   |
+ *          |        +---------<|    (ASCII)    |>---------+        |
+ *          |        |          +---------------+          |        |
+ *          |        | to_jis_x_0201_roman   to_jis_x_0208 |        |
+ *          |        | (ESC ( J)                 (ESC $ B) |        |
+ *          |        v                                     v        |
+ *       +------------------+     to_jis_x_0208      +------------+ |
+ *       | JIS X 0201 Roman |>---------------------->| JIS X 0208 |>+
+ *       +------------------+<----------------------<+------------+
+ *                             to_jis_x_0201_roman
+ *
+ * Escape sequences designate the character set that subsequent code units
+ * are interpreted in; they decode to no character.  Encoding a character
+ * that is not in the current character set first writes the escape sequence
+ * for a character set that includes it.  Encoded text must end in the initial
+ * state, so producers should encode a to_initial state transition at the end
+ * of their text.
+ */
+struct iso_2022_jp_encoding_state_transition {
+    enum {
+        to_initial,
+        to_ascii,
+        to_jis_x_0201_roman,
+        to_jis_x_0208
+    } state_transition;
+
+    static iso_2022_jp_encoding_state_transition
+    to_initial_state() {
+        return { to_initial };
+    }
+
+    static iso_2022_jp_encoding_state_transition
+    to_ascii_state() {
+        return { to_ascii };
+    }
+
+    static iso_2022_jp_encoding_state_transition
+    to_jis_x_0201_roman_state() {
+        return { to_jis_x_0201_roman };
+    }
+
+    static iso_2022_jp_encoding_state_transition
+    to_jis_x_0208_state() {
+        return { to_jis_x_0208 };
+    }
+};
+
+struct iso_2022_jp_encoding_state {
+    enum charset_type : unsigned char {
+        ascii,
+        jis_x_0201_roman,
+        jis_x_0208
+    };
+    charset_type charset = ascii;
+};
+
+
+namespace text_detail {
+
+template<Character CT, CodeUnit CUT>
+class iso_2022_jp_codec {
+public:
+    using state_type = iso_2022_jp_encoding_state;
+    using state_transition_type = iso_2022_jp_encoding_state_transition;
+    using character_type = CT;
+    using code_unit_type = CUT;
+    using charmap_type = jis_x_0208_charmap;
+    static constexpr int min_code_units = 1;
+    static constexpr int max_code_units = 5;
+
+    static_assert(sizeof(code_unit_type) * CHAR_BIT >= 8);
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode_state_transition(
+        state_type &state,
+        CUIT &out,
+        const state_transition_type &stt,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+
+        state_type::charset_type charset;
+        unsigned_code_unit_type intermediate;
+        unsigned_code_unit_type final;
+        switch (stt.state_transition) {
+            case state_transition_type::to_initial:
+            case state_transition_type::to_ascii:
+                charset = state_type::ascii;
+                intermediate = 0x28;  // (
+                final = 0x42;         // B
+                break;
+            case state_transition_type::to_jis_x_0201_roman:
+                charset = state_type::jis_x_0201_roman;
+                intermediate = 0x28;  // (
+                final = 0x4A;         // J
+                break;
+            case state_transition_type::to_jis_x_0208:
+                charset = state_type::jis_x_0208;
+                intermediate = 0x24;  // $
+                final = 0x42;         // B
+                break;
+            default:
+                throw text_encode_error("Invalid state transition");
+        }
+        if (state.charset == charset) {
+            return;
+        }
+        *out++ = unsigned_code_unit_type(0x1B);
+        ++encoded_code_units;
+        *out++ = intermediate;
+        ++encoded_code_units;
+        *out++ = final;
+        ++encoded_code_units;
+        state.charset = charset;
+    }
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode(
+        state_type &state,
+        CUIT &out,
+        character_type c,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+        code_point_type cp{c.get_code_point()};
+
+        if (cp <= 0x7F) {
+            if (cp == 0x1B) {
+                throw text_encode_error("Unmappable code point");
+            }
+            // JIS X 0201 Roman differs from ASCII only at 0x5C and 0x7E.
+            if (state.charset == state_type::jis_x_0208 ||
+                (state.charset == state_type::jis_x_0201_roman &&
+                 (cp == 0x5C || cp == 0x7E)))
+            {
+                encode_state_transition(
+                    state, out, state_transition_type::to_ascii_state(),
+                    encoded_code_units);
+            }
+            *out++ = unsigned_code_unit_type(cp);
+            ++encoded_code_units;
+            return;
+        }
+
+        if (cp == 0xA5 || cp == 0x203E) {
+            if (state.charset != state_type::jis_x_0201_roman) {
+                encode_state_transition(
+                    state, out,
+                    state_transition_type::to_jis_x_0201_roman_state(),
+                    encoded_code_units);
+            }
+            *out++ = unsigned_code_unit_type(cp == 0xA5 ? 0x5C : 0x7E);
+            ++encoded_code_units;
+            return;
+        }
+
+        if (cp > 0xFFFF) {
+            throw text_encode_error("Unmappable code point");
+        }
+        unsigned short jis =
+            charmap_type::from_unicode_blocks
+                [charmap_type::from_unicode_index[
+                     cp >> charmap_type::block_bits]]
+                [cp & ((1 << charmap_type::block_bits) - 1)];
+        if (jis == 0) {
+            throw text_encode_error("Unmappable code point");
+        }
+        if (state.charset != state_type::jis_x_0208) {
+            encode_state_transition(
+                state, out, state_transition_type::to_jis_x_0208_state(),
+                encoded_code_units);
+        }
+        *out++ = unsigned_code_unit_type(jis >> 8);
+        ++encoded_code_units;
+        *out++ = unsigned_code_unit_type(jis & 0xFF);
+        ++encoded_code_units;
+    }
+
+    template<CodeUnitIterator CUIT, typename CUST>
+    requires origin::Input_iterator<CUIT>()
+          && origin::Convertible<
+                 origin::Value_type<CUIT>,
+                 std::make_unsigned_t<code_unit_type>>()
+          && origin::Sentinel<CUST, CUIT>()
+    static bool decode(
+        state_type &state,
+        CUIT &in_next,
+        CUST in_end,
+        character_type &c,
+        int &decoded_code_units)
+    {
+        decoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu1 = *in_next++;
+        ++decoded_code_units;
+
+        if (cu1 == 0x1B) {
+            if (in_next == in_end)
+                throw text_decode_underflow_error("text decode underflow error");
+            unsigned_code_unit_type cu2 = *in_next++;
+            ++decoded_code_units;
+            if (in_next == in_end)
+                throw text_decode_underflow_error("text decode underflow error");
+            unsigned_code_unit_type cu3 = *in_next++;
+            ++decoded_code_units;
+            if (cu2 == 0x28 && cu3 == 0x42) {
+                state.charset = state_type::ascii;
+            } else if (cu2 == 0x28 && cu3 == 0x4A) {
+                state.charset = state_type::jis_x_0201_roman;
+            } else if (cu2 == 0x24 && (cu3 == 0x40 || cu3 == 0x42)) {
+                state.charset = state_type::jis_x_0208;
+            } else {
+                throw text_decode_error("Invalid ISO-2022-JP escape sequence");
+            }
+            // An escape sequence was decoded; return false to indicate that
+            // a code point has not been decoded.
+            return false;
+        }
+
+        if (cu1 > 0x7F) {
+            throw text_decode_error("Invalid ISO-2022-JP code unit");
+        }
+        // Control characters are accepted in any state so that line breaks
+        // within double byte runs, which some producers emit, decode.
+        if (state.charset == state_type::ascii || cu1 < 0x21) {
+            c.set_code_point(code_point_type(cu1));
+            return true;
+        }
+        if (state.charset == state_type::jis_x_0201_roman) {
+            c.set_code_point(code_point_type(
+                cu1 == 0x5C ? 0xA5 : cu1 == 0x7E ? 0x203E : cu1));
+            return true;
+        }
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu2 = *in_next++;
+        ++decoded_code_units;
+        if (cu1 == 0x7F || cu2 < 0x21 || cu2 > 0x7E) {
+            throw text_decode_error("Invalid ISO-2022-JP code unit");
+        }
+        int row = cu1 - 0x21;
+        int cell = cu2 - 0x21;
+        if (row >= charmap_type::rows) {
+            throw text_decode_error("Unmapped ISO-2022-JP code unit sequence");
+        }
+        char16_t u = charmap_type::to_unicode[row][cell];
+        if (u == 0xFFFF) {
+            throw text_decode_error("Unmapped ISO-2022-JP code unit sequence");
+        }
+        c.set_code_point(code_point_type(u));
+        return true;
+    }
+
+    // Bulk decoding of the code unit sequence [first, last) to UTF-8 starting
+    // in, and updating, 'state'.  'out' must have room for 3 * (last - first)
+    // code units; JIS X 0201 Roman 0x7E decodes to the three code unit
+    // sequence for U+203E.  Returns the end of the written sequence.  Throws
+    // text_decode_error if an invalid or unmapped code unit sequence is
+    // encountered, or text_decode_underflow_error if the input ends within a
+    // sequence.  The state is only consulted when a run of code units in one
+    // character set ends, so long runs translate in tight loops.
+    static char* decode_to_utf8(
+        state_type &state,
+        const code_unit_type *first,
+        const code_unit_type *last,
+        char *out)
+    {
+        const unsigned char *in =
+            reinterpret_cast<const unsigned char *>(first);
+        const unsigned char *in_end =
+            reinterpret_cast<const unsigned char *>(last);
+        character_type c;
+        int decoded_code_units;
+        while (in != in_end) {
+            switch (state.charset) {
+                case state_type::ascii:
+                    copy_ascii_blocks(in, in_end, out, 0x1B);
+                    while (in != in_end && *in != 0x1B && *in <= 0x7F) {
+                        *out++ = char(*in++);
+                    }
+                    break;
+                case state_type::jis_x_0208:
+                    while (in_end - in >= 2 &&
+                           in[0] >= 0x21 && in[0] - 0x21 < charmap_type::rows &&
+                           in[1] >= 0x21 && in[1] <= 0x7E)
+                    {
+                        char16_t u =
+                            charmap_type::to_unicode[in[0] - 0x21][in[1] - 0x21];
+                        if (u == 0xFFFF) {
+                            break;
+                        }
+                        out = put_utf8(u, out);
+                        in += 2;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            // Escape sequences, the JIS X 0201 Roman character set, and
+            // anything the loops above declined are handled by decode().
+            if (in != in_end) {
+                if (decode(state, in, in_end, c, decoded_code_units)) {
+                    out = put_utf8(c.get_code_point(), out);
+                }
+            }
+        }
+        return out;
+    }
+
+    // Bulk decoding of the code unit sequence [first, last) to UTF-8 starting
+    // in the initial state.
+    static char* decode_to_utf8(
+        const code_unit_type *first,
+        const code_unit_type *last,
+        char *out)
+    {
+        state_type state;
+        return decode_to_utf8(state, first, last, out);
+    }
+};
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CODECS_ISO_2022_JP_CODEC_HPP
@@ -0,0 +1,36 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_CODECS_MODIFIED_UTF8_CODEC_HPP) // {
+#define TEXT_VIEW_CODECS_MODIFIED_UTF8_CODEC_HPP
+
+
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/codecs/cesu8_codec.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * Modified UTF-8 codec
+ * Modified UTF-8 is CESU-8 with U+0000 encoded as 0xC0 0x80.  A lone 0x00
+ * code unit is still decoded as U+0000, as the Java virtual machine does.
+ */
+template<Character CT, CodeUnit CUT>
+using modified_utf8_codec = cesu8_codec<CT, CUT, true>;
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CODECS_MODIFIED_UTF8_CODEC_HPP
@@ -0,0 +1,208 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_CODECS_SHIFT_JIS_CODEC_HPP) // {
+#define TEXT_VIEW_CODECS_SHIFT_JIS_CODEC_HPP
+
+
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/exceptions.hpp>
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/trivial_encoding_state.hpp>
+#include <text_view_detail/codecs/bulk_utf8.hpp>
+#include <text_view_detail/codecs/multi_byte_charmaps.hpp>
+#include <climits>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * Shift_JIS codec
+ * Single code units encode ASCII and the half-width katakana.  Two-code-unit
+ * sequences encode the JIS X 0208 row/cell pairs, two rows per lead code
+ * unit.  Only mappings that round trip are supported; U+00A5 and U+203E are
+ * not encoded as 0x5C and 0x7E.  Shift_JIS sequences can not be decoded in
+ * reverse, so this codec only provides forward decoding.
+ */
+template<Character CT, CodeUnit CUT>
+class shift_jis_codec {
+public:
+    using state_type = trivial_encoding_state;
+    using state_transition_type = trivial_encoding_state_transition;
+    using character_type = CT;
+    using code_unit_type = CUT;
+    using charmap_type = jis_x_0208_charmap;
+    static constexpr int min_code_units = 1;
+    static constexpr int max_code_units = 2;
+
+    static_assert(sizeof(code_unit_type) * CHAR_BIT >= 8);
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode_state_transition(
+        state_type &state,
+        CUIT &out,
+        const state_transition_type &stt,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+    }
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode(
+        state_type &state,
+        CUIT &out,
+        character_type c,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+        code_point_type cp{c.get_code_point()};
+
+        if (cp <= 0x7F) {
+            *out++ = unsigned_code_unit_type(cp);
+            ++encoded_code_units;
+            return;
+        }
+        if (cp >= 0xFF61 && cp <= 0xFF9F) {
+            *out++ = unsigned_code_unit_type(cp - 0xFF61 + 0xA1);
+            ++encoded_code_units;
+            return;
+        }
+        if (cp > 0xFFFF) {
+            throw text_encode_error("Unmappable code point");
+        }
+        unsigned short jis =
+            charmap_type::from_unicode_blocks
+                [charmap_type::from_unicode_index[
+                     cp >> charmap_type::block_bits]]
+                [cp & ((1 << charmap_type::block_bits) - 1)];
+        if (jis == 0) {
+            throw text_encode_error("Unmappable code point");
+        }
+        int row = (jis >> 8) - 0x21;
+        int cell = (jis & 0xFF) - 0x21;
+        *out++ = unsigned_code_unit_type(
+            (row >> 1) + (row < 62 ? 0x81 : 0xC1));
+        ++encoded_code_units;
+        *out++ = unsigned_code_unit_type(
+            (row & 1) ? cell + 0x9F : cell + 0x40 + (cell >= 0x3F));
+        ++encoded_code_units;
+    }
+
+    template<CodeUnitIterator CUIT, typename CUST>
+    requires origin::Input_iterator<CUIT>()
+          && origin::Convertible<
+                 origin::Value_type<CUIT>,
+                 std::make_unsigned_t<code_unit_type>>()
+          && origin::Sentinel<CUST, CUIT>()
+    static bool decode(
+        state_type &state,
+        CUIT &in_next,
+        CUST in_end,
+        character_type &c,
+        int &decoded_code_units)
+    {
+        decoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu1 = *in_next++;
+        ++decoded_code_units;
+        if (cu1 <= 0x7F) {
+            c.set_code_point(code_point_type(cu1));
+            return true;
+        }
+        if (cu1 >= 0xA1 && cu1 <= 0xDF) {
+            c.set_code_point(code_point_type(cu1 - 0xA1 + 0xFF61));
+            return true;
+        }
+        if (cu1 == 0x80 || cu1 == 0xA0 || cu1 >= 0xFD) {
+            throw text_decode_error("Invalid Shift_JIS code unit sequence");
+        }
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu2 = *in_next++;
+        ++decoded_code_units;
+        if (cu2 < 0x40 || cu2 == 0x7F || cu2 > 0xFC) {
+            throw text_decode_error("Invalid Shift_JIS code unit sequence");
+        }
+        int row = (cu1 - (cu1 < 0xA0 ? 0x81 : 0xC1)) * 2;
+        int cell;
+        if (cu2 >= 0x9F) {
+            ++row;
+            cell = cu2 - 0x9F;
+        } else {
+            cell = cu2 - 0x40 - (cu2 > 0x7F);
+        }
+        if (row >= charmap_type::rows) {
+            throw text_decode_error("Unmapped Shift_JIS code unit sequence");
+        }
+        char16_t u = charmap_type::to_unicode[row][cell];
+        if (u == 0xFFFF) {
+            throw text_decode_error("Unmapped Shift_JIS code unit sequence");
+        }
+        c.set_code_point(code_point_type(u));
+        return true;
+    }
+
+    // Bulk decoding of the code unit sequence [first, last) to UTF-8.  'out'
+    // must have room for 3 * (last - first) code units.  Returns the end of
+    // the written sequence.  Throws text_decode_error if an invalid or
+    // unmapped code unit sequence is encountered, or
+    // text_decode_underflow_error if the input ends within a sequence.
+    static char* decode_to_utf8(
+        const code_unit_type *first,
+        const code_unit_type *last,
+        char *out)
+    {
+        const unsigned char *in =
+            reinterpret_cast<const unsigned char *>(first);
+        const unsigned char *in_end =
+            reinterpret_cast<const unsigned char *>(last);
+        state_type state;
+        character_type c;
+        int decoded_code_units;
+        while (in != in_end) {
+            copy_ascii_blocks(in, in_end, out);
+            // Translate at least a block of code units before looking for
+            // another run of ASCII.
+            const unsigned char *block_end =
+                in_end - in > 16 ? in + 16 : in_end;
+            while (in < block_end) {
+                if (*in <= 0x7F) {
+                    *out++ = char(*in++);
+                    continue;
+                }
+                decode(state, in, in_end, c, decoded_code_units);
+                out = put_utf8(c.get_code_point(), out);
+            }
+        }
+        return out;
+    }
+};
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CODECS_SHIFT_JIS_CODEC_HPP
@@ -0,0 +1,286 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_CODECS_SINGLE_BYTE_CODEC_HPP) // {
+#define TEXT_VIEW_CODECS_SINGLE_BYTE_CODEC_HPP
+
+
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/exceptions.hpp>
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/trivial_encoding_state.hpp>
+#include <text_view_detail/codecs/bulk_utf8.hpp>
+#include <climits>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * Single-byte codec
+ * CM is a character map type as generated in single_byte_charmaps.hpp.  Each
+ * code unit maps to at most one BMP code point and each code point maps to at
+ * most one code unit.  Encoding looks up the code point in a two-level page
+ * table; decoding is a single table lookup.
+ */
+template<Character CT, CodeUnit CUT, typename CM>
+class single_byte_codec {
+public:
+    using state_type = trivial_encoding_state;
+    using state_transition_type = trivial_encoding_state_transition;
+    using character_type = CT;
+    using code_unit_type = CUT;
+    using charmap_type = CM;
+    static constexpr int min_code_units = 1;
+    static constexpr int max_code_units = 1;
+
+    static_assert(sizeof(code_unit_type) * CHAR_BIT >= 8);
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode_state_transition(
+        state_type &state,
+        CUIT &out,
+        const state_transition_type &stt,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+    }
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode(
+        state_type &state,
+        CUIT &out,
+        character_type c,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+        code_point_type cp{c.get_code_point()};
+
+        if (cp > 0xFFFF) {
+            throw text_encode_error("Unmappable code point");
+        }
+        unsigned char octet =
+            charmap_type::from_unicode_pages
+                [charmap_type::from_unicode_index[(cp >> 8) & 0xFF]]
+                [cp & 0xFF];
+        if (octet == 0 && cp != 0) {
+            throw text_encode_error("Unmappable code point");
+        }
+        *out++ = unsigned_code_unit_type(octet);
+        ++encoded_code_units;
+    }
+
+    template<CodeUnitIterator CUIT, typename CUST>
+    requires origin::Input_iterator<CUIT>()
+          && origin::Convertible<
+                 origin::Value_type<CUIT>,
+                 std::make_unsigned_t<code_unit_type>>()
+          && origin::Sentinel<CUST, CUIT>()
+    static bool decode(
+        state_type &state,
+        CUIT &in_next,
+        CUST in_end,
+        character_type &c,
+        int &decoded_code_units)
+    {
+        decoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu = *in_next++;
+        ++decoded_code_units;
+        char16_t u = charmap_type::to_unicode[cu & 0xFF];
+        if (u == 0xFFFF) {
+            throw text_decode_error("Unmapped code unit");
+        }
+        c.set_code_point(code_point_type(u));
+        return true;
+    }
+
+    template<CodeUnitIterator CUIT, typename CUST>
+    requires origin::Input_iterator<CUIT>()
+          && origin::Convertible<
+                 origin::Value_type<CUIT>,
+                 std::make_unsigned_t<code_unit_type>>()
+          && origin::Sentinel<CUST, CUIT>()
+    static bool rdecode(
+        state_type &state,
+        CUIT &in_next,
+        CUST in_end,
+        character_type &c,
+        int &decoded_code_units)
+    {
+        return decode(state, in_next, in_end, c, decoded_code_units);
+    }
+
+    // Bulk decoding of the code unit sequence [first, last) to UTF-32.  'out'
+    // must have room for (last - first) code points.  Returns the end of the
+    // written sequence.  Throws text_decode_error if an unmapped code unit is
+    // encountered.
+    static char32_t* decode_to_utf32(
+        const code_unit_type *first,
+        const code_unit_type *last,
+        char32_t *out)
+    {
+        const unsigned char *in =
+            reinterpret_cast<const unsigned char *>(first);
+        const unsigned char *in_end =
+            reinterpret_cast<const unsigned char *>(last);
+        while (in != in_end) {
+#if defined(__AVX2__)
+            // Gather 8 table entries at a time.  The table holds 16-bit
+            // entries and is padded by one element so that 32-bit loads of any
+            // entry stay within bounds; the high half of each loaded value is
+            // masked off.  Blocks containing an unmapped code unit are left to
+            // the scalar code below to diagnose.
+            const __m256i low16 = _mm256_set1_epi32(0xFFFF);
+            while (in_end - in >= 8) {
+                __m128i octets = _mm_loadl_epi64(
+                    reinterpret_cast<const __m128i *>(in));
+                __m256i indexes = _mm256_cvtepu8_epi32(octets);
+                __m256i cps = _mm256_and_si256(
+                    _mm256_i32gather_epi32(
+                        reinterpret_cast<const int *>(
+                            charmap_type::to_unicode),
+                        indexes,
+                        2),
+                    low16);
+                if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(cps, low16))) {
+                    break;
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), cps);
+                in += 8;
+                out += 8;
+            }
+#elif defined(__SSE2__)
+            // Widen runs of 16 ASCII code units directly.  All supported
+            // character maps are ASCII supersets.
+            const __m128i zero = _mm_setzero_si128();
+            while (in_end - in >= 16) {
+                __m128i octets = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i *>(in));
+                if (_mm_movemask_epi8(octets)) {
+                    break;
+                }
+                __m128i lo = _mm_unpacklo_epi8(octets, zero);
+                __m128i hi = _mm_unpackhi_epi8(octets, zero);
+                __m128i *o = reinterpret_cast<__m128i *>(out);
+                _mm_storeu_si128(o + 0, _mm_unpacklo_epi16(lo, zero));
+                _mm_storeu_si128(o + 1, _mm_unpackhi_epi16(lo, zero));
+                _mm_storeu_si128(o + 2, _mm_unpacklo_epi16(hi, zero));
+                _mm_storeu_si128(o + 3, _mm_unpackhi_epi16(hi, zero));
+                in += 16;
+                out += 16;
+            }
+#endif
+            // Translate up to a block of code units that the vectorized loop
+            // above declined before trying it again.
+            const unsigned char *block_end =
+                in_end - in > 16 ? in + 16 : in_end;
+            while (in != block_end) {
+                char16_t u = charmap_type::to_unicode[*in++];
+                if (u == 0xFFFF) {
+                    throw text_decode_error("Unmapped code unit");
+                }
+                *out++ = u;
+            }
+        }
+        return out;
+    }
+
+private:
+    // The UTF-8 encoding of each code unit; the first three elements hold the
+    // UTF-8 code units padded with zeros and the last holds their number, or
+    // 0 for an unmapped code unit.  This permits a branch free translation of
+    // runs that mix ASCII and non-ASCII code units.
+    struct utf8_table_type {
+        unsigned char entries[256][4];
+
+        constexpr utf8_table_type() : entries{} {
+            for (int i = 0; i < 256; ++i) {
+                char16_t u = charmap_type::to_unicode[i];
+                unsigned char *e = entries[i];
+                if (u <= 0x7F) {
+                    e[0] = u;
+                    e[3] = 1;
+                } else if (u <= 0x7FF) {
+                    e[0] = 0xC0 + (u >> 6);
+                    e[1] = 0x80 + (u & 0x3F);
+                    e[3] = 2;
+                } else if (u != 0xFFFF) {
+                    e[0] = 0xE0 + (u >> 12);
+                    e[1] = 0x80 + ((u >> 6) & 0x3F);
+                    e[2] = 0x80 + (u & 0x3F);
+                    e[3] = 3;
+                }
+            }
+        }
+    };
+    static constexpr utf8_table_type utf8_table{};
+
+public:
+    // Bulk decoding of the code unit sequence [first, last) to UTF-8.  'out'
+    // must have room for 3 * (last - first) code units.  Returns the end of
+    // the written sequence.  Throws text_decode_error if an unmapped code unit
+    // is encountered.
+    static char* decode_to_utf8(
+        const code_unit_type *first,
+        const code_unit_type *last,
+        char *out)
+    {
+        const unsigned char *in =
+            reinterpret_cast<const unsigned char *>(first);
+        const unsigned char *in_end =
+            reinterpret_cast<const unsigned char *>(last);
+        while (in != in_end) {
+            // All supported character maps are ASCII supersets.
+            copy_ascii_blocks(in, in_end, out);
+            // Translate up to a block of code units before looking for
+            // another run of ASCII.
+            const unsigned char *block_end =
+                in_end - in > 16 ? in + 16 : in_end;
+            while (in != block_end) {
+                const unsigned char *utf8 = utf8_table.entries[*in++];
+                if (utf8[3] == 0) {
+                    throw text_decode_error("Unmapped code unit");
+                }
+                out[0] = char(utf8[0]);
+                out[1] = char(utf8[1]);
+                out[2] = char(utf8[2]);
+                out += utf8[3];
+            }
+        }
+        return out;
+    }
+};
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CODECS_SINGLE_BYTE_CODEC_HPP
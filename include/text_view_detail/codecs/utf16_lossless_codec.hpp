@@ -0,0 +1,158 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_CODECS_UTF16_LOSSLESS_CODEC_HPP) // {
+#define TEXT_VIEW_CODECS_UTF16_LOSSLESS_CODEC_HPP
+
+
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/exceptions.hpp>
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/trivial_encoding_state.hpp>
+#include <climits>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * Lossless UTF-16 codec
+ * Surrogate pairs decode to supplementary code points as in UTF-16, but an
+ * unpaired surrogate code unit decodes to the surrogate code point rather
+ * than being rejected, and surrogate code points encode to a single code
+ * unit.  Any sequence of code units therefore decodes, and re-encoding the
+ * decoded characters reproduces it exactly.  Determining whether a surrogate
+ * code unit is paired requires looking at the next code unit without
+ * consuming it, so decoding requires forward iterators.
+ */
+template<Character CT, CodeUnit CUT>
+class utf16_lossless_codec {
+public:
+    using state_type = trivial_encoding_state;
+    using state_transition_type = trivial_encoding_state_transition;
+    using character_type = CT;
+    using code_unit_type = CUT;
+    static constexpr int min_code_units = 1;
+    static constexpr int max_code_units = 2;
+
+    static_assert(sizeof(code_unit_type) * CHAR_BIT >= 16);
+
+    template<CodeUnitOutputIterator<code_unit_type> CUIT>
+    static void encode_state_transition(
+        state_type &state,
+        CUIT &out,
+        const state_transition_type &stt,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+    }
+
+    template<CodeUnitOutputIterator<code_unit_type> CUIT>
+    static void encode(
+        state_type &state,
+        CUIT &out,
+        character_type c,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+        code_point_type cp{c.get_code_point()};
+
+        if (cp <= 0xFFFF) {
+            *out++ = code_unit_type(cp);
+            ++encoded_code_units;
+        } else if (cp <= 0x10FFFF) {
+            *out++ = code_unit_type(0xD800 + (((cp - 0x10000) >> 10) & 0x03FF));
+            ++encoded_code_units;
+            *out++ = code_unit_type(0xDC00 + ((cp - 0x10000) & 0x03FF));
+            ++encoded_code_units;
+        } else {
+            throw text_encode_error("Invalid Unicode code point");
+        }
+    }
+
+    template<CodeUnitIterator CUIT, typename CUST>
+    requires origin::Forward_iterator<CUIT>()
+          && origin::Convertible<origin::Value_type<CUIT>, code_unit_type>()
+          && origin::Sentinel<CUST, CUIT>()
+    static bool decode(
+        state_type &state,
+        CUIT &in_next,
+        CUST in_end,
+        character_type &c,
+        int &decoded_code_units)
+    {
+        decoded_code_units = 0;
+
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        code_unit_type cu1 = *in_next++;
+        ++decoded_code_units;
+        if (cu1 >= 0xD800 && cu1 <= 0xDBFF && in_next != in_end) {
+            code_unit_type cu2 = *in_next;
+            if (cu2 >= 0xDC00 && cu2 <= 0xDFFF) {
+                ++in_next;
+                ++decoded_code_units;
+                c.set_code_point(code_point_type(
+                    0x10000 + (((cu1 & 0x3FF) << 10) | (cu2 & 0x3FF))));
+                return true;
+            }
+        }
+        c.set_code_point(code_point_type(cu1));
+        return true;
+    }
+
+    template<CodeUnitIterator CUIT, typename CUST>
+    requires origin::Forward_iterator<CUIT>()
+          && origin::Convertible<origin::Value_type<CUIT>, code_unit_type>()
+          && origin::Sentinel<CUST, CUIT>()
+    static bool rdecode(
+        state_type &state,
+        CUIT &in_next,
+        CUST in_end,
+        character_type &c,
+        int &decoded_code_units)
+    {
+        decoded_code_units = 0;
+
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        code_unit_type rcu1 = *in_next++;
+        ++decoded_code_units;
+        if (rcu1 >= 0xDC00 && rcu1 <= 0xDFFF && in_next != in_end) {
+            code_unit_type rcu2 = *in_next;
+            if (rcu2 >= 0xD800 && rcu2 <= 0xDBFF) {
+                ++in_next;
+                ++decoded_code_units;
+                c.set_code_point(code_point_type(
+                    0x10000 + (((rcu2 & 0x3FF) << 10) | (rcu1 & 0x3FF))));
+                return true;
+            }
+        }
+        c.set_code_point(code_point_type(rcu1));
+        return true;
+    }
+};
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CODECS_UTF16_LOSSLESS_CODEC_HPP
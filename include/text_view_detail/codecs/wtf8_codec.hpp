@@ -0,0 +1,310 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_CODECS_WTF8_CODEC_HPP) // {
+#define TEXT_VIEW_CODECS_WTF8_CODEC_HPP
+
+
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/exceptions.hpp>
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/trivial_encoding_state.hpp>
+#include <text_view_detail/codecs/bulk_utf8.hpp>
+#include <climits>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * WTF-8 codec
+ * WTF-8 is UTF-8 extended to encode surrogate code points, so that UTF-16 text
+ * containing unpaired surrogates, such as Windows file names, can be carried
+ * losslessly.  Each surrogate code point is encoded in three code units.
+ * Encoding a high surrogate followed by a low surrogate produces the
+ * generalized UTF-8 sequence for the pair rather than the four code unit
+ * sequence for the supplementary code point; the lossless UTF-16 decoder
+ * never produces such a pair, and this decoder decodes it as two surrogate
+ * code points.  Overlong sequences and code points above U+10FFFF are
+ * rejected.
+ */
+template<Character CT, CodeUnit CUT>
+class wtf8_codec {
+public:
+    using state_type = trivial_encoding_state;
+    using state_transition_type = trivial_encoding_state_transition;
+    using character_type = CT;
+    using code_unit_type = CUT;
+    static constexpr int min_code_units = 1;
+    static constexpr int max_code_units = 4;
+
+    static_assert(sizeof(code_unit_type) * CHAR_BIT >= 8);
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode_state_transition(
+        state_type &state,
+        CUIT &out,
+        const state_transition_type &stt,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+    }
+
+    template<CodeUnitOutputIterator<std::make_unsigned_t<code_unit_type>> CUIT>
+    static void encode(
+        state_type &state,
+        CUIT &out,
+        character_type c,
+        int &encoded_code_units)
+    {
+        encoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+        code_point_type cp{c.get_code_point()};
+
+        if (cp <= 0x7F) {
+            *out++ = unsigned_code_unit_type(cp);
+            ++encoded_code_units;
+        } else if (cp <= 0x7FF) {
+            *out++ = unsigned_code_unit_type(0xC0 + ((cp >> 6) & 0x1F));
+            ++encoded_code_units;
+            *out++ = unsigned_code_unit_type(0x80 + (cp & 0x3F));
+            ++encoded_code_units;
+        } else if (cp <= 0xFFFF) {
+            *out++ = unsigned_code_unit_type(0xE0 + ((cp >> 12) & 0x0F));
+            ++encoded_code_units;
+            *out++ = unsigned_code_unit_type(0x80 + ((cp >> 6) & 0x3F));
+            ++encoded_code_units;
+            *out++ = unsigned_code_unit_type(0x80 + (cp & 0x3F));
+            ++encoded_code_units;
+        } else if (cp <= 0x10FFFF) {
+            *out++ = unsigned_code_unit_type(0xF0 + ((cp >> 18) & 0x07));
+            ++encoded_code_units;
+            *out++ = unsigned_code_unit_type(0x80 + ((cp >> 12) & 0x3F));
+            ++encoded_code_units;
+            *out++ = unsigned_code_unit_type(0x80 + ((cp >> 6) & 0x3F));
+            ++encoded_code_units;
+            *out++ = unsigned_code_unit_type(0x80 + (cp & 0x3F));
+            ++encoded_code_units;
+        } else {
+            throw text_encode_error("Invalid Unicode code point");
+        }
+    }
+
+    template<CodeUnitIterator CUIT, typename CUST>
+    requires origin::Input_iterator<CUIT>()
+          && origin::Convertible<
+                 origin::Value_type<CUIT>,
+                 std::make_unsigned_t<code_unit_type>>()
+          && origin::Sentinel<CUST, CUIT>()
+    static bool decode(
+        state_type &state,
+        CUIT &in_next,
+        CUST in_end,
+        character_type &c,
+        int &decoded_code_units)
+    {
+        decoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type cu1 = *in_next++;
+        ++decoded_code_units;
+        if (cu1 <= 0x7F) {
+            c.set_code_point(code_point_type(cu1));
+            return true;
+        }
+
+        int length;
+        char32_t cp;
+        if (cu1 >= 0xC2 && cu1 <= 0xDF) {
+            length = 2;
+            cp = cu1 & 0x1F;
+        } else if (cu1 >= 0xE0 && cu1 <= 0xEF) {
+            length = 3;
+            cp = cu1 & 0x0F;
+        } else if (cu1 >= 0xF0 && cu1 <= 0xF4) {
+            length = 4;
+            cp = cu1 & 0x07;
+        } else {
+            throw text_decode_error("Invalid WTF-8 code unit sequence");
+        }
+        for (int i = 1; i < length; ++i) {
+            if (in_next == in_end)
+                throw text_decode_underflow_error("text decode underflow error");
+            unsigned_code_unit_type cu = *in_next++;
+            ++decoded_code_units;
+            if ((cu & 0xC0) != 0x80) {
+                throw text_decode_error("Invalid WTF-8 code unit sequence");
+            }
+            cp = (cp << 6) + (cu & 0x3F);
+        }
+        if (! is_valid(length, cp)) {
+            throw text_decode_error("Invalid WTF-8 code unit sequence");
+        }
+        c.set_code_point(code_point_type(cp));
+        return true;
+    }
+
+    template<CodeUnitIterator CUIT, typename CUST>
+    requires origin::Input_iterator<CUIT>()
+          && origin::Convertible<
+                 origin::Value_type<CUIT>,
+                 std::make_unsigned_t<code_unit_type>>()
+          && origin::Sentinel<CUST, CUIT>()
+    static bool rdecode(
+        state_type &state,
+        CUIT &in_next,
+        CUST in_end,
+        character_type &c,
+        int &decoded_code_units)
+    {
+        decoded_code_units = 0;
+
+        using unsigned_code_unit_type =
+            std::make_unsigned_t<code_unit_type>;
+        using code_point_type =
+            code_point_type_t<character_set_type_t<character_type>>;
+
+        if (in_next == in_end)
+            throw text_decode_underflow_error("text decode underflow error");
+        unsigned_code_unit_type rcu = *in_next++;
+        ++decoded_code_units;
+        if (rcu <= 0x7F) {
+            c.set_code_point(code_point_type(rcu));
+            return true;
+        }
+
+        char32_t cp = 0;
+        int shift = 0;
+        while ((rcu & 0xC0) == 0x80) {
+            if (decoded_code_units == max_code_units) {
+                throw text_decode_error("Invalid WTF-8 code unit sequence");
+            }
+            cp += char32_t(rcu & 0x3F) << shift;
+            shift += 6;
+            if (in_next == in_end)
+                throw text_decode_underflow_error("text decode underflow error");
+            rcu = *in_next++;
+            ++decoded_code_units;
+        }
+        int length = decoded_code_units;
+        unsigned_code_unit_type lead_mask =
+            length == 2 ? 0xE0 : length == 3 ? 0xF0 : 0xF8;
+        if (length < 2 ||
+            (rcu & lead_mask) != ((lead_mask << 1) & 0xFF))
+        {
+            throw text_decode_error("Invalid WTF-8 code unit sequence");
+        }
+        cp += char32_t(rcu & ~lead_mask & 0xFF) << shift;
+        if (! is_valid(length, cp)) {
+            throw text_decode_error("Invalid WTF-8 code unit sequence");
+        }
+        c.set_code_point(code_point_type(cp));
+        return true;
+    }
+
+    // Bulk transcoding of the code unit sequence [first, last) to UTF-16,
+    // with surrogate code points written as single (unpaired) UTF-16 code
+    // units.  'out' must have room for (last - first) code units.  Returns
+    // the end of the written sequence.  Throws text_decode_error if an
+    // invalid code unit sequence is encountered, or
+    // text_decode_underflow_error if the input ends within a sequence.
+    static char16_t* decode_to_utf16(
+        const code_unit_type *first,
+        const code_unit_type *last,
+        char16_t *out)
+    {
+        const unsigned char *in =
+            reinterpret_cast<const unsigned char *>(first);
+        const unsigned char *in_end =
+            reinterpret_cast<const unsigned char *>(last);
+        state_type state;
+        character_type c;
+        int decoded_code_units;
+        while (in != in_end) {
+            widen_ascii_blocks(in, in_end, out);
+            const unsigned char *block_end =
+                in_end - in > 16 ? in + 16 : in_end;
+            while (in < block_end) {
+                if (*in <= 0x7F) {
+                    *out++ = char16_t(*in++);
+                    continue;
+                }
+                decode(state, in, in_end, c, decoded_code_units);
+                char32_t cp = c.get_code_point();
+                if (cp <= 0xFFFF) {
+                    *out++ = char16_t(cp);
+                } else {
+                    *out++ = char16_t(0xD7C0 + (cp >> 10));
+                    *out++ = char16_t(0xDC00 + (cp & 0x3FF));
+                }
+            }
+        }
+        return out;
+    }
+
+    // Bulk transcoding of the UTF-16 code unit sequence [first, last) to
+    // WTF-8.  Surrogate pairs are encoded as supplementary code points and
+    // unpaired surrogates are encoded as surrogate code points, so any
+    // sequence of UTF-16 code units is accepted.  'out' must have room for
+    // 3 * (last - first) code units.  Returns the end of the written
+    // sequence.
+    static code_unit_type* encode_from_utf16(
+        const char16_t *first,
+        const char16_t *last,
+        code_unit_type *out_first)
+    {
+        char *out = reinterpret_cast<char *>(out_first);
+        while (first != last) {
+            narrow_ascii_blocks(first, last, out);
+            const char16_t *block_end =
+                last - first > 8 ? first + 8 : last;
+            while (first < block_end) {
+                char32_t cu1 = *first++;
+                if (cu1 >= 0xD800 && cu1 <= 0xDBFF && first != last &&
+                    *first >= 0xDC00 && *first <= 0xDFFF)
+                {
+                    char32_t cu2 = *first++;
+                    cu1 = 0x10000 + ((cu1 - 0xD800) << 10) + (cu2 - 0xDC00);
+                }
+                out = put_utf8(cu1, out);
+            }
+        }
+        return reinterpret_cast<code_unit_type *>(out);
+    }
+
+private:
+    // Returns true if 'cp', decoded from a sequence of 'length' code units,
+    // is not overlong and does not exceed U+10FFFF.
+    static bool is_valid(int length, char32_t cp) {
+        switch (length) {
+            case 2:  return cp >= 0x80;
+            case 3:  return cp >= 0x800;
+            default: return cp >= 0x10000 && cp <= 0x10FFFF;
+        }
+    }
+};
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CODECS_WTF8_CODEC_HPP
@@ -0,0 +1,334 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_COLLATION_HPP) // {
+#define TEXT_VIEW_COLLATION_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/boundary_view.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/normalization_view.hpp>
+#include <text_view_detail/unicode/unicode_trie.hpp>
+#include <text_view_detail/unicode/collation_tables.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+namespace text_detail {
+
+static_assert(std::numeric_limits<unsigned>::digits >= 32,
+              "collation elements require 32 bit unsigned integers");
+
+constexpr unsigned primary_weight(unsigned element) noexcept {
+    return element >> 16;
+}
+
+constexpr unsigned secondary_weight(unsigned element) noexcept {
+    return (element >> 7) & 0x1FF;
+}
+
+constexpr unsigned tertiary_weight(unsigned element) noexcept {
+    return (element >> 2) & 0x1F;
+}
+
+constexpr unsigned make_collation_element(
+    unsigned primary,
+    unsigned secondary,
+    unsigned tertiary) noexcept
+{
+    return primary << 16 | secondary << 7 | tertiary << 2
+         | collation_table::single;
+}
+
+// Appends the NFD normalization of the text view 'tv' to 's'.  Each
+// character is decomposed as it is decoded, and the Canonical Ordering
+// Algorithm is applied only if a non-starter follows one with a greater
+// combining class.
+template<TextView TVT>
+void append_nfd(const TVT &tv, std::u32string &s) {
+    bool ordered = true;
+    unsigned char last_ccc = 0;
+    for (auto c : tv) {
+        char32_t cp = c.get_code_point();
+        unsigned short properties = normalization_properties(cp);
+        std::size_t first = s.size();
+        if (quick_check_flags(normalization_form::nfd, properties)) {
+            decompose(cp, properties, false, s);
+            properties = normalization_properties(s[first]);
+        } else {
+            s += cp;
+        }
+        unsigned char ccc = canonical_combining_class(properties);
+        if (ccc != 0 && last_ccc > ccc) {
+            ordered = false;
+        }
+        if (first + 1 != s.size()) {
+            ccc = canonical_combining_class(
+                normalization_properties(s.back()));
+        }
+        last_ccc = ccc;
+    }
+    if (! ordered) {
+        canonical_order(s);
+    }
+}
+
+// Appends the two collation elements with implicit weights for 'cp' (UTS #10
+// section 10.1) to 'elements'.
+inline void append_implicit_collation_elements(
+    char32_t cp,
+    std::vector<unsigned> &elements)
+{
+    char32_t origin = 0;
+    unsigned base = collation_table::unassigned_base;
+    for (const auto &range : collation_table::implicit_ranges) {
+        if (cp < range.first) {
+            break;
+        }
+        if (cp <= range.last) {
+            origin = range.origin;
+            base = range.base;
+            break;
+        }
+    }
+    char32_t offset = cp - origin;
+    elements.push_back(
+        make_collation_element(base + (offset >> 15), 0x20, 0x02));
+    elements.push_back(
+        make_collation_element((offset & 0x7FFF) | 0x8000, 0, 0));
+}
+
+// Returns the node that follows 'node' in the contraction trie for the code
+// point 'cp', or nullptr if there is none.
+inline const collation_table::contraction *
+next_contraction(const collation_table::contraction *node, char32_t cp) {
+    const collation_table::contraction *first =
+        &collation_table::contractions[node->children];
+    const collation_table::contraction *last = first + node->child_count;
+    first = std::lower_bound(
+        first, last, cp,
+        [](const collation_table::contraction &c, char32_t cp) {
+            return c.code_point < cp;
+        });
+    return first != last && first->code_point == cp ? first : nullptr;
+}
+
+// Appends the collation elements of the longest contraction that begins with
+// the code point that precedes index 'i' of 's' to 'elements' and returns the
+// index of the code point that follows it.  'node' is the node of the
+// contraction trie for that code point.  The longest contiguous match is
+// found first (UTS #10 S2.1), and is then extended by each unblocked
+// non-starter that follows it and forms a longer match (S2.1.1 through
+// S2.1.3); such non-starters are removed from 's'.
+inline std::size_t append_contraction_elements(
+    std::u32string &s,
+    std::size_t i,
+    const collation_table::contraction *node,
+    std::vector<unsigned> &elements)
+{
+    const collation_table::contraction *match = node;
+    std::size_t next = i;
+    for (std::size_t j = i; node->child_count && j < s.size(); ) {
+        node = next_contraction(node, s[j++]);
+        if (! node) {
+            break;
+        }
+        if (node->element_count) {
+            match = node;
+            next = j;
+        }
+    }
+
+    unsigned char skipped_ccc = 0;
+    for (std::size_t k = next; match->child_count && k < s.size(); ) {
+        unsigned char ccc =
+            canonical_combining_class(normalization_properties(s[k]));
+        if (ccc == 0) {
+            break;
+        }
+        if (skipped_ccc < ccc) {
+            node = next_contraction(match, s[k]);
+            if (node && node->element_count) {
+                match = node;
+                s.erase(k, 1);
+                continue;
+            }
+        }
+        skipped_ccc = ccc;
+        ++k;
+    }
+
+    if (match->element_count == 0) {
+        append_implicit_collation_elements(s[i - 1], elements);
+    } else {
+        const unsigned *first = &collation_table::elements[match->elements];
+        elements.insert(elements.end(), first, first + match->element_count);
+    }
+    return next;
+}
+
+// Appends the collation elements of the NFD normalized code points of 's' to
+// 'elements'.  's' may be modified.
+inline void append_collation_elements(
+    std::u32string &s,
+    std::vector<unsigned> &elements)
+{
+    for (std::size_t i = 0; i < s.size(); ) {
+        char32_t cp = s[i++];
+        unsigned value = trie3_lookup<collation_table>(cp);
+        switch (value & 3) {
+        case 0:
+            append_implicit_collation_elements(cp, elements);
+            break;
+        case collation_table::single:
+            elements.push_back(value);
+            break;
+        case collation_table::expansion: {
+            const unsigned *first = &collation_table::elements[value >> 10];
+            elements.insert(
+                elements.end(), first, first + ((value >> 2) & 0xFF));
+            break;
+        }
+        case collation_table::contraction_tag:
+            i = append_contraction_elements(
+                s, i, &collation_table::contractions[value >> 2], elements);
+            break;
+        }
+    }
+}
+
+// Writes the sort key for the collation elements 'element(*it)' of each
+// iterator 'it' in ['first', 'last') to 'out' and returns 'out'.  Non-zero
+// primary weights are written as two bytes, most significant first, followed
+// by a zero byte, then non-zero secondary weights less 0x1F as one byte each,
+// followed by a zero byte, then non-zero tertiary weights as one byte each.
+// Every primary weight has a non-zero first byte and every secondary and
+// tertiary weight byte is non-zero, so sort keys compare as the collation
+// elements do.
+template<typename IT, typename F, typename OIT>
+OIT write_sort_key(IT first, IT last, F element, OIT out) {
+    for (IT it = first; it != last; ++it) {
+        unsigned weight = primary_weight(element(*it));
+        if (weight) {
+            *out++ = static_cast<unsigned char>(weight >> 8);
+            *out++ = static_cast<unsigned char>(weight);
+        }
+    }
+    *out++ = static_cast<unsigned char>(0);
+    for (IT it = first; it != last; ++it) {
+        unsigned weight = secondary_weight(element(*it));
+        if (weight) {
+            *out++ = static_cast<unsigned char>(weight - 0x1F);
+        }
+    }
+    *out++ = static_cast<unsigned char>(0);
+    for (IT it = first; it != last; ++it) {
+        unsigned weight = tertiary_weight(element(*it));
+        if (weight) {
+            *out++ = static_cast<unsigned char>(weight);
+        }
+    }
+    return out;
+}
+
+// In general, sort keys are computed from the collation elements of the NFD
+// normalization of the text.  See below for text in ASCII transparent
+// encodings.
+template<TextView TVT, typename OIT>
+bool write_ascii_sort_key(const TVT &, OIT &) {
+    return false;
+}
+
+// For text in ASCII transparent encodings that consists entirely of ASCII
+// characters, the sort key is computed directly from the code units.  ASCII
+// text is in NFD, each ASCII character has a single collation element, and
+// no contraction consists only of ASCII characters.  Returns false, without
+// writing to 'out', if the text contains a non-ASCII character.
+template<TextView TVT, typename OIT>
+requires is_ascii_transparent_encoding<encoding_type_t<TVT>>
+bool write_ascii_sort_key(const TVT &tv, OIT &out) {
+    auto cu_first = text_detail::adl_begin(tv.base());
+    auto cu_last = text_detail::adl_end(tv.base());
+    if (std::any_of(cu_first, cu_last, [](auto cu) {
+            return static_cast<unsigned char>(cu) >= 0x80;
+        }))
+    {
+        return false;
+    }
+    out = write_sort_key(cu_first, cu_last, [](auto cu) {
+            return collation_table::ascii[static_cast<unsigned char>(cu)];
+        }, out);
+    return true;
+}
+
+} // namespace text_detail
+
+
+/*
+ * Collation
+ * Sort keys for the Unicode Collation Algorithm (UTS #10) with the Default
+ * Unicode Collation Element Table (DUCET), three levels, and non-ignorable
+ * variable weighting.  Sort keys compare with memcmp() or as std::string
+ * objects in the order that the UCA collates the text they were computed
+ * from, so text may be sorted by comparing, or radix sorting, sort keys
+ * rather than by decoding and collating the text for each comparison.
+ */
+// Writes the sort key of the text view 'tv' as a sequence of unsigned char
+// values to 'out' and returns 'out'.  The text is converted to NFD, so
+// canonically equivalent text has the same sort key.  Sort keys of text in
+// ASCII transparent encodings that consists entirely of ASCII characters are
+// computed from the code units without decoding or allocation; otherwise,
+// the normalized text and its collation elements are held in temporary
+// storage.
+template<TextView TVT, typename OIT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+      && origin::Output_iterator<OIT, unsigned char>()
+OIT make_sort_key(
+    const TVT &tv,
+    OIT out)
+{
+    if (text_detail::write_ascii_sort_key(tv, out)) {
+        return out;
+    }
+    std::u32string s;
+    text_detail::append_nfd(tv, s);
+    std::vector<unsigned> elements;
+    text_detail::append_collation_elements(s, elements);
+    return text_detail::write_sort_key(
+        elements.begin(), elements.end(),
+        [](unsigned element) { return element; }, out);
+}
+
+// Returns the sort key of the text view 'tv' as a string of bytes.  Sort keys
+// of text compare as the text collates when compared as std::string objects.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+std::string make_sort_key(
+    const TVT &tv)
+{
+    std::string key;
+    make_sort_key(tv, std::back_inserter(key));
+    return key;
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_COLLATION_HPP
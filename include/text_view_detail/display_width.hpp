@@ -0,0 +1,169 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_DISPLAY_WIDTH_HPP) // {
+#define TEXT_VIEW_DISPLAY_WIDTH_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/boundary_view.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/grapheme_view.hpp>
+#include <text_view_detail/text_iterator.hpp>
+#include <text_view_detail/unicode_properties.hpp>
+#include <cstddef>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+namespace text_detail {
+
+// Returns the number of columns occupied by the code point 'cp' when it
+// begins a grapheme cluster.  Control characters, nonspacing and enclosing
+// marks, format characters, line and paragraph separators, and default
+// ignorable code points occupy no columns; wide and fullwidth characters
+// (East_Asian_Width W or F) occupy two columns, and all other characters,
+// including those of ambiguous width, occupy one.
+constexpr int code_point_width(char32_t cp) noexcept {
+    if (cp < 0x80) {
+        return cp >= 0x20 && cp < 0x7F;
+    }
+    unicode_properties p = get_unicode_properties(cp);
+    switch (p.get_general_category()) {
+    case general_category::cc:
+    case general_category::cf:
+    case general_category::mn:
+    case general_category::me:
+    case general_category::zl:
+    case general_category::zp:
+        return 0;
+    default:
+        break;
+    }
+    if (p.is_default_ignorable()) {
+        return 0;
+    }
+    east_asian_width ea = p.get_east_asian_width();
+    return ea == east_asian_width::w || ea == east_asian_width::f ? 2 : 1;
+}
+
+// Advances 'first' past the grapheme cluster that it begins and returns the
+// number of columns the cluster occupies.  A cluster occupies the columns of
+// its first character, except that it occupies two columns if it contains
+// the emoji presentation selector U+FE0F or a pair of regional indicators
+// (a flag).
+template<typename TIT, typename TST>
+int next_grapheme_width(TIT &first, TST last) {
+    using property = grapheme_break_table::property;
+    char32_t cp = (*first).get_code_point();
+    property p = grapheme_break_property(cp);
+    grapheme_break_context context{p};
+    int width = code_point_width(cp);
+    bool regional = p == property::regional_indicator;
+    for (++first; first != last; ++first) {
+        cp = (*first).get_code_point();
+        p = grapheme_break_property(cp);
+        if (context.is_boundary_before(p)) {
+            break;
+        }
+        if (cp == U'\uFE0F'
+            || (regional && p == property::regional_indicator))
+        {
+            width = 2;
+        }
+    }
+    return width;
+}
+
+// In general, the width of each grapheme cluster is computed by decoding its
+// characters.  See below for text in ASCII transparent encodings.
+template<typename TIT, typename TST, typename RT>
+bool ascii_display_width(TIT &, TST, const RT *, std::size_t &) {
+    return false;
+}
+
+// For text in ASCII transparent encodings, runs of ASCII characters are
+// measured by examining code units directly; printable characters occupy one
+// column and control characters none.  Every ASCII character other than CR
+// forms a grapheme cluster by itself when followed by another ASCII character
+// (GB999), and CR LF occupies no columns either way.  The last character of a
+// run that is followed by a non-ASCII character might begin a cluster with
+// the characters that follow (GB9, GB9a); in that case, 'first' is updated to
+// that character, the width of the preceding characters is added to 'width',
+// and false is returned.  Otherwise, 'first' is updated to the end of the
+// run, its width is added to 'width', and true is returned.
+template<typename TIT, typename TST, typename RT>
+requires is_ascii_transparent_encoding<encoding_type_t<TIT>>
+bool ascii_display_width(
+    TIT &first,
+    TST,
+    const RT *range,
+    std::size_t &width)
+{
+    auto cu_first = first.base();
+    auto cu_last = text_detail::adl_end(*range);
+    if (static_cast<unsigned char>(*cu_first) >= 0x80) {
+        return false;
+    }
+    unsigned char back = *cu_first;
+    auto run_back = cu_first;
+    auto run_last = cu_first;
+    for (++run_last; run_last != cu_last; run_back = run_last++) {
+        unsigned char cu = *run_last;
+        if (cu >= 0x80) {
+            first = TIT{first.state(), range, run_back};
+            return false;
+        }
+        width += code_point_width(back);
+        back = cu;
+    }
+    width += code_point_width(back);
+    first = TIT{first.state(), range, run_last};
+    return true;
+}
+
+} // namespace text_detail
+
+
+/*
+ * display_width
+ */
+// Returns the number of columns that the text view 'tv' occupies when written
+// to a terminal that displays East Asian wide and fullwidth characters and
+// emoji in two columns.  The text is segmented into extended grapheme
+// clusters (UAX #29), each of which occupies the columns of its first
+// character as determined by its general category and East_Asian_Width
+// property (UAX #11).  Characters of ambiguous width are assumed to be
+// narrow, and control characters, including tab and newline, occupy no
+// columns.  No memory is allocated.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+std::size_t display_width(
+    const TVT &tv)
+{
+    auto first = text_detail::adl_begin(tv);
+    auto last = text_detail::adl_end(tv);
+    std::size_t width = 0;
+    while (first != last) {
+        if (text_detail::ascii_display_width(first, last, &tv.base(), width)) {
+            continue;
+        }
+        width += text_detail::next_grapheme_width(first, last);
+    }
+    return width;
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_DISPLAY_WIDTH_HPP
@@ -0,0 +1,448 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_EDIT_DISTANCE_HPP) // {
+#define TEXT_VIEW_EDIT_DISTANCE_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/boundary_view.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/text_view.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+namespace text_detail {
+
+// In general, 'f' is called with each code point of the text view 'tv' as
+// it is decoded, and with a function that returns an iterator to the
+// character that follows it.  Decoding stops if 'f' returns false.
+template<TextView TVT, typename F>
+void scan_code_points(const TVT &tv, F f) {
+    auto last = text_detail::adl_end(tv);
+    for (auto it = text_detail::adl_begin(tv); it != last; ) {
+        char32_t cp = (*it).get_code_point();
+        ++it;
+        if (! f(cp, [&it] { return it; })) {
+            return;
+        }
+    }
+}
+
+// Text in ASCII transparent encodings is scanned a code unit at a time; only
+// characters that are not ASCII are decoded.
+template<TextView TVT, typename F>
+requires is_ascii_transparent_encoding<encoding_type_t<TVT>>
+void scan_code_points(const TVT &tv, F f) {
+    auto first = text_detail::adl_begin(tv);
+    using TIT = decltype(first);
+    auto cu = text_detail::adl_begin(tv.base());
+    auto cu_last = text_detail::adl_end(tv.base());
+    while (cu != cu_last) {
+        char32_t cp = static_cast<unsigned char>(*cu);
+        if (cp < 0x80) {
+            ++cu;
+        } else {
+            TIT it{first.state(), &tv.base(), cu};
+            cp = (*it).get_code_point();
+            ++it;
+            cu = it.base();
+        }
+        if (! f(cp, [&] { return TIT{first.state(), &tv.base(), cu}; })) {
+            return;
+        }
+    }
+}
+
+/*
+ * code_point_buffer
+ * A sequence of code points that is stored inline if it holds at most
+ * 'inline_size' code points, and otherwise in a std::u32string.
+ */
+class code_point_buffer {
+public:
+    static constexpr std::size_t inline_size = 64;
+
+    code_point_buffer() = default;
+    code_point_buffer(const code_point_buffer &) = delete;
+    code_point_buffer& operator=(const code_point_buffer &) = delete;
+
+    void push_back(char32_t cp) {
+        if (length < inline_size) {
+            inline_code_points[length] = cp;
+        } else {
+            if (length == inline_size) {
+                spilled.assign(inline_code_points, inline_size);
+            }
+            spilled += cp;
+        }
+        ++length;
+    }
+
+    const char32_t* data() const noexcept {
+        return length <= inline_size ? inline_code_points : spilled.data();
+    }
+
+    std::size_t size() const noexcept {
+        return length;
+    }
+
+private:
+    char32_t inline_code_points[inline_size];
+    std::u32string spilled;
+    std::size_t length = 0;
+};
+
+/*
+ * pattern_masks
+ * The match vectors of a pattern for the bit-parallel algorithms of Myers
+ * and Hyyro: for each code point, a bit vector with bit i set if the code
+ * point is the i'th code point of the pattern.  Bit vectors are divided into
+ * blocks of 64 bits and stored in rows, one for each distinct code point of
+ * the pattern, after a row of zeros for code points not in the pattern.  The
+ * rows of ASCII code points are found in a table, and those of other code
+ * points by binary search.  The masks of patterns of at most 64 code points
+ * are stored inline.
+ */
+class pattern_masks {
+public:
+    static constexpr std::size_t inline_size = 64;
+
+    // Constructs the masks of the 'length' code points at 'pattern', or if
+    // 'reversed' is true, of those code points in reverse order.
+    pattern_masks(
+        const char32_t *pattern,
+        std::size_t length,
+        bool reversed = false)
+    :
+        length{length},
+        blocks{(length + 63) / 64}
+    {
+        if (blocks <= 1) {
+            code_points = inline_code_points;
+            masks = inline_masks;
+        } else {
+            heap_code_points.resize(length);
+            heap_masks.resize((length + 1) * blocks);
+            code_points = heap_code_points.data();
+            masks = heap_masks.data();
+        }
+        std::fill(ascii_rows, ascii_rows + 0x80, 0);
+        std::size_t rows = 1;
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < length; ++i) {
+            if (pattern[i] >= 0x80) {
+                code_points[count++] = pattern[i];
+            } else if (! ascii_rows[pattern[i]]) {
+                ascii_rows[pattern[i]] = rows++;
+            }
+        }
+        std::sort(code_points, code_points + count);
+        other_count = std::unique(code_points, code_points + count)
+                    - code_points;
+        first_other_row = rows;
+        std::fill(masks, masks + (rows + other_count) * blocks, 0);
+        for (std::size_t i = 0; i < length; ++i) {
+            char32_t cp = pattern[reversed ? length - 1 - i : i];
+            masks[offset(cp) + i / 64] |= std::uint64_t{1} << (i % 64);
+        }
+    }
+
+    pattern_masks(const pattern_masks &) = delete;
+    pattern_masks& operator=(const pattern_masks &) = delete;
+
+    std::size_t size() const noexcept {
+        return length;
+    }
+
+    std::size_t block_count() const noexcept {
+        return blocks;
+    }
+
+    // Returns the bit vector of 'cp' as an array of block_count() blocks.
+    const std::uint64_t* find(char32_t cp) const noexcept {
+        return masks + offset(cp);
+    }
+
+private:
+    std::size_t offset(char32_t cp) const noexcept {
+        if (cp < 0x80) {
+            return ascii_rows[cp] * blocks;
+        }
+        const char32_t *first = code_points;
+        const char32_t *last = first + other_count;
+        const char32_t *it = std::lower_bound(first, last, cp);
+        if (it == last || *it != cp) {
+            return 0;
+        }
+        return (first_other_row + (it - first)) * blocks;
+    }
+
+    std::size_t length;
+    std::size_t blocks;
+    std::size_t other_count;
+    std::size_t first_other_row;
+    unsigned char ascii_rows[0x80];
+    char32_t *code_points;
+    std::uint64_t *masks;
+    char32_t inline_code_points[inline_size];
+    std::uint64_t inline_masks[inline_size + 1];
+    std::vector<char32_t> heap_code_points;
+    std::vector<std::uint64_t> heap_masks;
+};
+
+/*
+ * bit_parallel_distance
+ * The last row of the dynamic programming matrix of the edit distance
+ * between a pattern and a text, computed a column, one code point of the
+ * text, at a time with the bit-parallel algorithm of Myers as formulated by
+ * Hyyro, in which the differences between adjacent cells of a column are
+ * held in bit vectors.  Patterns longer than 64 code points are processed a
+ * block of 64 rows at a time, with the horizontal difference of the last
+ * row of each block carried to the next.  If 'global' is true, the distance
+ * is that between the pattern and the whole text scanned so far; otherwise,
+ * it is the least distance between the pattern and any suffix of that text,
+ * as in approximate string matching.
+ */
+class bit_parallel_distance {
+public:
+    bit_parallel_distance(
+        const pattern_masks &pattern,
+        bool global)
+    :
+        pattern(pattern),
+        global{global},
+        score{pattern.size()},
+        last_bit{std::uint64_t{1} << ((pattern.size() + 63) % 64)}
+    {
+        std::size_t blocks = pattern.block_count();
+        if (blocks <= 1) {
+            positive = &inline_positive;
+            negative = &inline_negative;
+        } else {
+            heap_vectors.resize(blocks * 2);
+            positive = heap_vectors.data();
+            negative = positive + blocks;
+        }
+        std::fill(positive, positive + blocks, ~std::uint64_t{0});
+        std::fill(negative, negative + blocks, 0);
+    }
+
+    bit_parallel_distance(const bit_parallel_distance &) = delete;
+    bit_parallel_distance& operator=(const bit_parallel_distance &) = delete;
+
+    // Advances over the code point 'cp' of the text and returns the distance.
+    std::size_t advance(char32_t cp) noexcept {
+        const std::uint64_t *eq = pattern.find(cp);
+        std::size_t blocks = pattern.block_count();
+        int carry = global;
+        for (std::size_t i = 0; i + 1 < blocks; ++i) {
+            carry = advance_block(positive[i], negative[i], eq[i], carry,
+                                  std::uint64_t{1} << 63);
+        }
+        if (blocks) {
+            carry = advance_block(positive[blocks - 1], negative[blocks - 1],
+                                  eq[blocks - 1], carry, last_bit);
+        }
+        score += carry;
+        return score;
+    }
+
+    // Returns true if the distance exceeds that between all but the last
+    // code point of the pattern and the text, so that the best alignment of
+    // the pattern with the text deletes the last code point of the pattern.
+    bool drops_last_code_point() const noexcept {
+        std::size_t blocks = pattern.block_count();
+        return blocks ? (positive[blocks - 1] & last_bit) != 0 : false;
+    }
+
+private:
+    // Advances a block of rows whose positive and negative vertical
+    // differences are 'pv' and 'mv' over a column with the match vector 'eq',
+    // given the horizontal difference 'carry_in' of the row above the block.
+    // Returns the horizontal difference of the row 'high_bit'.
+    static int advance_block(
+        std::uint64_t &pv,
+        std::uint64_t &mv,
+        std::uint64_t eq,
+        int carry_in,
+        std::uint64_t high_bit) noexcept
+    {
+        std::uint64_t negative_in = carry_in < 0;
+        std::uint64_t xv = eq | mv;
+        eq |= negative_in;
+        std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        std::uint64_t ph = mv | ~(xh | pv);
+        std::uint64_t mh = pv & xh;
+        int carry_out = int((ph & high_bit) != 0) - int((mh & high_bit) != 0);
+        ph = ph << 1 | std::uint64_t(carry_in > 0);
+        mh = mh << 1 | negative_in;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+        return carry_out;
+    }
+
+    const pattern_masks &pattern;
+    bool global;
+    std::size_t score;
+    std::uint64_t last_bit;
+    std::uint64_t *positive;
+    std::uint64_t *negative;
+    std::uint64_t inline_positive;
+    std::uint64_t inline_negative;
+    std::vector<std::uint64_t> heap_vectors;
+};
+
+} // namespace text_detail
+
+
+/*
+ * Edit distance
+ */
+// Returns the Levenshtein distance between the text views 'a' and 'b': the
+// least number of code points that must be inserted, deleted, or substituted
+// to change the code points of one into those of the other.  Characters are
+// not normalized.  The distance is computed with the bit-parallel algorithm
+// of Myers and Hyyro, taking time proportional to the length of the longer
+// text times the length of the shorter divided by 64, after any common
+// prefix and suffix are removed.  Text in ASCII transparent encodings is
+// scanned a code unit at a time.  No memory is allocated unless a text has
+// more than 64 code points.
+template<TextView TVT1, TextView TVT2>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT1>>()
+      && origin::Forward_iterator<origin::Iterator_type<const TVT2>>()
+std::size_t edit_distance(
+    const TVT1 &a,
+    const TVT2 &b)
+{
+    text_detail::code_point_buffer a_code_points, b_code_points;
+    auto append_to = [](text_detail::code_point_buffer &buffer) {
+        return [&buffer](char32_t cp, const auto &) {
+            buffer.push_back(cp);
+            return true;
+        };
+    };
+    text_detail::scan_code_points(a, append_to(a_code_points));
+    text_detail::scan_code_points(b, append_to(b_code_points));
+    const char32_t *pattern = a_code_points.data();
+    const char32_t *text = b_code_points.data();
+    std::size_t m = a_code_points.size();
+    std::size_t n = b_code_points.size();
+    if (m > n) {
+        std::swap(pattern, text);
+        std::swap(m, n);
+    }
+    for (; m && *pattern == *text; --m, --n) {
+        ++pattern;
+        ++text;
+    }
+    for (; m && pattern[m - 1] == text[n - 1]; --m, --n) {
+    }
+    if (m == 0) {
+        return n;
+    }
+    text_detail::pattern_masks masks{pattern, m};
+    text_detail::bit_parallel_distance distance{masks, true};
+    std::size_t d = m;
+    for (std::size_t i = 0; i < n; ++i) {
+        d = distance.advance(text[i]);
+    }
+    return d;
+}
+
+
+/*
+ * Fuzzy search
+ */
+// Returns a text view of the first sequence of characters of the text view
+// 'tv' whose code points are within the Levenshtein distance 'max_distance'
+// of those of the text view 'pattern', or an empty text view at the end of
+// 'tv' if there is none.  Matches are found by the position at which they
+// end: the first position at which a match ends is advanced while the
+// distance of a match that ends there decreases, or stays the same but no
+// longer requires deleting the last character of the pattern, and the match
+// is the longest that ends there with the least distance.  Text is scanned
+// once, a code unit at a time for text in ASCII transparent encodings, with
+// the bit-parallel algorithm of Myers and Hyyro; the characters of the match
+// are then scanned in reverse to find where it begins.  No memory is allocated
+// unless the pattern has more than 64 code points.
+template<TextView TVT, TextView PTVT>
+requires origin::Bidirectional_iterator<origin::Iterator_type<const TVT>>()
+      && origin::Forward_iterator<origin::Iterator_type<const PTVT>>()
+auto fuzzy_search(
+    const TVT &tv,
+    const PTVT &pattern,
+    std::size_t max_distance)
+{
+    text_detail::code_point_buffer pattern_code_points;
+    text_detail::scan_code_points(pattern, [&](char32_t cp, const auto &) {
+        pattern_code_points.push_back(cp);
+        return true;
+    });
+    std::size_t m = pattern_code_points.size();
+    auto first = text_detail::adl_begin(tv);
+    auto last = text_detail::adl_end(tv);
+    auto end = first;
+    std::size_t best = m;
+    bool found = m <= max_distance;
+    bool truncated = m > 0;
+    {
+        text_detail::pattern_masks masks{pattern_code_points.data(), m};
+        text_detail::bit_parallel_distance distance{masks, false};
+        text_detail::scan_code_points(tv, [&](char32_t cp, auto position) {
+            std::size_t d = distance.advance(cp);
+            bool drops = distance.drops_last_code_point();
+            // A match is extended by a character that does not reduce its
+            // distance only if the match no longer drops the end of the
+            // pattern, as when a match of "Zo" for the pattern "Zoe" is
+            // extended by an accented "e".
+            if (found && (d > best || (d == best && (! truncated || drops)))) {
+                return false;
+            }
+            if (found || d <= max_distance) {
+                found = true;
+                best = d;
+                truncated = drops;
+                end = position();
+            }
+            return true;
+        });
+    }
+    if (! found) {
+        return make_text_view(last, last);
+    }
+    text_detail::pattern_masks masks{pattern_code_points.data(), m, true};
+    text_detail::bit_parallel_distance distance{masks, true};
+    // A match with the least distance has at most m + best code points.
+    auto start = end;
+    auto it = end;
+    for (std::size_t n = 0; it != first && n < m + best; ++n) {
+        --it;
+        if (distance.advance((*it).get_code_point()) == best) {
+            start = it;
+        }
+    }
+    return make_text_view(start, end);
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_EDIT_DISTANCE_HPP
@@ -11,6 +11,8 @@
 #include <text_view_detail/traits.hpp>
 #include <text_view_detail/encodings/basic_encodings.hpp>
 #include <text_view_detail/encodings/unicode_encodings.hpp>
+#include <text_view_detail/encodings/single_byte_encodings.hpp>
+#include <text_view_detail/encodings/multi_byte_encodings.hpp>
 #include <text_view_detail/encodings/std_encodings.hpp>
 
 
@@ -0,0 +1,73 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#ifndef TEXT_VIEW_MULTI_BYTE_ENCODINGS_HPP // {
+#define TEXT_VIEW_MULTI_BYTE_ENCODINGS_HPP
+
+
+#include <text_view_detail/charsets/unicode_charsets.hpp>
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/codecs/gb18030_codec.hpp>
+#include <text_view_detail/codecs/shift_jis_codec.hpp>
+#include <text_view_detail/codecs/iso_2022_jp_codec.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+/*
+ * GB18030 character encoding
+ */
+struct gb18030_encoding
+    : public text_detail::gb18030_codec<
+                 character<unicode_character_set>,
+                 char>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+
+/*
+ * Shift_JIS character encoding
+ */
+struct shift_jis_encoding
+    : public text_detail::shift_jis_codec<
+                 character<unicode_character_set>,
+                 char>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+
+/*
+ * ISO-2022-JP character encoding
+ */
+struct iso_2022_jp_encoding
+    : public text_detail::iso_2022_jp_codec<
+                 character<unicode_character_set>,
+                 char>
+{
+    static const state_type& initial_state() {
+        static const state_type state{ state_type::ascii };
+        return state;
+    }
+};
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_MULTI_BYTE_ENCODINGS_HPP
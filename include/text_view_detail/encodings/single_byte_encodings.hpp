@@ -0,0 +1,323 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#ifndef TEXT_VIEW_SINGLE_BYTE_ENCODINGS_HPP // {
+#define TEXT_VIEW_SINGLE_BYTE_ENCODINGS_HPP
+
+
+#include <text_view_detail/charsets/unicode_charsets.hpp>
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/codecs/single_byte_codec.hpp>
+#include <text_view_detail/codecs/single_byte_charmaps.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+/*
+ * ISO/IEC 8859 character encodings
+ */
+struct iso_8859_1_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_1_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_2_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_2_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_3_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_3_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_4_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_4_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_5_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_5_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_6_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_6_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_7_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_7_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_8_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_8_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_9_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_9_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_10_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_10_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_11_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_11_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_13_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_13_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_14_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_14_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_15_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_15_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct iso_8859_16_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::iso_8859_16_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+
+/*
+ * Windows code page character encodings
+ */
+struct windows_1250_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::windows_1250_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct windows_1251_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::windows_1251_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct windows_1252_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::windows_1252_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct windows_1253_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::windows_1253_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct windows_1254_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::windows_1254_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct windows_1255_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::windows_1255_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct windows_1256_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::windows_1256_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct windows_1257_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::windows_1257_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct windows_1258_encoding
+    : public text_detail::single_byte_codec<
+                 character<unicode_character_set>,
+                 char,
+                 text_detail::windows_1258_charmap>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_SINGLE_BYTE_ENCODINGS_HPP
@@ -13,10 +13,14 @@
 #include <text_view_detail/codecs/trivial_codec.hpp>
 #include <text_view_detail/codecs/utf8_codec.hpp>
 #include <text_view_detail/codecs/utf8bom_codec.hpp>
+#include <text_view_detail/codecs/cesu8_codec.hpp>
+#include <text_view_detail/codecs/modified_utf8_codec.hpp>
+#include <text_view_detail/codecs/wtf8_codec.hpp>
 #include <text_view_detail/codecs/utf16_codec.hpp>
 #include <text_view_detail/codecs/utf16be_codec.hpp>
 #include <text_view_detail/codecs/utf16le_codec.hpp>
 #include <text_view_detail/codecs/utf16bom_codec.hpp>
+#include <text_view_detail/codecs/utf16_lossless_codec.hpp>
 #include <text_view_detail/codecs/utf32be_codec.hpp>
 #include <text_view_detail/codecs/utf32le_codec.hpp>
 #include <text_view_detail/codecs/utf32bom_codec.hpp>
@@ -72,6 +76,42 @@ struct utf8bom_encoding
     }
 };
 
+// CESU-8 (Unicode Technical Report #26) and the modified UTF-8 encoding used
+// by Java class files and JNI.
+struct cesu8_encoding
+    : public text_detail::cesu8_codec<
+                 character<unicode_character_set>,
+                 char>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+struct modified_utf8_encoding
+    : public text_detail::modified_utf8_codec<
+                 character<unicode_character_set>,
+                 char>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
+// WTF-8; UTF-8 extended to encode unpaired surrogates.
+struct wtf8_encoding
+    : public text_detail::wtf8_codec<
+                 character<unicode_character_set>,
+                 char>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
 
 /*
  * Unicode UTF-16 character encodings
@@ -168,6 +208,19 @@ struct utf32bom_encoding
     }
 };
 
+// UTF-16, native endian, with unpaired surrogates decoded to and encoded from
+// surrogate code points rather than rejected.
+struct utf16_lossless_encoding
+    : public text_detail::utf16_lossless_codec<
+                 character<unicode_character_set>,
+                 char16_t>
+{
+    static const state_type& initial_state() {
+        static const state_type state;
+        return state;
+    }
+};
+
 
 } // inline namespace text
 } // namespace experimental
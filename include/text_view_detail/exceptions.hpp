@@ -71,6 +71,28 @@ public:
 };
 
 
+/*
+ * Text regex error
+ */
+class text_regex_error
+    : public text_runtime_error
+{
+public:
+    using text_runtime_error::text_runtime_error;
+};
+
+
+/*
+ * Text tokenizer error
+ */
+class text_tokenizer_error
+    : public text_runtime_error
+{
+public:
+    using text_runtime_error::text_runtime_error;
+};
+
+
 } // inline namespace text
 } // namespace experimental
 } // namespace std
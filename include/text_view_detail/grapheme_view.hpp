@@ -0,0 +1,215 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_GRAPHEME_VIEW_HPP) // {
+#define TEXT_VIEW_GRAPHEME_VIEW_HPP
+
+
+#include <text_view_detail/boundary_view.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/unicode/unicode_trie.hpp>
+#include <text_view_detail/unicode/grapheme_break_tables.hpp>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+namespace text_detail {
+
+// Returns the Grapheme_Cluster_Break property of 'cp'.  Code points below
+// U+0300 (ASCII, Latin-1, and the Latin Extended blocks) are classified with
+// a single table lookup that bypasses the trie.
+inline grapheme_break_table::property
+grapheme_break_property(char32_t cp) noexcept {
+    if (cp < grapheme_break_table::latin_limit) {
+        return grapheme_break_table::property(grapheme_break_table::latin[cp]);
+    }
+    return grapheme_break_table::property(
+        trie_lookup<grapheme_break_table>(cp));
+}
+
+// Returns the bit that represents the Grapheme_Cluster_Break property 'p' in
+// a set of properties.
+constexpr unsigned grapheme_break_bit(grapheme_break_table::property p) {
+    return 1u << p;
+}
+
+/*
+ * Grapheme cluster boundary rules
+ * Implements the grapheme cluster boundary rules of UAX #29 (GB3 through
+ * GB13 and GB999) for extended grapheme clusters.  A grapheme_break_context
+ * holds the properties of the characters seen so far that the rules depend
+ * on: the property of the previous character, whether the preceding
+ * characters match ExtPict Extend* ZWJ? (GB11), and the parity of the
+ * preceding run of regional indicators (GB12 and GB13).
+ */
+class grapheme_break_context {
+public:
+    using property = grapheme_break_table::property;
+
+    explicit grapheme_break_context(property first) noexcept
+    :
+        previous{first},
+        emoji{first == property::extended_pictographic
+              ? pictographic : none},
+        odd_regional_indicators{first == property::regional_indicator}
+    {}
+
+    // Returns true if there is a grapheme cluster boundary between the
+    // previous character and a following character with property 'next'.
+    // The context is then updated to reflect 'next' as the previous
+    // character.
+    bool is_boundary_before(property next) noexcept {
+        bool boundary;
+        if (previous == property::zwj
+            && next == property::extended_pictographic)
+        {
+            boundary = emoji != pictographic_zwj;              // GB11
+        } else if (previous == property::regional_indicator
+                   && next == property::regional_indicator)
+        {
+            boundary = ! odd_regional_indicators;              // GB12, GB13
+        } else {
+            boundary = ! ((joins[previous] >> next) & 1);
+        }
+
+        if (next == property::extended_pictographic) {
+            emoji = pictographic;
+        } else if (emoji == pictographic && next == property::extend) {
+            emoji = pictographic;
+        } else if (emoji == pictographic && next == property::zwj) {
+            emoji = pictographic_zwj;
+        } else {
+            emoji = none;
+        }
+        odd_regional_indicators =
+            next == property::regional_indicator && ! odd_regional_indicators;
+        previous = next;
+        return boundary;
+    }
+
+private:
+    // GB9, GB9a.
+    static constexpr unsigned extenders =
+        grapheme_break_bit(property::extend) |
+        grapheme_break_bit(property::zwj) |
+        grapheme_break_bit(property::spacing_mark);
+    // For each property of a previous character, the set of properties of a
+    // following character that are not separated by a boundary under rules
+    // GB3 through GB9b.  Pairs not listed are separated by GB4, GB5, or
+    // GB999.
+    static constexpr unsigned joins[property::extended_pictographic + 1] = {
+        // other
+        extenders,
+        // cr (GB3)
+        grapheme_break_bit(property::lf),
+        // lf, control (GB4)
+        0,
+        0,
+        // extend, zwj, regional_indicator
+        extenders,
+        extenders,
+        extenders,
+        // prepend (GB9b)
+        ~(grapheme_break_bit(property::cr) |
+          grapheme_break_bit(property::lf) |
+          grapheme_break_bit(property::control)),
+        // spacing_mark
+        extenders,
+        // l (GB6)
+        extenders |
+        grapheme_break_bit(property::l) | grapheme_break_bit(property::v) |
+        grapheme_break_bit(property::lv) | grapheme_break_bit(property::lvt),
+        // v (GB7)
+        extenders |
+        grapheme_break_bit(property::v) | grapheme_break_bit(property::t),
+        // t (GB8)
+        extenders | grapheme_break_bit(property::t),
+        // lv (GB7)
+        extenders |
+        grapheme_break_bit(property::v) | grapheme_break_bit(property::t),
+        // lvt (GB8)
+        extenders | grapheme_break_bit(property::t),
+        // extended_pictographic
+        extenders,
+    };
+
+    enum emoji_state : unsigned char {
+        none,
+        pictographic,       // ExtPict Extend*
+        pictographic_zwj    // ExtPict Extend* ZWJ
+    };
+
+    property previous;
+    emoji_state emoji;
+    bool odd_regional_indicators;
+};
+
+// Boundary rules for boundary_view that locate extended grapheme cluster
+// boundaries.
+struct grapheme_break_rules {
+    template<typename TIT, typename TST, typename RT>
+    static TIT next_boundary(TIT first, TST last, const RT *) {
+        grapheme_break_context context{
+            grapheme_break_property((*first).get_code_point())};
+        for (++first; first != last; ++first) {
+            if (context.is_boundary_before(
+                    grapheme_break_property((*first).get_code_point())))
+            {
+                break;
+            }
+        }
+        return first;
+    }
+};
+
+} // namespace text_detail
+
+
+/*
+ * grapheme_view
+ * A view adapter over a text view that presents the extended grapheme
+ * clusters (UAX #29) of the underlying text as a range of text views, each
+ * of which spans the characters of one grapheme cluster.  Boundaries are
+ * located by decoding each character of the underlying text view exactly
+ * once.  The underlying text view must provide forward iterators and its
+ * characters must have Unicode code points.
+ */
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+class grapheme_view
+    : public text_detail::boundary_view<TVT, text_detail::grapheme_break_rules>
+{
+public:
+    using cluster_type = typename grapheme_view::segment_type;
+
+    using text_detail::boundary_view<
+        TVT, text_detail::grapheme_break_rules>::boundary_view;
+};
+
+
+/*
+ * make_grapheme_view
+ */
+// Constructs a grapheme view over an existing text view.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_grapheme_view(
+    TVT tv)
+{
+    return grapheme_view<TVT>{tv};
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_GRAPHEME_VIEW_HPP
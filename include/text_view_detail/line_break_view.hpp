@@ -0,0 +1,346 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_LINE_BREAK_VIEW_HPP) // {
+#define TEXT_VIEW_LINE_BREAK_VIEW_HPP
+
+
+#include <text_view_detail/boundary_view.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/unicode/unicode_trie.hpp>
+#include <text_view_detail/unicode/line_break_tables.hpp>
+#include <cstdint>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+namespace text_detail {
+
+// Returns the line_break_table entry for 'cp'; the resolved Line_Break
+// property and the east_asian and pictographic_unassigned flags.  Code points
+// below U+0300 are classified with a single table lookup that bypasses the
+// trie.
+inline unsigned char
+line_break_entry(char32_t cp) noexcept {
+    if (cp < line_break_table::latin_limit) {
+        return line_break_table::latin[cp];
+    }
+    return trie_lookup<line_break_table>(cp);
+}
+
+// Returns the bit that represents the Line_Break property 'p' in a set of
+// properties.
+constexpr std::uint64_t line_break_bit(line_break_table::property p) {
+    return std::uint64_t{1} << p;
+}
+
+/*
+ * Line breaking rules
+ * Implements the line breaking rules of UAX #14 (LB4 through LB31) with the
+ * classes resolved as specified by LB1.  A line_break_context holds the
+ * properties of the characters seen so far that the rules depend on: the
+ * previous character, the previous two characters after combining marks are
+ * attached to their base by LB9, whether spaces follow them, and the parity of
+ * the preceding run of regional indicators.  Whether a break is allowed
+ * between two characters that are not separated by spaces is determined by a
+ * pair table that holds, for each class of a previous character, the set of
+ * classes of a following character that are not separated by a break
+ * opportunity.  Every rule depends only on the characters that precede a
+ * potential break opportunity, so break opportunities are located without
+ * lookahead.
+ */
+class line_break_context {
+public:
+    using property = line_break_table::property;
+
+    explicit line_break_context(unsigned char first) noexcept
+    :
+        raw_previous{property(first & line_break_table::property_mask)}
+    {
+        start(first);
+    }
+
+    // Returns true if there is a break opportunity between the previous
+    // character and a following character with line_break_table entry
+    // 'next_entry'.  The context is then updated to reflect the following
+    // character as the previous character.
+    bool is_boundary_before(unsigned char next_entry) noexcept {
+        property next =
+            property(next_entry & line_break_table::property_mask);
+        property raw = raw_previous;
+        raw_previous = next;
+
+        if (raw == property::cr && next == property::lf) {
+            return false;                                       // LB5
+        }
+        if (is_hard_break(raw)) {
+            start(next_entry);
+            return true;                                        // LB4, LB5
+        }
+        if (is_hard_break(next)) {
+            return false;                                       // LB6
+        }
+        if (next == property::sp) {
+            spaces = true;
+            return false;                                       // LB7
+        }
+        if (next == property::zw) {
+            shift(next_entry, next);
+            return false;                                       // LB7
+        }
+        if (previous == property::zw) {
+            start(next_entry);
+            return true;                                        // LB8
+        }
+        if (next == property::cm || next == property::zwj) {
+            if (! spaces) {
+                return false;                                   // LB9
+            }
+            next_entry = next = property::al;                   // LB10
+        }
+        if (raw == property::zwj) {
+            shift(next_entry, next);
+            return false;                                       // LB8a
+        }
+
+        bool boundary = true;
+        if (spaces) {
+            if (previous == property::op) {
+                boundary = false;                               // LB14
+            } else if ((joins_after_spaces >> next) & 1) {
+                boundary = false;                               // LB11, LB13
+            } else if (previous == property::qu && next == property::op) {
+                boundary = false;                               // LB15
+            } else if ((previous == property::cl || previous == property::cp)
+                       && next == property::ns)
+            {
+                boundary = false;                               // LB16
+            } else if (previous == property::b2 && next == property::b2) {
+                boundary = false;                               // LB17
+            }                                                   // LB18
+        } else if ((joins[previous] >> next) & 1) {
+            boundary = false;
+        } else if (before_previous == property::hl
+                   && (previous == property::hy || previous == property::ba)
+                   && next != property::cb)
+        {
+            boundary = false;                                   // LB21a
+        } else if ((previous == property::al || previous == property::hl
+                    || previous == property::nu)
+                   && next == property::op
+                   && ! (next_entry & line_break_table::east_asian))
+        {
+            boundary = false;                                   // LB30
+        } else if (previous == property::cp
+                   && ! (previous_entry & line_break_table::east_asian)
+                   && (next == property::al || next == property::hl
+                       || next == property::nu))
+        {
+            boundary = false;                                   // LB30
+        } else if (previous == property::ri && next == property::ri) {
+            boundary = ! odd_regional_indicators;               // LB30a
+        } else if ((previous_entry & line_break_table::pictographic_unassigned)
+                   && next == property::em)
+        {
+            boundary = false;                                   // LB30b
+        }
+        shift(next_entry, next);
+        return boundary;
+    }
+
+private:
+    static constexpr bool is_hard_break(property p) {
+        return p == property::bk || p == property::cr || p == property::lf
+            || p == property::nl;
+    }
+
+    // Updates the context to reflect a character with line_break_table entry
+    // 'entry' that follows a break opportunity required by LB4, LB5, or LB8.
+    void start(unsigned char entry) noexcept {
+        property p = property(entry & line_break_table::property_mask);
+        if (p == property::cm || p == property::zwj) {
+            entry = p = property::al;                           // LB10
+        }
+        previous_entry = entry;
+        previous = p;
+        before_previous = property::sp;
+        spaces = p == property::sp;
+        odd_regional_indicators = p == property::ri;
+    }
+
+    void shift(unsigned char entry, property next) noexcept {
+        odd_regional_indicators =
+            next == property::ri && (spaces || ! odd_regional_indicators);
+        before_previous = spaces ? property::sp : previous;
+        previous = next;
+        previous_entry = entry;
+        spaces = false;
+    }
+
+    static constexpr std::uint64_t all = ~std::uint64_t{0};
+    // LB11, LB13: no break before these, even after spaces.
+    static constexpr std::uint64_t joins_after_spaces =
+        line_break_bit(property::wj) | line_break_bit(property::cl) |
+        line_break_bit(property::cp) | line_break_bit(property::ex) |
+        line_break_bit(property::is) | line_break_bit(property::sy);
+    // LB11, LB13, LB19; and LB12a for all but BA and HY.
+    static constexpr std::uint64_t closers =
+        joins_after_spaces | line_break_bit(property::qu);
+    static constexpr std::uint64_t glue = line_break_bit(property::gl);
+    // LB21, LB22; these follow LB20, so a CB is separated from them.
+    static constexpr std::uint64_t nonstarters =
+        line_break_bit(property::ba) | line_break_bit(property::hy) |
+        line_break_bit(property::ns) | line_break_bit(property::in);
+    static constexpr std::uint64_t common = closers | glue | nonstarters;
+    static constexpr std::uint64_t alphabetic =
+        line_break_bit(property::al) | line_break_bit(property::hl);
+    static constexpr std::uint64_t numeric = line_break_bit(property::nu);
+    static constexpr std::uint64_t affixes =
+        line_break_bit(property::pr) | line_break_bit(property::po);
+    static constexpr std::uint64_t postfix = line_break_bit(property::po);
+    static constexpr std::uint64_t hangul =
+        line_break_bit(property::jl) | line_break_bit(property::jv) |
+        line_break_bit(property::jt) | line_break_bit(property::h2) |
+        line_break_bit(property::h3);
+    // For each class of a previous character that is not followed by spaces,
+    // the set of classes of a following character that are not separated by
+    // a break opportunity under rules LB11 through LB30b, other than the
+    // contextual rules LB21a, LB30, LB30a, and the second part of LB30b.
+    // The rows for classes that are handled before the table is consulted
+    // are empty.
+    static constexpr std::uint64_t joins[property::ri + 1] = {
+        // al (LB23, LB24, LB28)
+        common | numeric | affixes | alphabetic,
+        // bk, cr, lf, nl, sp, zw, zwj, cm
+        0, 0, 0, 0, 0, 0, 0, 0,
+        // wj (LB11), gl (LB12)
+        all,
+        all,
+        // ba, hy (LB25)
+        closers | nonstarters,
+        closers | nonstarters | numeric,
+        // bb (LB21)
+        all & ~line_break_bit(property::cb),
+        // b2 (LB17)
+        common | line_break_bit(property::b2),
+        // cb (LB20)
+        closers | glue,
+        // cl, cp (LB25)
+        common | affixes,
+        common | affixes,
+        // ex
+        common,
+        // is (LB25, LB29)
+        common | numeric | alphabetic,
+        // sy (LB21b, LB25)
+        common | numeric | line_break_bit(property::hl),
+        // op (LB14), qu (LB19)
+        all,
+        all,
+        // ns, in
+        common,
+        common,
+        // nu (LB23, LB25)
+        common | alphabetic | affixes | numeric,
+        // pr (LB23a, LB24, LB25, LB27)
+        common | line_break_bit(property::id) | line_break_bit(property::eb) |
+        line_break_bit(property::em) | alphabetic |
+        line_break_bit(property::op) | numeric | hangul,
+        // po (LB24, LB25)
+        common | alphabetic | line_break_bit(property::op) | numeric,
+        // hl (LB23, LB24, LB28)
+        common | numeric | affixes | alphabetic,
+        // id (LB23a)
+        common | postfix,
+        // eb (LB23a, LB30b), em (LB23a)
+        common | postfix | line_break_bit(property::em),
+        common | postfix,
+        // h2, h3 (LB26, LB27)
+        common | line_break_bit(property::jv) | line_break_bit(property::jt) |
+        postfix,
+        common | line_break_bit(property::jt) | postfix,
+        // jl, jv, jt (LB26, LB27)
+        common | line_break_bit(property::jl) | line_break_bit(property::jv) |
+        line_break_bit(property::h2) | line_break_bit(property::h3) | postfix,
+        common | line_break_bit(property::jv) | line_break_bit(property::jt) |
+        postfix,
+        common | line_break_bit(property::jt) | postfix,
+        // ri (LB30a is contextual)
+        common,
+    };
+
+    property raw_previous;
+    property previous;
+    property before_previous;
+    unsigned char previous_entry;
+    bool spaces;
+    bool odd_regional_indicators;
+};
+
+// Boundary rules for boundary_view that locate line break opportunities.
+struct line_break_rules {
+    template<typename TIT, typename TST, typename RT>
+    static TIT next_boundary(TIT first, TST last, const RT *) {
+        line_break_context context{
+            line_break_entry((*first).get_code_point())};
+        for (++first; first != last; ++first) {
+            if (context.is_boundary_before(
+                    line_break_entry((*first).get_code_point())))
+            {
+                break;
+            }
+        }
+        return first;
+    }
+};
+
+} // namespace text_detail
+
+
+/*
+ * line_break_view
+ * A view adapter over a text view that presents the text between adjacent
+ * line break opportunities (UAX #14) as a range of text views.  Each segment
+ * includes any spaces that precede the break opportunity that ends it; a
+ * segment ends with a mandatory break if its last character has a Line_Break
+ * property of BK, CR, LF, or NL.  Break opportunities are located in a single
+ * pass over the underlying text view, which must provide forward iterators
+ * and whose characters must have Unicode code points.
+ */
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+class line_break_view
+    : public text_detail::boundary_view<TVT, text_detail::line_break_rules>
+{
+public:
+    using text_detail::boundary_view<
+        TVT, text_detail::line_break_rules>::boundary_view;
+};
+
+
+/*
+ * make_line_break_view
+ */
+// Constructs a line break view over an existing text view.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_line_break_view(
+    TVT tv)
+{
+    return line_break_view<TVT>{tv};
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_LINE_BREAK_VIEW_HPP
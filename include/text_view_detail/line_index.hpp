@@ -0,0 +1,574 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_LINE_INDEX_HPP) // {
+#define TEXT_VIEW_LINE_INDEX_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/encodings.hpp>
+#include <text_view_detail/exceptions.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <origin/core/traits.hpp>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+/*
+ * Line separators
+ * The characters that end lines: LF, which also ends a CR LF pair, and
+ * optionally the Unicode line and paragraph separators, U+2028 and U+2029.
+ * A CR that is not followed by LF does not end a line.
+ */
+enum class line_separators {
+    newline,
+    unicode
+};
+
+
+/*
+ * text_position
+ * A line and a column within it, both numbered from 1.  Columns are counted
+ * in code points.
+ */
+struct text_position {
+    std::size_t line;
+    std::size_t column;
+};
+
+inline bool operator==(
+    const text_position &l,
+    const text_position &r) noexcept
+{
+    return l.line == r.line && l.column == r.column;
+}
+
+inline bool operator!=(
+    const text_position &l,
+    const text_position &r) noexcept
+{
+    return ! (l == r);
+}
+
+
+namespace text_detail {
+
+// Marks with code units further apart than this are separated by a
+// checkpoint, so that at most this many code units are decoded to find a
+// column.
+constexpr std::size_t line_index_checkpoint_interval = 1024;
+
+/*
+ * line_mark
+ * A code unit offset, the number of code points that precede it, and the
+ * encoding state there.  The state is a base class so that the empty states
+ * of stateless encodings occupy no storage.
+ */
+template<typename ST>
+struct line_mark : ST {
+    line_mark(
+        const ST &state,
+        std::size_t offset,
+        std::size_t code_point)
+    :
+        ST(state), offset{offset}, code_point{code_point}
+    {}
+
+    const ST& state() const noexcept {
+        return *this;
+    }
+
+    std::size_t offset;
+    std::size_t code_point;
+};
+
+// Returns true if the character 'cp' ends a line.
+inline bool is_line_separator(
+    char32_t cp,
+    line_separators separators) noexcept
+{
+    return cp == U'\n'
+        || (separators == line_separators::unicode
+            && (cp == 0x2028 || cp == 0x2029));
+}
+
+// In general, the code units in ['first' + 'end.offset', 'first' + 'size')
+// are decoded a character at a time from the state of 'end'.  A mark is
+// appended to 'lines' after each line separator and to 'checkpoints' where
+// one is due, and 'end' is advanced past the last whole character; a
+// partial character at the end of the code units is left to be decoded once
+// the rest of it is appended.
+template<TextEncoding ET, typename CUIT>
+void scan_lines(
+    ET,
+    CUIT first,
+    std::size_t size,
+    line_separators separators,
+    line_mark<typename ET::state_type> &end,
+    std::vector<line_mark<typename ET::state_type>> &lines,
+    std::vector<line_mark<typename ET::state_type>> &checkpoints)
+{
+    typename ET::state_type state = end.state();
+    std::size_t offset = end.offset;
+    std::size_t code_points = end.code_point;
+    CUIT next = first + offset;
+    CUIT last = first + size;
+    character_type_t<ET> c;
+    int decoded_code_units;
+    while (next != last) {
+        if (offset - checkpoints.back().offset
+            >= line_index_checkpoint_interval)
+        {
+            checkpoints.emplace_back(state, offset, code_points);
+        }
+        typename ET::state_type decode_state = state;
+        CUIT p = next;
+        bool decoded;
+        try {
+            decoded = ET::decode(decode_state, p, last, c,
+                                 decoded_code_units);
+        } catch (const text_decode_underflow_error &) {
+            break;
+        } catch (...) {
+            end = {state, offset, code_points};
+            throw;
+        }
+        state = decode_state;
+        next = p;
+        offset = next - first;
+        if (decoded) {
+            ++code_points;
+            if (is_line_separator(c.get_code_point(), separators)) {
+                lines.emplace_back(state, offset, code_points);
+            }
+        }
+    }
+    end = {state, offset, code_points};
+}
+
+// UTF-8 text is scanned without decoding it, sixteen code units at a time
+// where SSE2 is available.  Code points are counted as the code units that
+// are not continuation code units, so marks need not fall on character
+// boundaries, and U+2028 and U+2029 are recognized by their last code unit
+// and the two before it, which have already been appended.
+template<typename CUIT>
+void scan_lines(
+    utf8_encoding,
+    CUIT first,
+    std::size_t size,
+    line_separators separators,
+    line_mark<utf8_encoding::state_type> &end,
+    std::vector<line_mark<utf8_encoding::state_type>> &lines,
+    std::vector<line_mark<utf8_encoding::state_type>> &checkpoints)
+{
+    const utf8_encoding::state_type state = end.state();
+    const bool unicode = separators == line_separators::unicode;
+    std::size_t offset = end.offset;
+    std::size_t code_points = end.code_point;
+    auto is_unicode_separator = [&](std::size_t i) {
+        return i >= 2
+            && static_cast<unsigned char>(first[i - 1]) == 0x80
+            && static_cast<unsigned char>(first[i - 2]) == 0xE2;
+    };
+#if defined(__SSE2__)
+    const __m128i newlines = _mm_set1_epi8('\n');
+    // Continuation code units compare as the signed values -128 through -65.
+    const __m128i continuations = _mm_set1_epi8(char(0xBF));
+    const __m128i line_separator_ends = _mm_set1_epi8(char(0xA8));
+    const __m128i paragraph_separator_ends = _mm_set1_epi8(char(0xA9));
+    while (size - offset >= 16) {
+        if (offset - checkpoints.back().offset
+            >= line_index_checkpoint_interval)
+        {
+            checkpoints.emplace_back(state, offset, code_points);
+        }
+        unsigned char block[16];
+        std::copy(first + offset, first + offset + 16, block);
+        __m128i octets = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(block));
+        int starts = _mm_movemask_epi8(
+            _mm_cmpgt_epi8(octets, continuations));
+        int breaks = _mm_movemask_epi8(_mm_cmpeq_epi8(octets, newlines));
+        if (unicode) {
+            int candidates = _mm_movemask_epi8(_mm_or_si128(
+                _mm_cmpeq_epi8(octets, line_separator_ends),
+                _mm_cmpeq_epi8(octets, paragraph_separator_ends)));
+            for (; candidates; candidates &= candidates - 1) {
+                int i = __builtin_ctz(candidates);
+                if (is_unicode_separator(offset + i)) {
+                    breaks |= 1 << i;
+                }
+            }
+        }
+        for (; breaks; breaks &= breaks - 1) {
+            int i = __builtin_ctz(breaks);
+            lines.emplace_back(
+                state, offset + i + 1,
+                code_points + __builtin_popcount(starts & ((2 << i) - 1)));
+        }
+        code_points += __builtin_popcount(starts);
+        offset += 16;
+    }
+#endif
+    for (; offset != size; ++offset) {
+        if (offset - checkpoints.back().offset
+            >= line_index_checkpoint_interval)
+        {
+            checkpoints.emplace_back(state, offset, code_points);
+        }
+        unsigned char cu = first[offset];
+        if ((cu & 0xC0) != 0x80) {
+            ++code_points;
+        }
+        if (cu == '\n'
+            || (unicode && (cu == 0xA8 || cu == 0xA9)
+                && is_unicode_separator(offset)))
+        {
+            lines.emplace_back(state, offset + 1, code_points);
+        }
+    }
+    end = {state, offset, code_points};
+}
+
+// In general, returns the number of characters decoded from the mark 'from'
+// that begin before 'offset', within the 'size' code units that have been
+// scanned.
+template<TextEncoding ET, typename CUIT>
+std::size_t count_code_points(
+    ET,
+    CUIT first,
+    std::size_t size,
+    const line_mark<typename ET::state_type> &from,
+    std::size_t offset)
+{
+    typename ET::state_type state = from.state();
+    CUIT next = first + from.offset;
+    CUIT stop = first + offset;
+    CUIT last = first + size;
+    character_type_t<ET> c;
+    int decoded_code_units;
+    std::size_t code_points = 0;
+    while (next < stop) {
+        if (ET::decode(state, next, last, c, decoded_code_units)) {
+            ++code_points;
+        }
+    }
+    return code_points;
+}
+
+// UTF-8 code points are counted as the code units that are not continuation
+// code units, sixteen at a time where SSE2 is available.
+template<typename CUIT>
+std::size_t count_code_points(
+    utf8_encoding,
+    CUIT first,
+    std::size_t,
+    const line_mark<utf8_encoding::state_type> &from,
+    std::size_t offset)
+{
+    std::size_t i = from.offset;
+    std::size_t code_points = 0;
+#if defined(__SSE2__)
+    const __m128i continuations = _mm_set1_epi8(char(0xBF));
+    for (; offset - i >= 16; i += 16) {
+        unsigned char block[16];
+        std::copy(first + i, first + i + 16, block);
+        __m128i octets = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(block));
+        code_points += __builtin_popcount(_mm_movemask_epi8(
+            _mm_cmpgt_epi8(octets, continuations)));
+    }
+#endif
+    for (; i != offset; ++i) {
+        if ((static_cast<unsigned char>(first[i]) & 0xC0) != 0x80) {
+            ++code_points;
+        }
+    }
+    return code_points;
+}
+
+// In general, returns the offset at which the character that follows
+// 'count' characters decoded from the mark 'from' begins, or 'size' if the
+// last of them ends the 'size' code units that have been scanned.
+template<TextEncoding ET, typename CUIT>
+std::size_t advance_code_points(
+    ET,
+    CUIT first,
+    std::size_t size,
+    const line_mark<typename ET::state_type> &from,
+    std::size_t count)
+{
+    typename ET::state_type state = from.state();
+    CUIT next = first + from.offset;
+    CUIT last = first + size;
+    character_type_t<ET> c;
+    int decoded_code_units;
+    while (count != 0) {
+        if (ET::decode(state, next, last, c, decoded_code_units)) {
+            --count;
+        }
+    }
+    return next - first;
+}
+
+// UTF-8 code units are skipped sixteen at a time where SSE2 is available
+// while no more than 'count' characters begin among them.
+template<typename CUIT>
+std::size_t advance_code_points(
+    utf8_encoding,
+    CUIT first,
+    std::size_t size,
+    const line_mark<utf8_encoding::state_type> &from,
+    std::size_t count)
+{
+    std::size_t i = from.offset;
+#if defined(__SSE2__)
+    const __m128i continuations = _mm_set1_epi8(char(0xBF));
+    while (size - i >= 16) {
+        unsigned char block[16];
+        std::copy(first + i, first + i + 16, block);
+        __m128i octets = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(block));
+        std::size_t starts = __builtin_popcount(_mm_movemask_epi8(
+            _mm_cmpgt_epi8(octets, continuations)));
+        if (starts > count) {
+            break;
+        }
+        count -= starts;
+        i += 16;
+    }
+#endif
+    for (; i != size; ++i) {
+        if ((static_cast<unsigned char>(first[i]) & 0xC0) != 0x80) {
+            if (count == 0) {
+                break;
+            }
+            --count;
+        }
+    }
+    return i;
+}
+
+} // namespace text_detail
+
+
+/*
+ * line_index
+ * An index of the lines of text in the encoding 'ET' that maps code unit
+ * offsets to lines and columns and back.  The index records the offset at
+ * which each line begins, and checkpoints at most 1024 code units apart, at
+ * each of which the number of preceding code points and the encoding state
+ * are recorded.  A lookup finds the line and the nearest checkpoint with a
+ * binary search and decodes no more than the code units between that
+ * checkpoint and the position sought.  UTF-8 text is indexed and looked up
+ * without decoding it, sixteen code units at a time where SSE2 is
+ * available.
+ *
+ * Text appended to the indexed text is indexed by update() without
+ * rescanning what precedes it.  Each text view given to an index must begin
+ * with the code units that it has already indexed, although these may have
+ * been moved; a partial character at the end of the text is indexed once
+ * the rest of it has been appended.  Text that is not well formed in its
+ * encoding has unspecified lines and columns, and may cause decode errors
+ * to be thrown in encodings other than UTF-8.
+ */
+template<TextEncoding ET>
+class line_index {
+public:
+    using encoding_type = ET;
+
+    // Constructs an index of empty text, whose lines end with the line
+    // separators 'separators'.
+    explicit line_index(
+        line_separators separators = line_separators::newline)
+    :
+        separators{separators},
+        end{ET::initial_state(), 0, 0},
+        lines{end},
+        checkpoints{end}
+    {}
+
+    // Constructs an index of the text view 'tv', whose lines end with the
+    // line separators 'separators'.
+    template<TextView TVT>
+    requires std::is_same<encoding_type_t<TVT>, ET>::value
+          && origin::Random_access_iterator<
+                 origin::Iterator_type<const typename TVT::range_type>>()
+    explicit line_index(
+        const TVT &tv,
+        line_separators separators = line_separators::newline)
+    :
+        line_index{separators}
+    {
+        update(tv);
+    }
+
+    // Indexes the code units of the text view 'tv' that follow those that
+    // have already been indexed.
+    template<TextView TVT>
+    requires std::is_same<encoding_type_t<TVT>, ET>::value
+          && origin::Random_access_iterator<
+                 origin::Iterator_type<const typename TVT::range_type>>()
+    void update(
+        const TVT &tv)
+    {
+        auto first = text_detail::adl_begin(tv.base());
+        std::size_t size = text_detail::adl_end(tv.base()) - first;
+        text_detail::scan_lines(ET{}, first, size, separators, end, lines,
+                                checkpoints);
+    }
+
+    // Returns the number of code units that have been indexed.
+    std::size_t size() const noexcept {
+        return end.offset;
+    }
+
+    // Returns the number of lines, counting the line that follows the last
+    // line separator even if it is empty.
+    std::size_t line_count() const noexcept {
+        return lines.size();
+    }
+
+    // Returns the offset of the first code unit of the line 'line'.  Throws
+    // std::out_of_range if there is no such line.
+    std::size_t line_offset(
+        std::size_t line) const
+    {
+        if (line == 0 || line > lines.size()) {
+            throw std::out_of_range("line index line out of range");
+        }
+        return lines[line - 1].offset;
+    }
+
+    // Returns the line and column of the code unit at the offset 'offset' of
+    // the text view 'tv', or, if 'offset' is within a character, the column
+    // that follows that character.  The offset of the end of the indexed
+    // text has the column that follows the last character.  Throws
+    // std::out_of_range if 'offset' is beyond the end of the indexed text.
+    template<TextView TVT>
+    requires std::is_same<encoding_type_t<TVT>, ET>::value
+          && origin::Random_access_iterator<
+                 origin::Iterator_type<const typename TVT::range_type>>()
+    text_position position(
+        const TVT &tv,
+        std::size_t offset) const
+    {
+        if (offset > end.offset) {
+            throw std::out_of_range("line index offset out of range");
+        }
+        auto by_offset = [](std::size_t offset, const mark_type &m) {
+            return offset < m.offset;
+        };
+        auto line = std::upper_bound(lines.begin(), lines.end(), offset,
+                                     by_offset) - 1;
+        // Checkpoints are searched only if the line does not begin within
+        // a checkpoint interval of the offset.
+        const mark_type *from = &*line;
+        if (offset - line->offset > checkpoint_interval) {
+            auto checkpoint = std::upper_bound(checkpoints.begin(),
+                                               checkpoints.end(), offset,
+                                               by_offset) - 1;
+            if (checkpoint->offset > line->offset) {
+                from = &*checkpoint;
+            }
+        }
+        std::size_t code_point = from->code_point
+            + text_detail::count_code_points(
+                  ET{}, text_detail::adl_begin(tv.base()), end.offset,
+                  *from, offset);
+        return {std::size_t(line - lines.begin()) + 1,
+                code_point - line->code_point + 1};
+    }
+
+    // Returns the offset of the first code unit of the character at the
+    // position 'p' of the text view 'tv', or the end of the indexed text if
+    // 'p' follows the last character.  Throws std::out_of_range if there is
+    // no such line, or if the line has fewer characters than the column
+    // precedes.
+    template<TextView TVT>
+    requires std::is_same<encoding_type_t<TVT>, ET>::value
+          && origin::Random_access_iterator<
+                 origin::Iterator_type<const typename TVT::range_type>>()
+    std::size_t offset(
+        const TVT &tv,
+        const text_position &p) const
+    {
+        if (p.line == 0 || p.line > lines.size() || p.column == 0) {
+            throw std::out_of_range("line index position out of range");
+        }
+        const mark_type &line = lines[p.line - 1];
+        std::size_t code_point = line.code_point + p.column - 1;
+        std::size_t last_code_point = p.line < lines.size()
+            ? lines[p.line].code_point - 1
+            : end.code_point;
+        if (code_point > last_code_point) {
+            throw std::out_of_range("line index position out of range");
+        }
+        const mark_type *from = &line;
+        std::size_t line_end = p.line < lines.size() ? lines[p.line].offset
+                                                     : end.offset;
+        if (line_end - line.offset > checkpoint_interval) {
+            auto checkpoint = std::upper_bound(
+                checkpoints.begin(), checkpoints.end(), code_point,
+                [](std::size_t code_point, const mark_type &m) {
+                    return code_point < m.code_point;
+                }) - 1;
+            if (checkpoint->offset > line.offset) {
+                from = &*checkpoint;
+            }
+        }
+        return text_detail::advance_code_points(
+            ET{}, text_detail::adl_begin(tv.base()), end.offset, *from,
+            code_point - from->code_point);
+    }
+
+private:
+    using mark_type = text_detail::line_mark<typename ET::state_type>;
+
+    static constexpr std::size_t checkpoint_interval =
+        text_detail::line_index_checkpoint_interval;
+
+    line_separators separators;
+    mark_type end;
+    std::vector<mark_type> lines;
+    std::vector<mark_type> checkpoints;
+};
+
+
+/*
+ * make_line_index
+ */
+// Returns an index of the lines of the text view 'tv', which end with the
+// line separators 'separators'.
+template<TextView TVT>
+requires origin::Random_access_iterator<
+             origin::Iterator_type<const typename TVT::range_type>>()
+line_index<encoding_type_t<TVT>> make_line_index(
+    const TVT &tv,
+    line_separators separators = line_separators::newline)
+{
+    return line_index<encoding_type_t<TVT>>{tv, separators};
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_LINE_INDEX_HPP
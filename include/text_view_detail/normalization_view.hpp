@@ -0,0 +1,567 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_NORMALIZATION_VIEW_HPP) // {
+#define TEXT_VIEW_NORMALIZATION_VIEW_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/charsets.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/unicode/unicode_trie.hpp>
+#include <text_view_detail/unicode/normalization_tables.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+/*
+ * Normalization forms
+ * The Unicode normalization forms defined by UAX #15.
+ */
+enum class normalization_form {
+    nfc,
+    nfd,
+    nfkc,
+    nfkd
+};
+
+/*
+ * Quick check results
+ * The result of a normalization quick check (UAX #15); 'maybe' indicates that
+ * the text must be normalized to determine whether it is already normalized.
+ */
+enum class quick_check_result {
+    yes,
+    no,
+    maybe
+};
+
+
+namespace text_detail {
+
+// Returns the normalization_property_table entry for 'cp'; the canonical
+// combining class and quick check flags.  Code points below U+00A0 have
+// neither decompositions nor a non-zero combining class.
+inline unsigned short
+normalization_properties(char32_t cp) noexcept {
+    if (cp < 0xA0) {
+        return 0;
+    }
+    return trie_lookup<normalization_property_table>(cp);
+}
+
+constexpr unsigned char
+canonical_combining_class(unsigned short properties) noexcept {
+    return properties & 0xFF;
+}
+
+// Returns the quick check flags of 'properties' that indicate that a code
+// point does not, or may not, occur in text in normalization form 'nf'.
+constexpr unsigned char
+quick_check_flags(normalization_form nf, unsigned short properties) noexcept {
+    return (properties >> normalization_property_table::quick_check_shift) &
+        (nf == normalization_form::nfd
+         ? normalization_property_table::nfd_no
+         : nf == normalization_form::nfkd
+         ? normalization_property_table::nfkd_no
+         : nf == normalization_form::nfc
+         ? normalization_property_table::nfc_no |
+           normalization_property_table::nfc_maybe
+         : normalization_property_table::nfkc_no |
+           normalization_property_table::nfkc_maybe);
+}
+
+constexpr bool
+is_quick_check_maybe(unsigned char flags) noexcept {
+    return flags & (normalization_property_table::nfc_maybe |
+                    normalization_property_table::nfkc_maybe);
+}
+
+constexpr bool is_compatibility_form(normalization_form nf) noexcept {
+    return nf == normalization_form::nfkc || nf == normalization_form::nfkd;
+}
+
+constexpr bool is_composition_form(normalization_form nf) noexcept {
+    return nf == normalization_form::nfc || nf == normalization_form::nfkc;
+}
+
+/*
+ * Hangul syllables
+ * Hangul syllables are decomposed into, and composed from, their conjoining
+ * jamo arithmetically as specified in section 3.12 of the Unicode Standard.
+ */
+struct hangul {
+    static constexpr char32_t s_base = 0xAC00;
+    static constexpr char32_t l_base = 0x1100;
+    static constexpr char32_t v_base = 0x1161;
+    static constexpr char32_t t_base = 0x11A7;
+    static constexpr char32_t l_count = 19;
+    static constexpr char32_t v_count = 21;
+    static constexpr char32_t t_count = 28;
+    static constexpr char32_t n_count = v_count * t_count;
+    static constexpr char32_t s_count = l_count * n_count;
+};
+
+// Appends the full canonical, or if 'compatibility' is true, compatibility
+// decomposition of 'cp' to 'out'.  'properties' is the
+// normalization_property_table entry for 'cp'.
+inline void
+decompose(
+    char32_t cp,
+    unsigned short properties,
+    bool compatibility,
+    std::u32string &out)
+{
+    if (cp - hangul::s_base < hangul::s_count) {
+        char32_t s = cp - hangul::s_base;
+        out += hangul::l_base + s / hangul::n_count;
+        out += hangul::v_base + s % hangul::n_count / hangul::t_count;
+        if (s % hangul::t_count) {
+            out += hangul::t_base + s % hangul::t_count;
+        }
+        return;
+    }
+    if (! quick_check_flags(normalization_form::nfkd, properties)) {
+        out += cp;
+        return;
+    }
+    const char32_t *mapping = decomposition_table::mappings +
+        trie_lookup<decomposition_table>(cp);
+    std::size_t canonical_length = mapping[0] & 0xFF;
+    std::size_t compatibility_length = mapping[0] >> 8;
+    if (compatibility && compatibility_length) {
+        out.append(mapping + 1 + canonical_length, compatibility_length);
+    } else if (canonical_length) {
+        out.append(mapping + 1, canonical_length);
+    } else {
+        out += cp;
+    }
+}
+
+// Sorts each run of code points with a non-zero combining class in 's' by
+// combining class, preserving the order of code points with the same
+// combining class (the Canonical Ordering Algorithm).
+inline void
+canonical_order(std::u32string &s) {
+    for (std::size_t i = 1; i < s.size(); ++i) {
+        unsigned char ccc =
+            canonical_combining_class(normalization_properties(s[i]));
+        if (ccc == 0) {
+            continue;
+        }
+        std::size_t j = i;
+        char32_t cp = s[i];
+        for (; j > 0; --j) {
+            unsigned char previous_ccc =
+                canonical_combining_class(normalization_properties(s[j - 1]));
+            if (previous_ccc <= ccc) {
+                break;
+            }
+            s[j] = s[j - 1];
+        }
+        s[j] = cp;
+    }
+}
+
+// Returns the primary composite of 'first' and 'second', or zero if there is
+// none.
+inline char32_t
+compose(char32_t first, char32_t second) noexcept {
+    if (first - hangul::l_base < hangul::l_count
+        && second - hangul::v_base < hangul::v_count)
+    {
+        return hangul::s_base +
+            ((first - hangul::l_base) * hangul::v_count +
+             (second - hangul::v_base)) * hangul::t_count;
+    }
+    if (first - hangul::s_base < hangul::s_count
+        && (first - hangul::s_base) % hangul::t_count == 0
+        && second - hangul::t_base - 1 < hangul::t_count - 1)
+    {
+        return first + (second - hangul::t_base);
+    }
+    using composition = composition_table::composition;
+    const composition *begin = std::begin(composition_table::compositions);
+    const composition *end = std::end(composition_table::compositions);
+    const composition *it = std::lower_bound(
+        begin, end, composition{first, second, 0},
+        [](const composition &l, const composition &r) {
+            return l.first < r.first
+                || (l.first == r.first && l.second < r.second);
+        });
+    if (it != end && it->first == first && it->second == second) {
+        return it->composite;
+    }
+    return 0;
+}
+
+// Composes the canonically decomposed and ordered code points of 's' in
+// place (the Canonical Composition Algorithm).
+inline void
+canonical_compose(std::u32string &s) {
+    if (s.empty()) {
+        return;
+    }
+    std::size_t starter = 0;
+    unsigned last_ccc =
+        canonical_combining_class(normalization_properties(s[0]));
+    if (last_ccc != 0) {
+        // No preceding starter; nothing that follows may compose with it.
+        last_ccc = 256;
+    }
+    std::size_t length = 1;
+    for (std::size_t i = 1; i < s.size(); ++i) {
+        char32_t cp = s[i];
+        unsigned ccc = canonical_combining_class(normalization_properties(cp));
+        char32_t composite = 0;
+        if (last_ccc < ccc || last_ccc == 0) {
+            composite = compose(s[starter], cp);
+        }
+        if (composite) {
+            s[starter] = composite;
+        } else {
+            if (ccc == 0) {
+                starter = length;
+            }
+            last_ccc = ccc;
+            s[length++] = cp;
+        }
+    }
+    s.resize(length);
+}
+
+// Replaces the code points of 's' with their normalization in form 'nf'.
+// 'scratch' is storage for intermediate results.
+inline void
+normalize(normalization_form nf, std::u32string &s, std::u32string &scratch) {
+    scratch.clear();
+    for (char32_t cp : s) {
+        decompose(cp, normalization_properties(cp),
+                  is_compatibility_form(nf), scratch);
+    }
+    canonical_order(scratch);
+    if (is_composition_form(nf)) {
+        canonical_compose(scratch);
+    }
+    s.swap(scratch);
+}
+
+// Locates the normalization segment that begins at 'first' and advances
+// 'first' to the character that follows it.  A segment ends before a starter
+// that is unaffected by normalization in form 'NF' and that does not compose
+// with the characters that precede it, so segments are normalized
+// independently.  Returns the first code point of the normalized segment and
+// sets 's' to the code points that follow it.  A segment that passes the
+// quick check for 'NF' is not normalized; its code points are used unchanged.
+template<normalization_form NF, typename TIT, typename TST>
+char32_t next_normalization_segment(
+    TIT &first,
+    TST last,
+    std::u32string &s,
+    std::u32string &scratch)
+{
+    s.clear();
+    char32_t first_cp = (*first).get_code_point();
+    unsigned short properties = normalization_properties(first_cp);
+    bool normalized = ! quick_check_flags(NF, properties);
+    unsigned char last_ccc = canonical_combining_class(properties);
+    for (++first; first != last; ++first) {
+        char32_t cp = (*first).get_code_point();
+        properties = normalization_properties(cp);
+        unsigned char ccc = canonical_combining_class(properties);
+        unsigned char flags = quick_check_flags(NF, properties);
+        if (ccc == 0 && ! flags) {
+            break;
+        }
+        if (flags || (ccc != 0 && last_ccc > ccc)) {
+            normalized = false;
+        }
+        last_ccc = ccc;
+        s += cp;
+    }
+    if (! normalized) {
+        s.insert(s.begin(), first_cp);
+        normalize(NF, s, scratch);
+        first_cp = s[0];
+        s.erase(s.begin());
+    }
+    return first_cp;
+}
+
+} // namespace text_detail
+
+
+/*
+ * normalization_view
+ * A view adapter over a text view that presents the characters of the
+ * normalization of the underlying text in normalization form 'NF' (UAX #15).
+ * Normalization is performed lazily, one segment at a time, as the view is
+ * iterated; a segment spans a starter and the characters that follow it up to
+ * the next character that can neither reorder nor compose with them, and is
+ * held in a buffer in the iterator.  Segments that pass the quick check for
+ * 'NF' are presented unchanged without being decomposed, and for most text
+ * consist of a single character, so iterating text that is already
+ * normalized performs no allocations.  The underlying text view must provide
+ * forward iterators and its characters must have Unicode code points.
+ */
+template<normalization_form NF, TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+class normalization_view {
+public:
+    using view_type = TVT;
+    using text_iterator = origin::Iterator_type<const view_type>;
+    using text_sentinel = origin::Sentinel_type<const view_type>;
+    using character_type = character<unicode_character_set>;
+
+    class sentinel;
+
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = character_type;
+        using reference = value_type;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        iterator(text_iterator first, text_sentinel last)
+        :
+            first{first}, next{first}, last{last}
+        {
+            // Locating the first segment through operator++ keeps a single
+            // call site for next_normalization_segment, which allows it to
+            // be inlined into the loop that advances the iterator.
+            ++*this;
+        }
+
+        reference operator*() const {
+            return character_type{code_point};
+        }
+
+        iterator& operator++() {
+            if (index < segment.size()) {
+                code_point = segment[index++];
+            } else {
+                first = next;
+                index = 0;
+                if (first != last) {
+                    code_point = text_detail::next_normalization_segment<NF>(
+                        next, last, segment, scratch);
+                }
+            }
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator it{*this};
+            ++*this;
+            return it;
+        }
+
+        // Returns an iterator to the first character of the current
+        // normalization segment in the underlying text view.
+        text_iterator base() const {
+            return first;
+        }
+
+        friend bool operator==(const iterator &l, const iterator &r) {
+            return l.first == r.first && l.index == r.index;
+        }
+        friend bool operator!=(const iterator &l, const iterator &r) {
+            return !(l == r);
+        }
+
+    private:
+        text_iterator first;
+        text_iterator next;
+        text_sentinel last;
+        // The current code point, and the code points of the current
+        // normalization segment that follow the first.
+        char32_t code_point = 0;
+        std::u32string segment;
+        std::u32string scratch;
+        std::size_t index = 0;
+    };
+
+    class sentinel {
+    public:
+        sentinel() = default;
+
+        explicit sentinel(text_sentinel last)
+            : last{last} {}
+
+        text_sentinel base() const {
+            return last;
+        }
+
+        friend bool operator==(const iterator &it, const sentinel &s) {
+            return it.base() == s.base();
+        }
+        friend bool operator!=(const iterator &it, const sentinel &s) {
+            return !(it == s);
+        }
+        friend bool operator==(const sentinel &s, const iterator &it) {
+            return it == s;
+        }
+        friend bool operator!=(const sentinel &s, const iterator &it) {
+            return !(it == s);
+        }
+
+    private:
+        text_sentinel last;
+    };
+
+    normalization_view() = default;
+
+    explicit normalization_view(view_type tv)
+        : tv{tv} {}
+
+    const view_type& base() const noexcept {
+        return tv;
+    }
+
+    iterator begin() const {
+        return iterator{text_detail::adl_begin(tv), text_detail::adl_end(tv)};
+    }
+    sentinel end() const {
+        return sentinel{text_detail::adl_end(tv)};
+    }
+
+private:
+    view_type tv;
+};
+
+
+/*
+ * make_normalization_view
+ */
+// Constructs a view of the normalization of an existing text view in
+// normalization form 'NF'.
+template<normalization_form NF, TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_normalization_view(
+    TVT tv)
+{
+    return normalization_view<NF, TVT>{tv};
+}
+
+// Constructs a view of the normalization of an existing text view in
+// normalization form C.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_nfc_view(
+    TVT tv)
+{
+    return normalization_view<normalization_form::nfc, TVT>{tv};
+}
+
+// Constructs a view of the normalization of an existing text view in
+// normalization form D.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_nfd_view(
+    TVT tv)
+{
+    return normalization_view<normalization_form::nfd, TVT>{tv};
+}
+
+// Constructs a view of the normalization of an existing text view in
+// normalization form KC.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_nfkc_view(
+    TVT tv)
+{
+    return normalization_view<normalization_form::nfkc, TVT>{tv};
+}
+
+// Constructs a view of the normalization of an existing text view in
+// normalization form KD.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_nfkd_view(
+    TVT tv)
+{
+    return normalization_view<normalization_form::nfkd, TVT>{tv};
+}
+
+
+/*
+ * quick_check
+ */
+// Performs the normalization quick check of UAX #15 for normalization form
+// 'NF' on the characters of a text view.  The scan stops at the first
+// character that shows that the text is not normalized.
+template<normalization_form NF, TextView TVT>
+quick_check_result quick_check(
+    const TVT &tv)
+{
+    quick_check_result result = quick_check_result::yes;
+    unsigned char last_ccc = 0;
+    for (auto c : tv) {
+        unsigned short properties =
+            text_detail::normalization_properties(c.get_code_point());
+        unsigned char ccc = text_detail::canonical_combining_class(properties);
+        if (ccc != 0 && last_ccc > ccc) {
+            return quick_check_result::no;
+        }
+        unsigned char flags = text_detail::quick_check_flags(NF, properties);
+        if (text_detail::is_quick_check_maybe(flags)) {
+            result = quick_check_result::maybe;
+        } else if (flags) {
+            return quick_check_result::no;
+        }
+        last_ccc = ccc;
+    }
+    return result;
+}
+
+
+/*
+ * is_normalized
+ */
+// Returns true if the characters of a text view are in normalization form
+// 'NF'.  The text is normalized for comparison only if the quick check is
+// inconclusive; for the common case of text that passes the quick check, the
+// text view may be used as is without normalization or allocation.
+template<normalization_form NF, TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+bool is_normalized(
+    const TVT &tv)
+{
+    quick_check_result result = quick_check<NF>(tv);
+    if (result != quick_check_result::maybe) {
+        return result == quick_check_result::yes;
+    }
+    auto nv = make_normalization_view<NF>(tv);
+    auto nv_it = nv.begin();
+    auto nv_end = nv.end();
+    auto tv_it = text_detail::adl_begin(tv);
+    auto tv_end = text_detail::adl_end(tv);
+    for (; nv_it != nv_end && tv_it != tv_end; ++nv_it, ++tv_it) {
+        if ((*nv_it).get_code_point() != (*tv_it).get_code_point()) {
+            return false;
+        }
+    }
+    return nv_it == nv_end && tv_it == tv_end;
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_NORMALIZATION_VIEW_HPP
@@ -0,0 +1,1588 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_REGEX_HPP) // {
+#define TEXT_VIEW_REGEX_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/encodings.hpp>
+#include <text_view_detail/exceptions.hpp>
+#include <text_view_detail/text_hash.hpp>
+#include <text_view_detail/text_view.hpp>
+#include <text_view_detail/unicode_properties.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+class text_regex;
+
+
+namespace text_detail {
+
+// A sequence of disjoint, ordered, and non-adjacent ranges of code points
+// (or code units), each given as its first and last member.
+using code_point_ranges = std::vector<std::pair<char32_t, char32_t>>;
+
+constexpr char32_t max_code_point = 0x10FFFF;
+
+// Sorts 'ranges' and merges ranges that overlap or are adjacent.
+inline void merge_ranges(code_point_ranges &ranges) {
+    std::sort(ranges.begin(), ranges.end());
+    std::size_t n = 0;
+    for (const auto &range : ranges) {
+        if (n && range.first <= ranges[n - 1].second + 1) {
+            ranges[n - 1].second = std::max(ranges[n - 1].second,
+                                            range.second);
+        } else {
+            ranges[n++] = range;
+        }
+    }
+    ranges.resize(n);
+}
+
+// Returns the code points that are not in the merged ranges 'ranges'.
+inline code_point_ranges complement_ranges(const code_point_ranges &ranges) {
+    code_point_ranges complement;
+    char32_t next = 0;
+    for (const auto &range : ranges) {
+        if (range.first > next) {
+            complement.emplace_back(next, range.first - 1);
+        }
+        next = range.second + 1;
+    }
+    if (next <= max_code_point) {
+        complement.emplace_back(next, max_code_point);
+    }
+    return complement;
+}
+
+// Returns the ranges of code points whose properties satisfy 'predicate'.
+// Planes 4 through 13 contain no assigned code points, so their properties
+// are tested once.
+template<typename P>
+code_point_ranges property_ranges(P predicate) {
+    code_point_ranges ranges;
+    auto add = [&ranges](char32_t first, char32_t last) {
+        if (! ranges.empty() && ranges.back().second + 1 == first) {
+            ranges.back().second = last;
+        } else {
+            ranges.emplace_back(first, last);
+        }
+    };
+    for (char32_t cp = 0; cp <= max_code_point; ++cp) {
+        if (cp == 0x40000) {
+            if (predicate(get_unicode_properties(cp))) {
+                add(0x40000, 0xDFFFF);
+            }
+            cp = 0xDFFFF;
+        } else if (predicate(get_unicode_properties(cp))) {
+            add(cp, cp);
+        }
+    }
+    return ranges;
+}
+
+// Returns 'name' without case distinctions, spaces, hyphens, or underscores,
+// for loose matching of property and property value names (UAX #44 LM3).
+inline std::string loose_property_name(const std::string &name) {
+    std::string loose;
+    for (char c : name) {
+        if (c >= 'A' && c <= 'Z') {
+            loose += char(c + ('a' - 'A'));
+        } else if (c != ' ' && c != '-' && c != '_') {
+            loose += c;
+        }
+    }
+    return loose;
+}
+
+/*
+ * Unicode property classes
+ * The code points named by the property expressions of \p{...} and \P{...}:
+ * a General_Category value or group, a Script value, a binary property, Any,
+ * ASCII, or Assigned, optionally qualified by gc=, general_category=, sc=,
+ * or script=.  The code points of each expression are computed once by
+ * testing the properties of every code point and are shared by all patterns.
+ */
+class unicode_property_classes {
+public:
+    // Returns the code points named by the property expression 'name', or
+    // nullptr if 'name' does not name a supported property or value.
+    static const code_point_ranges *find(const std::string &name) {
+        static std::mutex mutex;
+        static std::map<std::string, code_point_ranges> classes;
+        std::string loose = loose_property_name(name);
+        std::lock_guard<std::mutex> lock{mutex};
+        auto it = classes.find(loose);
+        if (it == classes.end()) {
+            code_point_ranges ranges;
+            if (! compute(loose, ranges)) {
+                return nullptr;
+            }
+            it = classes.emplace(loose, std::move(ranges)).first;
+        }
+        return &it->second;
+    }
+
+private:
+    using table_type = unicode_property_table;
+
+    static bool compute(const std::string &name, code_point_ranges &ranges) {
+        std::string::size_type equals = name.find('=');
+        std::string property = equals == std::string::npos
+                             ? std::string{} : name.substr(0, equals);
+        std::string value = equals == std::string::npos
+                          ? name : name.substr(equals + 1);
+        bool any_property = equals == std::string::npos;
+        if (any_property || property == "gc"
+            || property == "generalcategory")
+        {
+            unsigned long categories = general_category_mask(value);
+            if (categories) {
+                ranges = property_ranges([categories](unicode_properties p) {
+                    return categories >> unsigned(p.get_general_category())
+                           & 1;
+                });
+                return true;
+            }
+        }
+        if (any_property || property == "sc" || property == "script") {
+            const auto &names = table_type::script_names;
+            for (std::size_t i = 0; i < std::size(names); ++i) {
+                if (loose_property_name(names[i]) == value) {
+                    script sc = static_cast<script>(i);
+                    ranges = property_ranges([sc](unicode_properties p) {
+                        return p.get_script() == sc;
+                    });
+                    return true;
+                }
+            }
+        }
+        if (! any_property) {
+            return false;
+        }
+        bool (unicode_properties::*binary)() const noexcept =
+            value == "alphabetic" || value == "alpha"
+            ? &unicode_properties::is_alphabetic
+            : value == "lowercase" || value == "lower"
+            ? &unicode_properties::is_lowercase
+            : value == "uppercase" || value == "upper"
+            ? &unicode_properties::is_uppercase
+            : value == "whitespace" || value == "wspace" || value == "space"
+            ? &unicode_properties::is_white_space
+            : value == "math"
+            ? &unicode_properties::is_math
+            : value == "defaultignorablecodepoint" || value == "di"
+            ? &unicode_properties::is_default_ignorable
+            : nullptr;
+        if (binary) {
+            ranges = property_ranges([binary](unicode_properties p) {
+                return (p.*binary)();
+            });
+        } else if (value == "any") {
+            ranges.emplace_back(0, max_code_point);
+        } else if (value == "ascii") {
+            ranges.emplace_back(0, 0x7F);
+        } else if (value == "assigned") {
+            ranges = property_ranges([](unicode_properties p) {
+                return p.get_general_category() != general_category::cn;
+            });
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    // Returns a mask with a bit set for each General_Category value named by
+    // the loosely matched short or long alias 'value' of a value or group, or
+    // zero if there is none.
+    static unsigned long general_category_mask(const std::string &value) {
+        static constexpr const char *long_names[] = {
+            "unassigned", "uppercaseletter", "lowercaseletter",
+            "titlecaseletter", "modifierletter", "otherletter",
+            "nonspacingmark", "spacingmark", "enclosingmark",
+            "decimalnumber", "letternumber", "othernumber",
+            "connectorpunctuation", "dashpunctuation", "openpunctuation",
+            "closepunctuation", "initialpunctuation", "finalpunctuation",
+            "otherpunctuation", "mathsymbol", "currencysymbol",
+            "modifiersymbol", "othersymbol", "spaceseparator",
+            "lineseparator", "paragraphseparator", "control", "format",
+            "surrogate", "privateuse",
+        };
+        static constexpr struct {
+            const char *short_name;
+            const char *long_name;
+        } groups[] = {
+            { "l", "letter" }, { "m", "mark" }, { "n", "number" },
+            { "p", "punctuation" }, { "s", "symbol" }, { "z", "separator" },
+            { "c", "other" },
+        };
+        const auto &short_names = table_type::general_category_names;
+        static_assert(std::size(long_names) == std::size(short_names),
+                      "a long name is required for each general category");
+        unsigned long mask = 0;
+        for (std::size_t i = 0; i < std::size(short_names); ++i) {
+            if (loose_property_name(short_names[i]) == value
+                || long_names[i] == value)
+            {
+                mask |= 1UL << i;
+            }
+        }
+        if (value == "lc" || value == "casedletter") {
+            mask = general_category_mask("lu") | general_category_mask("ll")
+                 | general_category_mask("lt");
+        }
+        for (const auto &group : groups) {
+            if (value == group.short_name || value == group.long_name) {
+                for (std::size_t i = 0; i < std::size(short_names); ++i) {
+                    if (short_names[i][0] - 'A' + 'a' == group.short_name[0]) {
+                        mask |= 1UL << i;
+                    }
+                }
+            }
+        }
+        return mask;
+    }
+};
+
+/*
+ * regex_node
+ * A node of the syntax tree of a regular expression.  Nodes are stored in a
+ * vector and refer to their children by index.
+ */
+struct regex_node {
+    enum kind_type {
+        empty,
+        ranges,
+        concatenation,
+        alternation,
+        repetition,
+        text_begin,
+        text_end
+    };
+
+    kind_type kind;
+    code_point_ranges set;
+    std::vector<std::size_t> children;
+    // The minimum and maximum number of repetitions; a maximum less than
+    // zero denotes no maximum.
+    int min = 0;
+    int max = 0;
+};
+
+/*
+ * regex_parser
+ * A recursive descent parser for the regular expression syntax of
+ * text_regex, which is described in README.md.  Errors are reported by
+ * throwing text_regex_error.
+ */
+class regex_parser {
+public:
+    static constexpr int max_repetitions = 1000;
+
+    regex_parser(
+        const std::u32string &pattern,
+        std::vector<regex_node> &nodes)
+    :
+        pattern(pattern), nodes(nodes)
+    {}
+
+    // Parses the pattern and returns the index of the root node.
+    std::size_t parse() {
+        std::size_t root = parse_alternation();
+        if (! at_end()) {
+            error("unmatched ')'");
+        }
+        return root;
+    }
+
+private:
+    [[noreturn]] void error(const char *message) const {
+        throw text_regex_error{
+            std::string{"invalid regular expression: "} + message
+            + " at offset " + std::to_string(position)};
+    }
+
+    bool at_end() const {
+        return position == pattern.size();
+    }
+
+    char32_t peek() const {
+        return pattern[position];
+    }
+
+    bool consume(char32_t c) {
+        if (! at_end() && peek() == c) {
+            ++position;
+            return true;
+        }
+        return false;
+    }
+
+    std::size_t add_node(regex_node node) {
+        nodes.push_back(std::move(node));
+        return nodes.size() - 1;
+    }
+
+    std::size_t add_set(code_point_ranges set) {
+        regex_node node{regex_node::ranges};
+        node.set = std::move(set);
+        return add_node(std::move(node));
+    }
+
+    std::size_t parse_alternation() {
+        std::size_t first = parse_concatenation();
+        if (at_end() || peek() != U'|') {
+            return first;
+        }
+        regex_node node{regex_node::alternation};
+        node.children.push_back(first);
+        while (consume(U'|')) {
+            node.children.push_back(parse_concatenation());
+        }
+        return add_node(std::move(node));
+    }
+
+    std::size_t parse_concatenation() {
+        regex_node node{regex_node::concatenation};
+        while (! at_end() && peek() != U'|' && peek() != U')') {
+            node.children.push_back(parse_repetition());
+        }
+        if (node.children.empty()) {
+            return add_node(regex_node{regex_node::empty});
+        }
+        if (node.children.size() == 1) {
+            return node.children[0];
+        }
+        return add_node(std::move(node));
+    }
+
+    std::size_t parse_repetition() {
+        std::size_t atom = parse_atom();
+        while (! at_end()) {
+            int min, max;
+            if (consume(U'*')) {
+                min = 0;
+                max = -1;
+            } else if (consume(U'+')) {
+                min = 1;
+                max = -1;
+            } else if (consume(U'?')) {
+                min = 0;
+                max = 1;
+            } else if (consume(U'{')) {
+                min = parse_count();
+                max = min;
+                if (consume(U',')) {
+                    max = ! at_end() && peek() == U'}' ? -1 : parse_count();
+                }
+                if (! consume(U'}')) {
+                    error("expected '}'");
+                }
+                if (max >= 0 && max < min) {
+                    error("invalid repetition count");
+                }
+            } else {
+                break;
+            }
+            if (! at_end() && peek() == U'?') {
+                error("lazy quantifiers are not supported");
+            }
+            regex_node node{regex_node::repetition};
+            node.children.push_back(atom);
+            node.min = min;
+            node.max = max;
+            atom = add_node(std::move(node));
+        }
+        return atom;
+    }
+
+    int parse_count() {
+        int count = 0;
+        bool digits = false;
+        while (! at_end() && peek() >= U'0' && peek() <= U'9') {
+            count = count * 10 + int(pattern[position++] - U'0');
+            if (count > max_repetitions) {
+                error("repetition count is too large");
+            }
+            digits = true;
+        }
+        if (! digits) {
+            error("expected a repetition count");
+        }
+        return count;
+    }
+
+    std::size_t parse_atom() {
+        char32_t c = pattern[position++];
+        switch (c) {
+        case U'(': {
+            if (consume(U'?') && ! consume(U':')) {
+                error("unsupported group");
+            }
+            std::size_t group = parse_alternation();
+            if (! consume(U')')) {
+                error("expected ')'");
+            }
+            return group;
+        }
+        case U'[':
+            return add_set(parse_class());
+        case U'.':
+            return add_set(code_point_ranges{
+                {0, U'\n' - 1}, {U'\n' + 1, max_code_point}});
+        case U'^':
+            return add_node(regex_node{regex_node::text_begin});
+        case U'$':
+            return add_node(regex_node{regex_node::text_end});
+        case U'\\': {
+            code_point_ranges set;
+            parse_escape(set);
+            return add_set(std::move(set));
+        }
+        case U'*':
+        case U'+':
+        case U'?':
+        case U'{':
+            --position;
+            error("nothing to repeat");
+        default:
+            return add_set(code_point_ranges{{c, c}});
+        }
+    }
+
+    // Parses a bracket expression that follows '['.
+    code_point_ranges parse_class() {
+        code_point_ranges set;
+        bool negated = consume(U'^');
+        bool first = true;
+        while (at_end() || peek() != U']' || first) {
+            if (at_end()) {
+                error("expected ']'");
+            }
+            first = false;
+            char32_t low;
+            if (consume(U'\\')) {
+                code_point_ranges escaped;
+                if (! parse_escape(escaped)) {
+                    set.insert(set.end(), escaped.begin(), escaped.end());
+                    continue;
+                }
+                low = escaped[0].first;
+            } else {
+                low = pattern[position++];
+            }
+            char32_t high = low;
+            if (position + 1 < pattern.size() && peek() == U'-'
+                && pattern[position + 1] != U']')
+            {
+                ++position;
+                if (consume(U'\\')) {
+                    code_point_ranges escaped;
+                    if (! parse_escape(escaped)) {
+                        error("invalid range in character class");
+                    }
+                    high = escaped[0].first;
+                } else {
+                    high = pattern[position++];
+                }
+                if (high < low) {
+                    error("invalid range in character class");
+                }
+            }
+            set.emplace_back(low, high);
+        }
+        ++position;
+        merge_ranges(set);
+        return negated ? complement_ranges(set) : set;
+    }
+
+    // Parses an escape sequence that follows '\' and appends the code points
+    // it matches to 'set'.  Returns true if it denotes a single code point.
+    bool parse_escape(code_point_ranges &set) {
+        if (at_end()) {
+            error("incomplete escape sequence");
+        }
+        char32_t c = pattern[position++];
+        switch (c) {
+        case U'd':
+        case U'D':
+            return append_class(set, "gc=nd", c == U'D');
+        case U's':
+        case U'S':
+            return append_class(set, "whitespace", c == U'S');
+        case U'w':
+        case U'W': {
+            // Word characters as defined by UTS #18 annex C, without
+            // Join_Control.
+            code_point_ranges word;
+            append_class(word, "alphabetic", false);
+            append_class(word, "gc=m", false);
+            append_class(word, "gc=nd", false);
+            append_class(word, "gc=pc", false);
+            merge_ranges(word);
+            if (c == U'W') {
+                word = complement_ranges(word);
+            }
+            set.insert(set.end(), word.begin(), word.end());
+            return false;
+        }
+        case U'p':
+        case U'P': {
+            std::string name;
+            if (consume(U'{')) {
+                while (! consume(U'}')) {
+                    if (at_end() || peek() >= 0x80) {
+                        error("invalid property name");
+                    }
+                    name += char(pattern[position++]);
+                }
+            } else if (! at_end() && peek() < 0x80) {
+                name += char(pattern[position++]);
+            } else {
+                error("invalid property name");
+            }
+            return append_class(set, name, c == U'P');
+        }
+        case U'x':
+        case U'u':
+            return append_code_point(set, parse_hex(c == U'u' ? 4 : 2));
+        case U'n':
+            return append_code_point(set, U'\n');
+        case U'r':
+            return append_code_point(set, U'\r');
+        case U't':
+            return append_code_point(set, U'\t');
+        case U'f':
+            return append_code_point(set, U'\f');
+        case U'v':
+            return append_code_point(set, U'\v');
+        case U'a':
+            return append_code_point(set, U'\a');
+        case U'e':
+            return append_code_point(set, 0x1B);
+        default:
+            if ((c | 0x20) - U'a' < 26 || c - U'0' < 10) {
+                --position;
+                error("unsupported escape sequence");
+            }
+            return append_code_point(set, c);
+        }
+    }
+
+    // Parses the hexadecimal digits of \xHH, \uHHHH, or \x{H...} and returns
+    // the code point they denote.
+    char32_t parse_hex(int digits) {
+        bool braced = consume(U'{');
+        char32_t cp = 0;
+        int count = 0;
+        while (! at_end() && (braced ? peek() != U'}' : count < digits)) {
+            char32_t c = pattern[position++];
+            char32_t value = c - U'0' < 10 ? c - U'0'
+                           : (c | 0x20) - U'a' < 6 ? (c | 0x20) - U'a' + 10
+                           : 16;
+            if (value == 16 || count == 6) {
+                error("invalid hexadecimal escape sequence");
+            }
+            cp = cp << 4 | value;
+            ++count;
+        }
+        if ((braced && ! consume(U'}')) || count == 0
+            || (! braced && count != digits) || cp > max_code_point)
+        {
+            error("invalid hexadecimal escape sequence");
+        }
+        return cp;
+    }
+
+    static bool append_code_point(code_point_ranges &set, char32_t cp) {
+        set.emplace_back(cp, cp);
+        return true;
+    }
+
+    bool append_class(
+        code_point_ranges &set,
+        const std::string &name,
+        bool negated)
+    {
+        const code_point_ranges *ranges =
+            unicode_property_classes::find(name);
+        if (! ranges) {
+            error("unknown property");
+        }
+        if (negated) {
+            code_point_ranges complement = complement_ranges(*ranges);
+            set.insert(set.end(), complement.begin(), complement.end());
+        } else {
+            set.insert(set.end(), ranges->begin(), ranges->end());
+        }
+        return false;
+    }
+
+    const std::u32string &pattern;
+    std::vector<regex_node> &nodes;
+    std::size_t position = 0;
+};
+
+/*
+ * Regex code units
+ * The code units over which an automaton is built: the octets of UTF-8, the
+ * 16-bit code units of UTF-16, or, for text in other encodings, the code
+ * points of decoded characters.
+ */
+enum class regex_unit {
+    utf8,
+    utf16,
+    code_point
+};
+
+// Calls 'add' with each sequence of ranges of UTF-8 code units that encodes
+// the code points in [first, last], excluding surrogate code points, as an
+// array of ranges and its length.
+template<typename F>
+void utf8_sequences(char32_t first, char32_t last, F &add) {
+    if (first > last) {
+        return;
+    }
+    if (first <= 0xDFFF && last >= 0xD800) {
+        utf8_sequences(first, std::min<char32_t>(last, 0xD7FF), add);
+        utf8_sequences(std::max<char32_t>(first, 0xE000), last, add);
+        return;
+    }
+    for (char32_t boundary : {0x7Fu, 0x7FFu, 0xFFFFu}) {
+        if (first <= boundary && last > boundary) {
+            utf8_sequences(first, boundary, add);
+            utf8_sequences(boundary + 1, last, add);
+            return;
+        }
+    }
+    unsigned char low[4], high[4];
+    int length = encode_utf8(first, low);
+    encode_utf8(last, high);
+    // Split the range until the code points share their leading code units
+    // and each trailing code unit ranges independently over a full range.
+    for (int i = 1; i < length; ++i) {
+        char32_t mask = (char32_t{1} << (6 * i)) - 1;
+        if ((first & ~mask) != (last & ~mask)) {
+            if (first & mask) {
+                utf8_sequences(first, first | mask, add);
+                utf8_sequences((first | mask) + 1, last, add);
+                return;
+            }
+            if ((last & mask) != mask) {
+                utf8_sequences(first, (last & ~mask) - 1, add);
+                utf8_sequences(last & ~mask, last, add);
+                return;
+            }
+        }
+    }
+    std::pair<char32_t, char32_t> sequence[4];
+    for (int i = 0; i < length; ++i) {
+        sequence[i] = {low[i], high[i]};
+    }
+    add(sequence, length);
+}
+
+// Calls 'add' with each sequence of ranges of UTF-16 code units that encodes
+// the code points in [first, last], excluding surrogate code points.
+template<typename F>
+void utf16_sequences(char32_t first, char32_t last, F &add) {
+    if (first > last) {
+        return;
+    }
+    if (first <= 0xDFFF && last >= 0xD800) {
+        utf16_sequences(first, std::min<char32_t>(last, 0xD7FF), add);
+        utf16_sequences(std::max<char32_t>(first, 0xE000), last, add);
+        return;
+    }
+    if (last < 0x10000) {
+        std::pair<char32_t, char32_t> sequence[1] = {{first, last}};
+        add(sequence, 1);
+        return;
+    }
+    if (first < 0x10000) {
+        utf16_sequences(first, 0xFFFF, add);
+        first = 0x10000;
+    }
+    char32_t high_first = 0xD800 + ((first - 0x10000) >> 10);
+    char32_t high_last = 0xD800 + ((last - 0x10000) >> 10);
+    char32_t low_first = 0xDC00 + (first & 0x3FF);
+    char32_t low_last = 0xDC00 + (last & 0x3FF);
+    if (high_first == high_last) {
+        std::pair<char32_t, char32_t> sequence[2] = {
+            {high_first, high_first}, {low_first, low_last}};
+        add(sequence, 2);
+        return;
+    }
+    if (low_first != 0xDC00) {
+        std::pair<char32_t, char32_t> sequence[2] = {
+            {high_first, high_first}, {low_first, 0xDFFF}};
+        add(sequence, 2);
+        ++high_first;
+    }
+    if (low_last != 0xDFFF) {
+        std::pair<char32_t, char32_t> sequence[2] = {
+            {high_last, high_last}, {0xDC00, low_last}};
+        add(sequence, 2);
+        --high_last;
+    }
+    if (high_first <= high_last) {
+        std::pair<char32_t, char32_t> sequence[2] = {
+            {high_first, high_last}, {0xDC00, 0xDFFF}};
+        add(sequence, 2);
+    }
+}
+
+/*
+ * regex_nfa
+ * A Thompson NFA over code units.  A state either has transitions on ranges
+ * of code units, is an epsilon state with one or two successors ('out' and
+ * 'out1'), asserts that it is at the beginning or end of the text, or is the
+ * match state.
+ */
+struct regex_nfa {
+    static constexpr std::size_t max_states = 1 << 20;
+
+    struct transition {
+        char32_t first;
+        char32_t last;
+        int target;
+    };
+
+    struct state {
+        enum kind_type {
+            code_units,
+            epsilon,
+            text_begin,
+            text_end,
+            match
+        };
+
+        kind_type kind;
+        std::vector<transition> transitions;
+        int out = -1;
+        int out1 = -1;
+    };
+
+    std::vector<state> states;
+    int start;
+};
+
+/*
+ * regex_compiler
+ * Compiles a syntax tree to a regex_nfa over the code units 'unit'.  Each
+ * fragment of the NFA has a start state and an exit state whose 'out'
+ * successor is set when the fragment is joined to the fragment that follows.
+ * A set of code points becomes a trie of the code unit sequences that encode
+ * them.
+ */
+class regex_compiler {
+public:
+    regex_compiler(
+        const std::vector<regex_node> &nodes,
+        regex_unit unit,
+        regex_nfa &nfa)
+    :
+        nodes(nodes), unit(unit), nfa(nfa)
+    {}
+
+    void compile(std::size_t root) {
+        fragment f = compile_node(root);
+        nfa.states[f.exit].out = add_state(regex_nfa::state::match);
+        nfa.start = f.start;
+    }
+
+private:
+    struct fragment {
+        int start;
+        int exit;
+    };
+
+    int add_state(regex_nfa::state::kind_type kind) {
+        if (nfa.states.size() == regex_nfa::max_states) {
+            throw text_regex_error{
+                "invalid regular expression: pattern is too large"};
+        }
+        nfa.states.push_back(regex_nfa::state{kind});
+        return int(nfa.states.size() - 1);
+    }
+
+    fragment compile_node(std::size_t index) {
+        const regex_node &node = nodes[index];
+        switch (node.kind) {
+        case regex_node::ranges:
+            return compile_set(node.set);
+        case regex_node::concatenation: {
+            fragment f = compile_node(node.children[0]);
+            for (std::size_t i = 1; i < node.children.size(); ++i) {
+                fragment next = compile_node(node.children[i]);
+                nfa.states[f.exit].out = next.start;
+                f.exit = next.exit;
+            }
+            return f;
+        }
+        case regex_node::alternation: {
+            int exit = add_state(regex_nfa::state::epsilon);
+            fragment f = compile_node(node.children.back());
+            nfa.states[f.exit].out = exit;
+            int start = f.start;
+            for (std::size_t i = node.children.size() - 1; i-- > 0; ) {
+                f = compile_node(node.children[i]);
+                nfa.states[f.exit].out = exit;
+                int split = add_state(regex_nfa::state::epsilon);
+                nfa.states[split].out = f.start;
+                nfa.states[split].out1 = start;
+                start = split;
+            }
+            return {start, exit};
+        }
+        case regex_node::repetition:
+            return compile_repetition(node);
+        case regex_node::text_begin: {
+            int state = add_state(regex_nfa::state::text_begin);
+            return {state, state};
+        }
+        case regex_node::text_end: {
+            int state = add_state(regex_nfa::state::text_end);
+            return {state, state};
+        }
+        case regex_node::empty:
+        default: {
+            int state = add_state(regex_nfa::state::epsilon);
+            return {state, state};
+        }
+        }
+    }
+
+    fragment compile_repetition(const regex_node &node) {
+        int start = add_state(regex_nfa::state::epsilon);
+        fragment f{start, start};
+        for (int i = 0; i < node.min; ++i) {
+            fragment next = compile_node(node.children[0]);
+            nfa.states[f.exit].out = next.start;
+            f.exit = next.exit;
+        }
+        if (node.max < 0) {
+            fragment body = compile_node(node.children[0]);
+            int split = add_state(regex_nfa::state::epsilon);
+            int exit = add_state(regex_nfa::state::epsilon);
+            nfa.states[split].out = body.start;
+            nfa.states[split].out1 = exit;
+            nfa.states[body.exit].out = split;
+            nfa.states[f.exit].out = split;
+            f.exit = exit;
+            return f;
+        }
+        int exit = add_state(regex_nfa::state::epsilon);
+        for (int i = node.min; i < node.max; ++i) {
+            fragment body = compile_node(node.children[0]);
+            int split = add_state(regex_nfa::state::epsilon);
+            nfa.states[split].out = body.start;
+            nfa.states[split].out1 = exit;
+            nfa.states[f.exit].out = split;
+            f.exit = body.exit;
+        }
+        nfa.states[f.exit].out = exit;
+        f.exit = exit;
+        return f;
+    }
+
+    fragment compile_set(const code_point_ranges &set) {
+        int root = add_state(regex_nfa::state::code_units);
+        int exit = add_state(regex_nfa::state::epsilon);
+        std::map<std::tuple<int, char32_t, char32_t>, int> children;
+        auto add = [&](const std::pair<char32_t, char32_t> *sequence,
+                       int length)
+        {
+            int state = root;
+            for (int i = 0; i < length; ++i) {
+                char32_t first = sequence[i].first;
+                char32_t last = sequence[i].second;
+                int target = exit;
+                if (i + 1 < length) {
+                    auto key = std::make_tuple(state, first, last);
+                    auto it = children.find(key);
+                    if (it != children.end()) {
+                        state = it->second;
+                        continue;
+                    }
+                    target = add_state(regex_nfa::state::code_units);
+                    children.emplace(key, target);
+                }
+                nfa.states[state].transitions.push_back({first, last, target});
+                state = target;
+            }
+        };
+        for (const auto &range : set) {
+            if (unit == regex_unit::utf8) {
+                utf8_sequences(range.first, range.second, add);
+            } else if (unit == regex_unit::utf16) {
+                utf16_sequences(range.first, range.second, add);
+            } else {
+                std::pair<char32_t, char32_t> sequence[1] = {range};
+                add(sequence, 1);
+            }
+        }
+        return {root, exit};
+    }
+
+    const std::vector<regex_node> &nodes;
+    regex_unit unit;
+    regex_nfa &nfa;
+};
+
+/*
+ * regex_unit_classes
+ * A partition of the code units into classes that no transition of an NFA
+ * distinguishes between, so that DFA transition tables have one entry per
+ * class rather than per code unit.
+ */
+class regex_unit_classes {
+public:
+    explicit regex_unit_classes(const regex_nfa &nfa) {
+        bounds.push_back(0);
+        for (const auto &state : nfa.states) {
+            for (const auto &t : state.transitions) {
+                bounds.push_back(t.first);
+                if (t.last < max_code_point) {
+                    bounds.push_back(t.last + 1);
+                }
+            }
+        }
+        std::sort(bounds.begin(), bounds.end());
+        bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+        for (char32_t u = 0; u < 0x100; ++u) {
+            octet_classes[u] = find(u);
+        }
+    }
+
+    std::size_t size() const noexcept {
+        return bounds.size();
+    }
+
+    std::size_t operator()(char32_t unit) const noexcept {
+        return unit < 0x100 ? octet_classes[unit] : find(unit);
+    }
+
+    // Returns the first code unit of the class 'c'.
+    char32_t representative(std::size_t c) const noexcept {
+        return bounds[c];
+    }
+
+private:
+    std::size_t find(char32_t unit) const noexcept {
+        return std::upper_bound(bounds.begin(), bounds.end(), unit)
+             - bounds.begin() - 1;
+    }
+
+    std::vector<char32_t> bounds;
+    unsigned short octet_classes[0x100];
+};
+
+/*
+ * regex_dfa
+ * A DFA whose states are sets of NFA states, constructed lazily: a state's
+ * transition on a class of code units is computed the first time that it is
+ * taken and then cached.  An unanchored DFA adds the start of the NFA to
+ * every state, so that it finds matches that begin at any position.  If the
+ * transition table grows beyond a limit, the cache is discarded and states
+ * are constructed again as they are reached.  State zero is the dead state,
+ * from which no match is reachable.
+ */
+class regex_dfa {
+public:
+    static constexpr int dead = 0;
+    static constexpr std::size_t max_table_size = 1 << 22;
+
+    regex_dfa(
+        const regex_nfa &nfa,
+        const regex_unit_classes &classes,
+        bool unanchored)
+    :
+        nfa(nfa), classes(classes), unanchored(unanchored),
+        stride(classes.size()), marks(nfa.states.size(), 0)
+    {
+        reset();
+    }
+
+    // Returns the start state at the beginning of the text, if 'at_begin' is
+    // true, or elsewhere.
+    int start(bool at_begin) const noexcept {
+        return at_begin ? begin_state : start_state;
+    }
+
+    int next(int state, char32_t unit) {
+        std::size_t c = classes(unit);
+        int target = table[state * stride + c];
+        return target >= 0 ? target : compute_next(state, c);
+    }
+
+    // Returns true if a match ends at the current position.
+    bool is_match(int state) const noexcept {
+        return matches[state] & 1;
+    }
+
+    // Returns true if a match ends at the current position when it is the
+    // end of the text.
+    bool is_match_at_end(int state) const noexcept {
+        return matches[state] & 2;
+    }
+
+private:
+    struct state_info {
+        std::vector<int> nfa_states;
+        bool match;
+        bool match_at_end;
+    };
+
+    void reset() {
+        states.clear();
+        matches.clear();
+        table.clear();
+        ids.clear();
+        intern({}, false);
+        std::vector<int> set;
+        add_closure(nfa.start, true, false, set);
+        begin_state = intern(set, true);
+        set.clear();
+        add_closure(nfa.start, false, false, set);
+        start_state = intern(set, false);
+    }
+
+    // Adds the states reachable from 's' through epsilon transitions, and
+    // through assertions that hold, to 'set'.  States are marked as they are
+    // added, so that each is added once per set.
+    void add_closure(
+        int s,
+        bool at_begin,
+        bool at_end,
+        std::vector<int> &set)
+    {
+        if (set.empty()) {
+            ++generation;
+        }
+        std::vector<int> stack{s};
+        while (! stack.empty()) {
+            s = stack.back();
+            stack.pop_back();
+            if (s < 0 || marks[s] == generation) {
+                continue;
+            }
+            marks[s] = generation;
+            const regex_nfa::state &state = nfa.states[s];
+            switch (state.kind) {
+            case regex_nfa::state::epsilon:
+                stack.push_back(state.out1);
+                stack.push_back(state.out);
+                break;
+            case regex_nfa::state::text_begin:
+                if (at_begin) {
+                    stack.push_back(state.out);
+                }
+                break;
+            case regex_nfa::state::text_end:
+                set.push_back(s);
+                if (at_end) {
+                    stack.push_back(state.out);
+                }
+                break;
+            default:
+                set.push_back(s);
+                break;
+            }
+        }
+    }
+
+    bool contains_match(const std::vector<int> &set) const {
+        return std::any_of(set.begin(), set.end(), [this](int s) {
+                return nfa.states[s].kind == regex_nfa::state::match;
+            });
+    }
+
+    // Returns the index of the state for the set of NFA states 'set',
+    // constructing it if necessary.
+    int intern(std::vector<int> set, bool at_begin) {
+        std::sort(set.begin(), set.end());
+        if (at_begin) {
+            set.push_back(-1);
+        }
+        auto it = ids.find(set);
+        if (it != ids.end()) {
+            return it->second;
+        }
+        if (at_begin) {
+            set.pop_back();
+        }
+        state_info info{set, contains_match(set), false};
+        info.match_at_end = info.match;
+        if (! info.match_at_end) {
+            std::vector<int> at_end;
+            for (int s : set) {
+                if (nfa.states[s].kind == regex_nfa::state::text_end) {
+                    add_closure(nfa.states[s].out, at_begin, true, at_end);
+                }
+            }
+            info.match_at_end = contains_match(at_end);
+        }
+        if (at_begin) {
+            set.push_back(-1);
+        }
+        int id = int(states.size());
+        ids.emplace(std::move(set), id);
+        matches.push_back(info.match | info.match_at_end << 1);
+        states.push_back(std::move(info));
+        table.resize(table.size() + stride, -1);
+        return id;
+    }
+
+    int compute_next(int state, std::size_t c) {
+        char32_t unit = classes.representative(c);
+        std::vector<int> set;
+        for (int s : states[state].nfa_states) {
+            for (const auto &t : nfa.states[s].transitions) {
+                if (t.first <= unit && unit <= t.last) {
+                    add_closure(t.target, false, false, set);
+                }
+            }
+        }
+        if (unanchored) {
+            add_closure(nfa.start, false, false, set);
+        }
+        if (table.size() >= max_table_size) {
+            reset();
+            return intern(std::move(set), false);
+        }
+        int target = intern(std::move(set), false);
+        table[state * stride + c] = target;
+        return target;
+    }
+
+    const regex_nfa &nfa;
+    const regex_unit_classes &classes;
+    bool unanchored;
+    std::size_t stride;
+    std::vector<state_info> states;
+    // Bit 0 is set if a state is a match, and bit 1 if it is a match at the
+    // end of the text.
+    std::vector<unsigned char> matches;
+    std::vector<int> table;
+    std::map<std::vector<int>, int> ids;
+    std::vector<unsigned> marks;
+    unsigned generation = 0;
+    int begin_state;
+    int start_state;
+};
+
+// Appends the code points of the literal text that every match of the node
+// 'index' begins with to 'prefix'.  Returns true if the node matches only
+// that text, so that the literal text of the node that follows it may be
+// appended as well.
+inline bool append_literal_prefix(
+    const std::vector<regex_node> &nodes,
+    std::size_t index,
+    std::u32string &prefix)
+{
+    const regex_node &node = nodes[index];
+    switch (node.kind) {
+    case regex_node::empty:
+    case regex_node::text_begin:
+        return true;
+    case regex_node::ranges:
+        if (node.set.size() == 1 && node.set[0].first == node.set[0].second) {
+            prefix += node.set[0].first;
+            return true;
+        }
+        return false;
+    case regex_node::concatenation:
+        for (std::size_t child : node.children) {
+            if (! append_literal_prefix(nodes, child, prefix)) {
+                return false;
+            }
+        }
+        return true;
+    case regex_node::repetition:
+        if (node.min > 0) {
+            append_literal_prefix(nodes, node.children[0], prefix);
+        }
+        return false;
+    default:
+        return false;
+    }
+}
+
+/*
+ * regex_automaton
+ * The NFA of a regular expression over one kind of code unit, the anchored
+ * and unanchored DFAs constructed from it, and the code units of the literal
+ * text that every match begins with.
+ */
+struct regex_automaton {
+    regex_automaton(
+        const std::vector<regex_node> &nodes,
+        std::size_t root,
+        regex_unit unit)
+    :
+        nfa{compile(nodes, root, unit)},
+        classes{nfa},
+        anchored{nfa, classes, false},
+        unanchored{nfa, classes, true}
+    {
+        std::u32string literal;
+        append_literal_prefix(nodes, root, literal);
+        for (char32_t cp : literal) {
+            if (unit == regex_unit::utf8) {
+                unsigned char code_units[4];
+                prefix.append(code_units,
+                              code_units + encode_utf8(cp, code_units));
+            } else if (unit == regex_unit::utf16 && cp >= 0x10000) {
+                prefix += 0xD800 + ((cp - 0x10000) >> 10);
+                prefix += 0xDC00 + (cp & 0x3FF);
+            } else {
+                prefix += cp;
+            }
+        }
+    }
+
+    static regex_nfa compile(
+        const std::vector<regex_node> &nodes,
+        std::size_t root,
+        regex_unit unit)
+    {
+        regex_nfa nfa;
+        regex_compiler{nodes, unit, nfa}.compile(root);
+        return nfa;
+    }
+
+    regex_nfa nfa;
+    regex_unit_classes classes;
+    regex_dfa anchored;
+    regex_dfa unanchored;
+    std::u32string prefix;
+};
+
+struct regex_access {
+    static regex_automaton& automaton(text_regex &re, regex_unit unit);
+};
+
+// Returns true if a match begins at 'first', which is the beginning of the
+// text if 'at_begin' is true, and if so, sets 'end' to the end of the
+// longest such match.  'unit' returns the code unit of the value of an
+// iterator.
+template<typename IT, typename ST, typename U>
+bool regex_longest_match(
+    regex_dfa &dfa,
+    IT first,
+    ST last,
+    bool at_begin,
+    U unit,
+    IT &end)
+{
+    int state = dfa.start(at_begin);
+    bool found = false;
+    for (;;) {
+        if (first == last) {
+            if (dfa.is_match_at_end(state)) {
+                end = first;
+                found = true;
+            }
+            return found;
+        }
+        if (dfa.is_match(state)) {
+            end = first;
+            found = true;
+        }
+        state = dfa.next(state, unit(*first));
+        ++first;
+        if (state == regex_dfa::dead) {
+            return found;
+        }
+    }
+}
+
+// Returns true if a match ends in ['first', 'last'], and if so, sets 'end'
+// to the first position at which one does.  Otherwise, sets 'end' to 'last'.
+template<typename IT, typename ST, typename U>
+bool regex_earliest_match_end(
+    regex_dfa &dfa,
+    IT first,
+    ST last,
+    U unit,
+    IT &end)
+{
+    int state = dfa.start(true);
+    for (;;) {
+        if (first == last) {
+            end = first;
+            return dfa.is_match_at_end(state);
+        }
+        if (dfa.is_match(state)) {
+            end = first;
+            return true;
+        }
+        state = dfa.next(state, unit(*first));
+        ++first;
+    }
+}
+
+// Returns the first position in ['first', 'last') at which the code units
+// 'prefix' occur, or the position of 'last' if there is none.
+template<typename IT, typename ST, typename U>
+IT find_regex_prefix(
+    IT first,
+    ST last,
+    const std::u32string &prefix,
+    U unit)
+{
+    for (; first != last; ++first) {
+        if (unit(*first) != prefix[0]) {
+            continue;
+        }
+        IT it = first;
+        std::size_t i = 0;
+        for (; i < prefix.size() && it != last; ++i, ++it) {
+            if (unit(*it) != prefix[i]) {
+                break;
+            }
+        }
+        if (i == prefix.size()) {
+            break;
+        }
+    }
+    return first;
+}
+
+// Finds the leftmost-longest match of 'a' in ['first', 'last'], or if
+// 'whole' is true, determines whether all of it matches.  Returns true if
+// there is a match and sets ['match_first', 'match_last'] to it; otherwise,
+// sets both to the position of 'last'.  'unit' returns the code unit of the
+// value of an iterator, and 'is_boundary' returns true if a code unit
+// begins a character.
+//
+// A match is sought in one of two ways.  If every match begins with literal
+// text, occurrences of it are found, and the longest match that begins at
+// each is sought with the anchored DFA.  Otherwise, the unanchored DFA
+// finds the first position at which any match ends; text without a match is
+// rejected in a single pass, and otherwise the leftmost match begins at or
+// before that position and is sought there with the anchored DFA.
+template<typename IT, typename ST, typename U, typename B>
+bool regex_find(
+    regex_automaton &a,
+    IT first,
+    ST last,
+    U unit,
+    B is_boundary,
+    bool whole,
+    IT &match_first,
+    IT &match_last)
+{
+    if (whole) {
+        IT end = first;
+        if (regex_longest_match(a.anchored, first, last, true, unit, end)
+            && end == last)
+        {
+            match_first = first;
+            match_last = end;
+            return true;
+        }
+        for (; first != last; ++first) {
+        }
+        match_first = match_last = first;
+        return false;
+    }
+    if (! a.prefix.empty()) {
+        for (IT it = first; ; ++it) {
+            it = find_regex_prefix(it, last, a.prefix, unit);
+            if (it == last) {
+                match_first = match_last = it;
+                return false;
+            }
+            if (regex_longest_match(a.anchored, it, last, it == first, unit,
+                                    match_last))
+            {
+                match_first = it;
+                return true;
+            }
+        }
+    }
+    IT end = first;
+    if (! regex_earliest_match_end(a.unanchored, first, last, unit, end)) {
+        match_first = match_last = end;
+        return false;
+    }
+    for (IT it = first; ; ++it) {
+        if ((it == end || is_boundary(*it))
+            && regex_longest_match(a.anchored, it, last, it == first, unit,
+                                   match_last))
+        {
+            match_first = it;
+            return true;
+        }
+        if (it == end) {
+            match_first = match_last = end;
+            return false;
+        }
+    }
+}
+
+// In general, text is matched by decoding its characters and running an
+// automaton over their code points.
+template<TextView TVT, typename TIT>
+bool regex_find_in_view(
+    const TVT &tv,
+    text_regex &re,
+    bool whole,
+    TIT &match_first,
+    TIT &match_last)
+{
+    return regex_find(
+        regex_access::automaton(re, regex_unit::code_point),
+        text_detail::adl_begin(tv), text_detail::adl_end(tv),
+        [](const auto &c) -> char32_t { return c.get_code_point(); },
+        [](const auto &) { return true; },
+        whole, match_first, match_last);
+}
+
+// Text in UTF-8 and UTF-16 is matched by running an automaton over its code
+// units without decoding it.
+template<TextView TVT, typename TIT>
+requires std::is_same<encoding_type_t<TVT>, utf8_encoding>::value
+      || std::is_same<encoding_type_t<TVT>, utf16_encoding>::value
+bool regex_find_in_view(
+    const TVT &tv,
+    text_regex &re,
+    bool whole,
+    TIT &match_first,
+    TIT &match_last)
+{
+    constexpr bool utf8 =
+        std::is_same<encoding_type_t<TVT>, utf8_encoding>::value;
+    auto first = text_detail::adl_begin(tv);
+    auto cu_first = text_detail::adl_begin(tv.base());
+    auto cu_last = text_detail::adl_end(tv.base());
+    decltype(cu_first) cu_match_first, cu_match_last;
+    bool found = regex_find(
+        regex_access::automaton(
+            re, utf8 ? regex_unit::utf8 : regex_unit::utf16),
+        cu_first, cu_last,
+        [](auto cu) -> char32_t {
+            return utf8 ? static_cast<unsigned char>(cu)
+                        : static_cast<char16_t>(cu);
+        },
+        [](auto cu) {
+            return utf8 ? (static_cast<unsigned char>(cu) & 0xC0) != 0x80
+                        : static_cast<char16_t>(cu) - 0xDC00u >= 0x400;
+        },
+        whole, cu_match_first, cu_match_last);
+    match_first = TIT{first.state(), &tv.base(), cu_match_first};
+    match_last = TIT{first.state(), &tv.base(), cu_match_last};
+    return found;
+}
+
+} // namespace text_detail
+
+
+/*
+ * text_regex
+ * A regular expression over Unicode text.  Patterns are parsed when a
+ * text_regex is constructed; the automata that match them are constructed
+ * lazily, for each kind of code unit that text is matched in, as matching
+ * proceeds.  Since matching updates these automata, a text_regex object
+ * must not be used to match text in more than one thread at a time.
+ */
+class text_regex {
+public:
+    // Parses the pattern 'pattern'.  Throws text_regex_error if it is not a
+    // valid regular expression.
+    template<TextView TVT>
+    requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+    explicit text_regex(const TVT &pattern) {
+        std::u32string code_points;
+        for (auto c : pattern) {
+            code_points += c.get_code_point();
+        }
+        root = text_detail::regex_parser{code_points, nodes}.parse();
+    }
+
+private:
+    friend struct text_detail::regex_access;
+
+    std::vector<text_detail::regex_node> nodes;
+    std::size_t root;
+    std::unique_ptr<text_detail::regex_automaton> automata[3];
+};
+
+
+namespace text_detail {
+
+inline regex_automaton& regex_access::automaton(
+    text_regex &re,
+    regex_unit unit)
+{
+    auto &automaton = re.automata[static_cast<int>(unit)];
+    if (! automaton) {
+        automaton.reset(new regex_automaton{re.nodes, re.root, unit});
+    }
+    return *automaton;
+}
+
+} // namespace text_detail
+
+
+/*
+ * Regular expression matching
+ */
+// Returns a text view of the leftmost-longest match of the regular expression
+// 're' in the text view 'tv', or an empty text view at the end of 'tv' if
+// there is none.  UTF-8 and UTF-16 text is matched without decoding it.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto regex_search(
+    const TVT &tv,
+    text_regex &re)
+{
+    auto first = text_detail::adl_begin(tv);
+    auto last = first;
+    text_detail::regex_find_in_view(tv, re, false, first, last);
+    return make_text_view(first, last);
+}
+
+// Returns true if the regular expression 're' matches all of the text view
+// 'tv'.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+bool regex_match(
+    const TVT &tv,
+    text_regex &re)
+{
+    auto first = text_detail::adl_begin(tv);
+    auto last = first;
+    return text_detail::regex_find_in_view(tv, re, true, first, last);
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_REGEX_HPP
@@ -0,0 +1,231 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_SENTENCE_VIEW_HPP) // {
+#define TEXT_VIEW_SENTENCE_VIEW_HPP
+
+
+#include <text_view_detail/boundary_view.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/unicode/unicode_trie.hpp>
+#include <text_view_detail/unicode/sentence_break_tables.hpp>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+namespace text_detail {
+
+// Returns the Sentence_Break property of 'cp'.  Code points below U+0300 are
+// classified with a single table lookup that bypasses the trie.
+inline sentence_break_table::property
+sentence_break_property(char32_t cp) noexcept {
+    if (cp < sentence_break_table::latin_limit) {
+        return sentence_break_table::property(
+            sentence_break_table::latin[cp]);
+    }
+    return sentence_break_table::property(
+        trie_lookup<sentence_break_table>(cp));
+}
+
+/*
+ * Sentence boundary rules
+ * Implements the sentence boundary rules of UAX #29 (SB3 through SB11 and
+ * SB998).  A sentence_break_context holds the properties of the characters
+ * seen so far that the rules depend on: the previous character, the previous
+ * two characters other than those ignored by SB5, and how much of the
+ * sequence SATerm Close* Sp* the characters not ignored by SB5 end with.
+ * Rule SB8 also depends on the characters that follow; they are examined
+ * with a lookahead function only when that rule might apply.
+ */
+class sentence_break_context {
+public:
+    using property = sentence_break_table::property;
+
+    explicit sentence_break_context(property first) noexcept
+    :
+        raw_previous{first},
+        previous{property::other},
+        before_previous{property::other},
+        terminator{none},
+        aterm{false}
+    {
+        shift(first);
+    }
+
+    // Returns true if there is a sentence boundary between the previous
+    // character and a following character with property 'next'.
+    // 'lower_follows' is a function object that returns true if the first
+    // character, starting with the following character, that has a property
+    // of OLetter, Upper, Lower, Sep, CR, LF, STerm, or ATerm has the property
+    // Lower.  The context is then updated to reflect the following character
+    // as the previous character.
+    template<typename F>
+    bool is_boundary_before(property next, F lower_follows) {
+        property raw = raw_previous;
+        raw_previous = next;
+
+        if (raw == property::cr && next == property::lf) {
+            return false;                                       // SB3
+        }
+        if (is_parasep(raw)) {
+            shift(next);
+            return true;                                        // SB4
+        }
+        if (next == property::extend || next == property::format) {
+            return false;                                       // SB5
+        }
+
+        bool boundary = false;                                  // SB998
+        if (previous == property::aterm && next == property::numeric) {
+            boundary = false;                                   // SB6
+        } else if (previous == property::aterm
+                   && (before_previous == property::upper
+                       || before_previous == property::lower)
+                   && next == property::upper)
+        {
+            boundary = false;                                   // SB7
+        } else if (terminator != none) {
+            if (next == property::scontinue || is_saterm(next)) {
+                boundary = false;                               // SB8a
+            } else if (terminator == closed
+                       && (next == property::close
+                           || next == property::sp
+                           || is_parasep(next)))
+            {
+                boundary = false;                               // SB9
+            } else if (next == property::sp || is_parasep(next)) {
+                boundary = false;                               // SB10
+            } else if (aterm && lower_follows()) {
+                boundary = false;                               // SB8
+            } else {
+                boundary = true;                                // SB11
+            }
+        }
+        shift(next);
+        return boundary;
+    }
+
+    static constexpr bool is_parasep(property p) {
+        return p == property::sep || p == property::cr || p == property::lf;
+    }
+    static constexpr bool is_saterm(property p) {
+        return p == property::sterm || p == property::aterm;
+    }
+
+private:
+    void shift(property next) noexcept {
+        if (is_saterm(next)) {
+            terminator = closed;
+            aterm = next == property::aterm;
+        } else if (next == property::close && terminator == closed) {
+            terminator = closed;
+        } else if (next == property::sp && terminator != none) {
+            terminator = spaced;
+        } else {
+            terminator = none;
+        }
+        before_previous = previous;
+        previous = next;
+    }
+
+    enum terminator_state : unsigned char {
+        none,
+        closed,     // SATerm Close*
+        spaced      // SATerm Close* Sp+
+    };
+
+    property raw_previous;
+    property previous;
+    property before_previous;
+    terminator_state terminator;
+    bool aterm;
+};
+
+// Boundary rules for boundary_view that locate sentence boundaries.
+class sentence_break_rules {
+public:
+    template<typename TIT, typename TST, typename RT>
+    static TIT next_boundary(TIT first, TST last, const RT *) {
+        sentence_break_context context{
+            sentence_break_property((*first).get_code_point())};
+        for (++first; first != last; ++first) {
+            auto lower_follows = [&first, &last] {
+                return is_lower_following(first, last);
+            };
+            if (context.is_boundary_before(
+                    sentence_break_property((*first).get_code_point()),
+                    lower_follows))
+            {
+                break;
+            }
+        }
+        return first;
+    }
+
+private:
+    // Returns true if the characters from 'it' match
+    // ( [^OLetter Upper Lower ParaSep SATerm] )* Lower (SB8).
+    template<typename TIT, typename TST>
+    static bool is_lower_following(TIT it, TST last) {
+        using property = sentence_break_table::property;
+        for (; it != last; ++it) {
+            property p = sentence_break_property((*it).get_code_point());
+            if (p == property::oletter || p == property::upper
+                || p == property::lower
+                || sentence_break_context::is_parasep(p)
+                || sentence_break_context::is_saterm(p))
+            {
+                return p == property::lower;
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace text_detail
+
+
+/*
+ * sentence_view
+ * A view adapter over a text view that presents the sentences (UAX #29) of
+ * the underlying text as a range of text views.  The underlying text view
+ * must provide forward iterators and its characters must have Unicode code
+ * points.
+ */
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+class sentence_view
+    : public text_detail::boundary_view<TVT, text_detail::sentence_break_rules>
+{
+public:
+    using text_detail::boundary_view<
+        TVT, text_detail::sentence_break_rules>::boundary_view;
+};
+
+
+/*
+ * make_sentence_view
+ */
+// Constructs a sentence view over an existing text view.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_sentence_view(
+    TVT tv)
+{
+    return sentence_view<TVT>{tv};
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_SENTENCE_VIEW_HPP
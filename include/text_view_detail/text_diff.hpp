@@ -0,0 +1,579 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_TEXT_DIFF_HPP) // {
+#define TEXT_VIEW_TEXT_DIFF_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/boundary_view.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/grapheme_view.hpp>
+#include <text_view_detail/text_hash.hpp>
+#include <text_view_detail/text_view.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+/*
+ * Diff granularity
+ * The units in which diff_text() reports the differences between texts:
+ * lines, each of which ends after a line feed or at the end of the text, or
+ * the code points or extended grapheme clusters (UAX #29) of the lines that
+ * differ.
+ */
+enum class diff_granularity {
+    line,
+    code_point,
+    grapheme
+};
+
+
+/*
+ * text_diff_hunk
+ * A difference between two texts: the characters in ['old_first',
+ * 'old_last') of the old text are replaced by those in ['new_first',
+ * 'new_last') of the new text.  Either range may be empty.
+ */
+template<typename TIT1, typename TIT2>
+struct text_diff_hunk {
+    TIT1 old_first;
+    TIT1 old_last;
+    TIT2 new_first;
+    TIT2 new_last;
+};
+
+
+namespace text_detail {
+
+/*
+ * diff_range
+ * The elements in ['old_first', 'old_last') of one sequence that are
+ * replaced by those in ['new_first', 'new_last') of another.
+ */
+struct diff_range {
+    std::size_t old_first;
+    std::size_t old_last;
+    std::size_t new_first;
+    std::size_t new_last;
+};
+
+// Appends 'r' to 'ranges', or extends the last range of 'ranges' if 'r'
+// adjoins it.
+inline void append_diff_range(
+    std::vector<diff_range> &ranges,
+    const diff_range &r)
+{
+    if (! ranges.empty()
+        && ranges.back().old_last == r.old_first
+        && ranges.back().new_last == r.new_first)
+    {
+        ranges.back().old_last = r.old_last;
+        ranges.back().new_last = r.new_last;
+    } else {
+        ranges.push_back(r);
+    }
+}
+
+// The number of edits beyond which find_middle_snake() stops looking for the
+// middle snake of a shortest edit script and settles for a split point on a
+// furthest reaching path instead.  This bounds the time taken to compare
+// sequences that have little in common, at the cost of a diff that may not
+// be minimal.
+constexpr std::ptrdiff_t diff_cost_limit = 512;
+
+// Sets 'x' and 'y' to a point at which the sequences 'a' of length 'n' and
+// 'b' of length 'm', which are both non-empty and differ in their first and
+// last elements, may be split so that each half can be compared separately.
+// The point is the start of the middle snake of a shortest edit script found
+// with the linear space variant of the algorithm of Myers, in which furthest
+// reaching paths are extended from both ends of the sequences until they
+// overlap.  'forward' and 'backward' are used as temporary storage for the
+// furthest reaching paths on each diagonal.
+inline void find_middle_snake(
+    const unsigned *a,
+    std::ptrdiff_t n,
+    const unsigned *b,
+    std::ptrdiff_t m,
+    std::vector<std::ptrdiff_t> &forward,
+    std::vector<std::ptrdiff_t> &backward,
+    std::ptrdiff_t &x,
+    std::ptrdiff_t &y)
+{
+    std::ptrdiff_t max_d = std::min((n + m + 1) / 2, diff_cost_limit);
+    std::ptrdiff_t offset = max_d + 1;
+    std::ptrdiff_t length = 2 * offset;
+    forward.assign(length, -1);
+    backward.assign(length, -1);
+    forward[offset + 1] = 0;
+    backward[offset + 1] = 0;
+    std::ptrdiff_t delta = n - m;
+    bool odd = delta % 2 != 0;
+    std::ptrdiff_t k1_start = 0, k1_end = 0, k2_start = 0, k2_end = 0;
+    std::ptrdiff_t best_x = 0, best_y = 0;
+    for (std::ptrdiff_t d = 0; d < max_d; ++d) {
+        for (std::ptrdiff_t k1 = -d + k1_start; k1 <= d - k1_end; k1 += 2) {
+            std::ptrdiff_t i = offset + k1;
+            std::ptrdiff_t x1 =
+                k1 == -d || (k1 != d && forward[i - 1] < forward[i + 1])
+                ? forward[i + 1] : forward[i - 1] + 1;
+            std::ptrdiff_t y1 = x1 - k1;
+            while (x1 < n && y1 < m && a[x1] == b[y1]) {
+                ++x1;
+                ++y1;
+            }
+            forward[i] = x1;
+            if (x1 > n) {
+                k1_end += 2;
+            } else if (y1 > m) {
+                k1_start += 2;
+            } else {
+                if (x1 + y1 > best_x + best_y) {
+                    best_x = x1;
+                    best_y = y1;
+                }
+                std::ptrdiff_t j = offset + delta - k1;
+                if (odd && j >= 0 && j < length && backward[j] != -1
+                    && x1 >= n - backward[j])
+                {
+                    x = x1;
+                    y = y1;
+                    return;
+                }
+            }
+        }
+        for (std::ptrdiff_t k2 = -d + k2_start; k2 <= d - k2_end; k2 += 2) {
+            std::ptrdiff_t j = offset + k2;
+            std::ptrdiff_t x2 =
+                k2 == -d || (k2 != d && backward[j - 1] < backward[j + 1])
+                ? backward[j + 1] : backward[j - 1] + 1;
+            std::ptrdiff_t y2 = x2 - k2;
+            while (x2 < n && y2 < m && a[n - x2 - 1] == b[m - y2 - 1]) {
+                ++x2;
+                ++y2;
+            }
+            backward[j] = x2;
+            if (x2 > n) {
+                k2_end += 2;
+            } else if (y2 > m) {
+                k2_start += 2;
+            } else {
+                std::ptrdiff_t i = offset + delta - k2;
+                if (! odd && i >= 0 && i < length && forward[i] != -1
+                    && forward[i] >= n - x2)
+                {
+                    x = forward[i];
+                    y = forward[i] - (i - offset);
+                    return;
+                }
+            }
+        }
+    }
+    x = best_x;
+    y = best_y;
+}
+
+// Appends to 'ranges' the ranges of the sequences 'a' and 'b' that differ,
+// in order and with adjoining ranges merged, as found by the algorithm of
+// Myers.  The common prefix and suffix of each pair of subsequences are
+// skipped before a split point is found for them; pairs are kept on an
+// explicit stack so that long edit scripts do not exhaust the call stack.
+inline void diff_sequences(
+    const std::vector<unsigned> &a,
+    const std::vector<unsigned> &b,
+    std::vector<diff_range> &ranges)
+{
+    std::vector<std::ptrdiff_t> forward, backward;
+    std::vector<diff_range> pending{{0, a.size(), 0, b.size()}};
+    while (! pending.empty()) {
+        diff_range r = pending.back();
+        pending.pop_back();
+        while (r.old_first != r.old_last && r.new_first != r.new_last
+               && a[r.old_first] == b[r.new_first])
+        {
+            ++r.old_first;
+            ++r.new_first;
+        }
+        while (r.old_first != r.old_last && r.new_first != r.new_last
+               && a[r.old_last - 1] == b[r.new_last - 1])
+        {
+            --r.old_last;
+            --r.new_last;
+        }
+        if (r.old_first == r.old_last || r.new_first == r.new_last) {
+            if (r.old_first != r.old_last || r.new_first != r.new_last) {
+                append_diff_range(ranges, r);
+            }
+            continue;
+        }
+        std::ptrdiff_t x, y;
+        find_middle_snake(
+            &a[r.old_first], r.old_last - r.old_first,
+            &b[r.new_first], r.new_last - r.new_first,
+            forward, backward, x, y);
+        if (x + y == 0) {
+            append_diff_range(ranges, r);
+            continue;
+        }
+        pending.push_back({r.old_first + x, r.old_last,
+                           r.new_first + y, r.new_last});
+        pending.push_back({r.old_first, r.old_first + x,
+                           r.new_first, r.new_first + y});
+    }
+}
+
+// Appends to 'ranges' the ranges of the sequences 'a' and 'b', whose
+// elements are less than 'id_count', that differ.  Elements that occur in
+// only one of the sequences cannot be matched, so they are removed before
+// the remaining elements are compared with diff_sequences(); texts with
+// little in common are then compared quickly.
+inline void diff_ids(
+    const std::vector<unsigned> &a,
+    const std::vector<unsigned> &b,
+    unsigned id_count,
+    std::vector<diff_range> &ranges)
+{
+    std::vector<unsigned char> occurs(id_count);
+    for (unsigned id : a) {
+        occurs[id] |= 1;
+    }
+    for (unsigned id : b) {
+        occurs[id] |= 2;
+    }
+    std::vector<unsigned> a_shared, b_shared;
+    std::vector<std::size_t> a_index, b_index;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (occurs[a[i]] == 3) {
+            a_shared.push_back(a[i]);
+            a_index.push_back(i);
+        }
+    }
+    for (std::size_t j = 0; j < b.size(); ++j) {
+        if (occurs[b[j]] == 3) {
+            b_shared.push_back(b[j]);
+            b_index.push_back(j);
+        }
+    }
+    std::vector<diff_range> shared_ranges;
+    diff_sequences(a_shared, b_shared, shared_ranges);
+
+    // The elements that are not in a range of the shared elements match;
+    // the differences are the gaps between them in the full sequences.
+    std::size_t old_next = 0, new_next = 0;
+    auto match = [&](std::size_t i, std::size_t j) {
+        if (a_index[i] != old_next || b_index[j] != new_next) {
+            append_diff_range(
+                ranges, {old_next, a_index[i], new_next, b_index[j]});
+        }
+        old_next = a_index[i] + 1;
+        new_next = b_index[j] + 1;
+    };
+    std::size_t i = 0, j = 0;
+    for (const diff_range &r : shared_ranges) {
+        for (; i < r.old_first; ++i, ++j) {
+            match(i, j);
+        }
+        i = r.old_last;
+        j = r.new_last;
+    }
+    for (; i < a_shared.size(); ++i, ++j) {
+        match(i, j);
+    }
+    if (old_next != a.size() || new_next != b.size()) {
+        append_diff_range(ranges, {old_next, a.size(), new_next, b.size()});
+    }
+}
+
+// In general, the text view 'tv' is divided into lines by decoding its
+// characters.  An iterator to the beginning of each line, followed by one to
+// the end of the text, is appended to 'bounds'.  See below for text in ASCII
+// transparent encodings.
+template<TextView TVT, typename TIT>
+void append_line_bounds(const TVT &tv, std::vector<TIT> &bounds) {
+    auto first = text_detail::adl_begin(tv);
+    auto last = text_detail::adl_end(tv);
+    if (first != last) {
+        bounds.push_back(first);
+    }
+    while (first != last) {
+        char32_t cp = (*first).get_code_point();
+        ++first;
+        if (cp == U'\n' && first != last) {
+            bounds.push_back(first);
+        }
+    }
+    bounds.push_back(first);
+}
+
+// Text in ASCII transparent encodings is divided into lines by searching its
+// code units for line feeds.
+template<TextView TVT, typename TIT>
+requires is_ascii_transparent_encoding<encoding_type_t<TVT>>
+void append_line_bounds(const TVT &tv, std::vector<TIT> &bounds) {
+    auto first = text_detail::adl_begin(tv);
+    auto cu = text_detail::adl_begin(tv.base());
+    auto cu_last = text_detail::adl_end(tv.base());
+    while (cu != cu_last) {
+        bounds.push_back(TIT{first.state(), &tv.base(), cu});
+        cu = std::find(cu, cu_last, '\n');
+        if (cu != cu_last) {
+            ++cu;
+        }
+    }
+    bounds.push_back(TIT{first.state(), &tv.base(), cu_last});
+}
+
+// In general, returns true if the characters in ['first1', 'last1') have the
+// same code points as those in ['first2', 'last2').  See below for text in
+// the same ASCII transparent encoding.
+template<typename TIT1, typename TIT2>
+bool equal_code_points(TIT1 first1, TIT1 last1, TIT2 first2, TIT2 last2) {
+    return std::equal(first1, last1, first2, last2,
+                      [](const auto &c1, const auto &c2) {
+                          return c1.get_code_point() == c2.get_code_point();
+                      });
+}
+
+// Text in the same ASCII transparent encoding is compared by its code units.
+template<typename TIT1, typename TIT2>
+requires is_ascii_transparent_encoding<encoding_type_t<TIT1>>
+      && std::is_same<encoding_type_t<TIT1>, encoding_type_t<TIT2>>::value
+bool equal_code_points(TIT1 first1, TIT1 last1, TIT2 first2, TIT2 last2) {
+    return std::equal(first1.base(), last1.base(),
+                      first2.base(), last2.base());
+}
+
+/*
+ * line_ids
+ * Assigns each line of two texts an identifier, with equal lines, those
+ * with the same code points, having the same identifier.  Every line is
+ * hashed with hash_text() before any is looked up, so that the lookups,
+ * which rarely hit the cache for large texts, are not serialized behind the
+ * hashing.  Lines are looked up in an open addressing table with linear
+ * probing that holds at least twice as many slots as there are lines.  Each
+ * slot holds an identifier and the upper 32 bits of the hash of its first
+ * line, and a line whose hash has the same bits is compared with that line
+ * to confirm that they are equal.
+ */
+template<typename TIT1, typename TIT2>
+class line_ids {
+public:
+    line_ids(
+        const std::vector<TIT1> &a_bounds,
+        const std::vector<TIT2> &b_bounds)
+    :
+        a_bounds(a_bounds), b_bounds(b_bounds)
+    {
+        for (std::size_t i = 0; i + 1 < a_bounds.size(); ++i) {
+            hashes.push_back(line_hash(a_bounds, i));
+        }
+        for (std::size_t j = 0; j + 1 < b_bounds.size(); ++j) {
+            hashes.push_back(line_hash(b_bounds, j));
+        }
+        std::size_t size = 16;
+        while (size < 2 * hashes.size()) {
+            size *= 2;
+        }
+        slots.assign(size, 0);
+    }
+
+    // Returns the identifier of line 'i' of the old text if 'b' is false, or
+    // of the new text if 'b' is true.
+    unsigned assign(bool b, std::size_t i) {
+        std::uint64_t h = hashes[b ? a_bounds.size() - 1 + i : i];
+        std::uint64_t tag = h & ~std::uint64_t{0xFFFFFFFF};
+        for (std::size_t slot = h & (slots.size() - 1); ;
+             slot = (slot + 1) & (slots.size() - 1))
+        {
+            if (slots[slot] == 0) {
+                representatives.push_back({b, i});
+                slots[slot] = tag | representatives.size();
+                return representatives.size() - 1;
+            }
+            unsigned id = (slots[slot] & 0xFFFFFFFF) - 1;
+            if ((slots[slot] & ~std::uint64_t{0xFFFFFFFF}) == tag
+                && (b ? equal_lines(b_bounds, i, representatives[id])
+                      : equal_lines(a_bounds, i, representatives[id])))
+            {
+                return id;
+            }
+        }
+    }
+
+    unsigned count() const {
+        return representatives.size();
+    }
+
+private:
+    struct representative {
+        bool b;
+        std::size_t line;
+    };
+
+    template<typename TIT>
+    static std::uint64_t line_hash(
+        const std::vector<TIT> &bounds,
+        std::size_t i)
+    {
+        return hash_text(make_text_view(bounds[i], bounds[i + 1]));
+    }
+
+    template<typename TIT>
+    bool equal_lines(
+        const std::vector<TIT> &bounds,
+        std::size_t i,
+        const representative &r) const
+    {
+        if (r.b) {
+            return equal_code_points(bounds[i], bounds[i + 1],
+                                     b_bounds[r.line], b_bounds[r.line + 1]);
+        }
+        return equal_code_points(bounds[i], bounds[i + 1],
+                                 a_bounds[r.line], a_bounds[r.line + 1]);
+    }
+
+    const std::vector<TIT1> &a_bounds;
+    const std::vector<TIT2> &b_bounds;
+    std::vector<std::uint64_t> hashes;
+    std::vector<std::uint64_t> slots;
+    std::vector<representative> representatives;
+};
+
+// Appends to 'bounds' an iterator to each code point, or if 'graphemes' is
+// true, each extended grapheme cluster, in ['first', 'last'), followed by
+// 'last', and appends to 'ids' the identifier of each of those units, which
+// is assigned by 'ids_by_unit'.  'range' is the range of the underlying text
+// view.
+template<typename TIT, typename RT>
+void append_unit_ids(
+    TIT first,
+    TIT last,
+    const RT *range,
+    bool graphemes,
+    std::unordered_map<std::u32string, unsigned> &ids_by_unit,
+    std::vector<TIT> &bounds,
+    std::vector<unsigned> &ids)
+{
+    std::u32string unit;
+    while (first != last) {
+        bounds.push_back(first);
+        TIT next = first;
+        if (graphemes) {
+            next = grapheme_break_rules::next_boundary(first, last, range);
+        } else {
+            ++next;
+        }
+        unit.clear();
+        for (; first != next; ++first) {
+            unit += (*first).get_code_point();
+        }
+        ids.push_back(
+            ids_by_unit.emplace(unit, ids_by_unit.size()).first->second);
+    }
+    bounds.push_back(last);
+}
+
+} // namespace text_detail
+
+
+/*
+ * diff_text
+ */
+// Returns the differences between the text views 'old_text' and 'new_text'
+// as a std::vector of text_diff_hunk objects, in order, with iterators into
+// each text.  Replacing the characters of each hunk in the old text with
+// those in the new text produces the new text.  Lines are compared by their
+// code points, so the texts may be in different encodings; characters are
+// not normalized.  Each line is hashed, from its code units for UTF-8 text,
+// and the sequences of line identifiers, less the lines that occur in only
+// one of the texts, are compared with the algorithm of Myers in linear
+// space.  If 'granularity' is not diff_granularity::line, the code points or
+// grapheme clusters of the lines that differ are then compared in the same
+// way, so that the characters that are unchanged within those lines are not
+// reported.  Texts that differ by more than several hundred lines or units
+// may receive a diff that is correct but not minimal.  Memory proportional
+// to the number of lines, and to the length of the largest difference, is
+// used.
+template<TextView TVT1, TextView TVT2>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT1>>()
+      && origin::Forward_iterator<origin::Iterator_type<const TVT2>>()
+auto diff_text(
+    const TVT1 &old_text,
+    const TVT2 &new_text,
+    diff_granularity granularity = diff_granularity::line)
+{
+    using TIT1 = origin::Iterator_type<const TVT1>;
+    using TIT2 = origin::Iterator_type<const TVT2>;
+    std::vector<TIT1> a_bounds;
+    std::vector<TIT2> b_bounds;
+    text_detail::append_line_bounds(old_text, a_bounds);
+    text_detail::append_line_bounds(new_text, b_bounds);
+    std::vector<unsigned> a_lines(a_bounds.size() - 1);
+    std::vector<unsigned> b_lines(b_bounds.size() - 1);
+    text_detail::line_ids<TIT1, TIT2> ids{a_bounds, b_bounds};
+    for (std::size_t i = 0; i < a_lines.size(); ++i) {
+        a_lines[i] = ids.assign(false, i);
+    }
+    for (std::size_t j = 0; j < b_lines.size(); ++j) {
+        b_lines[j] = ids.assign(true, j);
+    }
+    std::vector<text_detail::diff_range> line_ranges;
+    text_detail::diff_ids(a_lines, b_lines, ids.count(), line_ranges);
+
+    std::vector<text_diff_hunk<TIT1, TIT2>> hunks;
+    std::unordered_map<std::u32string, unsigned> ids_by_unit;
+    std::vector<TIT1> a_units;
+    std::vector<TIT2> b_units;
+    std::vector<unsigned> a_ids, b_ids;
+    std::vector<text_detail::diff_range> unit_ranges;
+    for (const text_detail::diff_range &r : line_ranges) {
+        if (granularity == diff_granularity::line
+            || r.old_first == r.old_last || r.new_first == r.new_last)
+        {
+            hunks.push_back({a_bounds[r.old_first], a_bounds[r.old_last],
+                             b_bounds[r.new_first], b_bounds[r.new_last]});
+            continue;
+        }
+        bool graphemes = granularity == diff_granularity::grapheme;
+        ids_by_unit.clear();
+        a_units.clear();
+        b_units.clear();
+        a_ids.clear();
+        b_ids.clear();
+        unit_ranges.clear();
+        text_detail::append_unit_ids(
+            a_bounds[r.old_first], a_bounds[r.old_last], &old_text.base(),
+            graphemes, ids_by_unit, a_units, a_ids);
+        text_detail::append_unit_ids(
+            b_bounds[r.new_first], b_bounds[r.new_last], &new_text.base(),
+            graphemes, ids_by_unit, b_units, b_ids);
+        text_detail::diff_ids(a_ids, b_ids, ids_by_unit.size(), unit_ranges);
+        for (const text_detail::diff_range &u : unit_ranges) {
+            hunks.push_back({a_units[u.old_first], a_units[u.old_last],
+                             b_units[u.new_first], b_units[u.new_last]});
+        }
+    }
+    return hunks;
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_TEXT_DIFF_HPP
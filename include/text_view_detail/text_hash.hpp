@@ -0,0 +1,291 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_TEXT_HASH_HPP) // {
+#define TEXT_VIEW_TEXT_HASH_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/encodings.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+namespace text_detail {
+
+/*
+ * xxh64
+ * The 64-bit xxHash algorithm, computed incrementally.  Bytes are consumed in
+ * stripes of 32 bytes, each of which updates four independent accumulators,
+ * so the result does not depend on how the input is divided between calls
+ * to update().
+ */
+class xxh64 {
+public:
+    explicit xxh64(std::uint64_t seed) noexcept
+    :
+        seed{seed},
+        accumulators{seed + prime1 + prime2, seed + prime2, seed,
+                     seed - prime1}
+    {}
+
+    void update(const unsigned char *p, std::size_t n) noexcept {
+        total += n;
+        if (buffered) {
+            std::size_t length = std::min(n, sizeof(buffer) - buffered);
+            std::copy(p, p + length, buffer + buffered);
+            buffered += length;
+            p += length;
+            n -= length;
+            if (buffered < sizeof(buffer)) {
+                return;
+            }
+            consume_stripe(buffer);
+            buffered = 0;
+        }
+        for (; n >= sizeof(buffer); p += sizeof(buffer), n -= sizeof(buffer)) {
+            consume_stripe(p);
+        }
+        std::copy(p, p + n, buffer);
+        buffered = n;
+    }
+
+    std::uint64_t digest() const noexcept {
+        std::uint64_t h;
+        if (total >= sizeof(buffer)) {
+            h = rotate_left(accumulators[0], 1)
+              + rotate_left(accumulators[1], 7)
+              + rotate_left(accumulators[2], 12)
+              + rotate_left(accumulators[3], 18);
+            for (std::uint64_t accumulator : accumulators) {
+                h ^= round(0, accumulator);
+                h = h * prime1 + prime4;
+            }
+        } else {
+            h = seed + prime5;
+        }
+        h += total;
+        const unsigned char *p = buffer;
+        std::size_t n = buffered;
+        for (; n >= 8; p += 8, n -= 8) {
+            h ^= round(0, read_le<8>(p));
+            h = rotate_left(h, 27) * prime1 + prime4;
+        }
+        if (n >= 4) {
+            h ^= read_le<4>(p) * prime1;
+            h = rotate_left(h, 23) * prime2 + prime3;
+            p += 4;
+            n -= 4;
+        }
+        for (; n > 0; ++p, --n) {
+            h ^= *p * prime5;
+            h = rotate_left(h, 11) * prime1;
+        }
+        h ^= h >> 33;
+        h *= prime2;
+        h ^= h >> 29;
+        h *= prime3;
+        h ^= h >> 32;
+        return h;
+    }
+
+private:
+    static constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87;
+    static constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4F;
+    static constexpr std::uint64_t prime3 = 0x165667B19E3779F9;
+    static constexpr std::uint64_t prime4 = 0x85EBCA77C2B2AE63;
+    static constexpr std::uint64_t prime5 = 0x27D4EB2F165667C5;
+
+    static constexpr std::uint64_t rotate_left(
+        std::uint64_t x,
+        int bits) noexcept
+    {
+        return x << bits | x >> (64 - bits);
+    }
+
+    static constexpr std::uint64_t round(
+        std::uint64_t accumulator,
+        std::uint64_t input) noexcept
+    {
+        return rotate_left(accumulator + input * prime2, 31) * prime1;
+    }
+
+    // Returns the 'N' bytes at 'p' as a little endian integer.
+    template<int N>
+    static std::uint64_t read_le(const unsigned char *p) noexcept {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        typename std::conditional<N == 8, std::uint64_t, std::uint32_t>::type
+            value;
+        std::memcpy(&value, p, N);
+        return value;
+#else
+        std::uint64_t value = 0;
+        for (int i = N - 1; i >= 0; --i) {
+            value = value << 8 | p[i];
+        }
+        return value;
+#endif
+    }
+
+    void consume_stripe(const unsigned char *p) noexcept {
+        for (int i = 0; i < 4; ++i) {
+            accumulators[i] = round(accumulators[i], read_le<8>(p + i * 8));
+        }
+    }
+
+    std::uint64_t seed;
+    std::uint64_t accumulators[4];
+    std::uint64_t total = 0;
+    unsigned char buffer[32];
+    std::size_t buffered = 0;
+};
+
+// Writes the UTF-8 encoding of 'cp' to 'out' and returns the number of code
+// units written.
+inline int encode_utf8(char32_t cp, unsigned char *out) noexcept {
+    if (cp < 0x80) {
+        out[0] = cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = 0xC0 | cp >> 6;
+        out[1] = 0x80 | (cp & 0x3F);
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = 0xE0 | cp >> 12;
+        out[1] = 0x80 | (cp >> 6 & 0x3F);
+        out[2] = 0x80 | (cp & 0x3F);
+        return 3;
+    }
+    out[0] = 0xF0 | cp >> 18;
+    out[1] = 0x80 | (cp >> 12 & 0x3F);
+    out[2] = 0x80 | (cp >> 6 & 0x3F);
+    out[3] = 0x80 | (cp & 0x3F);
+    return 4;
+}
+
+// In general, text is hashed by decoding its characters and hashing the
+// UTF-8 encoding of their code points, which is accumulated in a buffer so
+// that the hash is updated a batch of code units at a time.
+template<TextView TVT>
+void hash_code_units(const TVT &tv, xxh64 &state) {
+    unsigned char batch[256];
+    std::size_t length = 0;
+    for (auto c : tv) {
+        length += encode_utf8(c.get_code_point(), batch + length);
+        if (length > sizeof(batch) - 4) {
+            state.update(batch, length);
+            length = 0;
+        }
+    }
+    state.update(batch, length);
+}
+
+// Updates 'state' with the code units in ['first', 'last'), which are copied
+// to a buffer in batches.
+template<typename CUIT, typename CUST>
+void hash_utf8_code_units(CUIT first, CUST last, xxh64 &state) {
+    using code_unit_type = typename std::iterator_traits<CUIT>::value_type;
+    static_assert(sizeof(code_unit_type) == 1,
+                  "UTF-8 code units must be one byte");
+    code_unit_type batch[256];
+    while (first != last) {
+        std::size_t length = 0;
+        for (; length < sizeof(batch) && first != last; ++length, ++first) {
+            batch[length] = *first;
+        }
+        state.update(reinterpret_cast<const unsigned char *>(batch), length);
+    }
+}
+
+// Code units of random access ranges are copied a batch at a time.
+template<typename CUIT>
+requires origin::Random_access_iterator<CUIT>()
+void hash_utf8_code_units(CUIT first, CUIT last, xxh64 &state) {
+    typename std::iterator_traits<CUIT>::value_type batch[256];
+    while (first != last) {
+        auto length = std::min<typename std::iterator_traits<CUIT>::
+            difference_type>(last - first, sizeof(batch));
+        std::copy(first, first + length, batch);
+        first += length;
+        state.update(reinterpret_cast<const unsigned char *>(batch), length);
+    }
+}
+
+// Code units stored in an array are hashed in place.
+template<typename CU>
+void hash_utf8_code_units(CU *first, CU *last, xxh64 &state) {
+    state.update(reinterpret_cast<const unsigned char *>(first),
+                 last - first);
+}
+
+// UTF-8 text is hashed directly from its code units without decoding it.
+template<TextView TVT>
+requires std::is_same<encoding_type_t<TVT>, utf8_encoding>::value
+void hash_code_units(const TVT &tv, xxh64 &state) {
+    hash_utf8_code_units(text_detail::adl_begin(tv.base()),
+                         text_detail::adl_end(tv.base()), state);
+}
+
+} // namespace text_detail
+
+
+/*
+ * hash_text
+ */
+// Returns a hash of the code points of the text view 'tv', computed with the
+// 64-bit xxHash algorithm over the UTF-8 encoding of those code points and
+// the seed 'seed'.  Text views with the same sequence of code points hash
+// equally regardless of their encodings; UTF-8 text is hashed in a single
+// pass over its code units without decoding them.  Text that is not well
+// formed in its encoding has an unspecified hash.  No memory is allocated.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+std::size_t hash_text(
+    const TVT &tv,
+    std::uint64_t seed = 0)
+{
+    text_detail::xxh64 state{seed};
+    text_detail::hash_code_units(tv, state);
+    return static_cast<std::size_t>(state.digest());
+}
+
+
+/*
+ * text_hash
+ * A function object type that hashes text views with hash_text(), for use
+ * as the hash function of unordered containers keyed by text, including
+ * heterogeneous lookup with text views in different encodings.
+ */
+struct text_hash {
+    using is_transparent = void;
+
+    template<TextView TVT>
+    requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+    std::size_t operator()(const TVT &tv) const {
+        return hash_text(tv);
+    }
+};
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_TEXT_HASH_HPP
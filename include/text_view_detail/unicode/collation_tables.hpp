@@ -0,0 +1,12603 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+// This file is generated by tools/gen_collation_tables.py from the Unicode
+// Character Database, version 14.0.0, and the Default
+// Unicode Collation Element Table, version 13.0.0.  Do not edit.
+
+#if !defined(TEXT_VIEW_UNICODE_COLLATION_TABLES_HPP) // {
+#define TEXT_VIEW_UNICODE_COLLATION_TABLES_HPP
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * Collation element table
+ * The collation elements of the DUCET, version 13.0.0, packed as
+ * described in tools/gen_collation_tables.py.  'ascii' holds the collation
+ * element of each ASCII character when it does not begin a contraction.  Code
+ * points without an entry have implicit weights computed from the first
+ * implicit range that contains them; the primary weight of the first
+ * collation element is base + ((cp - origin) >> 15) and that of the second is
+ * ((cp - origin) & 0x7FFF) | 0x8000.  Code points in no range have the base
+ * unassigned_base and origin zero.
+ */
+struct collation_table {
+    struct contraction {
+        char32_t code_point;
+        unsigned short elements;
+        unsigned char element_count;
+        unsigned short children;
+        unsigned short child_count;
+    };
+    struct implicit_range {
+        char32_t first;
+        char32_t last;
+        char32_t origin;
+        unsigned short base;
+    };
+    static constexpr unsigned default_value = 0;
+    static constexpr unsigned single = 1;
+    static constexpr unsigned expansion = 2;
+    static constexpr unsigned contraction_tag = 3;
+    static constexpr unsigned short unassigned_base = 0xFBC0;
+    static constexpr unsigned ascii[0x80] = {
+        0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        0x00000001, 0x00000001, 0x00000001, 0x02011009, 0x02021009, 0x02031009,
+        0x02041009, 0x02051009, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        0x00000001, 0x00000001, 0x02091009, 0x02671009, 0x031D1009, 0x03AC1009,
+        0x1F641009, 0x03AD1009, 0x03A91009, 0x03161009, 0x03281009, 0x03291009,
+        0x03A11009, 0x06661009, 0x02231009, 0x020D1009, 0x027E1009, 0x03A61009,
+        0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+        0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x02401009, 0x023A1009,
+        0x066A1009, 0x066B1009, 0x066C1009, 0x026D1009, 0x03A01009, 0x1FA21021,
+        0x1FBC1021, 0x1FD61021, 0x1FEB1021, 0x20071021, 0x20421021, 0x20511021,
+        0x20751021, 0x20901021, 0x20AB1021, 0x20C41021, 0x20D61021, 0x21091021,
+        0x21181021, 0x213C1021, 0x216B1021, 0x21801021, 0x21931021, 0x21D21021,
+        0x21F71021, 0x22171021, 0x22471021, 0x22591021, 0x22641021, 0x22701021,
+        0x22861021, 0x032A1009, 0x03A71009, 0x032B1009, 0x04B71009, 0x020B1009,
+        0x04B41009, 0x1FA21009, 0x1FBC1009, 0x1FD61009, 0x1FEB1009, 0x20071009,
+        0x20421009, 0x20511009, 0x20751009, 0x20901009, 0x20AB1009, 0x20C41009,
+        0x20D61009, 0x21091009, 0x21181009, 0x213C1009, 0x216B1009, 0x21801009,
+        0x21931009, 0x21D21009, 0x21F71009, 0x22171009, 0x22471009, 0x22591009,
+        0x22641009, 0x22701009, 0x22861009, 0x032C1009, 0x066E1009, 0x032D1009,
+        0x06701009, 0x00000001,
+    };
+    static constexpr unsigned elements[6593] = {
+        0x1F991079, 0x06761079, 0x1F9C1079, 0x1F991079, 0x06761079, 0x1F9A1079,
+        0x1F9B1079, 0x06761079, 0x1F9C1079, 0x1FA21029, 0x00008C11, 0x20071029,
+        0x1FEB1029, 0x00008C11, 0x213C1021, 0x00001789, 0x21D21011, 0x00008C11,
+        0x21D21011, 0x1FA21011, 0x00008C11, 0x20071011, 0x1FEB1011, 0x00008C11,
+        0x213C1009, 0x00001789, 0x1FEB1021, 0x00001C89, 0x1FEB1009, 0x00001C89,
+        0x20751021, 0x00001C89, 0x20751009, 0x00001C89, 0x20901029, 0x20AB1029,
+        0x20901011, 0x20AB1011, 0x20D61021, 0x00008C09, 0x20D61009, 0x00008C09,
+        0x20D61021, 0x00001C89, 0x20D61009, 0x00001C89, 0x22E31011, 0x21181011,
+        0x213C1029, 0x00008C11, 0x20071029, 0x213C1011, 0x00008C11, 0x20071011,
+        0x21D21011, 0x00008C91, 0x22861011, 0x22591011, 0x21F71011, 0x21D21011,
+        0x1FEB1029, 0x22861029, 0x00001411, 0x1FEB1029, 0x22861011, 0x00001411,
+        0x1FEB1011, 0x22861011, 0x00001411, 0x20D61029, 0x20AB1029, 0x20D61029,
+        0x20AB1011, 0x20D61011, 0x20AB1011, 0x21181029, 0x20AB1029, 0x21181029,
+        0x20AB1011, 0x21181011, 0x20AB1011, 0x1FEB1029, 0x22861029, 0x1FEB1029,
+        0x22861011, 0x1FEB1011, 0x22861011, 0x1FEB1011, 0x1FBC1011, 0x21801011,
+        0x216B1011, 0x1FEB1011, 0x22A31011, 0x1FEB1011, 0x22991011, 0x21F71011,
+        0x21E41011, 0x21F71011, 0x1FE51011, 0x20421011, 0x21371011, 0x20D61011,
+        0x21D21011, 0x20D61011, 0x22861011, 0x232D1029, 0x231E1011, 0x232B1011,
+        0x232D1011, 0x231E1011, 0x232B1011, 0x239B1029, 0x00008C91, 0x239B1011,
+        0x00008C91, 0x25FA1011, 0x26181011, 0x26271011, 0x26221011, 0x26231011,
+        0x26221011, 0x26231011, 0x26231011, 0x26231011, 0x26271011, 0x26271011,
+        0x26271011, 0x26721011, 0x26641011, 0x27281011, 0x26641011, 0x272C1011,
+        0x26641011, 0x27371011, 0x26641011, 0x26641011, 0x00008C91, 0x27141011,
+        0x00008C91, 0x274A1011, 0x00008C91, 0x27521011, 0x00008C91, 0x275C1011,
+        0x00008C91, 0x27491011, 0x00008D11, 0x274A1011, 0x00008D11, 0x274C1011,
+        0x00008D11, 0x27C51011, 0x00008C11, 0x27C61011, 0x00008C11, 0x27C81011,
+        0x00008C11, 0x2A5B1011, 0x2A7C1011, 0x2C321011, 0x2C4F1011, 0x2C301011,
+        0x2C4F1011, 0x2C311011, 0x2C4F1011, 0x2C3A1011, 0x2C4F1011, 0x2C251011,
+        0x2C4F1011, 0x2C2A1011, 0x2C4F1011, 0x2C331011, 0x2C4F1011, 0x2C391011,
+        0x2C4F1011, 0x2C171011, 0x2C4F1011, 0x327E1011, 0x326F1011, 0x327E1011,
+        0x32771011, 0x331F1011, 0x33361011, 0x00006211, 0x33121011, 0x00008C91,
+        0x33091011, 0x00008C91, 0x33111011, 0x00008C91, 0x33131011, 0x00008C91,
+        0x35C91011, 0x36021011, 0x35C91011, 0x3C351011, 0x00008C11, 0x3C361011,
+        0x00008C11, 0x3C361011, 0x00008C91, 0x3C371011, 0x00008C11, 0x3C381011,
+        0x00008C11, 0x3C381011, 0x00008C91, 0x3C381011, 0x00008D11, 0x3C381011,
+        0x00008D91, 0x3C3D1011, 0x00008C11, 0x3C3D1011, 0x00008C91, 0x3C3D1011,
+        0x00008D11, 0x3C3D1011, 0x00008D91, 0x3C411011, 0x00008C11, 0x3C411011,
+        0x00008C91, 0x3C411011, 0x00008D11, 0x3C421011, 0x00008C11, 0x3C421011,
+        0x00008C91, 0x3C431011, 0x00008C11, 0x3C451011, 0x00008C11, 0x3C461011,
+        0x00008C11, 0x3C4A1011, 0x00008C11, 0x3C4A1011, 0x00008D11, 0x3C4A1011,
+        0x00008D91, 0x3C4A1011, 0x00008E11, 0x3C4C1011, 0x00008C11, 0x3C4C1011,
+        0x00008C91, 0x3C4D1011, 0x00008C11, 0x3C4D1011, 0x00008C91, 0x3C481011,
+        0x00008C11, 0x3C501011, 0x00008C11, 0x3C501011, 0x00008C91, 0x3C511011,
+        0x00008C11, 0x3C521011, 0x00008C11, 0x3C621011, 0x00008C11, 0x3C621011,
+        0x00008C91, 0x3C401011, 0x00008C11, 0x3C4A1011, 0x00008C91, 0x3C461011,
+        0x3C511011, 0x3C501011, 0x00008C11, 0x3C501011, 0x00008C11, 0x3C371011,
+        0x3C371011, 0x345C1011, 0x347A1011, 0x345F1011, 0x347B1011, 0x36FA1011,
+        0x37101011, 0x36FA1011, 0x37101011, 0x371B1011, 0x374A1011, 0x37701011,
+        0x374A1011, 0x1FA21051, 0x00008C51, 0x20071051, 0x20511011, 0x00008C91,
+        0x21F71011, 0x00008C11, 0x20751011, 0x1FEB1051, 0x00008C51, 0x1FA21011,
+        0x00008C11, 0x1FA21011, 0x213C1011, 0x1FA21011, 0x22471011, 0x1FD61011,
+        0x00001811, 0x1FEB1011, 0x00008C91, 0x213C1011, 0x00001A11, 0x22171011,
+        0x00001A11, 0x1FA21011, 0x00001591, 0x213C1011, 0x00001591, 0x22171011,
+        0x00001591, 0x1FA21011, 0x22E51011, 0x21D21029, 0x00008C11, 0x21D21029,
+        0x20D61029, 0x20D61029, 0x20D61011, 0x20D61011, 0x027E1011, 0x027E1011,
+        0x027E1011, 0x027E1011, 0x027E1011, 0x03BF1011, 0x03BF1011, 0x03BF1011,
+        0x03BF1011, 0x03BF1011, 0x03C01011, 0x03C01011, 0x03C01011, 0x03C01011,
+        0x03C01011, 0x02671011, 0x02671011, 0x026D1011, 0x026D1011, 0x026D1011,
+        0x02671011, 0x02671011, 0x026D1011, 0x03BF1011, 0x03BF1011, 0x03BF1011,
+        0x03BF1011, 0x21931029, 0x21D21011, 0x1FA21011, 0x03A61011, 0x1FD61011,
+        0x1FA21011, 0x03A61011, 0x21D21011, 0x052A1011, 0x1FD61029, 0x1FD61011,
+        0x03A61011, 0x213C1011, 0x1FD61011, 0x03A61011, 0x22171011, 0x052A1011,
+        0x20421029, 0x21181029, 0x213C1011, 0x21D21051, 0x21091051, 0x21F71029,
+        0x20071029, 0x20D61029, 0x21F71051, 0x21091051, 0x20421029, 0x1FA21029,
+        0x22641029, 0x1FA21029, 0x03A61011, 0x21D21029, 0x1F991079, 0x06761079,
+        0x1F9F1079, 0x1F991079, 0x06761079, 0x1FA11079, 0x1F991079, 0x06761079,
+        0x1F991079, 0x1F981079, 0x1F991079, 0x06761079, 0x1F9B1079, 0x1F9A1079,
+        0x06761079, 0x1F9B1079, 0x1F991079, 0x06761079, 0x1F9D1079, 0x1F9A1079,
+        0x06761079, 0x1F9D1079, 0x1F9B1079, 0x06761079, 0x1F9D1079, 0x1F9C1079,
+        0x06761079, 0x1F9D1079, 0x1F991079, 0x06761079, 0x1F9E1079, 0x1F9D1079,
+        0x06761079, 0x1F9E1079, 0x1F991079, 0x06761079, 0x1FA01079, 0x1F9B1079,
+        0x06761079, 0x1FA01079, 0x1F9D1079, 0x06761079, 0x1FA01079, 0x1F9F1079,
+        0x06761079, 0x1FA01079, 0x1F991079, 0x06761079, 0x20901029, 0x20901029,
+        0x20901029, 0x20901029, 0x20901029, 0x20901029, 0x22471029, 0x22471029,
+        0x20901029, 0x22471029, 0x20901029, 0x20901029, 0x22471029, 0x20901029,
+        0x20901029, 0x20901029, 0x20901029, 0x22641029, 0x22641029, 0x20901029,
+        0x22641029, 0x20901029, 0x20901029, 0x20901011, 0x20901011, 0x20901011,
+        0x20901011, 0x20901011, 0x20901011, 0x22471011, 0x22471011, 0x20901011,
+        0x22471011, 0x20901011, 0x20901011, 0x22471011, 0x20901011, 0x20901011,
+        0x20901011, 0x20901011, 0x22641011, 0x22641011, 0x20901011, 0x22641011,
+        0x20901011, 0x20901011, 0x1F981079, 0x06761079, 0x1F9B1079, 0x068C1011,
+        0x068C1011, 0x068C1011, 0x068C1011, 0x068C1011, 0x068D1011, 0x068D1011,
+        0x068D1011, 0x068D1011, 0x068D1011, 0x1F991019, 0x1F981019, 0x1F991019,
+        0x1F991019, 0x1F991019, 0x1F9A1019, 0x1F991019, 0x1F9B1019, 0x1F991019,
+        0x1F9C1019, 0x1F991019, 0x1F9D1019, 0x1F991019, 0x1F9E1019, 0x1F991019,
+        0x1F9F1019, 0x1F991019, 0x1FA01019, 0x1F991019, 0x1FA11019, 0x1F9A1019,
+        0x1F981019, 0x03281011, 0x1F991011, 0x03291011, 0x03281011, 0x1F9A1011,
+        0x03291011, 0x03281011, 0x1F9B1011, 0x03291011, 0x03281011, 0x1F9C1011,
+        0x03291011, 0x03281011, 0x1F9D1011, 0x03291011, 0x03281011, 0x1F9E1011,
+        0x03291011, 0x03281011, 0x1F9F1011, 0x03291011, 0x03281011, 0x1FA01011,
+        0x03291011, 0x03281011, 0x1FA11011, 0x03291011, 0x03281011, 0x1F991011,
+        0x1F981011, 0x03291011, 0x03281011, 0x1F991011, 0x1F991011, 0x03291011,
+        0x03281011, 0x1F991011, 0x1F9A1011, 0x03291011, 0x03281011, 0x1F991011,
+        0x1F9B1011, 0x03291011, 0x03281011, 0x1F991011, 0x1F9C1011, 0x03291011,
+        0x03281011, 0x1F991011, 0x1F9D1011, 0x03291011, 0x03281011, 0x1F991011,
+        0x1F9E1011, 0x03291011, 0x03281011, 0x1F991011, 0x1F9F1011, 0x03291011,
+        0x03281011, 0x1F991011, 0x1FA01011, 0x03291011, 0x03281011, 0x1F991011,
+        0x1FA11011, 0x03291011, 0x03281011, 0x1F9A1011, 0x1F981011, 0x03291011,
+        0x1F991011, 0x027E1011, 0x1F9A1011, 0x027E1011, 0x1F9B1011, 0x027E1011,
+        0x1F9C1011, 0x027E1011, 0x1F9D1011, 0x027E1011, 0x1F9E1011, 0x027E1011,
+        0x1F9F1011, 0x027E1011, 0x1FA01011, 0x027E1011, 0x1FA11011, 0x027E1011,
+        0x1F991011, 0x1F981011, 0x027E1011, 0x1F991011, 0x1F991011, 0x027E1011,
+        0x1F991011, 0x1F9A1011, 0x027E1011, 0x1F991011, 0x1F9B1011, 0x027E1011,
+        0x1F991011, 0x1F9C1011, 0x027E1011, 0x1F991011, 0x1F9D1011, 0x027E1011,
+        0x1F991011, 0x1F9E1011, 0x027E1011, 0x1F991011, 0x1F9F1011, 0x027E1011,
+        0x1F991011, 0x1FA01011, 0x027E1011, 0x1F991011, 0x1FA11011, 0x027E1011,
+        0x1F9A1011, 0x1F981011, 0x027E1011, 0x03281011, 0x1FA21011, 0x03291011,
+        0x03281011, 0x1FBC1011, 0x03291011, 0x03281011, 0x1FD61011, 0x03291011,
+        0x03281011, 0x1FEB1011, 0x03291011, 0x03281011, 0x20071011, 0x03291011,
+        0x03281011, 0x20421011, 0x03291011, 0x03281011, 0x20511011, 0x03291011,
+        0x03281011, 0x20751011, 0x03291011, 0x03281011, 0x20901011, 0x03291011,
+        0x03281011, 0x20AB1011, 0x03291011, 0x03281011, 0x20C41011, 0x03291011,
+        0x03281011, 0x20D61011, 0x03291011, 0x03281011, 0x21091011, 0x03291011,
+        0x03281011, 0x21181011, 0x03291011, 0x03281011, 0x213C1011, 0x03291011,
+        0x03281011, 0x216B1011, 0x03291011, 0x03281011, 0x21801011, 0x03291011,
+        0x03281011, 0x21931011, 0x03291011, 0x03281011, 0x21D21011, 0x03291011,
+        0x03281011, 0x21F71011, 0x03291011, 0x03281011, 0x22171011, 0x03291011,
+        0x03281011, 0x22471011, 0x03291011, 0x03281011, 0x22591011, 0x03291011,
+        0x03281011, 0x22641011, 0x03291011, 0x03281011, 0x22701011, 0x03291011,
+        0x03281011, 0x22861011, 0x03291011, 0x068C1011, 0x068C1011, 0x068C1011,
+        0x068C1011, 0x02401011, 0x02401011, 0x066B1011, 0x066B1011, 0x066B1011,
+        0x066B1011, 0x066B1011, 0x066B1011, 0x23561011, 0x234B1011, 0x23551011,
+        0x246A1011, 0x24731011, 0xFB401011, 0xCE360001, 0x00008C11, 0xFB401011,
+        0xD3820001, 0x00008C11, 0xFB401011, 0xCE5B0001, 0xFB401011, 0xCE5A0001,
+        0xFB401011, 0xCE590001, 0x00008C11, 0xFB401011, 0xCEBB0001, 0xFB401011,
+        0xD1820001, 0x00008C11, 0xFB401011, 0xD1E00001, 0x00008C11, 0xFB401011,
+        0xD2000001, 0x00008C11, 0xFB401011, 0xD2020001, 0xFB401011, 0xD35C0001,
+        0x00008C11, 0xFB401011, 0xD3690001, 0x00008C11, 0xFB401011, 0xDC0F0001,
+        0x00008C11, 0xFB401011, 0xDC0F0001, 0x00008C91, 0xFB401011, 0xDC220001,
+        0x00008C11, 0xFB401011, 0xDC230001, 0xFB401011, 0xDC220001, 0xFB401011,
+        0xDC230001, 0x00008C11, 0xFB401011, 0xDDF30001, 0xFB401011, 0xDE7A0001,
+        0xFB401011, 0xDF510001, 0xFB401011, 0xDF500001, 0x00008C11, 0xFB401011,
+        0xDFC40001, 0xFB401011, 0xDFC30001, 0x00008C11, 0xFB401011, 0xE24C0001,
+        0xFB401011, 0xE5350001, 0xFB401011, 0xE5E10001, 0xFB401011, 0xE5E50001,
+        0x00008C11, 0xFB401011, 0xE7080001, 0x00008C11, 0xFB401011, 0xEB7A0001,
+        0x00008C11, 0xFB401011, 0xEBCD0001, 0xFB401011, 0xEC110001, 0xFB401011,
+        0xEC350001, 0xFB401011, 0xEC3A0001, 0xFB401011, 0xF06C0001, 0xFB401011,
+        0xF22B0001, 0xFB401011, 0xF22B0001, 0x00008C11, 0xFB401011, 0xCE2C0001,
+        0xFB401011, 0xF25B0001, 0x00008C11, 0xFB401011, 0xF2AD0001, 0xFB401011,
+        0xF38B0001, 0x00008C11, 0xFB401011, 0xF58B0001, 0x00008C11, 0xFB401011,
+        0xF6EE0001, 0x00008C11, 0xFB401011, 0xF93A0001, 0x00008C11, 0xFB401011,
+        0xF93B0001, 0xFB401011, 0xFAF90001, 0x00008C11, 0xFB401011, 0xFCF90001,
+        0xFB401011, 0xFE9F0001, 0xFB401011, 0xFF530001, 0xFB401011, 0xFF520001,
+        0xFB401011, 0xFF530001, 0x00008C11, 0xFB401011, 0xFF530001, 0x00008C91,
+        0xFB401011, 0xFF520001, 0x00008C11, 0xFB401011, 0xFF8A0001, 0x00008C11,
+        0xFB401011, 0xFF8A0001, 0x00008C91, 0xFB401011, 0xFF8B0001, 0xFB411011,
+        0x80020001, 0xFB411011, 0x80800001, 0xFB411011, 0x807F0001, 0x00008C11,
+        0xFB411011, 0x80890001, 0x00008C11, 0xFB411011, 0x81FC0001, 0x00008C11,
+        0xFB411011, 0x82790001, 0xFB411011, 0x82790001, 0x00008C11, 0xFB411011,
+        0x82790001, 0x00008C91, 0xFB411011, 0x864E0001, 0xFB411011, 0x88640001,
+        0xFB411011, 0x89800001, 0xFB411011, 0x897F0001, 0xFB411011, 0x89C10001,
+        0xFB411011, 0x89D20001, 0xFB411011, 0x89D20001, 0x00008C11, 0xFB411011,
+        0x8BA00001, 0xFB411011, 0x8D1D0001, 0xFB411011, 0x8DB30001, 0x00008C11,
+        0xFB411011, 0x8F660001, 0xFB411011, 0x8FB60001, 0xFB411011, 0x8FB60001,
+        0x00008C11, 0xFB411011, 0x8FB60001, 0x00008C91, 0xFB411011, 0x90910001,
+        0x00008C11, 0xFB411011, 0x94850001, 0xFB411011, 0x95770001, 0xFB411011,
+        0x95780001, 0xFB411011, 0x957F0001, 0xFB411011, 0x95E80001, 0xFB411011,
+        0x961C0001, 0x00008C11, 0xFB411011, 0x961D0001, 0xFB411011, 0x96E80001,
+        0x00008C11, 0xFB411011, 0x97520001, 0xFB411011, 0x97E60001, 0xFB411011,
+        0x98750001, 0xFB411011, 0x98CE0001, 0xFB411011, 0x98DE0001, 0xFB411011,
+        0x98DF0001, 0xFB411011, 0x98E00001, 0x00008C11, 0xFB411011, 0x98E00001,
+        0xFB411011, 0x99630001, 0xFB411011, 0x99960001, 0x00008C11, 0xFB411011,
+        0x9A6C0001, 0xFB411011, 0x9AA80001, 0x00008C11, 0xFB411011, 0x9B3C0001,
+        0x00008C11, 0xFB411011, 0x9C7C0001, 0xFB411011, 0x9E1F0001, 0xFB411011,
+        0x9E750001, 0x00008C11, 0xFB411011, 0x9EA60001, 0xFB411011, 0x9EC40001,
+        0xFB411011, 0x9EFE0001, 0xFB411011, 0x9F4A0001, 0x00008C11, 0xFB411011,
+        0x9F500001, 0xFB411011, 0x9F520001, 0x00008C11, 0xFB411011, 0x9F7F0001,
+        0xFB411011, 0x9F8D0001, 0x00008C11, 0xFB411011, 0x9F990001, 0xFB411011,
+        0x9F9C0001, 0x00008C11, 0xFB411011, 0x9F9C0001, 0x00008C91, 0xFB411011,
+        0x9F9F0001, 0xFB401011, 0xCE000001, 0xFB401011, 0xCE280001, 0xFB401011,
+        0xCE360001, 0xFB401011, 0xCE3F0001, 0xFB401011, 0xCE590001, 0xFB401011,
+        0xCE850001, 0xFB401011, 0xCE8C0001, 0xFB401011, 0xCEA00001, 0xFB401011,
+        0xCEBA0001, 0xFB401011, 0xD13F0001, 0xFB401011, 0xD1650001, 0xFB401011,
+        0xD16B0001, 0xFB401011, 0xD1820001, 0xFB401011, 0xD1960001, 0xFB401011,
+        0xD1AB0001, 0xFB401011, 0xD1E00001, 0xFB401011, 0xD1F50001, 0xFB401011,
+        0xD2000001, 0xFB401011, 0xD29B0001, 0xFB401011, 0xD2F90001, 0xFB401011,
+        0xD3150001, 0xFB401011, 0xD31A0001, 0xFB401011, 0xD3380001, 0xFB401011,
+        0xD3410001, 0xFB401011, 0xD35C0001, 0xFB401011, 0xD3690001, 0xFB401011,
+        0xD3820001, 0xFB401011, 0xD3B60001, 0xFB401011, 0xD3C80001, 0xFB401011,
+        0xD3E30001, 0xFB401011, 0xD6D70001, 0xFB401011, 0xD71F0001, 0xFB401011,
+        0xD8EB0001, 0xFB401011, 0xD9020001, 0xFB401011, 0xD90A0001, 0xFB401011,
+        0xD9150001, 0xFB401011, 0xD9270001, 0xFB401011, 0xD9730001, 0xFB401011,
+        0xDB500001, 0xFB401011, 0xDB800001, 0xFB401011, 0xDBF80001, 0xFB401011,
+        0xDC0F0001, 0xFB401011, 0xDC380001, 0xFB401011, 0xDC6E0001, 0xFB401011,
+        0xDC710001, 0xFB401011, 0xDDDB0001, 0xFB401011, 0xDDE50001, 0xFB401011,
+        0xDDF10001, 0xFB401011, 0xDDFE0001, 0xFB401011, 0xDE720001, 0xFB401011,
+        0xDE7F0001, 0xFB401011, 0xDEF40001, 0xFB401011, 0xDEFE0001, 0xFB401011,
+        0xDF0B0001, 0xFB401011, 0xDF130001, 0xFB401011, 0xDF500001, 0xFB401011,
+        0xDF610001, 0xFB401011, 0xDF730001, 0xFB401011, 0xDFC30001, 0xFB401011,
+        0xE2080001, 0xFB401011, 0xE2360001, 0xFB401011, 0xE24B0001, 0xFB401011,
+        0xE52F0001, 0xFB401011, 0xE5340001, 0xFB401011, 0xE5870001, 0xFB401011,
+        0xE5970001, 0xFB401011, 0xE5A40001, 0xFB401011, 0xE5B90001, 0xFB401011,
+        0xE5E00001, 0xFB401011, 0xE5E50001, 0xFB401011, 0xE6F00001, 0xFB401011,
+        0xE7080001, 0xFB401011, 0xE7280001, 0xFB401011, 0xEB200001, 0xFB401011,
+        0xEB620001, 0xFB401011, 0xEB790001, 0xFB401011, 0xEBB30001, 0xFB401011,
+        0xEBCB0001, 0xFB401011, 0xEBD40001, 0xFB401011, 0xEBDB0001, 0xFB401011,
+        0xEC0F0001, 0xFB401011, 0xEC140001, 0xFB401011, 0xEC340001, 0xFB401011,
+        0xF06B0001, 0xFB401011, 0xF22A0001, 0xFB401011, 0xF2360001, 0xFB401011,
+        0xF23B0001, 0xFB401011, 0xF23F0001, 0xFB401011, 0xF2470001, 0xFB401011,
+        0xF2590001, 0xFB401011, 0xF25B0001, 0xFB401011, 0xF2AC0001, 0xFB401011,
+        0xF3840001, 0xFB401011, 0xF3890001, 0xFB401011, 0xF4DC0001, 0xFB401011,
+        0xF4E60001, 0xFB401011, 0xF5180001, 0xFB401011, 0xF51F0001, 0xFB401011,
+        0xF5280001, 0xFB401011, 0xF5300001, 0xFB401011, 0xF58B0001, 0xFB401011,
+        0xF5920001, 0xFB401011, 0xF6760001, 0xFB401011, 0xF67D0001, 0xFB401011,
+        0xF6AE0001, 0xFB401011, 0xF6BF0001, 0xFB401011, 0xF6EE0001, 0xFB401011,
+        0xF7DB0001, 0xFB401011, 0xF7E20001, 0xFB401011, 0xF7F30001, 0xFB401011,
+        0xF93A0001, 0xFB401011, 0xF9B80001, 0xFB401011, 0xF9BE0001, 0xFB401011,
+        0xFA740001, 0xFB401011, 0xFACB0001, 0xFB401011, 0xFAF90001, 0xFB401011,
+        0xFC730001, 0xFB401011, 0xFCF80001, 0xFB401011, 0xFF360001, 0xFB401011,
+        0xFF510001, 0xFB401011, 0xFF8A0001, 0xFB401011, 0xFFBD0001, 0xFB411011,
+        0x80010001, 0xFB411011, 0x800C0001, 0xFB411011, 0x80120001, 0xFB411011,
+        0x80330001, 0xFB411011, 0x807F0001, 0xFB411011, 0x80890001, 0xFB411011,
+        0x81E30001, 0xFB411011, 0x81EA0001, 0xFB411011, 0x81F30001, 0xFB411011,
+        0x81FC0001, 0xFB411011, 0x820C0001, 0xFB411011, 0x821B0001, 0xFB411011,
+        0x821F0001, 0xFB411011, 0x826E0001, 0xFB411011, 0x82720001, 0xFB411011,
+        0x82780001, 0xFB411011, 0x864D0001, 0xFB411011, 0x866B0001, 0xFB411011,
+        0x88400001, 0xFB411011, 0x884C0001, 0xFB411011, 0x88630001, 0xFB411011,
+        0x897E0001, 0xFB411011, 0x898B0001, 0xFB411011, 0x8A000001, 0xFB411011,
+        0x8C370001, 0xFB411011, 0x8C460001, 0xFB411011, 0x8C550001, 0xFB411011,
+        0x8C780001, 0xFB411011, 0x8C9D0001, 0xFB411011, 0x8D640001, 0xFB411011,
+        0x8D700001, 0xFB411011, 0x8DB30001, 0xFB411011, 0x8EAB0001, 0xFB411011,
+        0x8ECA0001, 0xFB411011, 0x8F9B0001, 0xFB411011, 0x8FB00001, 0xFB411011,
+        0x8FB50001, 0xFB411011, 0x90910001, 0xFB411011, 0x91490001, 0xFB411011,
+        0x91C60001, 0xFB411011, 0x91CC0001, 0xFB411011, 0x91D10001, 0xFB411011,
+        0x95800001, 0xFB411011, 0x961C0001, 0xFB411011, 0x96B60001, 0xFB411011,
+        0x96B90001, 0xFB411011, 0x96E80001, 0xFB411011, 0x97510001, 0xFB411011,
+        0x975E0001, 0xFB411011, 0x97620001, 0xFB411011, 0x97690001, 0xFB411011,
+        0x97CB0001, 0xFB411011, 0x97ED0001, 0xFB411011, 0x97F30001, 0xFB411011,
+        0x98010001, 0xFB411011, 0x98A80001, 0xFB411011, 0x98DB0001, 0xFB411011,
+        0x99960001, 0xFB411011, 0x99990001, 0xFB411011, 0x99AC0001, 0xFB411011,
+        0x9AA80001, 0xFB411011, 0x9AD80001, 0xFB411011, 0x9ADF0001, 0xFB411011,
+        0x9B250001, 0xFB411011, 0x9B2F0001, 0xFB411011, 0x9B320001, 0xFB411011,
+        0x9B3C0001, 0xFB411011, 0x9B5A0001, 0xFB411011, 0x9CE50001, 0xFB411011,
+        0x9E750001, 0xFB411011, 0x9E7F0001, 0xFB411011, 0x9EA50001, 0xFB411011,
+        0x9EBB0001, 0xFB411011, 0x9EC30001, 0xFB411011, 0x9ECD0001, 0xFB411011,
+        0x9ED10001, 0xFB411011, 0x9EF90001, 0xFB411011, 0x9EFD0001, 0xFB411011,
+        0x9F0E0001, 0xFB411011, 0x9F130001, 0xFB411011, 0x9F200001, 0xFB411011,
+        0x9F3B0001, 0xFB411011, 0x9F4A0001, 0xFB411011, 0x9F520001, 0xFB411011,
+        0x9F8D0001, 0xFB411011, 0x9F9C0001, 0xFB411011, 0x9FA00001, 0x42E61011,
+        0x42FC1011, 0x1F5C1009, 0x00001B89, 0x1F5D1009, 0x00001B89, 0xFB401011,
+        0xD3440001, 0xFB401011, 0xD3450001, 0x42F91011, 0x42E71011, 0x43001059,
+        0x43021059, 0x42E41059, 0x42EE1059, 0xFB401051, 0xCE000001, 0xFB401051,
+        0xCE8C0001, 0xFB401051, 0xCE090001, 0xFB401051, 0xD6DB0001, 0xFB401051,
+        0xCE0A0001, 0xFB401051, 0xCE2D0001, 0xFB401051, 0xCE0B0001, 0xFB401051,
+        0xF5320001, 0xFB401051, 0xCE590001, 0xFB401051, 0xCE190001, 0xFB401051,
+        0xCE010001, 0xFB401051, 0xD9290001, 0xFB401051, 0xD7300001, 0xFB401051,
+        0xCEBA0001, 0x44291011, 0x00008C91, 0x44431011, 0x00008C91, 0x44391011,
+        0x00008C91, 0x44341011, 0x00008C91, 0x444E1011, 0x00008C91, 0x444A1011,
+        0x00008C91, 0x445C1011, 0x00008D11, 0x44491011, 0x00008C91, 0x445B1011,
+        0x00008C91, 0x445C1011, 0x00008C91, 0x444F1011, 0x00008C91, 0x44511011,
+        0x00008C91, 0x445B1059, 0x00008CD9, 0x03281011, 0x41751011, 0x03291011,
+        0x03281011, 0x41771011, 0x03291011, 0x03281011, 0x41781011, 0x03291011,
+        0x03281011, 0x417A1011, 0x03291011, 0x03281011, 0x417B1011, 0x03291011,
+        0x03281011, 0x417C1011, 0x03291011, 0x03281011, 0x417E1011, 0x03291011,
+        0x03281011, 0x41801011, 0x03291011, 0x03281011, 0x41811011, 0x03291011,
+        0x03281011, 0x41831011, 0x03291011, 0x03281011, 0x41841011, 0x03291011,
+        0x03281011, 0x41851011, 0x03291011, 0x03281011, 0x41861011, 0x03291011,
+        0x03281011, 0x41871011, 0x03291011, 0x03281011, 0x41751011, 0x41F31011,
+        0x03291011, 0x03281011, 0x41771011, 0x41F31011, 0x03291011, 0x03281011,
+        0x41781011, 0x41F31011, 0x03291011, 0x03281011, 0x417A1011, 0x41F31011,
+        0x03291011, 0x03281011, 0x417B1011, 0x41F31011, 0x03291011, 0x03281011,
+        0x417C1011, 0x41F31011, 0x03291011, 0x03281011, 0x417E1011, 0x41F31011,
+        0x03291011, 0x03281011, 0x41801011, 0x41F31011, 0x03291011, 0x03281011,
+        0x41811011, 0x41F31011, 0x03291011, 0x03281011, 0x41831011, 0x41F31011,
+        0x03291011, 0x03281011, 0x41841011, 0x41F31011, 0x03291011, 0x03281011,
+        0x41851011, 0x41F31011, 0x03291011, 0x03281011, 0x41861011, 0x41F31011,
+        0x03291011, 0x03281011, 0x41871011, 0x41F31011, 0x03291011, 0x03281011,
+        0x41811011, 0x42001011, 0x03291011, 0x03281011, 0x41801011, 0x41FB1011,
+        0x41811011, 0x41F71011, 0x42541011, 0x03291011, 0x03281011, 0x41801011,
+        0x41FB1011, 0x41871011, 0x42001011, 0x03291011, 0x03281011, 0xFB401011,
+        0xCE000001, 0x03291011, 0x03281011, 0xFB401011, 0xCE8C0001, 0x03291011,
+        0x03281011, 0xFB401011, 0xCE090001, 0x03291011, 0x03281011, 0xFB401011,
+        0xD6DB0001, 0x03291011, 0x03281011, 0xFB401011, 0xCE940001, 0x03291011,
+        0x03281011, 0xFB401011, 0xD16D0001, 0x03291011, 0x03281011, 0xFB401011,
+        0xCE030001, 0x03291011, 0x03281011, 0xFB401011, 0xD16B0001, 0x03291011,
+        0x03281011, 0xFB401011, 0xCE5D0001, 0x03291011, 0x03281011, 0xFB401011,
+        0xD3410001, 0x03291011, 0x03281011, 0xFB401011, 0xE7080001, 0x03291011,
+        0x03281011, 0xFB401011, 0xF06B0001, 0x03291011, 0x03281011, 0xFB401011,
+        0xEC340001, 0x03291011, 0x03281011, 0xFB401011, 0xE7280001, 0x03291011,
+        0x03281011, 0xFB411011, 0x91D10001, 0x03291011, 0x03281011, 0xFB401011,
+        0xD71F0001, 0x03291011, 0x03281011, 0xFB401011, 0xE5E50001, 0x03291011,
+        0x03281011, 0xFB401011, 0xE82A0001, 0x03291011, 0x03281011, 0xFB401011,
+        0xE7090001, 0x03291011, 0x03281011, 0xFB401011, 0xF93E0001, 0x03291011,
+        0x03281011, 0xFB401011, 0xD40D0001, 0x03291011, 0x03281011, 0xFB401011,
+        0xF2790001, 0x03291011, 0x03281011, 0xFB411011, 0x8CA10001, 0x03291011,
+        0x03281011, 0xFB401011, 0xF95D0001, 0x03291011, 0x03281011, 0xFB401011,
+        0xD2B40001, 0x03291011, 0x03281011, 0xFB401011, 0xCEE30001, 0x03291011,
+        0x03281011, 0xFB401011, 0xD47C0001, 0x03291011, 0x03281011, 0xFB401011,
+        0xDB660001, 0x03291011, 0x03281011, 0xFB401011, 0xF6E30001, 0x03291011,
+        0x03281011, 0xFB401011, 0xCF010001, 0x03291011, 0x03281011, 0xFB411011,
+        0x8CC70001, 0x03291011, 0x03281011, 0xFB401011, 0xD3540001, 0x03291011,
+        0x03281011, 0xFB401011, 0xF96D0001, 0x03291011, 0x03281011, 0xFB401011,
+        0xCF110001, 0x03291011, 0x03281011, 0xFB411011, 0x81EA0001, 0x03291011,
+        0x03281011, 0xFB411011, 0x81F30001, 0x03291011, 0xFB401019, 0xD54F0001,
+        0xFB401019, 0xDE7C0001, 0xFB401019, 0xE5870001, 0xFB401019, 0xFB8F0001,
+        0x1F9B1019, 0x1F981019, 0x1F9C1019, 0x1F981019, 0x1F9D1019, 0x1F981019,
+        0x1F9E1019, 0x1F981019, 0x1F9F1019, 0x1F981019, 0x1FA01019, 0x1F981019,
+        0x216B1075, 0x21F71075, 0x20071075, 0x1F9A1019, 0x1F991019, 0x1F9A1019,
+        0x1F9A1019, 0x1F9A1019, 0x1F9B1019, 0x1F9A1019, 0x1F9C1019, 0x1F9A1019,
+        0x1F9D1019, 0x1F9A1019, 0x1F9E1019, 0x1F9A1019, 0x1F9F1019, 0x1F9A1019,
+        0x1FA01019, 0x1F9A1019, 0x1FA11019, 0x1F9B1019, 0x1F991019, 0x1F9B1019,
+        0x1F9A1019, 0x1F9B1019, 0x1F9B1019, 0x1F9B1019, 0x1F9C1019, 0x1F9B1019,
+        0x1F9D1019, 0x41751019, 0x41F31019, 0x41771019, 0x41F31019, 0x41781019,
+        0x41F31019, 0x417A1019, 0x41F31019, 0x417B1019, 0x41F31019, 0x417C1019,
+        0x41F31019, 0x417E1019, 0x41F31019, 0x41801019, 0x41F31019, 0x41811019,
+        0x41F31019, 0x41831019, 0x41F31019, 0x41841019, 0x41F31019, 0x41851019,
+        0x41F31019, 0x41861019, 0x41F31019, 0x41871019, 0x41F31019, 0x41831019,
+        0x41F31019, 0x42601019, 0x41751019, 0x41FB1019, 0x41811019, 0x42001019,
+        0x41801019, 0x42061019, 0x41801019, 0x42001019, 0xFB401019, 0xCE000001,
+        0xFB401019, 0xCE8C0001, 0xFB401019, 0xCE090001, 0xFB401019, 0xD6DB0001,
+        0xFB401019, 0xCE940001, 0xFB401019, 0xD16D0001, 0xFB401019, 0xCE030001,
+        0xFB401019, 0xD16B0001, 0xFB401019, 0xCE5D0001, 0xFB401019, 0xD3410001,
+        0xFB401019, 0xE7080001, 0xFB401019, 0xF06B0001, 0xFB401019, 0xEC340001,
+        0xFB401019, 0xE7280001, 0xFB411019, 0x91D10001, 0xFB401019, 0xD71F0001,
+        0xFB401019, 0xE5E50001, 0xFB401019, 0xE82A0001, 0xFB401019, 0xE7090001,
+        0xFB401019, 0xF93E0001, 0xFB401019, 0xD40D0001, 0xFB401019, 0xF2790001,
+        0xFB411019, 0x8CA10001, 0xFB401019, 0xF95D0001, 0xFB401019, 0xD2B40001,
+        0xFB401019, 0xF9D80001, 0xFB401019, 0xF5370001, 0xFB401019, 0xD9730001,
+        0xFB411019, 0x90690001, 0xFB401019, 0xD12A0001, 0xFB401019, 0xD3700001,
+        0xFB401019, 0xECE80001, 0xFB411019, 0x98050001, 0xFB401019, 0xCF110001,
+        0xFB401019, 0xD1990001, 0xFB401019, 0xEB630001, 0xFB401019, 0xCE0A0001,
+        0xFB401019, 0xCE2D0001, 0xFB401019, 0xCE0B0001, 0xFB401019, 0xDDE60001,
+        0xFB401019, 0xD3F30001, 0xFB401019, 0xD33B0001, 0xFB401019, 0xDB970001,
+        0xFB401019, 0xDB660001, 0xFB401019, 0xF6E30001, 0xFB401019, 0xCF010001,
+        0xFB411019, 0x8CC70001, 0xFB401019, 0xD3540001, 0xFB401019, 0xD91C0001,
+        0x1F9B1019, 0x1F9E1019, 0x1F9B1019, 0x1F9F1019, 0x1F9B1019, 0x1FA01019,
+        0x1F9B1019, 0x1FA11019, 0x1F9C1019, 0x1F991019, 0x1F9C1019, 0x1F9A1019,
+        0x1F9C1019, 0x1F9B1019, 0x1F9C1019, 0x1F9C1019, 0x1F9C1019, 0x1F9D1019,
+        0x1F9C1019, 0x1F9E1019, 0x1F9C1019, 0x1F9F1019, 0x1F9C1019, 0x1FA01019,
+        0x1F9C1019, 0x1FA11019, 0x1F991011, 0xFB401011, 0xE7080001, 0x1F9A1011,
+        0xFB401011, 0xE7080001, 0x1F9B1011, 0xFB401011, 0xE7080001, 0x1F9C1011,
+        0xFB401011, 0xE7080001, 0x1F9D1011, 0xFB401011, 0xE7080001, 0x1F9E1011,
+        0xFB401011, 0xE7080001, 0x1F9F1011, 0xFB401011, 0xE7080001, 0x1FA01011,
+        0xFB401011, 0xE7080001, 0x1FA11011, 0xFB401011, 0xE7080001, 0x1F991011,
+        0x1F981011, 0xFB401011, 0xE7080001, 0x1F991011, 0x1F991011, 0xFB401011,
+        0xE7080001, 0x1F991011, 0x1F9A1011, 0xFB401011, 0xE7080001, 0x20751075,
+        0x20511071, 0x20071071, 0x21931071, 0x20511071, 0x20071071, 0x22471075,
+        0x20D61075, 0x21F71075, 0x1FEB1075, 0xFB401071, 0xCEE40001, 0xFB401071,
+        0xD48C0001, 0x42DA1071, 0x42F41071, 0x00001C71, 0x1F601071, 0x42EE1071,
+        0x42DA1071, 0x43031071, 0x42F61071, 0x42DA1071, 0x42DA1071, 0x430A1071,
+        0x42F71071, 0x00001C71, 0x42DA1071, 0x42DA1071, 0x1F601071, 0x43031071,
+        0x42DB1071, 0x42F01071, 0x430A1071, 0x42E21071, 0x00001BF1, 0x42DB1071,
+        0x430A1071, 0x42EB1071, 0x42DC1071, 0x42DF1071, 0x430A1071, 0x42DE1071,
+        0x42E71071, 0x42E21071, 0x1F601071, 0x42EE1071, 0x00001BF1, 0x42DE1071,
+        0x1F601071, 0x42E01071, 0x1F601071, 0x42DF1071, 0x430A1071, 0x42E71071,
+        0x42DF1071, 0x1F601071, 0x42FB1071, 0x42E01071, 0x42DB1071, 0x43021071,
+        0x42E01071, 0x43011071, 0x42EC1071, 0x42EE1071, 0x42E01071, 0x43051071,
+        0x43021071, 0x1F601071, 0x42E01071, 0x00001BF1, 0x43051071, 0x430A1071,
+        0x42E01071, 0x00001BF1, 0x430A1071, 0x42F91071, 0x42E11071, 0x00001BF1,
+        0x42E01071, 0x00001BF1, 0x42E11071, 0x00001BF1, 0x42F01071, 0x1F601071,
+        0x42E11071, 0x42FF1071, 0x43021071, 0x1F601071, 0x42E11071, 0x00001BF1,
+        0x43031071, 0x42EA1071, 0x00001BF1, 0x1F601071, 0x42E11071, 0x43051071,
+        0x42E11071, 0x43051071, 0x42E21071, 0x00001BF1, 0x43011071, 0x42FB1071,
+        0x42E11071, 0x43051071, 0x42FC1071, 0x1F601071, 0x42EE1071, 0x43031071,
+        0x42E11071, 0x43051071, 0x43061071, 0x42EC1071, 0x42EE1071, 0x42E21071,
+        0x00001BF1, 0x43011071, 0x42FB1071, 0x42E21071, 0x00001BF1, 0x43011071,
+        0x42FB1071, 0x42EE1071, 0x430A1071, 0x42E21071, 0x43031071, 0x42E81071,
+        0x00001BF1, 0x42DB1071, 0x43051071, 0x42E21071, 0x43051071, 0x1F601071,
+        0x42F21071, 0x42E31071, 0x1F601071, 0x42E71071, 0x42E41071, 0x43031071,
+        0x42EF1071, 0x42E41071, 0x1F601071, 0x42F81071, 0x00001C71, 0x42E51071,
+        0x42DB1071, 0x42E21071, 0x43031071, 0x42E51071, 0x430A1071, 0x42EB1071,
+        0x1F601071, 0x42FB1071, 0x42E61071, 0x43021071, 0x430A1071, 0x42E21071,
+        0x00001BF1, 0x42E81071, 0x430A1071, 0x42EB1071, 0x42E81071, 0x430A1071,
+        0x42EE1071, 0x42EA1071, 0x00001BF1, 0x1F601071, 0x42E71071, 0x42ED1071,
+        0x00001BF1, 0x42E61071, 0x42EE1071, 0x00001BF1, 0x43031071, 0x42EE1071,
+        0x430A1071, 0x42EF1071, 0x42F31071, 0x42F31071, 0x42EC1071, 0x42EE1071,
+        0x42F41071, 0x42DB1071, 0x42EC1071, 0x42F41071, 0x00001C71, 0x1F601071,
+        0x42E81071, 0x430A1071, 0x42EE1071, 0x42F41071, 0x00001C71, 0x1F601071,
+        0x42EC1071, 0x42F41071, 0x00001BF1, 0x1F601071, 0x43041071, 0x43031071,
+        0x42F51071, 0x00001C71, 0x42DA1071, 0x42E71071, 0x42EE1071, 0x43031071,
+        0x42F51071, 0x00001C71, 0x42E21071, 0x43031071, 0x42F51071, 0x00001C71,
+        0x42E41071, 0x42F51071, 0x00001BF1, 0x43031071, 0x42F61071, 0x42DA1071,
+        0x43011071, 0x42EC1071, 0x42EE1071, 0x00001BF1, 0x42F61071, 0x42DB1071,
+        0x1F601071, 0x42EE1071, 0x42F61071, 0x00001BF1, 0x42EC1071, 0x42E61071,
+        0x42DE1071, 0x43031071, 0x42F61071, 0x43011071, 0x430A1071, 0x42F71071,
+        0x42E21071, 0x42EA1071, 0x1F601071, 0x43031071, 0x42F71071, 0x00001C71,
+        0x42E91071, 0x42F71071, 0x00001C71, 0x42F01071, 0x42F51071, 0x42F71071,
+        0x43031071, 0x42EC1071, 0x42F71071, 0x00001C71, 0x430A1071, 0x42E71071,
+        0x42F71071, 0x00001C71, 0x1F601071, 0x42E61071, 0x00001BF1, 0x42F71071,
+        0x00001BF1, 0x1F601071, 0x42EA1071, 0x42F81071, 0x00001C71, 0x42DB1071,
+        0x430A1071, 0x42EE1071, 0x42F81071, 0x00001BF1, 0x43031071, 0x42EE1071,
+        0x42F81071, 0x430A1071, 0x42F81071, 0x00001C71, 0x430A1071, 0x42EE1071,
+        0x00001BF1, 0x42F81071, 0x1F601071, 0x43031071, 0x42F81071, 0x1F601071,
+        0x430A1071, 0x42F91071, 0x42DB1071, 0x42E21071, 0x43051071, 0x42F91071,
+        0x42DB1071, 0x43031071, 0x42F91071, 0x42EC1071, 0x42F41071, 0x42F91071,
+        0x43031071, 0x42E21071, 0x42F91071, 0x430A1071, 0x42E61071, 0x43001071,
+        0x430A1071, 0x42FA1071, 0x42E21071, 0x43051071, 0x430A1071, 0x42FA1071,
+        0x43021071, 0x42FA1071, 0x43021071, 0x42F41071, 0x00001BF1, 0x1F601071,
+        0x43031071, 0x42FC1071, 0x42E01071, 0x00001BF1, 0x42FC1071, 0x42E01071,
+        0x00001BF1, 0x42EE1071, 0x430A1071, 0x42FC1071, 0x1F601071, 0x42EE1071,
+        0x43031071, 0x42FE1071, 0x1F601071, 0x42EE1071, 0x00001BF1, 0x42FE1071,
+        0x1F601071, 0x43031071, 0x42FF1071, 0x42DA1071, 0x430A1071, 0x43021071,
+        0x42EC1071, 0x42EE1071, 0x43031071, 0x43021071, 0x43011071, 0x43031071,
+        0x42F51071, 0x00001C71, 0x1F601071, 0x43031071, 0x1F601071, 0x42F61071,
+        0x00001BF1, 0x43031071, 0x43041071, 0x42FB1071, 0x43041071, 0x430A1071,
+        0x42EE1071, 0x42E31071, 0x00001BF1, 0x430A1071, 0x43061071, 0x42EC1071,
+        0x42EE1071, 0x1F981011, 0xFB401011, 0xF0B90001, 0x1F991011, 0xFB401011,
+        0xF0B90001, 0x1F9A1011, 0xFB401011, 0xF0B90001, 0x1F9B1011, 0xFB401011,
+        0xF0B90001, 0x1F9C1011, 0xFB401011, 0xF0B90001, 0x1F9D1011, 0xFB401011,
+        0xF0B90001, 0x1F9E1011, 0xFB401011, 0xF0B90001, 0x1F9F1011, 0xFB401011,
+        0xF0B90001, 0x1FA01011, 0xFB401011, 0xF0B90001, 0x1FA11011, 0xFB401011,
+        0xF0B90001, 0x1F991011, 0x1F981011, 0xFB401011, 0xF0B90001, 0x1F991011,
+        0x1F991011, 0xFB401011, 0xF0B90001, 0x1F991011, 0x1F9A1011, 0xFB401011,
+        0xF0B90001, 0x1F991011, 0x1F9B1011, 0xFB401011, 0xF0B90001, 0x1F991011,
+        0x1F9C1011, 0xFB401011, 0xF0B90001, 0x1F991011, 0x1F9D1011, 0xFB401011,
+        0xF0B90001, 0x1F991011, 0x1F9E1011, 0xFB401011, 0xF0B90001, 0x1F991011,
+        0x1F9F1011, 0xFB401011, 0xF0B90001, 0x1F991011, 0x1FA01011, 0xFB401011,
+        0xF0B90001, 0x1F991011, 0x1FA11011, 0xFB401011, 0xF0B90001, 0x1F9A1011,
+        0x1F981011, 0xFB401011, 0xF0B90001, 0x1F9A1011, 0x1F991011, 0xFB401011,
+        0xF0B90001, 0x1F9A1011, 0x1F9A1011, 0xFB401011, 0xF0B90001, 0x1F9A1011,
+        0x1F9B1011, 0xFB401011, 0xF0B90001, 0x1F9A1011, 0x1F9C1011, 0xFB401011,
+        0xF0B90001, 0x20751071, 0x216B1075, 0x1FA21071, 0x1FEB1071, 0x1FA21071,
+        0x1FA21075, 0x22171075, 0x1FBC1071, 0x1FA21071, 0x21931071, 0x213C1071,
+        0x22471075, 0x216B1071, 0x1FD61071, 0x1FEB1071, 0x21091071, 0x1FEB1071,
+        0x21091071, 0x1F9A1071, 0x1FEB1071, 0x21091071, 0x1F9B1071, 0x20901075,
+        0x22171075, 0xFB401071, 0xDE730001, 0xFB401071, 0xE2100001, 0xFB401071,
+        0xE62D0001, 0xFB401071, 0xD48C0001, 0xFB401071, 0xD9270001, 0xFB401071,
+        0xEB630001, 0xFB401071, 0xE60E0001, 0xFB401071, 0xECBB0001, 0xFB401071,
+        0xE82A0001, 0xFB401071, 0xDF0F0001, 0xFB401071, 0xCF1A0001, 0xFB401071,
+        0xF93E0001, 0x216B1071, 0x1FA21075, 0x21181071, 0x1FA21075, 0x23301071,
+        0x1FA21075, 0x21091071, 0x1FA21075, 0x20C41071, 0x1FA21075, 0x20C41075,
+        0x1FBC1075, 0x21091075, 0x1FBC1075, 0x20511075, 0x1FBC1075, 0x1FD61071,
+        0x1FA21071, 0x20D61071, 0x20C41071, 0x1FD61071, 0x1FA21071, 0x20D61071,
+        0x216B1071, 0x20421075, 0x21181071, 0x20421075, 0x23301071, 0x20421075,
+        0x23301071, 0x20511071, 0x21091071, 0x20511071, 0x20C41071, 0x20511071,
+        0x20751075, 0x22861071, 0x20C41071, 0x20751075, 0x22861071, 0x21091075,
+        0x20751075, 0x22861071, 0x20511075, 0x20751075, 0x22861071, 0x21F71075,
+        0x20751075, 0x22861071, 0x23301071, 0x20D61071, 0x21091071, 0x20D61071,
+        0x1FEB1071, 0x20D61071, 0x20C41071, 0x20D61071, 0x20421071, 0x21091071,
+        0x21181071, 0x21091071, 0x23301071, 0x21091071, 0x21091071, 0x21091071,
+        0x1FD61071, 0x21091071, 0x20C41071, 0x21091071, 0x21091071, 0x21091071,
+        0x1F9A1071, 0x1FD61071, 0x21091071, 0x1F9A1071, 0x21091071, 0x1F9A1071,
+        0x20C41071, 0x21091071, 0x1F9A1071, 0x21091071, 0x21091071, 0x1F9B1071,
+        0x1FD61071, 0x21091071, 0x1F9B1071, 0x21091071, 0x1F9B1071, 0x20C41071,
+        0x21091071, 0x1F9B1071, 0x21091071, 0x06751071, 0x21D21071, 0x21091071,
+        0x06751071, 0x21D21071, 0x1F9A1071, 0x216B1075, 0x1FA21071, 0x20C41071,
+        0x216B1075, 0x1FA21071, 0x21091075, 0x216B1075, 0x1FA21071, 0x20511075,
+        0x216B1075, 0x1FA21071, 0x21931071, 0x1FA21071, 0x1FEB1071, 0x21931071,
+        0x1FA21071, 0x1FEB1071, 0x06751071, 0x21D21071, 0x21931071, 0x1FA21071,
+        0x1FEB1071, 0x06751071, 0x21D21071, 0x1F9A1071, 0x216B1071, 0x21D21071,
+        0x21181071, 0x21D21071, 0x23301071, 0x21D21071, 0x21091071, 0x21D21071,
+        0x216B1071, 0x22471075, 0x21181071, 0x22471075, 0x23301071, 0x22471075,
+        0x21091071, 0x22471075, 0x20C41071, 0x22471075, 0x21091075, 0x22471075,
+        0x216B1071, 0x22591075, 0x21181071, 0x22591075, 0x23301071, 0x22591075,
+        0x21091071, 0x22591075, 0x20C41071, 0x22591075, 0x21091075, 0x22591075,
+        0x20C41071, 0x23461075, 0x21091075, 0x23461075, 0x1FA21071, 0x027E1071,
+        0x21091071, 0x027E1071, 0x1FBC1075, 0x21801071, 0x1FD61071, 0x1FD61071,
+        0x1FD61071, 0x1FEB1071, 0x1FD61075, 0x06751071, 0x20C41071, 0x20511071,
+        0x1FD61075, 0x213C1071, 0x027E1071, 0x1FEB1071, 0x1FBC1075, 0x20511075,
+        0x22701071, 0x20751071, 0x1FA21071, 0x20751075, 0x216B1075, 0x20901071,
+        0x21181071, 0x20C41075, 0x20C41075, 0x20C41075, 0x21091075, 0x20C41071,
+        0x21F71071, 0x20D61071, 0x21091071, 0x20D61071, 0x21181071, 0x20D61071,
+        0x213C1071, 0x20511071, 0x20D61071, 0x22641071, 0x21091071, 0x1FBC1071,
+        0x21091071, 0x20901071, 0x20D61071, 0x21091071, 0x213C1071, 0x20D61071,
+        0x216B1075, 0x20751075, 0x216B1071, 0x027E1071, 0x21091071, 0x027E1071,
+        0x216B1075, 0x216B1075, 0x21091075, 0x216B1075, 0x21931075, 0x21D21071,
+        0x21931071, 0x21D21075, 0x22471071, 0x22591075, 0x1FBC1071, 0x22471075,
+        0x06751071, 0x21091071, 0x1FA21075, 0x06751071, 0x21091071, 0x1F991011,
+        0xFB401011, 0xE5E50001, 0x1F9A1011, 0xFB401011, 0xE5E50001, 0x1F9B1011,
+        0xFB401011, 0xE5E50001, 0x1F9C1011, 0xFB401011, 0xE5E50001, 0x1F9D1011,
+        0xFB401011, 0xE5E50001, 0x1F9E1011, 0xFB401011, 0xE5E50001, 0x1F9F1011,
+        0xFB401011, 0xE5E50001, 0x1FA01011, 0xFB401011, 0xE5E50001, 0x1FA11011,
+        0xFB401011, 0xE5E50001, 0x1F991011, 0x1F981011, 0xFB401011, 0xE5E50001,
+        0x1F991011, 0x1F991011, 0xFB401011, 0xE5E50001, 0x1F991011, 0x1F9A1011,
+        0xFB401011, 0xE5E50001, 0x1F991011, 0x1F9B1011, 0xFB401011, 0xE5E50001,
+        0x1F991011, 0x1F9C1011, 0xFB401011, 0xE5E50001, 0x1F991011, 0x1F9D1011,
+        0xFB401011, 0xE5E50001, 0x1F991011, 0x1F9E1011, 0xFB401011, 0xE5E50001,
+        0x1F991011, 0x1F9F1011, 0xFB401011, 0xE5E50001, 0x1F991011, 0x1FA01011,
+        0xFB401011, 0xE5E50001, 0x1F991011, 0x1FA11011, 0xFB401011, 0xE5E50001,
+        0x1F9A1011, 0x1F981011, 0xFB401011, 0xE5E50001, 0x1F9A1011, 0x1F991011,
+        0xFB401011, 0xE5E50001, 0x1F9A1011, 0x1F9A1011, 0xFB401011, 0xE5E50001,
+        0x1F9A1011, 0x1F9B1011, 0xFB401011, 0xE5E50001, 0x1F9A1011, 0x1F9C1011,
+        0xFB401011, 0xE5E50001, 0x1F9A1011, 0x1F9D1011, 0xFB401011, 0xE5E50001,
+        0x1F9A1011, 0x1F9E1011, 0xFB401011, 0xE5E50001, 0x1F9A1011, 0x1F9F1011,
+        0xFB401011, 0xE5E50001, 0x1F9A1011, 0x1FA01011, 0xFB401011, 0xE5E50001,
+        0x1F9A1011, 0x1FA11011, 0xFB401011, 0xE5E50001, 0x1F9B1011, 0x1F981011,
+        0xFB401011, 0xE5E50001, 0x1F9B1011, 0x1F991011, 0xFB401011, 0xE5E50001,
+        0x20511071, 0x1FA21071, 0x20D61071, 0x3CC51011, 0x3DC41011, 0x3CD71011,
+        0x3DC41011, 0x3CEC1011, 0x3DC41011, 0x3D001011, 0x3DC51011, 0x3D0B1011,
+        0x3DC41011, 0x3D111011, 0x3DC51011, 0x3D131011, 0x3DC51011, 0x3D191011,
+        0x3DC41011, 0x3D3E1011, 0x3DC41011, 0x3D6D1011, 0x3DC41011, 0x3D841011,
+        0x3DC41011, 0x3D8A1011, 0x3DC51011, 0x3D911011, 0x3DC41011, 0x23ED1011,
+        0x00001591, 0x21F71029, 0x22861011, 0x21F71011, 0x22861011, 0x1FA21029,
+        0x1FA21029, 0x1FA21011, 0x1FA21011, 0x1FA21029, 0x213C1029, 0x1FA21029,
+        0x22171029, 0x1FA21011, 0x22171011, 0x1FA21029, 0x22471029, 0x1FA21029,
+        0x00008C11, 0x22471029, 0x1FA21011, 0x00008C11, 0x22471011, 0x1FA21029,
+        0x22701029, 0x1FA21011, 0x22701011, 0x213C1029, 0x213C1029, 0x213C1011,
+        0x213C1011, 0x22471029, 0x22701029, 0x22471011, 0x22701011, 0x1FEB1029,
+        0x00008C91, 0x20421029, 0x00008C91, 0x20421011, 0x00008C91, 0x20511029,
+        0x00008C91, 0x21931029, 0x00008C91, 0x21931011, 0x00008C91, 0x21D21029,
+        0x00008C91, 0x21F71029, 0x00008C91, 0x21F71011, 0x00008C91, 0x1FA21029,
+        0x00001591, 0x213C1029, 0x00001591, 0x22171029, 0x00001591, 0x20511029,
+        0x00001A91, 0x20511011, 0x00001A91, 0x20C41029, 0x00001A91, 0x20C41011,
+        0x00001A91, 0x21181029, 0x00001A91, 0x21181011, 0x00001A91, 0x21931029,
+        0x00001A91, 0x21931011, 0x00001A91, 0x21D21029, 0x00001A91, 0x21D21011,
+        0x00001A91, 0x20751051, 0x00001CD1, 0x213C1051, 0x00008C51, 0x20071051,
+        0x1FEB1011, 0x22951011, 0x21F71011, 0x21DA1011, 0xFB411009, 0xFA0E0001,
+        0xFB411009, 0xFA0F0001, 0xFB411009, 0xFA110001, 0xFB411009, 0xFA130001,
+        0xFB411009, 0xFA140001, 0xFB411009, 0xFA1F0001, 0xFB411009, 0xFA210001,
+        0xFB411009, 0xFA230001, 0xFB411009, 0xFA240001, 0xFB411009, 0xFA270001,
+        0xFB411009, 0xFA280001, 0xFB411009, 0xFA290001, 0x20421011, 0x20421011,
+        0x20421011, 0x20901011, 0x20421011, 0x20D61011, 0x20421011, 0x20421011,
+        0x20901011, 0x20421011, 0x20421011, 0x20D61011, 0x21D21011, 0x00008C91,
+        0x21F71011, 0x21D21011, 0x21F71011, 0x26091011, 0x260C1011, 0x26091011,
+        0x25FA1011, 0x26091011, 0x26001011, 0x26141011, 0x260C1011, 0x26091011,
+        0x26021011, 0x261E1011, 0x26291011, 0x27271069, 0x000041E9, 0x27271065,
+        0x000041E5, 0x27451069, 0x000041E9, 0x27451065, 0x000041E5, 0x272C1069,
+        0x26641069, 0x266E1069, 0x26721069, 0x266E1065, 0x26721065, 0x266E1069,
+        0x27271069, 0x266E1065, 0x27271065, 0x266E1069, 0x27281069, 0x266E1065,
+        0x27281065, 0x266E1069, 0x272C1069, 0x266E1065, 0x272C1065, 0x266E1069,
+        0x272B1069, 0x266E1065, 0x272B1065, 0x266E1069, 0x272D1069, 0x266E1065,
+        0x272D1065, 0x266E1069, 0x273B1069, 0x266E1065, 0x273B1065, 0x266E105D,
+        0x273B105D, 0x266E1069, 0x27361069, 0x266E1065, 0x27361065, 0x266E105D,
+        0x2736105D, 0x266E1069, 0x268F1069, 0x266E1069, 0x26991069, 0x266E1069,
+        0x27141069, 0x266E1069, 0x27371069, 0x26741069, 0x268F1069, 0x26741069,
+        0x26991069, 0x26741069, 0x269A1069, 0x26741069, 0x27141069, 0x26741069,
+        0x27361069, 0x26741069, 0x27371069, 0x26851069, 0x268F1069, 0x26851069,
+        0x26991069, 0x26851069, 0x269A1069, 0x26851069, 0x27141069, 0x26851069,
+        0x27361069, 0x26851069, 0x27371069, 0x26861069, 0x268F1069, 0x26861069,
+        0x27141069, 0x26861069, 0x27361069, 0x26861069, 0x27371069, 0x268F1069,
+        0x26991069, 0x268F1069, 0x27141069, 0x26991069, 0x268F1069, 0x26991069,
+        0x27141069, 0x269A1069, 0x268F1069, 0x269A1069, 0x26991069, 0x269A1069,
+        0x27141069, 0x26C61069, 0x268F1069, 0x26C61069, 0x26991069, 0x26C61069,
+        0x269A1069, 0x26C61069, 0x27141069, 0x26D11069, 0x26991069, 0x26D11069,
+        0x27141069, 0x26D21069, 0x268F1069, 0x26D21069, 0x26991069, 0x26D21069,
+        0x269A1069, 0x26D21069, 0x27141069, 0x26D71069, 0x26991069, 0x26D71069,
+        0x27141069, 0x26D81069, 0x27141069, 0x26DB1069, 0x268F1069, 0x26DB1069,
+        0x27141069, 0x26DC1069, 0x268F1069, 0x26DC1069, 0x27141069, 0x26E41069,
+        0x268F1069, 0x26E41069, 0x26991069, 0x26E41069, 0x269A1069, 0x26E41069,
+        0x27141069, 0x26E41069, 0x27361069, 0x26E41069, 0x27371069, 0x26F01069,
+        0x26991069, 0x26F01069, 0x27141069, 0x26F01069, 0x27361069, 0x26F01069,
+        0x27371069, 0x26F61069, 0x26721069, 0x26F61069, 0x268F1069, 0x26F61069,
+        0x26991069, 0x26F61069, 0x269A1069, 0x26F61069, 0x270C1069, 0x26F61069,
+        0x27141069, 0x26F61069, 0x27361069, 0x26F61069, 0x27371069, 0x270C1069,
+        0x268F1069, 0x270C1069, 0x26991069, 0x270C1069, 0x269A1069, 0x270C1069,
+        0x27141069, 0x270C1069, 0x27361069, 0x270C1069, 0x27371069, 0x27141069,
+        0x268F1069, 0x27141069, 0x26991069, 0x27141069, 0x269A1069, 0x27141069,
+        0x27141069, 0x27141069, 0x27361069, 0x27141069, 0x27371069, 0x27181069,
+        0x268F1069, 0x27181069, 0x26991069, 0x27181069, 0x269A1069, 0x27181069,
+        0x27141069, 0x27181069, 0x27361069, 0x27181069, 0x27371069, 0x27221069,
+        0x268F1069, 0x27221069, 0x27141069, 0x27221069, 0x27361069, 0x27221069,
+        0x27371069, 0x27371069, 0x268F1069, 0x27371069, 0x26991069, 0x27371069,
+        0x269A1069, 0x27371069, 0x27141069, 0x27371069, 0x27361069, 0x27371069,
+        0x27371069, 0x26A51069, 0x00004C69, 0x26B31069, 0x00004C69, 0x27361069,
+        0x00004C69, 0x00003869, 0x00004069, 0x000039E9, 0x00004069, 0x00003B69,
+        0x00004069, 0x00003D69, 0x00004069, 0x00003EE9, 0x00004069, 0x00004069,
+        0x00004C69, 0x266E1065, 0x26B31065, 0x266E1065, 0x26B41065, 0x266E1065,
+        0x27141065, 0x266E1065, 0x27181065, 0x266E1065, 0x27371065, 0x26741065,
+        0x26B31065, 0x26741065, 0x26B41065, 0x26741065, 0x27141065, 0x26741065,
+        0x27181065, 0x26741065, 0x27361065, 0x26741065, 0x27371065, 0x26851065,
+        0x26B31065, 0x26851065, 0x26B41065, 0x26851065, 0x27141065, 0x26851065,
+        0x27181065, 0x26851065, 0x27361065, 0x26851065, 0x27371065, 0x26861065,
+        0x26B31065, 0x26861065, 0x26B41065, 0x26861065, 0x27141065, 0x26861065,
+        0x27181065, 0x26861065, 0x27361065, 0x26861065, 0x27371065, 0x26E41065,
+        0x27361065, 0x26E41065, 0x27371065, 0x26F01065, 0x27361065, 0x26F01065,
+        0x27371065, 0x26F61065, 0x26721065, 0x26F61065, 0x270C1065, 0x26F61065,
+        0x27141065, 0x26F61065, 0x27361065, 0x26F61065, 0x27371065, 0x270C1065,
+        0x27141065, 0x270C1065, 0x27361065, 0x270C1065, 0x27371065, 0x27141065,
+        0x26721065, 0x27141065, 0x27141065, 0x27181065, 0x26B31065, 0x27181065,
+        0x26B41065, 0x27181065, 0x27141065, 0x27181065, 0x27181065, 0x27181065,
+        0x27361065, 0x27181065, 0x27371065, 0x27361065, 0x00004C65, 0x27371065,
+        0x26B31065, 0x27371065, 0x26B41065, 0x27371065, 0x27141065, 0x27371065,
+        0x27181065, 0x27371065, 0x27361065, 0x27371065, 0x27371065, 0x266E105D,
+        0x268F105D, 0x266E105D, 0x2699105D, 0x266E105D, 0x269A105D, 0x266E105D,
+        0x2714105D, 0x266E105D, 0x2722105D, 0x2674105D, 0x268F105D, 0x2674105D,
+        0x2699105D, 0x2674105D, 0x269A105D, 0x2674105D, 0x2714105D, 0x2674105D,
+        0x2722105D, 0x2685105D, 0x268F105D, 0x2685105D, 0x2699105D, 0x2685105D,
+        0x269A105D, 0x2685105D, 0x2714105D, 0x2685105D, 0x2722105D, 0x2686105D,
+        0x2714105D, 0x268F105D, 0x2699105D, 0x268F105D, 0x2714105D, 0x2699105D,
+        0x268F105D, 0x2699105D, 0x2714105D, 0x269A105D, 0x268F105D, 0x269A105D,
+        0x2714105D, 0x26C6105D, 0x268F105D, 0x26C6105D, 0x2699105D, 0x26C6105D,
+        0x269A105D, 0x26C6105D, 0x2714105D, 0x26D1105D, 0x2699105D, 0x26D1105D,
+        0x269A105D, 0x26D1105D, 0x2714105D, 0x26D2105D, 0x268F105D, 0x26D2105D,
+        0x2699105D, 0x26D2105D, 0x269A105D, 0x26D2105D, 0x2714105D, 0x26D7105D,
+        0x2699105D, 0x26D8105D, 0x2714105D, 0x26DB105D, 0x268F105D, 0x26DB105D,
+        0x2714105D, 0x26DC105D, 0x268F105D, 0x26DC105D, 0x2714105D, 0x26E4105D,
+        0x268F105D, 0x26E4105D, 0x2699105D, 0x26E4105D, 0x269A105D, 0x26E4105D,
+        0x2714105D, 0x26F0105D, 0x2699105D, 0x26F0105D, 0x2714105D, 0x26F6105D,
+        0x268F105D, 0x26F6105D, 0x2699105D, 0x26F6105D, 0x269A105D, 0x26F6105D,
+        0x270C105D, 0x26F6105D, 0x2714105D, 0x270C105D, 0x268F105D, 0x270C105D,
+        0x2699105D, 0x270C105D, 0x269A105D, 0x270C105D, 0x2714105D, 0x270C105D,
+        0x2722105D, 0x2714105D, 0x268F105D, 0x2714105D, 0x2699105D, 0x2714105D,
+        0x269A105D, 0x2714105D, 0x2714105D, 0x2718105D, 0x268F105D, 0x2718105D,
+        0x2699105D, 0x2718105D, 0x269A105D, 0x2718105D, 0x2714105D, 0x2718105D,
+        0x2722105D, 0x2722105D, 0x268F105D, 0x2722105D, 0x2714105D, 0x2722105D,
+        0x00004C5D, 0x2737105D, 0x268F105D, 0x2737105D, 0x2699105D, 0x2737105D,
+        0x269A105D, 0x2737105D, 0x2714105D, 0x2737105D, 0x2722105D, 0x266E1061,
+        0x27141061, 0x266E1061, 0x27221061, 0x26741061, 0x27141061, 0x26741061,
+        0x27221061, 0x26851061, 0x27141061, 0x26851061, 0x27221061, 0x26861061,
+        0x27141061, 0x26861061, 0x27221061, 0x26C61061, 0x27141061, 0x26C61061,
+        0x27221061, 0x26C71061, 0x27141061, 0x26C71061, 0x27221061, 0x26F61061,
+        0x270C1061, 0x26F61061, 0x27141061, 0x270C1061, 0x27141061, 0x27181061,
+        0x27141061, 0x27181061, 0x27221061, 0x27371061, 0x27141061, 0x27371061,
+        0x27221061, 0x00003B61, 0x00004061, 0x00003D61, 0x00004061, 0x00003EE1,
+        0x00004061, 0x26D71069, 0x27361069, 0x26D71069, 0x27371069, 0x26DB1069,
+        0x27361069, 0x26DB1069, 0x27371069, 0x26DC1069, 0x27361069, 0x26DC1069,
+        0x27371069, 0x26C61069, 0x27361069, 0x26C61069, 0x27371069, 0x26C71069,
+        0x27361069, 0x26C71069, 0x27371069, 0x26991069, 0x27361069, 0x26991069,
+        0x27371069, 0x268F1069, 0x27361069, 0x268F1069, 0x27371069, 0x269A1069,
+        0x27361069, 0x269A1069, 0x27371069, 0x26D11069, 0x27361069, 0x26D11069,
+        0x27371069, 0x26D21069, 0x27361069, 0x26D21069, 0x27371069, 0x26C71069,
+        0x268F1069, 0x26C71069, 0x26991069, 0x26C71069, 0x269A1069, 0x26C71069,
+        0x27141069, 0x26C71069, 0x26B31069, 0x26C61069, 0x26B31069, 0x26D11069,
+        0x26B31069, 0x26D21069, 0x26B31069, 0x26D71065, 0x27361065, 0x26D71065,
+        0x27371065, 0x26DB1065, 0x27361065, 0x26DB1065, 0x27371065, 0x26DC1065,
+        0x27361065, 0x26DC1065, 0x27371065, 0x26C61065, 0x27361065, 0x26C61065,
+        0x27371065, 0x26C71065, 0x27361065, 0x26C71065, 0x27371065, 0x26991065,
+        0x27361065, 0x26991065, 0x27371065, 0x268F1065, 0x27361065, 0x268F1065,
+        0x27371065, 0x269A1065, 0x27361065, 0x269A1065, 0x27371065, 0x26D11065,
+        0x27361065, 0x26D11065, 0x27371065, 0x26D21065, 0x27361065, 0x26D21065,
+        0x27371065, 0x26C71065, 0x268F1065, 0x26C71065, 0x26991065, 0x26C71065,
+        0x269A1065, 0x26C71065, 0x27141065, 0x26C71065, 0x26B31065, 0x26C61065,
+        0x26B31065, 0x26D11065, 0x26B31065, 0x26D21065, 0x26B31065, 0x26C7105D,
+        0x268F105D, 0x26C7105D, 0x2699105D, 0x26C7105D, 0x269A105D, 0x26C7105D,
+        0x2714105D, 0x26C6105D, 0x2722105D, 0x26C7105D, 0x2722105D, 0x26D7105D,
+        0x2714105D, 0x26C61061, 0x268F1061, 0x26C61061, 0x26991061, 0x26C61061,
+        0x269A1061, 0x26C71061, 0x268F1061, 0x26C71061, 0x26991061, 0x26C71061,
+        0x269A1061, 0x26D71061, 0x27141061, 0x26D81061, 0x27141061, 0x26721065,
+        0x000036E5, 0x26721069, 0x000036E9, 0x2685105D, 0x268F105D, 0x2714105D,
+        0x26851065, 0x26991065, 0x268F1065, 0x2685105D, 0x2699105D, 0x268F105D,
+        0x2685105D, 0x2699105D, 0x2714105D, 0x2685105D, 0x269A105D, 0x2714105D,
+        0x2685105D, 0x2714105D, 0x268F105D, 0x2685105D, 0x2714105D, 0x2699105D,
+        0x2685105D, 0x2714105D, 0x269A105D, 0x268F1065, 0x27141065, 0x26991065,
+        0x268F105D, 0x2714105D, 0x2699105D, 0x26991065, 0x27141065, 0x27371065,
+        0x26991065, 0x27141065, 0x27361065, 0x26C6105D, 0x2699105D, 0x268F105D,
+        0x26C6105D, 0x268F105D, 0x2699105D, 0x26C61065, 0x268F1065, 0x27361065,
+        0x26C61065, 0x27141065, 0x26991065, 0x26C6105D, 0x2714105D, 0x2699105D,
+        0x26C6105D, 0x2714105D, 0x268F105D, 0x26C61065, 0x27141065, 0x27141065,
+        0x26C6105D, 0x2714105D, 0x2714105D, 0x26D11065, 0x26991065, 0x26991065,
+        0x26D1105D, 0x2699105D, 0x2699105D, 0x26D11065, 0x27141065, 0x27141065,
+        0x26C71065, 0x26991065, 0x27141065, 0x26C7105D, 0x2699105D, 0x2714105D,
+        0x26C71065, 0x268F1065, 0x27371065, 0x26C71065, 0x27141065, 0x269A1065,
+        0x26C7105D, 0x2714105D, 0x269A105D, 0x26C71065, 0x27141065, 0x27141065,
+        0x26C7105D, 0x2714105D, 0x2714105D, 0x26D21065, 0x26991065, 0x27361065,
+        0x26D21065, 0x269A1065, 0x27141065, 0x26D2105D, 0x269A105D, 0x2714105D,
+        0x26D71065, 0x27141065, 0x26991065, 0x26D7105D, 0x2714105D, 0x2699105D,
+        0x26D7105D, 0x2714105D, 0x2714105D, 0x26D71065, 0x27141065, 0x27371065,
+        0x26DB1065, 0x268F1065, 0x27141065, 0x26DB1065, 0x27141065, 0x27141065,
+        0x26DB105D, 0x2714105D, 0x2714105D, 0x26DB1065, 0x27141065, 0x27361065,
+        0x26DC1065, 0x27141065, 0x27141065, 0x26DC1065, 0x27141065, 0x27371065,
+        0x26DC1065, 0x27141065, 0x27361065, 0x26E41065, 0x269A1065, 0x27141065,
+        0x26E4105D, 0x269A105D, 0x2714105D, 0x26F01065, 0x27141065, 0x26991065,
+        0x26F01065, 0x27141065, 0x27141065, 0x270C1065, 0x26991065, 0x27141065,
+        0x270C1065, 0x26991065, 0x27371065, 0x270C1065, 0x26991065, 0x27361065,
+        0x270C105D, 0x268F105D, 0x268F105D, 0x270C1065, 0x268F1065, 0x268F1065,
+        0x270C1065, 0x269A1065, 0x27141065, 0x270C105D, 0x269A105D, 0x2714105D,
+        0x270C1065, 0x27141065, 0x26991065, 0x270C105D, 0x2714105D, 0x2699105D,
+        0x2714105D, 0x2699105D, 0x268F105D, 0x2714105D, 0x2699105D, 0x2714105D,
+        0x27141065, 0x26991065, 0x27371065, 0x2714105D, 0x268F105D, 0x2699105D,
+        0x2714105D, 0x268F105D, 0x2714105D, 0x2714105D, 0x269A105D, 0x268F105D,
+        0x2714105D, 0x269A105D, 0x2714105D, 0x2714105D, 0x268F105D, 0x269A105D,
+        0x2722105D, 0x2714105D, 0x268F105D, 0x2722105D, 0x2714105D, 0x2714105D,
+        0x2718105D, 0x2699105D, 0x2714105D, 0x27181065, 0x26991065, 0x27361065,
+        0x27181065, 0x268F1065, 0x27141065, 0x2718105D, 0x268F105D, 0x2714105D,
+        0x27181065, 0x268F1065, 0x27361065, 0x27181065, 0x27141065, 0x27371065,
+        0x27181065, 0x27141065, 0x27361065, 0x27371065, 0x27141065, 0x27141065,
+        0x2737105D, 0x2714105D, 0x2714105D, 0x26741065, 0x269A1065, 0x27371065,
+        0x26851065, 0x268F1065, 0x27371065, 0x26851065, 0x268F1065, 0x27361065,
+        0x26851065, 0x269A1065, 0x27371065, 0x26851065, 0x269A1065, 0x27361065,
+        0x26851065, 0x27141065, 0x27371065, 0x26851065, 0x27141065, 0x27361065,
+        0x268F1065, 0x27141065, 0x27371065, 0x268F1065, 0x26991065, 0x27361065,
+        0x268F1065, 0x27141065, 0x27361065, 0x26C61065, 0x269A1065, 0x27361065,
+        0x26D11065, 0x26991065, 0x27371065, 0x26C71065, 0x26991065, 0x27371065,
+        0x26D21065, 0x26991065, 0x27371065, 0x270C1065, 0x268F1065, 0x27371065,
+        0x270C1065, 0x27141065, 0x27371065, 0x27371065, 0x26991065, 0x27371065,
+        0x27371065, 0x268F1065, 0x27371065, 0x27371065, 0x27141065, 0x27371065,
+        0x27141065, 0x27141065, 0x27371065, 0x26F01065, 0x27141065, 0x27371065,
+        0x27181065, 0x26991065, 0x27371065, 0x26F0105D, 0x2714105D, 0x2699105D,
+        0x270C105D, 0x2699105D, 0x2714105D, 0x26DB1065, 0x27141065, 0x27371065,
+        0x26F61065, 0x27141065, 0x27371065, 0x2718105D, 0x268F105D, 0x2699105D,
+        0x27141065, 0x269A1065, 0x27371065, 0x270C105D, 0x268F105D, 0x2714105D,
+        0x26F61065, 0x27141065, 0x27141065, 0x270C1065, 0x268F1065, 0x27141065,
+        0x27181065, 0x268F1065, 0x26991065, 0x268F1065, 0x26991065, 0x27371065,
+        0x26991065, 0x268F1065, 0x27371065, 0x27141065, 0x268F1065, 0x27371065,
+        0x26E41065, 0x27141065, 0x27371065, 0x26741065, 0x26991065, 0x27371065,
+        0x26F6105D, 0x2714105D, 0x2714105D, 0x26DB105D, 0x268F105D, 0x2714105D,
+        0x26D1105D, 0x2714105D, 0x2714105D, 0x26C61065, 0x269A1065, 0x27371065,
+        0x27181065, 0x268F1065, 0x27371065, 0x26D11069, 0x270C1069, 0x27451069,
+        0x26F01069, 0x270C1069, 0x27451069, 0x26721069, 0x270C1069, 0x270C1069,
+        0x27221069, 0x26721069, 0x26F61069, 0x26741069, 0x26B31069, 0x27141069,
+        0x26991069, 0x27141069, 0x26A41069, 0x26D11069, 0x270C1069, 0x26DB1069,
+        0x27141069, 0x26B31069, 0x26C61069, 0x27281069, 0x270C1069, 0x26DB1069,
+        0x270C1069, 0x27371069, 0x27221069, 0x27281069, 0x26C61069, 0x270C1069,
+        0x27141069, 0x26D11069, 0x270C1069, 0x27361069, 0x26D11069, 0x270C1069,
+        0x27361069, 0x02091069, 0x26721069, 0x270C1069, 0x270C1069, 0x27221069,
+        0x02091069, 0x26DB1069, 0x270C1069, 0x27371069, 0x27221069, 0x02091069,
+        0x27281069, 0x26C61069, 0x270C1069, 0x27141069, 0x268F1069, 0x270C1069,
+        0x02091069, 0x268F1069, 0x270C1069, 0x26721069, 0x270C1069, 0x27221069,
+        0x26B31069, 0x27381069, 0x26721069, 0x270C1069, 0x027E1059, 0x027E1059,
+        0x027E1059, 0x027E1059, 0x027E1059, 0x270C1069, 0x26651069, 0x270C1065,
+        0x26651065, 0x270C1069, 0x26661069, 0x270C1065, 0x26661065, 0x270C1069,
+        0x266A1069, 0x270C1065, 0x266A1065, 0x270C1069, 0x26721069, 0x270C1065,
+        0x26721065, 0x59D61011, 0x00008C11, 0x59D71011, 0x00008C11, 0x59D81011,
+        0x00008C11, 0x59D91011, 0x00008C11, 0x59DA1011, 0x00008C11, 0x59DB1011,
+        0x00008C11, 0x59DC1011, 0x00008C11, 0x59DC1011, 0x00008C91, 0x59DD1011,
+        0x00008C11, 0x59DE1011, 0x00008C11, 0x59DF1011, 0x00008C11, 0x59DF1011,
+        0x00008C91, 0x59E01011, 0x00008C11, 0x59E01011, 0x00008C91, 0x59E11011,
+        0x00008C11, 0x59E11011, 0x00008C91, 0x59E21011, 0x00008C11, 0x59E31011,
+        0x00008C11, 0x59E41011, 0x00008C11, 0x59E51011, 0x00008C91, 0x59E51011,
+        0x00008D11, 0x59E61011, 0x00008C11, 0x59E71011, 0x00008C11, 0x59E81011,
+        0x00008C11, 0x59E91011, 0x00008C11, 0x59E91011, 0x00008C91, 0x59EA1011,
+        0x00008C11, 0x59EA1011, 0x00008C91, 0x59EB1011, 0x00008C11, 0x59EC1011,
+        0x00008C11, 0x59E51011, 0x00008C11, 0x50791011, 0x00008C91, 0x4FC21011,
+        0x00008C11, 0x3C8C1011, 0x00008C11, 0x3C8E1011, 0x00008C11, 0x3C911011,
+        0x00008C11, 0x3C921011, 0x00008C11, 0x3C931011, 0x00008C11, 0x3C941011,
+        0x00008C11, 0x3C951011, 0x00008C11, 0x3C961011, 0x00008C11, 0x3C981011,
+        0x00008C11, 0x3C991011, 0x00008C11, 0x3C9A1011, 0x00008C11, 0x3C9B1011,
+        0x00008C11, 0x3C9C1011, 0x00008C11, 0x3C9D1011, 0x00008C11, 0x3CA21011,
+        0x00008C11, 0x3CA31011, 0x00008C11, 0x3CA41011, 0x00008C11, 0x3CA51011,
+        0x00008C11, 0x3CA71011, 0x00008C11, 0x3CAB1011, 0x00008C11, 0x3CAC1011,
+        0x00008C11, 0x3CAD1011, 0x00008C11, 0x3CAE1011, 0x00008C11, 0x3CAF1011,
+        0x00008C11, 0x3CB31011, 0x00008C11, 0x3CB41011, 0x00008C11, 0x3CB51011,
+        0x00008C11, 0x3CB61011, 0x00008C11, 0x3C631029, 0x00008C11, 0x3C6B1029,
+        0x00008C11, 0x3C6B1029, 0x00008C91, 0x3C701029, 0x00008C11, 0x3C7A1029,
+        0x00008C11, 0x3C7B1029, 0x00008C11, 0x3C7B1029, 0x00008C91, 0x3C7E1029,
+        0x00008C11, 0x3C851029, 0x00008C11, 0x3C861029, 0x00008C11, 0x3C631011,
+        0x00008C11, 0x3C6B1011, 0x00008C11, 0x3C6B1011, 0x00008C91, 0x3C701011,
+        0x00008C11, 0x3C7A1011, 0x00008C11, 0x3C7B1011, 0x00008C11, 0x3C7B1011,
+        0x00008C91, 0x3C7E1011, 0x00008C11, 0x3C851011, 0x00008C11, 0x3C861011,
+        0x00008C11, 0x50A11011, 0x00008C91, 0x50A31011, 0x00008C91, 0x50A51011,
+        0x00008C91, 0x50A81011, 0x00008C91, 0x50A31011, 0x50A61011, 0x50BA1011,
+        0x00008C91, 0x50621011, 0x50651011, 0x2F491011, 0x00008C11, 0x2F491011,
+        0x00008C91, 0x2F4A1011, 0x00008C11, 0x2F4B1011, 0x00008C11, 0x2F791011,
+        0x00008C11, 0x2F7A1011, 0x00008C11, 0x30A91011, 0x00008C11, 0x30B91011,
+        0x00008C11, 0x30AC1011, 0x00008C11, 0x1F991011, 0x00008C11, 0x1F9A1011,
+        0x00008C11, 0x1F9B1009, 0x00008C09, 0x1F9B1011, 0x00008C11, 0x1F9C1011,
+        0x00008C11, 0x1F9D1011, 0x00008C11, 0x1F9E1011, 0x00008C11, 0x1F9F1011,
+        0x00008C11, 0x1FA01011, 0x00008C11, 0x1FA11011, 0x00008C11, 0x1F981011,
+        0x027E1011, 0x1F981011, 0x02231011, 0x1F991011, 0x02231011, 0x1F9A1011,
+        0x02231011, 0x1F9B1011, 0x02231011, 0x1F9C1011, 0x02231011, 0x1F9D1011,
+        0x02231011, 0x1F9E1011, 0x02231011, 0x1F9F1011, 0x02231011, 0x1FA01011,
+        0x02231011, 0x1FA11011, 0x02231011, 0x03281011, 0x1FA21029, 0x03291011,
+        0x03281011, 0x1FBC1029, 0x03291011, 0x03281011, 0x1FD61029, 0x03291011,
+        0x03281011, 0x1FEB1029, 0x03291011, 0x03281011, 0x20071029, 0x03291011,
+        0x03281011, 0x20421029, 0x03291011, 0x03281011, 0x20511029, 0x03291011,
+        0x03281011, 0x20751029, 0x03291011, 0x03281011, 0x20901029, 0x03291011,
+        0x03281011, 0x20AB1029, 0x03291011, 0x03281011, 0x20C41029, 0x03291011,
+        0x03281011, 0x20D61029, 0x03291011, 0x03281011, 0x21091029, 0x03291011,
+        0x03281011, 0x21181029, 0x03291011, 0x03281011, 0x213C1029, 0x03291011,
+        0x03281011, 0x216B1029, 0x03291011, 0x03281011, 0x21801029, 0x03291011,
+        0x03281011, 0x21931029, 0x03291011, 0x03281011, 0x21D21029, 0x03291011,
+        0x03281011, 0x21F71029, 0x03291011, 0x03281011, 0x22171029, 0x03291011,
+        0x03281011, 0x22471029, 0x03291011, 0x03281011, 0x22591029, 0x03291011,
+        0x03281011, 0x22641029, 0x03291011, 0x03281011, 0x22701029, 0x03291011,
+        0x03281011, 0x22861029, 0x03291011, 0x038A1011, 0x21D21029, 0x038B1011,
+        0x1FD61031, 0x1FEB1031, 0x22591031, 0x22861031, 0x20751075, 0x22471075,
+        0x21D21075, 0x1FEB1075, 0x21D21075, 0x21D21075, 0x216B1075, 0x216B1075,
+        0x22471075, 0x22591075, 0x1FD61075, 0x21091051, 0x1FD61051, 0x21091051,
+        0x1FEB1051, 0x21091051, 0x21931051, 0x20901075, 0x1FD61075, 0x216B1075,
+        0x1FA21075, 0x21D21075, 0x1FA21075, 0x1FA21075, 0x1FBC1075, 0x1FEB1075,
+        0x20AB1075, 0x1FD61075, 0x20D61075, 0x1FD61075, 0x213C1075, 0x213C1075,
+        0x20D61075, 0x20421075, 0x21931075, 0x20071075, 0x20071075, 0x20901075,
+        0x1FEB1075, 0x21181075, 0x20071075, 0x22591075, 0x21181075, 0x20511075,
+        0x213C1075, 0x20C41075, 0x21D21075, 0x213C1075, 0x21D21075, 0x22171075,
+        0x216B1075, 0x02671071, 0x22471075, 0x21D21075, 0x1F9B1071, 0x1FEB1075,
+        0x1F9A1071, 0x21181071, 0x1FEB1071, 0x02091071, 0x21D21075, 0x1FD61071,
+        0x21931071, 0x1F9A1071, 0x20C41075, 0x1F9C1071, 0x20C41075, 0x1FA01071,
+        0x20C41075, 0x1F9D1071, 0x027E1071, 0x1F991071, 0x1F9F1071, 0x027E1071,
+        0x1F991071, 0x1F9A1071, 0x1F9A1071, 0x027E1071, 0x1F9A1071, 0x1F9E1071,
+        0x1F981071, 0x216B1075, 0x1F991071, 0x1F9A1071, 0x1F981071, 0x216B1075,
+        0x20751075, 0x1FD61071, 0x20751075, 0x1FEB1071, 0x21931075, 0x20751075,
+        0x20901071, 0x02091071, 0x21931075, 0x20071071, 0x21D21071, 0x20D61075,
+        0x213C1071, 0x21D21071, 0x21D21071, 0x20D61071, 0x20071071, 0x21D21071,
+        0x21D21071, 0x21D21075, 0x20751075, 0x22471075, 0x22171075, 0x20751075,
+        0x1FEB1075, 0x22471075, 0x213C1075, 0x1FEB1075, 0x42F81071, 0x42E01071,
+        0x42E41071, 0x42E41071, 0xFB401071, 0xE24B0001, 0xFB401071, 0xDB570001,
+        0xFB401071, 0xD3CC0001, 0x42ED1071, 0x00001BF1, 0xFB401071, 0xCE8C0001,
+        0xFB401071, 0xD91A0001, 0xFB411071, 0x89E30001, 0xFB401071, 0xD9290001,
+        0xFB401071, 0xCEA40001, 0xFB401071, 0xE6200001, 0xFB401071, 0xF1210001,
+        0xFB401071, 0xE5990001, 0xFB401071, 0xD24D0001, 0xFB401071, 0xDF8C0001,
+        0xFB401071, 0xD18D0001, 0xFB401071, 0xE5B00001, 0xFB401071, 0xD21D0001,
+        0xFB401071, 0xFD420001, 0xFB401071, 0xF51F0001, 0xFB411071, 0x8CA90001,
+        0xFB401071, 0xD8F00001, 0xFB401071, 0xD4390001, 0xFB401071, 0xEF140001,
+        0xFB401071, 0xE2950001, 0xFB401071, 0xE3550001, 0xFB401071, 0xCE000001,
+        0xFB401071, 0xCE090001, 0xFB411071, 0x904A0001, 0xFB401071, 0xDDE60001,
+        0xFB401071, 0xCE2D0001, 0xFB401071, 0xD3F30001, 0xFB401071, 0xE3070001,
+        0xFB411071, 0x8D700001, 0xFB401071, 0xE2530001, 0xFB401071, 0xF9810001,
+        0xFB401071, 0xFA7A0001, 0xFB401071, 0xD4080001, 0xFB401071, 0xEE800001,
+        0xFB401071, 0xE7090001, 0xFB401071, 0xE7080001, 0xFB401071, 0xF5330001,
+        0xFB401071, 0xD2720001, 0xFB401071, 0xD5B60001, 0xFB411071, 0x914D0001,
+        0x038A1011, 0xFB401011, 0xE72C0001, 0x038B1011, 0x038A1011, 0xFB401011,
+        0xCE090001, 0x038B1011, 0x038A1011, 0xFB401011, 0xCE8C0001, 0x038B1011,
+        0x038A1011, 0xFB401011, 0xDB890001, 0x038B1011, 0x038A1011, 0xFB401011,
+        0xF0B90001, 0x038B1011, 0x038A1011, 0xFB401011, 0xE2530001, 0x038B1011,
+        0x038A1011, 0xFB401011, 0xF6D70001, 0x038B1011, 0x038A1011, 0xFB401011,
+        0xD2DD0001, 0x038B1011, 0x038A1011, 0xFB401011, 0xE5570001, 0x038B1011,
+        0xFB401019, 0xDF970001, 0xFB401019, 0xD3EF0001, 0x20D61021, 0x20D61009,
+        0x23E51021, 0x23E51009, 0x26721009, 0x27281009, 0x27371009, 0x2A781009,
+        0x2B391009, 0x2B4A1009, 0x2B6A1009, 0x2B6B1009, 0x2BB31009, 0x2BF51009,
+        0x2BFD1009, 0x2C481009, 0x2C491009, 0x2C961009, 0x32511009, 0x32521009,
+        0x32531009, 0x32541009, 0x32551009, 0x00006D09, 0x32911009, 0x32921009,
+        0x32931009, 0x32941009, 0x32951009, 0x00007009, 0x33291009, 0x33131009,
+        0x33161009, 0x35DC1009, 0x370F1009, 0x37101009, 0x37111009, 0x37141009,
+        0x37B61009, 0x37B81009, 0x37BA1009, 0x37BC1009, 0x37BE1009, 0x37C21009,
+        0x37F11009, 0x37F31009, 0x37F51009, 0x37F61009, 0x37F91009, 0x32CB1009,
+        0x32CC1009, 0x32CF1009, 0x32D11009, 0x32D21009, 0x366F1009, 0x36701009,
+        0x2EB31009, 0x2F401009, 0x2F7D1009, 0x2F7E1009, 0x302A1009, 0x23F21021,
+        0x23F21009, 0x26651009, 0x26661009, 0x266A1009, 0x26691009, 0x266E1009,
+        0x2A7A1009, 0x2A7B1009, 0x2B3B1009, 0x2B3A1009, 0x2B3C1009, 0x2B4C1009,
+        0x2B6D1009, 0x2B6F1009, 0x2B6E1009, 0x2BB51009, 0x2BF61009, 0x2C001009,
+        0x2BFE1009, 0x2BFF1009, 0x2C4B1009, 0x2C4D1009, 0x2C4C1009, 0x2C971009,
+        0x2C991009, 0x2C9B1009, 0x32171009, 0x32511009, 0x32181009, 0x32511009,
+        0x32191009, 0x32511009, 0x321A1009, 0x32511009, 0x321B1009, 0x32511009,
+        0x321C1009, 0x32511009, 0x321D1009, 0x32511009, 0x321E1009, 0x32511009,
+        0x321F1009, 0x32511009, 0x32201009, 0x32511009, 0x32211009, 0x32511009,
+        0x32221009, 0x32511009, 0x32231009, 0x32511009, 0x32241009, 0x32511009,
+        0x32251009, 0x32511009, 0x32261009, 0x32511009, 0x32271009, 0x32511009,
+        0x32281009, 0x32511009, 0x32291009, 0x32511009, 0x322A1009, 0x32511009,
+        0x322B1009, 0x32511009, 0x322C1009, 0x32511009, 0x322D1009, 0x32511009,
+        0x322E1009, 0x32511009, 0x322F1009, 0x32511009, 0x32301009, 0x32511009,
+        0x32311009, 0x32511009, 0x32321009, 0x32511009, 0x32331009, 0x32511009,
+        0x32341009, 0x32511009, 0x32351009, 0x32511009, 0x32361009, 0x32511009,
+        0x32371009, 0x32511009, 0x32381009, 0x32511009, 0x32391009, 0x32511009,
+        0x323A1009, 0x32511009, 0x323B1009, 0x32511009, 0x323C1009, 0x32511009,
+        0x323D1009, 0x32511009, 0x323E1009, 0x32511009, 0x323F1009, 0x32511009,
+        0x32401009, 0x32511009, 0x32411009, 0x32511009, 0x32421009, 0x32511009,
+        0x32431009, 0x32511009, 0x32441009, 0x32511009, 0x32171009, 0x32521009,
+        0x32181009, 0x32521009, 0x32191009, 0x32521009, 0x321A1009, 0x32521009,
+        0x321B1009, 0x32521009, 0x321C1009, 0x32521009, 0x321D1009, 0x32521009,
+        0x321E1009, 0x32521009, 0x321F1009, 0x32521009, 0x32201009, 0x32521009,
+        0x32211009, 0x32521009, 0x32221009, 0x32521009, 0x32231009, 0x32521009,
+        0x32241009, 0x32521009, 0x32251009, 0x32521009, 0x32261009, 0x32521009,
+        0x32271009, 0x32521009, 0x32281009, 0x32521009, 0x32291009, 0x32521009,
+        0x322A1009, 0x32521009, 0x322B1009, 0x32521009, 0x322C1009, 0x32521009,
+        0x322D1009, 0x32521009, 0x322E1009, 0x32521009, 0x322F1009, 0x32521009,
+        0x32301009, 0x32521009, 0x32311009, 0x32521009, 0x32321009, 0x32521009,
+        0x32331009, 0x32521009, 0x32341009, 0x32521009, 0x32351009, 0x32521009,
+        0x32361009, 0x32521009, 0x32371009, 0x32521009, 0x32381009, 0x32521009,
+        0x32391009, 0x32521009, 0x323A1009, 0x32521009, 0x323B1009, 0x32521009,
+        0x323C1009, 0x32521009, 0x323D1009, 0x32521009, 0x323E1009, 0x32521009,
+        0x323F1009, 0x32521009, 0x32401009, 0x32521009, 0x32411009, 0x32521009,
+        0x32421009, 0x32521009, 0x32431009, 0x32521009, 0x32441009, 0x32521009,
+        0x32171009, 0x32531009, 0x32181009, 0x32531009, 0x32191009, 0x32531009,
+        0x321A1009, 0x32531009, 0x321B1009, 0x32531009, 0x321C1009, 0x32531009,
+        0x321D1009, 0x32531009, 0x321E1009, 0x32531009, 0x321F1009, 0x32531009,
+        0x32201009, 0x32531009, 0x32211009, 0x32531009, 0x32221009, 0x32531009,
+        0x32231009, 0x32531009, 0x32241009, 0x32531009, 0x32251009, 0x32531009,
+        0x32261009, 0x32531009, 0x32271009, 0x32531009, 0x32281009, 0x32531009,
+        0x32291009, 0x32531009, 0x322A1009, 0x32531009, 0x322B1009, 0x32531009,
+        0x322C1009, 0x32531009, 0x322D1009, 0x32531009, 0x322E1009, 0x32531009,
+        0x322F1009, 0x32531009, 0x32301009, 0x32531009, 0x32311009, 0x32531009,
+        0x32321009, 0x32531009, 0x32331009, 0x32531009, 0x32341009, 0x32531009,
+        0x32351009, 0x32531009, 0x32361009, 0x32531009, 0x32371009, 0x32531009,
+        0x32381009, 0x32531009, 0x32391009, 0x32531009, 0x323A1009, 0x32531009,
+        0x323B1009, 0x32531009, 0x323C1009, 0x32531009, 0x323D1009, 0x32531009,
+        0x323E1009, 0x32531009, 0x323F1009, 0x32531009, 0x32401009, 0x32531009,
+        0x32411009, 0x32531009, 0x32421009, 0x32531009, 0x32431009, 0x32531009,
+        0x32441009, 0x32531009, 0x32171009, 0x32541009, 0x32181009, 0x32541009,
+        0x32191009, 0x32541009, 0x321A1009, 0x32541009, 0x321B1009, 0x32541009,
+        0x321C1009, 0x32541009, 0x321D1009, 0x32541009, 0x321E1009, 0x32541009,
+        0x321F1009, 0x32541009, 0x32201009, 0x32541009, 0x32211009, 0x32541009,
+        0x32221009, 0x32541009, 0x32231009, 0x32541009, 0x32241009, 0x32541009,
+        0x32251009, 0x32541009, 0x32261009, 0x32541009, 0x32271009, 0x32541009,
+        0x32281009, 0x32541009, 0x32291009, 0x32541009, 0x322A1009, 0x32541009,
+        0x322B1009, 0x32541009, 0x322C1009, 0x32541009, 0x322D1009, 0x32541009,
+        0x322E1009, 0x32541009, 0x322F1009, 0x32541009, 0x32301009, 0x32541009,
+        0x32311009, 0x32541009, 0x32321009, 0x32541009, 0x32331009, 0x32541009,
+        0x32341009, 0x32541009, 0x32351009, 0x32541009, 0x32361009, 0x32541009,
+        0x32371009, 0x32541009, 0x32381009, 0x32541009, 0x32391009, 0x32541009,
+        0x323A1009, 0x32541009, 0x323B1009, 0x32541009, 0x323C1009, 0x32541009,
+        0x323D1009, 0x32541009, 0x323E1009, 0x32541009, 0x323F1009, 0x32541009,
+        0x32401009, 0x32541009, 0x32411009, 0x32541009, 0x32421009, 0x32541009,
+        0x32431009, 0x32541009, 0x32441009, 0x32541009, 0x32171009, 0x32551009,
+        0x32181009, 0x32551009, 0x32191009, 0x32551009, 0x321A1009, 0x32551009,
+        0x321B1009, 0x32551009, 0x321C1009, 0x32551009, 0x321D1009, 0x32551009,
+        0x321E1009, 0x32551009, 0x321F1009, 0x32551009, 0x32201009, 0x32551009,
+        0x32211009, 0x32551009, 0x32221009, 0x32551009, 0x32231009, 0x32551009,
+        0x32241009, 0x32551009, 0x32251009, 0x32551009, 0x32261009, 0x32551009,
+        0x32271009, 0x32551009, 0x32281009, 0x32551009, 0x32291009, 0x32551009,
+        0x322A1009, 0x32551009, 0x322B1009, 0x32551009, 0x322C1009, 0x32551009,
+        0x322D1009, 0x32551009, 0x322E1009, 0x32551009, 0x322F1009, 0x32551009,
+        0x32301009, 0x32551009, 0x32311009, 0x32551009, 0x32321009, 0x32551009,
+        0x32331009, 0x32551009, 0x32341009, 0x32551009, 0x32351009, 0x32551009,
+        0x32361009, 0x32551009, 0x32371009, 0x32551009, 0x32381009, 0x32551009,
+        0x32391009, 0x32551009, 0x323A1009, 0x32551009, 0x323B1009, 0x32551009,
+        0x323C1009, 0x32551009, 0x323D1009, 0x32551009, 0x323E1009, 0x32551009,
+        0x323F1009, 0x32551009, 0x32401009, 0x32551009, 0x32411009, 0x32551009,
+        0x32421009, 0x32551009, 0x32431009, 0x32551009, 0x32441009, 0x32551009,
+        0x32491009, 0x32581009, 0x32911009, 0x32591009, 0x32911009, 0x325A1009,
+        0x32911009, 0x325B1009, 0x32911009, 0x325C1009, 0x32911009, 0x325D1009,
+        0x32911009, 0x325E1009, 0x32911009, 0x32601009, 0x32911009, 0x32611009,
+        0x32911009, 0x32641009, 0x32911009, 0x32621009, 0x32911009, 0x32651009,
+        0x32911009, 0x32661009, 0x32911009, 0x32671009, 0x32911009, 0x32681009,
+        0x32911009, 0x32691009, 0x32911009, 0x326A1009, 0x32911009, 0x326B1009,
+        0x32911009, 0x326C1009, 0x32911009, 0x326D1009, 0x32911009, 0x326E1009,
+        0x32911009, 0x326F1009, 0x32911009, 0x32701009, 0x32911009, 0x32711009,
+        0x32911009, 0x32721009, 0x32911009, 0x32731009, 0x32911009, 0x32741009,
+        0x32911009, 0x32751009, 0x32911009, 0x32761009, 0x32911009, 0x32771009,
+        0x32911009, 0x32781009, 0x32911009, 0x32791009, 0x32911009, 0x327A1009,
+        0x32911009, 0x327B1009, 0x32911009, 0x327C1009, 0x32911009, 0x327D1009,
+        0x32911009, 0x325F1009, 0x32911009, 0x327E1009, 0x32911009, 0x327F1009,
+        0x32911009, 0x32801009, 0x32911009, 0x32811009, 0x32911009, 0x327E1011,
+        0x326F1011, 0x32911009, 0x327E1011, 0x32771011, 0x32911009, 0x32571009,
+        0x32911009, 0x32631009, 0x32911009, 0x32581009, 0x32921009, 0x32591009,
+        0x32921009, 0x325A1009, 0x32921009, 0x325B1009, 0x32921009, 0x325C1009,
+        0x32921009, 0x325D1009, 0x32921009, 0x325E1009, 0x32921009, 0x32601009,
+        0x32921009, 0x32611009, 0x32921009, 0x32641009, 0x32921009, 0x32621009,
+        0x32921009, 0x32651009, 0x32921009, 0x32661009, 0x32921009, 0x32671009,
+        0x32921009, 0x32681009, 0x32921009, 0x32691009, 0x32921009, 0x326A1009,
+        0x32921009, 0x326B1009, 0x32921009, 0x326C1009, 0x32921009, 0x326D1009,
+        0x32921009, 0x326E1009, 0x32921009, 0x326F1009, 0x32921009, 0x32701009,
+        0x32921009, 0x32711009, 0x32921009, 0x32721009, 0x32921009, 0x32731009,
+        0x32921009, 0x32741009, 0x32921009, 0x32751009, 0x32921009, 0x32761009,
+        0x32921009, 0x32771009, 0x32921009, 0x32781009, 0x32921009, 0x32791009,
+        0x32921009, 0x327A1009, 0x32921009, 0x327B1009, 0x32921009, 0x327C1009,
+        0x32921009, 0x327D1009, 0x32921009, 0x325F1009, 0x32921009, 0x327E1009,
+        0x32921009, 0x327F1009, 0x32921009, 0x32801009, 0x32921009, 0x32811009,
+        0x32921009, 0x327E1011, 0x326F1011, 0x32921009, 0x327E1011, 0x32771011,
+        0x32921009, 0x32571009, 0x32921009, 0x32631009, 0x32921009, 0x32581009,
+        0x32931009, 0x32591009, 0x32931009, 0x325A1009, 0x32931009, 0x325B1009,
+        0x32931009, 0x325C1009, 0x32931009, 0x325D1009, 0x32931009, 0x325E1009,
+        0x32931009, 0x32601009, 0x32931009, 0x32611009, 0x32931009, 0x32641009,
+        0x32931009, 0x32621009, 0x32931009, 0x32651009, 0x32931009, 0x32661009,
+        0x32931009, 0x32671009, 0x32931009, 0x32681009, 0x32931009, 0x32691009,
+        0x32931009, 0x326A1009, 0x32931009, 0x326B1009, 0x32931009, 0x326C1009,
+        0x32931009, 0x326D1009, 0x32931009, 0x326E1009, 0x32931009, 0x326F1009,
+        0x32931009, 0x32701009, 0x32931009, 0x32711009, 0x32931009, 0x32721009,
+        0x32931009, 0x32731009, 0x32931009, 0x32741009, 0x32931009, 0x32751009,
+        0x32931009, 0x32761009, 0x32931009, 0x32771009, 0x32931009, 0x32781009,
+        0x32931009, 0x32791009, 0x32931009, 0x327A1009, 0x32931009, 0x327B1009,
+        0x32931009, 0x327C1009, 0x32931009, 0x327D1009, 0x32931009, 0x325F1009,
+        0x32931009, 0x327E1009, 0x32931009, 0x327F1009, 0x32931009, 0x32801009,
+        0x32931009, 0x32811009, 0x32931009, 0x327E1011, 0x326F1011, 0x32931009,
+        0x327E1011, 0x32771011, 0x32931009, 0x32571009, 0x32931009, 0x32631009,
+        0x32931009, 0x32581009, 0x32941009, 0x32591009, 0x32941009, 0x325A1009,
+        0x32941009, 0x325B1009, 0x32941009, 0x325C1009, 0x32941009, 0x325D1009,
+        0x32941009, 0x325E1009, 0x32941009, 0x32601009, 0x32941009, 0x32611009,
+        0x32941009, 0x32641009, 0x32941009, 0x32621009, 0x32941009, 0x32651009,
+        0x32941009, 0x32661009, 0x32941009, 0x32671009, 0x32941009, 0x32681009,
+        0x32941009, 0x32691009, 0x32941009, 0x326A1009, 0x32941009, 0x326B1009,
+        0x32941009, 0x326C1009, 0x32941009, 0x326D1009, 0x32941009, 0x326E1009,
+        0x32941009, 0x326F1009, 0x32941009, 0x32701009, 0x32941009, 0x32711009,
+        0x32941009, 0x32721009, 0x32941009, 0x32731009, 0x32941009, 0x32741009,
+        0x32941009, 0x32751009, 0x32941009, 0x32761009, 0x32941009, 0x32771009,
+        0x32941009, 0x32781009, 0x32941009, 0x32791009, 0x32941009, 0x327A1009,
+        0x32941009, 0x327B1009, 0x32941009, 0x327C1009, 0x32941009, 0x327D1009,
+        0x32941009, 0x325F1009, 0x32941009, 0x327E1009, 0x32941009, 0x327F1009,
+        0x32941009, 0x32801009, 0x32941009, 0x32811009, 0x32941009, 0x327E1011,
+        0x326F1011, 0x32941009, 0x327E1011, 0x32771011, 0x32941009, 0x32571009,
+        0x32941009, 0x32631009, 0x32941009, 0x32581009, 0x32951009, 0x32591009,
+        0x32951009, 0x325A1009, 0x32951009, 0x325B1009, 0x32951009, 0x325C1009,
+        0x32951009, 0x325D1009, 0x32951009, 0x325E1009, 0x32951009, 0x32601009,
+        0x32951009, 0x32611009, 0x32951009, 0x32641009, 0x32951009, 0x32621009,
+        0x32951009, 0x32651009, 0x32951009, 0x32661009, 0x32951009, 0x32671009,
+        0x32951009, 0x32681009, 0x32951009, 0x32691009, 0x32951009, 0x326A1009,
+        0x32951009, 0x326B1009, 0x32951009, 0x326C1009, 0x32951009, 0x326D1009,
+        0x32951009, 0x326E1009, 0x32951009, 0x326F1009, 0x32951009, 0x32701009,
+        0x32951009, 0x32711009, 0x32951009, 0x32721009, 0x32951009, 0x32731009,
+        0x32951009, 0x32741009, 0x32951009, 0x32751009, 0x32951009, 0x32761009,
+        0x32951009, 0x32771009, 0x32951009, 0x32781009, 0x32951009, 0x32791009,
+        0x32951009, 0x327A1009, 0x32951009, 0x327B1009, 0x32951009, 0x327C1009,
+        0x32951009, 0x327D1009, 0x32951009, 0x325F1009, 0x32951009, 0x327E1009,
+        0x32951009, 0x327F1009, 0x32951009, 0x32801009, 0x32951009, 0x32811009,
+        0x32951009, 0x327E1011, 0x326F1011, 0x32951009, 0x327E1011, 0x32771011,
+        0x32951009, 0x32571009, 0x32951009, 0x32631009, 0x32951009, 0x32861009,
+        0x332B1009, 0x332F1009, 0x332D1009, 0x33301009, 0x33321009, 0x35DD1009,
+        0x36DE1009, 0x370F1009, 0x36DF1009, 0x370F1009, 0x36E01009, 0x370F1009,
+        0x36E11009, 0x370F1009, 0x36E21009, 0x370F1009, 0x36E31009, 0x370F1009,
+        0x36E41009, 0x370F1009, 0x36E51009, 0x370F1009, 0x36E61009, 0x370F1009,
+        0x36E71009, 0x370F1009, 0x36E81009, 0x370F1009, 0x36E91009, 0x370F1009,
+        0x36EA1009, 0x370F1009, 0x36EB1009, 0x370F1009, 0x36EC1009, 0x370F1009,
+        0x36ED1009, 0x370F1009, 0x36EE1009, 0x370F1009, 0x36EF1009, 0x370F1009,
+        0x36F01009, 0x370F1009, 0x36F11009, 0x370F1009, 0x36F21009, 0x370F1009,
+        0x36F31009, 0x370F1009, 0x36F41009, 0x370F1009, 0x36F51009, 0x370F1009,
+        0x36F61009, 0x370F1009, 0x36F71009, 0x370F1009, 0x36F81009, 0x370F1009,
+        0x36F91009, 0x370F1009, 0x36FA1009, 0x370F1009, 0x36FB1009, 0x370F1009,
+        0x36FC1009, 0x370F1009, 0x36FD1009, 0x370F1009, 0x36FE1009, 0x370F1009,
+        0x36FF1009, 0x370F1009, 0x37001009, 0x370F1009, 0x37011009, 0x370F1009,
+        0x37021009, 0x370F1009, 0x37031009, 0x370F1009, 0x37041009, 0x370F1009,
+        0x37051009, 0x370F1009, 0x37061009, 0x370F1009, 0x37071009, 0x370F1009,
+        0x37081009, 0x370F1009, 0x37091009, 0x370F1009, 0x36DE1009, 0x37101009,
+        0x36DF1009, 0x37101009, 0x36E01009, 0x37101009, 0x36E11009, 0x37101009,
+        0x36E21009, 0x37101009, 0x36E31009, 0x37101009, 0x36E41009, 0x37101009,
+        0x36E51009, 0x37101009, 0x36E61009, 0x37101009, 0x36E71009, 0x37101009,
+        0x36E81009, 0x37101009, 0x36E91009, 0x37101009, 0x36EA1009, 0x37101009,
+        0x36EB1009, 0x37101009, 0x36EC1009, 0x37101009, 0x36ED1009, 0x37101009,
+        0x36EE1009, 0x37101009, 0x36EF1009, 0x37101009, 0x36F01009, 0x37101009,
+        0x36F11009, 0x37101009, 0x36F21009, 0x37101009, 0x36F31009, 0x37101009,
+        0x36F41009, 0x37101009, 0x36F51009, 0x37101009, 0x36F61009, 0x37101009,
+        0x36F71009, 0x37101009, 0x36F81009, 0x37101009, 0x36F91009, 0x37101009,
+        0x36FA1009, 0x37101009, 0x36FB1009, 0x37101009, 0x36FC1009, 0x37101009,
+        0x36FD1009, 0x37101009, 0x36FE1009, 0x37101009, 0x36FF1009, 0x37101009,
+        0x37001009, 0x37101009, 0x37011009, 0x37101009, 0x37021009, 0x37101009,
+        0x37031009, 0x37101009, 0x37041009, 0x37101009, 0x37051009, 0x37101009,
+        0x37061009, 0x37101009, 0x37071009, 0x37101009, 0x37081009, 0x37101009,
+        0x37091009, 0x37101009, 0x36DE1009, 0x37111009, 0x36DF1009, 0x37111009,
+        0x36E01009, 0x37111009, 0x36E11009, 0x37111009, 0x36E21009, 0x37111009,
+        0x36E31009, 0x37111009, 0x36E41009, 0x37111009, 0x36E51009, 0x37111009,
+        0x36E61009, 0x37111009, 0x36E71009, 0x37111009, 0x36E81009, 0x37111009,
+        0x36E91009, 0x37111009, 0x36EA1009, 0x37111009, 0x36EB1009, 0x37111009,
+        0x36EC1009, 0x37111009, 0x36ED1009, 0x37111009, 0x36EE1009, 0x37111009,
+        0x36EF1009, 0x37111009, 0x36F01009, 0x37111009, 0x36F11009, 0x37111009,
+        0x36F21009, 0x37111009, 0x36F31009, 0x37111009, 0x36F41009, 0x37111009,
+        0x36F51009, 0x37111009, 0x36F61009, 0x37111009, 0x36F71009, 0x37111009,
+        0x36F81009, 0x37111009, 0x36F91009, 0x37111009, 0x36FA1009, 0x37111009,
+        0x36FB1009, 0x37111009, 0x36FC1009, 0x37111009, 0x36FD1009, 0x37111009,
+        0x36FE1009, 0x37111009, 0x36FF1009, 0x37111009, 0x37001009, 0x37111009,
+        0x37011009, 0x37111009, 0x37021009, 0x37111009, 0x37031009, 0x37111009,
+        0x37041009, 0x37111009, 0x37051009, 0x37111009, 0x37061009, 0x37111009,
+        0x37071009, 0x37111009, 0x37081009, 0x37111009, 0x37091009, 0x37111009,
+        0x36DE1009, 0x37141009, 0x36DF1009, 0x37141009, 0x36E01009, 0x37141009,
+        0x36E11009, 0x37141009, 0x36E21009, 0x37141009, 0x36E31009, 0x37141009,
+        0x36E41009, 0x37141009, 0x36E51009, 0x37141009, 0x36E61009, 0x37141009,
+        0x36E71009, 0x37141009, 0x36E81009, 0x37141009, 0x36E91009, 0x37141009,
+        0x36EA1009, 0x37141009, 0x36EB1009, 0x37141009, 0x36EC1009, 0x37141009,
+        0x36ED1009, 0x37141009, 0x36EE1009, 0x37141009, 0x36EF1009, 0x37141009,
+        0x36F01009, 0x37141009, 0x36F11009, 0x37141009, 0x36F21009, 0x37141009,
+        0x36F31009, 0x37141009, 0x36F41009, 0x37141009, 0x36F51009, 0x37141009,
+        0x36F61009, 0x37141009, 0x36F71009, 0x37141009, 0x36F81009, 0x37141009,
+        0x36F91009, 0x37141009, 0x36FA1009, 0x37141009, 0x36FB1009, 0x37141009,
+        0x36FC1009, 0x37141009, 0x36FD1009, 0x37141009, 0x36FE1009, 0x37141009,
+        0x36FF1009, 0x37141009, 0x37001009, 0x37141009, 0x37011009, 0x37141009,
+        0x37021009, 0x37141009, 0x37031009, 0x37141009, 0x37041009, 0x37141009,
+        0x37051009, 0x37141009, 0x37061009, 0x37141009, 0x37071009, 0x37141009,
+        0x37081009, 0x37141009, 0x37091009, 0x37141009, 0x37B71009, 0x37B91009,
+        0x37BB1009, 0x37BD1009, 0x37BF1009, 0x37C31009, 0x37F21009, 0x37F41009,
+        0x37F71009, 0x37F81009, 0x37FA1009, 0x32961009, 0x32CB1009, 0x32971009,
+        0x32CB1009, 0x32981009, 0x32CB1009, 0x32991009, 0x32CB1009, 0x329A1009,
+        0x32CB1009, 0x329B1009, 0x32CB1009, 0x329C1009, 0x32CB1009, 0x329D1009,
+        0x32CB1009, 0x329E1009, 0x32CB1009, 0x329F1009, 0x32CB1009, 0x32A01009,
+        0x32CB1009, 0x32A11009, 0x32CB1009, 0x32A21009, 0x32CB1009, 0x32A31009,
+        0x32CB1009, 0x32A41009, 0x32CB1009, 0x32A51009, 0x32CB1009, 0x32A61009,
+        0x32CB1009, 0x32A71009, 0x32CB1009, 0x32A81009, 0x32CB1009, 0x32A91009,
+        0x32CB1009, 0x32AA1009, 0x32CB1009, 0x32AB1009, 0x32CB1009, 0x32AC1009,
+        0x32CB1009, 0x32AD1009, 0x32CB1009, 0x32AE1009, 0x32CB1009, 0x32AF1009,
+        0x32CB1009, 0x32B01009, 0x32CB1009, 0x32B11009, 0x32CB1009, 0x32B21009,
+        0x32CB1009, 0x32B31009, 0x32CB1009, 0x32B41009, 0x32CB1009, 0x32B51009,
+        0x32CB1009, 0x32B61009, 0x32CB1009, 0x32B71009, 0x32CB1009, 0x32B81009,
+        0x32CB1009, 0x32B91009, 0x32CB1009, 0x32BA1009, 0x32CB1009, 0x32BB1009,
+        0x32CB1009, 0x32BC1009, 0x32CB1009, 0x32BD1009, 0x32CB1009, 0x32BE1009,
+        0x32CB1009, 0x32BF1009, 0x32CB1009, 0x32C01009, 0x32CB1009, 0x32C11009,
+        0x32CB1009, 0x32C21009, 0x32CB1009, 0x32C31009, 0x32CB1009, 0x32C41009,
+        0x32CB1009, 0x32C51009, 0x32CB1009, 0x32961009, 0x32CC1009, 0x32971009,
+        0x32CC1009, 0x32981009, 0x32CC1009, 0x32991009, 0x32CC1009, 0x329A1009,
+        0x32CC1009, 0x329B1009, 0x32CC1009, 0x329C1009, 0x32CC1009, 0x329D1009,
+        0x32CC1009, 0x329E1009, 0x32CC1009, 0x329F1009, 0x32CC1009, 0x32A01009,
+        0x32CC1009, 0x32A11009, 0x32CC1009, 0x32A21009, 0x32CC1009, 0x32A31009,
+        0x32CC1009, 0x32A41009, 0x32CC1009, 0x32A51009, 0x32CC1009, 0x32A61009,
+        0x32CC1009, 0x32A71009, 0x32CC1009, 0x32A81009, 0x32CC1009, 0x32A91009,
+        0x32CC1009, 0x32AA1009, 0x32CC1009, 0x32AB1009, 0x32CC1009, 0x32AC1009,
+        0x32CC1009, 0x32AD1009, 0x32CC1009, 0x32AE1009, 0x32CC1009, 0x32AF1009,
+        0x32CC1009, 0x32B01009, 0x32CC1009, 0x32B11009, 0x32CC1009, 0x32B21009,
+        0x32CC1009, 0x32B31009, 0x32CC1009, 0x32B41009, 0x32CC1009, 0x32B51009,
+        0x32CC1009, 0x32B61009, 0x32CC1009, 0x32B71009, 0x32CC1009, 0x32B81009,
+        0x32CC1009, 0x32B91009, 0x32CC1009, 0x32BA1009, 0x32CC1009, 0x32BB1009,
+        0x32CC1009, 0x32BC1009, 0x32CC1009, 0x32BD1009, 0x32CC1009, 0x32BE1009,
+        0x32CC1009, 0x32BF1009, 0x32CC1009, 0x32C01009, 0x32CC1009, 0x32C11009,
+        0x32CC1009, 0x32C21009, 0x32CC1009, 0x32C31009, 0x32CC1009, 0x32C41009,
+        0x32CC1009, 0x32C51009, 0x32CC1009, 0x32961009, 0x32CF1009, 0x32971009,
+        0x32CF1009, 0x32981009, 0x32CF1009, 0x32991009, 0x32CF1009, 0x329A1009,
+        0x32CF1009, 0x329B1009, 0x32CF1009, 0x329C1009, 0x32CF1009, 0x329D1009,
+        0x32CF1009, 0x329E1009, 0x32CF1009, 0x329F1009, 0x32CF1009, 0x32A01009,
+        0x32CF1009, 0x32A11009, 0x32CF1009, 0x32A21009, 0x32CF1009, 0x32A31009,
+        0x32CF1009, 0x32A41009, 0x32CF1009, 0x32A51009, 0x32CF1009, 0x32A61009,
+        0x32CF1009, 0x32A71009, 0x32CF1009, 0x32A81009, 0x32CF1009, 0x32A91009,
+        0x32CF1009, 0x32AA1009, 0x32CF1009, 0x32AB1009, 0x32CF1009, 0x32AC1009,
+        0x32CF1009, 0x32AD1009, 0x32CF1009, 0x32AE1009, 0x32CF1009, 0x32AF1009,
+        0x32CF1009, 0x32B01009, 0x32CF1009, 0x32B11009, 0x32CF1009, 0x32B21009,
+        0x32CF1009, 0x32B31009, 0x32CF1009, 0x32B41009, 0x32CF1009, 0x32B51009,
+        0x32CF1009, 0x32B61009, 0x32CF1009, 0x32B71009, 0x32CF1009, 0x32B81009,
+        0x32CF1009, 0x32B91009, 0x32CF1009, 0x32BA1009, 0x32CF1009, 0x32BB1009,
+        0x32CF1009, 0x32BC1009, 0x32CF1009, 0x32BD1009, 0x32CF1009, 0x32BE1009,
+        0x32CF1009, 0x32BF1009, 0x32CF1009, 0x32C01009, 0x32CF1009, 0x32C11009,
+        0x32CF1009, 0x32C21009, 0x32CF1009, 0x32C31009, 0x32CF1009, 0x32C41009,
+        0x32CF1009, 0x32C51009, 0x32CF1009, 0x32961009, 0x32D11009, 0x32971009,
+        0x32D11009, 0x32981009, 0x32D11009, 0x32991009, 0x32D11009, 0x329A1009,
+        0x32D11009, 0x329B1009, 0x32D11009, 0x329C1009, 0x32D11009, 0x329D1009,
+        0x32D11009, 0x329E1009, 0x32D11009, 0x329F1009, 0x32D11009, 0x32A01009,
+        0x32D11009, 0x32A11009, 0x32D11009, 0x32A21009, 0x32D11009, 0x32A31009,
+        0x32D11009, 0x32A41009, 0x32D11009, 0x32A51009, 0x32D11009, 0x32A61009,
+        0x32D11009, 0x32A71009, 0x32D11009, 0x32A81009, 0x32D11009, 0x32A91009,
+        0x32D11009, 0x32AA1009, 0x32D11009, 0x32AB1009, 0x32D11009, 0x32AC1009,
+        0x32D11009, 0x32AD1009, 0x32D11009, 0x32AE1009, 0x32D11009, 0x32AF1009,
+        0x32D11009, 0x32B01009, 0x32D11009, 0x32B11009, 0x32D11009, 0x32B21009,
+        0x32D11009, 0x32B31009, 0x32D11009, 0x32B41009, 0x32D11009, 0x32B51009,
+        0x32D11009, 0x32B61009, 0x32D11009, 0x32B71009, 0x32D11009, 0x32B81009,
+        0x32D11009, 0x32B91009, 0x32D11009, 0x32BA1009, 0x32D11009, 0x32BB1009,
+        0x32D11009, 0x32BC1009, 0x32D11009, 0x32BD1009, 0x32D11009, 0x32BE1009,
+        0x32D11009, 0x32BF1009, 0x32D11009, 0x32C01009, 0x32D11009, 0x32C11009,
+        0x32D11009, 0x32C21009, 0x32D11009, 0x32C31009, 0x32D11009, 0x32C41009,
+        0x32D11009, 0x32C51009, 0x32D11009, 0x32961009, 0x32D21009, 0x32971009,
+        0x32D21009, 0x32981009, 0x32D21009, 0x32991009, 0x32D21009, 0x329A1009,
+        0x32D21009, 0x329B1009, 0x32D21009, 0x329C1009, 0x32D21009, 0x329D1009,
+        0x32D21009, 0x329E1009, 0x32D21009, 0x329F1009, 0x32D21009, 0x32A01009,
+        0x32D21009, 0x32A11009, 0x32D21009, 0x32A21009, 0x32D21009, 0x32A31009,
+        0x32D21009, 0x32A41009, 0x32D21009, 0x32A51009, 0x32D21009, 0x32A61009,
+        0x32D21009, 0x32A71009, 0x32D21009, 0x32A81009, 0x32D21009, 0x32A91009,
+        0x32D21009, 0x32AA1009, 0x32D21009, 0x32AB1009, 0x32D21009, 0x32AC1009,
+        0x32D21009, 0x32AD1009, 0x32D21009, 0x32AE1009, 0x32D21009, 0x32AF1009,
+        0x32D21009, 0x32B01009, 0x32D21009, 0x32B11009, 0x32D21009, 0x32B21009,
+        0x32D21009, 0x32B31009, 0x32D21009, 0x32B41009, 0x32D21009, 0x32B51009,
+        0x32D21009, 0x32B61009, 0x32D21009, 0x32B71009, 0x32D21009, 0x32B81009,
+        0x32D21009, 0x32B91009, 0x32D21009, 0x32BA1009, 0x32D21009, 0x32BB1009,
+        0x32D21009, 0x32BC1009, 0x32D21009, 0x32BD1009, 0x32D21009, 0x32BE1009,
+        0x32D21009, 0x32BF1009, 0x32D21009, 0x32C01009, 0x32D21009, 0x32C11009,
+        0x32D21009, 0x32C21009, 0x32D21009, 0x32C31009, 0x32D21009, 0x32C41009,
+        0x32D21009, 0x32C51009, 0x32D21009, 0x366C1009, 0x366D1009, 0x2EB51009,
+        0x2EB61009, 0x2F431009, 0x2F421009, 0x2F451009, 0x2F7F1009, 0x2F801009,
+        0x302C1009, 0x2C011009, 0x2C9A1009, 0x33311009, 0x33331009,
+    };
+    static constexpr contraction contractions[996] = {
+        { 0x004C, 4720, 1, 61, 1 },
+        { 0x006C, 4721, 1, 62, 1 },
+        { 0x0418, 4722, 1, 63, 1 },
+        { 0x0438, 4723, 1, 64, 1 },
+        { 0x0627, 4724, 1, 65, 3 },
+        { 0x0648, 4725, 1, 68, 1 },
+        { 0x064A, 4726, 1, 69, 1 },
+        { 0x09C7, 4727, 1, 70, 2 },
+        { 0x0B47, 4728, 1, 72, 3 },
+        { 0x0B92, 4729, 1, 75, 1 },
+        { 0x0BC6, 4730, 1, 76, 2 },
+        { 0x0BC7, 4731, 1, 78, 1 },
+        { 0x0C46, 4732, 1, 79, 1 },
+        { 0x0CBF, 4733, 1, 80, 1 },
+        { 0x0CC6, 4734, 1, 81, 3 },
+        { 0x0D46, 4735, 1, 84, 2 },
+        { 0x0D47, 4736, 1, 86, 1 },
+        { 0x0DD9, 4737, 1, 87, 3 },
+        { 0x0E40, 4738, 1, 90, 46 },
+        { 0x0E41, 4739, 1, 136, 46 },
+        { 0x0E42, 4740, 1, 182, 46 },
+        { 0x0E43, 4741, 1, 228, 46 },
+        { 0x0E44, 4742, 1, 274, 46 },
+        { 0x0E4D, 4743, 1, 320, 1 },
+        { 0x0EC0, 4744, 1, 321, 45 },
+        { 0x0EC1, 4745, 1, 366, 45 },
+        { 0x0EC2, 4746, 1, 411, 45 },
+        { 0x0EC3, 4747, 1, 456, 45 },
+        { 0x0EC4, 4748, 1, 501, 45 },
+        { 0x0ECD, 4749, 1, 546, 1 },
+        { 0x0F71, 4750, 1, 547, 3 },
+        { 0x0FB2, 4751, 1, 550, 2 },
+        { 0x0FB3, 4752, 1, 552, 2 },
+        { 0x1025, 4753, 1, 554, 1 },
+        { 0x19B5, 4754, 1, 555, 44 },
+        { 0x19B6, 4755, 1, 599, 44 },
+        { 0x19B7, 4756, 1, 643, 44 },
+        { 0x19BA, 4757, 1, 687, 44 },
+        { 0x1B05, 4758, 1, 731, 1 },
+        { 0x1B07, 4759, 1, 732, 1 },
+        { 0x1B09, 4760, 1, 733, 1 },
+        { 0x1B0B, 4761, 1, 734, 1 },
+        { 0x1B0D, 4762, 1, 735, 1 },
+        { 0x1B11, 4763, 1, 736, 1 },
+        { 0x1B3A, 4764, 1, 737, 1 },
+        { 0x1B3C, 4765, 1, 738, 1 },
+        { 0x1B3E, 4766, 1, 739, 1 },
+        { 0x1B3F, 4767, 1, 740, 1 },
+        { 0x1B42, 4768, 1, 741, 1 },
+        { 0xAAB5, 4769, 1, 742, 48 },
+        { 0xAAB6, 4770, 1, 790, 48 },
+        { 0xAAB9, 4771, 1, 838, 48 },
+        { 0xAABB, 4772, 1, 886, 48 },
+        { 0xAABC, 4773, 1, 934, 48 },
+        { 0x11131, 4774, 1, 982, 1 },
+        { 0x11132, 4775, 1, 983, 1 },
+        { 0x11347, 4776, 1, 984, 2 },
+        { 0x114B9, 4777, 1, 986, 3 },
+        { 0x115B8, 4778, 1, 989, 1 },
+        { 0x115B9, 4779, 1, 990, 1 },
+        { 0x11935, 4780, 1, 991, 1 },
+        { 0x00B7, 38, 2, 0, 0 },
+        { 0x00B7, 40, 2, 0, 0 },
+        { 0x0306, 4781, 1, 0, 0 },
+        { 0x0306, 4782, 1, 0, 0 },
+        { 0x0653, 4783, 1, 0, 0 },
+        { 0x0654, 4784, 1, 0, 0 },
+        { 0x0655, 4785, 1, 0, 0 },
+        { 0x0654, 4786, 1, 0, 0 },
+        { 0x0654, 4787, 1, 0, 0 },
+        { 0x09BE, 4788, 1, 0, 0 },
+        { 0x09D7, 4789, 1, 0, 0 },
+        { 0x0B3E, 4790, 1, 0, 0 },
+        { 0x0B56, 4791, 1, 0, 0 },
+        { 0x0B57, 4792, 1, 0, 0 },
+        { 0x0BD7, 4793, 1, 0, 0 },
+        { 0x0BBE, 4794, 1, 0, 0 },
+        { 0x0BD7, 4795, 1, 0, 0 },
+        { 0x0BBE, 4796, 1, 0, 0 },
+        { 0x0C56, 4797, 1, 0, 0 },
+        { 0x0CD5, 4798, 1, 0, 0 },
+        { 0x0CC2, 4799, 1, 992, 1 },
+        { 0x0CD5, 4800, 1, 0, 0 },
+        { 0x0CD6, 4801, 1, 0, 0 },
+        { 0x0D3E, 4802, 1, 0, 0 },
+        { 0x0D57, 4803, 1, 0, 0 },
+        { 0x0D3E, 4804, 1, 0, 0 },
+        { 0x0DCA, 4805, 1, 0, 0 },
+        { 0x0DCF, 4806, 1, 993, 1 },
+        { 0x0DDF, 4807, 1, 0, 0 },
+        { 0x0E01, 4808, 2, 0, 0 },
+        { 0x0E02, 4810, 2, 0, 0 },
+        { 0x0E03, 4812, 2, 0, 0 },
+        { 0x0E04, 4814, 2, 0, 0 },
+        { 0x0E05, 4816, 2, 0, 0 },
+        { 0x0E06, 4818, 2, 0, 0 },
+        { 0x0E07, 4820, 2, 0, 0 },
+        { 0x0E08, 4822, 2, 0, 0 },
+        { 0x0E09, 4824, 2, 0, 0 },
+        { 0x0E0A, 4826, 2, 0, 0 },
+        { 0x0E0B, 4828, 2, 0, 0 },
+        { 0x0E0C, 4830, 2, 0, 0 },
+        { 0x0E0D, 4832, 2, 0, 0 },
+        { 0x0E0E, 4834, 2, 0, 0 },
+        { 0x0E0F, 4836, 2, 0, 0 },
+        { 0x0E10, 4838, 2, 0, 0 },
+        { 0x0E11, 4840, 2, 0, 0 },
+        { 0x0E12, 4842, 2, 0, 0 },
+        { 0x0E13, 4844, 2, 0, 0 },
+        { 0x0E14, 4846, 2, 0, 0 },
+        { 0x0E15, 4848, 2, 0, 0 },
+        { 0x0E16, 4850, 2, 0, 0 },
+        { 0x0E17, 4852, 2, 0, 0 },
+        { 0x0E18, 4854, 2, 0, 0 },
+        { 0x0E19, 4856, 2, 0, 0 },
+        { 0x0E1A, 4858, 2, 0, 0 },
+        { 0x0E1B, 4860, 2, 0, 0 },
+        { 0x0E1C, 4862, 2, 0, 0 },
+        { 0x0E1D, 4864, 2, 0, 0 },
+        { 0x0E1E, 4866, 2, 0, 0 },
+        { 0x0E1F, 4868, 2, 0, 0 },
+        { 0x0E20, 4870, 2, 0, 0 },
+        { 0x0E21, 4872, 2, 0, 0 },
+        { 0x0E22, 4874, 2, 0, 0 },
+        { 0x0E23, 4876, 2, 0, 0 },
+        { 0x0E24, 4878, 2, 0, 0 },
+        { 0x0E25, 4880, 2, 0, 0 },
+        { 0x0E26, 4882, 2, 0, 0 },
+        { 0x0E27, 4884, 2, 0, 0 },
+        { 0x0E28, 4886, 2, 0, 0 },
+        { 0x0E29, 4888, 2, 0, 0 },
+        { 0x0E2A, 4890, 2, 0, 0 },
+        { 0x0E2B, 4892, 2, 0, 0 },
+        { 0x0E2C, 4894, 2, 0, 0 },
+        { 0x0E2D, 4896, 2, 0, 0 },
+        { 0x0E2E, 4898, 2, 0, 0 },
+        { 0x0E01, 4900, 2, 0, 0 },
+        { 0x0E02, 4902, 2, 0, 0 },
+        { 0x0E03, 4904, 2, 0, 0 },
+        { 0x0E04, 4906, 2, 0, 0 },
+        { 0x0E05, 4908, 2, 0, 0 },
+        { 0x0E06, 4910, 2, 0, 0 },
+        { 0x0E07, 4912, 2, 0, 0 },
+        { 0x0E08, 4914, 2, 0, 0 },
+        { 0x0E09, 4916, 2, 0, 0 },
+        { 0x0E0A, 4918, 2, 0, 0 },
+        { 0x0E0B, 4920, 2, 0, 0 },
+        { 0x0E0C, 4922, 2, 0, 0 },
+        { 0x0E0D, 4924, 2, 0, 0 },
+        { 0x0E0E, 4926, 2, 0, 0 },
+        { 0x0E0F, 4928, 2, 0, 0 },
+        { 0x0E10, 4930, 2, 0, 0 },
+        { 0x0E11, 4932, 2, 0, 0 },
+        { 0x0E12, 4934, 2, 0, 0 },
+        { 0x0E13, 4936, 2, 0, 0 },
+        { 0x0E14, 4938, 2, 0, 0 },
+        { 0x0E15, 4940, 2, 0, 0 },
+        { 0x0E16, 4942, 2, 0, 0 },
+        { 0x0E17, 4944, 2, 0, 0 },
+        { 0x0E18, 4946, 2, 0, 0 },
+        { 0x0E19, 4948, 2, 0, 0 },
+        { 0x0E1A, 4950, 2, 0, 0 },
+        { 0x0E1B, 4952, 2, 0, 0 },
+        { 0x0E1C, 4954, 2, 0, 0 },
+        { 0x0E1D, 4956, 2, 0, 0 },
+        { 0x0E1E, 4958, 2, 0, 0 },
+        { 0x0E1F, 4960, 2, 0, 0 },
+        { 0x0E20, 4962, 2, 0, 0 },
+        { 0x0E21, 4964, 2, 0, 0 },
+        { 0x0E22, 4966, 2, 0, 0 },
+        { 0x0E23, 4968, 2, 0, 0 },
+        { 0x0E24, 4970, 2, 0, 0 },
+        { 0x0E25, 4972, 2, 0, 0 },
+        { 0x0E26, 4974, 2, 0, 0 },
+        { 0x0E27, 4976, 2, 0, 0 },
+        { 0x0E28, 4978, 2, 0, 0 },
+        { 0x0E29, 4980, 2, 0, 0 },
+        { 0x0E2A, 4982, 2, 0, 0 },
+        { 0x0E2B, 4984, 2, 0, 0 },
+        { 0x0E2C, 4986, 2, 0, 0 },
+        { 0x0E2D, 4988, 2, 0, 0 },
+        { 0x0E2E, 4990, 2, 0, 0 },
+        { 0x0E01, 4992, 2, 0, 0 },
+        { 0x0E02, 4994, 2, 0, 0 },
+        { 0x0E03, 4996, 2, 0, 0 },
+        { 0x0E04, 4998, 2, 0, 0 },
+        { 0x0E05, 5000, 2, 0, 0 },
+        { 0x0E06, 5002, 2, 0, 0 },
+        { 0x0E07, 5004, 2, 0, 0 },
+        { 0x0E08, 5006, 2, 0, 0 },
+        { 0x0E09, 5008, 2, 0, 0 },
+        { 0x0E0A, 5010, 2, 0, 0 },
+        { 0x0E0B, 5012, 2, 0, 0 },
+        { 0x0E0C, 5014, 2, 0, 0 },
+        { 0x0E0D, 5016, 2, 0, 0 },
+        { 0x0E0E, 5018, 2, 0, 0 },
+        { 0x0E0F, 5020, 2, 0, 0 },
+        { 0x0E10, 5022, 2, 0, 0 },
+        { 0x0E11, 5024, 2, 0, 0 },
+        { 0x0E12, 5026, 2, 0, 0 },
+        { 0x0E13, 5028, 2, 0, 0 },
+        { 0x0E14, 5030, 2, 0, 0 },
+        { 0x0E15, 5032, 2, 0, 0 },
+        { 0x0E16, 5034, 2, 0, 0 },
+        { 0x0E17, 5036, 2, 0, 0 },
+        { 0x0E18, 5038, 2, 0, 0 },
+        { 0x0E19, 5040, 2, 0, 0 },
+        { 0x0E1A, 5042, 2, 0, 0 },
+        { 0x0E1B, 5044, 2, 0, 0 },
+        { 0x0E1C, 5046, 2, 0, 0 },
+        { 0x0E1D, 5048, 2, 0, 0 },
+        { 0x0E1E, 5050, 2, 0, 0 },
+        { 0x0E1F, 5052, 2, 0, 0 },
+        { 0x0E20, 5054, 2, 0, 0 },
+        { 0x0E21, 5056, 2, 0, 0 },
+        { 0x0E22, 5058, 2, 0, 0 },
+        { 0x0E23, 5060, 2, 0, 0 },
+        { 0x0E24, 5062, 2, 0, 0 },
+        { 0x0E25, 5064, 2, 0, 0 },
+        { 0x0E26, 5066, 2, 0, 0 },
+        { 0x0E27, 5068, 2, 0, 0 },
+        { 0x0E28, 5070, 2, 0, 0 },
+        { 0x0E29, 5072, 2, 0, 0 },
+        { 0x0E2A, 5074, 2, 0, 0 },
+        { 0x0E2B, 5076, 2, 0, 0 },
+        { 0x0E2C, 5078, 2, 0, 0 },
+        { 0x0E2D, 5080, 2, 0, 0 },
+        { 0x0E2E, 5082, 2, 0, 0 },
+        { 0x0E01, 5084, 2, 0, 0 },
+        { 0x0E02, 5086, 2, 0, 0 },
+        { 0x0E03, 5088, 2, 0, 0 },
+        { 0x0E04, 5090, 2, 0, 0 },
+        { 0x0E05, 5092, 2, 0, 0 },
+        { 0x0E06, 5094, 2, 0, 0 },
+        { 0x0E07, 5096, 2, 0, 0 },
+        { 0x0E08, 5098, 2, 0, 0 },
+        { 0x0E09, 5100, 2, 0, 0 },
+        { 0x0E0A, 5102, 2, 0, 0 },
+        { 0x0E0B, 5104, 2, 0, 0 },
+        { 0x0E0C, 5106, 2, 0, 0 },
+        { 0x0E0D, 5108, 2, 0, 0 },
+        { 0x0E0E, 5110, 2, 0, 0 },
+        { 0x0E0F, 5112, 2, 0, 0 },
+        { 0x0E10, 5114, 2, 0, 0 },
+        { 0x0E11, 5116, 2, 0, 0 },
+        { 0x0E12, 5118, 2, 0, 0 },
+        { 0x0E13, 5120, 2, 0, 0 },
+        { 0x0E14, 5122, 2, 0, 0 },
+        { 0x0E15, 5124, 2, 0, 0 },
+        { 0x0E16, 5126, 2, 0, 0 },
+        { 0x0E17, 5128, 2, 0, 0 },
+        { 0x0E18, 5130, 2, 0, 0 },
+        { 0x0E19, 5132, 2, 0, 0 },
+        { 0x0E1A, 5134, 2, 0, 0 },
+        { 0x0E1B, 5136, 2, 0, 0 },
+        { 0x0E1C, 5138, 2, 0, 0 },
+        { 0x0E1D, 5140, 2, 0, 0 },
+        { 0x0E1E, 5142, 2, 0, 0 },
+        { 0x0E1F, 5144, 2, 0, 0 },
+        { 0x0E20, 5146, 2, 0, 0 },
+        { 0x0E21, 5148, 2, 0, 0 },
+        { 0x0E22, 5150, 2, 0, 0 },
+        { 0x0E23, 5152, 2, 0, 0 },
+        { 0x0E24, 5154, 2, 0, 0 },
+        { 0x0E25, 5156, 2, 0, 0 },
+        { 0x0E26, 5158, 2, 0, 0 },
+        { 0x0E27, 5160, 2, 0, 0 },
+        { 0x0E28, 5162, 2, 0, 0 },
+        { 0x0E29, 5164, 2, 0, 0 },
+        { 0x0E2A, 5166, 2, 0, 0 },
+        { 0x0E2B, 5168, 2, 0, 0 },
+        { 0x0E2C, 5170, 2, 0, 0 },
+        { 0x0E2D, 5172, 2, 0, 0 },
+        { 0x0E2E, 5174, 2, 0, 0 },
+        { 0x0E01, 5176, 2, 0, 0 },
+        { 0x0E02, 5178, 2, 0, 0 },
+        { 0x0E03, 5180, 2, 0, 0 },
+        { 0x0E04, 5182, 2, 0, 0 },
+        { 0x0E05, 5184, 2, 0, 0 },
+        { 0x0E06, 5186, 2, 0, 0 },
+        { 0x0E07, 5188, 2, 0, 0 },
+        { 0x0E08, 5190, 2, 0, 0 },
+        { 0x0E09, 5192, 2, 0, 0 },
+        { 0x0E0A, 5194, 2, 0, 0 },
+        { 0x0E0B, 5196, 2, 0, 0 },
+        { 0x0E0C, 5198, 2, 0, 0 },
+        { 0x0E0D, 5200, 2, 0, 0 },
+        { 0x0E0E, 5202, 2, 0, 0 },
+        { 0x0E0F, 5204, 2, 0, 0 },
+        { 0x0E10, 5206, 2, 0, 0 },
+        { 0x0E11, 5208, 2, 0, 0 },
+        { 0x0E12, 5210, 2, 0, 0 },
+        { 0x0E13, 5212, 2, 0, 0 },
+        { 0x0E14, 5214, 2, 0, 0 },
+        { 0x0E15, 5216, 2, 0, 0 },
+        { 0x0E16, 5218, 2, 0, 0 },
+        { 0x0E17, 5220, 2, 0, 0 },
+        { 0x0E18, 5222, 2, 0, 0 },
+        { 0x0E19, 5224, 2, 0, 0 },
+        { 0x0E1A, 5226, 2, 0, 0 },
+        { 0x0E1B, 5228, 2, 0, 0 },
+        { 0x0E1C, 5230, 2, 0, 0 },
+        { 0x0E1D, 5232, 2, 0, 0 },
+        { 0x0E1E, 5234, 2, 0, 0 },
+        { 0x0E1F, 5236, 2, 0, 0 },
+        { 0x0E20, 5238, 2, 0, 0 },
+        { 0x0E21, 5240, 2, 0, 0 },
+        { 0x0E22, 5242, 2, 0, 0 },
+        { 0x0E23, 5244, 2, 0, 0 },
+        { 0x0E24, 5246, 2, 0, 0 },
+        { 0x0E25, 5248, 2, 0, 0 },
+        { 0x0E26, 5250, 2, 0, 0 },
+        { 0x0E27, 5252, 2, 0, 0 },
+        { 0x0E28, 5254, 2, 0, 0 },
+        { 0x0E29, 5256, 2, 0, 0 },
+        { 0x0E2A, 5258, 2, 0, 0 },
+        { 0x0E2B, 5260, 2, 0, 0 },
+        { 0x0E2C, 5262, 2, 0, 0 },
+        { 0x0E2D, 5264, 2, 0, 0 },
+        { 0x0E2E, 5266, 2, 0, 0 },
+        { 0x0E32, 5268, 1, 0, 0 },
+        { 0x0E81, 5269, 2, 0, 0 },
+        { 0x0E82, 5271, 2, 0, 0 },
+        { 0x0E84, 5273, 2, 0, 0 },
+        { 0x0E86, 5275, 2, 0, 0 },
+        { 0x0E87, 5277, 2, 0, 0 },
+        { 0x0E88, 5279, 2, 0, 0 },
+        { 0x0E89, 5281, 2, 0, 0 },
+        { 0x0E8A, 5283, 2, 0, 0 },
+        { 0x0E8C, 5285, 2, 0, 0 },
+        { 0x0E8D, 5287, 2, 0, 0 },
+        { 0x0E8E, 5289, 2, 0, 0 },
+        { 0x0E8F, 5291, 2, 0, 0 },
+        { 0x0E90, 5293, 2, 0, 0 },
+        { 0x0E91, 5295, 2, 0, 0 },
+        { 0x0E92, 5297, 2, 0, 0 },
+        { 0x0E93, 5299, 2, 0, 0 },
+        { 0x0E94, 5301, 2, 0, 0 },
+        { 0x0E95, 5303, 2, 0, 0 },
+        { 0x0E96, 5305, 2, 0, 0 },
+        { 0x0E97, 5307, 2, 0, 0 },
+        { 0x0E98, 5309, 2, 0, 0 },
+        { 0x0E99, 5311, 2, 0, 0 },
+        { 0x0E9A, 5313, 2, 0, 0 },
+        { 0x0E9B, 5315, 2, 0, 0 },
+        { 0x0E9C, 5317, 2, 0, 0 },
+        { 0x0E9D, 5319, 2, 0, 0 },
+        { 0x0E9E, 5321, 2, 0, 0 },
+        { 0x0E9F, 5323, 2, 0, 0 },
+        { 0x0EA0, 5325, 2, 0, 0 },
+        { 0x0EA1, 5327, 2, 0, 0 },
+        { 0x0EA2, 5329, 2, 0, 0 },
+        { 0x0EA3, 5331, 2, 0, 0 },
+        { 0x0EA5, 5333, 2, 0, 0 },
+        { 0x0EA7, 5335, 2, 0, 0 },
+        { 0x0EA8, 5337, 2, 0, 0 },
+        { 0x0EA9, 5339, 2, 0, 0 },
+        { 0x0EAA, 5341, 2, 0, 0 },
+        { 0x0EAB, 5343, 2, 0, 0 },
+        { 0x0EAC, 5345, 2, 0, 0 },
+        { 0x0EAD, 5347, 2, 0, 0 },
+        { 0x0EAE, 5349, 2, 0, 0 },
+        { 0x0EDC, 5351, 3, 0, 0 },
+        { 0x0EDD, 5354, 3, 0, 0 },
+        { 0x0EDE, 5357, 2, 0, 0 },
+        { 0x0EDF, 5359, 2, 0, 0 },
+        { 0x0E81, 5361, 2, 0, 0 },
+        { 0x0E82, 5363, 2, 0, 0 },
+        { 0x0E84, 5365, 2, 0, 0 },
+        { 0x0E86, 5367, 2, 0, 0 },
+        { 0x0E87, 5369, 2, 0, 0 },
+        { 0x0E88, 5371, 2, 0, 0 },
+        { 0x0E89, 5373, 2, 0, 0 },
+        { 0x0E8A, 5375, 2, 0, 0 },
+        { 0x0E8C, 5377, 2, 0, 0 },
+        { 0x0E8D, 5379, 2, 0, 0 },
+        { 0x0E8E, 5381, 2, 0, 0 },
+        { 0x0E8F, 5383, 2, 0, 0 },
+        { 0x0E90, 5385, 2, 0, 0 },
+        { 0x0E91, 5387, 2, 0, 0 },
+        { 0x0E92, 5389, 2, 0, 0 },
+        { 0x0E93, 5391, 2, 0, 0 },
+        { 0x0E94, 5393, 2, 0, 0 },
+        { 0x0E95, 5395, 2, 0, 0 },
+        { 0x0E96, 5397, 2, 0, 0 },
+        { 0x0E97, 5399, 2, 0, 0 },
+        { 0x0E98, 5401, 2, 0, 0 },
+        { 0x0E99, 5403, 2, 0, 0 },
+        { 0x0E9A, 5405, 2, 0, 0 },
+        { 0x0E9B, 5407, 2, 0, 0 },
+        { 0x0E9C, 5409, 2, 0, 0 },
+        { 0x0E9D, 5411, 2, 0, 0 },
+        { 0x0E9E, 5413, 2, 0, 0 },
+        { 0x0E9F, 5415, 2, 0, 0 },
+        { 0x0EA0, 5417, 2, 0, 0 },
+        { 0x0EA1, 5419, 2, 0, 0 },
+        { 0x0EA2, 5421, 2, 0, 0 },
+        { 0x0EA3, 5423, 2, 0, 0 },
+        { 0x0EA5, 5425, 2, 0, 0 },
+        { 0x0EA7, 5427, 2, 0, 0 },
+        { 0x0EA8, 5429, 2, 0, 0 },
+        { 0x0EA9, 5431, 2, 0, 0 },
+        { 0x0EAA, 5433, 2, 0, 0 },
+        { 0x0EAB, 5435, 2, 0, 0 },
+        { 0x0EAC, 5437, 2, 0, 0 },
+        { 0x0EAD, 5439, 2, 0, 0 },
+        { 0x0EAE, 5441, 2, 0, 0 },
+        { 0x0EDC, 5443, 3, 0, 0 },
+        { 0x0EDD, 5446, 3, 0, 0 },
+        { 0x0EDE, 5449, 2, 0, 0 },
+        { 0x0EDF, 5451, 2, 0, 0 },
+        { 0x0E81, 5453, 2, 0, 0 },
+        { 0x0E82, 5455, 2, 0, 0 },
+        { 0x0E84, 5457, 2, 0, 0 },
+        { 0x0E86, 5459, 2, 0, 0 },
+        { 0x0E87, 5461, 2, 0, 0 },
+        { 0x0E88, 5463, 2, 0, 0 },
+        { 0x0E89, 5465, 2, 0, 0 },
+        { 0x0E8A, 5467, 2, 0, 0 },
+        { 0x0E8C, 5469, 2, 0, 0 },
+        { 0x0E8D, 5471, 2, 0, 0 },
+        { 0x0E8E, 5473, 2, 0, 0 },
+        { 0x0E8F, 5475, 2, 0, 0 },
+        { 0x0E90, 5477, 2, 0, 0 },
+        { 0x0E91, 5479, 2, 0, 0 },
+        { 0x0E92, 5481, 2, 0, 0 },
+        { 0x0E93, 5483, 2, 0, 0 },
+        { 0x0E94, 5485, 2, 0, 0 },
+        { 0x0E95, 5487, 2, 0, 0 },
+        { 0x0E96, 5489, 2, 0, 0 },
+        { 0x0E97, 5491, 2, 0, 0 },
+        { 0x0E98, 5493, 2, 0, 0 },
+        { 0x0E99, 5495, 2, 0, 0 },
+        { 0x0E9A, 5497, 2, 0, 0 },
+        { 0x0E9B, 5499, 2, 0, 0 },
+        { 0x0E9C, 5501, 2, 0, 0 },
+        { 0x0E9D, 5503, 2, 0, 0 },
+        { 0x0E9E, 5505, 2, 0, 0 },
+        { 0x0E9F, 5507, 2, 0, 0 },
+        { 0x0EA0, 5509, 2, 0, 0 },
+        { 0x0EA1, 5511, 2, 0, 0 },
+        { 0x0EA2, 5513, 2, 0, 0 },
+        { 0x0EA3, 5515, 2, 0, 0 },
+        { 0x0EA5, 5517, 2, 0, 0 },
+        { 0x0EA7, 5519, 2, 0, 0 },
+        { 0x0EA8, 5521, 2, 0, 0 },
+        { 0x0EA9, 5523, 2, 0, 0 },
+        { 0x0EAA, 5525, 2, 0, 0 },
+        { 0x0EAB, 5527, 2, 0, 0 },
+        { 0x0EAC, 5529, 2, 0, 0 },
+        { 0x0EAD, 5531, 2, 0, 0 },
+        { 0x0EAE, 5533, 2, 0, 0 },
+        { 0x0EDC, 5535, 3, 0, 0 },
+        { 0x0EDD, 5538, 3, 0, 0 },
+        { 0x0EDE, 5541, 2, 0, 0 },
+        { 0x0EDF, 5543, 2, 0, 0 },
+        { 0x0E81, 5545, 2, 0, 0 },
+        { 0x0E82, 5547, 2, 0, 0 },
+        { 0x0E84, 5549, 2, 0, 0 },
+        { 0x0E86, 5551, 2, 0, 0 },
+        { 0x0E87, 5553, 2, 0, 0 },
+        { 0x0E88, 5555, 2, 0, 0 },
+        { 0x0E89, 5557, 2, 0, 0 },
+        { 0x0E8A, 5559, 2, 0, 0 },
+        { 0x0E8C, 5561, 2, 0, 0 },
+        { 0x0E8D, 5563, 2, 0, 0 },
+        { 0x0E8E, 5565, 2, 0, 0 },
+        { 0x0E8F, 5567, 2, 0, 0 },
+        { 0x0E90, 5569, 2, 0, 0 },
+        { 0x0E91, 5571, 2, 0, 0 },
+        { 0x0E92, 5573, 2, 0, 0 },
+        { 0x0E93, 5575, 2, 0, 0 },
+        { 0x0E94, 5577, 2, 0, 0 },
+        { 0x0E95, 5579, 2, 0, 0 },
+        { 0x0E96, 5581, 2, 0, 0 },
+        { 0x0E97, 5583, 2, 0, 0 },
+        { 0x0E98, 5585, 2, 0, 0 },
+        { 0x0E99, 5587, 2, 0, 0 },
+        { 0x0E9A, 5589, 2, 0, 0 },
+        { 0x0E9B, 5591, 2, 0, 0 },
+        { 0x0E9C, 5593, 2, 0, 0 },
+        { 0x0E9D, 5595, 2, 0, 0 },
+        { 0x0E9E, 5597, 2, 0, 0 },
+        { 0x0E9F, 5599, 2, 0, 0 },
+        { 0x0EA0, 5601, 2, 0, 0 },
+        { 0x0EA1, 5603, 2, 0, 0 },
+        { 0x0EA2, 5605, 2, 0, 0 },
+        { 0x0EA3, 5607, 2, 0, 0 },
+        { 0x0EA5, 5609, 2, 0, 0 },
+        { 0x0EA7, 5611, 2, 0, 0 },
+        { 0x0EA8, 5613, 2, 0, 0 },
+        { 0x0EA9, 5615, 2, 0, 0 },
+        { 0x0EAA, 5617, 2, 0, 0 },
+        { 0x0EAB, 5619, 2, 0, 0 },
+        { 0x0EAC, 5621, 2, 0, 0 },
+        { 0x0EAD, 5623, 2, 0, 0 },
+        { 0x0EAE, 5625, 2, 0, 0 },
+        { 0x0EDC, 5627, 3, 0, 0 },
+        { 0x0EDD, 5630, 3, 0, 0 },
+        { 0x0EDE, 5633, 2, 0, 0 },
+        { 0x0EDF, 5635, 2, 0, 0 },
+        { 0x0E81, 5637, 2, 0, 0 },
+        { 0x0E82, 5639, 2, 0, 0 },
+        { 0x0E84, 5641, 2, 0, 0 },
+        { 0x0E86, 5643, 2, 0, 0 },
+        { 0x0E87, 5645, 2, 0, 0 },
+        { 0x0E88, 5647, 2, 0, 0 },
+        { 0x0E89, 5649, 2, 0, 0 },
+        { 0x0E8A, 5651, 2, 0, 0 },
+        { 0x0E8C, 5653, 2, 0, 0 },
+        { 0x0E8D, 5655, 2, 0, 0 },
+        { 0x0E8E, 5657, 2, 0, 0 },
+        { 0x0E8F, 5659, 2, 0, 0 },
+        { 0x0E90, 5661, 2, 0, 0 },
+        { 0x0E91, 5663, 2, 0, 0 },
+        { 0x0E92, 5665, 2, 0, 0 },
+        { 0x0E93, 5667, 2, 0, 0 },
+        { 0x0E94, 5669, 2, 0, 0 },
+        { 0x0E95, 5671, 2, 0, 0 },
+        { 0x0E96, 5673, 2, 0, 0 },
+        { 0x0E97, 5675, 2, 0, 0 },
+        { 0x0E98, 5677, 2, 0, 0 },
+        { 0x0E99, 5679, 2, 0, 0 },
+        { 0x0E9A, 5681, 2, 0, 0 },
+        { 0x0E9B, 5683, 2, 0, 0 },
+        { 0x0E9C, 5685, 2, 0, 0 },
+        { 0x0E9D, 5687, 2, 0, 0 },
+        { 0x0E9E, 5689, 2, 0, 0 },
+        { 0x0E9F, 5691, 2, 0, 0 },
+        { 0x0EA0, 5693, 2, 0, 0 },
+        { 0x0EA1, 5695, 2, 0, 0 },
+        { 0x0EA2, 5697, 2, 0, 0 },
+        { 0x0EA3, 5699, 2, 0, 0 },
+        { 0x0EA5, 5701, 2, 0, 0 },
+        { 0x0EA7, 5703, 2, 0, 0 },
+        { 0x0EA8, 5705, 2, 0, 0 },
+        { 0x0EA9, 5707, 2, 0, 0 },
+        { 0x0EAA, 5709, 2, 0, 0 },
+        { 0x0EAB, 5711, 2, 0, 0 },
+        { 0x0EAC, 5713, 2, 0, 0 },
+        { 0x0EAD, 5715, 2, 0, 0 },
+        { 0x0EAE, 5717, 2, 0, 0 },
+        { 0x0EDC, 5719, 3, 0, 0 },
+        { 0x0EDD, 5722, 3, 0, 0 },
+        { 0x0EDE, 5725, 2, 0, 0 },
+        { 0x0EDF, 5727, 2, 0, 0 },
+        { 0x0EB2, 5729, 1, 0, 0 },
+        { 0x0F72, 5730, 1, 0, 0 },
+        { 0x0F74, 5731, 1, 0, 0 },
+        { 0x0F80, 5732, 1, 0, 0 },
+        { 0x0F71, 0, 0, 994, 1 },
+        { 0x0F80, 5733, 1, 0, 0 },
+        { 0x0F71, 0, 0, 995, 1 },
+        { 0x0F80, 5734, 1, 0, 0 },
+        { 0x102E, 5735, 1, 0, 0 },
+        { 0x1980, 5736, 2, 0, 0 },
+        { 0x1981, 5738, 2, 0, 0 },
+        { 0x1982, 5740, 2, 0, 0 },
+        { 0x1983, 5742, 2, 0, 0 },
+        { 0x1984, 5744, 2, 0, 0 },
+        { 0x1985, 5746, 2, 0, 0 },
+        { 0x1986, 5748, 2, 0, 0 },
+        { 0x1987, 5750, 2, 0, 0 },
+        { 0x1988, 5752, 2, 0, 0 },
+        { 0x1989, 5754, 2, 0, 0 },
+        { 0x198A, 5756, 2, 0, 0 },
+        { 0x198B, 5758, 2, 0, 0 },
+        { 0x198C, 5760, 2, 0, 0 },
+        { 0x198D, 5762, 2, 0, 0 },
+        { 0x198E, 5764, 2, 0, 0 },
+        { 0x198F, 5766, 2, 0, 0 },
+        { 0x1990, 5768, 2, 0, 0 },
+        { 0x1991, 5770, 2, 0, 0 },
+        { 0x1992, 5772, 2, 0, 0 },
+        { 0x1993, 5774, 2, 0, 0 },
+        { 0x1994, 5776, 2, 0, 0 },
+        { 0x1995, 5778, 2, 0, 0 },
+        { 0x1996, 5780, 2, 0, 0 },
+        { 0x1997, 5782, 2, 0, 0 },
+        { 0x1998, 5784, 2, 0, 0 },
+        { 0x1999, 5786, 2, 0, 0 },
+        { 0x199A, 5788, 2, 0, 0 },
+        { 0x199B, 5790, 2, 0, 0 },
+        { 0x199C, 5792, 2, 0, 0 },
+        { 0x199D, 5794, 2, 0, 0 },
+        { 0x199E, 5796, 2, 0, 0 },
+        { 0x199F, 5798, 2, 0, 0 },
+        { 0x19A0, 5800, 2, 0, 0 },
+        { 0x19A1, 5802, 2, 0, 0 },
+        { 0x19A2, 5804, 2, 0, 0 },
+        { 0x19A3, 5806, 2, 0, 0 },
+        { 0x19A4, 5808, 2, 0, 0 },
+        { 0x19A5, 5810, 2, 0, 0 },
+        { 0x19A6, 5812, 2, 0, 0 },
+        { 0x19A7, 5814, 2, 0, 0 },
+        { 0x19A8, 5816, 2, 0, 0 },
+        { 0x19A9, 5818, 2, 0, 0 },
+        { 0x19AA, 5820, 2, 0, 0 },
+        { 0x19AB, 5822, 2, 0, 0 },
+        { 0x1980, 5824, 2, 0, 0 },
+        { 0x1981, 5826, 2, 0, 0 },
+        { 0x1982, 5828, 2, 0, 0 },
+        { 0x1983, 5830, 2, 0, 0 },
+        { 0x1984, 5832, 2, 0, 0 },
+        { 0x1985, 5834, 2, 0, 0 },
+        { 0x1986, 5836, 2, 0, 0 },
+        { 0x1987, 5838, 2, 0, 0 },
+        { 0x1988, 5840, 2, 0, 0 },
+        { 0x1989, 5842, 2, 0, 0 },
+        { 0x198A, 5844, 2, 0, 0 },
+        { 0x198B, 5846, 2, 0, 0 },
+        { 0x198C, 5848, 2, 0, 0 },
+        { 0x198D, 5850, 2, 0, 0 },
+        { 0x198E, 5852, 2, 0, 0 },
+        { 0x198F, 5854, 2, 0, 0 },
+        { 0x1990, 5856, 2, 0, 0 },
+        { 0x1991, 5858, 2, 0, 0 },
+        { 0x1992, 5860, 2, 0, 0 },
+        { 0x1993, 5862, 2, 0, 0 },
+        { 0x1994, 5864, 2, 0, 0 },
+        { 0x1995, 5866, 2, 0, 0 },
+        { 0x1996, 5868, 2, 0, 0 },
+        { 0x1997, 5870, 2, 0, 0 },
+        { 0x1998, 5872, 2, 0, 0 },
+        { 0x1999, 5874, 2, 0, 0 },
+        { 0x199A, 5876, 2, 0, 0 },
+        { 0x199B, 5878, 2, 0, 0 },
+        { 0x199C, 5880, 2, 0, 0 },
+        { 0x199D, 5882, 2, 0, 0 },
+        { 0x199E, 5884, 2, 0, 0 },
+        { 0x199F, 5886, 2, 0, 0 },
+        { 0x19A0, 5888, 2, 0, 0 },
+        { 0x19A1, 5890, 2, 0, 0 },
+        { 0x19A2, 5892, 2, 0, 0 },
+        { 0x19A3, 5894, 2, 0, 0 },
+        { 0x19A4, 5896, 2, 0, 0 },
+        { 0x19A5, 5898, 2, 0, 0 },
+        { 0x19A6, 5900, 2, 0, 0 },
+        { 0x19A7, 5902, 2, 0, 0 },
+        { 0x19A8, 5904, 2, 0, 0 },
+        { 0x19A9, 5906, 2, 0, 0 },
+        { 0x19AA, 5908, 2, 0, 0 },
+        { 0x19AB, 5910, 2, 0, 0 },
+        { 0x1980, 5912, 2, 0, 0 },
+        { 0x1981, 5914, 2, 0, 0 },
+        { 0x1982, 5916, 2, 0, 0 },
+        { 0x1983, 5918, 2, 0, 0 },
+        { 0x1984, 5920, 2, 0, 0 },
+        { 0x1985, 5922, 2, 0, 0 },
+        { 0x1986, 5924, 2, 0, 0 },
+        { 0x1987, 5926, 2, 0, 0 },
+        { 0x1988, 5928, 2, 0, 0 },
+        { 0x1989, 5930, 2, 0, 0 },
+        { 0x198A, 5932, 2, 0, 0 },
+        { 0x198B, 5934, 2, 0, 0 },
+        { 0x198C, 5936, 2, 0, 0 },
+        { 0x198D, 5938, 2, 0, 0 },
+        { 0x198E, 5940, 2, 0, 0 },
+        { 0x198F, 5942, 2, 0, 0 },
+        { 0x1990, 5944, 2, 0, 0 },
+        { 0x1991, 5946, 2, 0, 0 },
+        { 0x1992, 5948, 2, 0, 0 },
+        { 0x1993, 5950, 2, 0, 0 },
+        { 0x1994, 5952, 2, 0, 0 },
+        { 0x1995, 5954, 2, 0, 0 },
+        { 0x1996, 5956, 2, 0, 0 },
+        { 0x1997, 5958, 2, 0, 0 },
+        { 0x1998, 5960, 2, 0, 0 },
+        { 0x1999, 5962, 2, 0, 0 },
+        { 0x199A, 5964, 2, 0, 0 },
+        { 0x199B, 5966, 2, 0, 0 },
+        { 0x199C, 5968, 2, 0, 0 },
+        { 0x199D, 5970, 2, 0, 0 },
+        { 0x199E, 5972, 2, 0, 0 },
+        { 0x199F, 5974, 2, 0, 0 },
+        { 0x19A0, 5976, 2, 0, 0 },
+        { 0x19A1, 5978, 2, 0, 0 },
+        { 0x19A2, 5980, 2, 0, 0 },
+        { 0x19A3, 5982, 2, 0, 0 },
+        { 0x19A4, 5984, 2, 0, 0 },
+        { 0x19A5, 5986, 2, 0, 0 },
+        { 0x19A6, 5988, 2, 0, 0 },
+        { 0x19A7, 5990, 2, 0, 0 },
+        { 0x19A8, 5992, 2, 0, 0 },
+        { 0x19A9, 5994, 2, 0, 0 },
+        { 0x19AA, 5996, 2, 0, 0 },
+        { 0x19AB, 5998, 2, 0, 0 },
+        { 0x1980, 6000, 2, 0, 0 },
+        { 0x1981, 6002, 2, 0, 0 },
+        { 0x1982, 6004, 2, 0, 0 },
+        { 0x1983, 6006, 2, 0, 0 },
+        { 0x1984, 6008, 2, 0, 0 },
+        { 0x1985, 6010, 2, 0, 0 },
+        { 0x1986, 6012, 2, 0, 0 },
+        { 0x1987, 6014, 2, 0, 0 },
+        { 0x1988, 6016, 2, 0, 0 },
+        { 0x1989, 6018, 2, 0, 0 },
+        { 0x198A, 6020, 2, 0, 0 },
+        { 0x198B, 6022, 2, 0, 0 },
+        { 0x198C, 6024, 2, 0, 0 },
+        { 0x198D, 6026, 2, 0, 0 },
+        { 0x198E, 6028, 2, 0, 0 },
+        { 0x198F, 6030, 2, 0, 0 },
+        { 0x1990, 6032, 2, 0, 0 },
+        { 0x1991, 6034, 2, 0, 0 },
+        { 0x1992, 6036, 2, 0, 0 },
+        { 0x1993, 6038, 2, 0, 0 },
+        { 0x1994, 6040, 2, 0, 0 },
+        { 0x1995, 6042, 2, 0, 0 },
+        { 0x1996, 6044, 2, 0, 0 },
+        { 0x1997, 6046, 2, 0, 0 },
+        { 0x1998, 6048, 2, 0, 0 },
+        { 0x1999, 6050, 2, 0, 0 },
+        { 0x199A, 6052, 2, 0, 0 },
+        { 0x199B, 6054, 2, 0, 0 },
+        { 0x199C, 6056, 2, 0, 0 },
+        { 0x199D, 6058, 2, 0, 0 },
+        { 0x199E, 6060, 2, 0, 0 },
+        { 0x199F, 6062, 2, 0, 0 },
+        { 0x19A0, 6064, 2, 0, 0 },
+        { 0x19A1, 6066, 2, 0, 0 },
+        { 0x19A2, 6068, 2, 0, 0 },
+        { 0x19A3, 6070, 2, 0, 0 },
+        { 0x19A4, 6072, 2, 0, 0 },
+        { 0x19A5, 6074, 2, 0, 0 },
+        { 0x19A6, 6076, 2, 0, 0 },
+        { 0x19A7, 6078, 2, 0, 0 },
+        { 0x19A8, 6080, 2, 0, 0 },
+        { 0x19A9, 6082, 2, 0, 0 },
+        { 0x19AA, 6084, 2, 0, 0 },
+        { 0x19AB, 6086, 2, 0, 0 },
+        { 0x1B35, 6088, 1, 0, 0 },
+        { 0x1B35, 6089, 1, 0, 0 },
+        { 0x1B35, 6090, 1, 0, 0 },
+        { 0x1B35, 6091, 1, 0, 0 },
+        { 0x1B35, 6092, 1, 0, 0 },
+        { 0x1B35, 6093, 1, 0, 0 },
+        { 0x1B35, 6094, 1, 0, 0 },
+        { 0x1B35, 6095, 1, 0, 0 },
+        { 0x1B35, 6096, 1, 0, 0 },
+        { 0x1B35, 6097, 1, 0, 0 },
+        { 0x1B35, 6098, 1, 0, 0 },
+        { 0xAA80, 6099, 2, 0, 0 },
+        { 0xAA81, 6101, 2, 0, 0 },
+        { 0xAA82, 6103, 2, 0, 0 },
+        { 0xAA83, 6105, 2, 0, 0 },
+        { 0xAA84, 6107, 2, 0, 0 },
+        { 0xAA85, 6109, 2, 0, 0 },
+        { 0xAA86, 6111, 2, 0, 0 },
+        { 0xAA87, 6113, 2, 0, 0 },
+        { 0xAA88, 6115, 2, 0, 0 },
+        { 0xAA89, 6117, 2, 0, 0 },
+        { 0xAA8A, 6119, 2, 0, 0 },
+        { 0xAA8B, 6121, 2, 0, 0 },
+        { 0xAA8C, 6123, 2, 0, 0 },
+        { 0xAA8D, 6125, 2, 0, 0 },
+        { 0xAA8E, 6127, 2, 0, 0 },
+        { 0xAA8F, 6129, 2, 0, 0 },
+        { 0xAA90, 6131, 2, 0, 0 },
+        { 0xAA91, 6133, 2, 0, 0 },
+        { 0xAA92, 6135, 2, 0, 0 },
+        { 0xAA93, 6137, 2, 0, 0 },
+        { 0xAA94, 6139, 2, 0, 0 },
+        { 0xAA95, 6141, 2, 0, 0 },
+        { 0xAA96, 6143, 2, 0, 0 },
+        { 0xAA97, 6145, 2, 0, 0 },
+        { 0xAA98, 6147, 2, 0, 0 },
+        { 0xAA99, 6149, 2, 0, 0 },
+        { 0xAA9A, 6151, 2, 0, 0 },
+        { 0xAA9B, 6153, 2, 0, 0 },
+        { 0xAA9C, 6155, 2, 0, 0 },
+        { 0xAA9D, 6157, 2, 0, 0 },
+        { 0xAA9E, 6159, 2, 0, 0 },
+        { 0xAA9F, 6161, 2, 0, 0 },
+        { 0xAAA0, 6163, 2, 0, 0 },
+        { 0xAAA1, 6165, 2, 0, 0 },
+        { 0xAAA2, 6167, 2, 0, 0 },
+        { 0xAAA3, 6169, 2, 0, 0 },
+        { 0xAAA4, 6171, 2, 0, 0 },
+        { 0xAAA5, 6173, 2, 0, 0 },
+        { 0xAAA6, 6175, 2, 0, 0 },
+        { 0xAAA7, 6177, 2, 0, 0 },
+        { 0xAAA8, 6179, 2, 0, 0 },
+        { 0xAAA9, 6181, 2, 0, 0 },
+        { 0xAAAA, 6183, 2, 0, 0 },
+        { 0xAAAB, 6185, 2, 0, 0 },
+        { 0xAAAC, 6187, 2, 0, 0 },
+        { 0xAAAD, 6189, 2, 0, 0 },
+        { 0xAAAE, 6191, 2, 0, 0 },
+        { 0xAAAF, 6193, 2, 0, 0 },
+        { 0xAA80, 6195, 2, 0, 0 },
+        { 0xAA81, 6197, 2, 0, 0 },
+        { 0xAA82, 6199, 2, 0, 0 },
+        { 0xAA83, 6201, 2, 0, 0 },
+        { 0xAA84, 6203, 2, 0, 0 },
+        { 0xAA85, 6205, 2, 0, 0 },
+        { 0xAA86, 6207, 2, 0, 0 },
+        { 0xAA87, 6209, 2, 0, 0 },
+        { 0xAA88, 6211, 2, 0, 0 },
+        { 0xAA89, 6213, 2, 0, 0 },
+        { 0xAA8A, 6215, 2, 0, 0 },
+        { 0xAA8B, 6217, 2, 0, 0 },
+        { 0xAA8C, 6219, 2, 0, 0 },
+        { 0xAA8D, 6221, 2, 0, 0 },
+        { 0xAA8E, 6223, 2, 0, 0 },
+        { 0xAA8F, 6225, 2, 0, 0 },
+        { 0xAA90, 6227, 2, 0, 0 },
+        { 0xAA91, 6229, 2, 0, 0 },
+        { 0xAA92, 6231, 2, 0, 0 },
+        { 0xAA93, 6233, 2, 0, 0 },
+        { 0xAA94, 6235, 2, 0, 0 },
+        { 0xAA95, 6237, 2, 0, 0 },
+        { 0xAA96, 6239, 2, 0, 0 },
+        { 0xAA97, 6241, 2, 0, 0 },
+        { 0xAA98, 6243, 2, 0, 0 },
+        { 0xAA99, 6245, 2, 0, 0 },
+        { 0xAA9A, 6247, 2, 0, 0 },
+        { 0xAA9B, 6249, 2, 0, 0 },
+        { 0xAA9C, 6251, 2, 0, 0 },
+        { 0xAA9D, 6253, 2, 0, 0 },
+        { 0xAA9E, 6255, 2, 0, 0 },
+        { 0xAA9F, 6257, 2, 0, 0 },
+        { 0xAAA0, 6259, 2, 0, 0 },
+        { 0xAAA1, 6261, 2, 0, 0 },
+        { 0xAAA2, 6263, 2, 0, 0 },
+        { 0xAAA3, 6265, 2, 0, 0 },
+        { 0xAAA4, 6267, 2, 0, 0 },
+        { 0xAAA5, 6269, 2, 0, 0 },
+        { 0xAAA6, 6271, 2, 0, 0 },
+        { 0xAAA7, 6273, 2, 0, 0 },
+        { 0xAAA8, 6275, 2, 0, 0 },
+        { 0xAAA9, 6277, 2, 0, 0 },
+        { 0xAAAA, 6279, 2, 0, 0 },
+        { 0xAAAB, 6281, 2, 0, 0 },
+        { 0xAAAC, 6283, 2, 0, 0 },
+        { 0xAAAD, 6285, 2, 0, 0 },
+        { 0xAAAE, 6287, 2, 0, 0 },
+        { 0xAAAF, 6289, 2, 0, 0 },
+        { 0xAA80, 6291, 2, 0, 0 },
+        { 0xAA81, 6293, 2, 0, 0 },
+        { 0xAA82, 6295, 2, 0, 0 },
+        { 0xAA83, 6297, 2, 0, 0 },
+        { 0xAA84, 6299, 2, 0, 0 },
+        { 0xAA85, 6301, 2, 0, 0 },
+        { 0xAA86, 6303, 2, 0, 0 },
+        { 0xAA87, 6305, 2, 0, 0 },
+        { 0xAA88, 6307, 2, 0, 0 },
+        { 0xAA89, 6309, 2, 0, 0 },
+        { 0xAA8A, 6311, 2, 0, 0 },
+        { 0xAA8B, 6313, 2, 0, 0 },
+        { 0xAA8C, 6315, 2, 0, 0 },
+        { 0xAA8D, 6317, 2, 0, 0 },
+        { 0xAA8E, 6319, 2, 0, 0 },
+        { 0xAA8F, 6321, 2, 0, 0 },
+        { 0xAA90, 6323, 2, 0, 0 },
+        { 0xAA91, 6325, 2, 0, 0 },
+        { 0xAA92, 6327, 2, 0, 0 },
+        { 0xAA93, 6329, 2, 0, 0 },
+        { 0xAA94, 6331, 2, 0, 0 },
+        { 0xAA95, 6333, 2, 0, 0 },
+        { 0xAA96, 6335, 2, 0, 0 },
+        { 0xAA97, 6337, 2, 0, 0 },
+        { 0xAA98, 6339, 2, 0, 0 },
+        { 0xAA99, 6341, 2, 0, 0 },
+        { 0xAA9A, 6343, 2, 0, 0 },
+        { 0xAA9B, 6345, 2, 0, 0 },
+        { 0xAA9C, 6347, 2, 0, 0 },
+        { 0xAA9D, 6349, 2, 0, 0 },
+        { 0xAA9E, 6351, 2, 0, 0 },
+        { 0xAA9F, 6353, 2, 0, 0 },
+        { 0xAAA0, 6355, 2, 0, 0 },
+        { 0xAAA1, 6357, 2, 0, 0 },
+        { 0xAAA2, 6359, 2, 0, 0 },
+        { 0xAAA3, 6361, 2, 0, 0 },
+        { 0xAAA4, 6363, 2, 0, 0 },
+        { 0xAAA5, 6365, 2, 0, 0 },
+        { 0xAAA6, 6367, 2, 0, 0 },
+        { 0xAAA7, 6369, 2, 0, 0 },
+        { 0xAAA8, 6371, 2, 0, 0 },
+        { 0xAAA9, 6373, 2, 0, 0 },
+        { 0xAAAA, 6375, 2, 0, 0 },
+        { 0xAAAB, 6377, 2, 0, 0 },
+        { 0xAAAC, 6379, 2, 0, 0 },
+        { 0xAAAD, 6381, 2, 0, 0 },
+        { 0xAAAE, 6383, 2, 0, 0 },
+        { 0xAAAF, 6385, 2, 0, 0 },
+        { 0xAA80, 6387, 2, 0, 0 },
+        { 0xAA81, 6389, 2, 0, 0 },
+        { 0xAA82, 6391, 2, 0, 0 },
+        { 0xAA83, 6393, 2, 0, 0 },
+        { 0xAA84, 6395, 2, 0, 0 },
+        { 0xAA85, 6397, 2, 0, 0 },
+        { 0xAA86, 6399, 2, 0, 0 },
+        { 0xAA87, 6401, 2, 0, 0 },
+        { 0xAA88, 6403, 2, 0, 0 },
+        { 0xAA89, 6405, 2, 0, 0 },
+        { 0xAA8A, 6407, 2, 0, 0 },
+        { 0xAA8B, 6409, 2, 0, 0 },
+        { 0xAA8C, 6411, 2, 0, 0 },
+        { 0xAA8D, 6413, 2, 0, 0 },
+        { 0xAA8E, 6415, 2, 0, 0 },
+        { 0xAA8F, 6417, 2, 0, 0 },
+        { 0xAA90, 6419, 2, 0, 0 },
+        { 0xAA91, 6421, 2, 0, 0 },
+        { 0xAA92, 6423, 2, 0, 0 },
+        { 0xAA93, 6425, 2, 0, 0 },
+        { 0xAA94, 6427, 2, 0, 0 },
+        { 0xAA95, 6429, 2, 0, 0 },
+        { 0xAA96, 6431, 2, 0, 0 },
+        { 0xAA97, 6433, 2, 0, 0 },
+        { 0xAA98, 6435, 2, 0, 0 },
+        { 0xAA99, 6437, 2, 0, 0 },
+        { 0xAA9A, 6439, 2, 0, 0 },
+        { 0xAA9B, 6441, 2, 0, 0 },
+        { 0xAA9C, 6443, 2, 0, 0 },
+        { 0xAA9D, 6445, 2, 0, 0 },
+        { 0xAA9E, 6447, 2, 0, 0 },
+        { 0xAA9F, 6449, 2, 0, 0 },
+        { 0xAAA0, 6451, 2, 0, 0 },
+        { 0xAAA1, 6453, 2, 0, 0 },
+        { 0xAAA2, 6455, 2, 0, 0 },
+        { 0xAAA3, 6457, 2, 0, 0 },
+        { 0xAAA4, 6459, 2, 0, 0 },
+        { 0xAAA5, 6461, 2, 0, 0 },
+        { 0xAAA6, 6463, 2, 0, 0 },
+        { 0xAAA7, 6465, 2, 0, 0 },
+        { 0xAAA8, 6467, 2, 0, 0 },
+        { 0xAAA9, 6469, 2, 0, 0 },
+        { 0xAAAA, 6471, 2, 0, 0 },
+        { 0xAAAB, 6473, 2, 0, 0 },
+        { 0xAAAC, 6475, 2, 0, 0 },
+        { 0xAAAD, 6477, 2, 0, 0 },
+        { 0xAAAE, 6479, 2, 0, 0 },
+        { 0xAAAF, 6481, 2, 0, 0 },
+        { 0xAA80, 6483, 2, 0, 0 },
+        { 0xAA81, 6485, 2, 0, 0 },
+        { 0xAA82, 6487, 2, 0, 0 },
+        { 0xAA83, 6489, 2, 0, 0 },
+        { 0xAA84, 6491, 2, 0, 0 },
+        { 0xAA85, 6493, 2, 0, 0 },
+        { 0xAA86, 6495, 2, 0, 0 },
+        { 0xAA87, 6497, 2, 0, 0 },
+        { 0xAA88, 6499, 2, 0, 0 },
+        { 0xAA89, 6501, 2, 0, 0 },
+        { 0xAA8A, 6503, 2, 0, 0 },
+        { 0xAA8B, 6505, 2, 0, 0 },
+        { 0xAA8C, 6507, 2, 0, 0 },
+        { 0xAA8D, 6509, 2, 0, 0 },
+        { 0xAA8E, 6511, 2, 0, 0 },
+        { 0xAA8F, 6513, 2, 0, 0 },
+        { 0xAA90, 6515, 2, 0, 0 },
+        { 0xAA91, 6517, 2, 0, 0 },
+        { 0xAA92, 6519, 2, 0, 0 },
+        { 0xAA93, 6521, 2, 0, 0 },
+        { 0xAA94, 6523, 2, 0, 0 },
+        { 0xAA95, 6525, 2, 0, 0 },
+        { 0xAA96, 6527, 2, 0, 0 },
+        { 0xAA97, 6529, 2, 0, 0 },
+        { 0xAA98, 6531, 2, 0, 0 },
+        { 0xAA99, 6533, 2, 0, 0 },
+        { 0xAA9A, 6535, 2, 0, 0 },
+        { 0xAA9B, 6537, 2, 0, 0 },
+        { 0xAA9C, 6539, 2, 0, 0 },
+        { 0xAA9D, 6541, 2, 0, 0 },
+        { 0xAA9E, 6543, 2, 0, 0 },
+        { 0xAA9F, 6545, 2, 0, 0 },
+        { 0xAAA0, 6547, 2, 0, 0 },
+        { 0xAAA1, 6549, 2, 0, 0 },
+        { 0xAAA2, 6551, 2, 0, 0 },
+        { 0xAAA3, 6553, 2, 0, 0 },
+        { 0xAAA4, 6555, 2, 0, 0 },
+        { 0xAAA5, 6557, 2, 0, 0 },
+        { 0xAAA6, 6559, 2, 0, 0 },
+        { 0xAAA7, 6561, 2, 0, 0 },
+        { 0xAAA8, 6563, 2, 0, 0 },
+        { 0xAAA9, 6565, 2, 0, 0 },
+        { 0xAAAA, 6567, 2, 0, 0 },
+        { 0xAAAB, 6569, 2, 0, 0 },
+        { 0xAAAC, 6571, 2, 0, 0 },
+        { 0xAAAD, 6573, 2, 0, 0 },
+        { 0xAAAE, 6575, 2, 0, 0 },
+        { 0xAAAF, 6577, 2, 0, 0 },
+        { 0x11127, 6579, 1, 0, 0 },
+        { 0x11127, 6580, 1, 0, 0 },
+        { 0x1133E, 6581, 1, 0, 0 },
+        { 0x11357, 6582, 1, 0, 0 },
+        { 0x114B0, 6583, 1, 0, 0 },
+        { 0x114BA, 6584, 1, 0, 0 },
+        { 0x114BD, 6585, 1, 0, 0 },
+        { 0x115AF, 6586, 1, 0, 0 },
+        { 0x115AF, 6587, 1, 0, 0 },
+        { 0x11930, 6588, 1, 0, 0 },
+        { 0x0CD5, 6589, 1, 0, 0 },
+        { 0x0DCA, 6590, 1, 0, 0 },
+        { 0x0F80, 6591, 1, 0, 0 },
+        { 0x0F80, 6592, 1, 0, 0 },
+    };
+    static constexpr implicit_range implicit_ranges[19] = {
+        { 0x3400, 0x4DBF, 0x0000, 0xFB80 },
+        { 0x4E00, 0x9FFC, 0x0000, 0xFB40 },
+        { 0xFA0E, 0xFA0F, 0x0000, 0xFB40 },
+        { 0xFA11, 0xFA11, 0x0000, 0xFB40 },
+        { 0xFA13, 0xFA14, 0x0000, 0xFB40 },
+        { 0xFA1F, 0xFA1F, 0x0000, 0xFB40 },
+        { 0xFA21, 0xFA21, 0x0000, 0xFB40 },
+        { 0xFA23, 0xFA24, 0x0000, 0xFB40 },
+        { 0xFA27, 0xFA29, 0x0000, 0xFB40 },
+        { 0x17000, 0x18AFF, 0x17000, 0xFB00 },
+        { 0x18B00, 0x18CFF, 0x18B00, 0xFB02 },
+        { 0x18D00, 0x18D8F, 0x18D00, 0xFB00 },
+        { 0x1B170, 0x1B2FF, 0x1B170, 0xFB01 },
+        { 0x20000, 0x2A6DD, 0x0000, 0xFB80 },
+        { 0x2A700, 0x2B734, 0x0000, 0xFB80 },
+        { 0x2B740, 0x2B81D, 0x0000, 0xFB80 },
+        { 0x2B820, 0x2CEA1, 0x0000, 0xFB80 },
+        { 0x2CEB0, 0x2EBE0, 0x0000, 0xFB80 },
+        { 0x30000, 0x3134A, 0x0000, 0xFB80 },
+    };
+    static constexpr int block_bits = 4;
+    static constexpr int index_block_bits = 6;
+    static constexpr unsigned char index[0x110000 >> 10] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13,
+        13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 15, 16, 17, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 18, 13, 13, 13, 13, 13, 13, 13, 13, 19, 20,
+        21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 13, 13, 31, 32, 13, 13,
+        13, 33, 13, 13, 13, 13, 13, 13, 13, 13, 34, 35, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 36, 13, 13, 37,
+        13, 13, 13, 13, 38, 39, 40, 13, 41, 13, 42, 43, 44, 45, 46, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        47, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    };
+    static constexpr unsigned short index_blocks[48][64] = {
+        {
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 1, 9, 10, 11, 12, 13, 14,
+            15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+            15, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+            46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
+        },
+        {
+            62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+            78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 1, 88, 89, 90, 91, 92,
+            93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+            109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
+        },
+        {
+            125, 126, 127, 128, 129, 130, 131, 15, 15, 15, 132, 133, 134, 135, 136, 137,
+            138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153,
+            154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169,
+            170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 160, 184,
+        },
+        {
+            185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200,
+            201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 160, 215,
+            216, 217, 218, 219, 220, 221, 15, 15, 222, 223, 224, 225, 226, 227, 15, 15,
+            228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 15, 15,
+        },
+        {
+            242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+            258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+            274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+            290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+        },
+        {
+            306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+            322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+            338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353,
+            354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 368,
+        },
+        {
+            369, 368, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+            384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+            400, 401, 402, 403, 404, 405, 406, 407, 368, 368, 408, 409, 410, 15, 15, 15,
+            411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426,
+        },
+        {
+            427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 1, 440, 441,
+            442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 458, 15, 15, 15, 15, 15, 459,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 460, 461, 15, 15, 462,
+        },
+        {
+            463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 15, 475, 476, 477,
+            478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493,
+            494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
+            510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525,
+        },
+        {
+            526, 527, 528, 15, 529, 15, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
+            540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555,
+            556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571,
+            572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587,
+        },
+        {
+            588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603,
+            604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619,
+            620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635,
+            636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651,
+        },
+        {
+            652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667,
+            668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683,
+            684, 685, 686, 687, 688, 689, 15, 15, 690, 691, 692, 693, 694, 695, 696, 697,
+            698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 15, 712,
+        },
+        {
+            713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728,
+            729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744,
+            745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760,
+            761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776,
+        },
+        {
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 777, 778, 779, 780,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796,
+            797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812,
+            813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828,
+            829, 830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844,
+        },
+        {
+            845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860,
+            861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876,
+            877, 878, 879, 15, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891,
+            892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 15, 15, 905,
+        },
+        {
+            906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 368, 1, 919,
+            920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935,
+            936, 937, 938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951,
+            952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 368,
+        },
+        {
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 967, 968, 969, 970, 971,
+        },
+        {
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            972, 973, 974, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            975, 976, 977, 15, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989,
+        },
+        {
+            990, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005,
+            1006, 1007, 1008, 1009, 15, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 15, 15, 1018,
+            1, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033,
+            1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049,
+        },
+        {
+            1050, 1051, 1052, 1053, 1054, 1055, 15, 15, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063,
+            1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 15, 15, 1075, 1076, 1077,
+            15, 15, 15, 15, 15, 15, 15, 15, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085,
+            1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 15, 15,
+        },
+        {
+            1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 368, 1110, 1111, 1112, 1113, 1114,
+            1115, 1116, 1117, 1118, 1119, 1120, 1121, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137,
+            1138, 1139, 1140, 1141, 1142, 1143, 1144, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 15, 15, 15, 1156, 1157,
+            1158, 1159, 1160, 1161, 15, 15, 15, 15, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169,
+            1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 15, 15, 1180, 1181, 1182, 1183,
+            1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 15, 15, 15, 15, 15,
+        },
+        {
+            1195, 1196, 1197, 1198, 1199, 15, 15, 15, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207,
+            1208, 1209, 1210, 368, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 1211, 1212, 1213, 1214, 1215, 1216, 15, 15, 15, 15,
+            1217, 1218, 1219, 1220, 1221, 1222, 15, 15, 15, 15, 15, 1223, 1224, 15, 1225, 1226,
+        },
+        {
+            1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 368,
+            1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257,
+            1258, 1259, 1260, 1261, 15, 15, 15, 15, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 368,
+            1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1277, 1278, 1279, 1280, 1281, 1282, 1283, 15, 1284, 1285, 1286, 1287, 1288, 368, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 1289, 1290, 1291, 1292, 1293, 1294, 15, 15,
+            1295, 1296, 1297, 1298, 1299, 368, 1300, 15, 1301, 1302, 1303, 1304, 368, 15, 15, 15,
+            1305, 1306, 1307, 1308, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1309, 1310, 1311, 1312, 15, 15, 15, 15, 15, 15, 1313, 1314, 1315, 1316, 1317, 1318,
+            1319, 1320, 1321, 1322, 1323, 368, 15, 15, 15, 15, 1324, 1325, 1326, 1327, 1328, 15,
+            1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 15, 1340, 1341, 1342, 1343,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 15, 15, 15, 15,
+            1356, 1357, 1358, 1359, 1360, 368, 1361, 1362, 1363, 1364, 368, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 1365, 1366,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 1367, 1368, 1369, 1370, 1371,
+        },
+        {
+            1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387,
+            1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403,
+            1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
+            1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445,
+            1446, 1447, 1448, 1449, 1450, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466,
+            1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482,
+            1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498,
+            1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514,
+        },
+        {
+            1515, 1516, 1517, 1518, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534,
+            1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550,
+            1551, 1552, 1553, 1554, 1555, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571,
+            1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587,
+            1588, 1589, 1590, 1591, 1592, 1593, 1594, 15, 15, 15, 15, 15, 15, 1595, 1596, 1597,
+            1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 1607, 1608, 1609, 1610, 1611, 1612, 15, 15, 15, 15, 15, 15,
+            1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 15, 15, 15, 15, 1623, 1624,
+        },
+        {
+            1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640,
+            1641, 1642, 15, 15, 15, 1643, 1644, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671,
+            1672, 1673, 1674, 1675, 1676, 1677, 1678, 1, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 15,
+            1686, 1687, 1688, 1689, 1690, 15, 15, 15, 15, 15, 15, 15, 15, 15, 1691, 1692,
+            1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1701, 1702, 1703,
+            1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1701, 1702, 1703, 1704, 1705, 1716,
+            1707, 1708, 1709, 1720, 1721, 1722, 1723, 1701, 1702, 1703, 1724, 1725, 1726, 1727, 1728, 1729,
+            1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745,
+        },
+        {
+            1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761,
+            1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777,
+            1, 1, 1, 1778, 1, 1, 1779, 1780, 1781, 1782, 87, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1783, 1784, 1785, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            1786, 1787, 1788, 1789, 1790, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 1791, 1792, 1793, 1794,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 15, 15,
+            1809, 1810, 1811, 1812, 1813, 1814, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            15, 15, 15, 15, 15, 15, 15, 1815, 1816, 1817, 1818, 1819, 15, 15, 15, 15,
+            1820, 1821, 1822, 1823, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1833, 15, 15, 15, 1835,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+        {
+            1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851,
+            1852, 1853, 1854, 1855, 1856, 1857, 1858, 1855, 1859, 1860, 1861, 15, 15, 15, 1862, 1863,
+            1864, 1865, 1866, 1867, 1868, 1869, 1870, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886,
+        },
+        {
+            1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902,
+            1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918,
+            1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934,
+            1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 15,
+        },
+        {
+            1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 15, 15, 15, 15,
+            1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977,
+            1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 15, 15,
+            1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 15, 15, 2005,
+        },
+        {
+            2006, 15, 1, 1, 1, 1, 1, 1, 15, 15, 15, 15, 15, 15, 15, 15,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        },
+    };
+    static constexpr unsigned blocks[2007][16] = {
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x02011009, 0x02021009, 0x02031009,
+            0x02041009, 0x02051009, 0x00000001, 0x00000001,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        },
+        {
+            0x02091009, 0x02671009, 0x031D1009, 0x03AC1009, 0x1F641009, 0x03AD1009,
+            0x03A91009, 0x03161009, 0x03281009, 0x03291009, 0x03A11009, 0x06661009,
+            0x02231009, 0x020D1009, 0x027E1009, 0x03A61009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x02401009, 0x023A1009,
+            0x066A1009, 0x066B1009, 0x066C1009, 0x026D1009,
+        },
+        {
+            0x03A01009, 0x1FA21021, 0x1FBC1021, 0x1FD61021, 0x1FEB1021, 0x20071021,
+            0x20421021, 0x20511021, 0x20751021, 0x20901021, 0x20AB1021, 0x20C41021,
+            0x00000003, 0x21091021, 0x21181021, 0x213C1021,
+        },
+        {
+            0x216B1021, 0x21801021, 0x21931021, 0x21D21021, 0x21F71021, 0x22171021,
+            0x22471021, 0x22591021, 0x22641021, 0x22701021, 0x22861021, 0x032A1009,
+            0x03A71009, 0x032B1009, 0x04B71009, 0x020B1009,
+        },
+        {
+            0x04B41009, 0x1FA21009, 0x1FBC1009, 0x1FD61009, 0x1FEB1009, 0x20071009,
+            0x20421009, 0x20511009, 0x20751009, 0x20901009, 0x20AB1009, 0x20C41009,
+            0x00000007, 0x21091009, 0x21181009, 0x213C1009,
+        },
+        {
+            0x216B1009, 0x21801009, 0x21931009, 0x21D21009, 0x21F71009, 0x22171009,
+            0x22471009, 0x22591009, 0x22641009, 0x22701009, 0x22861009, 0x032C1009,
+            0x066E1009, 0x032D1009, 0x06701009, 0x00000001,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x02061009,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        },
+        {
+            0x0209106D, 0x02681009, 0x1F631009, 0x1F651009, 0x1F621009, 0x1F661009,
+            0x066F1009, 0x039A1009, 0x04BB1009, 0x05D21009, 0x1FA21051, 0x03261009,
+            0x066D1009, 0x00000001, 0x05D41009, 0x04B81009,
+        },
+        {
+            0x052A1009, 0x06671009, 0x1F9A1051, 0x1F9B1051, 0x04B51009, 0x23301011,
+            0x039C1009, 0x02931009, 0x04BE1009, 0x1F991051, 0x213C1051, 0x03271009,
+            0x0000000E, 0x00000C0E, 0x0000180E, 0x026E1009,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x0000240E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x0000300A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x06691009, 0x0000380A, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x22B51021, 0x0000400E,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00004C0E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x0000580A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x06681009, 0x0000600A, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x22B51009, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x0000680A, 0x0000700A, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x0000780A, 0x0000800A, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x20941009, 0x0000880A, 0x0000900A, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x218F1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x0000980A,
+        },
+        {
+            0x0000A00A, 0x0000A80A, 0x0000B00A, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x0000B80A, 0x21371021, 0x21371009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x0000C00E, 0x0000CC0E, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x21FC1021, 0x21FC1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x0000D80A,
+        },
+        {
+            0x1FC41009, 0x1FCD1021, 0x1FD11021, 0x1FD11009, 0x22D61021, 0x22D61009,
+            0x214F1021, 0x1FE11021, 0x1FE11009, 0x1FF41021, 0x1FF81021, 0x1FFD1021,
+            0x1FFD1009, 0x0000E00A, 0x20151021, 0x201A1021,
+        },
+        {
+            0x201F1021, 0x204B1021, 0x204B1009, 0x20631021, 0x206D1021, 0x207D1009,
+            0x20A61021, 0x209F1021, 0x20CA1021, 0x20CA1009, 0x20E11009, 0x21011009,
+            0x22381021, 0x21231021, 0x21271009, 0x215C1021,
+        },
+        {
+            0x00000000, 0x00000000, 0x20711021, 0x20711009, 0x21741021, 0x21741009,
+            0x21981021, 0x22CE1021, 0x22CE1009, 0x21E41021, 0x21EA1009, 0x22021009,
+            0x22061021, 0x22061009, 0x220A1021, 0x00000000,
+        },
+        {
+            0x00000000, 0x22421021, 0x224E1021, 0x227C1021, 0x227C1009, 0x228B1021,
+            0x228B1009, 0x22A31021, 0x22A81021, 0x22A81009, 0x22AD1009, 0x22C71009,
+            0x22D21021, 0x22D21009, 0x0000E80A, 0x22BB1009,
+        },
+        {
+            0x22FE1009, 0x23021009, 0x23061009, 0x230A1009, 0x0000F00E, 0x0000FC0E,
+            0x0001080E, 0x0001140A, 0x00011C0A, 0x0001240A, 0x00012C0A, 0x0001340A,
+            0x00013C0A, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x20151009, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x205E1021, 0x205E1009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x0001440A, 0x00014C0A, 0x0001540A, 0x00000000, 0x00000000,
+            0x207D1021, 0x22BB1021, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x22821021, 0x22821009, 0x00000000, 0x00000000,
+        },
+        {
+            0x21271021, 0x20011009, 0x21661021, 0x21661009, 0x22911021, 0x22911009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20F71009, 0x21311009,
+            0x220E1009, 0x20AF1009, 0x00015C0A, 0x0001640A, 0x1FA71021, 0x1FDB1021,
+            0x1FDB1009, 0x20E11021, 0x22001021, 0x21DE1009,
+        },
+        {
+            0x229D1009, 0x22DE1021, 0x22DE1009, 0x1FC41021, 0x22221021, 0x22551021,
+            0x200E1021, 0x200E1009, 0x20B41021, 0x20B41009, 0x218B1021, 0x218B1009,
+            0x219F1021, 0x219F1009, 0x22781021, 0x22781009,
+        },
+        {
+            0x1FAD1009, 0x1FB11009, 0x1FB71009, 0x1FCD1009, 0x214F1009, 0x1FE51009,
+            0x1FF41009, 0x1FF81009, 0x20241009, 0x201A1009, 0x20281009, 0x201F1009,
+            0x202C1009, 0x20321009, 0x20361009, 0x20BC1009,
+        },
+        {
+            0x20631009, 0x20551009, 0x205A1009, 0x206D1009, 0x203E1009, 0x222C1009,
+            0x20821009, 0x208A1009, 0x209F1009, 0x20A61009, 0x20981009, 0x20E61009,
+            0x20EC1009, 0x20F21009, 0x20FC1009, 0x22381009,
+        },
+        {
+            0x223E1009, 0x21101009, 0x21231009, 0x212D1009, 0x211C1009, 0x215C1009,
+            0x21431009, 0x21611009, 0x217B1009, 0x21A41009, 0x21A91009, 0x21AE1009,
+            0x21B31009, 0x21B71009, 0x21BC1009, 0x21C11009,
+        },
+        {
+            0x21981009, 0x21CA1009, 0x21DA1009, 0x21E41009, 0x20C01009, 0x21EE1009,
+            0x21F31009, 0x22131009, 0x220A1009, 0x22221009, 0x22421009, 0x224E1009,
+            0x22551009, 0x22601009, 0x21051009, 0x22741009,
+        },
+        {
+            0x22951009, 0x22991009, 0x22A31009, 0x22B11009, 0x22DA1009, 0x22E91009,
+            0x22FA1009, 0x230E1009, 0x23121009, 0x1FC01009, 0x203A1009, 0x20671009,
+            0x20791009, 0x20B81009, 0x20D21009, 0x20DA1009,
+        },
+        {
+            0x21871009, 0x22F21009, 0x22F61009, 0x0001540A, 0x00016C0A, 0x0001740A,
+            0x0000E80A, 0x00017C0A, 0x0001840A, 0x00018C0A, 0x0001940A, 0x00019C0A,
+            0x23161009, 0x231A1009, 0x22301009, 0x22341009,
+        },
+        {
+            0x20751051, 0x20821051, 0x20AB1051, 0x21931051, 0x21A41051, 0x21AE1051,
+            0x21CA1051, 0x22591051, 0x22701051, 0x04C51009, 0x04C71009, 0x208E1009,
+            0x22E31009, 0x208F1009, 0x22E51009, 0x22ED1009,
+        },
+        {
+            0x22E21009, 0x22EE1009, 0x04C81009, 0x04C91009, 0x04CA1009, 0x04CB1009,
+            0x04CC1009, 0x04CD1009, 0x04CE1009, 0x04CF1009, 0x04D01009, 0x04D11009,
+            0x04D21009, 0x04D31009, 0x04D41009, 0x04D51009,
+        },
+        {
+            0x1F461009, 0x1F471009, 0x04D61009, 0x04D71009, 0x04D81009, 0x04D91009,
+            0x04DC1009, 0x04DD1009, 0x04B91009, 0x04BA1009, 0x04BC1009, 0x04BF1009,
+            0x04B61009, 0x04BD1009, 0x04DE1009, 0x04DF1009,
+        },
+        {
+            0x206D1051, 0x20D61051, 0x21D21051, 0x22641051, 0x22E91051, 0x04E01009,
+            0x04E11009, 0x04E21009, 0x04E31009, 0x04E41009, 0x04E51009, 0x04E61009,
+            0x04E71009, 0x04E81009, 0x22E41009, 0x04E91009,
+        },
+        {
+            0x04EA1009, 0x04EB1009, 0x04EC1009, 0x04ED1009, 0x04EE1009, 0x04EF1009,
+            0x04F01009, 0x04F11009, 0x04F21009, 0x04F31009, 0x04F41009, 0x04F51009,
+            0x04F61009, 0x04F71009, 0x04F81009, 0x04F91009,
+        },
+        {
+            0x00001289, 0x00001209, 0x00001389, 0x00001689, 0x00001909, 0x00001D09,
+            0x00001309, 0x00001709, 0x00001589, 0x00001D89, 0x00001489, 0x00001609,
+            0x00001409, 0x00001989, 0x00001989, 0x00001E09,
+        },
+        {
+            0x00001E89, 0x00001F09, 0x00001989, 0x00001109, 0x00001189, 0x00001989,
+            0x00001A09, 0x00001A09, 0x00001A09, 0x00001A09, 0x00001989, 0x00001F89,
+            0x00001A09, 0x00001A09, 0x00001A09, 0x00001A09,
+        },
+        {
+            0x00001A09, 0x00002009, 0x00002089, 0x00002109, 0x00002189, 0x00002209,
+            0x00002289, 0x00001809, 0x00001889, 0x00001A09, 0x00001A09, 0x00001A09,
+            0x00001A09, 0x00002309, 0x00002389, 0x00001A09,
+        },
+        {
+            0x00002409, 0x00002489, 0x00001089, 0x00001A09, 0x00002509, 0x00001C89,
+            0x00001A89, 0x00001A89, 0x00001789, 0x00002589, 0x00001A09, 0x00001A09,
+            0x00001A09, 0x00001989, 0x00001989, 0x00001989,
+        },
+        {
+            0x00000000, 0x00000000, 0x00001509, 0x00000000, 0x00000000, 0x00002609,
+            0x00001989, 0x00001A09, 0x00001A09, 0x00001A09, 0x00001989, 0x00001989,
+            0x00001989, 0x00001A09, 0x00001A09, 0x00000001,
+        },
+        {
+            0x00001989, 0x00001989, 0x00001989, 0x00001A09, 0x00001A09, 0x00001A09,
+            0x00001A09, 0x00001989, 0x00002689, 0x00001A09, 0x00001A09, 0x00001989,
+            0x00001A09, 0x00001989, 0x00001989, 0x00001A09,
+        },
+        {
+            0x00002709, 0x00002789, 0x00001A09, 0x1FA21011, 0x20071011, 0x20901011,
+            0x213C1011, 0x22171011, 0x1FD61011, 0x1FEB1011, 0x20751011, 0x21091011,
+            0x21931011, 0x21F71011, 0x22471011, 0x22641011,
+        },
+        {
+            0x23281021, 0x23281009, 0x23491021, 0x23491009, 0x00000000, 0x04C61009,
+            0x23251021, 0x23251009, 0x00000000, 0x00000000, 0x232B1011, 0x233E1009,
+            0x233D1009, 0x233F1009, 0x00000000, 0x232C1021,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04B51009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x231E1021, 0x231F1021, 0x23201021, 0x23221021, 0x23231021,
+            0x23271021, 0x23291021, 0x232A1021, 0x232B1021, 0x232D1021, 0x232E1021,
+            0x23301021, 0x23311021, 0x23321021, 0x23331021,
+        },
+        {
+            0x23341021, 0x23391021, 0x00000000, 0x233C1021, 0x23401021, 0x23411021,
+            0x23421021, 0x23431021, 0x23441021, 0x23461021, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x231E1009, 0x231F1009, 0x23201009, 0x23221009, 0x23231009,
+            0x23271009, 0x23291009, 0x232A1009, 0x232B1009, 0x232D1009, 0x232E1009,
+            0x23301009, 0x23311009, 0x23321009, 0x23331009,
+        },
+        {
+            0x23341009, 0x23391009, 0x233C1065, 0x233C1009, 0x23401009, 0x23411009,
+            0x23421009, 0x23431009, 0x23441009, 0x23461009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x0001A40E,
+        },
+        {
+            0x231F1011, 0x232A1011, 0x23411029, 0x00000000, 0x00000000, 0x23421011,
+            0x23341011, 0x0001B00E, 0x23381021, 0x23381009, 0x23261021, 0x23261009,
+            0x23241021, 0x23241009, 0x23371021, 0x23371009,
+        },
+        {
+            0x23481021, 0x23481009, 0x236A1021, 0x236A1009, 0x236F1021, 0x236F1009,
+            0x23701021, 0x23701009, 0x23731021, 0x23731009, 0x237A1021, 0x237A1009,
+            0x237D1021, 0x237D1009, 0x23811021, 0x23811009,
+        },
+        {
+            0x232D1011, 0x23391011, 0x233C1011, 0x232C1009, 0x232A1029, 0x23231011,
+            0x06611009, 0x234A1021, 0x234A1009, 0x233C1029, 0x23361021, 0x23361009,
+            0x233B1009, 0x233E1021, 0x233D1021, 0x233F1021,
+        },
+        {
+            0x00000000, 0x00000000, 0x23B51021, 0x00000000, 0x23C31021, 0x23D91021,
+            0x23ED1021, 0x00000000, 0x23F61021, 0x24211021, 0x24471021, 0x247E1021,
+            0x00000000, 0x00000000, 0x00000000, 0x24E41021,
+        },
+        {
+            0x23871021, 0x23931021, 0x23971021, 0x239B1021, 0x23AF1021, 0x23BF1021,
+            0x23C71021, 0x23D11021, 0x0000000B, 0x00000000, 0x23FB1021, 0x24151021,
+            0x24281021, 0x24311021, 0x244C1021, 0x24541021,
+        },
+        {
+            0x24611021, 0x246A1021, 0x24731021, 0x24821021, 0x24931021, 0x24971021,
+            0x24BE1021, 0x24C91021, 0x24E81021, 0x24ED1021, 0x24F41021, 0x24F91021,
+            0x24FD1021, 0x250A1021, 0x250E1021, 0x25141021,
+        },
+        {
+            0x23871009, 0x23931009, 0x23971009, 0x239B1009, 0x23AF1009, 0x23BF1009,
+            0x23C71009, 0x23D11009, 0x0000000F, 0x00000000, 0x23FB1009, 0x24151009,
+            0x24281009, 0x24311009, 0x244C1009, 0x24541009,
+        },
+        {
+            0x24611009, 0x246A1009, 0x24731009, 0x24821009, 0x24931009, 0x24971009,
+            0x24BE1009, 0x24C91009, 0x24E81009, 0x24ED1009, 0x24F41009, 0x24F91009,
+            0x24FD1009, 0x250A1009, 0x250E1009, 0x25141009,
+        },
+        {
+            0x00000000, 0x00000000, 0x23B51009, 0x00000000, 0x23C31009, 0x23D91009,
+            0x23ED1009, 0x00000000, 0x23F61009, 0x24211009, 0x24471009, 0x247E1009,
+            0x00000000, 0x00000000, 0x00000000, 0x24E41009,
+        },
+        {
+            0x24AD1021, 0x24AD1009, 0x25051021, 0x25051009, 0x25191021, 0x25191009,
+            0x251D1021, 0x251D1009, 0x25271021, 0x25271009, 0x25221021, 0x25221009,
+            0x252C1021, 0x252C1009, 0x25301021, 0x25301009,
+        },
+        {
+            0x25341021, 0x25341009, 0x25381021, 0x25381009, 0x253C1021, 0x253C1009,
+            0x00000000, 0x00000000, 0x248F1021, 0x248F1009, 0x24BA1021, 0x24BA1009,
+            0x24B61021, 0x24B61009, 0x24B11021, 0x24B11009,
+        },
+        {
+            0x245D1021, 0x245D1009, 0x052B1009, 0x00002809, 0x00001989, 0x00001189,
+            0x00001109, 0x00001989, 0x00000001, 0x00000001, 0x23E91021, 0x23E91009,
+            0x25011021, 0x25011009, 0x24651021, 0x24651009,
+        },
+        {
+            0x0001BC0A, 0x0001C40A, 0x239F1021, 0x239F1009, 0x23A71021, 0x23A71009,
+            0x23CD1021, 0x23CD1009, 0x23BB1021, 0x23BB1009, 0x23FF1021, 0x23FF1009,
+            0x240F1021, 0x240F1009, 0x240B1021, 0x240B1009,
+        },
+        {
+            0x24071021, 0x24071009, 0x243A1021, 0x243A1009, 0x24431021, 0x24431009,
+            0x24591021, 0x24591009, 0x25411021, 0x25411009, 0x246F1021, 0x246F1009,
+            0x24791021, 0x24791009, 0x24861021, 0x24861009,
+        },
+        {
+            0x248A1021, 0x248A1009, 0x24A31021, 0x24A31009, 0x24C41021, 0x24C41009,
+            0x24CF1021, 0x24CF1009, 0x24D71021, 0x24D71009, 0x24A71021, 0x24A71009,
+            0x24DC1021, 0x24DC1009, 0x24E01021, 0x24E01009,
+        },
+        {
+            0x25461021, 0x00000000, 0x00000000, 0x24031021, 0x24031009, 0x241A1021,
+            0x241A1009, 0x243E1021, 0x243E1009, 0x24361021, 0x24361009, 0x24D31021,
+            0x24D31009, 0x242C1021, 0x242C1009, 0x25461009,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x238F1021, 0x238F1009,
+            0x00000000, 0x00000000, 0x238B1021, 0x238B1009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x23DE1021, 0x23DE1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x24501021, 0x24501009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x23AB1021, 0x23AB1009, 0x00000000, 0x00000000, 0x23A31021, 0x23A31009,
+            0x249B1021, 0x249B1009, 0x249F1021, 0x249F1009,
+        },
+        {
+            0x23B31021, 0x23B31009, 0x23BA1021, 0x23BA1009, 0x23D61021, 0x23D61009,
+            0x23E31021, 0x23E31009, 0x24261021, 0x24261009, 0x244B1021, 0x244B1009,
+            0x246E1021, 0x246E1009, 0x24781021, 0x24781009,
+        },
+        {
+            0x23D71021, 0x23D71009, 0x241F1021, 0x241F1009, 0x24271021, 0x24271009,
+            0x24691021, 0x24691009, 0x25181021, 0x25181009, 0x24141021, 0x24141009,
+            0x25451021, 0x25451009, 0x24131021, 0x24131009,
+        },
+        {
+            0x24201021, 0x24201009, 0x24421021, 0x24421009, 0x24581021, 0x24581009,
+            0x24AB1021, 0x24AB1009, 0x24351021, 0x24351009, 0x23CB1021, 0x23CB1009,
+            0x24CD1021, 0x24CD1009, 0x241E1021, 0x241E1009,
+        },
+        {
+            0x00000000, 0x25F51021, 0x25F71021, 0x25F81021, 0x25F91021, 0x25FA1021,
+            0x25FB1021, 0x25FC1021, 0x25FD1021, 0x25FE1021, 0x25FF1021, 0x26001021,
+            0x26011021, 0x26021021, 0x26031021, 0x26041021,
+        },
+        {
+            0x26051021, 0x26061021, 0x26071021, 0x26081021, 0x26091021, 0x260A1021,
+            0x260C1021, 0x260D1021, 0x260E1021, 0x260F1021, 0x26101021, 0x26111021,
+            0x26121021, 0x26131021, 0x26141021, 0x26151021,
+        },
+        {
+            0x26161021, 0x26171021, 0x26181021, 0x26191021, 0x261A1021, 0x261B1021,
+            0x261C1021, 0x00000000, 0x00000000, 0x261D1009, 0x03E41009, 0x03E51009,
+            0x02691009, 0x022A1009, 0x02701009, 0x03E61009,
+        },
+        {
+            0x25F61009, 0x25F51009, 0x25F71009, 0x25F81009, 0x25F91009, 0x25FA1009,
+            0x25FB1009, 0x25FC1009, 0x25FD1009, 0x25FE1009, 0x25FF1009, 0x26001009,
+            0x26011009, 0x26021009, 0x26031009, 0x26041009,
+        },
+        {
+            0x26051009, 0x26061009, 0x26071009, 0x26081009, 0x26091009, 0x260A1009,
+            0x260C1009, 0x260D1009, 0x260E1009, 0x260F1009, 0x26101009, 0x26111009,
+            0x26121009, 0x26131009, 0x26141009, 0x26151009,
+        },
+        {
+            0x26161009, 0x26171009, 0x26181009, 0x26191009, 0x261A1009, 0x261B1009,
+            0x261C1009, 0x0001CC0A, 0x260B1009, 0x02411009, 0x020E1009, 0x00000000,
+            0x00000000, 0x052C1009, 0x052D1009, 0x1F671009,
+        },
+        {
+            0x00000000, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        },
+        {
+            0x00002909, 0x00002989, 0x00002A09, 0x00002A89, 0x00002B09, 0x00002B89,
+            0x00002C09, 0x00002C89, 0x00002D09, 0x00002D89, 0x00002D89, 0x00002E09,
+            0x00002F89, 0x00000001, 0x03E71009, 0x00003009,
+        },
+        {
+            0x03E81009, 0x00002F09, 0x00002E89, 0x03E91009, 0x00000001, 0x00000001,
+            0x03EA1009, 0x00002D09, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x261E1009, 0x261F1009, 0x26201009, 0x26211009, 0x26221009, 0x26231009,
+            0x26241009, 0x26251009, 0x26261009, 0x26271009, 0x26281065, 0x26281009,
+            0x26291009, 0x262A1065, 0x262A1009, 0x262B1065,
+        },
+        {
+            0x262B1009, 0x262C1009, 0x262D1009, 0x262E1065, 0x262E1009, 0x262F1065,
+            0x262F1009, 0x26301009, 0x26311009, 0x26321009, 0x26331009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x0001D412,
+        },
+        {
+            0x0001E40A, 0x0001EC0A, 0x0001F40A, 0x03EB1009, 0x03EC1009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x067D1009, 0x067F1009, 0x052E1009, 0x03B01009, 0x03B21009, 0x1F681009,
+            0x022B1009, 0x022C1009, 0x05311009, 0x05321009,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x023B1009,
+            0x00000001, 0x00000000, 0x02421009, 0x02711009,
+        },
+        {
+            0x27401009, 0x26641009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000013, 0x26741009, 0x26841009, 0x26851009, 0x26861009,
+            0x268F1009, 0x26991009, 0x269A1009, 0x26A41009,
+        },
+        {
+            0x26A51009, 0x26B31009, 0x26B41009, 0x26C61009, 0x26C71009, 0x26D11009,
+            0x26D21009, 0x26D71009, 0x26D81009, 0x26DB1009, 0x26DC1009, 0x27071009,
+            0x27081009, 0x273D1009, 0x273E1009, 0x273F1009,
+        },
+        {
+            0x00000001, 0x26E41009, 0x26F01009, 0x26F61009, 0x270C1009, 0x27141009,
+            0x27181009, 0x27221009, 0x00000017, 0x27361009, 0x0000001B, 0x00003689,
+            0x00003809, 0x00003989, 0x00003B09, 0x00003D09,
+        },
+        {
+            0x00003E89, 0x00004009, 0x00004089, 0x00004109, 0x00004189, 0x00004209,
+            0x00004309, 0x00004389, 0x00004409, 0x00004509, 0x00004589, 0x00004609,
+            0x00004689, 0x00004709, 0x00004789, 0x00004289,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x03AE1009, 0x022D1009,
+            0x022E1009, 0x03A41009, 0x26731009, 0x26EF1009,
+        },
+        {
+            0x00004C09, 0x26681009, 0x26671009, 0x266B1009, 0x26641011, 0x0001FC0A,
+            0x0002040A, 0x00020C0A, 0x0002140A, 0x26871009, 0x26881009, 0x26751009,
+            0x26891009, 0x268A1009, 0x26761009, 0x268B1009,
+        },
+        {
+            0x26771009, 0x269B1009, 0x269C1009, 0x26901009, 0x26911009, 0x269D1009,
+            0x26921009, 0x26941009, 0x26A61009, 0x26A71009, 0x26A81009, 0x26A91009,
+            0x26AA1009, 0x26AB1009, 0x26AD1009, 0x26AE1009,
+        },
+        {
+            0x26AF1009, 0x26B51009, 0x26B61009, 0x26B71009, 0x26B81009, 0x26B91009,
+            0x26BA1009, 0x26BB1009, 0x26BC1009, 0x26BD1009, 0x26C81009, 0x26C91009,
+            0x26CA1009, 0x26D31009, 0x26D51009, 0x26D91009,
+        },
+        {
+            0x26DD1009, 0x26E51009, 0x26E61009, 0x26E81009, 0x26E91009, 0x26EB1009,
+            0x26EC1009, 0x26F11009, 0x26F31009, 0x26F71009, 0x26F81009, 0x26F91009,
+            0x26FA1009, 0x26FC1009, 0x26FD1009, 0x26FF1009,
+        },
+        {
+            0x27011009, 0x27021009, 0x27031009, 0x27041009, 0x27051009, 0x270D1009,
+            0x270E1009, 0x270F1009, 0x27101009, 0x271E1009, 0x27191009, 0x271B1009,
+            0x271C1009, 0x271D1009, 0x27231009, 0x26931009,
+        },
+        {
+            0x00000000, 0x27241009, 0x00000000, 0x27251009, 0x27291009, 0x272A1009,
+            0x272B1009, 0x272C1009, 0x272D1009, 0x272E1009, 0x272F1009, 0x27301009,
+            0x27381009, 0x27391009, 0x273A1009, 0x27321009,
+        },
+        {
+            0x273B1009, 0x273C1009, 0x27451009, 0x00000000, 0x02801009, 0x27271009,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x05331009, 0x00000001,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x27281011,
+            0x27371011, 0x00000001, 0x00000001, 0x05341009, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x26B01009, 0x26BE1009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x26CB1009, 0x26D61009,
+            0x26DF1009, 0x00021C0A, 0x0002240A, 0x27261009,
+        },
+        {
+            0x02CD1009, 0x02811009, 0x02821009, 0x02431009, 0x02441009, 0x02451009,
+            0x02461009, 0x02471009, 0x02481009, 0x02721009, 0x03ED1009, 0x03EE1009,
+            0x03EF1009, 0x03F01009, 0x00000000, 0x00000001,
+        },
+        {
+            0x27481009, 0x00004C89, 0x27491009, 0x274A1009, 0x00022C0A, 0x274C1009,
+            0x274B1009, 0x274D1009, 0x274E1009, 0x274F1009, 0x27511009, 0x27521009,
+            0x0002340A, 0x27531009, 0x27541009, 0x27551009,
+        },
+        {
+            0x27571009, 0x27581009, 0x27591009, 0x275A1009, 0x275A1065, 0x275B1009,
+            0x275C1009, 0x00023C0A, 0x275E1009, 0x275F1009, 0x27601009, 0x27611009,
+            0x27621009, 0x0002440A, 0x00024C0A, 0x0002540A,
+        },
+        {
+            0x00004D09, 0x00004D89, 0x00004E09, 0x00004E89, 0x00004F09, 0x00004F89,
+            0x00005009, 0x00005089, 0x00005109, 0x00005189, 0x00005209, 0x00005289,
+            0x00005309, 0x00005389, 0x00005409, 0x00005489,
+        },
+        {
+            0x00000001, 0x00001989, 0x00001A09, 0x00000001, 0x00000001, 0x00001989,
+            0x00001A09, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000000,
+            0x00000000, 0x27501009, 0x27561009, 0x275D1009,
+        },
+        {
+            0x26781009, 0x26791009, 0x267A1009, 0x267B1009, 0x267C1009, 0x267D1009,
+            0x267F1009, 0x269E1009, 0x269F1009, 0x26B11009, 0x26B21009, 0x26BF1009,
+            0x26CC1009, 0x26E01009, 0x26E11009, 0x26E21009,
+        },
+        {
+            0x26ED1009, 0x26EE1009, 0x27061009, 0x27091009, 0x270A1009, 0x27151009,
+            0x27161009, 0x271F1009, 0x27201009, 0x27211009, 0x27111009, 0x26C01009,
+            0x26C11009, 0x26CD1009, 0x26A01009, 0x26A11009,
+        },
+        {
+            0x26CE1009, 0x26C21009, 0x26A21009, 0x266C1009, 0x266D1009, 0x27411009,
+            0x27421009, 0x27431009, 0x27331009, 0x27341009, 0x27461009, 0x27471009,
+            0x26A31009, 0x26CF1009, 0x26D01009, 0x26FB1009,
+        },
+        {
+            0x27871009, 0x278A1009, 0x278B1009, 0x278C1009, 0x278E1009, 0x278F1009,
+            0x27901009, 0x27911009, 0x27941009, 0x27961009, 0x27971009, 0x27981009,
+            0x279A1009, 0x279E1009, 0x279F1009, 0x27A11009,
+        },
+        {
+            0x27A21009, 0x27A61009, 0x27A71009, 0x27A81009, 0x27A91009, 0x27AA1009,
+            0x27AB1009, 0x27AC1009, 0x279B1009, 0x27881009, 0x27891009, 0x27991009,
+            0x278D1009, 0x27A31009, 0x27A41009, 0x27A51009,
+        },
+        {
+            0x279C1009, 0x279D1009, 0x27921009, 0x27931009, 0x27A01009, 0x27951009,
+            0x27AE1009, 0x27AF1009, 0x27B01009, 0x27B11009, 0x27B21009, 0x27B31009,
+            0x27B41009, 0x27B51009, 0x27B61009, 0x27B71009,
+        },
+        {
+            0x27B81009, 0x27AD1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x27B91009, 0x27BA1009,
+            0x27BB1009, 0x27BC1009, 0x27BD1009, 0x27BE1009,
+        },
+        {
+            0x27BF1009, 0x27C01009, 0x27C11009, 0x27C21009, 0x27C31009, 0x27C41009,
+            0x27C51009, 0x27C61009, 0x27C71009, 0x27C81009, 0x27C91009, 0x27CA1009,
+            0x27CB1009, 0x27CC1009, 0x27CD1009, 0x27CE1009,
+        },
+        {
+            0x27CF1009, 0x27D01009, 0x27D11009, 0x27D21009, 0x27D31009, 0x27D41009,
+            0x27D51009, 0x27D61009, 0x00025C0A, 0x0002640A, 0x00026C0A, 0x00005509,
+            0x00005589, 0x00005609, 0x00005689, 0x00005709,
+        },
+        {
+            0x00005789, 0x00005809, 0x00005889, 0x00005909, 0x27D71009, 0x27D81009,
+            0x05461009, 0x02CE1009, 0x022F1009, 0x026A1009, 0x00000001, 0x00000000,
+            0x00000000, 0x00001A09, 0x1F691009, 0x1F6A1009,
+        },
+        {
+            0x264A1009, 0x264B1009, 0x264C1009, 0x264D1009, 0x264E1009, 0x264F1009,
+            0x26501009, 0x26511009, 0x26521009, 0x26531009, 0x26541009, 0x26551009,
+            0x26561009, 0x26571009, 0x26581009, 0x26591009,
+        },
+        {
+            0x265A1009, 0x265B1009, 0x265C1009, 0x265D1009, 0x265E1009, 0x265F1009,
+            0x26601009, 0x26611009, 0x00003509, 0x00003589, 0x26621009, 0x26631009,
+            0x00003109, 0x00003109, 0x00003189, 0x00003189,
+        },
+        {
+            0x00003189, 0x00003209, 0x00003209, 0x00003209, 0x00003289, 0x00003289,
+            0x00003309, 0x00003309, 0x00003389, 0x00003389, 0x00003389, 0x00003409,
+            0x00003489, 0x00003609, 0x00000000, 0x00000000,
+        },
+        {
+            0x02491009, 0x024A1009, 0x024B1009, 0x024C1009, 0x024D1009, 0x024E1009,
+            0x024F1009, 0x02501009, 0x02511009, 0x02521009, 0x02531009, 0x02541009,
+            0x02551009, 0x02561009, 0x02571009, 0x00000000,
+        },
+        {
+            0x276E1009, 0x276F1009, 0x27701009, 0x27711009, 0x27721009, 0x27731009,
+            0x27741009, 0x27751009, 0x27761009, 0x27771009, 0x27781009, 0x27791009,
+            0x277A1009, 0x277B1009, 0x277C1009, 0x277D1009,
+        },
+        {
+            0x277E1009, 0x277F1009, 0x27801009, 0x27811009, 0x27821009, 0x27831009,
+            0x27841009, 0x27851009, 0x27861009, 0x00001A09, 0x00001A09, 0x00001A09,
+            0x00000000, 0x00000000, 0x03F11009, 0x00000000,
+        },
+        {
+            0x27631009, 0x27641009, 0x27651009, 0x27661009, 0x27671009, 0x27681009,
+            0x27691009, 0x276A1009, 0x276B1009, 0x276C1009, 0x276D1009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x267E1009, 0x26811009, 0x26951009, 0x26DA1009, 0x26EA1009, 0x26F51009,
+            0x27121009, 0x27171009, 0x266F1009, 0x26701009, 0x26C31009, 0x27351009,
+            0x26711009, 0x26721011, 0x26AC1009, 0x26D41009,
+        },
+        {
+            0x27001009, 0x27311009, 0x26C41009, 0x26E31009, 0x26FE1009, 0x00000000,
+            0x26821009, 0x26831009, 0x268C1009, 0x26C51009, 0x27441009, 0x26E71009,
+            0x26F21009, 0x271A1009, 0x26801009, 0x268D1009,
+        },
+        {
+            0x268E1009, 0x26961009, 0x270B1009, 0x26DE1009, 0x26F41009, 0x26971009,
+            0x26981009, 0x27131009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00004809, 0x00003B89, 0x00003D89,
+            0x00003F09, 0x00003789, 0x00003909, 0x00003A89, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        },
+        {
+            0x00003709, 0x00003889, 0x00003A09, 0x00000001, 0x00003C09, 0x00003C89,
+            0x00003F89, 0x00004889, 0x00004909, 0x00004B09, 0x00004B89, 0x00004A09,
+            0x00004A89, 0x00004989, 0x00003E09, 0x00004489,
+        },
+        {
+            0x00006189, 0x00006189, 0x00006209, 0x00006289, 0x29DA1009, 0x29DB1009,
+            0x29DC1009, 0x29E21009, 0x29E31009, 0x29E41009, 0x29E51009, 0x29E61009,
+            0x29E81009, 0x29EA1009, 0x29EB1009, 0x29EC1009,
+        },
+        {
+            0x29ED1009, 0x29EF1009, 0x29F01009, 0x29F11009, 0x29F21009, 0x29F31009,
+            0x29F41009, 0x29F51009, 0x29F71009, 0x29F81009, 0x29F91009, 0x29FA1009,
+            0x29FB1009, 0x29FE1009, 0x29FF1009, 0x2A001009,
+        },
+        {
+            0x2A011009, 0x2A031009, 0x2A051009, 0x2A061009, 0x2A071009, 0x2A081009,
+            0x2A091009, 0x2A0A1009, 0x2A0B1009, 0x00000000, 0x2A0C1009, 0x2A0D1009,
+            0x2A0E1009, 0x2A101009, 0x2A111009, 0x2A121009,
+        },
+        {
+            0x2A141009, 0x00000000, 0x2A151009, 0x2A161009, 0x00000000, 0x2A171009,
+            0x2A181009, 0x2A191009, 0x2A1A1009, 0x2A1B1009, 0x2A241009, 0x2A251009,
+            0x00006109, 0x2A1C1009, 0x2A231009, 0x2A291009,
+        },
+        {
+            0x2A2A1009, 0x2A2B1009, 0x2A2C1009, 0x2A2D1009, 0x2A2E1009, 0x2A311009,
+            0x2A331009, 0x2A341009, 0x2A361009, 0x2A381009, 0x2A391009, 0x2A3A1009,
+            0x2A3B1009, 0x2A3C1009, 0x2A351009, 0x2A261009,
+        },
+        {
+            0x29D71009, 0x00000001, 0x00000001, 0x00001289, 0x00001209, 0x2A321009,
+            0x2A271009, 0x2A281009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x29E71009, 0x29E91009, 0x2A2F1009, 0x2A301009, 0x02961009, 0x02971009,
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x04001009, 0x1F481009, 0x29D91009, 0x29DD1009, 0x29DE1009, 0x29DF1009,
+            0x29E01009, 0x29E11009, 0x2A021009, 0x29FC1009, 0x2A131009, 0x29F61009,
+            0x29FD1009, 0x2A1D1009, 0x2A041009, 0x2A0F1009,
+        },
+        {
+            0x2A3D1009, 0x00006189, 0x00006209, 0x00006289, 0x00000000, 0x2A3E1009,
+            0x2A3F1009, 0x2A401009, 0x2A411009, 0x2A421009, 0x2A431009, 0x2A441009,
+            0x2A461009, 0x00000000, 0x00000000, 0x2A481009,
+        },
+        {
+            0x2A491009, 0x00000000, 0x00000000, 0x2A4A1009, 0x2A4B1009, 0x2A4C1009,
+            0x2A4D1009, 0x2A4E1009, 0x2A4F1009, 0x2A501009, 0x2A511009, 0x2A521009,
+            0x2A531009, 0x2A541009, 0x2A551009, 0x2A561009,
+        },
+        {
+            0x2A571009, 0x2A581009, 0x2A591009, 0x2A5A1009, 0x2A5B1009, 0x2A5C1009,
+            0x2A5D1009, 0x2A5E1009, 0x2A5F1009, 0x00000000, 0x2A601009, 0x2A611009,
+            0x2A621009, 0x2A631009, 0x2A641009, 0x2A651009,
+        },
+        {
+            0x2A661009, 0x00000000, 0x2A681009, 0x00000000, 0x00000000, 0x00000000,
+            0x2A6A1009, 0x2A6B1009, 0x2A6C1009, 0x2A6D1009, 0x00000000, 0x00000000,
+            0x00006109, 0x2A6E1009, 0x2A6F1009, 0x2A701009,
+        },
+        {
+            0x2A711009, 0x2A721009, 0x2A731009, 0x2A741009, 0x2A751009, 0x00000000,
+            0x00000000, 0x0000001F, 0x2A791009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x2A7C1009, 0x0002740A, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x2A7D1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x2A451009, 0x2A471009, 0x2A761009, 0x2A771009, 0x00000000, 0x00000000,
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x2A671009, 0x2A691009, 0x1F6B1009, 0x1F6C1009, 0x1D561009, 0x1D571009,
+            0x1D581009, 0x1D591009, 0x1D5A1009, 0x1D5B1009, 0x05471009, 0x1F6D1009,
+            0x2A7E1009, 0x04051009, 0x00006309, 0x00000000,
+        },
+        {
+            0x00000000, 0x00006189, 0x00006209, 0x00006289, 0x00000000, 0x2A841009,
+            0x2A851009, 0x2A891009, 0x2A8A1009, 0x2A811009, 0x2A821009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x2A8B1009,
+        },
+        {
+            0x2A861009, 0x00000000, 0x00000000, 0x2A831009, 0x2A871009, 0x2A8F1009,
+            0x2A901009, 0x2A911009, 0x2A921009, 0x2A931009, 0x2A941009, 0x2A951009,
+            0x2A961009, 0x2A971009, 0x2A981009, 0x2A991009,
+        },
+        {
+            0x2A9A1009, 0x2A9B1009, 0x2A9C1009, 0x2A9D1009, 0x2A9E1009, 0x2A9F1009,
+            0x2AA01009, 0x2AA11009, 0x2AA21009, 0x00000000, 0x2AA31009, 0x2AA41009,
+            0x2AA51009, 0x2AA61009, 0x2AA71009, 0x2AA81009,
+        },
+        {
+            0x2AAA1009, 0x00000000, 0x2AAB1009, 0x00000000, 0x00000000, 0x2AAC1009,
+            0x00000000, 0x00000000, 0x2A8C1009, 0x2A8D1009, 0x00000000, 0x00000000,
+            0x00006109, 0x00000000, 0x2AAE1009, 0x2AAF1009,
+        },
+        {
+            0x2AB01009, 0x2AB11009, 0x2AB21009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x2AB31009, 0x2AB41009, 0x00000000, 0x00000000, 0x2AB51009,
+            0x2AB61009, 0x2AB71009, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x2A8E1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x2AAD1009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x00006389, 0x00006409, 0x2A881009, 0x2A801009, 0x2A7F1009, 0x2AA91009,
+            0x04061009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00006189, 0x00006209, 0x00006289, 0x00000000, 0x2AB91009,
+            0x2ABA1009, 0x2ABB1009, 0x2ABC1009, 0x2ABD1009, 0x2ABE1009, 0x2ABF1009,
+            0x2AC11009, 0x2AC31009, 0x00000000, 0x2AC41009,
+        },
+        {
+            0x2AC51009, 0x2AC61009, 0x00000000, 0x2AC71009, 0x2AC81009, 0x2AC91009,
+            0x2ACA1009, 0x2ACB1009, 0x2ACC1009, 0x2ACD1009, 0x2ACE1009, 0x2ACF1009,
+            0x2AD01009, 0x2AD21009, 0x2AD31009, 0x2AD41009,
+        },
+        {
+            0x2AD51009, 0x2AD61009, 0x2AD71009, 0x2AD81009, 0x2AD91009, 0x2ADA1009,
+            0x2ADB1009, 0x2ADC1009, 0x2ADD1009, 0x00000000, 0x2ADE1009, 0x2ADF1009,
+            0x2AE01009, 0x2AE11009, 0x2AE21009, 0x2AE31009,
+        },
+        {
+            0x2AE41009, 0x00000000, 0x2AE51009, 0x2AEB1009, 0x00000000, 0x2AE61009,
+            0x2AE71009, 0x2AE81009, 0x2AE91009, 0x2AEA1009, 0x00000000, 0x00000000,
+            0x00006109, 0x2AEC1009, 0x2AED1009, 0x2AEE1009,
+        },
+        {
+            0x2AEF1009, 0x2AF01009, 0x2AF11009, 0x2AF21009, 0x2AF31009, 0x2AF61009,
+            0x00000000, 0x2AF71009, 0x2AF81009, 0x2AF91009, 0x00000000, 0x2AFA1009,
+            0x2AFB1009, 0x2AFC1009, 0x00000000, 0x00000000,
+        },
+        {
+            0x2AB81009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x2AC01009, 0x2AC21009, 0x2AF41009, 0x2AF51009, 0x00000000, 0x00000000,
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x04071009, 0x1F6E1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x2AD11009, 0x00004089, 0x00004009,
+            0x00004109, 0x00006109, 0x00006109, 0x00006109,
+        },
+        {
+            0x00000000, 0x00006189, 0x00006209, 0x00006289, 0x00000000, 0x2AFD1009,
+            0x2AFE1009, 0x2AFF1009, 0x2B001009, 0x2B011009, 0x2B021009, 0x2B031009,
+            0x2B051009, 0x00000000, 0x00000000, 0x2B071009,
+        },
+        {
+            0x2B081009, 0x00000000, 0x00000000, 0x2B091009, 0x2B0A1009, 0x2B0B1009,
+            0x2B0C1009, 0x2B0D1009, 0x2B0E1009, 0x2B0F1009, 0x2B101009, 0x2B111009,
+            0x2B121009, 0x2B131009, 0x2B141009, 0x2B151009,
+        },
+        {
+            0x2B161009, 0x2B171009, 0x2B181009, 0x2B191009, 0x2B1A1009, 0x2B1B1009,
+            0x2B1C1009, 0x2B1D1009, 0x2B1E1009, 0x00000000, 0x2B1F1009, 0x2B201009,
+            0x2B211009, 0x2B221009, 0x2B231009, 0x2B241009,
+        },
+        {
+            0x2B261009, 0x00000000, 0x2B271009, 0x2B281009, 0x00000000, 0x2B291009,
+            0x2B2B1009, 0x2B2C1009, 0x2B2D1009, 0x2B2E1009, 0x00000000, 0x00000000,
+            0x00006109, 0x2B2F1009, 0x2B301009, 0x2B311009,
+        },
+        {
+            0x2B321009, 0x2B331009, 0x2B341009, 0x2B351009, 0x2B361009, 0x00000000,
+            0x00000000, 0x00000023, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x2B3D1009, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001989,
+            0x2B3E1009, 0x2B3F1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x2B251009,
+        },
+        {
+            0x2B041009, 0x2B061009, 0x2B371009, 0x2B381009, 0x00000000, 0x00000000,
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x05481009, 0x2B2A1009, 0x1D5C1009, 0x1D5D1009, 0x1D5E1009, 0x1D5F1009,
+            0x1D601009, 0x1D611009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00006209, 0x2B4D1009, 0x00000000, 0x2B411009,
+            0x2B421009, 0x2B431009, 0x2B441009, 0x2B451009, 0x2B461009, 0x00000000,
+            0x00000000, 0x00000000, 0x2B471009, 0x2B481009,
+        },
+        {
+            0x2B491009, 0x00000000, 0x00000027, 0x2B4B1009, 0x00000000, 0x2B4E1009,
+            0x00000000, 0x00000000, 0x00000000, 0x2B4F1009, 0x2B501009, 0x00000000,
+            0x2B601009, 0x00000000, 0x2B511009, 0x2B521009,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x2B531009, 0x2B541009, 0x00000000,
+            0x00000000, 0x00000000, 0x2B551009, 0x2B5F1009, 0x2B561009, 0x00000000,
+            0x00000000, 0x00000000, 0x2B571009, 0x2B581009,
+        },
+        {
+            0x2B591009, 0x2B5E1009, 0x2B5A1009, 0x2B5D1009, 0x2B5C1009, 0x2B5B1009,
+            0x2B611009, 0x2B621009, 0x2B631009, 0x2B641009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x2B651009, 0x2B661009,
+        },
+        {
+            0x2B671009, 0x2B681009, 0x2B691009, 0x00000000, 0x00000000, 0x00000000,
+            0x0000002B, 0x0000002F, 0x2B6C1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x2B701009, 0x00000000, 0x00000000,
+        },
+        {
+            0x2B401009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x2B711009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1D681009, 0x1D691009, 0x1D6A1009, 0x05491009, 0x054A1009, 0x054B1009,
+            0x054C1009, 0x054D1009, 0x054E1009, 0x1F701009, 0x054F1009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00006189, 0x00006189, 0x00006209, 0x00006289, 0x00006209, 0x2B721009,
+            0x2B731009, 0x2B741009, 0x2B751009, 0x2B761009, 0x2B771009, 0x2B781009,
+            0x2B7A1009, 0x00000000, 0x2B7C1009, 0x2B7D1009,
+        },
+        {
+            0x2B7E1009, 0x00000000, 0x2B7F1009, 0x2B801009, 0x2B811009, 0x2B821009,
+            0x2B831009, 0x2B841009, 0x2B851009, 0x2B861009, 0x2B871009, 0x2B891009,
+            0x2B8A1009, 0x2B8C1009, 0x2B8D1009, 0x2B8E1009,
+        },
+        {
+            0x2B8F1009, 0x2B901009, 0x2B911009, 0x2B921009, 0x2B931009, 0x2B941009,
+            0x2B951009, 0x2B961009, 0x2B971009, 0x00000000, 0x2B981009, 0x2B991009,
+            0x2B9A1009, 0x2B9B1009, 0x2B9C1009, 0x2B9D1009,
+        },
+        {
+            0x2B9E1009, 0x2B9F1009, 0x2BA01009, 0x2BA61009, 0x2BA71009, 0x2BA11009,
+            0x2BA21009, 0x2BA31009, 0x2BA41009, 0x2BA51009, 0x00000000, 0x00000000,
+            0x00000000, 0x2BA91009, 0x2BAA1009, 0x2BAB1009,
+        },
+        {
+            0x2BAC1009, 0x2BAD1009, 0x2BAE1009, 0x2BAF1009, 0x2BB01009, 0x00000000,
+            0x00000033, 0x2BB41009, 0x00000000, 0x00000000, 0x2BB61009, 0x2BB71009,
+            0x2BB81009, 0x2BB91009, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2BBA1009,
+            0x2BBB1009, 0x00000000, 0x2B881009, 0x2B8B1009, 0x2BA81009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x2B791009, 0x2B7B1009, 0x2BB11009, 0x2BB21009, 0x00000000, 0x00000000,
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x04081009, 0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009,
+            0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x05691009,
+        },
+        {
+            0x2BF31009, 0x00006189, 0x00006209, 0x00006289, 0x04091009, 0x2BBC1009,
+            0x2BBD1009, 0x2BBE1009, 0x2BBF1009, 0x2BC01009, 0x2BC11009, 0x2BC21009,
+            0x2BC41009, 0x00000000, 0x2BC61009, 0x2BC71009,
+        },
+        {
+            0x2BC81009, 0x00000000, 0x2BC91009, 0x2BCA1009, 0x2BCB1009, 0x2BCC1009,
+            0x2BCD1009, 0x2BCE1009, 0x2BCF1009, 0x2BD01009, 0x2BD11009, 0x2BD21009,
+            0x2BD31009, 0x2BD41009, 0x2BD51009, 0x2BD61009,
+        },
+        {
+            0x2BD71009, 0x2BD81009, 0x2BD91009, 0x2BDA1009, 0x2BDB1009, 0x2BDC1009,
+            0x2BDD1009, 0x2BDE1009, 0x2BDF1009, 0x00000000, 0x2BE01009, 0x2BE11009,
+            0x2BE21009, 0x2BE31009, 0x2BE41009, 0x2BE51009,
+        },
+        {
+            0x2BE61009, 0x2BE71009, 0x2BE81009, 0x2BEE1009, 0x00000000, 0x2BE91009,
+            0x2BEA1009, 0x2BEB1009, 0x2BEC1009, 0x2BED1009, 0x00000000, 0x00000000,
+            0x00006109, 0x2BF01009, 0x2BF41009, 0x00000037,
+        },
+        {
+            0x00000000, 0x2BF71009, 0x2BF81009, 0x2BF91009, 0x2BFA1009, 0x00000000,
+            0x0000003B, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x2C021009, 0x2C031009, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2C041009,
+            0x2C051009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x2BEF1009, 0x00000000,
+        },
+        {
+            0x2BC31009, 0x2BC51009, 0x2BFB1009, 0x2BFC1009, 0x00000000, 0x00000000,
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x00000000, 0x2BF11009, 0x2BF21009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00006209, 0x00006189, 0x00006209, 0x00006289, 0x2C3E1009, 0x2C061009,
+            0x2C071009, 0x2C081009, 0x2C091009, 0x2C0B1009, 0x2C0C1009, 0x2C0D1009,
+            0x2C0F1009, 0x00000000, 0x2C111009, 0x2C121009,
+        },
+        {
+            0x2C131009, 0x00000000, 0x2C141009, 0x2C151009, 0x2C161009, 0x2C171009,
+            0x2C181009, 0x2C191009, 0x2C1A1009, 0x2C1B1009, 0x2C1C1009, 0x2C1D1009,
+            0x2C1E1009, 0x2C1F1009, 0x2C201009, 0x2C211009,
+        },
+        {
+            0x2C221009, 0x2C231009, 0x2C241009, 0x2C251009, 0x2C261009, 0x2C271009,
+            0x2C281009, 0x2C291009, 0x2C2A1009, 0x2C2B1009, 0x2C2C1009, 0x2C2D1009,
+            0x2C2E1009, 0x2C2F1009, 0x2C301009, 0x2C311009,
+        },
+        {
+            0x2C321009, 0x2C3B1009, 0x2C331009, 0x2C391009, 0x2C3A1009, 0x2C341009,
+            0x2C351009, 0x2C361009, 0x2C371009, 0x2C381009, 0x2C3C1009, 0x2C4F1011,
+            0x2C4F1011, 0x2C3D1009, 0x2C3F1009, 0x2C401009,
+        },
+        {
+            0x2C411009, 0x2C421009, 0x2C431009, 0x2C441009, 0x2C451009, 0x00000000,
+            0x0000003F, 0x00000043, 0x2C4A1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x2C4F1009, 0x00027C0A, 0x056A1009,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0002840A, 0x00028C0A,
+            0x0002940A, 0x2C4E1009, 0x1D801009, 0x1D811009, 0x1D821009, 0x1D831009,
+            0x1D841009, 0x1D851009, 0x1D861009, 0x2C0A1009,
+        },
+        {
+            0x2C0E1009, 0x2C101009, 0x2C461009, 0x2C471009, 0x00000000, 0x00000000,
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x1D871009, 0x1D881009, 0x1D891009, 0x1D8A1009, 0x1D8B1009, 0x1D8C1009,
+            0x1D8D1009, 0x1D8E1009, 0x1D8F1009, 0x056B1009, 0x00029C0A, 0x0002A40A,
+            0x00027C0A, 0x0002AC0A, 0x0002B40A, 0x0002BC0A,
+        },
+        {
+            0x00000000, 0x00006189, 0x00006209, 0x00006289, 0x00000000, 0x2C501009,
+            0x2C511009, 0x2C521009, 0x2C531009, 0x2C541009, 0x2C551009, 0x2C561009,
+            0x2C571009, 0x2C581009, 0x2C591009, 0x2C5A1009,
+        },
+        {
+            0x2C5B1009, 0x2C5C1009, 0x2C5D1009, 0x2C5E1009, 0x2C5F1009, 0x2C601009,
+            0x2C611009, 0x00000000, 0x00000000, 0x00000000, 0x2C621009, 0x2C631009,
+            0x2C641009, 0x2C651009, 0x2C661009, 0x2C671009,
+        },
+        {
+            0x2C681009, 0x2C691009, 0x2C6A1009, 0x2C6B1009, 0x2C6C1009, 0x2C6D1009,
+            0x2C6E1009, 0x2C6F1009, 0x2C701009, 0x2C711009, 0x2C721009, 0x2C731009,
+            0x2C741009, 0x2C751009, 0x2C761009, 0x2C771009,
+        },
+        {
+            0x2C781009, 0x2C791009, 0x00000000, 0x2C7A1009, 0x2C7B1009, 0x2C7C1009,
+            0x2C7D1009, 0x2C7E1009, 0x2C7F1009, 0x2C801009, 0x2C811009, 0x2C821009,
+            0x00000000, 0x2C831009, 0x00000000, 0x00000000,
+        },
+        {
+            0x2C841009, 0x2C851009, 0x2C861009, 0x2C871009, 0x2C881009, 0x2C891009,
+            0x2C8A1009, 0x00000000, 0x00000000, 0x00000000, 0x2C9C1009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x2C8B1009,
+        },
+        {
+            0x2C8C1009, 0x2C8D1009, 0x2C8E1009, 0x2C8F1009, 0x2C901009, 0x00000000,
+            0x2C911009, 0x00000000, 0x2C921009, 0x00000047, 0x00000000, 0x2C981009,
+            0x00000000, 0x00000000, 0x00000000, 0x2C941009,
+        },
+        {
+            0x00000000, 0x00000000, 0x2C931009, 0x2C951009, 0x040A1009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x32171009, 0x32181009, 0x32191009, 0x321A1009, 0x321B1009,
+            0x321C1009, 0x321D1009, 0x321E1009, 0x321F1009, 0x32201009, 0x32211009,
+            0x32221009, 0x32231009, 0x32241009, 0x32251009,
+        },
+        {
+            0x32261009, 0x32271009, 0x32281009, 0x32291009, 0x322A1009, 0x322B1009,
+            0x322C1009, 0x322D1009, 0x322E1009, 0x322F1009, 0x32301009, 0x32311009,
+            0x32321009, 0x32331009, 0x32341009, 0x32351009,
+        },
+        {
+            0x32361009, 0x32371009, 0x32381009, 0x32391009, 0x323A1009, 0x323B1009,
+            0x323C1009, 0x323D1009, 0x323E1009, 0x323F1009, 0x32401009, 0x32411009,
+            0x32421009, 0x32431009, 0x32441009, 0x32451009,
+        },
+        {
+            0x32461009, 0x32471009, 0x32481009, 0x32491009, 0x324A1009, 0x324B1009,
+            0x324C1009, 0x324D1009, 0x324E1009, 0x324F1009, 0x32501009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x1F751009,
+        },
+        {
+            0x0000004B, 0x0000004F, 0x00000053, 0x00000057, 0x0000005B, 0x32561009,
+            0x1F491009, 0x00006A09, 0x00006A89, 0x00006B09, 0x00006B89, 0x00006C09,
+            0x00006C89, 0x0000005F, 0x00006989, 0x040B1009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x040C1009, 0x040D1009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x32581009, 0x32591009, 0x00000000, 0x325A1009, 0x00000000,
+            0x325B1009, 0x325C1009, 0x325D1009, 0x325E1009, 0x32601009, 0x00000000,
+            0x32611009, 0x32641009, 0x32621009, 0x32651009,
+        },
+        {
+            0x32661009, 0x32671009, 0x32681009, 0x32691009, 0x326A1009, 0x326B1009,
+            0x326C1009, 0x326D1009, 0x326E1009, 0x326F1009, 0x32701009, 0x32711009,
+            0x32721009, 0x32731009, 0x32741009, 0x32751009,
+        },
+        {
+            0x32761009, 0x32771009, 0x32781009, 0x32791009, 0x00000000, 0x327A1009,
+            0x00000000, 0x327B1009, 0x327C1009, 0x327D1009, 0x325F1009, 0x327E1009,
+            0x327F1009, 0x32801009, 0x32811009, 0x32821009,
+        },
+        {
+            0x32831009, 0x32841009, 0x32851009, 0x32861009, 0x32871009, 0x32881009,
+            0x32891009, 0x328A1009, 0x328B1009, 0x328C1009, 0x328D1009, 0x328E1009,
+            0x328F1009, 0x32901009, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000063, 0x00000067, 0x0000006B, 0x0000006F, 0x00000073, 0x00000000,
+            0x1F4A1009, 0x00000000, 0x00006D89, 0x00006E09, 0x00006E89, 0x00006F09,
+            0x00006F89, 0x00000077, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00000000, 0x00000000,
+            0x0002C40A, 0x0002CC0A, 0x32571009, 0x32631009,
+        },
+        {
+            0x0002D40E, 0x05731009, 0x05741009, 0x05751009, 0x04101009, 0x04111009,
+            0x04121009, 0x04131009, 0x04141009, 0x04151009, 0x04161009, 0x04191009,
+            0x0419106D, 0x041A1009, 0x041B1009, 0x041C1009,
+        },
+        {
+            0x041D1009, 0x041E1009, 0x041F1009, 0x05761009, 0x025F1009, 0x05771009,
+            0x05781009, 0x05791009, 0x00000001, 0x00000001, 0x057A1009, 0x057B1009,
+            0x057C1009, 0x057D1009, 0x057E1009, 0x057F1009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1F991011, 0x1F9A1011,
+            0x1F9B1011, 0x1F9C1011, 0x1F9D1011, 0x1F9E1011,
+        },
+        {
+            0x1F9F1011, 0x1FA01011, 0x1FA11011, 0x1F981011, 0x05801009, 0x00000001,
+            0x05811009, 0x00000001, 0x05821009, 0x00007189, 0x032E1009, 0x032F1009,
+            0x03301009, 0x03311009, 0x00000001, 0x00000001,
+        },
+        {
+            0x32D91009, 0x32DC1009, 0x32DE1009, 0x00000000, 0x32E01009, 0x32E21009,
+            0x32E41009, 0x32E61009, 0x00000000, 0x32E81009, 0x32EA1009, 0x32EC1009,
+            0x32EE1009, 0x00000000, 0x32F01009, 0x32F21009,
+        },
+        {
+            0x32F41009, 0x32F61009, 0x00000000, 0x32F81009, 0x32FA1009, 0x32FC1009,
+            0x32FE1009, 0x00000000, 0x33001009, 0x33021009, 0x33041009, 0x33061009,
+            0x00000000, 0x33081009, 0x330A1009, 0x330C1009,
+        },
+        {
+            0x330E1009, 0x33101009, 0x33121009, 0x33151009, 0x33171009, 0x33191009,
+            0x331B1009, 0x331D1009, 0x331F1009, 0x00000000, 0x0002E00A, 0x32DB1009,
+            0x33141009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x0000007B, 0x332A1009, 0x00000000, 0x332E1009, 0x00000000,
+            0x00000000, 0x33311009, 0x00000000, 0x33331009, 0x33341009, 0x33351009,
+            0x33361009, 0x33371009, 0x00006209, 0x00006289,
+        },
+        {
+            0x332C1009, 0x00000000, 0x00000001, 0x00000001, 0x33381009, 0x04201009,
+            0x00000001, 0x00000001, 0x33211009, 0x33231009, 0x33271009, 0x33281009,
+            0x33251009, 0x33221009, 0x33241009, 0x33261009,
+        },
+        {
+            0x32DA1009, 0x32DD1009, 0x32DF1009, 0x00000000, 0x32E11009, 0x32E31009,
+            0x32E51009, 0x32E71009, 0x00000000, 0x32E91009, 0x32EB1009, 0x32ED1009,
+            0x32EF1009, 0x00000000, 0x32F11009, 0x32F31009,
+        },
+        {
+            0x32F51009, 0x32F71009, 0x00000000, 0x32F91009, 0x32FB1009, 0x32FD1009,
+            0x32FF1009, 0x00000000, 0x33011009, 0x33031009, 0x33051009, 0x33071009,
+            0x00000000, 0x33091009, 0x330B1009, 0x330D1009,
+        },
+        {
+            0x330F1009, 0x33111009, 0x0000007F, 0x00000083, 0x33181009, 0x331A1009,
+            0x331C1009, 0x331E1009, 0x33201009, 0x00000000, 0x0002E80A, 0x0002F00A,
+            0x0002F80A, 0x00000000, 0x05831009, 0x05841009,
+        },
+        {
+            0x05851009, 0x05861009, 0x05871009, 0x05881009, 0x05891009, 0x058A1009,
+            0x00000001, 0x058B1009, 0x058C1009, 0x058D1009, 0x058E1009, 0x058F1009,
+            0x05901009, 0x00000000, 0x05911009, 0x05921009,
+        },
+        {
+            0x04171009, 0x04181009, 0x04211009, 0x04221009, 0x04231009, 0x05931009,
+            0x05941009, 0x05951009, 0x05961009, 0x04241009, 0x04251009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x356C1009, 0x356E1009, 0x35701009, 0x35741009, 0x35771009, 0x35791009,
+            0x357C1009, 0x35801009, 0x35851009, 0x358C1009, 0x35901009, 0x35911009,
+            0x35931009, 0x35951009, 0x35981009, 0x359B1009,
+        },
+        {
+            0x359F1009, 0x35A01009, 0x35A11009, 0x35A41009, 0x35A71009, 0x35AB1009,
+            0x35AC1009, 0x35B21009, 0x35B51009, 0x35B81009, 0x35BA1009, 0x35BC1009,
+            0x35C01009, 0x35C21009, 0x35C91009, 0x35CB1009,
+        },
+        {
+            0x35D11009, 0x35D81009, 0x35D91009, 0x35DA1009, 0x35DB1009, 0x00000087,
+            0x00000000, 0x35E21009, 0x35E31009, 0x35E41009, 0x35E51009, 0x35E61011,
+            0x35E61009, 0x35EA1009, 0x35EC1009, 0x35EE1009,
+        },
+        {
+            0x35F11009, 0x35F61009, 0x35FA1009, 0x35ED1009, 0x35FC1009, 0x35F81009,
+            0x00006209, 0x00007389, 0x00006289, 0x36021009, 0x36031009, 0x35BB1009,
+            0x35BF1009, 0x35C31009, 0x35CE1009, 0x0003000E,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x02A11009, 0x02A21009,
+            0x043B1009, 0x043C1009, 0x043D1009, 0x043E1009,
+        },
+        {
+            0x35C61009, 0x35C71009, 0x35DE1009, 0x35DF1009, 0x35E01009, 0x35E11009,
+            0x35F21009, 0x35F31009, 0x35F41009, 0x35F51009, 0x35781009, 0x35861009,
+            0x35D31009, 0x35D41009, 0x35AA1009, 0x35B91009,
+        },
+        {
+            0x35C11009, 0x358A1009, 0x35FD1009, 0x36041009, 0x36051009, 0x35C81009,
+            0x35D71009, 0x35FE1009, 0x35FF1009, 0x36061009, 0x36071009, 0x36081009,
+            0x36091009, 0x360A1009, 0x359C1009, 0x35D51009,
+        },
+        {
+            0x35D61009, 0x35EB1009, 0x35E81009, 0x35EF1009, 0x35F01009, 0x356D1009,
+            0x356F1009, 0x35711009, 0x357A1009, 0x35831009, 0x358D1009, 0x35A21009,
+            0x35A81009, 0x35AD1009, 0x35AE1009, 0x35B31009,
+        },
+        {
+            0x35C51009, 0x35CC1009, 0x35C41009, 0x35E71009, 0x35F71009, 0x35F91009,
+            0x36011009, 0x360B1009, 0x360D1009, 0x36101009, 0x36111009, 0x360C1009,
+            0x360E1009, 0x360F1009, 0x35B01009, 0x36121009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x36131009, 0x36141009,
+            0x35E91009, 0x35FB1009, 0x05991009, 0x059A1009,
+        },
+        {
+            0x25A01021, 0x25A21021, 0x25A41021, 0x25A61021, 0x25A81021, 0x25AA1021,
+            0x25AC1021, 0x25B01021, 0x25B21021, 0x25B41021, 0x25B61021, 0x25B81021,
+            0x25BA1021, 0x25BE1021, 0x25C01021, 0x25C21021,
+        },
+        {
+            0x25C41021, 0x25C61021, 0x25C81021, 0x25CC1021, 0x25CE1021, 0x25D01021,
+            0x25D21021, 0x25D41021, 0x25D61021, 0x25D81021, 0x25DA1021, 0x25DC1021,
+            0x25DE1021, 0x25E01021, 0x25E21021, 0x25E61021,
+        },
+        {
+            0x25E81021, 0x25AE1021, 0x25BC1021, 0x25CA1021, 0x25E41021, 0x25EA1021,
+            0x00000000, 0x25ED1021, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x25F21021, 0x00000000, 0x00000000,
+        },
+        {
+            0x259F1009, 0x25A11009, 0x25A31009, 0x25A51009, 0x25A71009, 0x25A91009,
+            0x25AB1009, 0x25AF1009, 0x25B11009, 0x25B31009, 0x25B51009, 0x25B71009,
+            0x25B91009, 0x25BD1009, 0x25BF1009, 0x25C11009,
+        },
+        {
+            0x25C31009, 0x25C51009, 0x25C71009, 0x25CB1009, 0x25CD1009, 0x25CF1009,
+            0x25D11009, 0x25D31009, 0x25D51009, 0x25D71009, 0x25D91009, 0x25DB1009,
+            0x25DD1009, 0x25DF1009, 0x25E11009, 0x25E51009,
+        },
+        {
+            0x25E71009, 0x25AD1009, 0x25BB1009, 0x25C91009, 0x25E31009, 0x25E91009,
+            0x25EB1009, 0x25EC1009, 0x25EE1009, 0x25EF1009, 0x25F01009, 0x02CF1009,
+            0x25B91051, 0x25F11009, 0x25F31009, 0x25F41009,
+        },
+        {
+            0x41751009, 0x41761009, 0x41771009, 0x41781009, 0x41791009, 0x417A1009,
+            0x417B1009, 0x417C1009, 0x417D1009, 0x417E1009, 0x417F1009, 0x41801009,
+            0x41811009, 0x41821009, 0x41831009, 0x41841009,
+        },
+        {
+            0x41851009, 0x41861009, 0x41871009, 0x41881009, 0x41891009, 0x418A1009,
+            0x418B1009, 0x418C1009, 0x418D1009, 0x418E1009, 0x418F1009, 0x41901009,
+            0x41911009, 0x41921009, 0x41931009, 0x41941009,
+        },
+        {
+            0x41951009, 0x41961009, 0x41971009, 0x41981009, 0x41991009, 0x419A1009,
+            0x419B1009, 0x419C1009, 0x419D1009, 0x419E1009, 0x419F1009, 0x41A01009,
+            0x41A11009, 0x41A21009, 0x41A31009, 0x41A41009,
+        },
+        {
+            0x41A51009, 0x41A61009, 0x41A71009, 0x41A81009, 0x41A91009, 0x41AA1009,
+            0x41AB1009, 0x41AC1009, 0x41AD1009, 0x41AE1009, 0x41AF1009, 0x41B01009,
+            0x41B11009, 0x41B21009, 0x41B31009, 0x41B41009,
+        },
+        {
+            0x41B51009, 0x41B61009, 0x41B71009, 0x41B81009, 0x41B91009, 0x41BA1009,
+            0x41BB1009, 0x41BC1009, 0x41BD1009, 0x41BE1009, 0x41BF1009, 0x41C01009,
+            0x41C11009, 0x41C21009, 0x41C31009, 0x41C41009,
+        },
+        {
+            0x41C51009, 0x41C61009, 0x41C71009, 0x41C81009, 0x41C91009, 0x41CA1009,
+            0x41CB1009, 0x41CC1009, 0x41CD1009, 0x41CE1009, 0x41CF1009, 0x41D01009,
+            0x41D11009, 0x41D21009, 0x41D31009, 0x41F11009,
+        },
+        {
+            0x41F21009, 0x41F31009, 0x41F41009, 0x41F51009, 0x41F61009, 0x41F71009,
+            0x41F81009, 0x41F91009, 0x41FA1009, 0x41FB1009, 0x41FC1009, 0x41FD1009,
+            0x41FE1009, 0x41FF1009, 0x42001009, 0x42011009,
+        },
+        {
+            0x42021009, 0x42031009, 0x42041009, 0x42051009, 0x42061009, 0x42071009,
+            0x42081009, 0x42091009, 0x420A1009, 0x420B1009, 0x420C1009, 0x420D1009,
+            0x420E1009, 0x420F1009, 0x42101009, 0x42111009,
+        },
+        {
+            0x42121009, 0x42131009, 0x42141009, 0x42151009, 0x42161009, 0x42171009,
+            0x42181009, 0x42191009, 0x421A1009, 0x421B1009, 0x421C1009, 0x421D1009,
+            0x421E1009, 0x421F1009, 0x42201009, 0x42211009,
+        },
+        {
+            0x42221009, 0x42231009, 0x42241009, 0x42251009, 0x42261009, 0x42271009,
+            0x42281009, 0x42291009, 0x422A1009, 0x422B1009, 0x422C1009, 0x422D1009,
+            0x422E1009, 0x422F1009, 0x42301009, 0x42311009,
+        },
+        {
+            0x42321009, 0x42331009, 0x42341009, 0x42351009, 0x42361009, 0x42371009,
+            0x42381009, 0x42391009, 0x42511009, 0x42521009, 0x42531009, 0x42541009,
+            0x42551009, 0x42561009, 0x42571009, 0x42581009,
+        },
+        {
+            0x42591009, 0x425A1009, 0x425B1009, 0x425C1009, 0x425D1009, 0x425E1009,
+            0x425F1009, 0x42601009, 0x42611009, 0x42621009, 0x42631009, 0x42641009,
+            0x42651009, 0x42661009, 0x42671009, 0x42681009,
+        },
+        {
+            0x42691009, 0x426A1009, 0x426B1009, 0x426C1009, 0x426D1009, 0x426E1009,
+            0x426F1009, 0x42701009, 0x42711009, 0x42721009, 0x42731009, 0x42741009,
+            0x42751009, 0x42761009, 0x42771009, 0x42781009,
+        },
+        {
+            0x42791009, 0x427A1009, 0x427B1009, 0x427C1009, 0x427D1009, 0x427E1009,
+            0x427F1009, 0x42801009, 0x42811009, 0x42821009, 0x42831009, 0x42841009,
+            0x42851009, 0x42861009, 0x42871009, 0x42881009,
+        },
+        {
+            0x42891009, 0x428A1009, 0x428B1009, 0x428C1009, 0x428D1009, 0x428E1009,
+            0x428F1009, 0x42901009, 0x42911009, 0x42921009, 0x42931009, 0x42941009,
+            0x42951009, 0x42961009, 0x42971009, 0x42981009,
+        },
+        {
+            0x42991009, 0x429A1009, 0x429B1009, 0x429C1009, 0x429D1009, 0x429E1009,
+            0x429F1009, 0x42A01009, 0x42A11009, 0x42A21009, 0x42A31009, 0x42A41009,
+            0x42A51009, 0x42A61009, 0x42A71009, 0x42A81009,
+        },
+        {
+            0x28121009, 0x28131009, 0x28141009, 0x28151009, 0x28161009, 0x28171009,
+            0x28181009, 0x28191009, 0x281A1009, 0x281B1009, 0x281C1009, 0x281D1009,
+            0x281E1009, 0x281F1009, 0x28201009, 0x28211009,
+        },
+        {
+            0x28231009, 0x28241009, 0x28251009, 0x28261009, 0x28271009, 0x28281009,
+            0x28291009, 0x282A1009, 0x282B1009, 0x282C1009, 0x282D1009, 0x282E1009,
+            0x282F1009, 0x28301009, 0x28311009, 0x28321009,
+        },
+        {
+            0x28381009, 0x28391009, 0x283A1009, 0x283B1009, 0x283C1009, 0x283D1009,
+            0x283E1009, 0x283F1009, 0x28401009, 0x28411009, 0x28421009, 0x28431009,
+            0x28441009, 0x28451009, 0x28461009, 0x28471009,
+        },
+        {
+            0x28491009, 0x284A1009, 0x284B1009, 0x284C1009, 0x284D1009, 0x284E1009,
+            0x284F1009, 0x28501009, 0x28581009, 0x28591009, 0x285A1009, 0x285B1009,
+            0x285C1009, 0x285D1009, 0x285E1009, 0x285F1009,
+        },
+        {
+            0x28611009, 0x28621009, 0x28631009, 0x28641009, 0x28651009, 0x28661009,
+            0x28671009, 0x28681009, 0x28691009, 0x00000000, 0x286A1009, 0x286B1009,
+            0x286C1009, 0x286D1009, 0x00000000, 0x00000000,
+        },
+        {
+            0x286E1009, 0x286F1009, 0x28701009, 0x28711009, 0x28721009, 0x28731009,
+            0x28741009, 0x00000000, 0x28751009, 0x00000000, 0x28761009, 0x28771009,
+            0x28781009, 0x28791009, 0x00000000, 0x00000000,
+        },
+        {
+            0x287A1009, 0x287B1009, 0x287C1009, 0x287D1009, 0x287E1009, 0x287F1009,
+            0x28801009, 0x28811009, 0x28871009, 0x28881009, 0x28891009, 0x288A1009,
+            0x288B1009, 0x288C1009, 0x288D1009, 0x288E1009,
+        },
+        {
+            0x288F1009, 0x28901009, 0x28911009, 0x28921009, 0x28931009, 0x28941009,
+            0x28951009, 0x28961009, 0x28981009, 0x28991009, 0x289A1009, 0x289B1009,
+            0x289C1009, 0x289D1009, 0x289E1009, 0x289F1009,
+        },
+        {
+            0x28A11009, 0x28A21009, 0x28A31009, 0x28A41009, 0x28A51009, 0x28A61009,
+            0x28A71009, 0x28A81009, 0x28A91009, 0x00000000, 0x28AA1009, 0x28AB1009,
+            0x28AC1009, 0x28AD1009, 0x00000000, 0x00000000,
+        },
+        {
+            0x28AE1009, 0x28AF1009, 0x28B01009, 0x28B11009, 0x28B21009, 0x28B31009,
+            0x28B41009, 0x28B51009, 0x28B71009, 0x28B81009, 0x28B91009, 0x28BA1009,
+            0x28BB1009, 0x28BC1009, 0x28BD1009, 0x28BE1009,
+        },
+        {
+            0x28C01009, 0x28C11009, 0x28C21009, 0x28C31009, 0x28C41009, 0x28C51009,
+            0x28C61009, 0x28C71009, 0x28C91009, 0x28CA1009, 0x28CB1009, 0x28CC1009,
+            0x28CD1009, 0x28CE1009, 0x28CF1009, 0x28D01009,
+        },
+        {
+            0x28D11009, 0x00000000, 0x28D21009, 0x28D31009, 0x28D41009, 0x28D51009,
+            0x00000000, 0x00000000, 0x28D61009, 0x28D71009, 0x28D81009, 0x28D91009,
+            0x28DA1009, 0x28DB1009, 0x28DC1009, 0x00000000,
+        },
+        {
+            0x28DD1009, 0x00000000, 0x28DE1009, 0x28DF1009, 0x28E01009, 0x28E11009,
+            0x00000000, 0x00000000, 0x28E21009, 0x28E31009, 0x28E41009, 0x28E51009,
+            0x28E61009, 0x28E71009, 0x28E81009, 0x28E91009,
+        },
+        {
+            0x28EA1009, 0x28EB1009, 0x28EC1009, 0x28ED1009, 0x28EE1009, 0x28EF1009,
+            0x28F01009, 0x00000000, 0x28F11009, 0x28F21009, 0x28F31009, 0x28F41009,
+            0x28F51009, 0x28F61009, 0x28F71009, 0x28F81009,
+        },
+        {
+            0x29001009, 0x29011009, 0x29021009, 0x29031009, 0x29041009, 0x29051009,
+            0x29061009, 0x29071009, 0x29081009, 0x29091009, 0x290A1009, 0x290B1009,
+            0x290C1009, 0x290D1009, 0x290E1009, 0x290F1009,
+        },
+        {
+            0x29101009, 0x29111009, 0x29121009, 0x29131009, 0x29141009, 0x29151009,
+            0x29161009, 0x29171009, 0x291F1009, 0x29201009, 0x29211009, 0x29221009,
+            0x29231009, 0x29241009, 0x29251009, 0x29261009,
+        },
+        {
+            0x29281009, 0x29291009, 0x292A1009, 0x292B1009, 0x292C1009, 0x292D1009,
+            0x292E1009, 0x292F1009, 0x29311009, 0x29321009, 0x29331009, 0x29341009,
+            0x29351009, 0x29361009, 0x29371009, 0x29381009,
+        },
+        {
+            0x29391009, 0x00000000, 0x293A1009, 0x293B1009, 0x293C1009, 0x293D1009,
+            0x00000000, 0x00000000, 0x293E1009, 0x293F1009, 0x29401009, 0x29411009,
+            0x29421009, 0x29431009, 0x29441009, 0x29451009,
+        },
+        {
+            0x294A1009, 0x294B1009, 0x294C1009, 0x294D1009, 0x294E1009, 0x294F1009,
+            0x29501009, 0x29511009, 0x29531009, 0x29541009, 0x29551009, 0x29561009,
+            0x29571009, 0x29581009, 0x29591009, 0x295A1009,
+        },
+        {
+            0x29631009, 0x29641009, 0x29651009, 0x29661009, 0x29671009, 0x29681009,
+            0x29691009, 0x296A1009, 0x296C1009, 0x296D1009, 0x296E1009, 0x296F1009,
+            0x29701009, 0x29711009, 0x29721009, 0x29731009,
+        },
+        {
+            0x297B1009, 0x297C1009, 0x297D1009, 0x297E1009, 0x297F1009, 0x29801009,
+            0x29811009, 0x29821009, 0x29831009, 0x29841009, 0x29851009, 0x29861009,
+            0x29871009, 0x29881009, 0x29891009, 0x298A1009,
+        },
+        {
+            0x298F1009, 0x29901009, 0x29911009, 0x29921009, 0x29931009, 0x29941009,
+            0x29951009, 0x29961009, 0x299C1009, 0x299D1009, 0x299E1009, 0x00000000,
+            0x00000000, 0x00005A89, 0x00005A09, 0x00005989,
+        },
+        {
+            0x02D01009, 0x02581009, 0x02831009, 0x02591009, 0x025A1009, 0x025B1009,
+            0x025C1009, 0x02731009, 0x02D11009, 0x1F991009, 0x1F9A1009, 0x1F9B1009,
+            0x1F9C1009, 0x1F9D1009, 0x1F9E1009, 0x1F9F1009,
+        },
+        {
+            0x1FA01009, 0x1FA11009, 0x1D901009, 0x1D911009, 0x1D921009, 0x1D931009,
+            0x1D941009, 0x1D951009, 0x1D961009, 0x1D971009, 0x1D981009, 0x1D991009,
+            0x1D9A1009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x28331009, 0x28341009, 0x28351009, 0x28361009, 0x28821009, 0x28831009,
+            0x28841009, 0x28851009, 0x298B1009, 0x298C1009, 0x298D1009, 0x298E1009,
+            0x29971009, 0x29981009, 0x29991009, 0x299A1009,
+        },
+        {
+            0x04FA1009, 0x04FB1009, 0x04FC1009, 0x04FD1009, 0x04FE1009, 0x04FF1009,
+            0x05001009, 0x05011009, 0x05021009, 0x05031009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x38DE1021, 0x38DF1021, 0x38E01021, 0x38E11021, 0x38E21021, 0x38E31021,
+            0x38E41021, 0x38E51021, 0x38E61021, 0x38E71021, 0x38E81021, 0x38E91021,
+            0x38EA1021, 0x38EB1021, 0x38EC1021, 0x38ED1021,
+        },
+        {
+            0x38EE1021, 0x38EF1021, 0x38F01021, 0x38F11021, 0x38F21021, 0x38F31021,
+            0x38F41021, 0x38F51021, 0x38F61021, 0x38F71021, 0x38F81021, 0x38F91021,
+            0x38FA1021, 0x38FB1021, 0x38FC1021, 0x38FD1021,
+        },
+        {
+            0x38FE1021, 0x38FF1021, 0x39001021, 0x39011021, 0x39021021, 0x39031021,
+            0x39041021, 0x39051021, 0x39061021, 0x39071021, 0x39081021, 0x39091021,
+            0x390A1021, 0x390B1021, 0x390C1021, 0x390D1021,
+        },
+        {
+            0x390E1021, 0x390F1021, 0x39101021, 0x39111021, 0x39121021, 0x39131021,
+            0x39141021, 0x39151021, 0x39161021, 0x39171021, 0x39181021, 0x39191021,
+            0x391A1021, 0x391B1021, 0x391C1021, 0x391D1021,
+        },
+        {
+            0x391E1021, 0x391F1021, 0x39201021, 0x39211021, 0x39221021, 0x39231021,
+            0x39241021, 0x39251021, 0x39261021, 0x39271021, 0x39281021, 0x39291021,
+            0x392A1021, 0x392B1021, 0x392C1021, 0x392D1021,
+        },
+        {
+            0x392E1021, 0x392F1021, 0x39301021, 0x39311021, 0x39321021, 0x39331021,
+            0x00000000, 0x00000000, 0x392E1009, 0x392F1009, 0x39301009, 0x39311009,
+            0x39321009, 0x39331009, 0x00000000, 0x00000000,
+        },
+        {
+            0x020F1009, 0x39581009, 0x39591009, 0x395A1009, 0x395B1009, 0x395C1009,
+            0x395D1009, 0x395E1009, 0x395F1009, 0x39601009, 0x39611009, 0x39621009,
+            0x39631009, 0x39641009, 0x39651009, 0x39661009,
+        },
+        {
+            0x39671009, 0x39681009, 0x39691009, 0x396A1009, 0x396B1009, 0x396C1009,
+            0x396D1009, 0x396E1009, 0x396F1009, 0x39701009, 0x39711009, 0x39721009,
+            0x39731009, 0x39741009, 0x39751009, 0x39761009,
+        },
+        {
+            0x39771009, 0x39781009, 0x39791009, 0x397A1009, 0x397B1009, 0x397C1009,
+            0x397D1009, 0x397E1009, 0x397F1009, 0x39801009, 0x39811009, 0x39821009,
+            0x39831009, 0x39841009, 0x39851009, 0x39861009,
+        },
+        {
+            0x39871009, 0x39881009, 0x39891009, 0x398A1009, 0x398B1009, 0x398C1009,
+            0x398D1009, 0x398E1009, 0x398F1009, 0x39901009, 0x39911009, 0x39921009,
+            0x39931009, 0x39941009, 0x39951009, 0x39961009,
+        },
+        {
+            0x39971009, 0x39981009, 0x39991009, 0x399A1009, 0x399B1009, 0x399C1009,
+            0x399D1009, 0x399E1009, 0x399F1009, 0x39A01009, 0x39A11009, 0x39A21009,
+            0x39A31009, 0x39A41009, 0x39A51009, 0x39A61009,
+        },
+        {
+            0x39A71009, 0x39A81009, 0x39A91009, 0x39AA1009, 0x39AB1009, 0x39AC1009,
+            0x39AD1009, 0x39AE1009, 0x39AF1009, 0x39B01009, 0x39B11009, 0x39B21009,
+            0x39B31009, 0x39B41009, 0x39B51009, 0x39B61009,
+        },
+        {
+            0x39B71009, 0x39B81009, 0x39B91009, 0x39BA1009, 0x39BB1009, 0x39BC1009,
+            0x39BD1009, 0x39BE1009, 0x39BF1009, 0x39C01009, 0x39C11009, 0x39C21009,
+            0x39C31009, 0x39C41009, 0x39C51009, 0x39C61009,
+        },
+        {
+            0x39C71009, 0x39C81009, 0x39C91009, 0x39CA1009, 0x39CB1009, 0x39CC1009,
+            0x39CD1009, 0x39CE1009, 0x39CF1009, 0x39D01009, 0x39D11009, 0x39D21009,
+            0x39D31009, 0x39D41009, 0x39D51009, 0x39D61009,
+        },
+        {
+            0x39D71009, 0x39D81009, 0x39D91009, 0x39DA1009, 0x39DB1009, 0x39DC1009,
+            0x39DD1009, 0x39DE1009, 0x39DF1009, 0x39E01009, 0x39E11009, 0x39E21009,
+            0x39E31009, 0x39E41009, 0x39E51009, 0x39E61009,
+        },
+        {
+            0x39E71009, 0x39E81009, 0x39E91009, 0x39EA1009, 0x39EB1009, 0x39EC1009,
+            0x39ED1009, 0x39EE1009, 0x39EF1009, 0x39F01009, 0x39F11009, 0x39F21009,
+            0x39F31009, 0x39F41009, 0x39F51009, 0x39F61009,
+        },
+        {
+            0x39F71009, 0x39F81009, 0x39F91009, 0x39FA1009, 0x39FB1009, 0x39FC1009,
+            0x39FD1009, 0x39FE1009, 0x39FF1009, 0x3A001009, 0x3A011009, 0x3A021009,
+            0x3A031009, 0x3A041009, 0x3A051009, 0x3A061009,
+        },
+        {
+            0x3A071009, 0x3A081009, 0x3A091009, 0x3A0A1009, 0x3A0B1009, 0x3A0C1009,
+            0x3A0D1009, 0x3A0E1009, 0x3A0F1009, 0x3A101009, 0x3A111009, 0x3A121009,
+            0x3A131009, 0x3A141009, 0x3A151009, 0x3A161009,
+        },
+        {
+            0x3A171009, 0x3A181009, 0x3A191009, 0x3A1A1009, 0x3A1B1009, 0x3A1C1009,
+            0x3A1D1009, 0x3A1E1009, 0x3A1F1009, 0x3A201009, 0x3A211009, 0x3A221009,
+            0x3A231009, 0x3A241009, 0x3A251009, 0x3A261009,
+        },
+        {
+            0x3A271009, 0x3A281009, 0x3A291009, 0x3A2A1009, 0x3A2B1009, 0x3A2C1009,
+            0x3A2D1009, 0x3A2E1009, 0x3A2F1009, 0x3A301009, 0x3A311009, 0x3A321009,
+            0x3A331009, 0x3A341009, 0x3A351009, 0x3A361009,
+        },
+        {
+            0x3A371009, 0x3A381009, 0x3A391009, 0x3A3A1009, 0x3A3B1009, 0x3A3C1009,
+            0x3A3D1009, 0x3A3E1009, 0x3A3F1009, 0x3A401009, 0x3A411009, 0x3A421009,
+            0x3A431009, 0x3A441009, 0x3A451009, 0x3A461009,
+        },
+        {
+            0x3A471009, 0x3A481009, 0x3A491009, 0x3A4A1009, 0x3A4B1009, 0x3A4C1009,
+            0x3A4D1009, 0x3A4E1009, 0x3A4F1009, 0x3A501009, 0x3A511009, 0x3A521009,
+            0x3A531009, 0x3A541009, 0x3A551009, 0x3A561009,
+        },
+        {
+            0x3A571009, 0x3A581009, 0x3A591009, 0x3A5A1009, 0x3A5B1009, 0x3A5C1009,
+            0x3A5D1009, 0x3A5E1009, 0x3A5F1009, 0x3A601009, 0x3A611009, 0x3A621009,
+            0x3A631009, 0x3A641009, 0x3A651009, 0x3A661009,
+        },
+        {
+            0x3A671009, 0x3A681009, 0x3A691009, 0x3A6A1009, 0x3A6B1009, 0x3A6C1009,
+            0x3A6D1009, 0x3A6E1009, 0x3A6F1009, 0x3A701009, 0x3A711009, 0x3A721009,
+            0x3A731009, 0x3A741009, 0x3A751009, 0x3A761009,
+        },
+        {
+            0x3A771009, 0x3A781009, 0x3A791009, 0x3A7A1009, 0x3A7B1009, 0x3A7C1009,
+            0x3A7D1009, 0x3A7E1009, 0x3A7F1009, 0x3A801009, 0x3A811009, 0x3A821009,
+            0x3A831009, 0x3A841009, 0x3A851009, 0x3A861009,
+        },
+        {
+            0x3A871009, 0x3A881009, 0x3A891009, 0x3A8A1009, 0x3A8B1009, 0x3A8C1009,
+            0x3A8D1009, 0x3A8E1009, 0x3A8F1009, 0x3A901009, 0x3A911009, 0x3A921009,
+            0x3A931009, 0x3A941009, 0x3A951009, 0x3A961009,
+        },
+        {
+            0x3A971009, 0x3A981009, 0x3A991009, 0x3A9A1009, 0x3A9B1009, 0x3A9C1009,
+            0x3A9D1009, 0x3A9E1009, 0x3A9F1009, 0x3AA01009, 0x3AA11009, 0x3AA21009,
+            0x3AA31009, 0x3AA41009, 0x3AA51009, 0x3AA61009,
+        },
+        {
+            0x3AA71009, 0x3AA81009, 0x3AA91009, 0x3AAA1009, 0x3AAB1009, 0x3AAC1009,
+            0x3AAD1009, 0x3AAE1009, 0x3AAF1009, 0x3AB01009, 0x3AB11009, 0x3AB21009,
+            0x3AB31009, 0x3AB41009, 0x3AB51009, 0x3AB61009,
+        },
+        {
+            0x3AB71009, 0x3AB81009, 0x3AB91009, 0x3ABA1009, 0x3ABB1009, 0x3ABC1009,
+            0x3ABD1009, 0x3ABE1009, 0x3ABF1009, 0x3AC01009, 0x3AC11009, 0x3AC21009,
+            0x3AC31009, 0x3AC41009, 0x3AC51009, 0x3AC61009,
+        },
+        {
+            0x3AC71009, 0x3AC81009, 0x3AC91009, 0x3ACA1009, 0x3ACB1009, 0x3ACC1009,
+            0x3ACD1009, 0x3ACE1009, 0x3ACF1009, 0x3AD01009, 0x3AD11009, 0x3AD21009,
+            0x3B051009, 0x3AD31009, 0x3AD51009, 0x3AD61009,
+        },
+        {
+            0x3AD71009, 0x3AD81009, 0x3AD91009, 0x3ADA1009, 0x3ADB1009, 0x3ADC1009,
+            0x3ADD1009, 0x3ADE1009, 0x3ADF1009, 0x3AE01009, 0x3AE11009, 0x3AE21009,
+            0x3AE31009, 0x3AE41009, 0x3AE61009, 0x3AE71009,
+        },
+        {
+            0x3AE81009, 0x3AE91009, 0x3AEA1009, 0x3AEB1009, 0x3AEC1009, 0x3AED1009,
+            0x3AF41009, 0x3AF51009, 0x3AF61009, 0x3AF71009, 0x3AF81009, 0x3AF91009,
+            0x3AFA1009, 0x3AFB1009, 0x3AFC1009, 0x3AFD1009,
+        },
+        {
+            0x3AFE1009, 0x3AFF1009, 0x3B001009, 0x3B011009, 0x3B021009, 0x3B031009,
+            0x3B041009, 0x3B061009, 0x3B071009, 0x3B081009, 0x3B091009, 0x3B0A1009,
+            0x3B0B1009, 0x3B0C1009, 0x3B0D1009, 0x3B0E1009,
+        },
+        {
+            0x3B0F1009, 0x3B101009, 0x3B111009, 0x3B121009, 0x3B131009, 0x3B141009,
+            0x3B151009, 0x3B161009, 0x3B171009, 0x3B181009, 0x3B191009, 0x3B1A1009,
+            0x3B1B1009, 0x3B1C1009, 0x3B1D1009, 0x3B1E1009,
+        },
+        {
+            0x3B1F1009, 0x3B201009, 0x3B211009, 0x3B221009, 0x3B231009, 0x3B241009,
+            0x3B251009, 0x3B261009, 0x3B271009, 0x3B281009, 0x3B291009, 0x3B2A1009,
+            0x3B2B1009, 0x3B2C1009, 0x3B2D1009, 0x3B2E1009,
+        },
+        {
+            0x3B2F1009, 0x3B301009, 0x3B311009, 0x3B321009, 0x3B331009, 0x3B341009,
+            0x3B351009, 0x3B361009, 0x3B371009, 0x3B381009, 0x3B391009, 0x3B3A1009,
+            0x3B3B1009, 0x3B3C1009, 0x3B3D1009, 0x3B3E1009,
+        },
+        {
+            0x3B3F1009, 0x3B401009, 0x3B411009, 0x3B421009, 0x3B431009, 0x3B441009,
+            0x3B451009, 0x3B461009, 0x3B471009, 0x3B481009, 0x3B491009, 0x3B4A1009,
+            0x3B4B1009, 0x3B4C1009, 0x3B4D1009, 0x3B4E1009,
+        },
+        {
+            0x3B4F1009, 0x3B501009, 0x3B511009, 0x3B521009, 0x3B531009, 0x3B541009,
+            0x3B551009, 0x3B561009, 0x3B571009, 0x3B581009, 0x3B591009, 0x3B5A1009,
+            0x3B5B1009, 0x3B5C1009, 0x3B5D1009, 0x3B5E1009,
+        },
+        {
+            0x3B5F1009, 0x3B601009, 0x3B611009, 0x3B621009, 0x3B631009, 0x3B641009,
+            0x3B651009, 0x3B661009, 0x3B671009, 0x3B681009, 0x3B691009, 0x3B6A1009,
+            0x3B6B1009, 0x3B6C1009, 0x3B6D1009, 0x3B6E1009,
+        },
+        {
+            0x3B6F1009, 0x3B701009, 0x3B711009, 0x3B721009, 0x3B731009, 0x3B741009,
+            0x3B751009, 0x3B761009, 0x3B771009, 0x3B781009, 0x3B791009, 0x3B7A1009,
+            0x3B7B1009, 0x3B7C1009, 0x3B7D1009, 0x3B7E1009,
+        },
+        {
+            0x3B7F1009, 0x3B801009, 0x3B811009, 0x3B821009, 0x3B831009, 0x3B841009,
+            0x3B851009, 0x3B861009, 0x3B871009, 0x3B881009, 0x3B891009, 0x3B8A1009,
+            0x3B8B1009, 0x3B8C1009, 0x3B8D1009, 0x3B8E1009,
+        },
+        {
+            0x3B8F1009, 0x3B901009, 0x3B911009, 0x3B921009, 0x3B931009, 0x3B941009,
+            0x3B951009, 0x3B961009, 0x3B971009, 0x3B981009, 0x3B991009, 0x3B9A1009,
+            0x3B9B1009, 0x3B9C1009, 0x3B9D1009, 0x3B9E1009,
+        },
+        {
+            0x3B9F1009, 0x3BA01009, 0x3BA11009, 0x3BA21009, 0x3BA31009, 0x3BA41009,
+            0x3BA51009, 0x3BA61009, 0x3BA71009, 0x3BA81009, 0x3BA91009, 0x3BAA1009,
+            0x3BAB1009, 0x3BAC1009, 0x3BAD1009, 0x3BAE1009,
+        },
+        {
+            0x3BAF1009, 0x3BB01009, 0x3BB11009, 0x3BB21009, 0x3BB31009, 0x3BB41009,
+            0x3BB51009, 0x3BB61009, 0x3BB71009, 0x3BB81009, 0x3BB91009, 0x3BBA1009,
+            0x3BBB1009, 0x3BBC1009, 0x3BBD1009, 0x3BBE1009,
+        },
+        {
+            0x3BBF1009, 0x3BC01009, 0x3BC11009, 0x3BC21009, 0x3BC31009, 0x3BC41009,
+            0x3BC51009, 0x3BC61009, 0x3BC71009, 0x3BC81009, 0x3BC91009, 0x3BCA1009,
+            0x3BCB1009, 0x05971009, 0x02861009, 0x3AD41009,
+        },
+        {
+            0x3AE51009, 0x3AEE1009, 0x3AEF1009, 0x3AF01009, 0x3AF11009, 0x3AF21009,
+            0x3AF31009, 0x3BCC1009, 0x3BCD1009, 0x3BCE1009, 0x3BCF1009, 0x3BD01009,
+            0x3BD11009, 0x3BD21009, 0x3BD31009, 0x3BD41009,
+        },
+        {
+            0x02091011, 0x3C1B1009, 0x3C1C1009, 0x3C1D1009, 0x3C1E1009, 0x3C1F1009,
+            0x3C201009, 0x3C211009, 0x3C221009, 0x3C231009, 0x3C241009, 0x3C251009,
+            0x3C261009, 0x3C271009, 0x3C281009, 0x3C291009,
+        },
+        {
+            0x3C2A1009, 0x3C2B1009, 0x3C2C1009, 0x3C2D1009, 0x3C2E1009, 0x3C2F1009,
+            0x3C301009, 0x3C311009, 0x3C321009, 0x3C331009, 0x3C341009, 0x03321009,
+            0x03331009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x3C351009, 0x00030C0A, 0x3C361009, 0x3C5A1009, 0x0003140A, 0x00031C0A,
+            0x3C371009, 0x0003240A, 0x3C381009, 0x00032C0A, 0x3C561009, 0x3C581009,
+            0x0003340A, 0x00033C0A, 0x0003440A, 0x3C3A1009,
+        },
+        {
+            0x3C3B1009, 0x3C3C1009, 0x3C3D1009, 0x00034C0A, 0x0003540A, 0x00035C0A,
+            0x0003640A, 0x3C3F1009, 0x3C5D1009, 0x3C401009, 0x3C411009, 0x00036C0A,
+            0x0003740A, 0x00037C0A, 0x3C421009, 0x0003840A,
+        },
+        {
+            0x00038C0A, 0x3C431009, 0x0003940A, 0x3C451009, 0x00039C0A, 0x3C461009,
+            0x0003A40A, 0x3C471009, 0x3C481009, 0x3C491009, 0x3C4A1009, 0x0003AC0A,
+            0x0003B40A, 0x0003BC0A, 0x0003C40A, 0x3C4C1009,
+        },
+        {
+            0x0003CC0A, 0x0003D40A, 0x3C4D1009, 0x0003DC0A, 0x0003E40A, 0x0003EC0A,
+            0x3C4E1009, 0x3C501009, 0x0003F40A, 0x0003FC0A, 0x3C511009, 0x0004040A,
+            0x3C521009, 0x00040C0A, 0x3C531009, 0x3C541009,
+        },
+        {
+            0x3C5B1009, 0x3C5F1009, 0x3C601009, 0x3C5C1009, 0x3C5E1009, 0x3C611009,
+            0x3C621009, 0x0004140A, 0x00041C0A, 0x0004240A, 0x00042C0A, 0x02631009,
+            0x02641009, 0x02651009, 0x0004340A, 0x00043C12,
+        },
+        {
+            0x00044C0A, 0x3C3E1009, 0x3C4B1009, 0x3C551009, 0x3C391009, 0x3C441009,
+            0x3C4F1009, 0x3C571009, 0x3C591009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x34861009, 0x34871009, 0x34881009, 0x34891009, 0x348A1009, 0x348B1009,
+            0x348C1009, 0x348D1009, 0x348E1009, 0x348F1009, 0x34901009, 0x34911009,
+            0x34921009, 0x00000000, 0x34931009, 0x34941009,
+        },
+        {
+            0x34951009, 0x34961009, 0x34971009, 0x34981009, 0x34991009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x349A1009, 0x349B1009, 0x349C1009, 0x349D1009, 0x349E1009, 0x349F1009,
+            0x34A01009, 0x34A11009, 0x34A21009, 0x34A31009, 0x34A41009, 0x34A51009,
+            0x34A61009, 0x34A71009, 0x34A81009, 0x34A91009,
+        },
+        {
+            0x34AA1009, 0x34AB1009, 0x34AC1009, 0x34AD1009, 0x34AE1009, 0x029E1009,
+            0x029F1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x34AF1009, 0x34B01009, 0x34B11009, 0x34B21009, 0x34B31009, 0x34B41009,
+            0x34B51009, 0x34B61009, 0x34B71009, 0x34B81009, 0x34B91009, 0x34BA1009,
+            0x34BB1009, 0x34BC1009, 0x34BD1009, 0x34BE1009,
+        },
+        {
+            0x34BF1009, 0x34C01009, 0x34C11009, 0x34C21009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x34C31009, 0x34C41009, 0x34C51009, 0x34C61009, 0x34C71009, 0x34C81009,
+            0x34C91009, 0x34CA1009, 0x34CB1009, 0x34CC1009, 0x34CD1009, 0x34CE1009,
+            0x34CF1009, 0x00000000, 0x34D01009, 0x34D11009,
+        },
+        {
+            0x34D21009, 0x00000000, 0x34D31009, 0x34D41009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x36751009, 0x36761009, 0x36771009, 0x36781009, 0x36791009, 0x367A1009,
+            0x367B1009, 0x367C1009, 0x367D1009, 0x367E1009, 0x367F1009, 0x36801009,
+            0x36811009, 0x36821009, 0x36831009, 0x36841009,
+        },
+        {
+            0x36851009, 0x36861009, 0x36871009, 0x36881009, 0x36891009, 0x368A1009,
+            0x368B1009, 0x368C1009, 0x368D1009, 0x368E1009, 0x368F1009, 0x36901009,
+            0x36911009, 0x36921009, 0x36931009, 0x36941009,
+        },
+        {
+            0x36951009, 0x36961009, 0x36971009, 0x36991009, 0x369A1009, 0x369B1009,
+            0x369C1009, 0x369D1009, 0x369E1009, 0x369F1009, 0x36A01009, 0x36A11009,
+            0x36A21009, 0x36A31009, 0x36A41009, 0x36A51009,
+        },
+        {
+            0x36A61009, 0x36A71009, 0x36A81009, 0x36A91009, 0x00000001, 0x00000001,
+            0x36AA1009, 0x36AB1009, 0x36AC1009, 0x36AD1009, 0x36AE1009, 0x36AF1009,
+            0x36B01009, 0x36B11009, 0x36B21009, 0x36B31009,
+        },
+        {
+            0x36B41009, 0x36B51009, 0x36B61009, 0x36B71009, 0x36B81009, 0x36B91009,
+            0x00006209, 0x00006289, 0x00007409, 0x00007489, 0x00007509, 0x00001989,
+            0x00001989, 0x00001989, 0x00001989, 0x00001989,
+        },
+        {
+            0x00001989, 0x00001989, 0x36BA1009, 0x00000001, 0x02A31009, 0x02A41009,
+            0x02601009, 0x1F4B1009, 0x043F1009, 0x04401009, 0x04411009, 0x1F761009,
+            0x36981009, 0x00001989, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x03F21009, 0x027F1009, 0x02301009, 0x02841009, 0x025D1009, 0x025E1009,
+            0x02111009, 0x02121009, 0x02311009, 0x02851009, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000000,
+        },
+        {
+            0x383E1009, 0x38401009, 0x38431009, 0x38491009, 0x384B1009, 0x384E1009,
+            0x38501009, 0x38531009, 0x38541009, 0x38551009, 0x385A1009, 0x385C1009,
+            0x385F1009, 0x38611009, 0x38661009, 0x38681009,
+        },
+        {
+            0x38691009, 0x386A1009, 0x38711009, 0x38741009, 0x38771009, 0x387D1009,
+            0x38811009, 0x38841009, 0x38861009, 0x38881009, 0x388B1009, 0x38901009,
+            0x38911009, 0x38941009, 0x38981009, 0x389B1009,
+        },
+        {
+            0x389C1009, 0x389D1009, 0x389E1009, 0x383D1009, 0x38411009, 0x38441009,
+            0x384A1009, 0x384C1009, 0x384F1009, 0x38511009, 0x38561009, 0x385B1009,
+            0x385D1009, 0x38601009, 0x38621009, 0x38671009,
+        },
+        {
+            0x38721009, 0x38751009, 0x38781009, 0x387E1009, 0x38921009, 0x38821009,
+            0x38871009, 0x388C1009, 0x38961009, 0x38991009, 0x389F1009, 0x38A01009,
+            0x387B1009, 0x38421009, 0x38451009, 0x38481009,
+        },
+        {
+            0x38521009, 0x384D1009, 0x38571009, 0x388D1009, 0x38631009, 0x38651009,
+            0x385E1009, 0x386B1009, 0x38731009, 0x38761009, 0x387F1009, 0x38891009,
+            0x38971009, 0x389A1009, 0x38931009, 0x38951009,
+        },
+        {
+            0x38A11009, 0x38791009, 0x38831009, 0x38461009, 0x388E1009, 0x38851009,
+            0x388A1009, 0x38801009, 0x387A1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x38361009, 0x38371009, 0x38381009, 0x38391009, 0x383A1009, 0x383B1009,
+            0x383C1009, 0x383F1009, 0x38471009, 0x388F1009, 0x38581009, 0x387C1009,
+            0x38A21009, 0x38A41009, 0x38A51009, 0x38A71009,
+        },
+        {
+            0x38A81009, 0x38AB1009, 0x38AD1009, 0x38AE1009, 0x38B01009, 0x38B21009,
+            0x38B41009, 0x38B51009, 0x38A91009, 0x38B31009, 0x38641009, 0x38591009,
+            0x386C1009, 0x386D1009, 0x38A31009, 0x38A61009,
+        },
+        {
+            0x38AA1009, 0x38AC1009, 0x386E1009, 0x38B11009, 0x386F1009, 0x38701009,
+            0x38B61009, 0x38B71009, 0x38AF1009, 0x38B91009, 0x38B81009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x3BD51009, 0x3BD61009, 0x3BD71009, 0x3BD81009, 0x3BD91009, 0x3BDA1009,
+            0x3BDB1009, 0x3BDC1009, 0x3BDD1009, 0x3BDE1009, 0x3BDF1009, 0x3BE01009,
+            0x3BE11009, 0x3BE21009, 0x3BE31009, 0x3BE41009,
+        },
+        {
+            0x3BE51009, 0x3BE61009, 0x3BE71009, 0x3BE81009, 0x3BE91009, 0x3BEA1009,
+            0x3BEB1009, 0x3BEC1009, 0x3BED1009, 0x3BEE1009, 0x3BEF1009, 0x3BF01009,
+            0x3BF11009, 0x3BF21009, 0x3BF31009, 0x3BF41009,
+        },
+        {
+            0x3BF51009, 0x3BF61009, 0x3BF71009, 0x3BF81009, 0x3BF91009, 0x3BFA1009,
+            0x3BFB1009, 0x3BFC1009, 0x3BFD1009, 0x3BFE1009, 0x3BFF1009, 0x3C001009,
+            0x3C011009, 0x3C021009, 0x3C031009, 0x3C041009,
+        },
+        {
+            0x3C051009, 0x3C061009, 0x3C071009, 0x3C081009, 0x3C091009, 0x3C0A1009,
+            0x3C0B1009, 0x3C0C1009, 0x3C0D1009, 0x3C0E1009, 0x3C0F1009, 0x3C101009,
+            0x3C111009, 0x3C121009, 0x3C131009, 0x3C141009,
+        },
+        {
+            0x3C151009, 0x3C161009, 0x3C171009, 0x3C181009, 0x3C191009, 0x3C1A1009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x34541009, 0x34551009, 0x34561009, 0x34571009, 0x34581009, 0x34591009,
+            0x345A1009, 0x345B1009, 0x345C1009, 0x345D1009, 0x345E1009, 0x345F1009,
+            0x34601009, 0x34611009, 0x34621009, 0x34631009,
+        },
+        {
+            0x34641009, 0x34651009, 0x34661009, 0x34671009, 0x34681009, 0x34691009,
+            0x346A1009, 0x346B1009, 0x346C1009, 0x346D1009, 0x346E1009, 0x346F1009,
+            0x34701009, 0x0004540A, 0x00045C0A, 0x00000000,
+        },
+        {
+            0x34711009, 0x34721009, 0x34731009, 0x34741009, 0x34751009, 0x34761009,
+            0x34771009, 0x34781009, 0x34791009, 0x347A1009, 0x347B1009, 0x347C1009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x347D1009, 0x347E1009, 0x347F1009, 0x34801009, 0x34811009, 0x34821009,
+            0x34831009, 0x34841009, 0x34851009, 0x00007989, 0x00007A09, 0x00007A89,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x05981009, 0x00000000, 0x00000000, 0x00000000, 0x026B1009, 0x02741009,
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x36BB1009, 0x36BC1009, 0x36BD1009, 0x36BE1009, 0x36BF1009, 0x36C01009,
+            0x36C11009, 0x36C21009, 0x36C31009, 0x36C41009, 0x36C51009, 0x36C61009,
+            0x36C71009, 0x36C81009, 0x36C91009, 0x36CA1009,
+        },
+        {
+            0x36CB1009, 0x36CC1009, 0x36CD1009, 0x36CE1009, 0x36CF1009, 0x36D01009,
+            0x36D11009, 0x36D21009, 0x36D31009, 0x36D41009, 0x36D51009, 0x36D61009,
+            0x36D71009, 0x36D81009, 0x00000000, 0x00000000,
+        },
+        {
+            0x36D91009, 0x36DA1009, 0x36DB1009, 0x36DC1009, 0x36DD1009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x36DE1009, 0x36DF1009, 0x36E01009, 0x36E11009, 0x36E21009, 0x36E31009,
+            0x36E41009, 0x36E51009, 0x36E61009, 0x36E71009, 0x36E81009, 0x36E91009,
+            0x36EA1009, 0x36EB1009, 0x36EC1009, 0x36ED1009,
+        },
+        {
+            0x36EE1009, 0x36EF1009, 0x36F01009, 0x36F11009, 0x36F21009, 0x36F31009,
+            0x36F41009, 0x36F51009, 0x36F61009, 0x36F71009, 0x36F81009, 0x36F91009,
+            0x36FA1009, 0x36FB1009, 0x36FC1009, 0x36FD1009,
+        },
+        {
+            0x36FE1009, 0x36FF1009, 0x37001009, 0x37011009, 0x37021009, 0x37031009,
+            0x37041009, 0x37051009, 0x37061009, 0x37071009, 0x37081009, 0x37091009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x370A1009, 0x370B1009, 0x370C1009, 0x370D1009, 0x370E1009, 0x0000008B,
+            0x0000008F, 0x00000093, 0x37121009, 0x37131009, 0x00000097, 0x37151009,
+            0x37161009, 0x37171009, 0x37181009, 0x37191009,
+        },
+        {
+            0x371A1009, 0x371B1009, 0x371C1009, 0x371D1009, 0x371E1009, 0x371F1009,
+            0x37201009, 0x37211009, 0x37221009, 0x37231009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1F991009, 0x00000000,
+            0x00000000, 0x00000000, 0x0004640A, 0x00046C0E,
+        },
+        {
+            0x059F1009, 0x05A01009, 0x05A11009, 0x05A21009, 0x05A31009, 0x05A41009,
+            0x05A51009, 0x05A61009, 0x05A71009, 0x05A81009, 0x05A91009, 0x05AA1009,
+            0x05AB1009, 0x05AC1009, 0x05AD1009, 0x05AE1009,
+        },
+        {
+            0x05AF1009, 0x05B01009, 0x05B11009, 0x05B21009, 0x05B31009, 0x05B41009,
+            0x05B51009, 0x05B61009, 0x05B71009, 0x05B81009, 0x05B91009, 0x05BA1009,
+            0x05BB1009, 0x05BC1009, 0x05BD1009, 0x05BE1009,
+        },
+        {
+            0x34D51009, 0x34D61009, 0x34D71009, 0x34D81009, 0x34D91009, 0x34DA1009,
+            0x34DB1009, 0x34DC1009, 0x34DD1009, 0x34DE1009, 0x34DF1009, 0x34E01009,
+            0x34E11009, 0x34E21009, 0x34E31009, 0x34E41009,
+        },
+        {
+            0x34E51009, 0x34E61009, 0x34E71009, 0x34E81009, 0x34E91009, 0x34EA1009,
+            0x34EB1009, 0x34EC1009, 0x34ED1009, 0x34EE1009, 0x34EF1009, 0x34F01009,
+            0x00000000, 0x00000000, 0x02D21009, 0x02D31009,
+        },
+        {
+            0x37241009, 0x37251009, 0x37261009, 0x37271009, 0x37281009, 0x37291009,
+            0x372A1009, 0x372B1009, 0x372C1009, 0x372D1009, 0x372E1009, 0x372F1009,
+            0x37301009, 0x37311009, 0x37321009, 0x37331009,
+        },
+        {
+            0x37341009, 0x37351009, 0x37361009, 0x37371009, 0x37381009, 0x37391009,
+            0x373A1009, 0x373B1009, 0x373C1009, 0x373D1009, 0x373E1009, 0x373F1009,
+            0x37401009, 0x37411009, 0x37421009, 0x37431009,
+        },
+        {
+            0x37441009, 0x37451009, 0x37461009, 0x37471009, 0x37481009, 0x37491009,
+            0x374A1009, 0x374B1009, 0x374C1009, 0x374D1009, 0x374E1009, 0x374F1009,
+            0x37501009, 0x37591009, 0x375A1009, 0x375B1009,
+        },
+        {
+            0x375C1009, 0x375D1009, 0x375E1009, 0x37511009, 0x0004780E, 0x37531009,
+            0x37541009, 0x37551009, 0x372A1011, 0x372A1011, 0x373F1011, 0x373F1011,
+            0x37561009, 0x37571009, 0x37581009, 0x00000000,
+        },
+        {
+            0x37701009, 0x375F1009, 0x37611009, 0x37621009, 0x37621011, 0x37631009,
+            0x37641009, 0x37651009, 0x37661009, 0x37671009, 0x37681009, 0x37521009,
+            0x37601009, 0x376F1009, 0x37691009, 0x376A1009,
+        },
+        {
+            0x376C1009, 0x376D1009, 0x376E1009, 0x376B1009, 0x00006209, 0x00007589,
+            0x00007609, 0x00007689, 0x00007709, 0x00007789, 0x00007809, 0x00007889,
+            0x00007909, 0x00000000, 0x00000000, 0x00000001,
+        },
+        {
+            0x04421009, 0x04431009, 0x04441009, 0x04451009, 0x04461009, 0x04471009,
+            0x04481009, 0x1F4C1009, 0x02A51009, 0x02A61009, 0x02A71009, 0x02A81009,
+            0x04491009, 0x044A1009, 0x00000000, 0x00000000,
+        },
+        {
+            0x00001989, 0x00001989, 0x00001989, 0x00001989, 0x00001989, 0x00001A09,
+            0x00001A09, 0x00001A09, 0x00001A09, 0x00001A09, 0x00001A09, 0x00001989,
+            0x00001989, 0x00001A09, 0x00001B09, 0x22591011,
+        },
+        {
+            0x22601011, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00006189, 0x00006189, 0x00006209, 0x00006489, 0x00006289, 0x0000009B,
+            0x00000000, 0x0000009F, 0x00000000, 0x000000A3, 0x00000000, 0x000000A7,
+            0x00000000, 0x000000AB, 0x00000000, 0x37C01009,
+        },
+        {
+            0x37C11009, 0x000000AF, 0x00000000, 0x37C41009, 0x37C71009, 0x37C81009,
+            0x37C91009, 0x37CA1009, 0x37CB1009, 0x37CC1009, 0x37CD1009, 0x37CE1009,
+            0x37CF1009, 0x37D01009, 0x37D11009, 0x37D21009,
+        },
+        {
+            0x37D31009, 0x37D41009, 0x37D51009, 0x37D71009, 0x37D81009, 0x37D91009,
+            0x37DA1009, 0x37DB1009, 0x37DD1009, 0x37DE1009, 0x37DF1009, 0x37E01009,
+            0x37E11009, 0x37E21009, 0x37E31009, 0x37E41009,
+        },
+        {
+            0x37E61009, 0x37E71009, 0x37E81009, 0x37EB1009, 0x00006109, 0x37EC1009,
+            0x37ED1009, 0x37EE1009, 0x37EF1009, 0x37F01009, 0x000000B3, 0x00000000,
+            0x000000B7, 0x00000000, 0x000000BB, 0x000000BF,
+        },
+        {
+            0x00000000, 0x00000000, 0x000000C3, 0x00000000, 0x37FB1009, 0x37C51009,
+            0x37C61009, 0x37D61009, 0x37DC1009, 0x37E51009, 0x37E91009, 0x37EA1009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x02D41009, 0x02D51009,
+            0x02871009, 0x02611009, 0x02A91009, 0x02AA1009,
+        },
+        {
+            0x02101009, 0x05BF1009, 0x05C01009, 0x05C11009, 0x05C21009, 0x05C31009,
+            0x05C41009, 0x05C51009, 0x05C61009, 0x05C71009, 0x05C81009, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x05C91009, 0x05CA1009,
+            0x05CB1009, 0x05CC1009, 0x05CD1009, 0x05CE1009, 0x05CF1009, 0x05D01009,
+            0x05D11009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00006209, 0x00006589, 0x00006289, 0x313A1009, 0x313B1009, 0x313C1009,
+            0x313D1009, 0x313E1009, 0x313F1009, 0x31401009, 0x31411009, 0x31431009,
+            0x31441009, 0x31451009, 0x31461009, 0x31471009,
+        },
+        {
+            0x31481009, 0x31491009, 0x314A1009, 0x314B1009, 0x314C1009, 0x314D1009,
+            0x314E1009, 0x314F1009, 0x31501009, 0x31521009, 0x31541009, 0x31561009,
+            0x31591009, 0x315C1009, 0x315E1009, 0x315F1009,
+        },
+        {
+            0x31611009, 0x31551009, 0x31571009, 0x315A1009, 0x31621009, 0x31631009,
+            0x31641009, 0x31651009, 0x31661009, 0x31671009, 0x31681009, 0x31691009,
+            0x31531009, 0x315D1009, 0x31421009, 0x31601009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x313A1011, 0x31581009,
+            0x315B1009, 0x31511009, 0x31411065, 0x31521065,
+        },
+        {
+            0x35081009, 0x35081011, 0x35091009, 0x35091011, 0x35091011, 0x350A1009,
+            0x350A1011, 0x350B1009, 0x350B1011, 0x350C1009, 0x350C1011, 0x350D1009,
+            0x350D1011, 0x350D1011, 0x350E1009, 0x350E1011,
+        },
+        {
+            0x350F1009, 0x35101009, 0x35111009, 0x35111011, 0x35121009, 0x35121011,
+            0x35131009, 0x35131011, 0x35141009, 0x35141011, 0x35141011, 0x35151009,
+            0x35151011, 0x35161009, 0x35171009, 0x35171011,
+        },
+        {
+            0x35181009, 0x35191009, 0x351A1009, 0x351B1009, 0x351C1009, 0x351D1009,
+            0x00006109, 0x351E1009, 0x351E1011, 0x351F1009, 0x35201009, 0x35201011,
+            0x35211009, 0x35211011, 0x35221009, 0x35221011,
+        },
+        {
+            0x35231009, 0x35241009, 0x35251009, 0x35261009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x04561009, 0x04571009, 0x04581009, 0x04591009,
+        },
+        {
+            0x33E61009, 0x33E71009, 0x33E81009, 0x33E91009, 0x33EA1009, 0x33EB1009,
+            0x33EC1009, 0x33ED1009, 0x33EE1009, 0x33EF1009, 0x33F31009, 0x33F41009,
+            0x33F51009, 0x33F61009, 0x33F71009, 0x33F81009,
+        },
+        {
+            0x33F91009, 0x33FA1009, 0x33FB1009, 0x33FC1009, 0x33FD1009, 0x33FE1009,
+            0x33FF1009, 0x34001009, 0x34011009, 0x34021009, 0x34031009, 0x34051009,
+            0x34071009, 0x34081009, 0x34091009, 0x340A1009,
+        },
+        {
+            0x340B1009, 0x340C1009, 0x340D1009, 0x340E1009, 0x34041009, 0x34061009,
+            0x34101009, 0x34111009, 0x34121009, 0x34131009, 0x34141009, 0x34151009,
+            0x34161009, 0x34171009, 0x34181009, 0x34191009,
+        },
+        {
+            0x341A1009, 0x341B1009, 0x341C1009, 0x341D1009, 0x341E1009, 0x341F1009,
+            0x340F1009, 0x00006109, 0x00000000, 0x00000000, 0x00000000, 0x029A1009,
+            0x029B1009, 0x04381009, 0x04391009, 0x043A1009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00000000, 0x00000000,
+            0x00000000, 0x33F01009, 0x33F11009, 0x33F21009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x38BA1009, 0x38BB1009,
+            0x38BC1009, 0x38BD1009, 0x38BE1009, 0x38BF1009,
+        },
+        {
+            0x38C01009, 0x38C11009, 0x38C21009, 0x38C31009, 0x38C41009, 0x38C51009,
+            0x38C61009, 0x38C71009, 0x38C81009, 0x38C91009, 0x38CA1009, 0x38CB1009,
+            0x38CC1009, 0x38CD1009, 0x38CE1009, 0x38CF1009,
+        },
+        {
+            0x38D01009, 0x38D11009, 0x38D21009, 0x38D31009, 0x38D41009, 0x38D51009,
+            0x38D61009, 0x38D71009, 0x38D81009, 0x38D91009, 0x38DA1009, 0x38DB1009,
+            0x38DC1009, 0x38DD1009, 0x02CB1009, 0x02CC1009,
+        },
+        {
+            0x23971011, 0x23AF1011, 0x244C1011, 0x246A1011, 0x24731011, 0x24731011,
+            0x24F41011, 0x25051011, 0x248E1011, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x259F1021, 0x25A11021, 0x25A31021, 0x25A51021, 0x25A71021, 0x25A91021,
+            0x25AB1021, 0x25AF1021, 0x25B11021, 0x25B31021, 0x25B51021, 0x25B71021,
+            0x25B91021, 0x25BD1021, 0x25BF1021, 0x25C11021,
+        },
+        {
+            0x25C31021, 0x25C51021, 0x25C71021, 0x25CB1021, 0x25CD1021, 0x25CF1021,
+            0x25D11021, 0x25D31021, 0x25D51021, 0x25D71021, 0x25D91021, 0x25DB1021,
+            0x25DD1021, 0x25DF1021, 0x25E11021, 0x25E51021,
+        },
+        {
+            0x25E71021, 0x25AD1021, 0x25BB1021, 0x25C91021, 0x25E31021, 0x25E91021,
+            0x25EB1021, 0x25EC1021, 0x25EE1021, 0x25EF1021, 0x25F01021, 0x00000000,
+            0x00000000, 0x25F11021, 0x25F31021, 0x25F41021,
+        },
+        {
+            0x044B1009, 0x044C1009, 0x044D1009, 0x044E1009, 0x044F1009, 0x04501009,
+            0x04511009, 0x04521009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x2A1E1009, 0x2A1E1011, 0x2A1E1011,
+            0x2A1E1011, 0x00006209, 0x2A1E1011, 0x2A1E1011,
+        },
+        {
+            0x2A1E1011, 0x2A1E1011, 0x00006289, 0x00006289, 0x00000001, 0x2A1F1009,
+            0x2A201009, 0x00000001, 0x00000001, 0x00000001, 0x2A1E1011, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1FA61009, 0x1FAA1009, 0x1FAB1009, 0x1FC91009, 0x1FDA1009, 0x1FEF1009,
+            0x1FF01009, 0x200B1009, 0x20311009, 0x209E1009, 0x20B31009, 0x20C81009,
+            0x20DF1009, 0x210D1009, 0x21211009, 0x21401009,
+        },
+        {
+            0x21531009, 0x21411009, 0x21541009, 0x214D1009, 0x21471009, 0x216A1009,
+            0x21591009, 0x215A1009, 0x216F1009, 0x219E1009, 0x21A81009, 0x21FB1009,
+            0x221B1009, 0x221D1009, 0x221E1009, 0x223D1009,
+        },
+        {
+            0x224B1009, 0x225D1009, 0x228A1009, 0x22A71009, 0x22EF1009, 0x22F01009,
+            0x23211009, 0x232F1009, 0x23351009, 0x233A1009, 0x23451009, 0x24191009,
+            0x1FA21075, 0x0004840E, 0x1FBC1075, 0x1FC81009,
+        },
+        {
+            0x1FEB1075, 0x20071075, 0x20151075, 0x20511075, 0x20751075, 0x20901075,
+            0x20AB1075, 0x20C41075, 0x20D61075, 0x21091075, 0x21181075, 0x21201009,
+            0x213C1075, 0x21661075, 0x216B1075, 0x21931075,
+        },
+        {
+            0x21F71075, 0x22171075, 0x22591075, 0x1FA21051, 0x1FAD1051, 0x1FB11051,
+            0x1FAB1051, 0x1FBC1051, 0x1FEB1051, 0x20071051, 0x201A1051, 0x201F1051,
+            0x20311051, 0x20511051, 0x209E1051, 0x20C41051,
+        },
+        {
+            0x21091051, 0x21371051, 0x213C1051, 0x214F1051, 0x21591051, 0x215A1051,
+            0x216B1051, 0x21F71051, 0x22171051, 0x221D1051, 0x22381051, 0x22471051,
+            0x22F01051, 0x231F1051, 0x23201051, 0x23221051,
+        },
+        {
+            0x23421051, 0x23431051, 0x20901055, 0x21931055, 0x22171055, 0x22471055,
+            0x231F1055, 0x23201055, 0x23391055, 0x23421055, 0x23431055, 0x221F1009,
+            0x1FCA1009, 0x1FF21009, 0x20491009, 0x210E1009,
+        },
+        {
+            0x21221009, 0x21721009, 0x21A31009, 0x21C01009, 0x21D81009, 0x22011009,
+            0x228F1009, 0x206B1009, 0x24311051, 0x0004900A, 0x0004980E, 0x20A31009,
+            0x20AA1009, 0x21701009, 0x22281009, 0x22461009,
+        },
+        {
+            0x1FCC1009, 0x1FF31009, 0x204A1009, 0x20621009, 0x20C91009, 0x20F11009,
+            0x210F1009, 0x212C1009, 0x21731009, 0x21AD1009, 0x21D91009, 0x21E91009,
+            0x224D1009, 0x22681009, 0x22901009, 0x1FA81009,
+        },
+        {
+            0x1FB61009, 0x1FFC1009, 0x20121009, 0x20231009, 0x20301009, 0x201E1009,
+            0x20A41009, 0x21561009, 0x21F21009, 0x22291009, 0x22AC1009, 0x1FB71051,
+            0x1FD61051, 0x1FE51051, 0x0004A40A, 0x202C1051,
+        },
+        {
+            0x20421051, 0x20BC1051, 0x20551051, 0x222C1051, 0x209F1051, 0x20A61051,
+            0x20981051, 0x20A31051, 0x20B81051, 0x20F21051, 0x20F11051, 0x20DA1051,
+            0x21101051, 0x223E1051, 0x21231051, 0x212D1051,
+        },
+        {
+            0x211C1051, 0x215C1051, 0x217B1051, 0x21DA1051, 0x21E41051, 0x22021051,
+            0x22221051, 0x22421051, 0x221B1051, 0x224E1051, 0x22551051, 0x22861051,
+            0x22951051, 0x22991051, 0x22A31051, 0x232A1051,
+        },
+        {
+            0x00001989, 0x00001989, 0x00001A09, 0x00001989, 0x00001989, 0x00001989,
+            0x00001989, 0x00001989, 0x00001989, 0x00001989, 0x21931011, 0x00001989,
+            0x00001989, 0x00001989, 0x00001989, 0x00001A09,
+        },
+        {
+            0x00001A09, 0x00001989, 0x22C51011, 0x0004AC0A, 0x00004C0E, 0x0004B40A,
+            0x0004BC0A, 0x0004C40A, 0x0004CC0A, 0x0000580A, 0x20511011, 0x205A1011,
+            0x20C41011, 0x20D61011, 0x20DA1011, 0x210D1011,
+        },
+        {
+            0x21181011, 0x211C1011, 0x21981011, 0x219D1011, 0x21D21011, 0x0000D80A,
+            0x22861011, 0x1FB11011, 0x1FBC1011, 0x1FD51011, 0x201A1011, 0x20421011,
+            0x20EA1011, 0x0004D40A, 0x216B1011, 0x21E41011,
+        },
+        {
+            0x0004DC0A, 0x22591011, 0x0004E40A, 0x0004EC0A, 0x0004F40A, 0x00001989,
+            0x00001989, 0x00001989, 0x00001989, 0x00001A09, 0x00000000, 0x00001989,
+            0x00001A09, 0x00001A09, 0x00001989, 0x00001A09,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0004FC0A, 0x00000000,
+            0x21E21009, 0x21E31009, 0x0005040E, 0x20061009,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0005100A, 0x0005180A,
+            0x22541021, 0x22541009, 0x22801021, 0x22801009,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x04C01009, 0x00000000, 0x04C01009,
+        },
+        {
+            0x04C21009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x04C11009, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x02091011, 0x02091011, 0x02091011, 0x02091011,
+            0x02091011, 0x0209106D, 0x02091011, 0x02091011, 0x02091011, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        },
+        {
+            0x02131009, 0x0213106D, 0x02141009, 0x02151009, 0x02161009, 0x02171009,
+            0x03941009, 0x020C1009, 0x03171009, 0x03181009, 0x03191009, 0x031A1009,
+            0x031E1009, 0x031F1009, 0x03201009, 0x03211009,
+        },
+        {
+            0x03B31009, 0x03B41009, 0x03B91009, 0x03BA1009, 0x027E1011, 0x0005200A,
+            0x0005280E, 0x03BB1009, 0x02071009, 0x02081009, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x0209106D,
+        },
+        {
+            0x03AF1009, 0x03B11009, 0x03BF1009, 0x0005340A, 0x00053C0E, 0x03C01009,
+            0x0005480A, 0x0005500E, 0x03C31009, 0x031B1009, 0x031C1009, 0x03C41009,
+            0x00055C0A, 0x027C1009, 0x020A1009, 0x03C51009,
+        },
+        {
+            0x03C71009, 0x03C91009, 0x03CA1009, 0x03BC1009, 0x06761009, 0x03341009,
+            0x03351009, 0x0005640A, 0x00056C0A, 0x0005740A, 0x03AA1009, 0x039D1009,
+            0x03BD1009, 0x03BE1009, 0x03A21009, 0x023C1009,
+        },
+        {
+            0x03C81009, 0x03A31009, 0x06721009, 0x021A1009, 0x03C61009, 0x02F91009,
+            0x02FA1009, 0x00057C12, 0x02FB1009, 0x02FC1009, 0x02FD1009, 0x02FE1009,
+            0x02FF1009, 0x03001009, 0x03011009, 0x02091011,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000000,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        },
+        {
+            0x1F981051, 0x20901051, 0x00000000, 0x00000000, 0x1F9C1051, 0x1F9D1051,
+            0x1F9E1051, 0x1F9F1051, 0x1FA01051, 0x1FA11051, 0x06661051, 0x06711051,
+            0x066B1051, 0x03281051, 0x03291051, 0x21181051,
+        },
+        {
+            0x1F981055, 0x1F991055, 0x1F9A1055, 0x1F9B1055, 0x1F9C1055, 0x1F9D1055,
+            0x1F9E1055, 0x1F9F1055, 0x1FA01055, 0x1FA11055, 0x06661055, 0x06711055,
+            0x066B1055, 0x03281055, 0x03291055, 0x00000000,
+        },
+        {
+            0x1FA21055, 0x20071055, 0x213C1055, 0x22641055, 0x201A1055, 0x20751055,
+            0x20C41055, 0x20D61055, 0x21091055, 0x21181055, 0x216B1055, 0x21D21055,
+            0x21F71055, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F781009, 0x1F791009, 0x1F7A1009, 0x1F7B1009, 0x1F7C1009, 0x1F7D1009,
+            0x1F7E1009, 0x1F7F1009, 0x00058C0A, 0x1F801009, 0x1F811009, 0x1F821009,
+            0x1F831009, 0x1F841009, 0x1F851009, 0x1F861009,
+        },
+        {
+            0x1F871009, 0x1F881009, 0x1F891009, 0x1F8A1009, 0x1F8B1009, 0x1F8C1009,
+            0x1F8D1009, 0x1F8E1009, 0x1F8F1009, 0x1F901009, 0x1F921009, 0x1F931009,
+            0x1F941009, 0x1F951009, 0x1F961009, 0x1F971009,
+        },
+        {
+            0x00008489, 0x00008509, 0x00008589, 0x00008589, 0x00008609, 0x00008689,
+            0x00008709, 0x00008789, 0x00001A89, 0x00001A89, 0x00001A89, 0x00008809,
+            0x00008889, 0x00001B09, 0x00001B09, 0x00001B09,
+        },
+        {
+            0x00001B09, 0x00008909, 0x00001B09, 0x00001B09, 0x00001B09, 0x00001A89,
+            0x00008989, 0x00008A09, 0x00008A89, 0x00008B09, 0x00001A89, 0x00001A89,
+            0x00001A09, 0x00001A09, 0x00001A09, 0x00001A09,
+        },
+        {
+            0x00001989, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x0005940E, 0x0005A00E, 0x1FD6102D, 0x0005AC0A, 0x05D61009, 0x0005B40E,
+            0x0005C00E, 0x201F1029, 0x05D71009, 0x0005CC0A, 0x20511015, 0x2075102D,
+            0x2075102D, 0x2075102D, 0x20751015, 0x0000800A,
+        },
+        {
+            0x2090102D, 0x2090102D, 0x20D6102D, 0x20D61015, 0x05D81009, 0x2118102D,
+            0x0005D40A, 0x05D91009, 0x05DA1009, 0x216B102D, 0x2180102D, 0x2193102D,
+            0x2193102D, 0x2193102D, 0x05DB1009, 0x05DC1009,
+        },
+        {
+            0x0005DC0A, 0x0005E40E, 0x0005F00A, 0x05DD1009, 0x2286102D, 0x05DE1009,
+            0x00000000, 0x05DF1009, 0x2286102D, 0x05E01009, 0x00000000, 0x00000000,
+            0x1FBC102D, 0x1FD6102D, 0x05E11009, 0x20071015,
+        },
+        {
+            0x2007102D, 0x2042102D, 0x204F1021, 0x2109102D, 0x213C1015, 0x261E1011,
+            0x261F1011, 0x26201011, 0x26211011, 0x20901015, 0x05E21009, 0x0005F80E,
+            0x23341015, 0x23201015, 0x2320102D, 0x2334102D,
+        },
+        {
+            0x06651015, 0x05E31009, 0x05E41009, 0x05E51009, 0x05E61009, 0x1FEB102D,
+            0x1FEB1015, 0x20071015, 0x20901015, 0x20AB1015, 0x05E71009, 0x07011009,
+            0x05E81009, 0x0006040E, 0x204F1009, 0x05E91009,
+        },
+        {
+            0x0006100E, 0x00061C0E, 0x00062812, 0x0006380E, 0x0006440E, 0x0006500E,
+            0x00065C0E, 0x0006680E, 0x0006740E, 0x0006800E, 0x00068C0E, 0x0006980E,
+            0x0006A40E, 0x0006B00E, 0x0006BC0E, 0x0006C80A,
+        },
+        {
+            0x20901029, 0x0006D00A, 0x0006D80E, 0x0006E40A, 0x22471029, 0x0006EC0A,
+            0x0006F40E, 0x00070012, 0x0007100A, 0x22641029, 0x0007180A, 0x0007200E,
+            0x20D61029, 0x1FD61029, 0x1FEB1029, 0x21091029,
+        },
+        {
+            0x20901011, 0x00072C0A, 0x0007340E, 0x0007400A, 0x22471011, 0x0007480A,
+            0x0007500E, 0x00075C12, 0x00076C0A, 0x22641011, 0x0007740A, 0x00077C0E,
+            0x20D61011, 0x1FD61011, 0x1FEB1011, 0x21091011,
+        },
+        {
+            0x1D9B1009, 0x1D9C1009, 0x1D9D1009, 0x1FE91021, 0x1FE91009, 0x1F9E1009,
+            0x1D9E1009, 0x1D9F1009, 0x1DA01009, 0x0007880E, 0x05EA1009, 0x05EB1009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x05EC1009, 0x05EE1009, 0x05ED1009, 0x05EF1009, 0x05F01009, 0x05F11009,
+            0x05F21009, 0x05F31009, 0x05F41009, 0x05F51009, 0x00000000, 0x00000000,
+            0x05F61009, 0x05F71009, 0x05F81009, 0x05F91009,
+        },
+        {
+            0x05FA1009, 0x05FB1009, 0x05FC1009, 0x05FD1009, 0x05FE1009, 0x05FF1009,
+            0x06001009, 0x06011009, 0x06021009, 0x06031009, 0x06041009, 0x06051009,
+            0x06061009, 0x06071009, 0x00000000, 0x06081009,
+        },
+        {
+            0x06091009, 0x060A1009, 0x060B1009, 0x060C1009, 0x060D1009, 0x060E1009,
+            0x060F1009, 0x06101009, 0x06111009, 0x06121009, 0x06131009, 0x06141009,
+            0x06151009, 0x06161009, 0x06171009, 0x06181009,
+        },
+        {
+            0x06191009, 0x061A1009, 0x061B1009, 0x061C1009, 0x061D1009, 0x061E1009,
+            0x061F1009, 0x06201009, 0x06211009, 0x06221009, 0x06231009, 0x06241009,
+            0x06251009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x06261009, 0x06271009, 0x06281009, 0x06291009, 0x062A1009, 0x062B1009,
+            0x062C1009, 0x062D1009, 0x062E1009, 0x062F1009, 0x06301009, 0x06311009,
+            0x06321009, 0x06331009, 0x06341009, 0x06351009,
+        },
+        {
+            0x06361009, 0x06371009, 0x06381009, 0x06391009, 0x063A1009, 0x063B1009,
+            0x063C1009, 0x063D1009, 0x063E1009, 0x063F1009, 0x06401009, 0x06411009,
+            0x06421009, 0x06431009, 0x06441009, 0x06451009,
+        },
+        {
+            0x06461009, 0x06471009, 0x06481009, 0x06491009, 0x064A1009, 0x064B1009,
+            0x064C1009, 0x064D1009, 0x064E1009, 0x064F1009, 0x06501009, 0x06511009,
+            0x06521009, 0x06531009, 0x06541009, 0x06551009,
+        },
+        {
+            0x06561009, 0x06571009, 0x06581009, 0x06591009, 0x00000000, 0x065A1009,
+            0x065B1009, 0x065C1009, 0x065D1009, 0x00000000, 0x065E1009, 0x065F1009,
+            0x00000000, 0x06601009, 0x06621009, 0x06631009,
+        },
+        {
+            0x06641009, 0x06651009, 0x06711009, 0x06731009, 0x06741009, 0x06751009,
+            0x06771009, 0x06781009, 0x06791009, 0x067A1009, 0x067B1009, 0x067C1009,
+            0x067E1009, 0x06801009, 0x06811009, 0x06821009,
+        },
+        {
+            0x06831009, 0x06841009, 0x06851009, 0x06861009, 0x00000000, 0x06871009,
+            0x00000000, 0x06881009, 0x06891009, 0x068A1009, 0x068B1009, 0x068C1009,
+            0x0007940A, 0x00079C0E, 0x068D1009, 0x0007A80A,
+        },
+        {
+            0x0007B00E, 0x068E1009, 0x068F1009, 0x06901009, 0x06911009, 0x06921009,
+            0x06931009, 0x06941009, 0x06951009, 0x06961009, 0x06971009, 0x06981009,
+            0x06991009, 0x069A1009, 0x069B1009, 0x069C1009,
+        },
+        {
+            0x069D1009, 0x00000000, 0x069E1009, 0x069F1009, 0x00000000, 0x06A01009,
+            0x06A11009, 0x00000000, 0x06A21009, 0x00000000, 0x06A31009, 0x06A41009,
+            0x06A51009, 0x06A61009, 0x06A71009, 0x06A81009,
+        },
+        {
+            0x06A91009, 0x06AA1009, 0x06AB1009, 0x06AC1009, 0x06AD1009, 0x06AE1009,
+            0x06AF1009, 0x06B01009, 0x06B11009, 0x06B21009, 0x06B31009, 0x06B41009,
+            0x06B51009, 0x06B61009, 0x06B71009, 0x06B81009,
+        },
+        {
+            0x00000000, 0x06B91009, 0x00000000, 0x06BA1009, 0x06BB1009, 0x06BC1009,
+            0x06BD1009, 0x06BE1009, 0x06BF1009, 0x06C01009, 0x06C11009, 0x06C21009,
+            0x06C31009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x06C41009, 0x06C51009, 0x00000000, 0x00000000,
+            0x06C61009, 0x06C71009, 0x00000000, 0x00000000, 0x06C81009, 0x06C91009,
+            0x06CA1009, 0x06CB1009, 0x06CC1009, 0x06CD1009,
+        },
+        {
+            0x00000000, 0x00000000, 0x06CE1009, 0x06CF1009, 0x00000000, 0x00000000,
+            0x06D01009, 0x06D11009, 0x00000000, 0x00000000, 0x06D21009, 0x06D31009,
+            0x06D41009, 0x06D51009, 0x06D61009, 0x06D71009,
+        },
+        {
+            0x06D81009, 0x06D91009, 0x06DA1009, 0x06DB1009, 0x06DC1009, 0x06DD1009,
+            0x06DE1009, 0x06DF1009, 0x06E01009, 0x06E11009, 0x06E21009, 0x06E31009,
+            0x06E41009, 0x06E51009, 0x06E61009, 0x06E71009,
+        },
+        {
+            0x06E81009, 0x06E91009, 0x06EA1009, 0x06EB1009, 0x06EC1009, 0x06ED1009,
+            0x06EE1009, 0x06EF1009, 0x06F01009, 0x06F11009, 0x06F21009, 0x06F31009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x06F41009, 0x06F51009, 0x06F61009, 0x06F71009, 0x06F81009, 0x06F91009,
+            0x06FA1009, 0x06FB1009, 0x06FC1009, 0x06FD1009, 0x06FE1009, 0x06FF1009,
+            0x07001009, 0x07021009, 0x07031009, 0x07041009,
+        },
+        {
+            0x07051009, 0x07061009, 0x07071009, 0x07081009, 0x07091009, 0x070A1009,
+            0x070B1009, 0x070C1009, 0x070D1009, 0x070E1009, 0x070F1009, 0x07101009,
+            0x07111009, 0x07121009, 0x07131009, 0x07141009,
+        },
+        {
+            0x07151009, 0x07161009, 0x07171009, 0x07181009, 0x07191009, 0x071A1009,
+            0x071B1009, 0x071C1009, 0x071D1009, 0x071E1009, 0x071F1009, 0x07201009,
+            0x07211009, 0x07221009, 0x07231009, 0x07241009,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07251009, 0x07261009,
+            0x07271009, 0x07281009, 0x07291009, 0x072A1009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x072B1009, 0x072C1009,
+        },
+        {
+            0x072D1009, 0x072E1009, 0x072F1009, 0x07301009, 0x07311009, 0x07321009,
+            0x07331009, 0x07341009, 0x07351009, 0x07361009, 0x07371009, 0x07381009,
+            0x07391009, 0x073A1009, 0x073B1009, 0x073C1009,
+        },
+        {
+            0x073D1009, 0x073E1009, 0x073F1009, 0x07401009, 0x07411009, 0x07421009,
+            0x07431009, 0x07441009, 0x03361009, 0x03371009, 0x03381009, 0x03391009,
+            0x07451009, 0x07461009, 0x07471009, 0x07481009,
+        },
+        {
+            0x07491009, 0x074A1009, 0x074B1009, 0x074C1009, 0x074D1009, 0x074E1009,
+            0x074F1009, 0x07501009, 0x07511009, 0x07521009, 0x07531009, 0x07541009,
+            0x07551009, 0x07561009, 0x07571009, 0x07581009,
+        },
+        {
+            0x07591009, 0x075A1009, 0x075B1009, 0x075C1009, 0x075D1009, 0x075E1009,
+            0x075F1009, 0x07601009, 0x07611009, 0x00000000, 0x00000000, 0x07621009,
+            0x07631009, 0x07641009, 0x07651009, 0x07661009,
+        },
+        {
+            0x07671009, 0x07681009, 0x07691009, 0x076A1009, 0x076B1009, 0x076C1009,
+            0x076D1009, 0x076E1009, 0x076F1009, 0x07701009, 0x07711009, 0x07721009,
+            0x07731009, 0x07741009, 0x07751009, 0x07761009,
+        },
+        {
+            0x07771009, 0x07781009, 0x07791009, 0x077A1009, 0x077B1009, 0x077C1009,
+            0x077D1009, 0x077E1009, 0x077F1009, 0x07801009, 0x07811009, 0x07821009,
+            0x07831009, 0x07841009, 0x07851009, 0x07861009,
+        },
+        {
+            0x07871009, 0x07881009, 0x07891009, 0x078A1009, 0x078B1009, 0x078C1009,
+            0x078D1009, 0x078E1009, 0x078F1009, 0x07901009, 0x07911009, 0x07921009,
+            0x07931009, 0x07941009, 0x07951009, 0x07961009,
+        },
+        {
+            0x07971009, 0x07981009, 0x07991009, 0x079A1009, 0x079B1009, 0x079C1009,
+            0x079D1009, 0x079E1009, 0x079F1009, 0x07A01009, 0x07A11009, 0x07A21009,
+            0x07A31009, 0x07A41009, 0x07A51009, 0x07A61009,
+        },
+        {
+            0x07A71009, 0x07A81009, 0x07A91009, 0x07AA1009, 0x07AB1009, 0x07AC1009,
+            0x07AD1009, 0x07AE1009, 0x07AF1009, 0x07B01009, 0x07B11009, 0x07B21009,
+            0x07B31009, 0x07B41009, 0x07B51009, 0x07B61009,
+        },
+        {
+            0x07B71009, 0x07B81009, 0x07B91009, 0x07BA1009, 0x07BB1009, 0x07BC1009,
+            0x07BD1009, 0x07BE1009, 0x07BF1009, 0x07C01009, 0x07C11009, 0x07C21009,
+            0x07C31009, 0x07C41009, 0x07C51009, 0x07C61009,
+        },
+        {
+            0x07C71009, 0x07C81009, 0x07C91009, 0x07CA1009, 0x07CB1009, 0x07CC1009,
+            0x07CD1009, 0x07CE1009, 0x07CF1009, 0x07D01009, 0x07D11009, 0x07D21009,
+            0x07D31009, 0x07D41009, 0x07D51009, 0x07D61009,
+        },
+        {
+            0x07D71009, 0x07D81009, 0x07D91009, 0x07DA1009, 0x07DB1009, 0x07DC1009,
+            0x07DD1009, 0x07DE1009, 0x07DF1009, 0x07E01009, 0x07E11009, 0x07E21009,
+            0x07E31009, 0x07E41009, 0x07E51009, 0x07E61009,
+        },
+        {
+            0x07E71009, 0x07E81009, 0x07E91009, 0x07EA1009, 0x07EB1009, 0x07EC1009,
+            0x07ED1009, 0x07EE1009, 0x07EF1009, 0x07F01009, 0x07F11009, 0x07F21009,
+            0x07F31009, 0x07F41009, 0x07F51009, 0x07F61009,
+        },
+        {
+            0x07F71009, 0x07F81009, 0x07F91009, 0x07FA1009, 0x07FB1009, 0x07FC1009,
+            0x07FD1009, 0x07FE1009, 0x07FF1009, 0x08001009, 0x08011009, 0x08021009,
+            0x08031009, 0x08041009, 0x08051009, 0x08061009,
+        },
+        {
+            0x08071009, 0x08081009, 0x08091009, 0x080A1009, 0x080B1009, 0x080C1009,
+            0x080D1009, 0x080E1009, 0x080F1009, 0x08101009, 0x08111009, 0x08121009,
+            0x08131009, 0x08141009, 0x08151009, 0x08161009,
+        },
+        {
+            0x08171009, 0x08181009, 0x08191009, 0x081A1009, 0x081B1009, 0x081C1009,
+            0x081D1009, 0x081E1009, 0x081F1009, 0x08201009, 0x08211009, 0x08221009,
+            0x08231009, 0x08241009, 0x08251009, 0x08261009,
+        },
+        {
+            0x08271009, 0x08281009, 0x08291009, 0x082A1009, 0x082B1009, 0x082C1009,
+            0x082D1009, 0x082E1009, 0x082F1009, 0x08301009, 0x08311009, 0x08321009,
+            0x08331009, 0x08341009, 0x08351009, 0x08361009,
+        },
+        {
+            0x08371009, 0x08381009, 0x08391009, 0x083A1009, 0x083B1009, 0x083C1009,
+            0x083D1009, 0x083E1009, 0x083F1009, 0x08401009, 0x08411009, 0x08421009,
+            0x08431009, 0x08441009, 0x08451009, 0x08461009,
+        },
+        {
+            0x08471009, 0x08481009, 0x08491009, 0x084A1009, 0x084B1009, 0x084C1009,
+            0x084D1009, 0x084E1009, 0x084F1009, 0x08501009, 0x08511009, 0x08521009,
+            0x08531009, 0x08541009, 0x08551009, 0x08561009,
+        },
+        {
+            0x08571009, 0x08581009, 0x08591009, 0x085A1009, 0x085B1009, 0x085C1009,
+            0x085D1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x085E1009, 0x085F1009, 0x08601009, 0x08611009, 0x08621009, 0x08631009,
+            0x08641009, 0x08651009, 0x08661009, 0x08671009, 0x08681009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F991019, 0x1F9A1019, 0x1F9B1019, 0x1F9C1019, 0x1F9D1019, 0x1F9E1019,
+            0x1F9F1019, 0x1FA01019, 0x1FA11019, 0x0007BC0A, 0x0007C40A, 0x0007CC0A,
+            0x0007D40A, 0x0007DC0A, 0x0007E40A, 0x0007EC0A,
+        },
+        {
+            0x0007F40A, 0x0007FC0A, 0x0008040A, 0x00080C0A, 0x0008140E, 0x0008200E,
+            0x00082C0E, 0x0008380E, 0x0008440E, 0x0008500E, 0x00085C0E, 0x0008680E,
+            0x0008740E, 0x00088012, 0x00089012, 0x0008A012,
+        },
+        {
+            0x0008B012, 0x0008C012, 0x0008D012, 0x0008E012, 0x0008F012, 0x00090012,
+            0x00091012, 0x00092012, 0x0009300A, 0x0009380A, 0x0009400A, 0x0009480A,
+            0x0009500A, 0x0009580A, 0x0009600A, 0x0009680A,
+        },
+        {
+            0x0009700A, 0x0009780E, 0x0009840E, 0x0009900E, 0x00099C0E, 0x0009A80E,
+            0x0009B40E, 0x0009C00E, 0x0009CC0E, 0x0009D80E, 0x0009E40E, 0x0009F00E,
+            0x0009FC0E, 0x000A080E, 0x000A140E, 0x000A200E,
+        },
+        {
+            0x000A2C0E, 0x000A380E, 0x000A440E, 0x000A500E, 0x000A5C0E, 0x000A680E,
+            0x000A740E, 0x000A800E, 0x000A8C0E, 0x000A980E, 0x000AA40E, 0x000AB00E,
+            0x000ABC0E, 0x000AC80E, 0x000AD40E, 0x000AE00E,
+        },
+        {
+            0x000AEC0E, 0x000AF80E, 0x000B040E, 0x000B100E, 0x000B1C0E, 0x000B280E,
+            0x1FA21031, 0x1FBC1031, 0x1FD61031, 0x1FEB1031, 0x20071031, 0x20421031,
+            0x20511031, 0x20751031, 0x20901031, 0x20AB1031,
+        },
+        {
+            0x20C41031, 0x20D61031, 0x21091031, 0x21181031, 0x213C1031, 0x216B1031,
+            0x21801031, 0x21931031, 0x21D21031, 0x21F71031, 0x22171031, 0x22471031,
+            0x22591031, 0x22641031, 0x22701031, 0x22861031,
+        },
+        {
+            0x1FA21019, 0x1FBC1019, 0x1FD61019, 0x1FEB1019, 0x20071019, 0x20421019,
+            0x20511019, 0x20751019, 0x20901019, 0x20AB1019, 0x20C41019, 0x20D61019,
+            0x21091019, 0x21181019, 0x213C1019, 0x216B1019,
+        },
+        {
+            0x21801019, 0x21931019, 0x21D21019, 0x21F71019, 0x22171019, 0x22471019,
+            0x22591019, 0x22641019, 0x22701019, 0x22861019, 0x1F981019, 0x0007C40A,
+            0x0007CC0A, 0x0007D40A, 0x0007DC0A, 0x0007E40A,
+        },
+        {
+            0x0007EC0A, 0x0007F40A, 0x0007FC0A, 0x0008040A, 0x00080C0A, 0x1F991019,
+            0x1F9A1019, 0x1F9B1019, 0x1F9C1019, 0x1F9D1019, 0x1F9E1019, 0x1F9F1019,
+            0x1FA01019, 0x1FA11019, 0x0007BC0A, 0x1F981019,
+        },
+        {
+            0x08691009, 0x086A1009, 0x086B1009, 0x086C1009, 0x086D1009, 0x086E1009,
+            0x086F1009, 0x08701009, 0x08711009, 0x08721009, 0x08731009, 0x08741009,
+            0x08751009, 0x08761009, 0x08771009, 0x08781009,
+        },
+        {
+            0x08791009, 0x087A1009, 0x087B1009, 0x087C1009, 0x087D1009, 0x087E1009,
+            0x087F1009, 0x08801009, 0x08811009, 0x08821009, 0x08831009, 0x08841009,
+            0x08851009, 0x08861009, 0x08871009, 0x08881009,
+        },
+        {
+            0x08891009, 0x088A1009, 0x088B1009, 0x088C1009, 0x088D1009, 0x088E1009,
+            0x088F1009, 0x08901009, 0x08911009, 0x08921009, 0x08931009, 0x08941009,
+            0x08951009, 0x08961009, 0x08971009, 0x08981009,
+        },
+        {
+            0x08991009, 0x089A1009, 0x089B1009, 0x089C1009, 0x089D1009, 0x089E1009,
+            0x089F1009, 0x08A01009, 0x08A11009, 0x08A21009, 0x08A31009, 0x08A41009,
+            0x08A51009, 0x08A61009, 0x08A71009, 0x08A81009,
+        },
+        {
+            0x08A91009, 0x08AA1009, 0x08AB1009, 0x08AC1009, 0x08AD1009, 0x08AE1009,
+            0x08AF1009, 0x08B01009, 0x08B11009, 0x08B21009, 0x08B31009, 0x08B41009,
+            0x08B51009, 0x08B61009, 0x08B71009, 0x08B81009,
+        },
+        {
+            0x08B91009, 0x08BA1009, 0x08BB1009, 0x08BC1009, 0x08BD1009, 0x08BE1009,
+            0x08BF1009, 0x08C01009, 0x08C11009, 0x08C21009, 0x08C31009, 0x08C41009,
+            0x08C51009, 0x08C61009, 0x08C71009, 0x08C81009,
+        },
+        {
+            0x08C91009, 0x08CA1009, 0x08CB1009, 0x08CC1009, 0x08CD1009, 0x08CE1009,
+            0x08CF1009, 0x08D01009, 0x08D11009, 0x08D21009, 0x08D31009, 0x08D41009,
+            0x08D51009, 0x08D61009, 0x08D71009, 0x08D81009,
+        },
+        {
+            0x08D91009, 0x08DA1009, 0x08DB1009, 0x08DC1009, 0x08DD1009, 0x08DE1009,
+            0x08DF1009, 0x08E01009, 0x08E11009, 0x08E21009, 0x08E31009, 0x08E41009,
+            0x08E51009, 0x08E61009, 0x08E71009, 0x08E81009,
+        },
+        {
+            0x08E91009, 0x08EA1009, 0x08EB1009, 0x08EC1009, 0x08ED1009, 0x08EE1009,
+            0x08EF1009, 0x08F01009, 0x08F11009, 0x08F21009, 0x08F31009, 0x08F41009,
+            0x08F51009, 0x08F61009, 0x08F71009, 0x08F81009,
+        },
+        {
+            0x08F91009, 0x08FA1009, 0x08FB1009, 0x08FC1009, 0x08FD1009, 0x08FE1009,
+            0x08FF1009, 0x09001009, 0x09011009, 0x09021009, 0x09031009, 0x09041009,
+            0x09051009, 0x09061009, 0x09071009, 0x09081009,
+        },
+        {
+            0x09091009, 0x090A1009, 0x090B1009, 0x090C1009, 0x090D1009, 0x090E1009,
+            0x090F1009, 0x09101009, 0x09111009, 0x09121009, 0x09131009, 0x09141009,
+            0x09151009, 0x09161009, 0x09171009, 0x09181009,
+        },
+        {
+            0x09191009, 0x091A1009, 0x091B1009, 0x091C1009, 0x091D1009, 0x091E1009,
+            0x091F1009, 0x09201009, 0x09211009, 0x09221009, 0x09231009, 0x09241009,
+            0x09251009, 0x09261009, 0x09271009, 0x09281009,
+        },
+        {
+            0x09291009, 0x092A1009, 0x092B1009, 0x092C1009, 0x092D1009, 0x092E1009,
+            0x092F1009, 0x09301009, 0x09311009, 0x09321009, 0x09331009, 0x09341009,
+            0x09351009, 0x09361009, 0x09371009, 0x09381009,
+        },
+        {
+            0x09391009, 0x093A1009, 0x093B1009, 0x093C1009, 0x093D1009, 0x093E1009,
+            0x093F1009, 0x09401009, 0x09411009, 0x09421009, 0x09431009, 0x09441009,
+            0x09451009, 0x09461009, 0x09471009, 0x09481009,
+        },
+        {
+            0x09491009, 0x094A1009, 0x094B1009, 0x094C1009, 0x094D1009, 0x094E1009,
+            0x094F1009, 0x09501009, 0x09511009, 0x09521009, 0x09531009, 0x09541009,
+            0x09551009, 0x09561009, 0x09571009, 0x09581009,
+        },
+        {
+            0x09591009, 0x095A1009, 0x095B1009, 0x095C1009, 0x095D1009, 0x095E1009,
+            0x095F1009, 0x09601009, 0x09611009, 0x09621009, 0x09631009, 0x09641009,
+            0x09651009, 0x09661009, 0x09671009, 0x09681009,
+        },
+        {
+            0x0A331009, 0x0A341009, 0x0A351009, 0x0A361009, 0x0A371009, 0x0A381009,
+            0x0A391009, 0x0A3A1009, 0x0A3B1009, 0x0A3C1009, 0x0A3D1009, 0x0A3E1009,
+            0x0A3F1009, 0x0A401009, 0x0A411009, 0x0A421009,
+        },
+        {
+            0x0A431009, 0x0A441009, 0x0A451009, 0x0A461009, 0x0A471009, 0x0A481009,
+            0x0A491009, 0x0A4A1009, 0x0A4B1009, 0x0A4C1009, 0x0A4D1009, 0x0A4E1009,
+            0x0A4F1009, 0x0A501009, 0x0A511009, 0x0A521009,
+        },
+        {
+            0x0A531009, 0x0A541009, 0x0A551009, 0x0A561009, 0x0A571009, 0x0A581009,
+            0x0A591009, 0x0A5A1009, 0x0A5B1009, 0x0A5C1009, 0x0A5D1009, 0x0A5E1009,
+            0x0A5F1009, 0x0A601009, 0x0A611009, 0x0A621009,
+        },
+        {
+            0x0FEE1009, 0x0FEF1009, 0x0FF01009, 0x0FF11009, 0x0FF21009, 0x0FF31009,
+            0x0FF41009, 0x0FF51009, 0x0A631009, 0x0A641009, 0x0A651009, 0x0A661009,
+            0x0A671009, 0x0A681009, 0x0A691009, 0x0A6A1009,
+        },
+        {
+            0x0A6B1009, 0x0A6C1009, 0x0A6D1009, 0x0A6E1009, 0x0A6F1009, 0x0A701009,
+            0x0A711009, 0x0A721009, 0x0A731009, 0x0A741009, 0x0A751009, 0x0A761009,
+            0x0A771009, 0x0A781009, 0x0A791009, 0x0A7A1009,
+        },
+        {
+            0x0A7B1009, 0x0A7C1009, 0x0A7D1009, 0x0A7E1009, 0x0A7F1009, 0x0A801009,
+            0x0A811009, 0x0A821009, 0x0A831009, 0x0A841009, 0x0A851009, 0x0A861009,
+            0x0A871009, 0x0A881009, 0x0A891009, 0x0A8A1009,
+        },
+        {
+            0x0A8B1009, 0x0A8C1009, 0x0A8D1009, 0x0A8E1009, 0x0A8F1009, 0x0A901009,
+            0x0A911009, 0x0A921009, 0x0A931009, 0x0A941009, 0x0A951009, 0x0A961009,
+            0x0A971009, 0x12411009, 0x12421009, 0x12431009,
+        },
+        {
+            0x0A981009, 0x0A991009, 0x0A9A1009, 0x0A9B1009, 0x0A9C1009, 0x0A9D1009,
+            0x0A9E1009, 0x0A9F1009, 0x0AA01009, 0x0AA11009, 0x0AA21009, 0x0AA31009,
+            0x0AA41009, 0x0AA51009, 0x0AA61009, 0x0AA71009,
+        },
+        {
+            0x0AA81009, 0x0AA91009, 0x0AAA1009, 0x0AAB1009, 0x0AAC1009, 0x0AAD1009,
+            0x0AAE1009, 0x0AAF1009, 0x0AB01009, 0x0AB11009, 0x0FE81009, 0x0FE91009,
+            0x0FEA1009, 0x0FEB1009, 0x0FEC1009, 0x0FED1009,
+        },
+        {
+            0x0AB21009, 0x0AB31009, 0x0AB41009, 0x0AB51009, 0x0AB61009, 0x0AB71009,
+            0x0AB81009, 0x0AB91009, 0x0ABA1009, 0x0ABB1009, 0x0ABC1009, 0x0ABD1009,
+            0x0ABE1009, 0x0ABF1009, 0x0AC01009, 0x0AC11009,
+        },
+        {
+            0x0AC21009, 0x0AC31009, 0x0AC41009, 0x0AC51009, 0x0AC61009, 0x0AC71009,
+            0x0AC81009, 0x0AC91009, 0x0ACA1009, 0x0ACB1009, 0x0ACC1009, 0x0ACD1009,
+            0x0ACE1009, 0x0ACF1009, 0x0AD01009, 0x0AD11009,
+        },
+        {
+            0x0AD21009, 0x0AD31009, 0x0AD41009, 0x0AD51009, 0x0AD61009, 0x0AD71009,
+            0x0AD81009, 0x0AD91009, 0x0ADA1009, 0x0ADB1009, 0x0ADC1009, 0x0ADD1009,
+            0x0ADE1009, 0x0ADF1009, 0x0AE01009, 0x0AE11009,
+        },
+        {
+            0x0AE21009, 0x0AE31009, 0x0AE41009, 0x0AE51009, 0x0AE61009, 0x0AE71009,
+            0x0AE81009, 0x0AE91009, 0x0AEA1009, 0x0AEB1009, 0x0AEC1009, 0x0AED1009,
+            0x0AEE1009, 0x0AEF1009, 0x0AF01009, 0x0AF11009,
+        },
+        {
+            0x0AF21009, 0x0AF31009, 0x0AF41009, 0x0AF51009, 0x0AF61009, 0x0AF71009,
+            0x0AF81009, 0x0AF91009, 0x0AFA1009, 0x0AFB1009, 0x0AFC1009, 0x0AFD1009,
+            0x0AFE1009, 0x0AFF1009, 0x0B001009, 0x0B011009,
+        },
+        {
+            0x0B021009, 0x0B031009, 0x0B041009, 0x0B051009, 0x0B061009, 0x0B071009,
+            0x0B081009, 0x0B091009, 0x0B0A1009, 0x0B0B1009, 0x0B0C1009, 0x0B0D1009,
+            0x0B0E1009, 0x0B0F1009, 0x0B101009, 0x0B111009,
+        },
+        {
+            0x0B121009, 0x0B131009, 0x0B141009, 0x0B151009, 0x0B161009, 0x0B171009,
+            0x0B181009, 0x0B191009, 0x0B1A1009, 0x0B1B1009, 0x0B1C1009, 0x0B1D1009,
+            0x0B1E1009, 0x0B1F1009, 0x0B201009, 0x0B211009,
+        },
+        {
+            0x0B3C1009, 0x0B3D1009, 0x0B3E1009, 0x0B3F1009, 0x0B401009, 0x0B411009,
+            0x0B421009, 0x0B431009, 0x0B441009, 0x0B451009, 0x0B461009, 0x0B471009,
+            0x0B481009, 0x0B491009, 0x0B4A1009, 0x0B4B1009,
+        },
+        {
+            0x0B4C1009, 0x0B4D1009, 0x0B4E1009, 0x0B4F1009, 0x0B501009, 0x0B511009,
+            0x0B521009, 0x0B531009, 0x0B541009, 0x0B551009, 0x0B561009, 0x0B571009,
+            0x0B581009, 0x0B591009, 0x0B5A1009, 0x0B5B1009,
+        },
+        {
+            0x0B5C1009, 0x0B5F1009, 0x0B601009, 0x0B611009, 0x0B621009, 0x0B631009,
+            0x0B641009, 0x0B651009, 0x0B661009, 0x0B671009, 0x0B681009, 0x0B691009,
+            0x0B6A1009, 0x0B6B1009, 0x0B6C1009, 0x0B6D1009,
+        },
+        {
+            0x0B6E1009, 0x0B6F1009, 0x0B701009, 0x0B711009, 0x0B721009, 0x0B731009,
+            0x0B741009, 0x0B751009, 0x0B761009, 0x0B771009, 0x0B781009, 0x0B791009,
+            0x0B7A1009, 0x0B7B1009, 0x0B7C1009, 0x0B7D1009,
+        },
+        {
+            0x0B7E1009, 0x0B7F1009, 0x0B801009, 0x0B811009, 0x0B821009, 0x0B831009,
+            0x0B841009, 0x0B851009, 0x0B861009, 0x0B871009, 0x0B881009, 0x0B891009,
+            0x0B8A1009, 0x0B8B1009, 0x0B8C1009, 0x0B8D1009,
+        },
+        {
+            0x0B8E1009, 0x0B8F1009, 0x0B901009, 0x0B911009, 0x0B921009, 0x0B931009,
+            0x0B941009, 0x0B951009, 0x0B961009, 0x0B971009, 0x0B981009, 0x0B991009,
+            0x0B9A1009, 0x0B9B1009, 0x0B9C1009, 0x0B9D1009,
+        },
+        {
+            0x0B9E1009, 0x0B9F1009, 0x0BA01009, 0x0BA11009, 0x0BA21009, 0x0BA31009,
+            0x0BA41009, 0x0BA51009, 0x035E1009, 0x035F1009, 0x03601009, 0x03611009,
+            0x03621009, 0x03631009, 0x03641009, 0x03651009,
+        },
+        {
+            0x03661009, 0x03671009, 0x03681009, 0x03691009, 0x036A1009, 0x036B1009,
+            0x1F991019, 0x1F9A1019, 0x1F9B1019, 0x1F9C1019, 0x1F9D1019, 0x1F9E1019,
+            0x1F9F1019, 0x1FA01019, 0x1FA11019, 0x0007BC0A,
+        },
+        {
+            0x1F991019, 0x1F9A1019, 0x1F9B1019, 0x1F9C1019, 0x1F9D1019, 0x1F9E1019,
+            0x1F9F1019, 0x1FA01019, 0x1FA11019, 0x0007BC0A, 0x1F991019, 0x1F9A1019,
+            0x1F9B1019, 0x1F9C1019, 0x1F9D1019, 0x1F9E1019,
+        },
+        {
+            0x1F9F1019, 0x1FA01019, 0x1FA11019, 0x0007BC0A, 0x0BA61009, 0x0BA71009,
+            0x0BA81009, 0x0BA91009, 0x0BAA1009, 0x0BAB1009, 0x0BAC1009, 0x0BAD1009,
+            0x0BAE1009, 0x0BAF1009, 0x0BB01009, 0x0BB11009,
+        },
+        {
+            0x0BB21009, 0x0BB31009, 0x0BB41009, 0x0BB51009, 0x0BB61009, 0x0BB71009,
+            0x0BB81009, 0x0BB91009, 0x0BBA1009, 0x0BBB1009, 0x0BBC1009, 0x0BBD1009,
+            0x0BBE1009, 0x0BBF1009, 0x0BC01009, 0x0BC11009,
+        },
+        {
+            0x0BC21009, 0x0BC31009, 0x0BC41009, 0x0BC51009, 0x0BC61009, 0x0BC71009,
+            0x0BC81009, 0x0BC91009, 0x0BCA1009, 0x0BCB1009, 0x0BCC1009, 0x0BCD1009,
+            0x0BCE1009, 0x0BCF1009, 0x0BD01009, 0x0BD11009,
+        },
+        {
+            0x0BD21009, 0x0BD31009, 0x0BD41009, 0x0BD51009, 0x0BD61009, 0x03521009,
+            0x03531009, 0x0BD71009, 0x0BD81009, 0x0BD91009, 0x0BDA1009, 0x0BDB1009,
+            0x0BDC1009, 0x0BDD1009, 0x0BDE1009, 0x0BDF1009,
+        },
+        {
+            0x0BE01009, 0x0BE11009, 0x0BE21009, 0x0BE31009, 0x0BE41009, 0x0BE51009,
+            0x0BE61009, 0x0BE71009, 0x0BE81009, 0x0BE91009, 0x0BEA1009, 0x0BEB1009,
+            0x0BEC1009, 0x0BED1009, 0x0BEE1009, 0x0BEF1009,
+        },
+        {
+            0x0BF01009, 0x0BF11009, 0x0BF21009, 0x0BF31009, 0x0BF41009, 0x0BF51009,
+            0x03541009, 0x03551009, 0x03561009, 0x03571009, 0x03581009, 0x03591009,
+            0x035A1009, 0x035B1009, 0x035C1009, 0x035D1009,
+        },
+        {
+            0x0BF61009, 0x0BF71009, 0x0BF81009, 0x0BF91009, 0x0BFA1009, 0x0BFB1009,
+            0x0BFC1009, 0x0BFD1009, 0x0BFE1009, 0x0BFF1009, 0x0C001009, 0x0C011009,
+            0x0C021009, 0x0C031009, 0x0C041009, 0x0C051009,
+        },
+        {
+            0x0EE81009, 0x0EE91009, 0x0EEA1009, 0x0EEB1009, 0x0EEC1009, 0x0EED1009,
+            0x0EEE1009, 0x0EEF1009, 0x0EF01009, 0x0EF11009, 0x0EF21009, 0x0EF31009,
+            0x0EF41009, 0x0EF51009, 0x0EF61009, 0x0EF71009,
+        },
+        {
+            0x0EF81009, 0x0EF91009, 0x0EFA1009, 0x0EFB1009, 0x0EFC1009, 0x0EFD1009,
+            0x0EFE1009, 0x0EFF1009, 0x0F001009, 0x0F011009, 0x0F021009, 0x0F031009,
+            0x0F041009, 0x0F051009, 0x0F061009, 0x0F071009,
+        },
+        {
+            0x0F081009, 0x0F091009, 0x0F0A1009, 0x0F0B1009, 0x0F0C1009, 0x0F0D1009,
+            0x0F0E1009, 0x0F0F1009, 0x0F101009, 0x0F111009, 0x0F121009, 0x0F131009,
+            0x0F141009, 0x0F151009, 0x0F161009, 0x0F171009,
+        },
+        {
+            0x0F181009, 0x0F191009, 0x0F1A1009, 0x0F1B1009, 0x0F1C1009, 0x0F1D1009,
+            0x0F1E1009, 0x0F1F1009, 0x0F201009, 0x0F211009, 0x0F221009, 0x0F231009,
+            0x0F241009, 0x0F251009, 0x0F261009, 0x0F271009,
+        },
+        {
+            0x0F281009, 0x0F291009, 0x0F2A1009, 0x0F2B1009, 0x0F2C1009, 0x0F2D1009,
+            0x0F2E1009, 0x0F2F1009, 0x0F301009, 0x0F311009, 0x0F321009, 0x0F331009,
+            0x0F341009, 0x0F351009, 0x0F361009, 0x0F371009,
+        },
+        {
+            0x0F381009, 0x0F391009, 0x0F3A1009, 0x0F3B1009, 0x0F3C1009, 0x0F3D1009,
+            0x0F3E1009, 0x0F3F1009, 0x0F401009, 0x0F411009, 0x0F421009, 0x0F431009,
+            0x0F441009, 0x0F451009, 0x0F461009, 0x0F471009,
+        },
+        {
+            0x0F481009, 0x0F491009, 0x0F4A1009, 0x0F4B1009, 0x0F4C1009, 0x0F4D1009,
+            0x0F4E1009, 0x0F4F1009, 0x0F501009, 0x0F511009, 0x0F521009, 0x0F531009,
+            0x0F541009, 0x0F551009, 0x0F561009, 0x0F571009,
+        },
+        {
+            0x0F581009, 0x0F591009, 0x0F5A1009, 0x0F5B1009, 0x0F5C1009, 0x0F5D1009,
+            0x0F5E1009, 0x0F5F1009, 0x0F601009, 0x0F611009, 0x0F621009, 0x0F631009,
+            0x0F641009, 0x0F651009, 0x0F661009, 0x0F671009,
+        },
+        {
+            0x0F681009, 0x0F691009, 0x0F6A1009, 0x0F6B1009, 0x0F6C1009, 0x0F6D1009,
+            0x0F6E1009, 0x0F6F1009, 0x0F701009, 0x0F711009, 0x0F721009, 0x0F731009,
+            0x0F741009, 0x0F751009, 0x0F761009, 0x0F771009,
+        },
+        {
+            0x0F781009, 0x0F791009, 0x0F7A1009, 0x0F7B1009, 0x0F7C1009, 0x0F7D1009,
+            0x0F7E1009, 0x0F7F1009, 0x0F801009, 0x0F811009, 0x0F821009, 0x0F831009,
+            0x0F841009, 0x0F851009, 0x0F861009, 0x0F871009,
+        },
+        {
+            0x0F881009, 0x0F891009, 0x0F8A1009, 0x0F8B1009, 0x0F8C1009, 0x0F8D1009,
+            0x0F8E1009, 0x0F8F1009, 0x0F901009, 0x0F911009, 0x0F921009, 0x0F931009,
+            0x0F941009, 0x0F951009, 0x0F961009, 0x0F971009,
+        },
+        {
+            0x0F981009, 0x0F991009, 0x0F9A1009, 0x0F9B1009, 0x0F9C1009, 0x0F9D1009,
+            0x0F9E1009, 0x0F9F1009, 0x0FA01009, 0x0FA11009, 0x0FA21009, 0x0FA31009,
+            0x0FA41009, 0x0FA51009, 0x0FA61009, 0x0FA71009,
+        },
+        {
+            0x0FA81009, 0x0FA91009, 0x0FAA1009, 0x0FAB1009, 0x0FAC1009, 0x0FAD1009,
+            0x0FAE1009, 0x0FAF1009, 0x0FB01009, 0x0FB11009, 0x0FB21009, 0x0FB31009,
+            0x0FB41009, 0x0FB51009, 0x0FB61009, 0x0FB71009,
+        },
+        {
+            0x0FB81009, 0x0FB91009, 0x0FBA1009, 0x0FBB1009, 0x0FBC1009, 0x0FBD1009,
+            0x0FBE1009, 0x0FBF1009, 0x0FC01009, 0x0FC11009, 0x0FC21009, 0x0FC31009,
+            0x0FC41009, 0x0FC51009, 0x0FC61009, 0x0FC71009,
+        },
+        {
+            0x0FC81009, 0x0FC91009, 0x0FCA1009, 0x0FCB1009, 0x0FCC1009, 0x0FCD1009,
+            0x0FCE1009, 0x0FCF1009, 0x0FD01009, 0x0FD11009, 0x0FD21009, 0x0FD31009,
+            0x0FD41009, 0x0FD51009, 0x0FD61009, 0x0FD71009,
+        },
+        {
+            0x0FD81009, 0x0FD91009, 0x0FDA1009, 0x0FDB1009, 0x0FDC1009, 0x0FDD1009,
+            0x0FDE1009, 0x0FDF1009, 0x0FE01009, 0x0FE11009, 0x0FE21009, 0x0FE31009,
+            0x0FE41009, 0x0FE51009, 0x0FE61009, 0x0FE71009,
+        },
+        {
+            0x0C061009, 0x0C071009, 0x0C081009, 0x0C091009, 0x0C0A1009, 0x0C0B1009,
+            0x0C0C1009, 0x0C0D1009, 0x0C0E1009, 0x0C0F1009, 0x0C101009, 0x0C111009,
+            0x0C121009, 0x0C131009, 0x0C141009, 0x0C151009,
+        },
+        {
+            0x0C161009, 0x0C171009, 0x0C181009, 0x0C191009, 0x0C1A1009, 0x0C1B1009,
+            0x0C1C1009, 0x0C1D1009, 0x0C1E1009, 0x0C1F1009, 0x0C201009, 0x0C211009,
+            0x0C221009, 0x0C231009, 0x0C241009, 0x0C251009,
+        },
+        {
+            0x0C261009, 0x0C271009, 0x0C281009, 0x0C291009, 0x0C2A1009, 0x0C2B1009,
+            0x0C2C1009, 0x0C2D1009, 0x0C2E1009, 0x0C2F1009, 0x0C301009, 0x0C311009,
+            0x0C321009, 0x0C331009, 0x0C341009, 0x0C351009,
+        },
+        {
+            0x0C361009, 0x0C371009, 0x0C381009, 0x0C391009, 0x0C3A1009, 0x0C3B1009,
+            0x0C3C1009, 0x0C3D1009, 0x0C3E1009, 0x0C3F1009, 0x0C401009, 0x0C411009,
+            0x0C421009, 0x0C431009, 0x0C441009, 0x0C451009,
+        },
+        {
+            0x0C461009, 0x0C471009, 0x0C481009, 0x0C491009, 0x0C4A1009, 0x0C4B1009,
+            0x0C4C1009, 0x0C4D1009, 0x0C4E1009, 0x0C4F1009, 0x0C501009, 0x0C511009,
+            0x0C521009, 0x0C531009, 0x0C541009, 0x0C551009,
+        },
+        {
+            0x0C561009, 0x0C571009, 0x0C581009, 0x0C591009, 0x0C5A1009, 0x0C5B1009,
+            0x0C5C1009, 0x0C5D1009, 0x0C5E1009, 0x0C5F1009, 0x0C601009, 0x0C611009,
+            0x0C621009, 0x0C631009, 0x0C641009, 0x0C651009,
+        },
+        {
+            0x0C661009, 0x0C671009, 0x0C681009, 0x0C691009, 0x0C6A1009, 0x0C6B1009,
+            0x0C6C1009, 0x0C6D1009, 0x0C6E1009, 0x0C6F1009, 0x0C701009, 0x0C711009,
+            0x0C721009, 0x0C731009, 0x0C741009, 0x0C751009,
+        },
+        {
+            0x0C761009, 0x0C771009, 0x0C781009, 0x0C791009, 0x0C7A1009, 0x0C7B1009,
+            0x0C7C1009, 0x0C7D1009, 0x0C7E1009, 0x0C7F1009, 0x0C801009, 0x0C811009,
+            0x0C821009, 0x0C831009, 0x0C841009, 0x0C851009,
+        },
+        {
+            0x0C861009, 0x0C871009, 0x0C881009, 0x033C1009, 0x033D1009, 0x033E1009,
+            0x033F1009, 0x03401009, 0x03411009, 0x03421009, 0x03431009, 0x03441009,
+            0x03451009, 0x03461009, 0x03471009, 0x03481009,
+        },
+        {
+            0x03491009, 0x034A1009, 0x034B1009, 0x034C1009, 0x034D1009, 0x034E1009,
+            0x034F1009, 0x03501009, 0x03511009, 0x0C891009, 0x0C8A1009, 0x0C8B1009,
+            0x0C8C1009, 0x0C8D1009, 0x0C8E1009, 0x0C8F1009,
+        },
+        {
+            0x0C901009, 0x0C911009, 0x0C921009, 0x0C931009, 0x0C941009, 0x0C951009,
+            0x0C961009, 0x0C971009, 0x0C981009, 0x0C991009, 0x0C9A1009, 0x0C9B1009,
+            0x0C9C1009, 0x0C9D1009, 0x0C9E1009, 0x0C9F1009,
+        },
+        {
+            0x0CA01009, 0x0CA11009, 0x0CA21009, 0x0CA31009, 0x0CA41009, 0x0CA51009,
+            0x0CA61009, 0x0CA71009, 0x0CA81009, 0x0CA91009, 0x0CAA1009, 0x0CAB1009,
+            0x0CAC1009, 0x0CAD1009, 0x0CAE1009, 0x0CAF1009,
+        },
+        {
+            0x0CB01009, 0x0CB11009, 0x0CB21009, 0x0CB31009, 0x0CB41009, 0x0CB51009,
+            0x0CB61009, 0x0CB71009, 0x0CB81009, 0x0CB91009, 0x0CBA1009, 0x0CBB1009,
+            0x0CBC1009, 0x0CBD1009, 0x0CBE1009, 0x0CBF1009,
+        },
+        {
+            0x0CC01009, 0x0CC11009, 0x0CC21009, 0x0CC31009, 0x0CC41009, 0x0CC51009,
+            0x0CC61009, 0x0CC71009, 0x03961009, 0x03971009, 0x03981009, 0x03991009,
+            0x0CC81009, 0x0CC91009, 0x0CCA1009, 0x0CCB1009,
+        },
+        {
+            0x0CCC1009, 0x0CCD1009, 0x0CCE1009, 0x0CCF1009, 0x0CD01009, 0x0CD11009,
+            0x0CD21009, 0x0CD31009, 0x0CD41009, 0x0CD51009, 0x0CD61009, 0x0CD71009,
+            0x0CD81009, 0x0CD91009, 0x0CDA1009, 0x0CDB1009,
+        },
+        {
+            0x0CDC1009, 0x0CDD1009, 0x0CDE1009, 0x0CDF1009, 0x0CE01009, 0x0CE11009,
+            0x0CE21009, 0x0CE31009, 0x0CE41009, 0x0CE51009, 0x0CE61009, 0x0CE71009,
+            0x033A1009, 0x033B1009, 0x0CE81009, 0x0CE91009,
+        },
+        {
+            0x0CEA1009, 0x0CEB1009, 0x0CEC1009, 0x0CED1009, 0x0CEE1009, 0x0CEF1009,
+            0x0CF01009, 0x0CF11009, 0x0CF21009, 0x0CF31009, 0x0CF41009, 0x0CF51009,
+            0x000B3412, 0x0CF61009, 0x0CF71009, 0x0CF81009,
+        },
+        {
+            0x0CF91009, 0x0CFA1009, 0x0CFB1009, 0x0CFC1009, 0x0CFD1009, 0x0CFE1009,
+            0x0CFF1009, 0x0D001009, 0x0D011009, 0x0D021009, 0x0D031009, 0x0D041009,
+            0x0D051009, 0x0D061009, 0x0D071009, 0x0D081009,
+        },
+        {
+            0x0D091009, 0x0D0A1009, 0x0D0B1009, 0x0D0C1009, 0x0D0D1009, 0x0D0E1009,
+            0x0D0F1009, 0x0D101009, 0x0D111009, 0x0D121009, 0x0D131009, 0x0D141009,
+            0x0D151009, 0x0D161009, 0x0D171009, 0x0D181009,
+        },
+        {
+            0x0D191009, 0x0D1A1009, 0x0D1B1009, 0x0D1C1009, 0x0D1D1009, 0x0D1E1009,
+            0x0D1F1009, 0x0D201009, 0x0D211009, 0x0D221009, 0x0D231009, 0x0D241009,
+            0x0D251009, 0x0D261009, 0x0D271009, 0x0D281009,
+        },
+        {
+            0x0D291009, 0x0D2A1009, 0x0D2B1009, 0x0D2C1009, 0x0D2D1009, 0x0D2E1009,
+            0x0D2F1009, 0x0D301009, 0x0D311009, 0x0D321009, 0x0D331009, 0x0D341009,
+            0x0D351009, 0x0D361009, 0x0D371009, 0x0D381009,
+        },
+        {
+            0x0D391009, 0x0D3A1009, 0x0D3B1009, 0x0D3C1009, 0x0D3D1009, 0x0D3E1009,
+            0x0D3F1009, 0x0D401009, 0x0D411009, 0x0D421009, 0x0D431009, 0x0D441009,
+            0x0D451009, 0x0D461009, 0x0D471009, 0x0D481009,
+        },
+        {
+            0x0D491009, 0x0D4A1009, 0x0D4B1009, 0x0D4C1009, 0x0D4D1009, 0x0D4E1009,
+            0x0D4F1009, 0x0D501009, 0x0D511009, 0x0D521009, 0x0D531009, 0x0D541009,
+            0x0D551009, 0x0D561009, 0x0D571009, 0x0D581009,
+        },
+        {
+            0x0D591009, 0x0D5A1009, 0x0D5B1009, 0x0D5C1009, 0x000B440E, 0x000B500A,
+            0x000B580E, 0x0D5D1009, 0x0D5E1009, 0x0D5F1009, 0x0D601009, 0x0D611009,
+            0x0D621009, 0x0D631009, 0x0D641009, 0x0D651009,
+        },
+        {
+            0x0D661009, 0x0D671009, 0x0D681009, 0x0D691009, 0x0D6A1009, 0x0D6B1009,
+            0x0D6C1009, 0x0D6D1009, 0x0D6E1009, 0x0D6F1009, 0x0D701009, 0x0D711009,
+            0x0D721009, 0x0D731009, 0x0D741009, 0x0D751009,
+        },
+        {
+            0x0D761009, 0x0D771009, 0x0D781009, 0x0D791009, 0x0D7A1009, 0x0D7B1009,
+            0x0D7C1009, 0x0D7D1009, 0x0D7E1009, 0x0D7F1009, 0x0D801009, 0x0D811009,
+            0x0D821009, 0x0D831009, 0x0D841009, 0x0D851009,
+        },
+        {
+            0x0D861009, 0x0D871009, 0x0D881009, 0x0D891009, 0x0D8A1009, 0x0D8B1009,
+            0x0D8C1009, 0x0D8D1009, 0x0D8E1009, 0x0D8F1009, 0x0D901009, 0x0D911009,
+            0x0D921009, 0x0D931009, 0x0D941009, 0x0D951009,
+        },
+        {
+            0x0D961009, 0x0D971009, 0x0D981009, 0x0D991009, 0x0D9A1009, 0x0D9B1009,
+            0x0D9C1009, 0x0D9D1009, 0x0D9E1009, 0x0D9F1009, 0x0DA01009, 0x0DA11009,
+            0x0DA21009, 0x0DA31009, 0x0DA41009, 0x0DA51009,
+        },
+        {
+            0x0DA61009, 0x0DA71009, 0x0DA81009, 0x0DA91009, 0x0DAA1009, 0x0DAB1009,
+            0x0DAC1009, 0x0DAD1009, 0x0DAE1009, 0x0DAF1009, 0x0DB01009, 0x0DB11009,
+            0x0DB21009, 0x0DB31009, 0x0DB41009, 0x0DB51009,
+        },
+        {
+            0x0DB61009, 0x0DB71009, 0x0DB81009, 0x0DB91009, 0x0DBA1009, 0x0DBB1009,
+            0x0DBC1009, 0x0DBD1009, 0x0DBE1009, 0x0DBF1009, 0x0DC01009, 0x0DC11009,
+            0x00000000, 0x0DC21009, 0x0DC31009, 0x0DC41009,
+        },
+        {
+            0x0DC51009, 0x0DC61009, 0x0DC71009, 0x0DC81009, 0x0DC91009, 0x0DCA1009,
+            0x0DCB1009, 0x0DCC1009, 0x0DCD1009, 0x0DCE1009, 0x0DCF1009, 0x0DD01009,
+            0x0DD11009, 0x0DD21009, 0x0DD31009, 0x0DD41009,
+        },
+        {
+            0x0DD51009, 0x0DD61009, 0x0DD71009, 0x0DD81009, 0x0DD91009, 0x0DDA1009,
+            0x0DDB1009, 0x0DDC1009, 0x0DDD1009, 0x0DDE1009, 0x0DDF1009, 0x0DE01009,
+            0x0DE11009, 0x0DE21009, 0x0DE31009, 0x0DE41009,
+        },
+        {
+            0x0DE51009, 0x0DE61009, 0x0DE71009, 0x0DE81009, 0x0DE91009, 0x0DEA1009,
+            0x0DEB1009, 0x0DEC1009, 0x0DED1009, 0x0DEE1009, 0x0DEF1009, 0x0DF01009,
+            0x0DF11009, 0x0DF21009, 0x0DF31009, 0x0DF41009,
+        },
+        {
+            0x0DF51009, 0x0DF61009, 0x0DF71009, 0x0DF81009, 0x0DF91009, 0x0DFA1009,
+            0x0DFB1009, 0x0DFC1009, 0x0DFD1009, 0x0DFE1009, 0x0DFF1009, 0x0E001009,
+            0x0E011009, 0x0E021009, 0x0E031009, 0x0E041009,
+        },
+        {
+            0x0E051009, 0x0E061009, 0x0E071009, 0x0E081009, 0x0E091009, 0x0E0A1009,
+            0x0E0B1009, 0x0E0C1009, 0x0E0D1009, 0x0E0E1009, 0x0E0F1009, 0x0E101009,
+            0x0E111009, 0x0E121009, 0x0E131009, 0x0E141009,
+        },
+        {
+            0x0E151009, 0x0E161009, 0x0E171009, 0x0E181009, 0x0E191009, 0x0E1A1009,
+            0x0E1B1009, 0x0E1C1009, 0x0E1D1009, 0x0E1E1009, 0x0E1F1009, 0x0E201009,
+            0x0E211009, 0x0E221009, 0x0E231009, 0x0E241009,
+        },
+        {
+            0x0E251009, 0x0E261009, 0x0E271009, 0x0E281009, 0x0E291009, 0x0E2A1009,
+            0x0E2B1009, 0x0E2C1009, 0x0E2D1009, 0x0E2E1009, 0x0E2F1009, 0x0E301009,
+            0x0E311009, 0x0E321009, 0x0E331009, 0x0E341009,
+        },
+        {
+            0x0E351009, 0x0E361009, 0x0E371009, 0x0E381009, 0x0E391009, 0x0E3A1009,
+            0x0E3B1009, 0x0E3C1009, 0x0E3D1009, 0x0E3E1009, 0x0E3F1009, 0x0E401009,
+            0x0E411009, 0x0E421009, 0x0E431009, 0x0E441009,
+        },
+        {
+            0x0E451009, 0x0E461009, 0x0E471009, 0x0E481009, 0x0E491009, 0x0E4A1009,
+            0x0E4B1009, 0x0E4C1009, 0x0E4D1009, 0x0E4E1009, 0x0E4F1009, 0x0E501009,
+            0x0E511009, 0x0E521009, 0x0E531009, 0x0E541009,
+        },
+        {
+            0x0E551009, 0x0E561009, 0x0E571009, 0x0E581009, 0x00000000, 0x00000000,
+            0x0E591009, 0x0E5A1009, 0x0E5B1009, 0x0E5C1009, 0x0E5D1009, 0x0E5E1009,
+            0x0E5F1009, 0x0E601009, 0x0E611009, 0x0E621009,
+        },
+        {
+            0x0E631009, 0x0E641009, 0x0E651009, 0x0E661009, 0x0E671009, 0x0E681009,
+            0x0E691009, 0x0E6A1009, 0x0E6B1009, 0x0E6C1009, 0x0E6D1009, 0x0E6E1009,
+            0x0E6F1009, 0x0E701009, 0x0E711009, 0x0E721009,
+        },
+        {
+            0x0E731009, 0x0E741009, 0x0E751009, 0x0E761009, 0x0E771009, 0x0E781009,
+            0x00000000, 0x0E791009, 0x0E7A1009, 0x0E7B1009, 0x0E7C1009, 0x0E7D1009,
+            0x0E7E1009, 0x0E7F1009, 0x0E801009, 0x0E811009,
+        },
+        {
+            0x0E821009, 0x0E831009, 0x0E841009, 0x0E851009, 0x0E861009, 0x0E871009,
+            0x0E881009, 0x0E891009, 0x0E8A1009, 0x0E8B1009, 0x0E8C1009, 0x0E8D1009,
+            0x0E8E1009, 0x0E8F1009, 0x0E901009, 0x0E911009,
+        },
+        {
+            0x0E921009, 0x0E931009, 0x0E941009, 0x0E951009, 0x0E961009, 0x0E971009,
+            0x0E981009, 0x0E991009, 0x0E9A1009, 0x0E9B1009, 0x0E9C1009, 0x0E9D1009,
+            0x0E9E1009, 0x0E9F1009, 0x0EA01009, 0x0EA11009,
+        },
+        {
+            0x0EA21009, 0x0EA31009, 0x0EA41009, 0x0EA51009, 0x0EA61009, 0x0EA71009,
+            0x0EA81009, 0x0EA91009, 0x0EAA1009, 0x0EAB1009, 0x0EAC1009, 0x0EAD1009,
+            0x0EAE1009, 0x0EAF1009, 0x0EB01009, 0x0EB11009,
+        },
+        {
+            0x0EB21009, 0x0EB31009, 0x0EB41009, 0x0EB51009, 0x0EB61009, 0x0EB71009,
+            0x0EB81009, 0x0EB91009, 0x0EBA1009, 0x0EBB1009, 0x0EBC1009, 0x0EBD1009,
+            0x0EBE1009, 0x0EBF1009, 0x0EC01009, 0x0EC11009,
+        },
+        {
+            0x0EC21009, 0x0EC31009, 0x0EC41009, 0x0EC51009, 0x0EC61009, 0x0EC71009,
+            0x0EC81009, 0x0EC91009, 0x0ECA1009, 0x0ECB1009, 0x0ECC1009, 0x0ECD1009,
+            0x0ECE1009, 0x0ECF1009, 0x0ED01009, 0x0ED11009,
+        },
+        {
+            0x0ED21009, 0x0ED31009, 0x0ED41009, 0x0ED51009, 0x0ED61009, 0x0ED71009,
+            0x0ED81009, 0x0ED91009, 0x0EDA1009, 0x0EDB1009, 0x0EDC1009, 0x0EDD1009,
+            0x0EDE1009, 0x0EDF1009, 0x0EE01009, 0x0EE11009,
+        },
+        {
+            0x254A1021, 0x254B1021, 0x254C1021, 0x254D1021, 0x254E1021, 0x254F1021,
+            0x25501021, 0x25511021, 0x25521021, 0x25531021, 0x25541021, 0x25551021,
+            0x25561021, 0x25571021, 0x25581021, 0x25591021,
+        },
+        {
+            0x255A1021, 0x255B1021, 0x255C1021, 0x255D1021, 0x255E1021, 0x255F1021,
+            0x25601021, 0x25611021, 0x25621021, 0x25631021, 0x25641021, 0x25651021,
+            0x25661021, 0x25671021, 0x25681021, 0x25691021,
+        },
+        {
+            0x256A1021, 0x256B1021, 0x256C1021, 0x256D1021, 0x256E1021, 0x256F1021,
+            0x25701021, 0x25711021, 0x25721021, 0x25731021, 0x25741021, 0x25751021,
+            0x25761021, 0x25771021, 0x25781021, 0x00000000,
+        },
+        {
+            0x254A1009, 0x254B1009, 0x254C1009, 0x254D1009, 0x254E1009, 0x254F1009,
+            0x25501009, 0x25511009, 0x25521009, 0x25531009, 0x25541009, 0x25551009,
+            0x25561009, 0x25571009, 0x25581009, 0x25591009,
+        },
+        {
+            0x255A1009, 0x255B1009, 0x255C1009, 0x255D1009, 0x255E1009, 0x255F1009,
+            0x25601009, 0x25611009, 0x25621009, 0x25631009, 0x25641009, 0x25651009,
+            0x25661009, 0x25671009, 0x25681009, 0x25691009,
+        },
+        {
+            0x256A1009, 0x256B1009, 0x256C1009, 0x256D1009, 0x256E1009, 0x256F1009,
+            0x25701009, 0x25711009, 0x25721009, 0x25731009, 0x25741009, 0x25751009,
+            0x25761009, 0x25771009, 0x25781009, 0x00000000,
+        },
+        {
+            0x20E51021, 0x20E51009, 0x20E61021, 0x21701021, 0x21B71021, 0x1FA71009,
+            0x22001009, 0x20861021, 0x20861009, 0x20CE1021, 0x20CE1009, 0x22A11021,
+            0x22A11009, 0x1FB11021, 0x21101021, 0x1FAD1021,
+        },
+        {
+            0x1FB71021, 0x22521009, 0x225F1021, 0x225F1009, 0x22531009, 0x20871021,
+            0x20871009, 0x217F1009, 0x20141009, 0x21B21009, 0x215B1009, 0x20191009,
+            0x20AB1055, 0x22471075, 0x21DE1021, 0x229D1021,
+        },
+        {
+            0x234B1021, 0x234B1009, 0x234C1021, 0x234C1009, 0x234D1021, 0x234D1009,
+            0x234E1021, 0x234E1009, 0x234F1021, 0x234F1009, 0x23511021, 0x23511009,
+            0x23521021, 0x23521009, 0x23531021, 0x23531009,
+        },
+        {
+            0x23541021, 0x23541009, 0x23551021, 0x23551009, 0x23561021, 0x23561009,
+            0x23581021, 0x23581009, 0x23591021, 0x23591009, 0x235A1021, 0x235A1009,
+            0x235D1021, 0x235D1009, 0x235E1021, 0x235E1009,
+        },
+        {
+            0x235F1021, 0x235F1009, 0x23601021, 0x23601009, 0x23611021, 0x23611009,
+            0x23621021, 0x23621009, 0x23631021, 0x23631009, 0x23641021, 0x23641009,
+            0x23651021, 0x23651009, 0x23661021, 0x23661009,
+        },
+        {
+            0x23671021, 0x23671009, 0x23821021, 0x23821009, 0x23831021, 0x23831009,
+            0x23501021, 0x23501009, 0x23571021, 0x23571009, 0x235B1021, 0x235B1009,
+            0x235C1021, 0x235C1009, 0x23681021, 0x23681009,
+        },
+        {
+            0x23691021, 0x23691009, 0x236C1021, 0x236C1009, 0x236D1021, 0x236D1009,
+            0x236E1021, 0x236E1009, 0x23721021, 0x23721009, 0x23741021, 0x23741009,
+            0x23751021, 0x23751009, 0x23761021, 0x23761009,
+        },
+        {
+            0x23771021, 0x23771009, 0x23781021, 0x23781009, 0x23791021, 0x23791009,
+            0x237C1021, 0x237C1009, 0x237E1021, 0x237E1009, 0x237F1021, 0x237F1009,
+            0x23801021, 0x23801009, 0x23841021, 0x23841009,
+        },
+        {
+            0x23851021, 0x23851009, 0x23861021, 0x23861009, 0x000B640E, 0x0EE21009,
+            0x0EE31009, 0x0EE41009, 0x0EE51009, 0x0EE61009, 0x0EE71009, 0x236B1021,
+            0x236B1009, 0x237B1021, 0x237B1009, 0x00001989,
+        },
+        {
+            0x00001189, 0x00001109, 0x23711021, 0x23711009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x02881009, 0x02751009, 0x02761009,
+            0x03071009, 0x1DB71009, 0x02891009, 0x03081009,
+        },
+        {
+            0x25A01009, 0x25A21009, 0x25A41009, 0x25A61009, 0x25A81009, 0x25AA1009,
+            0x25AC1009, 0x25B01009, 0x25B21009, 0x25B41009, 0x25B61009, 0x25B81009,
+            0x25BA1009, 0x25BE1009, 0x25C01009, 0x25C21009,
+        },
+        {
+            0x25C41009, 0x25C61009, 0x25C81009, 0x25CC1009, 0x25CE1009, 0x25D01009,
+            0x25D21009, 0x25D41009, 0x25D61009, 0x25D81009, 0x25DA1009, 0x25DC1009,
+            0x25DE1009, 0x25E01009, 0x25E21009, 0x25E61009,
+        },
+        {
+            0x25E81009, 0x25AE1009, 0x25BC1009, 0x25CA1009, 0x25E41009, 0x25EA1009,
+            0x00000000, 0x25ED1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x25F21009, 0x00000000, 0x00000000,
+        },
+        {
+            0x27D91009, 0x27DA1009, 0x27DB1009, 0x27DC1009, 0x27DD1009, 0x27DE1009,
+            0x27DF1009, 0x27E01009, 0x27E11009, 0x27E21009, 0x27E31009, 0x27E41009,
+            0x27E61009, 0x27E71009, 0x27E81009, 0x27E91009,
+        },
+        {
+            0x27EA1009, 0x27EB1009, 0x27EC1009, 0x27ED1009, 0x27EE1009, 0x27EF1009,
+            0x27F01009, 0x27F11009, 0x27F21009, 0x27F31009, 0x27F41009, 0x27F51009,
+            0x27F61009, 0x27F71009, 0x27F81009, 0x27F91009,
+        },
+        {
+            0x27FA1009, 0x27FB1009, 0x27FC1009, 0x27FD1009, 0x27FF1009, 0x28001009,
+            0x28011009, 0x28021009, 0x28031009, 0x28041009, 0x28051009, 0x28061009,
+            0x28071009, 0x28081009, 0x28091009, 0x280A1009,
+        },
+        {
+            0x280B1009, 0x280C1009, 0x280D1009, 0x280E1009, 0x280F1009, 0x28101009,
+            0x27E51009, 0x27FE1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x28111009,
+        },
+        {
+            0x04531009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000001,
+        },
+        {
+            0x28221009, 0x28371009, 0x28481009, 0x28511009, 0x28601009, 0x28861009,
+            0x28971009, 0x28A01009, 0x28B61009, 0x28BF1009, 0x28C81009, 0x28F91009,
+            0x29181009, 0x29271009, 0x29301009, 0x29521009,
+        },
+        {
+            0x295B1009, 0x296B1009, 0x299B1009, 0x29461009, 0x29471009, 0x29481009,
+            0x29491009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x299F1009, 0x29A01009, 0x29A11009, 0x29A21009, 0x29A31009, 0x29A41009,
+            0x29A51009, 0x00000000, 0x29A61009, 0x29A71009, 0x29A81009, 0x29A91009,
+            0x29AA1009, 0x29AB1009, 0x29AC1009, 0x00000000,
+        },
+        {
+            0x29AD1009, 0x29AE1009, 0x29AF1009, 0x29B01009, 0x29B11009, 0x29B21009,
+            0x29B31009, 0x00000000, 0x29B41009, 0x29B51009, 0x29B61009, 0x29B71009,
+            0x29B81009, 0x29B91009, 0x29BA1009, 0x00000000,
+        },
+        {
+            0x29BB1009, 0x29BC1009, 0x29BD1009, 0x29BE1009, 0x29BF1009, 0x29C01009,
+            0x29C11009, 0x00000000, 0x29C21009, 0x29C31009, 0x29C41009, 0x29C51009,
+            0x29C61009, 0x29C71009, 0x29C81009, 0x00000000,
+        },
+        {
+            0x29C91009, 0x29CA1009, 0x29CB1009, 0x29CC1009, 0x29CD1009, 0x29CE1009,
+            0x29CF1009, 0x00000000, 0x29D01009, 0x29D11009, 0x29D21009, 0x29D31009,
+            0x29D41009, 0x29D51009, 0x29D61009, 0x00000000,
+        },
+        {
+            0x23931011, 0x23971011, 0x239B1011, 0x23AF1011, 0x23C71011, 0x23D11011,
+            0x23FB1011, 0x24151011, 0x24281011, 0x24311011, 0x244C1011, 0x24541011,
+            0x24611011, 0x246A1011, 0x24731011, 0x24971011,
+        },
+        {
+            0x24BE1011, 0x24C91011, 0x24E81011, 0x24ED1011, 0x25381011, 0x000B700A,
+            0x23871011, 0x23BF1011, 0x23FA1011, 0x248E1011, 0x25051011, 0x250E1011,
+            0x25131011, 0x251D1011, 0x25221011, 0x252C1011,
+        },
+        {
+            0x03CB1009, 0x03CC1009, 0x036C1009, 0x036D1009, 0x036E1009, 0x036F1009,
+            0x03CD1009, 0x03CE1009, 0x03CF1009, 0x03701009, 0x03711009, 0x03D01009,
+            0x03721009, 0x03731009, 0x03D11009, 0x03D21009,
+        },
+        {
+            0x03D31009, 0x03D41009, 0x03D51009, 0x03D61009, 0x03D71009, 0x03D81009,
+            0x03D91009, 0x021C1009, 0x027D1009, 0x03091009, 0x03DA1009, 0x03DB1009,
+            0x03741009, 0x03751009, 0x03DC1009, 0x03DD1009,
+        },
+        {
+            0x03761009, 0x03771009, 0x03781009, 0x03791009, 0x037A1009, 0x037B1009,
+            0x037C1009, 0x037D1009, 0x037E1009, 0x037F1009, 0x03021009, 0x03031009,
+            0x03041009, 0x03051009, 0x026F1009, 0x24F21009,
+        },
+        {
+            0x028A1009, 0x02941009, 0x02251009, 0x02951009, 0x02241009, 0x023D1009,
+            0x03B51009, 0x03B61009, 0x03B71009, 0x039B1009, 0x02181009, 0x02191009,
+            0x028B1009, 0x03061009, 0x03951009, 0x039F1009,
+        },
+        {
+            0x021D1009, 0x02261009, 0x03221009, 0x021B1009, 0x03DE1009, 0x03DF1009,
+            0x03E01009, 0x03E11009, 0x03E21009, 0x023F1009, 0x03A81009, 0x03B81009,
+            0x02271009, 0x039E1009, 0x02281009, 0x02291009,
+        },
+        {
+            0x0B5D1009, 0x0B5E1009, 0x03AB1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x000B780E, 0x000B840E, 0x000B900A, 0x000B980A, 0x000BA00E, 0x000BAC0A,
+            0x000BB40E, 0x000BC00E, 0x000BCC0E, 0x000BD80A, 0x000BE00E, 0x000BEC0E,
+            0x000BF80E, 0x000C040E, 0x000C100E, 0x000C1C0A,
+        },
+        {
+            0x000C240A, 0x000C2C0E, 0x000C380A, 0x000C400A, 0x000C480A, 0x000C500E,
+            0x000C5C0A, 0x000C640E, 0x000C700A, 0x000C780A, 0x00000000, 0x000C800A,
+            0x000C880E, 0x000C940E, 0x000CA00E, 0x000CAC0A,
+        },
+        {
+            0x000CB40A, 0x000CBC0A, 0x000CC40A, 0x000CCC0A, 0x000CD40A, 0x000CDC0E,
+            0x000CE80A, 0x000CF00E, 0x000CFC0A, 0x000D040E, 0x000D100E, 0x000D1C0E,
+            0x000D280E, 0x000D340A, 0x000D3C0E, 0x000D480A,
+        },
+        {
+            0x000D500A, 0x000D580A, 0x000D600A, 0x000D680E, 0x000D740E, 0x000D800E,
+            0x000D8C0E, 0x000D980E, 0x000DA40A, 0x000DAC0A, 0x000DB40A, 0x000DBC0E,
+            0x000DC80E, 0x000DD40E, 0x000DE00A, 0x000DE80E,
+        },
+        {
+            0x000DF40E, 0x000E000A, 0x000E080A, 0x000E100A, 0x000E180A, 0x000E200A,
+            0x000E280A, 0x000E300E, 0x000E3C0A, 0x000E440A, 0x000E4C0E, 0x000E580A,
+            0x000E600A, 0x000E680E, 0x000E740E, 0x000E800E,
+        },
+        {
+            0x000E8C0A, 0x000E940A, 0x000E9C0A, 0x000EA40A, 0x000EAC0A, 0x000EB40E,
+            0x000EC00A, 0x000EC80E, 0x000ED40A, 0x000EDC0A, 0x000EE40A, 0x000EEC0A,
+            0x000EF40A, 0x000EFC0A, 0x000F040E, 0x000F100A,
+        },
+        {
+            0x000F180A, 0x000F200E, 0x000F2C0A, 0x000F340E, 0x000F400E, 0x000F4C0A,
+            0x000F540A, 0x000F5C0E, 0x000F680A, 0x000F700A, 0x000F780A, 0x000F800E,
+            0x000F8C0A, 0x000F940E, 0x000FA00A, 0x000FA80E,
+        },
+        {
+            0x000FB40A, 0x000FBC0E, 0x000FC80E, 0x000FD40A, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x000FDC0A, 0x000FE40A, 0x000FEC0A, 0x000FF40A, 0x000FFC0A, 0x0010040A,
+            0x00100C0A, 0x0010140A, 0x00101C0A, 0x0010240A, 0x00102C0A, 0x0010340A,
+            0x00103C0A, 0x0010440A, 0x00104C0A, 0x0010540A,
+        },
+        {
+            0x00105C0A, 0x0010640A, 0x00106C0A, 0x0010740A, 0x00107C0A, 0x0010840A,
+            0x00108C0A, 0x0010940A, 0x00109C0A, 0x0010A40A, 0x0010AC0A, 0x0010B40A,
+            0x0010BC0A, 0x0010C40A, 0x0010CC0A, 0x0010D40A,
+        },
+        {
+            0x0010DC0A, 0x0010E40A, 0x0010EC0A, 0x0010F40A, 0x0010FC0A, 0x0011040A,
+            0x00110C0A, 0x0011140A, 0x00111C0A, 0x0011240A, 0x000C240A, 0x00112C0A,
+            0x0011340A, 0x00113C0A, 0x0011440A, 0x00114C0A,
+        },
+        {
+            0x0011540A, 0x00115C0A, 0x0011640A, 0x000C400A, 0x00116C0A, 0x0011740A,
+            0x00117C0A, 0x0011840A, 0x00118C0A, 0x0011940A, 0x00119C0A, 0x0011A40A,
+            0x0011AC0A, 0x0011B40A, 0x0011BC0A, 0x0011C40A,
+        },
+        {
+            0x0011CC0A, 0x0011D40A, 0x0011DC0A, 0x0011E40A, 0x0011EC0A, 0x0011F40A,
+            0x0011FC0A, 0x0012040A, 0x00120C0A, 0x0012140A, 0x00121C0A, 0x0012240A,
+            0x00122C0A, 0x0012340A, 0x00123C0A, 0x0012440A,
+        },
+        {
+            0x00124C0A, 0x0012540A, 0x00125C0A, 0x0012640A, 0x00126C0A, 0x0012740A,
+            0x00127C0A, 0x0012840A, 0x00128C0A, 0x0012940A, 0x00129C0A, 0x0012A40A,
+            0x0012AC0A, 0x0012B40A, 0x0012BC0A, 0x0012C40A,
+        },
+        {
+            0x0012CC0A, 0x0012D40A, 0x0012DC0A, 0x0012E40A, 0x0012EC0A, 0x0012F40A,
+            0x0012FC0A, 0x0013040A, 0x00130C0A, 0x0013140A, 0x00131C0A, 0x0013240A,
+            0x00132C0A, 0x0013340A, 0x00133C0A, 0x0013440A,
+        },
+        {
+            0x00134C0A, 0x0013540A, 0x00135C0A, 0x0013640A, 0x00136C0A, 0x0013740A,
+            0x00137C0A, 0x0013840A, 0x00138C0A, 0x0013940A, 0x00139C0A, 0x0013A40A,
+            0x0013AC0A, 0x0013B40A, 0x0013BC0A, 0x0013C40A,
+        },
+        {
+            0x0013CC0A, 0x0013D40A, 0x0013DC0A, 0x0013E40A, 0x0013EC0A, 0x0013F40A,
+            0x0013FC0A, 0x0014040A, 0x00140C0A, 0x0014140A, 0x00141C0A, 0x0014240A,
+            0x00142C0A, 0x0014340A, 0x00143C0A, 0x0014440A,
+        },
+        {
+            0x00144C0A, 0x0014540A, 0x00145C0A, 0x000E280A, 0x0014640A, 0x00146C0A,
+            0x0014740A, 0x00147C0A, 0x0014840A, 0x00148C0A, 0x0014940A, 0x00149C0A,
+            0x0014A40A, 0x0014AC0A, 0x0014B40A, 0x0014BC0A,
+        },
+        {
+            0x0014C40A, 0x0014CC0A, 0x0014D40A, 0x0014DC0A, 0x0014E40A, 0x0014EC0A,
+            0x0014F40A, 0x000E940A, 0x0014FC0A, 0x0015040A, 0x00150C0A, 0x0015140A,
+            0x00151C0A, 0x0015240A, 0x00152C0A, 0x0015340A,
+        },
+        {
+            0x00153C0A, 0x0015440A, 0x00154C0A, 0x0015540A, 0x00155C0A, 0x0015640A,
+            0x00156C0A, 0x000EFC0A, 0x0015740A, 0x00157C0A, 0x0015840A, 0x00158C0A,
+            0x0015940A, 0x00159C0A, 0x0015A40A, 0x0015AC0A,
+        },
+        {
+            0x0015B40A, 0x0015BC0A, 0x0015C40A, 0x0015CC0A, 0x0015D40A, 0x0015DC0A,
+            0x0015E40A, 0x0015EC0A, 0x0015F40A, 0x0015FC0A, 0x0016040A, 0x00160C0A,
+            0x0016140A, 0x00161C0A, 0x0016240A, 0x00162C0A,
+        },
+        {
+            0x0016340A, 0x00163C0A, 0x0016440A, 0x00164C0A, 0x0016540A, 0x00165C0A,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1D1B1009, 0x1D1C1009, 0x1D1D1009, 0x1D1E1009, 0x1D1F1009, 0x1D201009,
+            0x1D211009, 0x1D221009, 0x1D231009, 0x1D241009, 0x1D251009, 0x1D261009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x0209100D, 0x02361009, 0x02921009, 0x03C11009, 0x1D4B1009, 0x1F571009,
+            0x0016640A, 0x1F981009, 0x03801009, 0x03811009, 0x03821009, 0x03831009,
+            0x03841009, 0x03851009, 0x03861009, 0x03871009,
+        },
+        {
+            0x03881009, 0x03891009, 0x1D4C1009, 0x1D4D1009, 0x038A1009, 0x038B1009,
+            0x038C1009, 0x038D1009, 0x038E1009, 0x038F1009, 0x03901009, 0x03911009,
+            0x021E1009, 0x03231009, 0x03241009, 0x03251009,
+        },
+        {
+            0x1D4E1009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00008089, 0x00008109,
+            0x00008189, 0x00008209, 0x00008289, 0x00008309,
+        },
+        {
+            0x021F1009, 0x1F5C1009, 0x00166C0A, 0x1F5D1009, 0x0016740A, 0x1F5E1009,
+            0x1D4C1011, 0x1D4F1009, 0x0010940A, 0x00167C0A, 0x0016840A, 0x1F581009,
+            0x00168C0A, 0x03C21009, 0x1D501009, 0x1D511009,
+        },
+        {
+            0x00000000, 0x42DA1035, 0x42DA1039, 0x42DB1035, 0x42DB1039, 0x42DC1035,
+            0x42DC1039, 0x42DE1035, 0x42DE1039, 0x42DF1035, 0x42DF1039, 0x42E01039,
+            0x00000000, 0x42E11039, 0x00000000, 0x42E21039,
+        },
+        {
+            0x00000000, 0x42E31039, 0x00000000, 0x42E41039, 0x00000000, 0x42E51039,
+            0x00000000, 0x42E61039, 0x00000000, 0x42E71039, 0x00000000, 0x42E81039,
+            0x00000000, 0x42E91039, 0x00000000, 0x42EA1039,
+        },
+        {
+            0x00000000, 0x42EB1039, 0x00000000, 0x42EC1035, 0x42EC1039, 0x00000000,
+            0x42ED1039, 0x00000000, 0x42EE1039, 0x00000000, 0x42EF1039, 0x42F01039,
+            0x42F11039, 0x42F21039, 0x42F31039, 0x42F41039,
+        },
+        {
+            0x00000000, 0x00000000, 0x42F51039, 0x00000000, 0x00000000, 0x42F61039,
+            0x00000000, 0x00000000, 0x42F71039, 0x00000000, 0x00000000, 0x42F81039,
+            0x00000000, 0x00000000, 0x42F91039, 0x42FA1039,
+        },
+        {
+            0x42FB1039, 0x42FC1039, 0x42FD1039, 0x42FE1035, 0x42FE1039, 0x42FF1035,
+            0x42FF1039, 0x43001035, 0x43001039, 0x43011039, 0x43021039, 0x43031039,
+            0x43041039, 0x43051039, 0x43061035, 0x43061039,
+        },
+        {
+            0x43071039, 0x43081039, 0x43091039, 0x430A1039, 0x00000000, 0x42E01035,
+            0x42E31035, 0x00000000, 0x00000000, 0x00001B89, 0x00001C09, 0x04C31009,
+            0x04C41009, 0x1F5F1009, 0x00000000, 0x0016940A,
+        },
+        {
+            0x02201009, 0x42DA103D, 0x42DA1045, 0x42DB103D, 0x42DB1045, 0x42DC103D,
+            0x42DC1045, 0x42DE103D, 0x42DE1045, 0x42DF103D, 0x42DF1045, 0x42E01045,
+            0x00000000, 0x42E11045, 0x00000000, 0x42E21045,
+        },
+        {
+            0x00000000, 0x42E31045, 0x00000000, 0x42E41045, 0x00000000, 0x42E51045,
+            0x00000000, 0x42E61045, 0x00000000, 0x42E71045, 0x00000000, 0x42E81045,
+            0x00000000, 0x42E91045, 0x00000000, 0x42EA1045,
+        },
+        {
+            0x00000000, 0x42EB1045, 0x00000000, 0x42EC103D, 0x42EC1045, 0x00000000,
+            0x42ED1045, 0x00000000, 0x42EE1045, 0x00000000, 0x42EF1045, 0x42F01045,
+            0x42F11045, 0x42F21045, 0x42F31045, 0x42F41045,
+        },
+        {
+            0x00000000, 0x00000000, 0x42F51045, 0x00000000, 0x00000000, 0x42F61045,
+            0x00000000, 0x00000000, 0x42F71045, 0x00000000, 0x00000000, 0x42F81045,
+            0x00000000, 0x00000000, 0x42F91045, 0x42FA1045,
+        },
+        {
+            0x42FB1045, 0x42FC1045, 0x42FD1045, 0x42FE103D, 0x42FE1045, 0x42FF103D,
+            0x42FF1045, 0x4300103D, 0x43001045, 0x43011045, 0x43021045, 0x43031045,
+            0x43041045, 0x43051045, 0x4306103D, 0x43061045,
+        },
+        {
+            0x43071045, 0x43081045, 0x43091045, 0x430A1045, 0x00000000, 0x42E0103D,
+            0x42E3103D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02211009,
+            0x1F601009, 0x1F611009, 0x00000000, 0x00169C0A,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x44291009,
+            0x442A1009, 0x442B1009, 0x442D1009, 0x442F1009, 0x44301009, 0x44311009,
+            0x44331009, 0x44341009, 0x44351009, 0x44381009,
+        },
+        {
+            0x44391009, 0x443A1009, 0x443B1009, 0x443F1009, 0x44401009, 0x44411009,
+            0x44421009, 0x44431009, 0x44441009, 0x44451009, 0x44491009, 0x444A1009,
+            0x444C1009, 0x444D1009, 0x444F1009, 0x44501009,
+        },
+        {
+            0x44511009, 0x44521009, 0x44531009, 0x44541009, 0x44551009, 0x44571009,
+            0x445A1009, 0x445B1009, 0x445C1009, 0x445D1009, 0x442E1009, 0x44361009,
+            0x443C1009, 0x445E1009, 0x444C1011, 0x44321009,
+        },
+        {
+            0x00000000, 0x41751011, 0x41761011, 0x42531011, 0x41771011, 0x42551011,
+            0x42561011, 0x41781011, 0x41791011, 0x417A1011, 0x42591011, 0x425A1011,
+            0x425B1011, 0x425C1011, 0x425D1011, 0x425E1011,
+        },
+        {
+            0x418F1011, 0x417B1011, 0x417C1011, 0x417D1011, 0x41961011, 0x417E1011,
+            0x417F1011, 0x41801011, 0x41811011, 0x41821011, 0x41831011, 0x41841011,
+            0x41851011, 0x41861011, 0x41871011, 0x41F31011,
+        },
+        {
+            0x41F41011, 0x41F51011, 0x41F61011, 0x41F71011, 0x41F81011, 0x41F91011,
+            0x41FA1011, 0x41FB1011, 0x41FC1011, 0x41FD1011, 0x41FE1011, 0x41FF1011,
+            0x42001011, 0x42011011, 0x42021011, 0x42031011,
+        },
+        {
+            0x42041011, 0x42051011, 0x42061011, 0x42071011, 0x41F21011, 0x41891011,
+            0x418A1011, 0x42701011, 0x42711011, 0x42751011, 0x42771011, 0x427C1011,
+            0x42801011, 0x42821011, 0x41911011, 0x42861011,
+        },
+        {
+            0x42881011, 0x41921011, 0x41931011, 0x41951011, 0x41971011, 0x41981011,
+            0x419C1011, 0x419E1011, 0x41A01011, 0x41A11011, 0x41A21011, 0x41A31011,
+            0x41A41011, 0x41A71011, 0x41AB1011, 0x41B51011,
+        },
+        {
+            0x41BC1011, 0x41C11011, 0x429A1011, 0x429B1011, 0x41CC1011, 0x41CD1011,
+            0x41CE1011, 0x42161011, 0x42171011, 0x421A1011, 0x42231011, 0x42241011,
+            0x42261011, 0x42301011, 0x42331011, 0x00000000,
+        },
+        {
+            0x1D521009, 0x1D531009, 0x0016A40A, 0x0016AC0A, 0x0016B40A, 0x0016BC0A,
+            0x0016C40A, 0x0016CC0A, 0x0016D40A, 0x0016DC0A, 0x0016E40A, 0x0016EC0A,
+            0x0016F40A, 0x0016FC0A, 0x0017040A, 0x00170C0A,
+        },
+        {
+            0x0017140A, 0x00171C0A, 0x0017240A, 0x00172C0A, 0x444E1009, 0x0017340A,
+            0x444B1009, 0x00173C0A, 0x0017440A, 0x00174C0A, 0x0017540A, 0x00175C0A,
+            0x442C1009, 0x44371009, 0x0017640A, 0x00176C0A,
+        },
+        {
+            0x44581009, 0x44591009, 0x44561009, 0x0017740A, 0x442A1065, 0x44301065,
+            0x44351065, 0x44381065, 0x44461009, 0x44471009, 0x44481009, 0x44341065,
+            0x443D1009, 0x443E1009, 0x445F1009, 0x44601009,
+        },
+        {
+            0x1D271009, 0x1D281009, 0x1D291009, 0x1D2A1009, 0x1D2B1009, 0x1D2C1009,
+            0x1D2D1009, 0x1D2E1009, 0x1D2F1009, 0x1D301009, 0x1D311009, 0x1D321009,
+            0x1D331009, 0x1D341009, 0x1D351009, 0x1D361009,
+        },
+        {
+            0x1D371009, 0x1D381009, 0x1D391009, 0x1D3A1009, 0x1D3B1009, 0x1D3C1009,
+            0x1D3D1009, 0x1D3E1009, 0x1D3F1009, 0x1D401009, 0x1D411009, 0x1D421009,
+            0x1D431009, 0x1D441009, 0x1D451009, 0x1D461009,
+        },
+        {
+            0x1D471009, 0x1D481009, 0x1D491009, 0x1D4A1009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x42E2103D, 0x42E6103D, 0x42E7103D, 0x42EE103D, 0x42F1103D, 0x42F4103D,
+            0x42F5103D, 0x42F6103D, 0x42F7103D, 0x42F8103D, 0x42FB103D, 0x4301103D,
+            0x4302103D, 0x4303103D, 0x4304103D, 0x4305103D,
+        },
+        {
+            0x00177C0E, 0x0017880E, 0x0017940E, 0x0017A00E, 0x0017AC0E, 0x0017B80E,
+            0x0017C40E, 0x0017D00E, 0x0017DC0E, 0x0017E80E, 0x0017F40E, 0x0018000E,
+            0x00180C0E, 0x0018180E, 0x00182412, 0x00183412,
+        },
+        {
+            0x00184412, 0x00185412, 0x00186412, 0x00187412, 0x00188412, 0x00189412,
+            0x0018A412, 0x0018B412, 0x0018C412, 0x0018D412, 0x0018E412, 0x0018F412,
+            0x00190412, 0x0019141E, 0x0019301A, 0x00000000,
+        },
+        {
+            0x00194812, 0x00195812, 0x00196812, 0x00197812, 0x00198812, 0x00199812,
+            0x0019A812, 0x0019B812, 0x0019C812, 0x0019D812, 0x0019E812, 0x0019F812,
+            0x001A0812, 0x001A1812, 0x001A2812, 0x001A3812,
+        },
+        {
+            0x001A4812, 0x001A5812, 0x001A6812, 0x001A7812, 0x001A8812, 0x001A9812,
+            0x001AA812, 0x001AB812, 0x001AC812, 0x001AD812, 0x001AE812, 0x001AF812,
+            0x001B0812, 0x001B1812, 0x001B2812, 0x001B3812,
+        },
+        {
+            0x001B4812, 0x001B5812, 0x001B6812, 0x001B7812, 0x001B880A, 0x001B900A,
+            0x001B980A, 0x001BA00A, 0x0007BC0A, 0x00080C0A, 0x001BA80A, 0x001BB00A,
+            0x001BB80A, 0x001BC00A, 0x001BC80A, 0x001BD00A,
+        },
+        {
+            0x001BD80E, 0x001BE40A, 0x001BEC0A, 0x001BF40A, 0x001BFC0A, 0x001C040A,
+            0x001C0C0A, 0x001C140A, 0x001C1C0A, 0x001C240A, 0x001BA80A, 0x001C2C0A,
+            0x001C340A, 0x001C3C0A, 0x001C440A, 0x001C4C0A,
+        },
+        {
+            0x41751019, 0x41771019, 0x41781019, 0x417A1019, 0x417B1019, 0x417C1019,
+            0x417E1019, 0x41801019, 0x41811019, 0x41831019, 0x41841019, 0x41851019,
+            0x41861019, 0x41871019, 0x001C540A, 0x001C5C0A,
+        },
+        {
+            0x001C640A, 0x001C6C0A, 0x001C740A, 0x001C7C0A, 0x001C840A, 0x001C8C0A,
+            0x001C940A, 0x001C9C0A, 0x001CA40A, 0x001CAC0A, 0x001CB40A, 0x001CBC0A,
+            0x001CC416, 0x001CD812, 0x001CE80A, 0x1D541009,
+        },
+        {
+            0x001CF00A, 0x001CF80A, 0x001D000A, 0x001D080A, 0x001D100A, 0x001D180A,
+            0x001D200A, 0x001D280A, 0x001D300A, 0x001D380A, 0x001D400A, 0x001D480A,
+            0x001D500A, 0x001D580A, 0x001D600A, 0x001D680A,
+        },
+        {
+            0x001D700A, 0x001D780A, 0x001D800A, 0x001D880A, 0x001D900A, 0x001D980A,
+            0x001DA00A, 0x001DA80A, 0x001DB00A, 0x001DB80A, 0x001DC00A, 0x001DC80A,
+            0x001DD00A, 0x001DD80A, 0x001DE00A, 0x001DE80A,
+        },
+        {
+            0x001DF00A, 0x001DF80A, 0x001E000A, 0x001E080A, 0x001E100A, 0x001E180A,
+            0x001E200A, 0x001E280A, 0x001E300A, 0x001E380A, 0x001E400A, 0x001E480A,
+            0x001E500A, 0x001E580A, 0x001E600A, 0x001E680A,
+        },
+        {
+            0x001E700A, 0x001E780A, 0x001E800A, 0x001E880A, 0x001E900A, 0x001BB00A,
+            0x001E980A, 0x001EA00A, 0x001EA80A, 0x001EB00A, 0x001EB80A, 0x001EC00A,
+            0x001EC80A, 0x001ED00A, 0x001ED80A, 0x001BB80A,
+        },
+        {
+            0x001EE00E, 0x001EEC0E, 0x001EF80E, 0x001F040E, 0x001F100E, 0x001F1C0E,
+            0x001F280E, 0x001F340E, 0x001F400E, 0x001F4C12, 0x001F5C12, 0x001F6C12,
+            0x001F7C0A, 0x001F840E, 0x001F900A, 0x001F980E,
+        },
+        {
+            0x42DA104D, 0x42DB104D, 0x42DC104D, 0x42DE104D, 0x42DF104D, 0x42E0104D,
+            0x42E1104D, 0x42E2104D, 0x42E3104D, 0x42E4104D, 0x42E5104D, 0x42E6104D,
+            0x42E7104D, 0x42E8104D, 0x42E9104D, 0x42EA104D,
+        },
+        {
+            0x42EB104D, 0x42EC104D, 0x42ED104D, 0x42EE104D, 0x42EF104D, 0x42F0104D,
+            0x42F1104D, 0x42F2104D, 0x42F3104D, 0x42F4104D, 0x42F5104D, 0x42F6104D,
+            0x42F7104D, 0x42F8104D, 0x42F9104D, 0x42FA104D,
+        },
+        {
+            0x42FB104D, 0x42FC104D, 0x42FD104D, 0x42FE104D, 0x42FF104D, 0x4300104D,
+            0x4301104D, 0x4302104D, 0x4303104D, 0x4304104D, 0x4305104D, 0x4306104D,
+            0x4307104D, 0x4308104D, 0x4309104D, 0x001FA412,
+        },
+        {
+            0x001FB416, 0x001FC812, 0x001FD816, 0x001FEC0E, 0x001FF816, 0x00200C0E,
+            0x0020180E, 0x0020241A, 0x00203C12, 0x00204C0E, 0x0020580E, 0x0020640E,
+            0x00207012, 0x00208012, 0x00209012, 0x0020A012,
+        },
+        {
+            0x0020B012, 0x0020C012, 0x0020D012, 0x0020E01A, 0x0020F80A, 0x0021001A,
+            0x0021181A, 0x00213016, 0x00214412, 0x0021541A, 0x00216C1A, 0x00218412,
+            0x0021940E, 0x0021A00E, 0x0021AC12, 0x0021BC12,
+        },
+        {
+            0x0021CC16, 0x0021E016, 0x0021F40E, 0x0022000E, 0x00220C12, 0x00221C0E,
+            0x0022280E, 0x0022340A, 0x00223C0A, 0x0022440E, 0x0022500E, 0x00225C1A,
+            0x00227412, 0x00228416, 0x0022981A, 0x0022B012,
+        },
+        {
+            0x0022C00E, 0x0022CC0E, 0x0022D81A, 0x0022F012, 0x0023001A, 0x0023180E,
+            0x00232416, 0x0023380E, 0x00234412, 0x0023540E, 0x00236012, 0x00237016,
+            0x00238412, 0x00239416, 0x0023A812, 0x0023B80A,
+        },
+        {
+            0x0023C016, 0x0023D40E, 0x0023E00E, 0x0023EC12, 0x0023FC0E, 0x0024080E,
+            0x0024140E, 0x00242016, 0x00243412, 0x0024440A, 0x00244C1A, 0x0024640E,
+            0x00247016, 0x00248412, 0x00249412, 0x0024A40E,
+        },
+        {
+            0x0024B00E, 0x0024BC12, 0x0024CC0A, 0x0024D412, 0x0024E416, 0x0024F80A,
+            0x0025001A, 0x0025180E, 0x0025240E, 0x0025300E, 0x00253C0E, 0x0025480E,
+            0x0025540E, 0x0025600E, 0x00256C0E, 0x0025780E,
+        },
+        {
+            0x0025840E, 0x0025900E, 0x00259C12, 0x0025AC12, 0x0025BC12, 0x0025CC12,
+            0x0025DC12, 0x0025EC12, 0x0025FC12, 0x00260C12, 0x00261C12, 0x00262C12,
+            0x00263C12, 0x00264C12, 0x00265C12, 0x00266C12,
+        },
+        {
+            0x00267C12, 0x00268C0E, 0x0026980A, 0x0026A00A, 0x0026A80E, 0x0026B40A,
+            0x0026BC0A, 0x0026C40A, 0x0026CC0E, 0x0026D80E, 0x0026E40A, 0x0026EC12,
+            0x0026FC12, 0x00270C12, 0x00271C12, 0x00272C22,
+        },
+        {
+            0x00274C0A, 0x0027540A, 0x00275C0A, 0x0027640A, 0x00276C0A, 0x0027740A,
+            0x00277C0A, 0x0027840A, 0x00278C0E, 0x00279812, 0x0027A80A, 0x0027B00A,
+            0x0027B80A, 0x0027C00A, 0x0027C80A, 0x0027D00A,
+        },
+        {
+            0x0027D80A, 0x0027E00E, 0x0027EC0E, 0x0027F80E, 0x0028040E, 0x0028100A,
+            0x0028180A, 0x0028200A, 0x0028280A, 0x0028300A, 0x0028380A, 0x0028400A,
+            0x0028480A, 0x0028500A, 0x0028580A, 0x0028600E,
+        },
+        {
+            0x00286C0E, 0x0028780A, 0x0028800E, 0x00288C0E, 0x0028980E, 0x0028A40A,
+            0x0028AC0E, 0x0028B80E, 0x0028C412, 0x0028D40A, 0x0028DC0E, 0x0028E80E,
+            0x0028F40E, 0x0029000E, 0x00290C16, 0x0029201A,
+        },
+        {
+            0x0029380A, 0x0029400A, 0x0029480A, 0x0029500A, 0x0029580A, 0x0029600A,
+            0x0029680A, 0x0029700A, 0x0029780A, 0x0029800A, 0x0029880A, 0x0029900A,
+            0x0029980A, 0x0029A00A, 0x0029A80A, 0x0029B00A,
+        },
+        {
+            0x0029B80A, 0x0029C00A, 0x0029C812, 0x0029D80A, 0x0029E00A, 0x0029E80A,
+            0x0029F012, 0x002A000E, 0x002A0C0A, 0x002A140A, 0x002A1C0A, 0x002A240A,
+            0x002A2C0A, 0x002A340A, 0x002A3C0A, 0x002A440A,
+        },
+        {
+            0x002A4C0A, 0x002A540A, 0x002A5C0E, 0x002A680A, 0x002A700A, 0x002A780E,
+            0x002A840E, 0x002A900A, 0x002A9812, 0x002AA80E, 0x002AB40A, 0x002ABC0A,
+            0x002AC40A, 0x002ACC0A, 0x002AD40E, 0x002AE00E,
+        },
+        {
+            0x002AEC0E, 0x002AF80E, 0x002B040E, 0x002B100E, 0x002B1C0E, 0x002B280E,
+            0x002B340E, 0x002B400E, 0x002B4C0E, 0x002B5812, 0x002B6812, 0x002B7812,
+            0x002B8812, 0x002B9812, 0x002BA812, 0x002BB812,
+        },
+        {
+            0x002BC812, 0x002BD812, 0x002BE812, 0x002BF812, 0x002C0812, 0x002C1812,
+            0x002C2812, 0x002C3812, 0x002C4812, 0x002C5812, 0x002C6812, 0x002C7812,
+            0x002C8812, 0x002C9812, 0x002CA812, 0x002CB80E,
+        },
+        {
+            0x0FF61009, 0x0FF71009, 0x0FF81009, 0x0FF91009, 0x0FFA1009, 0x0FFB1009,
+            0x0FFC1009, 0x0FFD1009, 0x0FFE1009, 0x0FFF1009, 0x10001009, 0x10011009,
+            0x10021009, 0x10031009, 0x10041009, 0x10051009,
+        },
+        {
+            0x10061009, 0x10071009, 0x10081009, 0x10091009, 0x100A1009, 0x100B1009,
+            0x100C1009, 0x100D1009, 0x100E1009, 0x100F1009, 0x10101009, 0x10111009,
+            0x10121009, 0x10131009, 0x10141009, 0x10151009,
+        },
+        {
+            0x10161009, 0x10171009, 0x10181009, 0x10191009, 0x101A1009, 0x101B1009,
+            0x101C1009, 0x101D1009, 0x101E1009, 0x101F1009, 0x10201009, 0x10211009,
+            0x10221009, 0x10231009, 0x10241009, 0x10251009,
+        },
+        {
+            0x10261009, 0x10271009, 0x10281009, 0x10291009, 0x102A1009, 0x102B1009,
+            0x102C1009, 0x102D1009, 0x102E1009, 0x102F1009, 0x10301009, 0x10311009,
+            0x10321009, 0x10331009, 0x10341009, 0x10351009,
+        },
+        {
+            0x44611009, 0x44621009, 0x44631009, 0x44641009, 0x44651009, 0x44661009,
+            0x44671009, 0x44681009, 0x44691009, 0x446A1009, 0x446B1009, 0x446C1009,
+            0x446D1009, 0x446E1009, 0x446F1009, 0x44701009,
+        },
+        {
+            0x44711009, 0x44721009, 0x44731009, 0x44741009, 0x44751009, 0x44761009,
+            0x44771009, 0x44781009, 0x44791009, 0x447A1009, 0x447B1009, 0x447C1009,
+            0x447D1009, 0x447E1009, 0x447F1009, 0x44801009,
+        },
+        {
+            0x44811009, 0x44821009, 0x44831009, 0x44841009, 0x44851009, 0x44861009,
+            0x44871009, 0x44881009, 0x44891009, 0x448A1009, 0x448B1009, 0x448C1009,
+            0x448D1009, 0x448E1009, 0x448F1009, 0x44901009,
+        },
+        {
+            0x44911009, 0x44921009, 0x44931009, 0x44941009, 0x44951009, 0x44961009,
+            0x44971009, 0x44981009, 0x44991009, 0x449A1009, 0x449B1009, 0x449C1009,
+            0x449D1009, 0x449E1009, 0x449F1009, 0x44A01009,
+        },
+        {
+            0x44A11009, 0x44A21009, 0x44A31009, 0x44A41009, 0x44A51009, 0x44A61009,
+            0x44A71009, 0x44A81009, 0x44A91009, 0x44AA1009, 0x44AB1009, 0x44AC1009,
+            0x44AD1009, 0x44AE1009, 0x44AF1009, 0x44B01009,
+        },
+        {
+            0x44B11009, 0x44B21009, 0x44B31009, 0x44B41009, 0x44B51009, 0x44B61009,
+            0x44B71009, 0x44B81009, 0x44B91009, 0x44BA1009, 0x44BB1009, 0x44BC1009,
+            0x44BD1009, 0x44BE1009, 0x44BF1009, 0x44C01009,
+        },
+        {
+            0x44C11009, 0x44C21009, 0x44C31009, 0x44C41009, 0x44C51009, 0x44C61009,
+            0x44C71009, 0x44C81009, 0x44C91009, 0x44CA1009, 0x44CB1009, 0x44CC1009,
+            0x44CD1009, 0x44CE1009, 0x44CF1009, 0x44D01009,
+        },
+        {
+            0x44D11009, 0x44D21009, 0x44D31009, 0x44D41009, 0x44D51009, 0x44D61009,
+            0x44D71009, 0x44D81009, 0x44D91009, 0x44DA1009, 0x44DB1009, 0x44DC1009,
+            0x44DD1009, 0x44DE1009, 0x44DF1009, 0x44E01009,
+        },
+        {
+            0x44E11009, 0x44E21009, 0x44E31009, 0x44E41009, 0x44E51009, 0x44E61009,
+            0x44E71009, 0x44E81009, 0x44E91009, 0x44EA1009, 0x44EB1009, 0x44EC1009,
+            0x44ED1009, 0x44EE1009, 0x44EF1009, 0x44F01009,
+        },
+        {
+            0x44F11009, 0x44F21009, 0x44F31009, 0x44F41009, 0x44F51009, 0x44F61009,
+            0x44F71009, 0x44F81009, 0x44F91009, 0x44FA1009, 0x44FB1009, 0x44FC1009,
+            0x44FD1009, 0x44FE1009, 0x44FF1009, 0x45001009,
+        },
+        {
+            0x45011009, 0x45021009, 0x45031009, 0x45041009, 0x45051009, 0x45061009,
+            0x45071009, 0x45081009, 0x45091009, 0x450A1009, 0x450B1009, 0x450C1009,
+            0x450D1009, 0x450E1009, 0x450F1009, 0x45101009,
+        },
+        {
+            0x45111009, 0x45121009, 0x45131009, 0x45141009, 0x45151009, 0x45161009,
+            0x45171009, 0x45181009, 0x45191009, 0x451A1009, 0x451B1009, 0x451C1009,
+            0x451D1009, 0x451E1009, 0x451F1009, 0x45201009,
+        },
+        {
+            0x45211009, 0x45221009, 0x45231009, 0x45241009, 0x45251009, 0x45261009,
+            0x45271009, 0x45281009, 0x45291009, 0x452A1009, 0x452B1009, 0x452C1009,
+            0x452D1009, 0x452E1009, 0x452F1009, 0x45301009,
+        },
+        {
+            0x45311009, 0x45321009, 0x45331009, 0x45341009, 0x45351009, 0x45361009,
+            0x45371009, 0x45381009, 0x45391009, 0x453A1009, 0x453B1009, 0x453C1009,
+            0x453D1009, 0x453E1009, 0x453F1009, 0x45401009,
+        },
+        {
+            0x45411009, 0x45421009, 0x45431009, 0x45441009, 0x45451009, 0x45461009,
+            0x45471009, 0x45481009, 0x45491009, 0x454A1009, 0x454B1009, 0x454C1009,
+            0x454D1009, 0x454E1009, 0x454F1009, 0x45501009,
+        },
+        {
+            0x45511009, 0x45521009, 0x45531009, 0x45541009, 0x45551009, 0x45561009,
+            0x45571009, 0x45581009, 0x45591009, 0x455A1009, 0x455B1009, 0x455C1009,
+            0x455D1009, 0x455E1009, 0x455F1009, 0x45601009,
+        },
+        {
+            0x45611009, 0x45621009, 0x45631009, 0x45641009, 0x45651009, 0x45661009,
+            0x45671009, 0x45681009, 0x45691009, 0x456A1009, 0x456B1009, 0x456C1009,
+            0x456D1009, 0x456E1009, 0x456F1009, 0x45701009,
+        },
+        {
+            0x45711009, 0x45721009, 0x45731009, 0x45741009, 0x45751009, 0x45761009,
+            0x45771009, 0x45781009, 0x45791009, 0x457A1009, 0x457B1009, 0x457C1009,
+            0x457D1009, 0x457E1009, 0x457F1009, 0x45801009,
+        },
+        {
+            0x45811009, 0x45821009, 0x45831009, 0x45841009, 0x45851009, 0x45861009,
+            0x45871009, 0x45881009, 0x45891009, 0x458A1009, 0x458B1009, 0x458C1009,
+            0x458D1009, 0x458E1009, 0x458F1009, 0x45901009,
+        },
+        {
+            0x45911009, 0x45921009, 0x45931009, 0x45941009, 0x45951009, 0x45961009,
+            0x45971009, 0x45981009, 0x45991009, 0x459A1009, 0x459B1009, 0x459C1009,
+            0x459D1009, 0x459E1009, 0x459F1009, 0x45A01009,
+        },
+        {
+            0x45A11009, 0x45A21009, 0x45A31009, 0x45A41009, 0x45A51009, 0x45A61009,
+            0x45A71009, 0x45A81009, 0x45A91009, 0x45AA1009, 0x45AB1009, 0x45AC1009,
+            0x45AD1009, 0x45AE1009, 0x45AF1009, 0x45B01009,
+        },
+        {
+            0x45B11009, 0x45B21009, 0x45B31009, 0x45B41009, 0x45B51009, 0x45B61009,
+            0x45B71009, 0x45B81009, 0x45B91009, 0x45BA1009, 0x45BB1009, 0x45BC1009,
+            0x45BD1009, 0x45BE1009, 0x45BF1009, 0x45C01009,
+        },
+        {
+            0x45C11009, 0x45C21009, 0x45C31009, 0x45C41009, 0x45C51009, 0x45C61009,
+            0x45C71009, 0x45C81009, 0x45C91009, 0x45CA1009, 0x45CB1009, 0x45CC1009,
+            0x45CD1009, 0x45CE1009, 0x45CF1009, 0x45D01009,
+        },
+        {
+            0x45D11009, 0x45D21009, 0x45D31009, 0x45D41009, 0x45D51009, 0x45D61009,
+            0x45D71009, 0x45D81009, 0x45D91009, 0x45DA1009, 0x45DB1009, 0x45DC1009,
+            0x45DD1009, 0x45DE1009, 0x45DF1009, 0x45E01009,
+        },
+        {
+            0x45E11009, 0x45E21009, 0x45E31009, 0x45E41009, 0x45E51009, 0x45E61009,
+            0x45E71009, 0x45E81009, 0x45E91009, 0x45EA1009, 0x45EB1009, 0x45EC1009,
+            0x45ED1009, 0x45EE1009, 0x45EF1009, 0x45F01009,
+        },
+        {
+            0x45F11009, 0x45F21009, 0x45F31009, 0x45F41009, 0x45F51009, 0x45F61009,
+            0x45F71009, 0x45F81009, 0x45F91009, 0x45FA1009, 0x45FB1009, 0x45FC1009,
+            0x45FD1009, 0x45FE1009, 0x45FF1009, 0x46001009,
+        },
+        {
+            0x46011009, 0x46021009, 0x46031009, 0x46041009, 0x46051009, 0x46061009,
+            0x46071009, 0x46081009, 0x46091009, 0x460A1009, 0x460B1009, 0x460C1009,
+            0x460D1009, 0x460E1009, 0x460F1009, 0x46101009,
+        },
+        {
+            0x46111009, 0x46121009, 0x46131009, 0x46141009, 0x46151009, 0x46161009,
+            0x46171009, 0x46181009, 0x46191009, 0x461A1009, 0x461B1009, 0x461C1009,
+            0x461D1009, 0x461E1009, 0x461F1009, 0x46201009,
+        },
+        {
+            0x46211009, 0x46221009, 0x46231009, 0x46241009, 0x46251009, 0x46261009,
+            0x46271009, 0x46281009, 0x46291009, 0x462A1009, 0x462B1009, 0x462C1009,
+            0x462D1009, 0x462E1009, 0x462F1009, 0x46301009,
+        },
+        {
+            0x46311009, 0x46321009, 0x46331009, 0x46341009, 0x46351009, 0x46361009,
+            0x46371009, 0x46381009, 0x46391009, 0x463A1009, 0x463B1009, 0x463C1009,
+            0x463D1009, 0x463E1009, 0x463F1009, 0x46401009,
+        },
+        {
+            0x46411009, 0x46421009, 0x46431009, 0x46441009, 0x46451009, 0x46461009,
+            0x46471009, 0x46481009, 0x46491009, 0x464A1009, 0x464B1009, 0x464C1009,
+            0x464D1009, 0x464E1009, 0x464F1009, 0x46501009,
+        },
+        {
+            0x46511009, 0x46521009, 0x46531009, 0x46541009, 0x46551009, 0x46561009,
+            0x46571009, 0x46581009, 0x46591009, 0x465A1009, 0x465B1009, 0x465C1009,
+            0x465D1009, 0x465E1009, 0x465F1009, 0x46601009,
+        },
+        {
+            0x46611009, 0x46621009, 0x46631009, 0x46641009, 0x46651009, 0x46661009,
+            0x46671009, 0x46681009, 0x46691009, 0x466A1009, 0x466B1009, 0x466C1009,
+            0x466D1009, 0x466E1009, 0x466F1009, 0x46701009,
+        },
+        {
+            0x46711009, 0x46721009, 0x46731009, 0x46741009, 0x46751009, 0x46761009,
+            0x46771009, 0x46781009, 0x46791009, 0x467A1009, 0x467B1009, 0x467C1009,
+            0x467D1009, 0x467E1009, 0x467F1009, 0x46801009,
+        },
+        {
+            0x46811009, 0x46821009, 0x46831009, 0x46841009, 0x46851009, 0x46861009,
+            0x46871009, 0x46881009, 0x46891009, 0x468A1009, 0x468B1009, 0x468C1009,
+            0x468D1009, 0x468E1009, 0x468F1009, 0x46901009,
+        },
+        {
+            0x46911009, 0x46921009, 0x46931009, 0x46941009, 0x46951009, 0x46961009,
+            0x46971009, 0x46981009, 0x46991009, 0x469A1009, 0x469B1009, 0x469C1009,
+            0x469D1009, 0x469E1009, 0x469F1009, 0x46A01009,
+        },
+        {
+            0x46A11009, 0x46A21009, 0x46A31009, 0x46A41009, 0x46A51009, 0x46A61009,
+            0x46A71009, 0x46A81009, 0x46A91009, 0x46AA1009, 0x46AB1009, 0x46AC1009,
+            0x46AD1009, 0x46AE1009, 0x46AF1009, 0x46B01009,
+        },
+        {
+            0x46B11009, 0x46B21009, 0x46B31009, 0x46B41009, 0x46B51009, 0x46B61009,
+            0x46B71009, 0x46B81009, 0x46B91009, 0x46BA1009, 0x46BB1009, 0x46BC1009,
+            0x46BD1009, 0x46BE1009, 0x46BF1009, 0x46C01009,
+        },
+        {
+            0x46C11009, 0x46C21009, 0x46C31009, 0x46C41009, 0x46C51009, 0x46C61009,
+            0x46C71009, 0x46C81009, 0x46C91009, 0x46CA1009, 0x46CB1009, 0x46CC1009,
+            0x46CD1009, 0x46CE1009, 0x46CF1009, 0x46D01009,
+        },
+        {
+            0x46D11009, 0x46D21009, 0x46D31009, 0x46D41009, 0x46D51009, 0x46D61009,
+            0x46D71009, 0x46D81009, 0x46D91009, 0x46DA1009, 0x46DB1009, 0x46DC1009,
+            0x46DD1009, 0x46DE1009, 0x46DF1009, 0x46E01009,
+        },
+        {
+            0x46E11009, 0x46E21009, 0x46E31009, 0x46E41009, 0x46E51009, 0x46E61009,
+            0x46E71009, 0x46E81009, 0x46E91009, 0x46EA1009, 0x46EB1009, 0x46EC1009,
+            0x46ED1009, 0x46EE1009, 0x46EF1009, 0x46F01009,
+        },
+        {
+            0x46F11009, 0x46F21009, 0x46F31009, 0x46F41009, 0x46F51009, 0x46F61009,
+            0x46F71009, 0x46F81009, 0x46F91009, 0x46FA1009, 0x46FB1009, 0x46FC1009,
+            0x46FD1009, 0x46FE1009, 0x46FF1009, 0x47001009,
+        },
+        {
+            0x47011009, 0x47021009, 0x47031009, 0x47041009, 0x47051009, 0x47061009,
+            0x47071009, 0x47081009, 0x47091009, 0x470A1009, 0x470B1009, 0x470C1009,
+            0x470D1009, 0x470E1009, 0x470F1009, 0x47101009,
+        },
+        {
+            0x47111009, 0x47121009, 0x47131009, 0x47141009, 0x47151009, 0x47161009,
+            0x47171009, 0x47181009, 0x47191009, 0x471A1009, 0x471B1009, 0x471C1009,
+            0x471D1009, 0x471E1009, 0x471F1009, 0x47201009,
+        },
+        {
+            0x47211009, 0x47221009, 0x47231009, 0x47241009, 0x47251009, 0x47261009,
+            0x47271009, 0x47281009, 0x47291009, 0x472A1009, 0x472B1009, 0x472C1009,
+            0x472D1009, 0x472E1009, 0x472F1009, 0x47301009,
+        },
+        {
+            0x47311009, 0x47321009, 0x47331009, 0x47341009, 0x47351009, 0x47361009,
+            0x47371009, 0x47381009, 0x47391009, 0x473A1009, 0x473B1009, 0x473C1009,
+            0x473D1009, 0x473E1009, 0x473F1009, 0x47401009,
+        },
+        {
+            0x47411009, 0x47421009, 0x47431009, 0x47441009, 0x47451009, 0x47461009,
+            0x47471009, 0x47481009, 0x47491009, 0x474A1009, 0x474B1009, 0x474C1009,
+            0x474D1009, 0x474E1009, 0x474F1009, 0x47501009,
+        },
+        {
+            0x47511009, 0x47521009, 0x47531009, 0x47541009, 0x47551009, 0x47561009,
+            0x47571009, 0x47581009, 0x47591009, 0x475A1009, 0x475B1009, 0x475C1009,
+            0x475D1009, 0x475E1009, 0x475F1009, 0x47601009,
+        },
+        {
+            0x47611009, 0x47621009, 0x47631009, 0x47641009, 0x47651009, 0x47661009,
+            0x47671009, 0x47681009, 0x47691009, 0x476A1009, 0x476B1009, 0x476C1009,
+            0x476D1009, 0x476E1009, 0x476F1009, 0x47701009,
+        },
+        {
+            0x47711009, 0x47721009, 0x47731009, 0x47741009, 0x47751009, 0x47761009,
+            0x47771009, 0x47781009, 0x47791009, 0x477A1009, 0x477B1009, 0x477C1009,
+            0x477D1009, 0x477E1009, 0x477F1009, 0x47801009,
+        },
+        {
+            0x47811009, 0x47821009, 0x47831009, 0x47841009, 0x47851009, 0x47861009,
+            0x47871009, 0x47881009, 0x47891009, 0x478A1009, 0x478B1009, 0x478C1009,
+            0x478D1009, 0x478E1009, 0x478F1009, 0x47901009,
+        },
+        {
+            0x47911009, 0x47921009, 0x47931009, 0x47941009, 0x47951009, 0x47961009,
+            0x47971009, 0x47981009, 0x47991009, 0x479A1009, 0x479B1009, 0x479C1009,
+            0x479D1009, 0x479E1009, 0x479F1009, 0x47A01009,
+        },
+        {
+            0x47A11009, 0x47A21009, 0x47A31009, 0x47A41009, 0x47A51009, 0x47A61009,
+            0x47A71009, 0x47A81009, 0x47A91009, 0x47AA1009, 0x47AB1009, 0x47AC1009,
+            0x47AD1009, 0x47AE1009, 0x47AF1009, 0x47B01009,
+        },
+        {
+            0x47B11009, 0x47B21009, 0x47B31009, 0x47B41009, 0x47B51009, 0x47B61009,
+            0x47B71009, 0x47B81009, 0x47B91009, 0x47BA1009, 0x47BB1009, 0x47BC1009,
+            0x47BD1009, 0x47BE1009, 0x47BF1009, 0x47C01009,
+        },
+        {
+            0x47C11009, 0x47C21009, 0x47C31009, 0x47C41009, 0x47C51009, 0x47C61009,
+            0x47C71009, 0x47C81009, 0x47C91009, 0x47CA1009, 0x47CB1009, 0x47CC1009,
+            0x47CD1009, 0x47CE1009, 0x47CF1009, 0x47D01009,
+        },
+        {
+            0x47D11009, 0x47D21009, 0x47D31009, 0x47D41009, 0x47D51009, 0x47D61009,
+            0x47D71009, 0x47D81009, 0x47D91009, 0x47DA1009, 0x47DB1009, 0x47DC1009,
+            0x47DD1009, 0x47DE1009, 0x47DF1009, 0x47E01009,
+        },
+        {
+            0x47E11009, 0x47E21009, 0x47E31009, 0x47E41009, 0x47E51009, 0x47E61009,
+            0x47E71009, 0x47E81009, 0x47E91009, 0x47EA1009, 0x47EB1009, 0x47EC1009,
+            0x47ED1009, 0x47EE1009, 0x47EF1009, 0x47F01009,
+        },
+        {
+            0x47F11009, 0x47F21009, 0x47F31009, 0x47F41009, 0x47F51009, 0x47F61009,
+            0x47F71009, 0x47F81009, 0x47F91009, 0x47FA1009, 0x47FB1009, 0x47FC1009,
+            0x47FD1009, 0x47FE1009, 0x47FF1009, 0x48001009,
+        },
+        {
+            0x48011009, 0x48021009, 0x48031009, 0x48041009, 0x48051009, 0x48061009,
+            0x48071009, 0x48081009, 0x48091009, 0x480A1009, 0x480B1009, 0x480C1009,
+            0x480D1009, 0x480E1009, 0x480F1009, 0x48101009,
+        },
+        {
+            0x48111009, 0x48121009, 0x48131009, 0x48141009, 0x48151009, 0x48161009,
+            0x48171009, 0x48181009, 0x48191009, 0x481A1009, 0x481B1009, 0x481C1009,
+            0x481D1009, 0x481E1009, 0x481F1009, 0x48201009,
+        },
+        {
+            0x48211009, 0x48221009, 0x48231009, 0x48241009, 0x48251009, 0x48261009,
+            0x48271009, 0x48281009, 0x48291009, 0x482A1009, 0x482B1009, 0x482C1009,
+            0x482D1009, 0x482E1009, 0x482F1009, 0x48301009,
+        },
+        {
+            0x48311009, 0x48321009, 0x48331009, 0x48341009, 0x48351009, 0x48361009,
+            0x48371009, 0x48381009, 0x48391009, 0x483A1009, 0x483B1009, 0x483C1009,
+            0x483D1009, 0x483E1009, 0x483F1009, 0x48401009,
+        },
+        {
+            0x48411009, 0x48421009, 0x48431009, 0x48441009, 0x48451009, 0x48461009,
+            0x48471009, 0x48481009, 0x48491009, 0x484A1009, 0x484B1009, 0x484C1009,
+            0x484D1009, 0x484E1009, 0x484F1009, 0x48501009,
+        },
+        {
+            0x48511009, 0x48521009, 0x48531009, 0x48541009, 0x48551009, 0x48561009,
+            0x48571009, 0x48581009, 0x48591009, 0x485A1009, 0x485B1009, 0x485C1009,
+            0x485D1009, 0x485E1009, 0x485F1009, 0x48601009,
+        },
+        {
+            0x48611009, 0x48621009, 0x48631009, 0x48641009, 0x48651009, 0x48661009,
+            0x48671009, 0x48681009, 0x48691009, 0x486A1009, 0x486B1009, 0x486C1009,
+            0x486D1009, 0x486E1009, 0x486F1009, 0x48701009,
+        },
+        {
+            0x48711009, 0x48721009, 0x48731009, 0x48741009, 0x48751009, 0x48761009,
+            0x48771009, 0x48781009, 0x48791009, 0x487A1009, 0x487B1009, 0x487C1009,
+            0x487D1009, 0x487E1009, 0x487F1009, 0x48801009,
+        },
+        {
+            0x48811009, 0x48821009, 0x48831009, 0x48841009, 0x48851009, 0x48861009,
+            0x48871009, 0x48881009, 0x48891009, 0x488A1009, 0x488B1009, 0x488C1009,
+            0x488D1009, 0x488E1009, 0x488F1009, 0x48901009,
+        },
+        {
+            0x48911009, 0x48921009, 0x48931009, 0x48941009, 0x48951009, 0x48961009,
+            0x48971009, 0x48981009, 0x48991009, 0x489A1009, 0x489B1009, 0x489C1009,
+            0x489D1009, 0x489E1009, 0x489F1009, 0x48A01009,
+        },
+        {
+            0x48A11009, 0x48A21009, 0x48A31009, 0x48A41009, 0x48A51009, 0x48A61009,
+            0x48A71009, 0x48A81009, 0x48A91009, 0x48AA1009, 0x48AB1009, 0x48AC1009,
+            0x48AD1009, 0x48AE1009, 0x48AF1009, 0x48B01009,
+        },
+        {
+            0x48B11009, 0x48B21009, 0x48B31009, 0x48B41009, 0x48B51009, 0x48B61009,
+            0x48B71009, 0x48B81009, 0x48B91009, 0x48BA1009, 0x48BB1009, 0x48BC1009,
+            0x48BD1009, 0x48BE1009, 0x48BF1009, 0x48C01009,
+        },
+        {
+            0x48C11009, 0x48C21009, 0x48C31009, 0x48C41009, 0x48C51009, 0x48C61009,
+            0x48C71009, 0x48C81009, 0x48C91009, 0x48CA1009, 0x48CB1009, 0x48CC1009,
+            0x48CD1009, 0x48CE1009, 0x48CF1009, 0x48D01009,
+        },
+        {
+            0x48D11009, 0x48D21009, 0x48D31009, 0x48D41009, 0x48D51009, 0x48D61009,
+            0x48D71009, 0x48D81009, 0x48D91009, 0x48DA1009, 0x48DB1009, 0x48DC1009,
+            0x48DD1009, 0x48DE1009, 0x48DF1009, 0x48E01009,
+        },
+        {
+            0x48E11009, 0x48E21009, 0x48E31009, 0x48E41009, 0x48E51009, 0x48E61009,
+            0x48E71009, 0x48E81009, 0x48E91009, 0x48EA1009, 0x48EB1009, 0x48EC1009,
+            0x48ED1009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x108D1009, 0x108E1009, 0x108F1009, 0x10901009, 0x10911009, 0x10921009,
+            0x10931009, 0x10941009, 0x10951009, 0x10961009, 0x10971009, 0x10981009,
+            0x10991009, 0x109A1009, 0x109B1009, 0x109C1009,
+        },
+        {
+            0x109D1009, 0x109E1009, 0x109F1009, 0x10A01009, 0x10A11009, 0x10A21009,
+            0x10A31009, 0x10A41009, 0x10A51009, 0x10A61009, 0x10A71009, 0x10A81009,
+            0x10A91009, 0x10AA1009, 0x10AB1009, 0x10AC1009,
+        },
+        {
+            0x10AD1009, 0x10AE1009, 0x10AF1009, 0x10B01009, 0x10B11009, 0x10B21009,
+            0x10B31009, 0x10B41009, 0x10B51009, 0x10B61009, 0x10B71009, 0x10B81009,
+            0x10B91009, 0x10BA1009, 0x10BB1009, 0x10BC1009,
+        },
+        {
+            0x10BD1009, 0x10BE1009, 0x10BF1009, 0x10C01009, 0x10C11009, 0x10C21009,
+            0x10C31009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x48F41009, 0x48F51009, 0x48F61009, 0x48F71009, 0x48F81009, 0x48F91009,
+            0x48FA1009, 0x48FB1009, 0x48FC1009, 0x48FD1009, 0x48FE1009, 0x48FF1009,
+            0x49001009, 0x49011009, 0x49021009, 0x49031009,
+        },
+        {
+            0x49041009, 0x49051009, 0x49061009, 0x49071009, 0x49081009, 0x49091009,
+            0x490A1009, 0x490B1009, 0x490C1009, 0x490D1009, 0x49101009, 0x490E1009,
+            0x49111009, 0x490F1009, 0x49131009, 0x49141009,
+        },
+        {
+            0x49151009, 0x49161009, 0x49171009, 0x49181009, 0x49191009, 0x491A1009,
+            0x491B1009, 0x491C1009, 0x48EE1009, 0x48EF1009, 0x48F01009, 0x48F11009,
+            0x48F31009, 0x48F21009, 0x02321009, 0x028C1009,
+        },
+        {
+            0x3CB91009, 0x3CBA1009, 0x3CBB1009, 0x3CBC1009, 0x3CBD1009, 0x3CBE1009,
+            0x3CBF1009, 0x3CC01009, 0x3CC11009, 0x3CC21009, 0x3CC31009, 0x3CC41009,
+            0x3CC51009, 0x3CC61009, 0x3CC71009, 0x3CC81009,
+        },
+        {
+            0x3CC91009, 0x3CCA1009, 0x3CCB1009, 0x3CCC1009, 0x3CCD1009, 0x3CCE1009,
+            0x3CCF1009, 0x3CD01009, 0x3CD11009, 0x3CD21009, 0x3CD31009, 0x3CD41009,
+            0x3CD51009, 0x3CD61009, 0x3CD71009, 0x3CD81009,
+        },
+        {
+            0x3CD91009, 0x3CDA1009, 0x3CDB1009, 0x3CDC1009, 0x3CDD1009, 0x3CDE1009,
+            0x3CDF1009, 0x3CE01009, 0x3CE11009, 0x3CE21009, 0x3CE31009, 0x3CE41009,
+            0x3CE51009, 0x3CE61009, 0x3CE71009, 0x3CE81009,
+        },
+        {
+            0x3CE91009, 0x3CEA1009, 0x3CEB1009, 0x3CEC1009, 0x3CED1009, 0x3CEE1009,
+            0x3CEF1009, 0x3CF01009, 0x3CF11009, 0x3CF21009, 0x3CF31009, 0x3CF41009,
+            0x3CF51009, 0x3CF61009, 0x3CF71009, 0x3CF81009,
+        },
+        {
+            0x3CF91009, 0x3CFA1009, 0x3CFB1009, 0x3CFC1009, 0x3CFD1009, 0x3CFE1009,
+            0x3CFF1009, 0x3D001009, 0x3D011009, 0x3D021009, 0x3D031009, 0x3D041009,
+            0x3D051009, 0x3D061009, 0x3D071009, 0x3D081009,
+        },
+        {
+            0x3D091009, 0x3D0A1009, 0x3D0B1009, 0x3D0C1009, 0x3D0D1009, 0x3D0E1009,
+            0x3D0F1009, 0x3D101009, 0x3D111009, 0x3D121009, 0x3D131009, 0x3D141009,
+            0x3D151009, 0x3D161009, 0x3D171009, 0x3D181009,
+        },
+        {
+            0x3D191009, 0x3D1A1009, 0x3D1B1009, 0x3D1C1009, 0x3D1D1009, 0x3D1E1009,
+            0x3D1F1009, 0x3D201009, 0x3D211009, 0x3D221009, 0x3D231009, 0x3D241009,
+            0x3D251009, 0x3D261009, 0x3D271009, 0x3D281009,
+        },
+        {
+            0x3D291009, 0x3D2A1009, 0x3D2B1009, 0x3D2C1009, 0x3D2D1009, 0x3D2E1009,
+            0x3D2F1009, 0x3D301009, 0x3D311009, 0x3D321009, 0x3D331009, 0x3D341009,
+            0x3D351009, 0x3D361009, 0x3D371009, 0x3D381009,
+        },
+        {
+            0x3D391009, 0x3D3A1009, 0x3D3B1009, 0x3D3C1009, 0x3D3D1009, 0x3D3E1009,
+            0x3D3F1009, 0x3D401009, 0x3D411009, 0x3D421009, 0x3D431009, 0x3D441009,
+            0x3D451009, 0x3D461009, 0x3D471009, 0x3D481009,
+        },
+        {
+            0x3D491009, 0x3D4A1009, 0x3D4B1009, 0x3D4C1009, 0x3D4D1009, 0x3D4E1009,
+            0x3D4F1009, 0x3D501009, 0x3D511009, 0x3D521009, 0x3D531009, 0x3D541009,
+            0x3D551009, 0x3D561009, 0x3D571009, 0x3D581009,
+        },
+        {
+            0x3D591009, 0x3D5A1009, 0x3D5B1009, 0x3D5C1009, 0x3D5D1009, 0x3D5E1009,
+            0x3D5F1009, 0x3D601009, 0x3D611009, 0x3D621009, 0x3D631009, 0x3D641009,
+            0x3D651009, 0x3D661009, 0x3D671009, 0x3D681009,
+        },
+        {
+            0x3D691009, 0x3D6A1009, 0x3D6B1009, 0x3D6C1009, 0x3D6D1009, 0x3D6E1009,
+            0x3D6F1009, 0x3D701009, 0x3D711009, 0x3D721009, 0x3D731009, 0x3D741009,
+            0x3D751009, 0x3D761009, 0x3D771009, 0x3D781009,
+        },
+        {
+            0x3D791009, 0x3D7A1009, 0x3D7B1009, 0x3D7C1009, 0x3D7D1009, 0x3D7E1009,
+            0x3D7F1009, 0x3D801009, 0x3D811009, 0x3D821009, 0x3D831009, 0x3D841009,
+            0x3D851009, 0x3D861009, 0x3D871009, 0x3D881009,
+        },
+        {
+            0x3D891009, 0x3D8A1009, 0x3D8B1009, 0x3D8C1009, 0x3D8D1009, 0x3D8E1009,
+            0x3D8F1009, 0x3D901009, 0x3D911009, 0x3D921009, 0x3D931009, 0x3D941009,
+            0x3D951009, 0x3D961009, 0x3D971009, 0x3D981009,
+        },
+        {
+            0x3D991009, 0x3D9A1009, 0x3D9B1009, 0x3D9C1009, 0x3D9D1009, 0x3D9E1009,
+            0x3D9F1009, 0x3DA01009, 0x3DA11009, 0x3DA21009, 0x3DA31009, 0x3DA41009,
+            0x3DA51009, 0x3DA61009, 0x3DA71009, 0x3DA81009,
+        },
+        {
+            0x3DA91009, 0x3DAA1009, 0x3DAB1009, 0x3DAC1009, 0x3DAD1009, 0x3DAE1009,
+            0x3DAF1009, 0x3DB01009, 0x3DB11009, 0x3DB21009, 0x3DB31009, 0x3DB41009,
+            0x3DB51009, 0x3DB61009, 0x3DB71009, 0x3DB81009,
+        },
+        {
+            0x3DB91009, 0x3DBA1009, 0x3DBB1009, 0x3DBC1009, 0x3DBD1009, 0x3DBE1009,
+            0x3DBF1009, 0x3DC01009, 0x3DC11009, 0x3DC21009, 0x3DC31009, 0x3DC41009,
+            0x3DC51009, 0x02331009, 0x028D1009, 0x02771009,
+        },
+        {
+            0x3D111011, 0x3D231011, 0x3D401011, 0x002CC40A, 0x002CCC0A, 0x002CD40A,
+            0x002CDC0A, 0x002CE40A, 0x002CEC0A, 0x002CF40A, 0x002CFC0A, 0x002D040A,
+            0x002D0C0A, 0x002D140A, 0x002D1C0A, 0x002D240A,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x3D271011, 0x3D8A1011,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x23D51021, 0x23D51009, 0x23D81021, 0x23D81009, 0x23DD1021, 0x23DD1009,
+            0x23F11021, 0x23F11009, 0x23FA1021, 0x23FA1009, 0x248E1021, 0x248E1009,
+            0x24B51021, 0x24B51009, 0x24F11021, 0x24F11009,
+        },
+        {
+            0x24F81021, 0x24F81009, 0x25091021, 0x25091009, 0x25121021, 0x25121009,
+            0x25131021, 0x25131009, 0x25211021, 0x25211009, 0x25261021, 0x25261009,
+            0x252B1021, 0x252B1009, 0x25401021, 0x25401009,
+        },
+        {
+            0x24C21021, 0x24C21009, 0x23B91021, 0x23B91009, 0x24251021, 0x24251009,
+            0x24301021, 0x24301009, 0x244C1029, 0x244C1011, 0x244C1029, 0x244C1011,
+            0x244C1029, 0x244C1011, 0x244C1011, 0x00002889,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x03A51009, 0x23C31011, 0x23E51011,
+            0x002D2C0A, 0x24821011, 0x24F41011, 0x24F91011, 0x24FD1011, 0x24AD1011,
+            0x00001989, 0x00001989, 0x03E31009, 0x24F31009,
+        },
+        {
+            0x23B41021, 0x23B41009, 0x23E41021, 0x23E41009, 0x23CC1021, 0x23CC1009,
+            0x24DB1021, 0x24DB1009, 0x23E21021, 0x23E21009, 0x247D1021, 0x247D1009,
+            0x24771021, 0x24771009, 0x24C31021, 0x24C31009,
+        },
+        {
+            0x24C81021, 0x24C81009, 0x24CE1021, 0x24CE1009, 0x24AC1021, 0x24AC1009,
+            0x24EC1021, 0x24EC1009, 0x244C1029, 0x244C1011, 0x244C1029, 0x244C1011,
+            0x24F41051, 0x24FD1051, 0x24931011, 0x25191011,
+        },
+        {
+            0x3DC61009, 0x3DC71009, 0x3DC81009, 0x3DC91009, 0x3DCA1009, 0x3DCB1009,
+            0x3DCC1009, 0x3DCD1009, 0x3DCE1009, 0x3DCF1009, 0x3DD01009, 0x3DD11009,
+            0x3DD21009, 0x3DD31009, 0x3DD41009, 0x3DD51009,
+        },
+        {
+            0x3DD61009, 0x3DD71009, 0x3DD81009, 0x3DD91009, 0x3DDA1009, 0x3DDB1009,
+            0x3DDC1009, 0x3DDD1009, 0x3DDE1009, 0x3DDF1009, 0x3DE01009, 0x3DE11009,
+            0x3DE21009, 0x3DE31009, 0x3DE41009, 0x3DE51009,
+        },
+        {
+            0x3DE61009, 0x3DE71009, 0x3DE81009, 0x3DE91009, 0x3DEA1009, 0x3DEB1009,
+            0x3DEC1009, 0x3DED1009, 0x3DEE1009, 0x3DEF1009, 0x3DF01009, 0x3DF11009,
+            0x3DF21009, 0x3DF31009, 0x3DF41009, 0x3DF51009,
+        },
+        {
+            0x3DF61009, 0x3DF71009, 0x3DF81009, 0x3DF91009, 0x3DFA1009, 0x3DFB1009,
+            0x3DFC1009, 0x3DFD1009, 0x3DFE1009, 0x3DFF1009, 0x3E001009, 0x3E011009,
+            0x3E021009, 0x3E031009, 0x3E041009, 0x3E051009,
+        },
+        {
+            0x3E061009, 0x3E071009, 0x3E081009, 0x3E091009, 0x3E0A1009, 0x3E0B1009,
+            0x3E0C1009, 0x3E0D1009, 0x3E0E1009, 0x3E0F1009, 0x3E101009, 0x3E111009,
+            0x3E121009, 0x3E131009, 0x3E141009, 0x3E151009,
+        },
+        {
+            0x00005B09, 0x00005B89, 0x02E01009, 0x028E1009, 0x02661009, 0x02341009,
+            0x023E1009, 0x02781009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x05041009, 0x05051009, 0x05061009, 0x05071009, 0x05081009, 0x05091009,
+            0x050A1009, 0x050B1009, 0x050C1009, 0x050D1009, 0x050E1009, 0x050F1009,
+            0x05101009, 0x05111009, 0x05121009, 0x05131009,
+        },
+        {
+            0x05141009, 0x05151009, 0x05161009, 0x05171009, 0x05181009, 0x05191009,
+            0x051A1009, 0x051B1009, 0x051C1009, 0x051D1009, 0x051E1009, 0x051F1009,
+            0x05201009, 0x05211009, 0x05221009, 0x05231009,
+        },
+        {
+            0x05241009, 0x05251009, 0x22E61021, 0x22E61009, 0x22F11021, 0x22F11009,
+            0x20891021, 0x20891009, 0x002D340A, 0x002D3C0A, 0x22CB1021, 0x22CB1009,
+            0x22CC1021, 0x22CC1009, 0x22CD1021, 0x22CD1009,
+        },
+        {
+            0x20461009, 0x21D61009, 0x002D440A, 0x002D4C0A, 0x002D540A, 0x0004B40A,
+            0x002D5C0A, 0x002D640A, 0x002D6C0A, 0x0004BC0A, 0x002D740E, 0x002D800E,
+            0x002D8C0A, 0x002D940A, 0x1FEA1021, 0x1FEA1009,
+        },
+        {
+            0x20CF1021, 0x20CF1009, 0x20D01021, 0x20D01009, 0x20D11021, 0x20D11009,
+            0x20DE1021, 0x20DE1009, 0x20E01021, 0x20E01009, 0x21601021, 0x21601009,
+            0x21581021, 0x21581009, 0x002D9C0A, 0x002DA40A,
+        },
+        {
+            0x21711021, 0x21711009, 0x21781021, 0x21781009, 0x21791021, 0x21791009,
+            0x21851021, 0x21851009, 0x21861021, 0x21861009, 0x219D1021, 0x219D1009,
+            0x21D11021, 0x21D11009, 0x224C1021, 0x224C1009,
+        },
+        {
+            0x002DAC0A, 0x002DB40A, 0x22A21021, 0x22A21009, 0x22B91021, 0x22B91009,
+            0x22BA1021, 0x22BA1009, 0x22BF1021, 0x22BF1009, 0x22C31021, 0x22C31009,
+            0x22C41021, 0x22C41009, 0x22C51021, 0x22C51009,
+        },
+        {
+            0x22C51051, 0x20051009, 0x20FB1009, 0x21171009, 0x21361009, 0x21CF1009,
+            0x21D01009, 0x22121009, 0x22C61009, 0x002DBC0A, 0x0004CC0A, 0x002DC40A,
+            0x002DCC0A, 0x002DD40A, 0x206C1021, 0x206C1009,
+        },
+        {
+            0x21001021, 0x21001009, 0x002DDC0A, 0x002DE40A, 0x002DEC0A, 0x0000D80A,
+            0x002DF40A, 0x002DFC0A, 0x05261009, 0x05271009, 0x05281009, 0x22E71021,
+            0x22E71009, 0x222C1021, 0x20F61009, 0x22E81009,
+        },
+        {
+            0x212B1021, 0x212B1009, 0x1FDF1021, 0x1FDF1009, 0x1FE01009, 0x20811009,
+            0x1FCB1021, 0x1FCB1009, 0x20481021, 0x20481009, 0x002E040A, 0x0004E40A,
+            0x002E0C0A, 0x0004EC0A, 0x002E140A, 0x0004F40A,
+        },
+        {
+            0x002E1C0A, 0x002E240A, 0x002E2C0A, 0x002E340A, 0x002E3C0A, 0x002E440A,
+            0x002E4C0A, 0x002E540A, 0x002E5C0A, 0x002E640A, 0x20821021, 0x202C1021,
+            0x20551021, 0x20EC1021, 0x20981021, 0x21841009,
+        },
+        {
+            0x20D21021, 0x22131021, 0x20B81021, 0x226D1021, 0x1FD51021, 0x1FD51009,
+            0x21651021, 0x21651009, 0x22271021, 0x22271009, 0x1FA91021, 0x1FA91009,
+            0x20A51021, 0x20A51009, 0x222B1021, 0x222B1009,
+        },
+        {
+            0x00000000, 0x00000000, 0x225E1021, 0x225E1009, 0x1FE01021, 0x21DA1021,
+            0x22901021, 0x1FF11021, 0x1FF11009, 0x21D71021, 0x21D71009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20881021,
+            0x20881009, 0x209D1009, 0x002E6C0A, 0x002E740E, 0x223C1009, 0x20501009,
+            0x217A1009, 0x21151009, 0x209C1009, 0x21161009,
+        },
+        {
+            0x2CDC1009, 0x2CDD1009, 0x2CDE1009, 0x2CDF1009, 0x2CE01009, 0x2CE11009,
+            0x2CE21009, 0x2CE41009, 0x2CE51009, 0x2CE61009, 0x2CE71009, 0x00006209,
+            0x2CE81009, 0x2CE91009, 0x2CEA1009, 0x2CEB1009,
+        },
+        {
+            0x2CEC1009, 0x2CED1009, 0x2CEE1009, 0x2CEF1009, 0x2CF01009, 0x2CF11009,
+            0x2CF21009, 0x2CF31009, 0x2CF41009, 0x2CF51009, 0x2CF61009, 0x2CF71009,
+            0x2CF81009, 0x2CF91009, 0x2CFA1009, 0x2CFB1009,
+        },
+        {
+            0x2CFC1009, 0x2CFD1009, 0x2CFE1009, 0x2CFF1009, 0x2D001009, 0x2D011009,
+            0x2D021009, 0x2D031009, 0x056C1009, 0x056D1009, 0x056E1009, 0x056F1009,
+            0x2CE31009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1D621009, 0x1D631009, 0x1D641009, 0x1D651009, 0x1D661009, 0x1D671009,
+            0x05701009, 0x05711009, 0x1F6F1009, 0x05721009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x34201009, 0x34211009, 0x34221009, 0x34231009, 0x34241009, 0x34251009,
+            0x34261009, 0x34271009, 0x342C1009, 0x342D1009, 0x342E1009, 0x342F1009,
+            0x34301009, 0x34311009, 0x34321009, 0x34331009,
+        },
+        {
+            0x34341009, 0x34351009, 0x34361009, 0x34371009, 0x34391009, 0x343A1009,
+            0x343B1009, 0x343C1009, 0x343F1009, 0x34421009, 0x34431009, 0x34451009,
+            0x34461009, 0x34491009, 0x344E1009, 0x344F1009,
+        },
+        {
+            0x34501009, 0x34511009, 0x344A1009, 0x344B1009, 0x344C1009, 0x344D1009,
+            0x34521009, 0x34381009, 0x343D1009, 0x34281009, 0x34291009, 0x342A1009,
+            0x342B1009, 0x343E1009, 0x34441009, 0x34471009,
+        },
+        {
+            0x34481009, 0x34401009, 0x34411009, 0x34531009, 0x04541009, 0x04551009,
+            0x029C1009, 0x029D1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00006209, 0x00006289, 0x2D041009, 0x2D051009, 0x2D061009, 0x2D071009,
+            0x2D081009, 0x2D091009, 0x2D0A1009, 0x2D0B1009, 0x2D0C1009, 0x2D0D1009,
+            0x2D0E1009, 0x2D0F1009, 0x2D101009, 0x2D111009,
+        },
+        {
+            0x2D121009, 0x2D131009, 0x2D141009, 0x2D151009, 0x2D161009, 0x2D171009,
+            0x2D181009, 0x2D191009, 0x2D1A1009, 0x2D1B1009, 0x2D1C1009, 0x2D1D1009,
+            0x2D1E1009, 0x2D1F1009, 0x2D201009, 0x2D211009,
+        },
+        {
+            0x2D221009, 0x2D231009, 0x2D241009, 0x2D251009, 0x2D261009, 0x2D271009,
+            0x2D281009, 0x2D291009, 0x2D2A1009, 0x2D2B1009, 0x2D2C1009, 0x2D2D1009,
+            0x2D2E1009, 0x2D2F1009, 0x2D301009, 0x2D311009,
+        },
+        {
+            0x2D321009, 0x2D331009, 0x2D341009, 0x2D351009, 0x2D361009, 0x2D371009,
+            0x2D381009, 0x2D391009, 0x2D3A1009, 0x2D3B1009, 0x2D3C1009, 0x2D3D1009,
+            0x2D3E1009, 0x2D3F1009, 0x2D401009, 0x2D411009,
+        },
+        {
+            0x2D421009, 0x2D431009, 0x2D441009, 0x2D451009, 0x2D461009, 0x00006189,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x02981009, 0x02991009,
+        },
+        {
+            0x00000001, 0x00000001, 0x2A211009, 0x2A211011, 0x2A211011, 0x2A211011,
+            0x2A211011, 0x2A211011, 0x04011009, 0x04021009, 0x04031009, 0x2A221009,
+            0x04041009, 0x29D81009, 0x29EE1009, 0x2A371009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x354B1009, 0x354C1009,
+            0x354D1009, 0x354E1009, 0x354F1009, 0x35501009,
+        },
+        {
+            0x35511009, 0x35521009, 0x35531009, 0x35541009, 0x35551009, 0x35561009,
+            0x35571009, 0x35581009, 0x35591009, 0x355A1009, 0x355B1009, 0x355C1009,
+            0x355D1009, 0x355E1009, 0x355F1009, 0x35601009,
+        },
+        {
+            0x35611009, 0x35621009, 0x35631009, 0x35641009, 0x35651009, 0x35661009,
+            0x35671009, 0x35681009, 0x35691009, 0x356A1009, 0x356B1009, 0x00007209,
+            0x00007289, 0x00007309, 0x045A1009, 0x02A01009,
+        },
+        {
+            0x35271009, 0x35281009, 0x35291009, 0x352A1009, 0x352B1009, 0x352C1009,
+            0x352D1009, 0x352E1009, 0x352F1009, 0x35301009, 0x35311009, 0x35321009,
+            0x35331009, 0x35341009, 0x35351009, 0x35361009,
+        },
+        {
+            0x35371009, 0x35381009, 0x35391009, 0x353A1009, 0x353B1009, 0x353C1009,
+            0x353D1009, 0x353E1009, 0x353F1009, 0x35401009, 0x35411009, 0x35421009,
+            0x35431009, 0x35441009, 0x35451009, 0x35461009,
+        },
+        {
+            0x35471009, 0x35481009, 0x35491009, 0x354A1009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x02E11009,
+        },
+        {
+            0x41D41009, 0x41D51009, 0x41D61009, 0x41D71009, 0x41D81009, 0x41D91009,
+            0x41DA1009, 0x41DB1009, 0x41DC1009, 0x41DD1009, 0x41DE1009, 0x41DF1009,
+            0x41E01009, 0x41E11009, 0x41E21009, 0x41E31009,
+        },
+        {
+            0x41E41009, 0x41E51009, 0x41E61009, 0x41E71009, 0x41E81009, 0x41E91009,
+            0x41EA1009, 0x41EB1009, 0x41EC1009, 0x41ED1009, 0x41EE1009, 0x41EF1009,
+            0x41F01009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00006189, 0x00006209, 0x00006509, 0x00006289, 0x37FC1009, 0x37FD1009,
+            0x37FE1009, 0x37FF1009, 0x38001009, 0x38011009, 0x38021009, 0x38031009,
+            0x38041009, 0x38051009, 0x38061009, 0x38071009,
+        },
+        {
+            0x38081009, 0x38091009, 0x380A1009, 0x380B1009, 0x380C1009, 0x380D1009,
+            0x380E1009, 0x380F1009, 0x38101009, 0x38111009, 0x38121009, 0x38131009,
+            0x38141009, 0x38151009, 0x38161009, 0x38171009,
+        },
+        {
+            0x38181009, 0x38191009, 0x381A1009, 0x381B1009, 0x381C1009, 0x381D1009,
+            0x381E1009, 0x381F1009, 0x38201009, 0x38211009, 0x38221009, 0x38241009,
+            0x38241011, 0x38261009, 0x38271009, 0x38281009,
+        },
+        {
+            0x38291009, 0x382A1009, 0x382B1009, 0x00006109, 0x382C1009, 0x382C1011,
+            0x382E1009, 0x382F1009, 0x38301009, 0x38311009, 0x38331009, 0x38341009,
+            0x382D1009, 0x38321009, 0x38231009, 0x38251009,
+        },
+        {
+            0x38351009, 0x02D61009, 0x02D71009, 0x02D81009, 0x02D91009, 0x02DA1009,
+            0x02DB1009, 0x02621009, 0x02AB1009, 0x02AC1009, 0x02DC1009, 0x02DD1009,
+            0x02DE1009, 0x02DF1009, 0x00000000, 0x1F4D1009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x045B1009, 0x045C1009,
+        },
+        {
+            0x35751009, 0x357D1009, 0x35871009, 0x359D1009, 0x35B61009, 0x36001009,
+            0x1F4E1009, 0x358F1009, 0x35B11009, 0x35731009, 0x35761009, 0x35821009,
+            0x35891009, 0x35971009, 0x359A1009, 0x359E1009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x35D21009, 0x35A31009,
+            0x35A61009, 0x35B41009, 0x35B71009, 0x00000000,
+        },
+        {
+            0x37711009, 0x37721009, 0x37731009, 0x37741009, 0x37751009, 0x37761009,
+            0x37771009, 0x37781009, 0x37791009, 0x377A1009, 0x377B1009, 0x377C1009,
+            0x377D1009, 0x377E1009, 0x377F1009, 0x37801009,
+        },
+        {
+            0x37811009, 0x37821009, 0x37831009, 0x37841009, 0x37851009, 0x37861009,
+            0x37871009, 0x37881009, 0x37891009, 0x378A1009, 0x378B1009, 0x378C1009,
+            0x378D1009, 0x378E1009, 0x378F1009, 0x37901009,
+        },
+        {
+            0x37911009, 0x37921009, 0x37931009, 0x37941009, 0x37951009, 0x37961009,
+            0x37971009, 0x37981009, 0x37991009, 0x379E1009, 0x379F1009, 0x37A01009,
+            0x37A11009, 0x37A21009, 0x37A31009, 0x37A41009,
+        },
+        {
+            0x37A51009, 0x37A61009, 0x37A71009, 0x379A1009, 0x379B1009, 0x379C1009,
+            0x379D1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x37A81009, 0x37A91009, 0x37AA1009, 0x37AB1009, 0x37AC1009, 0x37AD1009,
+            0x37AE1009, 0x37AF1009, 0x37B01009, 0x37B11009, 0x37B21009, 0x37B31009,
+            0x37B41009, 0x37B51009, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00000000, 0x00000000,
+            0x045D1009, 0x02AD1009, 0x02AE1009, 0x02AF1009,
+        },
+        {
+            0x35721009, 0x357B1009, 0x357E1009, 0x35811009, 0x35881009, 0x358E1009,
+            0x35921009, 0x35941009, 0x35961009, 0x35991009, 0x35A51009, 0x35A91009,
+            0x35CA1009, 0x35CD1009, 0x35CF1009, 0x35AF1009,
+        },
+        {
+            0x1F4F1009, 0x35D01009, 0x35841009, 0x35BD1009, 0x36181009, 0x36191009,
+            0x361A1009, 0x059B1009, 0x059C1009, 0x059D1009, 0x35BE1009, 0x36151009,
+            0x36161009, 0x36171009, 0x357F1009, 0x358B1009,
+        },
+        {
+            0x32961009, 0x32971009, 0x32981009, 0x32991009, 0x329A1009, 0x329B1009,
+            0x329C1009, 0x329D1009, 0x329E1009, 0x329F1009, 0x32A01009, 0x32A11009,
+            0x32A21009, 0x32A31009, 0x32A41009, 0x32A51009,
+        },
+        {
+            0x32A61009, 0x32A71009, 0x32A81009, 0x32A91009, 0x32AA1009, 0x32AB1009,
+            0x32AC1009, 0x32AD1009, 0x32AE1009, 0x32AF1009, 0x32B01009, 0x32B11009,
+            0x32B21009, 0x32B31009, 0x32B41009, 0x32B51009,
+        },
+        {
+            0x32B61009, 0x32B71009, 0x32B81009, 0x32B91009, 0x32BA1009, 0x32BB1009,
+            0x32BC1009, 0x32BD1009, 0x32BE1009, 0x32BF1009, 0x32C01009, 0x32C11009,
+            0x32C21009, 0x32C31009, 0x32C41009, 0x32C51009,
+        },
+        {
+            0x32C61009, 0x32C71009, 0x32C81009, 0x32C91009, 0x32CA1009, 0x000000C7,
+            0x000000CB, 0x32CD1009, 0x32CE1009, 0x000000CF, 0x32D01009, 0x000000D3,
+            0x000000D7, 0x32D31009, 0x32D41009, 0x00007089,
+        },
+        {
+            0x32D51009, 0x00007109, 0x32D61009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x32D71009,
+            0x32D81009, 0x1F501009, 0x040E1009, 0x040F1009,
+        },
+        {
+            0x2CB91009, 0x2CBA1009, 0x2CBB1009, 0x2CBC1009, 0x2CBD1009, 0x2CBE1009,
+            0x2CBF1009, 0x2CC01009, 0x2CC11009, 0x2CC21009, 0x2CC31009, 0x2CCC1009,
+            0x2CCD1009, 0x2CCE1009, 0x2CCF1009, 0x2CD01009,
+        },
+        {
+            0x02B01009, 0x02791009, 0x2C9D1009, 0x1F511009, 0x1F521009, 0x2CD11009,
+            0x2CDB1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x28521009, 0x28531009, 0x28541009, 0x28551009, 0x28561009,
+            0x28571009, 0x00000000, 0x00000000, 0x29191009, 0x291A1009, 0x291B1009,
+            0x291C1009, 0x291D1009, 0x291E1009, 0x00000000,
+        },
+        {
+            0x00000000, 0x28FA1009, 0x28FB1009, 0x28FC1009, 0x28FD1009, 0x28FE1009,
+            0x28FF1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x295C1009, 0x295D1009, 0x295E1009, 0x295F1009, 0x29601009, 0x29611009,
+            0x29621009, 0x00000000, 0x29741009, 0x29751009, 0x29761009, 0x29771009,
+            0x29781009, 0x29791009, 0x297A1009, 0x00000000,
+        },
+        {
+            0x1FB51009, 0x1FAC1009, 0x200C1009, 0x200D1009, 0x20131009, 0x20471009,
+            0x20591009, 0x20F01009, 0x20EA1009, 0x20EB1009, 0x21141009, 0x21351009,
+            0x213B1009, 0x21421009, 0x214E1009, 0x21551009,
+        },
+        {
+            0x214A1009, 0x21481009, 0x21491009, 0x214B1009, 0x214C1009, 0x21971009,
+            0x219C1009, 0x21C51009, 0x21C61009, 0x21BB1009, 0x21C71009, 0x21C81009,
+            0x21C91009, 0x21E81009, 0x221C1009, 0x22261009,
+        },
+        {
+            0x22201009, 0x22211009, 0x222A1009, 0x226D1009, 0x226E1009, 0x226F1009,
+            0x22691009, 0x226A1009, 0x226B1009, 0x226C1009, 0x22811009, 0x05291009,
+            0x20891051, 0x20F01051, 0x20E61051, 0x222A1051,
+        },
+        {
+            0x22C01009, 0x22C11009, 0x21571009, 0x22C21009, 0x1FBB1009, 0x23471009,
+            0x002E800A, 0x002E880A, 0x21CE1009, 0x22601051, 0x04DA1009, 0x04DB1009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x38DE1009, 0x38DF1009, 0x38E01009, 0x38E11009, 0x38E21009, 0x38E31009,
+            0x38E41009, 0x38E51009, 0x38E61009, 0x38E71009, 0x38E81009, 0x38E91009,
+            0x38EA1009, 0x38EB1009, 0x38EC1009, 0x38ED1009,
+        },
+        {
+            0x38EE1009, 0x38EF1009, 0x38F01009, 0x38F11009, 0x38F21009, 0x38F31009,
+            0x38F41009, 0x38F51009, 0x38F61009, 0x38F71009, 0x38F81009, 0x38F91009,
+            0x38FA1009, 0x38FB1009, 0x38FC1009, 0x38FD1009,
+        },
+        {
+            0x38FE1009, 0x38FF1009, 0x39001009, 0x39011009, 0x39021009, 0x39031009,
+            0x39041009, 0x39051009, 0x39061009, 0x39071009, 0x39081009, 0x39091009,
+            0x390A1009, 0x390B1009, 0x390C1009, 0x390D1009,
+        },
+        {
+            0x390E1009, 0x390F1009, 0x39101009, 0x39111009, 0x39121009, 0x39131009,
+            0x39141009, 0x39151009, 0x39161009, 0x39171009, 0x39181009, 0x39191009,
+            0x391A1009, 0x391B1009, 0x391C1009, 0x391D1009,
+        },
+        {
+            0x391E1009, 0x391F1009, 0x39201009, 0x39211009, 0x39221009, 0x39231009,
+            0x39241009, 0x39251009, 0x39261009, 0x39271009, 0x39281009, 0x39291009,
+            0x392A1009, 0x392B1009, 0x392C1009, 0x392D1009,
+        },
+        {
+            0x2C9E1009, 0x2C9F1009, 0x2CA01009, 0x2CA11009, 0x2CA21009, 0x2CA31009,
+            0x2CA41009, 0x2CA51009, 0x2CA61009, 0x2CA71009, 0x2CA81009, 0x2CA91009,
+            0x2CAA1009, 0x2CAB1009, 0x2CAC1009, 0x2CAD1009,
+        },
+        {
+            0x2CAE1009, 0x2CAF1009, 0x2CB01009, 0x2CB11009, 0x2CB21009, 0x2CB31009,
+            0x2CB41009, 0x2CB51009, 0x2CB61009, 0x2CB71009, 0x2CB81009, 0x2CD21009,
+            0x2CD31009, 0x2CD41009, 0x2CD51009, 0x2CD61009,
+        },
+        {
+            0x2CD71009, 0x2CD81009, 0x2CD91009, 0x2CC41009, 0x2CC51009, 0x2CC61009,
+            0x2CC71009, 0x2CC81009, 0x2CC91009, 0x2CCA1009, 0x2CCB1009, 0x02B11009,
+            0x00006609, 0x2CDA1009, 0x00000000, 0x00000000,
+        },
+        {
+            0x423A1009, 0x423B1009, 0x423C1009, 0x423D1009, 0x423E1009, 0x423F1009,
+            0x42401009, 0x42411009, 0x42421009, 0x42431009, 0x42441009, 0x42451009,
+            0x42461009, 0x42471009, 0x42481009, 0x42491009,
+        },
+        {
+            0x424A1009, 0x424B1009, 0x424C1009, 0x424D1009, 0x424E1009, 0x424F1009,
+            0x42501009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x42A91009,
+            0x42AA1009, 0x42AB1009, 0x42AC1009, 0x42AD1009,
+        },
+        {
+            0x42AE1009, 0x42AF1009, 0x42B01009, 0x42B11009, 0x42B21009, 0x42B31009,
+            0x42B41009, 0x42B51009, 0x42B61009, 0x42B71009, 0x42B81009, 0x42B91009,
+            0x42BA1009, 0x42BB1009, 0x42BC1009, 0x42BD1009,
+        },
+        {
+            0x42BE1009, 0x42BF1009, 0x42C01009, 0x42C11009, 0x42C21009, 0x42C31009,
+            0x42C41009, 0x42C51009, 0x42C61009, 0x42C71009, 0x42C81009, 0x42C91009,
+            0x42CA1009, 0x42CB1009, 0x42CC1009, 0x42CD1009,
+        },
+        {
+            0x42CE1009, 0x42CF1009, 0x42D01009, 0x42D11009, 0x42D21009, 0x42D31009,
+            0x42D41009, 0x42D51009, 0x42D61009, 0x42D71009, 0x42D81009, 0x42D91009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x002E900A, 0x002E980A,
+        },
+        {
+            0x00000000, 0x002EA00A, 0x00000000, 0x002EA80A, 0x002EB00A, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x002EB80A,
+        },
+        {
+            0x00000000, 0x002EC00A, 0x00000000, 0x002EC80A, 0x002ED00A, 0x00000000,
+            0x00000000, 0x002ED80A, 0x002EE00A, 0x002EE80A, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x002EF00A, 0x002EF80A, 0x002F000A, 0x002F080E, 0x002F140E, 0x002F200E,
+            0x002F2C0A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x002F340A, 0x002F3C0A, 0x002F440A,
+            0x002F4C0A, 0x002F540A, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00003089, 0x00000000,
+        },
+        {
+            0x262D1015, 0x261E1015, 0x26211015, 0x26221015, 0x26281015, 0x26291015,
+            0x262A1015, 0x26311015, 0x26331015, 0x06661015, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x002F5C0A,
+        },
+        {
+            0x26681069, 0x26681065, 0x26751069, 0x26751065, 0x2675105D, 0x26751061,
+            0x26761069, 0x26761065, 0x2676105D, 0x26761061, 0x26771069, 0x26771065,
+            0x2677105D, 0x26771061, 0x26881069, 0x26881065,
+        },
+        {
+            0x2688105D, 0x26881061, 0x268B1069, 0x268B1065, 0x268B105D, 0x268B1061,
+            0x26871069, 0x26871065, 0x2687105D, 0x26871061, 0x26E91069, 0x26E91065,
+            0x26E9105D, 0x26E91061, 0x26EC1069, 0x26EC1065,
+        },
+        {
+            0x26EC105D, 0x26EC1061, 0x26911069, 0x26911065, 0x2691105D, 0x26911061,
+            0x26901069, 0x26901065, 0x2690105D, 0x26901061, 0x26921069, 0x26921065,
+            0x2692105D, 0x26921061, 0x26941069, 0x26941065,
+        },
+        {
+            0x2694105D, 0x26941061, 0x26AB1069, 0x26AB1065, 0x26AA1069, 0x26AA1065,
+            0x26AD1069, 0x26AD1065, 0x26A61069, 0x26A61065, 0x26BC1069, 0x26BC1065,
+            0x26B51069, 0x26B51065, 0x26F71069, 0x26F71065,
+        },
+        {
+            0x26F7105D, 0x26F71061, 0x26FF1069, 0x26FF1065, 0x26FF105D, 0x26FF1061,
+            0x27041069, 0x27041065, 0x2704105D, 0x27041061, 0x27021069, 0x27021065,
+            0x2702105D, 0x27021061, 0x27191069, 0x27191065,
+        },
+        {
+            0x271B1069, 0x271B1065, 0x271B105D, 0x271B1061, 0x002F640A, 0x002F6C0A,
+            0x27241069, 0x27241065, 0x2724105D, 0x27241061, 0x27231069, 0x27231065,
+            0x2723105D, 0x27231061, 0x27451069, 0x27451065,
+        },
+        {
+            0x002F740A, 0x002F7C0A, 0x05361009, 0x05371009, 0x05381009, 0x05391009,
+            0x053A1009, 0x053B1009, 0x053C1009, 0x053D1009, 0x053E1009, 0x053F1009,
+            0x05401009, 0x05411009, 0x05421009, 0x05431009,
+        },
+        {
+            0x05441009, 0x05451009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x26FC1069, 0x26FC1065, 0x26FC105D,
+            0x26FC1061, 0x272C1069, 0x272C1065, 0x272B1069, 0x272B1065, 0x272D1069,
+            0x272D1065, 0x002F840A, 0x27301069, 0x27301065,
+        },
+        {
+            0x272A1069, 0x272A1065, 0x272E1069, 0x272E1065, 0x273B1069, 0x273B1065,
+            0x273B105D, 0x273B1061, 0x2736105D, 0x27361061, 0x002F8C0A, 0x002F940A,
+            0x002F9C0A, 0x002FA40A, 0x002FAC0A, 0x002FB40A,
+        },
+        {
+            0x002FBC0A, 0x002FC40A, 0x002FCC0A, 0x002FD40A, 0x002FDC0A, 0x002FE40A,
+            0x002FEC0A, 0x002FF40A, 0x002FFC0A, 0x0030040A, 0x00300C0A, 0x0030140A,
+            0x27381069, 0x27381065, 0x2738105D, 0x27381061,
+        },
+        {
+            0x00301C0A, 0x0030240A, 0x00302C0A, 0x0030040A, 0x0030340A, 0x00303C0A,
+            0x0030440A, 0x00304C0A, 0x0030540A, 0x00305C0A, 0x0030640A, 0x00306C0A,
+            0x0030740A, 0x00307C0A, 0x0030840A, 0x00308C0A,
+        },
+        {
+            0x0030940A, 0x00309C0A, 0x0030A40A, 0x0030AC0A, 0x0030B40A, 0x0030BC0A,
+            0x0030C40A, 0x0030CC0A, 0x0030D40A, 0x0030DC0A, 0x0030E40A, 0x0030EC0A,
+            0x0030F40A, 0x0030FC0A, 0x0031040A, 0x00310C0A,
+        },
+        {
+            0x0031140A, 0x00311C0A, 0x0031240A, 0x00312C0A, 0x0031340A, 0x00313C0A,
+            0x0031440A, 0x00314C0A, 0x0031540A, 0x00315C0A, 0x0031640A, 0x00316C0A,
+            0x0031740A, 0x00317C0A, 0x0031840A, 0x00318C0A,
+        },
+        {
+            0x0031940A, 0x00319C0A, 0x0031A40A, 0x0031AC0A, 0x0031B40A, 0x0031BC0A,
+            0x0031C40A, 0x0031CC0A, 0x0031D40A, 0x0031DC0A, 0x0031E40A, 0x0031EC0A,
+            0x0031F40A, 0x0031FC0A, 0x0032040A, 0x00320C0A,
+        },
+        {
+            0x0032140A, 0x00321C0A, 0x0032240A, 0x00322C0A, 0x0032340A, 0x00323C0A,
+            0x0032440A, 0x00324C0A, 0x0032540A, 0x00325C0A, 0x0032640A, 0x00326C0A,
+            0x0032740A, 0x00327C0A, 0x0032840A, 0x00328C0A,
+        },
+        {
+            0x0032940A, 0x00329C0A, 0x0032A40A, 0x0032AC0A, 0x0032B40A, 0x0032BC0A,
+            0x0032C40A, 0x0032CC0A, 0x0032D40A, 0x0032DC0A, 0x0032E40A, 0x0032EC0A,
+            0x0032F40A, 0x0032FC0A, 0x0033040A, 0x00330C0A,
+        },
+        {
+            0x0033140A, 0x00331C0A, 0x0033240A, 0x00332C0A, 0x0033340A, 0x00333C0A,
+            0x0033440A, 0x00334C0A, 0x00300C0A, 0x0033540A, 0x00335C0A, 0x0033640A,
+            0x00336C0A, 0x0033740A, 0x00337C0A, 0x0033840A,
+        },
+        {
+            0x00338C0A, 0x0033940A, 0x00339C0A, 0x0033A40A, 0x0033AC0A, 0x0033B40A,
+            0x0033BC0A, 0x0033C40A, 0x0033CC0A, 0x0033D40A, 0x0033DC0A, 0x0033E40A,
+            0x0033EC0A, 0x0033F40A, 0x0033FC0A, 0x0034040A,
+        },
+        {
+            0x00340C0A, 0x0034140A, 0x00341C0A, 0x0034240A, 0x00342C0A, 0x0034340A,
+            0x00343C0A, 0x0034440A, 0x00344C0A, 0x0034540A, 0x00345C0A, 0x0034640A,
+            0x00346C0A, 0x0034740A, 0x00347C0A, 0x0034840A,
+        },
+        {
+            0x00348C0A, 0x0034940A, 0x00349C0A, 0x0034A40A, 0x0034AC0A, 0x0034B40A,
+            0x0034BC0A, 0x0034C40A, 0x0034CC0A, 0x0034D40A, 0x0034DC0A, 0x0034E40A,
+            0x0034EC0A, 0x0034F40A, 0x0034FC0A, 0x0035040A,
+        },
+        {
+            0x00350C0A, 0x0035140A, 0x00351C0A, 0x0035240A, 0x00352C0A, 0x0035340A,
+            0x00353C0A, 0x0035440A, 0x00354C0A, 0x0035540A, 0x00355C0A, 0x0035640A,
+            0x00356C0A, 0x0035740A, 0x00357C0A, 0x0035840A,
+        },
+        {
+            0x00358C0A, 0x0035940A, 0x00359C0A, 0x0035A40A, 0x0035AC0A, 0x0035B40A,
+            0x0035BC0A, 0x0035C40A, 0x0035CC0A, 0x0035D40A, 0x0035DC0A, 0x0035E40A,
+            0x0035EC0A, 0x0035F40A, 0x0035FC0A, 0x0036040A,
+        },
+        {
+            0x00360C0A, 0x0036140A, 0x00361C0A, 0x0036240A, 0x00362C0A, 0x0036340A,
+            0x00363C0A, 0x0036440A, 0x00364C0A, 0x0036540A, 0x00365C0A, 0x0036640A,
+            0x00366C0A, 0x0036740A, 0x00367C0A, 0x0036840A,
+        },
+        {
+            0x00368C0A, 0x0036940A, 0x00369C0A, 0x0036A40A, 0x0036AC0A, 0x0036B40A,
+            0x0036BC0A, 0x0036C40A, 0x0036CC0A, 0x0036D40A, 0x0036DC0A, 0x0036E40A,
+            0x0036EC0A, 0x0036F40A, 0x0036FC0A, 0x0037040A,
+        },
+        {
+            0x00370C0A, 0x0037140A, 0x00371C0A, 0x0037240A, 0x00372C0A, 0x0037340A,
+            0x00373C0A, 0x0037440A, 0x00374C0A, 0x0037540A, 0x00375C0A, 0x0037640A,
+            0x00376C0A, 0x0037740A, 0x00377C0A, 0x0037840A,
+        },
+        {
+            0x00378C0A, 0x0037940A, 0x00379C0A, 0x0037A40A, 0x0037AC0A, 0x0037B40A,
+            0x0037BC0A, 0x0037C40A, 0x0037CC0A, 0x0037D40A, 0x0037DC0A, 0x0037E40A,
+            0x0037EC0A, 0x0037F40A, 0x0037FC0A, 0x0038040A,
+        },
+        {
+            0x00380C0A, 0x0038140A, 0x00381C0A, 0x0038240A, 0x00382C0A, 0x0038340A,
+            0x00383C0A, 0x0038440A, 0x00384C0A, 0x0038540A, 0x00385C0A, 0x0038640A,
+            0x00386C0A, 0x0038740A, 0x00387C0A, 0x0038840A,
+        },
+        {
+            0x00388C0A, 0x0038940A, 0x00389C0A, 0x0038A40A, 0x0038AC0A, 0x0038B40A,
+            0x0038BC0A, 0x0038C40A, 0x0038CC0A, 0x0038D40A, 0x0038DC0A, 0x0038E40A,
+            0x0038EC0A, 0x0038F40A, 0x0038FC0A, 0x0039040A,
+        },
+        {
+            0x00390C0A, 0x0039140A, 0x00391C0A, 0x0039240A, 0x00392C0A, 0x0039340A,
+            0x00393C0A, 0x0039440A, 0x00394C0A, 0x0039540A, 0x00395C0A, 0x0039640A,
+            0x00396C0A, 0x0039740A, 0x00397C0A, 0x0039840A,
+        },
+        {
+            0x00398C0A, 0x0039940A, 0x00399C0A, 0x0039A40A, 0x0039AC0A, 0x0039B40A,
+            0x0039BC0A, 0x0039C40A, 0x0039CC0A, 0x0039D40A, 0x0039DC0A, 0x0039E40A,
+            0x0039EC0A, 0x0039F40A, 0x03921009, 0x03931009,
+        },
+        {
+            0x0039FC0E, 0x003A080E, 0x003A140E, 0x003A200E, 0x003A2C0E, 0x003A380E,
+            0x003A440E, 0x003A500E, 0x003A5C0E, 0x003A680E, 0x003A740E, 0x003A800E,
+            0x003A8C0E, 0x003A980E, 0x003AA40E, 0x003AB00E,
+        },
+        {
+            0x003ABC0E, 0x003AC80E, 0x003AD40E, 0x003AE00E, 0x003AEC0E, 0x003AF80E,
+            0x003B040E, 0x003B100E, 0x003B1C0E, 0x003B280E, 0x003B340E, 0x003B400E,
+            0x003B4C0E, 0x003B580E, 0x003B640E, 0x003B700E,
+        },
+        {
+            0x003B7C0E, 0x003B880E, 0x003B940E, 0x003BA00E, 0x003BAC0E, 0x003BB80E,
+            0x003BC40E, 0x003BD00E, 0x003BDC0E, 0x003BE80E, 0x003BF40E, 0x003C000E,
+            0x003C0C0E, 0x003C180E, 0x003C240E, 0x003C300E,
+        },
+        {
+            0x003C3C0E, 0x003C480E, 0x003C540E, 0x003C600E, 0x003C6C0E, 0x003C780E,
+            0x003C840E, 0x003C900E, 0x003C9C0E, 0x003CA80E, 0x003CB40E, 0x003CC00E,
+            0x003CCC0E, 0x003CD80E, 0x003CE40E, 0x003CF00E,
+        },
+        {
+            0x00000000, 0x00000000, 0x003CFC0E, 0x003D080E, 0x003D140E, 0x003D200E,
+            0x003D2C0E, 0x003D380E, 0x003D440E, 0x003D500E, 0x003D5C0E, 0x003D680E,
+            0x003D740E, 0x003D800E, 0x003D8C0E, 0x003D980E,
+        },
+        {
+            0x003DA40E, 0x003DB00E, 0x003DBC0E, 0x003DC80E, 0x003DD40E, 0x003DE00E,
+            0x003DEC0E, 0x003DF80E, 0x003E040E, 0x003E100E, 0x003E1C0E, 0x003E280E,
+            0x003E340E, 0x003E400E, 0x003E4C0E, 0x003E580E,
+        },
+        {
+            0x003E640E, 0x003E700E, 0x003E7C0E, 0x003E880E, 0x003E940E, 0x003EA00E,
+            0x003EAC0E, 0x003EB80E, 0x003EC40E, 0x003ED00E, 0x003EDC0E, 0x003EE80E,
+            0x003EF40E, 0x003F000E, 0x003F0C0E, 0x003F180E,
+        },
+        {
+            0x003F240E, 0x003F300E, 0x003F3C0E, 0x003F480E, 0x003F540E, 0x003F600E,
+            0x003F6C0E, 0x003F780E, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x003F840E, 0x003F900E, 0x003F9C12, 0x003FAC12, 0x003FBC12, 0x003FCC12,
+            0x003FDC12, 0x003FEC12, 0x003FFC12, 0x00400C0E, 0x0040184A, 0x00406022,
+            0x00408012, 0x05351009, 0x00000000, 0x00000000,
+        },
+        {
+            0x02231059, 0x02361059, 0x02921059, 0x02401059, 0x023A1059, 0x02671059,
+            0x026D1059, 0x038C1059, 0x038D1059, 0x0040900E, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00002789, 0x00000001, 0x00002709, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00001A09, 0x00000001, 0x00002709, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00002809, 0x00000001,
+        },
+        {
+            0x00409C0A, 0x02161059, 0x02151059, 0x020B1059, 0x020B1059, 0x03281059,
+            0x03291059, 0x032C1059, 0x032D1059, 0x038A1059, 0x038B1059, 0x03881059,
+            0x03891059, 0x03821059, 0x03831059, 0x03801059,
+        },
+        {
+            0x03811059, 0x03841059, 0x03851059, 0x03861059, 0x03871059, 0x02371009,
+            0x02381009, 0x032A1059, 0x032B1059, 0x020A1011, 0x020A1011, 0x020A1011,
+            0x020A1011, 0x020B1011, 0x020B1011, 0x020B1011,
+        },
+        {
+            0x0223103D, 0x0236103D, 0x027E103D, 0x00000000, 0x023A103D, 0x0240103D,
+            0x026D103D, 0x0267103D, 0x0216103D, 0x0328103D, 0x0329103D, 0x032C103D,
+            0x032D103D, 0x038A103D, 0x038B103D, 0x03AC103D,
+        },
+        {
+            0x03A9103D, 0x03A1103D, 0x0666103D, 0x020D103D, 0x066A103D, 0x066C103D,
+            0x066B103D, 0x00000000, 0x03A7103D, 0x1F64103D, 0x03AD103D, 0x03A0103D,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x000036E9, 0x000036E1, 0x00003869, 0x00000001, 0x000039E9, 0x00000000,
+            0x00003B69, 0x00003B61, 0x00003D69, 0x00003D61, 0x00003EE9, 0x00003EE1,
+            0x00004069, 0x00004061, 0x000040E9, 0x000040E1,
+        },
+        {
+            0x26641069, 0x26651069, 0x26651065, 0x26661069, 0x26661065, 0x26691069,
+            0x26691065, 0x266A1069, 0x266A1065, 0x266E1069, 0x266E1065, 0x266E105D,
+            0x266E1061, 0x26721069, 0x26721065, 0x26741069,
+        },
+        {
+            0x26741065, 0x2674105D, 0x26741061, 0x26841069, 0x26841065, 0x26851069,
+            0x26851065, 0x2685105D, 0x26851061, 0x26861069, 0x26861065, 0x2686105D,
+            0x26861061, 0x268F1069, 0x268F1065, 0x268F105D,
+        },
+        {
+            0x268F1061, 0x26991069, 0x26991065, 0x2699105D, 0x26991061, 0x269A1069,
+            0x269A1065, 0x269A105D, 0x269A1061, 0x26A41069, 0x26A41065, 0x26A51069,
+            0x26A51065, 0x26B31069, 0x26B31065, 0x26B41069,
+        },
+        {
+            0x26B41065, 0x26C61069, 0x26C61065, 0x26C6105D, 0x26C61061, 0x26C71069,
+            0x26C71065, 0x26C7105D, 0x26C71061, 0x26D11069, 0x26D11065, 0x26D1105D,
+            0x26D11061, 0x26D21069, 0x26D21065, 0x26D2105D,
+        },
+        {
+            0x26D21061, 0x26D71069, 0x26D71065, 0x26D7105D, 0x26D71061, 0x26D81069,
+            0x26D81065, 0x26D8105D, 0x26D81061, 0x26DB1069, 0x26DB1065, 0x26DB105D,
+            0x26DB1061, 0x26DC1069, 0x26DC1065, 0x26DC105D,
+        },
+        {
+            0x26DC1061, 0x26E41069, 0x26E41065, 0x26E4105D, 0x26E41061, 0x26F01069,
+            0x26F01065, 0x26F0105D, 0x26F01061, 0x26F61069, 0x26F61065, 0x26F6105D,
+            0x26F61061, 0x270C1069, 0x270C1065, 0x270C105D,
+        },
+        {
+            0x270C1061, 0x27141069, 0x27141065, 0x2714105D, 0x27141061, 0x27181069,
+            0x27181065, 0x2718105D, 0x27181061, 0x27221069, 0x27221065, 0x2722105D,
+            0x27221061, 0x27281069, 0x27281065, 0x27361069,
+        },
+        {
+            0x27361065, 0x27371069, 0x27371065, 0x2737105D, 0x27371061, 0x0040A40A,
+            0x0040AC0A, 0x0040B40A, 0x0040BC0A, 0x0040C40A, 0x0040CC0A, 0x0040D40A,
+            0x0040DC0A, 0x00000000, 0x00000000, 0x00000001,
+        },
+        {
+            0x00000000, 0x0267100D, 0x031D100D, 0x03AC100D, 0x1F64100D, 0x03AD100D,
+            0x03A9100D, 0x0316100D, 0x0328100D, 0x0329100D, 0x03A1100D, 0x0666100D,
+            0x0223100D, 0x020D100D, 0x027E100D, 0x03A6100D,
+        },
+        {
+            0x1F98100D, 0x1F99100D, 0x1F9A100D, 0x1F9B100D, 0x1F9C100D, 0x1F9D100D,
+            0x1F9E100D, 0x1F9F100D, 0x1FA0100D, 0x1FA1100D, 0x0240100D, 0x023A100D,
+            0x066A100D, 0x066B100D, 0x066C100D, 0x026D100D,
+        },
+        {
+            0x03A0100D, 0x1FA21025, 0x1FBC1025, 0x1FD61025, 0x1FEB1025, 0x20071025,
+            0x20421025, 0x20511025, 0x20751025, 0x20901025, 0x20AB1025, 0x20C41025,
+            0x20D61025, 0x21091025, 0x21181025, 0x213C1025,
+        },
+        {
+            0x216B1025, 0x21801025, 0x21931025, 0x21D21025, 0x21F71025, 0x22171025,
+            0x22471025, 0x22591025, 0x22641025, 0x22701025, 0x22861025, 0x032A100D,
+            0x03A7100D, 0x032B100D, 0x04B7100D, 0x020B100D,
+        },
+        {
+            0x04B4100D, 0x1FA2100D, 0x1FBC100D, 0x1FD6100D, 0x1FEB100D, 0x2007100D,
+            0x2042100D, 0x2051100D, 0x2075100D, 0x2090100D, 0x20AB100D, 0x20C4100D,
+            0x20D6100D, 0x2109100D, 0x2118100D, 0x213C100D,
+        },
+        {
+            0x216B100D, 0x2180100D, 0x2193100D, 0x21D2100D, 0x21F7100D, 0x2217100D,
+            0x2247100D, 0x2259100D, 0x2264100D, 0x2270100D, 0x2286100D, 0x032C100D,
+            0x066E100D, 0x032D100D, 0x0670100D, 0x033E100D,
+        },
+        {
+            0x033F100D, 0x02921049, 0x03841049, 0x03851049, 0x02361049, 0x02211049,
+            0x43091049, 0x42DA1041, 0x42DB1041, 0x42DC1041, 0x42DE1041, 0x42DF1041,
+            0x42FE1041, 0x42FF1041, 0x43001041, 0x42EC1041,
+        },
+        {
+            0x1F601049, 0x42DA1049, 0x42DB1049, 0x42DC1049, 0x42DE1049, 0x42DF1049,
+            0x42E01049, 0x42E11049, 0x42E21049, 0x42E31049, 0x42E41049, 0x42E51049,
+            0x42E61049, 0x42E71049, 0x42E81049, 0x42E91049,
+        },
+        {
+            0x42EA1049, 0x42EB1049, 0x42EC1049, 0x42ED1049, 0x42EE1049, 0x42EF1049,
+            0x42F01049, 0x42F11049, 0x42F21049, 0x42F31049, 0x42F41049, 0x42F51049,
+            0x42F61049, 0x42F71049, 0x42F81049, 0x42F91049,
+        },
+        {
+            0x42FA1049, 0x42FB1049, 0x42FC1049, 0x42FD1049, 0x42FE1049, 0x42FF1049,
+            0x43001049, 0x43011049, 0x43021049, 0x43031049, 0x43041049, 0x43051049,
+            0x43061049, 0x430A1049, 0x00001BC9, 0x00001C49,
+        },
+        {
+            0x41F21049, 0x41751049, 0x41761049, 0x42531049, 0x41771049, 0x42551049,
+            0x42561049, 0x41781049, 0x41791049, 0x417A1049, 0x42591049, 0x425A1049,
+            0x425B1049, 0x425C1049, 0x425D1049, 0x425E1049,
+        },
+        {
+            0x418F1049, 0x417B1049, 0x417C1049, 0x417D1049, 0x41961049, 0x417E1049,
+            0x417F1049, 0x41801049, 0x41811049, 0x41821049, 0x41831049, 0x41841049,
+            0x41851049, 0x41861049, 0x41871049, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x41F31049, 0x41F41049, 0x41F51049, 0x41F61049,
+            0x41F71049, 0x41F81049, 0x00000000, 0x00000000, 0x41F91049, 0x41FA1049,
+            0x41FB1049, 0x41FC1049, 0x41FD1049, 0x41FE1049,
+        },
+        {
+            0x00000000, 0x00000000, 0x41FF1049, 0x42001049, 0x42011049, 0x42021049,
+            0x42031049, 0x42041049, 0x00000000, 0x00000000, 0x42051049, 0x42061049,
+            0x42071049, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F63100D, 0x1F65100D, 0x066D100D, 0x04B8100D, 0x066F100D, 0x1F66100D,
+            0x1F80100D, 0x00000000, 0x086B1049, 0x05EC1049, 0x05EE1049, 0x05ED1049,
+            0x05EF1049, 0x09091049, 0x09341049, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x00000001,
+            0x1D551009, 0xFFFD1009, 0x00000000, 0x00000000,
+        },
+        {
+            0x4CFC1009, 0x4CFD1009, 0x4CFE1009, 0x4CFF1009, 0x4D001009, 0x4D011009,
+            0x4D021009, 0x4D031009, 0x4D041009, 0x4D051009, 0x4D061009, 0x4D071009,
+            0x00000000, 0x4D081009, 0x4D091009, 0x4D0A1009,
+        },
+        {
+            0x4D0B1009, 0x4D0C1009, 0x4D0D1009, 0x4D0E1009, 0x4D0F1009, 0x4D101009,
+            0x4D111009, 0x4D121009, 0x4D131009, 0x4D141009, 0x4D151009, 0x4D161009,
+            0x4D171009, 0x4D181009, 0x4D191009, 0x4D1A1009,
+        },
+        {
+            0x4D1B1009, 0x4D1C1009, 0x4D1D1009, 0x4D1E1009, 0x4D1F1009, 0x4D201009,
+            0x4D211009, 0x00000000, 0x4D221009, 0x4D231009, 0x4D241009, 0x4D251009,
+            0x4D261009, 0x4D271009, 0x4D281009, 0x4D291009,
+        },
+        {
+            0x4D2A1009, 0x4D2B1009, 0x4D2C1009, 0x4D2D1009, 0x4D2E1009, 0x4D2F1009,
+            0x4D301009, 0x4D311009, 0x4D321009, 0x4D331009, 0x4D341009, 0x00000000,
+            0x4D351009, 0x4D361009, 0x00000000, 0x4D371009,
+        },
+        {
+            0x4D381009, 0x4D391009, 0x4D3A1009, 0x4D3B1009, 0x4D3C1009, 0x4D3D1009,
+            0x4D3E1009, 0x4D3F1009, 0x4D401009, 0x4D411009, 0x4D421009, 0x4D431009,
+            0x4D441009, 0x4D451009, 0x00000000, 0x00000000,
+        },
+        {
+            0x4D461009, 0x4D471009, 0x4D481009, 0x4D491009, 0x4D4A1009, 0x4D4B1009,
+            0x4D4C1009, 0x4D4D1009, 0x4D4E1009, 0x4D4F1009, 0x4D501009, 0x4D511009,
+            0x4D521009, 0x4D531009, 0x00000000, 0x00000000,
+        },
+        {
+            0x4D541009, 0x4D551009, 0x4D561009, 0x4D571009, 0x4D581009, 0x4D591009,
+            0x4D5A1009, 0x4D5B1009, 0x4D5C1009, 0x4D5D1009, 0x4D5E1009, 0x4D5F1009,
+            0x4D601009, 0x4D611009, 0x4D621009, 0x4D631009,
+        },
+        {
+            0x4D641009, 0x4D651009, 0x4D661009, 0x4D671009, 0x4D681009, 0x4D691009,
+            0x4D6A1009, 0x4D6B1009, 0x4D6C1009, 0x4D6D1009, 0x4D6E1009, 0x4D6F1009,
+            0x4D701009, 0x4D711009, 0x4D721009, 0x4D731009,
+        },
+        {
+            0x4D741009, 0x4D751009, 0x4D761009, 0x4D771009, 0x4D781009, 0x4D791009,
+            0x4D7A1009, 0x4D7B1009, 0x4D7C1009, 0x4D7D1009, 0x4D7E1009, 0x4D7F1009,
+            0x4D801009, 0x4D811009, 0x4D821009, 0x4D831009,
+        },
+        {
+            0x4D841009, 0x4D851009, 0x4D861009, 0x4D871009, 0x4D881009, 0x4D891009,
+            0x4D8A1009, 0x4D8B1009, 0x4D8C1009, 0x4D8D1009, 0x4D8E1009, 0x4D8F1009,
+            0x4D901009, 0x4D911009, 0x4D921009, 0x4D931009,
+        },
+        {
+            0x4D941009, 0x4D951009, 0x4D961009, 0x4D971009, 0x4D981009, 0x4D991009,
+            0x4D9A1009, 0x4D9B1009, 0x4D9C1009, 0x4D9D1009, 0x4D9E1009, 0x4D9F1009,
+            0x4DA01009, 0x4DA11009, 0x4DA21009, 0x4DA31009,
+        },
+        {
+            0x4DA41009, 0x4DA51009, 0x4DA61009, 0x4DA71009, 0x4DA81009, 0x4DA91009,
+            0x4DAA1009, 0x4DAB1009, 0x4DAC1009, 0x4DAD1009, 0x4DAE1009, 0x4DAF1009,
+            0x4DB01009, 0x4DB11009, 0x4DB21009, 0x4DB31009,
+        },
+        {
+            0x4DB41009, 0x4DB51009, 0x4DB61009, 0x4DB71009, 0x4DB81009, 0x4DB91009,
+            0x4DBA1009, 0x4DBB1009, 0x4DBC1009, 0x4DBD1009, 0x4DBE1009, 0x4DBF1009,
+            0x4DC01009, 0x4DC11009, 0x4DC21009, 0x4DC31009,
+        },
+        {
+            0x4DC41009, 0x4DC51009, 0x4DC61009, 0x4DC71009, 0x4DC81009, 0x4DC91009,
+            0x4DCA1009, 0x4DCB1009, 0x4DCC1009, 0x4DCD1009, 0x4DCE1009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x030B1009, 0x030C1009, 0x030D1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x1DBE1009, 0x1DBF1009, 0x1DC01009, 0x1DC11009, 0x1DC21009, 0x1DC31009,
+            0x1DC41009, 0x1DC51009, 0x1DC61009, 0x1DC71009, 0x1DC81009, 0x1DC91009,
+            0x1DCA1009, 0x1DCB1009, 0x1DCC1009, 0x1DCD1009,
+        },
+        {
+            0x1DCE1009, 0x1DCF1009, 0x1DD01009, 0x1DD11009, 0x1DD21009, 0x1DD31009,
+            0x1DD41009, 0x1DD51009, 0x1DD61009, 0x1DD71009, 0x1DD81009, 0x1DD91009,
+            0x1DDA1009, 0x1DDB1009, 0x1DDC1009, 0x1DDD1009,
+        },
+        {
+            0x1DDE1009, 0x1DDF1009, 0x1DE01009, 0x1DE11009, 0x00000000, 0x00000000,
+            0x00000000, 0x10C41009, 0x10C51009, 0x10C61009, 0x10C71009, 0x10C81009,
+            0x10C91009, 0x10CA1009, 0x10CB1009, 0x10CC1009,
+        },
+        {
+            0x1DE21009, 0x1DE31009, 0x1F991009, 0x1F9D1009, 0x1DE41009, 0x1DE51009,
+            0x1DE61009, 0x1DE71009, 0x1F9D1009, 0x1DE81009, 0x1DE91009, 0x1DEA1009,
+            0x1DEB1009, 0x1DEC1009, 0x1DED1009, 0x1F9D1009,
+        },
+        {
+            0x1DEE1009, 0x1DEF1009, 0x1DF01009, 0x1DF11009, 0x1DF21009, 0x1DF31009,
+            0x1DF41009, 0x1DF51009, 0x1F991009, 0x1F991009, 0x1F991009, 0x1F9A1009,
+            0x1F9A1009, 0x1F9A1009, 0x1F9A1009, 0x1F9D1009,
+        },
+        {
+            0x1DF61009, 0x1DF71009, 0x1DF81009, 0x1DF91009, 0x1DFA1009, 0x1DFB1009,
+            0x1DFC1009, 0x1DFD1009, 0x1DFE1009, 0x1DFF1009, 0x1E001009, 0x1E011009,
+            0x1E021009, 0x1E031009, 0x1E041009, 0x1E051009,
+        },
+        {
+            0x1E061009, 0x1E071009, 0x1E081009, 0x1F9D1009, 0x1E091009, 0x1E0A1009,
+            0x1E0B1009, 0x1E0C1009, 0x1E0D1009, 0x10CD1009, 0x10CE1009, 0x10CF1009,
+            0x10D01009, 0x10D11009, 0x10D21009, 0x10D31009,
+        },
+        {
+            0x10D41009, 0x10D51009, 0x10D61009, 0x10D71009, 0x10D81009, 0x10D91009,
+            0x10DA1009, 0x10DB1009, 0x10DC1009, 0x10DD1009, 0x1F981009, 0x1E0E1009,
+            0x10DE1009, 0x10DF1009, 0x10E01009, 0x00000000,
+        },
+        {
+            0x10E11009, 0x10E21009, 0x10E31009, 0x10E41009, 0x10E51009, 0x10E61009,
+            0x10E71009, 0x10E81009, 0x10E91009, 0x10EA1009, 0x10EB1009, 0x10EC1009,
+            0x10ED1009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x10EE1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x10EF1009, 0x10F01009, 0x10F11009, 0x10F21009, 0x10F31009, 0x10F41009,
+            0x10F51009, 0x10F61009, 0x10F71009, 0x10F81009, 0x10F91009, 0x10FA1009,
+            0x10FB1009, 0x10FC1009, 0x10FD1009, 0x10FE1009,
+        },
+        {
+            0x10FF1009, 0x11001009, 0x11011009, 0x11021009, 0x11031009, 0x11041009,
+            0x11051009, 0x11061009, 0x11071009, 0x11081009, 0x11091009, 0x110A1009,
+            0x110B1009, 0x110C1009, 0x110D1009, 0x110E1009,
+        },
+        {
+            0x110F1009, 0x11101009, 0x11111009, 0x11121009, 0x11131009, 0x11141009,
+            0x11151009, 0x11161009, 0x11171009, 0x11181009, 0x11191009, 0x111A1009,
+            0x111B1009, 0x00008B89, 0x00000000, 0x00000000,
+        },
+        {
+            0x4AC11009, 0x4AC21009, 0x4AC31009, 0x4AC41009, 0x4AC51009, 0x4AC61009,
+            0x4AC71009, 0x4AC81009, 0x4AC91009, 0x4ACA1009, 0x4ACB1009, 0x4ACC1009,
+            0x4ACD1009, 0x4ACE1009, 0x4ACF1009, 0x4AD01009,
+        },
+        {
+            0x4AD11009, 0x4AD21009, 0x4AD31009, 0x4AD41009, 0x4AD51009, 0x4AD61009,
+            0x4AD71009, 0x4AD81009, 0x4AD91009, 0x4ADA1009, 0x4ADB1009, 0x4ADC1009,
+            0x4ADD1009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4ADE1009, 0x4ADF1009, 0x4AE01009, 0x4AE11009, 0x4AE21009, 0x4AE31009,
+            0x4AE41009, 0x4AE51009, 0x4AE61009, 0x4AE71009, 0x4AE81009, 0x4AE91009,
+            0x4AEA1009, 0x4AEB1009, 0x4AEC1009, 0x4AED1009,
+        },
+        {
+            0x4AEE1009, 0x4AEF1009, 0x4AF01009, 0x4AF11009, 0x4AF21009, 0x4AF31009,
+            0x4AF41009, 0x4AF51009, 0x4AF61009, 0x4AF71009, 0x4AF81009, 0x4AF91009,
+            0x4AFA1009, 0x4AFB1009, 0x4AFC1009, 0x4AFD1009,
+        },
+        {
+            0x4AFE1009, 0x4AFF1009, 0x4B001009, 0x4B011009, 0x4B021009, 0x4B031009,
+            0x4B041009, 0x4B051009, 0x4B061009, 0x4B071009, 0x4B081009, 0x4B091009,
+            0x4B0A1009, 0x4B0B1009, 0x4B0C1009, 0x4B0D1009,
+        },
+        {
+            0x4B0E1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000001, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1E0F1009, 0x1E101009,
+            0x1E111009, 0x1E121009, 0x1E131009, 0x1E141009,
+        },
+        {
+            0x1E151009, 0x1E161009, 0x1E171009, 0x1E181009, 0x1E191009, 0x1E1A1009,
+            0x1E1B1009, 0x1E1C1009, 0x1E1D1009, 0x1E1E1009, 0x1E1F1009, 0x1E201009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4B291009, 0x4B2A1009, 0x4B2B1009, 0x4B2C1009, 0x4B2D1009, 0x4B2E1009,
+            0x4B2F1009, 0x4B301009, 0x4B311009, 0x4B321009, 0x4B331009, 0x4B341009,
+            0x4B351009, 0x4B361009, 0x4B371009, 0x4B391009,
+        },
+        {
+            0x4B3A1009, 0x4B3B1009, 0x4B3C1009, 0x4B3D1009, 0x4B3E1009, 0x4B3F1009,
+            0x4B401009, 0x4B411009, 0x4B421009, 0x4B431009, 0x4B441009, 0x4B451009,
+            0x4B461009, 0x4B471009, 0x4B481009, 0x4B381009,
+        },
+        {
+            0x1F991009, 0x1F9D1009, 0x1DB81009, 0x1DB91009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x4B491009, 0x4B4A1009, 0x4B4B1009,
+        },
+        {
+            0x4B4C1009, 0x4B4D1009, 0x4B4E1009, 0x4B4F1009, 0x4B501009, 0x4B511009,
+            0x4B521009, 0x4B531009, 0x4B541009, 0x4B551009, 0x4B561009, 0x4B571009,
+            0x4B581009, 0x4B591009, 0x4B5A1009, 0x4B5B1009,
+        },
+        {
+            0x4B5C1009, 0x4B5D1009, 0x4B5E1009, 0x4B5F1009, 0x4B601009, 0x4B611009,
+            0x4B621009, 0x4B631009, 0x4B641009, 0x4B651009, 0x4B661009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x25791009, 0x257A1009, 0x257B1009, 0x257C1009, 0x257D1009, 0x257E1009,
+            0x257F1009, 0x25801009, 0x25811009, 0x25821009, 0x25831009, 0x25841009,
+            0x25851009, 0x25861009, 0x25871009, 0x25881009,
+        },
+        {
+            0x25891009, 0x258A1009, 0x258B1009, 0x258C1009, 0x258D1009, 0x258E1009,
+            0x258F1009, 0x25901009, 0x25911009, 0x25921009, 0x25931009, 0x25941009,
+            0x25951009, 0x25961009, 0x25971009, 0x25981009,
+        },
+        {
+            0x25991009, 0x259A1009, 0x259B1009, 0x259C1009, 0x259D1009, 0x259E1009,
+            0x25791011, 0x257C1011, 0x25801011, 0x25861011, 0x258A1011, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x50FF1009, 0x51001009, 0x51011009, 0x51021009, 0x51031009, 0x51041009,
+            0x51051009, 0x51061009, 0x51071009, 0x51081009, 0x51091009, 0x510A1009,
+            0x510B1009, 0x510C1009, 0x510D1009, 0x510E1009,
+        },
+        {
+            0x510F1009, 0x51101009, 0x51111009, 0x51121009, 0x51131009, 0x51141009,
+            0x51151009, 0x51161009, 0x51171009, 0x51181009, 0x51191009, 0x511A1009,
+            0x511B1009, 0x511C1009, 0x00000000, 0x030E1009,
+        },
+        {
+            0x511D1009, 0x511E1009, 0x511F1009, 0x51201009, 0x51211009, 0x51221009,
+            0x51231009, 0x51241009, 0x51251009, 0x51261009, 0x51271009, 0x51281009,
+            0x51291009, 0x512A1009, 0x512B1009, 0x512C1009,
+        },
+        {
+            0x512D1009, 0x512E1009, 0x512F1009, 0x51301009, 0x51311009, 0x51321009,
+            0x51331009, 0x51341009, 0x51351009, 0x51361009, 0x51371009, 0x51381009,
+            0x51391009, 0x513A1009, 0x513B1009, 0x513C1009,
+        },
+        {
+            0x513D1009, 0x513E1009, 0x513F1009, 0x51401009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x51411009, 0x51421009, 0x51431009, 0x51441009,
+            0x51451009, 0x51461009, 0x51471009, 0x51481009,
+        },
+        {
+            0x030F1009, 0x1F991009, 0x1F9A1009, 0x1E211009, 0x1E221009, 0x1E231009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4B671021, 0x4B681021, 0x4B691021, 0x4B6A1021, 0x4B6B1021, 0x4B6C1021,
+            0x4B6D1021, 0x4B6E1021, 0x4B6F1021, 0x4B701021, 0x4B711021, 0x4B721021,
+            0x4B731021, 0x4B741021, 0x4B751021, 0x4B761021,
+        },
+        {
+            0x4B771021, 0x4B781021, 0x4B791021, 0x4B7A1021, 0x4B7B1021, 0x4B7C1021,
+            0x4B7D1021, 0x4B7E1021, 0x4B7F1021, 0x4B801021, 0x4B811021, 0x4B821021,
+            0x4B831021, 0x4B841021, 0x4B851021, 0x4B861021,
+        },
+        {
+            0x4B871021, 0x4B881021, 0x4B891021, 0x4B8A1021, 0x4B8B1021, 0x4B8C1021,
+            0x4B8D1021, 0x4B8E1021, 0x4B671009, 0x4B681009, 0x4B691009, 0x4B6A1009,
+            0x4B6B1009, 0x4B6C1009, 0x4B6D1009, 0x4B6E1009,
+        },
+        {
+            0x4B6F1009, 0x4B701009, 0x4B711009, 0x4B721009, 0x4B731009, 0x4B741009,
+            0x4B751009, 0x4B761009, 0x4B771009, 0x4B781009, 0x4B791009, 0x4B7A1009,
+            0x4B7B1009, 0x4B7C1009, 0x4B7D1009, 0x4B7E1009,
+        },
+        {
+            0x4B7F1009, 0x4B801009, 0x4B811009, 0x4B821009, 0x4B831009, 0x4B841009,
+            0x4B851009, 0x4B861009, 0x4B871009, 0x4B881009, 0x4B891009, 0x4B8A1009,
+            0x4B8B1009, 0x4B8C1009, 0x4B8D1009, 0x4B8E1009,
+        },
+        {
+            0x4B8F1009, 0x4B901009, 0x4B911009, 0x4B921009, 0x4B931009, 0x4B941009,
+            0x4B951009, 0x4B961009, 0x4B971009, 0x4B981009, 0x4B991009, 0x4B9A1009,
+            0x4B9B1009, 0x4B9C1009, 0x4B9D1009, 0x4B9E1009,
+        },
+        {
+            0x4B9F1009, 0x4BA01009, 0x4BA11009, 0x4BA21009, 0x4BA31009, 0x4BA41009,
+            0x4BA51009, 0x4BA61009, 0x4BA71009, 0x4BA81009, 0x4BA91009, 0x4BAA1009,
+            0x4BAB1009, 0x4BAC1009, 0x4BAD1009, 0x4BAE1009,
+        },
+        {
+            0x4BAF1009, 0x4BB01009, 0x4BB11009, 0x4BB21009, 0x4BB31009, 0x4BB41009,
+            0x4BB51009, 0x4BB61009, 0x4BB71009, 0x4BB81009, 0x4BB91009, 0x4BBA1009,
+            0x4BBB1009, 0x4BBC1009, 0x4BBD1009, 0x4BBE1009,
+        },
+        {
+            0x4C4A1009, 0x4C4B1009, 0x4C4C1009, 0x4C4D1009, 0x4C4E1009, 0x4C4F1009,
+            0x4C501009, 0x4C511009, 0x4C521009, 0x4C531009, 0x4C541009, 0x4C551009,
+            0x4C561009, 0x4C571009, 0x4C581009, 0x4C591009,
+        },
+        {
+            0x4C5A1009, 0x4C5B1009, 0x4C5C1009, 0x4C5D1009, 0x4C5E1009, 0x4C5F1009,
+            0x4C601009, 0x4C611009, 0x4C621009, 0x4C631009, 0x4C641009, 0x4C651009,
+            0x4C661009, 0x4C671009, 0x00000000, 0x00000000,
+        },
+        {
+            0x39341021, 0x39351021, 0x39361021, 0x39371021, 0x39381021, 0x39391021,
+            0x393A1021, 0x393B1021, 0x393C1021, 0x393D1021, 0x393E1021, 0x393F1021,
+            0x39401021, 0x39411021, 0x39421021, 0x39431021,
+        },
+        {
+            0x39441021, 0x39451021, 0x39461021, 0x39471021, 0x39481021, 0x39491021,
+            0x394A1021, 0x394B1021, 0x394C1021, 0x394D1021, 0x394E1021, 0x394F1021,
+            0x39501021, 0x39511021, 0x39521021, 0x39531021,
+        },
+        {
+            0x39541021, 0x39551021, 0x39561021, 0x39571021, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x39341009, 0x39351009, 0x39361009, 0x39371009,
+            0x39381009, 0x39391009, 0x393A1009, 0x393B1009,
+        },
+        {
+            0x393C1009, 0x393D1009, 0x393E1009, 0x393F1009, 0x39401009, 0x39411009,
+            0x39421009, 0x39431009, 0x39441009, 0x39451009, 0x39461009, 0x39471009,
+            0x39481009, 0x39491009, 0x394A1009, 0x394B1009,
+        },
+        {
+            0x394C1009, 0x394D1009, 0x394E1009, 0x394F1009, 0x39501009, 0x39511009,
+            0x39521009, 0x39531009, 0x39541009, 0x39551009, 0x39561009, 0x39571009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4C681009, 0x4C691009, 0x4C6A1009, 0x4C6B1009, 0x4C6C1009, 0x4C6D1009,
+            0x4C6E1009, 0x4C6F1009, 0x4C701009, 0x4C711009, 0x4C721009, 0x4C731009,
+            0x4C741009, 0x4C751009, 0x4C761009, 0x4C771009,
+        },
+        {
+            0x4C781009, 0x4C791009, 0x4C7A1009, 0x4C7B1009, 0x4C7C1009, 0x4C7D1009,
+            0x4C7E1009, 0x4C7F1009, 0x4C801009, 0x4C811009, 0x4C821009, 0x4C831009,
+            0x4C841009, 0x4C851009, 0x4C861009, 0x4C871009,
+        },
+        {
+            0x4C881009, 0x4C891009, 0x4C8A1009, 0x4C8B1009, 0x4C8C1009, 0x4C8D1009,
+            0x4C8E1009, 0x4C8F1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4C901009, 0x4C911009, 0x4C921009, 0x4C931009, 0x4C941009, 0x4C951009,
+            0x4C961009, 0x4C971009, 0x4C981009, 0x4C991009, 0x4C9A1009, 0x4C9B1009,
+            0x4C9C1009, 0x4C9D1009, 0x4C9E1009, 0x4C9F1009,
+        },
+        {
+            0x4CA01009, 0x4CA11009, 0x4CA21009, 0x4CA31009, 0x4CA41009, 0x4CA51009,
+            0x4CA61009, 0x4CA71009, 0x4CA81009, 0x4CA91009, 0x4CAA1009, 0x4CAB1009,
+            0x4CAC1009, 0x4CAD1009, 0x4CAE1009, 0x4CAF1009,
+        },
+        {
+            0x4CB01009, 0x4CB11009, 0x4CB21009, 0x4CB31009, 0x4CB41009, 0x4CB51009,
+            0x4CB61009, 0x4CB71009, 0x4CB81009, 0x4CB91009, 0x4CBA1009, 0x4CBB1009,
+            0x4CBC1009, 0x4CBD1009, 0x4CBE1009, 0x4CBF1009,
+        },
+        {
+            0x4CC01009, 0x4CC11009, 0x4CC21009, 0x4CC31009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x045E1009,
+        },
+        {
+            0x4DCF1009, 0x4DD01009, 0x4DD11009, 0x4DD21009, 0x4DD31009, 0x4DD41009,
+            0x4DD51009, 0x4DD61009, 0x4DD71009, 0x4DD81009, 0x4DD91009, 0x4DDA1009,
+            0x4DDB1009, 0x4DDC1009, 0x4DDD1009, 0x4DDE1009,
+        },
+        {
+            0x4DDF1009, 0x4DE01009, 0x4DE11009, 0x4DE21009, 0x4DE31009, 0x4DE41009,
+            0x4DE51009, 0x4DE61009, 0x4DE71009, 0x4DE81009, 0x4DE91009, 0x4DEA1009,
+            0x4DEB1009, 0x4DEC1009, 0x4DED1009, 0x4DEE1009,
+        },
+        {
+            0x4DEF1009, 0x4DF01009, 0x4DF11009, 0x4DF21009, 0x4DF31009, 0x4DF41009,
+            0x4DF51009, 0x4DF61009, 0x4DF71009, 0x4DF81009, 0x4DF91009, 0x4DFA1009,
+            0x4DFB1009, 0x4DFC1009, 0x4DFD1009, 0x4DFE1009,
+        },
+        {
+            0x4DFF1009, 0x4E001009, 0x4E011009, 0x4E021009, 0x4E031009, 0x4E041009,
+            0x4E051009, 0x4E061009, 0x4E071009, 0x4E081009, 0x4E091009, 0x4E0A1009,
+            0x4E0B1009, 0x4E0C1009, 0x4E0D1009, 0x4E0E1009,
+        },
+        {
+            0x4E0F1009, 0x4E101009, 0x4E111009, 0x4E121009, 0x4E131009, 0x4E141009,
+            0x4E151009, 0x4E161009, 0x4E171009, 0x4E181009, 0x4E191009, 0x4E1A1009,
+            0x4E1B1009, 0x4E1C1009, 0x4E1D1009, 0x4E1E1009,
+        },
+        {
+            0x4E1F1009, 0x4E201009, 0x4E211009, 0x4E221009, 0x4E231009, 0x4E241009,
+            0x4E251009, 0x4E261009, 0x4E271009, 0x4E281009, 0x4E291009, 0x4E2A1009,
+            0x4E2B1009, 0x4E2C1009, 0x4E2D1009, 0x4E2E1009,
+        },
+        {
+            0x4E2F1009, 0x4E301009, 0x4E311009, 0x4E321009, 0x4E331009, 0x4E341009,
+            0x4E351009, 0x4E361009, 0x4E371009, 0x4E381009, 0x4E391009, 0x4E3A1009,
+            0x4E3B1009, 0x4E3C1009, 0x4E3D1009, 0x4E3E1009,
+        },
+        {
+            0x4E3F1009, 0x4E401009, 0x4E411009, 0x4E421009, 0x4E431009, 0x4E441009,
+            0x4E451009, 0x4E461009, 0x4E471009, 0x4E481009, 0x4E491009, 0x4E4A1009,
+            0x4E4B1009, 0x4E4C1009, 0x4E4D1009, 0x4E4E1009,
+        },
+        {
+            0x4E4F1009, 0x4E501009, 0x4E511009, 0x4E521009, 0x4E531009, 0x4E541009,
+            0x4E551009, 0x4E561009, 0x4E571009, 0x4E581009, 0x4E591009, 0x4E5A1009,
+            0x4E5B1009, 0x4E5C1009, 0x4E5D1009, 0x4E5E1009,
+        },
+        {
+            0x4E5F1009, 0x4E601009, 0x4E611009, 0x4E621009, 0x4E631009, 0x4E641009,
+            0x4E651009, 0x4E661009, 0x4E671009, 0x4E681009, 0x4E691009, 0x4E6A1009,
+            0x4E6B1009, 0x4E6C1009, 0x4E6D1009, 0x4E6E1009,
+        },
+        {
+            0x4E6F1009, 0x4E701009, 0x4E711009, 0x4E721009, 0x4E731009, 0x4E741009,
+            0x4E751009, 0x4E761009, 0x4E771009, 0x4E781009, 0x4E791009, 0x4E7A1009,
+            0x4E7B1009, 0x4E7C1009, 0x4E7D1009, 0x4E7E1009,
+        },
+        {
+            0x4E7F1009, 0x4E801009, 0x4E811009, 0x4E821009, 0x4E831009, 0x4E841009,
+            0x4E851009, 0x4E861009, 0x4E871009, 0x4E881009, 0x4E891009, 0x4E8A1009,
+            0x4E8B1009, 0x4E8C1009, 0x4E8D1009, 0x4E8E1009,
+        },
+        {
+            0x4E8F1009, 0x4E901009, 0x4E911009, 0x4E921009, 0x4E931009, 0x4E941009,
+            0x4E951009, 0x4E961009, 0x4E971009, 0x4E981009, 0x4E991009, 0x4E9A1009,
+            0x4E9B1009, 0x4E9C1009, 0x4E9D1009, 0x4E9E1009,
+        },
+        {
+            0x4E9F1009, 0x4EA01009, 0x4EA11009, 0x4EA21009, 0x4EA31009, 0x4EA41009,
+            0x4EA51009, 0x4EA61009, 0x4EA71009, 0x4EA81009, 0x4EA91009, 0x4EAA1009,
+            0x4EAB1009, 0x4EAC1009, 0x4EAD1009, 0x4EAE1009,
+        },
+        {
+            0x4EAF1009, 0x4EB01009, 0x4EB11009, 0x4EB21009, 0x4EB31009, 0x4EB41009,
+            0x4EB51009, 0x4EB61009, 0x4EB71009, 0x4EB81009, 0x4EB91009, 0x4EBA1009,
+            0x4EBB1009, 0x4EBC1009, 0x4EBD1009, 0x4EBE1009,
+        },
+        {
+            0x4EBF1009, 0x4EC01009, 0x4EC11009, 0x4EC21009, 0x4EC31009, 0x4EC41009,
+            0x4EC51009, 0x4EC61009, 0x4EC71009, 0x4EC81009, 0x4EC91009, 0x4ECA1009,
+            0x4ECB1009, 0x4ECC1009, 0x4ECD1009, 0x4ECE1009,
+        },
+        {
+            0x4ECF1009, 0x4ED01009, 0x4ED11009, 0x4ED21009, 0x4ED31009, 0x4ED41009,
+            0x4ED51009, 0x4ED61009, 0x4ED71009, 0x4ED81009, 0x4ED91009, 0x4EDA1009,
+            0x4EDB1009, 0x4EDC1009, 0x4EDD1009, 0x4EDE1009,
+        },
+        {
+            0x4EDF1009, 0x4EE01009, 0x4EE11009, 0x4EE21009, 0x4EE31009, 0x4EE41009,
+            0x4EE51009, 0x4EE61009, 0x4EE71009, 0x4EE81009, 0x4EE91009, 0x4EEA1009,
+            0x4EEB1009, 0x4EEC1009, 0x4EED1009, 0x4EEE1009,
+        },
+        {
+            0x4EEF1009, 0x4EF01009, 0x4EF11009, 0x4EF21009, 0x4EF31009, 0x4EF41009,
+            0x4EF51009, 0x4EF61009, 0x4EF71009, 0x4EF81009, 0x4EF91009, 0x4EFA1009,
+            0x4EFB1009, 0x4EFC1009, 0x4EFD1009, 0x4EFE1009,
+        },
+        {
+            0x4EFF1009, 0x4F001009, 0x4F011009, 0x4F021009, 0x4F031009, 0x4F041009,
+            0x4F051009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4F061009, 0x4F071009, 0x4F081009, 0x4F091009, 0x4F0A1009, 0x4F0B1009,
+            0x4F0C1009, 0x4F0D1009, 0x4F0E1009, 0x4F0F1009, 0x4F101009, 0x4F111009,
+            0x4F121009, 0x4F131009, 0x4F141009, 0x4F151009,
+        },
+        {
+            0x4F161009, 0x4F171009, 0x4F181009, 0x4F191009, 0x4F1A1009, 0x4F1B1009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4F1C1009, 0x4F1D1009, 0x4F1E1009, 0x4F1F1009, 0x4F201009, 0x4F211009,
+            0x4F221009, 0x4F231009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4F241009, 0x4F251009, 0x4F261009, 0x4F271009, 0x4F281009, 0x4F291009,
+            0x00000000, 0x00000000, 0x4F2A1009, 0x00000000, 0x4F2B1009, 0x4F2C1009,
+            0x4F2D1009, 0x4F2E1009, 0x4F2F1009, 0x4F301009,
+        },
+        {
+            0x4F311009, 0x4F321009, 0x4F331009, 0x4F341009, 0x4F351009, 0x4F361009,
+            0x4F371009, 0x4F381009, 0x4F391009, 0x4F3A1009, 0x4F3B1009, 0x4F3C1009,
+            0x4F3D1009, 0x4F3E1009, 0x4F3F1009, 0x4F401009,
+        },
+        {
+            0x4F411009, 0x4F421009, 0x4F431009, 0x4F441009, 0x4F451009, 0x4F461009,
+            0x4F471009, 0x4F481009, 0x4F491009, 0x4F4A1009, 0x4F4B1009, 0x4F4C1009,
+            0x4F4D1009, 0x4F4E1009, 0x4F4F1009, 0x4F501009,
+        },
+        {
+            0x4F511009, 0x4F521009, 0x4F531009, 0x4F541009, 0x4F551009, 0x4F561009,
+            0x00000000, 0x4F571009, 0x4F581009, 0x00000000, 0x00000000, 0x00000000,
+            0x4F591009, 0x00000000, 0x00000000, 0x4F5A1009,
+        },
+        {
+            0x500B1009, 0x500C1009, 0x500D1009, 0x500E1009, 0x500F1009, 0x50101009,
+            0x50111009, 0x50121009, 0x50131009, 0x50141009, 0x50151009, 0x50161009,
+            0x50171009, 0x50181009, 0x50191009, 0x501A1009,
+        },
+        {
+            0x501B1009, 0x501C1009, 0x501D1009, 0x501E1009, 0x501F1009, 0x50201009,
+            0x00000000, 0x02E21009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1E331009,
+            0x1E341009, 0x1E351009, 0x1E361009, 0x1E371009,
+        },
+        {
+            0x4FCA1009, 0x4FCB1009, 0x4FCC1009, 0x4FCD1009, 0x4FCE1009, 0x4FCF1009,
+            0x4FD01009, 0x4FD11009, 0x4FD21009, 0x4FD31009, 0x4FD41009, 0x4FD51009,
+            0x4FD61009, 0x4FD71065, 0x4FD71009, 0x4FD81009,
+        },
+        {
+            0x4FD91009, 0x4FDA1009, 0x4FDB1009, 0x4FDC1009, 0x4FDD1009, 0x4FDE1009,
+            0x4FDF1009, 0x111C1009, 0x111D1009, 0x1F991009, 0x1F9A1009, 0x1F9B1009,
+            0x1F9C1009, 0x1F9D1009, 0x1E241009, 0x1E251009,
+        },
+        {
+            0x4FE01065, 0x4FE01009, 0x4FE11065, 0x4FE11009, 0x4FE21009, 0x4FE31009,
+            0x4FE41065, 0x4FE41009, 0x4FE51009, 0x4FE61009, 0x4FE71009, 0x4FE81009,
+            0x4FE91065, 0x4FE91009, 0x4FEA1065, 0x4FEA1009,
+        },
+        {
+            0x4FEB1065, 0x4FEB1009, 0x4FEC1065, 0x4FEC1009, 0x4FED1065, 0x4FED1009,
+            0x4FEE1009, 0x4FEF1009, 0x4FF01009, 0x4FF11009, 0x4FF21009, 0x4FF31009,
+            0x4FF41065, 0x4FF41009, 0x4FF51009, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9C1009,
+            0x1F9D1009, 0x1E261009, 0x1E271009, 0x1E281009,
+        },
+        {
+            0x4FF61009, 0x4FF71009, 0x4FF81009, 0x4FF91009, 0x4FFA1009, 0x4FFB1009,
+            0x4FFC1009, 0x4FFD1009, 0x4FFE1009, 0x4FFF1009, 0x50001009, 0x50011009,
+            0x50021009, 0x50031009, 0x50041009, 0x50051009,
+        },
+        {
+            0x50061009, 0x50071009, 0x50081009, 0x00000000, 0x50091009, 0x500A1009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1F991009,
+            0x1F9D1009, 0x1E291009, 0x1E2A1009, 0x1E2B1009,
+        },
+        {
+            0x26341009, 0x26351009, 0x26361009, 0x26371009, 0x26381009, 0x26391009,
+            0x263A1009, 0x263B1009, 0x263C1009, 0x263D1009, 0x263E1009, 0x263F1009,
+            0x26401009, 0x26411009, 0x26421009, 0x26431009,
+        },
+        {
+            0x26441009, 0x26451009, 0x26461009, 0x26471009, 0x26481009, 0x26491009,
+            0x1F991009, 0x1E301009, 0x1E311009, 0x1E321009, 0x1F9A1009, 0x1F9B1009,
+            0x00000000, 0x00000000, 0x00000000, 0x03101009,
+        },
+        {
+            0x4B0F1009, 0x4B101009, 0x4B111009, 0x4B121009, 0x4B131009, 0x4B141009,
+            0x4B151009, 0x4B161009, 0x4B171009, 0x4B181009, 0x4B191009, 0x4B1A1009,
+            0x4B1B1009, 0x4B1C1009, 0x4B1D1009, 0x4B1E1009,
+        },
+        {
+            0x4B1F1009, 0x4B201009, 0x4B211009, 0x4B221009, 0x4B231009, 0x4B241009,
+            0x4B251009, 0x4B261009, 0x4B271009, 0x4B281009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x030A1009,
+        },
+        {
+            0x0040E40A, 0x0040EC0A, 0x0040F40A, 0x0040FC0A, 0x0041040A, 0x00410C0A,
+            0x0041140A, 0x00411C0A, 0x0041240A, 0x00412C0A, 0x0041340A, 0x00413C0A,
+            0x0041440A, 0x00414C0A, 0x0041540A, 0x00415C0A,
+        },
+        {
+            0x0041640A, 0x00416C0A, 0x0041740A, 0x00417C0A, 0x0041840A, 0x00418C0A,
+            0x0041940A, 0x00419C0A, 0x0041A40A, 0x0041AC0A, 0x0041B40A, 0x0041BC0A,
+            0x0041C40A, 0x0041CC0A, 0x59EF1009, 0x59F01009,
+        },
+        {
+            0x59D61009, 0x59D71009, 0x59D81009, 0x59D91009, 0x59DA1009, 0x59DB1009,
+            0x59DC1009, 0x59DD1009, 0x59DE1009, 0x59DF1009, 0x59E01009, 0x59E11009,
+            0x59E21009, 0x59E31009, 0x59E41009, 0x59E51009,
+        },
+        {
+            0x0041D40A, 0x59E61009, 0x59E71009, 0x59E81009, 0x59E91009, 0x59EA1009,
+            0x59EB1009, 0x59EC1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x1F2B1009, 0x1F201009, 0x59ED1009, 0x59EE1009,
+        },
+        {
+            0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009, 0x1F9E1009,
+            0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1EF51009, 0x1EF61009, 0x1EF71009,
+            0x1EF81009, 0x1EF91009, 0x1EFA1009, 0x1EFB1009,
+        },
+        {
+            0x00000000, 0x00000000, 0x1EFC1009, 0x1EFD1009, 0x1EFE1009, 0x1EFF1009,
+            0x1F001009, 0x1F011009, 0x1F021009, 0x1F031009, 0x1F041009, 0x1F051009,
+            0x1F061009, 0x1F071009, 0x1F081009, 0x1F091009,
+        },
+        {
+            0x1F0A1009, 0x1F0B1009, 0x1F0C1009, 0x1F0D1009, 0x1F0E1009, 0x1F0F1009,
+            0x1F101009, 0x1F111009, 0x1F121009, 0x1F131009, 0x1F141009, 0x1F151009,
+            0x1F161009, 0x1F171009, 0x1F181009, 0x1F191009,
+        },
+        {
+            0x1F1A1009, 0x1F1B1009, 0x1F1C1009, 0x1F1D1009, 0x1F1E1009, 0x1F1F1009,
+            0x1F211009, 0x1F221009, 0x1F231009, 0x1F241009, 0x1F251009, 0x1F261009,
+            0x1F271009, 0x1F281009, 0x1F291009, 0x1F2A1009,
+        },
+        {
+            0x31AF1009, 0x31B01009, 0x31B11009, 0x31B21009, 0x00000000, 0x31B31009,
+            0x31B41009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x31B51009, 0x00001A09, 0x00006209, 0x00006289,
+        },
+        {
+            0x31B61009, 0x31B81009, 0x31B91009, 0x31BA1009, 0x00000000, 0x31BB1009,
+            0x31BC1009, 0x31BD1009, 0x00000000, 0x31BE1009, 0x31BF1009, 0x31C11009,
+            0x31C31009, 0x31C41009, 0x31C51009, 0x31C61009,
+        },
+        {
+            0x31C71009, 0x31C81009, 0x31C91009, 0x31CA1009, 0x31CB1009, 0x31CC1009,
+            0x31CD1009, 0x31CE1009, 0x31CF1009, 0x31D01009, 0x31D11009, 0x31D21009,
+            0x31D31009, 0x31D51009, 0x31D61009, 0x31D71009,
+        },
+        {
+            0x31D81009, 0x31D91009, 0x31B71009, 0x31C21009, 0x31C01009, 0x31D41009,
+            0x00000000, 0x00000000, 0x00006689, 0x00006709, 0x00006789, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x31DA1009,
+        },
+        {
+            0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1E5E1009, 0x1E5F1009,
+            0x1E601009, 0x1E611009, 0x1E621009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x04641009, 0x04651009, 0x04661009, 0x04671009, 0x04681009, 0x04691009,
+            0x02B21009, 0x02B31009, 0x046A1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4F5B1009, 0x4F5C1009, 0x4F5D1009, 0x4F5E1009, 0x4F5F1009, 0x4F601009,
+            0x4F611009, 0x4F621009, 0x4F631009, 0x4F641009, 0x4F651009, 0x4F661009,
+            0x4F671009, 0x4F681009, 0x4F691009, 0x4F6A1009,
+        },
+        {
+            0x4F6B1009, 0x4F6C1009, 0x4F6D1009, 0x4F6E1009, 0x4F6F1009, 0x4F701009,
+            0x4F711009, 0x4F721009, 0x4F731009, 0x4F741009, 0x4F751009, 0x4F761009,
+            0x4F771009, 0x1F991009, 0x1E2C1009, 0x1E2D1009,
+        },
+        {
+            0x4F781009, 0x4F791009, 0x4F7A1009, 0x4F7B1009, 0x4F7C1009, 0x4F7D1009,
+            0x4F7E1009, 0x4F7F1009, 0x4F801009, 0x4F811009, 0x4F821009, 0x4F831009,
+            0x4F841009, 0x4F851009, 0x4F861009, 0x4F871009,
+        },
+        {
+            0x4F881009, 0x4F891009, 0x4F8A1009, 0x4F8B1009, 0x4F8C1009, 0x4F8D1009,
+            0x4F8E1009, 0x4F8F1009, 0x4F901009, 0x4F911009, 0x4F921009, 0x4F931009,
+            0x4F941009, 0x1F991009, 0x1E2E1009, 0x1E2F1009,
+        },
+        {
+            0x50721009, 0x50731009, 0x50741009, 0x50751009, 0x50761009, 0x50771009,
+            0x50781009, 0x50791009, 0x0041DC0A, 0x507A1009, 0x507B1009, 0x507C1009,
+            0x507D1009, 0x507E1009, 0x507F1009, 0x50801009,
+        },
+        {
+            0x50811009, 0x50821009, 0x50831009, 0x50841009, 0x50851009, 0x50861009,
+            0x50871009, 0x50881009, 0x50891009, 0x508A1009, 0x508B1009, 0x508C1009,
+            0x508D1009, 0x508E1009, 0x508F1009, 0x50901009,
+        },
+        {
+            0x50911009, 0x50921009, 0x50931009, 0x50941009, 0x50951009, 0x00001989,
+            0x00001A09, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1F991009,
+            0x1F9D1009, 0x1E381009, 0x1E391009, 0x1E3A1009,
+        },
+        {
+            0x046F1009, 0x04701009, 0x04711009, 0x04721009, 0x04731009, 0x04741009,
+            0x04751009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4F951009, 0x4F961009, 0x4F971009, 0x4F981009, 0x4F991009, 0x4F9A1009,
+            0x4F9B1009, 0x4F9C1009, 0x4F9D1009, 0x4F9E1009, 0x4F9F1009, 0x4FA01009,
+            0x4FA11009, 0x4FA21009, 0x4FA31009, 0x4FA41009,
+        },
+        {
+            0x4FA51009, 0x4FA61009, 0x4FA71009, 0x4FA81009, 0x4FA91009, 0x4FAA1009,
+            0x4FAB1009, 0x4FAC1009, 0x4FAD1009, 0x4FAE1009, 0x4FAF1009, 0x4FB01009,
+            0x4FB11009, 0x4FB21009, 0x4FB31009, 0x4FB41009,
+        },
+        {
+            0x4FB51009, 0x4FB61009, 0x4FB71009, 0x4FB81009, 0x4FB91009, 0x4FBA1009,
+            0x4FBB1009, 0x4FBC1009, 0x4FBD1009, 0x4FBE1009, 0x4FBF1009, 0x4FC01009,
+            0x4FC11009, 0x4FC21009, 0x0041E40A, 0x4FC31009,
+        },
+        {
+            0x4FC41009, 0x4FC51009, 0x4FC61009, 0x4FC71009, 0x4FC81009, 0x4FC91009,
+            0x00000000, 0x00000000, 0x00000000, 0x046E1009, 0x02E31009, 0x02E41009,
+            0x02E51009, 0x02E61009, 0x02E71009, 0x02E81009,
+        },
+        {
+            0x50211009, 0x50221009, 0x50231009, 0x50241009, 0x50251009, 0x50261009,
+            0x50271009, 0x50281009, 0x50291009, 0x502A1009, 0x502B1009, 0x502C1009,
+            0x502D1009, 0x502E1009, 0x502F1009, 0x50301009,
+        },
+        {
+            0x50311009, 0x50321009, 0x50331009, 0x50341009, 0x50351009, 0x50361009,
+            0x00000000, 0x00000000, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009,
+            0x1E3B1009, 0x1E3C1009, 0x1E3D1009, 0x1E3E1009,
+        },
+        {
+            0x50371009, 0x50381009, 0x50391009, 0x503A1009, 0x503B1009, 0x503C1009,
+            0x503D1009, 0x503E1009, 0x503F1009, 0x50401009, 0x50411009, 0x50421009,
+            0x50431009, 0x50441009, 0x50451009, 0x50461009,
+        },
+        {
+            0x50471009, 0x50481009, 0x50491009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009,
+            0x1E3F1009, 0x1E401009, 0x1E411009, 0x1E421009,
+        },
+        {
+            0x504A1009, 0x504B1009, 0x504C1009, 0x504D1009, 0x504E1009, 0x504F1009,
+            0x50501009, 0x50511009, 0x50521009, 0x50531009, 0x50541009, 0x50551009,
+            0x50561009, 0x50571009, 0x50581009, 0x50591009,
+        },
+        {
+            0x505A1009, 0x505B1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x04761009, 0x04771009, 0x04781009,
+            0x04791009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x1F991009, 0x1F9A1009, 0x1F9B1009,
+            0x1F9C1009, 0x1E431009, 0x1E441009, 0x1E451009,
+        },
+        {
+            0x3C8C1009, 0x0041EC0A, 0x3C8D1009, 0x3C8E1009, 0x0041F40A, 0x3C8F1009,
+            0x3C901009, 0x3C911009, 0x0041FC0A, 0x3C921009, 0x0042040A, 0x3C931009,
+            0x00420C0A, 0x3C941009, 0x0042140A, 0x3C951009,
+        },
+        {
+            0x00421C0A, 0x3C961009, 0x0042240A, 0x3C971009, 0x3C981009, 0x00422C0A,
+            0x3C991009, 0x0042340A, 0x3C9A1009, 0x00423C0A, 0x3C9B1009, 0x0042440A,
+            0x3C9C1009, 0x00424C0A, 0x3C9D1009, 0x0042540A,
+        },
+        {
+            0x3C9E1009, 0x3C9F1009, 0x3CA01009, 0x3CA11009, 0x3CA21009, 0x00425C0A,
+            0x3CA31009, 0x0042640A, 0x3CA41009, 0x00426C0A, 0x3CA51009, 0x0042740A,
+            0x3CA61009, 0x3CA71009, 0x00427C0A, 0x3CA81009,
+        },
+        {
+            0x3CA91009, 0x3CAA1009, 0x3CAB1009, 0x0042840A, 0x3CAC1009, 0x00428C0A,
+            0x3CAD1009, 0x0042940A, 0x3CAE1009, 0x00429C0A, 0x3CAF1009, 0x0042A40A,
+            0x3CB01009, 0x3CB11009, 0x3CB21009, 0x3CB31009,
+        },
+        {
+            0x0042AC0A, 0x3CB41009, 0x0042B40A, 0x3CB51009, 0x0042BC0A, 0x3CB61009,
+            0x0042C40A, 0x3CB71009, 0x3CB81009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x3C631021, 0x0042CC0A, 0x3C641021, 0x3C651021, 0x3C661021, 0x3C671021,
+            0x3C681021, 0x3C691021, 0x3C6A1021, 0x3C6B1021, 0x0042D40A, 0x0042DC0A,
+            0x3C6C1021, 0x3C6D1021, 0x3C6E1021, 0x3C6F1021,
+        },
+        {
+            0x3C701021, 0x0042E40A, 0x3C711021, 0x3C721021, 0x3C731021, 0x3C741021,
+            0x3C751021, 0x3C761021, 0x3C771021, 0x3C781021, 0x3C791021, 0x3C7A1021,
+            0x0042EC0A, 0x3C7B1021, 0x0042F40A, 0x0042FC0A,
+        },
+        {
+            0x3C7C1021, 0x3C7D1021, 0x3C7E1021, 0x0043040A, 0x3C7F1021, 0x3C801021,
+            0x3C811021, 0x3C821021, 0x3C831021, 0x3C841021, 0x3C851021, 0x00430C0A,
+            0x3C861021, 0x0043140A, 0x3C871021, 0x3C881021,
+        },
+        {
+            0x3C891021, 0x3C8A1021, 0x3C8B1021, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x3C631009, 0x00431C0A, 0x3C641009, 0x3C651009, 0x3C661009, 0x3C671009,
+            0x3C681009, 0x3C691009, 0x3C6A1009, 0x3C6B1009, 0x0043240A, 0x00432C0A,
+            0x3C6C1009, 0x3C6D1009, 0x3C6E1009, 0x3C6F1009,
+        },
+        {
+            0x3C701009, 0x0043340A, 0x3C711009, 0x3C721009, 0x3C731009, 0x3C741009,
+            0x3C751009, 0x3C761009, 0x3C771009, 0x3C781009, 0x3C791009, 0x3C7A1009,
+            0x00433C0A, 0x3C7B1009, 0x0043440A, 0x00434C0A,
+        },
+        {
+            0x3C7C1009, 0x3C7D1009, 0x3C7E1009, 0x0043540A, 0x3C7F1009, 0x3C801009,
+            0x3C811009, 0x3C821009, 0x3C831009, 0x3C841009, 0x3C851009, 0x00435C0A,
+            0x3C861009, 0x0043640A, 0x3C871009, 0x3C881009,
+        },
+        {
+            0x3C891009, 0x3C8A1009, 0x3C8B1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1F991009, 0x1F9D1009,
+            0x1DBA1009, 0x1DBB1009, 0x1DBC1009, 0x1DBD1009,
+        },
+        {
+            0x361B1009, 0x36211009, 0x36221009, 0x36231009, 0x36241009, 0x36251009,
+            0x36261009, 0x36271009, 0x36281009, 0x36291009, 0x362A1009, 0x362B1009,
+            0x362C1009, 0x362D1009, 0x362E1009, 0x362F1009,
+        },
+        {
+            0x36301009, 0x36311009, 0x36321009, 0x36331009, 0x36341009, 0x36351009,
+            0x36361009, 0x36371009, 0x36381009, 0x36391009, 0x363A1009, 0x363B1009,
+            0x363C1009, 0x361C1009, 0x361D1009, 0x361E1009,
+        },
+        {
+            0x361F1009, 0x36201009, 0x363D1009, 0x363E1009, 0x00001989, 0x00001989,
+            0x00001989, 0x00001989, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009, 0x1F9E1009,
+            0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1DA11009, 0x1DA21009, 0x1DA31009,
+            0x1DA41009, 0x1DA51009, 0x1DA61009, 0x1DA71009,
+        },
+        {
+            0x1DA81009, 0x1DA91009, 0x1DAA1009, 0x1DAB1009, 0x1DAC1009, 0x1DAD1009,
+            0x1DAE1009, 0x1DAF1009, 0x1DB01009, 0x1DB11009, 0x1DB21009, 0x1DB31009,
+            0x1DB41009, 0x1DB51009, 0x1DB61009, 0x00000000,
+        },
+        {
+            0x50BE1009, 0x50BF1009, 0x50C01009, 0x50C11009, 0x50C21009, 0x50C31009,
+            0x50C41009, 0x50C51009, 0x50C61009, 0x50C71009, 0x50C81009, 0x50C91009,
+            0x50CA1009, 0x50CB1009, 0x50CC1009, 0x50CD1009,
+        },
+        {
+            0x50CE1009, 0x50CF1009, 0x50D01009, 0x50D11009, 0x50D21009, 0x50D31009,
+            0x50D41009, 0x50D51009, 0x50D61009, 0x50D71009, 0x50D81009, 0x50D91009,
+            0x50DA1009, 0x50DB1009, 0x50DC1009, 0x50DD1009,
+        },
+        {
+            0x50DE1009, 0x50E01009, 0x50E11009, 0x50E21009, 0x50E31009, 0x50E41009,
+            0x50E51009, 0x50E61009, 0x50E71009, 0x50E91009, 0x00000000, 0x00004189,
+            0x00004109, 0x02221009, 0x00000000, 0x00000000,
+        },
+        {
+            0x50DF1009, 0x50E81009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x50961009, 0x50961065, 0x50971009, 0x50971065, 0x50981009, 0x50991009,
+            0x50991065, 0x509A1009, 0x509B1009, 0x509C1009, 0x509D1009, 0x509E1009,
+            0x509F1009, 0x50A01009, 0x50A11009, 0x50A11065,
+        },
+        {
+            0x00436C0A, 0x50A21009, 0x50A31009, 0x0043740A, 0x50A41009, 0x50A51009,
+            0x50A51065, 0x00437C0A, 0x50A61009, 0x50A71009, 0x50A81009, 0x50A81065,
+            0x0043840A, 0x1F991009, 0x1F9A1009, 0x1F9B1009,
+        },
+        {
+            0x1F9C1009, 0x1F9D1009, 0x1E461009, 0x1E471009, 0x1E481009, 0x1E491009,
+            0x1E4A1009, 0x00438C0A, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x50A91009, 0x50AA1009, 0x50AB1009, 0x50AC1009, 0x50AD1009, 0x50AE1009,
+            0x50AF1009, 0x50B01009, 0x50B11009, 0x50B21009, 0x50B31009, 0x50B41009,
+            0x50B51009, 0x50B61009, 0x50B71009, 0x50B81009,
+        },
+        {
+            0x50B91009, 0x50BA1009, 0x50BB1009, 0x50BC1009, 0x50BD1009, 0x0043940A,
+            0x00001A09, 0x00001A09, 0x00001989, 0x00001989, 0x00001989, 0x00001A09,
+            0x00001989, 0x00001A09, 0x00001A09, 0x00001A09,
+        },
+        {
+            0x00001A09, 0x1F991009, 0x1E4B1009, 0x1E4C1009, 0x1E4D1009, 0x02E91009,
+            0x02EA1009, 0x02EB1009, 0x02EC1009, 0x02ED1009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x50EA1009, 0x50EB1009, 0x50EC1009, 0x50ED1009, 0x50EE1009, 0x50EF1009,
+            0x50F01009, 0x50F11009, 0x50F21009, 0x50F31009, 0x50F41009, 0x50F51009,
+            0x50F61009, 0x50F71009, 0x50F81009, 0x50F91009,
+        },
+        {
+            0x50FA1009, 0x50FB1009, 0x50FC1009, 0x50FD1009, 0x50FE1009, 0x1F991009,
+            0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1E4E1009, 0x1E4F1009, 0x1E501009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x505C1009, 0x505D1009, 0x505E1009, 0x505F1009, 0x50601009, 0x50611009,
+            0x50621009, 0x50631009, 0x50641009, 0x50651009, 0x50661009, 0x50671009,
+            0x50681009, 0x50691009, 0x506A1009, 0x506B1009,
+        },
+        {
+            0x506C1009, 0x506D1009, 0x506E1009, 0x506F1009, 0x50701009, 0x50711009,
+            0x00439C0A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00006189, 0x00006209, 0x00006289, 0x31991009, 0x319A1009, 0x316A1009,
+            0x316B1009, 0x316C1009, 0x316D1009, 0x316E1009, 0x316F1009, 0x31701009,
+            0x31711009, 0x31721009, 0x31731009, 0x31741009,
+        },
+        {
+            0x31751009, 0x31761009, 0x31771009, 0x31781009, 0x31791009, 0x317A1009,
+            0x317B1009, 0x317C1009, 0x317D1009, 0x317E1009, 0x317F1009, 0x31801009,
+            0x31811009, 0x31821009, 0x31831009, 0x31841009,
+        },
+        {
+            0x31851009, 0x31861009, 0x31871009, 0x31881009, 0x31891009, 0x318A1009,
+            0x318B1009, 0x318C1009, 0x318D1009, 0x318E1009, 0x318F1009, 0x31901009,
+            0x31911009, 0x31921009, 0x31931009, 0x31941009,
+        },
+        {
+            0x31951009, 0x31961009, 0x31971009, 0x31981009, 0x319B1009, 0x319C1009,
+            0x319D1009, 0x319E1009, 0x319F1009, 0x31A01009, 0x31A11009, 0x31A21009,
+            0x31A31009, 0x31A41009, 0x31A51009, 0x31A61009,
+        },
+        {
+            0x31A71009, 0x31A81009, 0x31A91009, 0x31AA1009, 0x31AB1009, 0x31AC1009,
+            0x31AD1009, 0x02B41009, 0x02B51009, 0x045F1009, 0x04601009, 0x04611009,
+            0x04621009, 0x04631009, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009,
+            0x1F9D1009, 0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1E531009,
+            0x1E541009, 0x1E551009, 0x1E561009, 0x1E571009,
+        },
+        {
+            0x1E581009, 0x1E591009, 0x1E5A1009, 0x1E5B1009, 0x1E5C1009, 0x1E5D1009,
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x31AE1009,
+        },
+        {
+            0x00006189, 0x00006209, 0x00006289, 0x2D471009, 0x2D481009, 0x2D491009,
+            0x2D4A1009, 0x2D4B1009, 0x2D4C1009, 0x2D4D1009, 0x2D4E1009, 0x2D4F1009,
+            0x2D501009, 0x2D511009, 0x2D521009, 0x2D531009,
+        },
+        {
+            0x2D541009, 0x2D551009, 0x2D561009, 0x2D571009, 0x2D581009, 0x2D591009,
+            0x2D5A1009, 0x2D5B1009, 0x2D5C1009, 0x2D5D1009, 0x00000000, 0x2D5E1009,
+            0x00000000, 0x2D5F1009, 0x2D601009, 0x2D611009,
+        },
+        {
+            0x2D621009, 0x2D631009, 0x2D641009, 0x2D651009, 0x2D661009, 0x2D671009,
+            0x2D681009, 0x2D691009, 0x2D6A1009, 0x2D6B1009, 0x2D6C1009, 0x00000000,
+            0x2D6D1009, 0x2D6E1009, 0x2D6F1009, 0x2D701009,
+        },
+        {
+            0x2D711009, 0x2D721009, 0x2D731009, 0x2D741009, 0x2D751009, 0x2D761009,
+            0x2D771009, 0x2D781009, 0x2D791009, 0x2D7A1009, 0x00006109, 0x047A1009,
+            0x047B1009, 0x00000001, 0x02EE1009, 0x02EF1009,
+        },
+        {
+            0x02B61009, 0x02B71009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000001, 0x00000000, 0x00000000,
+        },
+        {
+            0x4CC41009, 0x4CC51009, 0x4CC61009, 0x4CC71009, 0x4CC81009, 0x4CC91009,
+            0x4CCA1009, 0x4CCB1009, 0x4CCC1009, 0x4CCD1009, 0x4CCE1009, 0x4CCF1009,
+            0x4CD01009, 0x4CD11009, 0x4CD21009, 0x4CD31009,
+        },
+        {
+            0x4CD41009, 0x4CD51009, 0x4CD61009, 0x4CD71009, 0x4CD81009, 0x4CD91009,
+            0x4CDA1009, 0x4CDB1009, 0x4CDC1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00006189, 0x00006209, 0x00006289, 0x363F1009, 0x36401009, 0x36411009,
+            0x36421009, 0x36431009, 0x36441009, 0x36451009, 0x36461009, 0x36471009,
+            0x36481009, 0x36491009, 0x364A1009, 0x364B1009,
+        },
+        {
+            0x364C1009, 0x364D1009, 0x364E1009, 0x364F1009, 0x36501009, 0x36511009,
+            0x36521009, 0x36531009, 0x36541009, 0x36551009, 0x36561009, 0x36571009,
+            0x36581009, 0x36591009, 0x365A1009, 0x365B1009,
+        },
+        {
+            0x365C1009, 0x365D1009, 0x365E1009, 0x365F1009, 0x36611009, 0x36621009,
+            0x36631009, 0x36651009, 0x36661009, 0x36671009, 0x36681009, 0x36691009,
+            0x366A1009, 0x366B1009, 0x00000000, 0x00000000,
+        },
+        {
+            0x366E1009, 0x000000DB, 0x000000DF, 0x36731009, 0x36741009, 0x00000000,
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x02F01009, 0x02B81009, 0x02B91009, 0x027A1009, 0x36641009, 0x36711009,
+            0x36721009, 0x36601009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x2D7B1009, 0x2D7C1009, 0x2D7D1009, 0x2D7E1009, 0x2D7F1009, 0x2D801009,
+            0x2D811009, 0x2D821009, 0x2D831009, 0x2D841009, 0x2D851009, 0x2D861009,
+            0x2D871009, 0x2D881009, 0x2D891009, 0x2D8A1009,
+        },
+        {
+            0x2D8B1009, 0x2D8C1009, 0x2D8D1009, 0x2D8E1009, 0x2D8F1009, 0x2D901009,
+            0x2D911009, 0x2D921009, 0x2D931009, 0x2D941009, 0x2D951009, 0x2D961009,
+            0x2D971009, 0x2D981009, 0x2D991009, 0x2D9A1009,
+        },
+        {
+            0x2D9C1009, 0x2D9D1009, 0x2D9E1009, 0x00006109, 0x047C1009, 0x047D1009,
+            0x2D9B1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00006189, 0x00006209, 0x00006289, 0x2DA11009, 0x2DA21009, 0x2DA31009,
+            0x2DA41009, 0x2DA51009, 0x2DA61009, 0x2DA71009, 0x2DA81009, 0x2DA91009,
+            0x2DAA1009, 0x2DAB1009, 0x2DAC1009, 0x2DAD1009,
+        },
+        {
+            0x2DAE1009, 0x2DAF1009, 0x2DB01009, 0x2DB11009, 0x2DB21009, 0x2DB31009,
+            0x2DB41009, 0x2DB51009, 0x2DB61009, 0x2DB71009, 0x2DB81009, 0x2DB91009,
+            0x2DBA1009, 0x2DBB1009, 0x2DBC1009, 0x2DBD1009,
+        },
+        {
+            0x2DBE1009, 0x2DBF1009, 0x2DC01009, 0x2DC11009, 0x2DC21009, 0x2DC31009,
+            0x2DC41009, 0x2DC51009, 0x2DC61009, 0x2DC71009, 0x2DC81009, 0x2DC91009,
+            0x2DCA1009, 0x2DCB1009, 0x2DCC1009, 0x2DCD1009,
+        },
+        {
+            0x2DCE1009, 0x2DCF1009, 0x2DD01009, 0x2DD51009, 0x2DD61009, 0x2DD71009,
+            0x2DD81009, 0x2DD91009, 0x2DDA1009, 0x2DDB1009, 0x2DDC1009, 0x2DDD1009,
+            0x2DDE1009, 0x2DE01009, 0x2DE11009, 0x2DE21009,
+        },
+        {
+            0x2DE31009, 0x2DD11009, 0x2DD21009, 0x2DD31009, 0x2D9F1009, 0x02BA1009,
+            0x02BB1009, 0x047F1009, 0x02F11009, 0x00006309, 0x00006109, 0x00006809,
+            0x00006889, 0x047E1009, 0x2DDF1009, 0x00006189,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x2DA01009, 0x04801009,
+            0x2DD41009, 0x04811009, 0x02F21009, 0x02F31009,
+        },
+        {
+            0x00000000, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1E6D1009, 0x1E6E1009,
+            0x1E6F1009, 0x1E701009, 0x1E711009, 0x1E721009,
+        },
+        {
+            0x1E731009, 0x1E741009, 0x1E751009, 0x1E761009, 0x1E771009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x2DE41009, 0x2DE51009, 0x2DE61009, 0x2DE71009, 0x2DE81009, 0x2DE91009,
+            0x2DEA1009, 0x2DEB1009, 0x2DEC1009, 0x2DED1009, 0x2DEE1009, 0x2DEF1009,
+            0x2DF01009, 0x2DF11009, 0x2DF21009, 0x2DF31009,
+        },
+        {
+            0x2DF41009, 0x2DF51009, 0x00000000, 0x2DF61009, 0x2DF71009, 0x2DF81009,
+            0x2DF91009, 0x2DFA1009, 0x2DFB1009, 0x2DFC1009, 0x2DFD1009, 0x2DFE1009,
+            0x2DFF1009, 0x2E001009, 0x2E011009, 0x2E021009,
+        },
+        {
+            0x2E031009, 0x2E041009, 0x2E051009, 0x2E061009, 0x2E071009, 0x2E081009,
+            0x2E091009, 0x2E0A1009, 0x2E0B1009, 0x2E0C1009, 0x2E0D1009, 0x2E0E1009,
+            0x2E0F1009, 0x2E101009, 0x2E111009, 0x2E121009,
+        },
+        {
+            0x2E131009, 0x2E141009, 0x2E151009, 0x2E161009, 0x00006209, 0x2E171009,
+            0x00006109, 0x00004009, 0x02BC1009, 0x02BD1009, 0x04821009, 0x04831009,
+            0x04841009, 0x04851009, 0x00004089, 0x00000000,
+        },
+        {
+            0x2E511009, 0x2E521009, 0x2E531009, 0x2E541009, 0x2E571009, 0x2E581009,
+            0x2E591009, 0x00000000, 0x2E5A1009, 0x00000000, 0x2E5B1009, 0x2E5C1009,
+            0x2E5D1009, 0x2E5E1009, 0x00000000, 0x2E5F1009,
+        },
+        {
+            0x2E601009, 0x2E611009, 0x2E621009, 0x2E631009, 0x2E641009, 0x2E651009,
+            0x2E661009, 0x2E671009, 0x2E681009, 0x2E691009, 0x2E6A1009, 0x2E6B1009,
+            0x2E6C1009, 0x2E6D1009, 0x00000000, 0x2E6E1009,
+        },
+        {
+            0x2E6F1009, 0x2E701009, 0x2E711009, 0x2E721009, 0x2E731009, 0x2E551009,
+            0x2E561009, 0x2E741009, 0x2E751009, 0x02F41009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x2E181009, 0x2E191009, 0x2E1A1009, 0x2E1B1009, 0x2E1C1009, 0x2E1D1009,
+            0x2E1E1009, 0x2E1F1009, 0x2E201009, 0x2E211009, 0x2E221009, 0x2E231009,
+            0x2E241009, 0x2E251009, 0x2E261009, 0x2E271009,
+        },
+        {
+            0x2E281009, 0x2E291009, 0x2E2A1009, 0x2E2B1009, 0x2E2C1009, 0x2E2D1009,
+            0x2E2E1009, 0x2E2F1009, 0x2E301009, 0x2E311009, 0x2E321009, 0x2E331009,
+            0x2E341009, 0x2E351009, 0x2E361009, 0x2E371009,
+        },
+        {
+            0x2E381009, 0x2E391009, 0x2E3A1009, 0x2E3B1009, 0x2E3C1009, 0x2E3D1009,
+            0x2E3E1009, 0x2E3F1009, 0x2E401009, 0x2E411009, 0x2E421009, 0x2E431009,
+            0x2E441009, 0x2E451009, 0x2E461009, 0x00006209,
+        },
+        {
+            0x2E471009, 0x2E481009, 0x2E491009, 0x2E4A1009, 0x2E4B1009, 0x2E4C1009,
+            0x2E4D1009, 0x2E4E1009, 0x2E4F1009, 0x00006109, 0x2E501009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00006209, 0x00006189, 0x00006209, 0x00006289, 0x00000000, 0x2E771009,
+            0x2E781009, 0x2E791009, 0x2E7A1009, 0x2E7B1009, 0x2E7C1009, 0x2E7D1009,
+            0x2E7F1009, 0x00000000, 0x00000000, 0x2E811009,
+        },
+        {
+            0x2E821009, 0x00000000, 0x00000000, 0x2E831009, 0x2E841009, 0x2E851009,
+            0x2E861009, 0x2E871009, 0x2E881009, 0x2E891009, 0x2E8A1009, 0x2E8B1009,
+            0x2E8C1009, 0x2E8D1009, 0x2E8E1009, 0x2E8F1009,
+        },
+        {
+            0x2E901009, 0x2E911009, 0x2E921009, 0x2E931009, 0x2E941009, 0x2E951009,
+            0x2E961009, 0x2E971009, 0x2E981009, 0x00000000, 0x2E991009, 0x2E9A1009,
+            0x2E9B1009, 0x2E9C1009, 0x2E9D1009, 0x2E9E1009,
+        },
+        {
+            0x2E9F1009, 0x00000000, 0x2EA01009, 0x2EA11009, 0x00000000, 0x2EA21009,
+            0x2EA31009, 0x2EA41009, 0x2EA51009, 0x2EA61009, 0x00000000, 0x00006109,
+            0x00006109, 0x2EA71009, 0x2EAA1009, 0x2EAB1009,
+        },
+        {
+            0x2EAC1009, 0x2EAD1009, 0x2EAE1009, 0x2EAF1009, 0x2EB01009, 0x00000000,
+            0x00000000, 0x000000E3, 0x2EB41009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x2EB71009, 0x00000000, 0x00000000,
+        },
+        {
+            0x2E761009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x2EB81009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x2EB91009, 0x2EA81009, 0x2EA91009,
+        },
+        {
+            0x2E7E1009, 0x2E801009, 0x2EB11009, 0x2EB21009, 0x00000000, 0x00000000,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x2EBC1009, 0x2EBD1009, 0x2EBE1009, 0x2EBF1009, 0x2EC01009, 0x2EC11009,
+            0x2EC21009, 0x2EC31009, 0x2EC41009, 0x2EC51009, 0x2EC61009, 0x2EC71009,
+            0x2EC81009, 0x2EC91009, 0x2ECA1009, 0x2ECB1009,
+        },
+        {
+            0x2ECC1009, 0x2ECD1009, 0x2ECE1009, 0x2ECF1009, 0x2ED01009, 0x2ED11009,
+            0x2ED21009, 0x2ED31009, 0x2ED41009, 0x2ED51009, 0x2ED61009, 0x2ED71009,
+            0x2ED81009, 0x2ED91009, 0x2EDA1009, 0x2EDB1009,
+        },
+        {
+            0x2EDC1009, 0x2EDD1009, 0x2EDE1009, 0x2EDF1009, 0x2EE01009, 0x2EE11009,
+            0x2EE21009, 0x2EE31009, 0x2EE41009, 0x2EE51009, 0x2EE61009, 0x2EE71009,
+            0x2EE81009, 0x2EE91009, 0x2EEA1009, 0x2EEB1009,
+        },
+        {
+            0x2EEC1009, 0x2EED1009, 0x2EEE1009, 0x2EEF1009, 0x2EF01009, 0x2EF61009,
+            0x2EF71009, 0x2EF81009, 0x2EF91009, 0x2EFA1009, 0x2EFB1009, 0x2EFC1009,
+            0x2EFD1009, 0x2EFE1009, 0x2EFF1009, 0x2F001009,
+        },
+        {
+            0x2F011009, 0x2F021009, 0x2F031009, 0x00006189, 0x00006209, 0x00006289,
+            0x00006109, 0x2EF11009, 0x2EF41009, 0x2EBA1009, 0x2EBB1009, 0x02BE1009,
+            0x02BF1009, 0x04861009, 0x04881009, 0x04891009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x04871009, 0x048A1009,
+            0x00000000, 0x048B1009, 0x00006309, 0x2EF51009,
+        },
+        {
+            0x2EF21009, 0x2EF31009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x2F051009, 0x2F061009, 0x2F071009, 0x2F081009, 0x2F091009, 0x2F0A1009,
+            0x2F0B1009, 0x2F0C1009, 0x2F0D1009, 0x2F0E1009, 0x2F0F1009, 0x2F101009,
+            0x2F111009, 0x2F121009, 0x2F131009, 0x2F141009,
+        },
+        {
+            0x2F151009, 0x2F161009, 0x2F171009, 0x2F181009, 0x2F191009, 0x2F1A1009,
+            0x2F1B1009, 0x2F1C1009, 0x2F1D1009, 0x2F1E1009, 0x2F1F1009, 0x2F201009,
+            0x2F211009, 0x2F221009, 0x2F231009, 0x2F241009,
+        },
+        {
+            0x2F251009, 0x2F261009, 0x2F271009, 0x2F281009, 0x2F291009, 0x2F2A1009,
+            0x2F2B1009, 0x2F2C1009, 0x2F2D1009, 0x2F2E1009, 0x2F2F1009, 0x2F301009,
+            0x2F311009, 0x2F321009, 0x2F331009, 0x2F341009,
+        },
+        {
+            0x2F371009, 0x2F381009, 0x2F391009, 0x2F3A1009, 0x2F3B1009, 0x2F3C1009,
+            0x2F3D1009, 0x2F3E1009, 0x2F3F1009, 0x000000E7, 0x2F411009, 0x00000000,
+            0x00000000, 0x2F441009, 0x00000000, 0x00006189,
+        },
+        {
+            0x00006209, 0x00006289, 0x2F461009, 0x00006109, 0x2F351009, 0x2F361009,
+            0x048C1009, 0x2F041009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x2F471009, 0x2F481009, 0x2F491009, 0x2F4A1009, 0x2F4B1009, 0x2F4C1009,
+            0x2F4D1009, 0x2F4E1009, 0x2F4F1009, 0x2F501009, 0x2F511009, 0x2F521009,
+            0x2F531009, 0x2F541009, 0x2F551009, 0x2F561009,
+        },
+        {
+            0x2F571009, 0x2F581009, 0x2F591009, 0x2F5A1009, 0x2F5B1009, 0x2F5C1009,
+            0x2F5D1009, 0x2F5E1009, 0x2F5F1009, 0x2F601009, 0x2F611009, 0x2F621009,
+            0x2F631009, 0x2F641009, 0x2F651009, 0x2F661009,
+        },
+        {
+            0x2F671009, 0x2F681009, 0x2F691009, 0x2F6A1009, 0x2F6B1009, 0x2F6C1009,
+            0x2F6D1009, 0x2F6E1009, 0x2F6F1009, 0x2F701009, 0x2F711009, 0x2F721009,
+            0x2F731009, 0x2F741009, 0x2F751009, 0x2F761009,
+        },
+        {
+            0x2F771009, 0x2F781009, 0x2F791009, 0x2F7A1009, 0x2F7B1009, 0x2F7C1009,
+            0x00000000, 0x00000000, 0x000000EB, 0x000000EF, 0x00000000, 0x00000000,
+            0x00006189, 0x00006209, 0x00006289, 0x2F811009,
+        },
+        {
+            0x00006109, 0x048D1009, 0x02C01009, 0x02C11009, 0x048E1009, 0x048F1009,
+            0x04901009, 0x04911009, 0x04921009, 0x04931009, 0x04941009, 0x04951009,
+            0x04961009, 0x04971009, 0x04981009, 0x04991009,
+        },
+        {
+            0x049A1009, 0x049B1009, 0x049C1009, 0x049D1009, 0x049E1009, 0x049F1009,
+            0x04A01009, 0x04A11009, 0x0043A40A, 0x0043AC0A, 0x0043B40A, 0x0043BC0A,
+            0x0043C40A, 0x0043CC0A, 0x00000000, 0x00000000,
+        },
+        {
+            0x2F821009, 0x2F831009, 0x2F841009, 0x2F851009, 0x2F861009, 0x2F871009,
+            0x2F881009, 0x2F891009, 0x2F8A1009, 0x2F8B1009, 0x2F8C1009, 0x2F8D1009,
+            0x2F8E1009, 0x2F8F1009, 0x2F901009, 0x2F911009,
+        },
+        {
+            0x2F921009, 0x2F931009, 0x2F941009, 0x2F951009, 0x2F961009, 0x2F971009,
+            0x2F981009, 0x2F991009, 0x2F9A1009, 0x2F9B1009, 0x2F9C1009, 0x2F9D1009,
+            0x2F9E1009, 0x2F9F1009, 0x2FA01009, 0x2FA11009,
+        },
+        {
+            0x2FA21009, 0x2FA31009, 0x2FA41009, 0x2FA51009, 0x2FA61009, 0x2FA71009,
+            0x2FA81009, 0x2FA91009, 0x2FAA1009, 0x2FAB1009, 0x2FAC1009, 0x2FAD1009,
+            0x2FAE1009, 0x2FAF1009, 0x2FB01009, 0x2FB11009,
+        },
+        {
+            0x2FB21009, 0x2FB31009, 0x2FB41009, 0x2FB51009, 0x2FB61009, 0x2FB71009,
+            0x2FB81009, 0x2FB91009, 0x2FBA1009, 0x2FBB1009, 0x2FBC1009, 0x2FBD1009,
+            0x2FBE1009, 0x00006209, 0x00006289, 0x2FBF1009,
+        },
+        {
+            0x00006189, 0x02C21009, 0x02C31009, 0x04A21009, 0x2FC01009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x03F31009, 0x03F41009, 0x03F51009, 0x03F61009, 0x03F71009, 0x03F81009,
+            0x03F91009, 0x03FA1009, 0x03FB1009, 0x03FC1009, 0x03FD1009, 0x03FE1009,
+            0x03FF1009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x2FC11009, 0x2FC21009, 0x2FC31009, 0x2FC41009, 0x2FC51009, 0x2FC61009,
+            0x2FC71009, 0x2FC81009, 0x2FC91009, 0x2FCA1009, 0x2FCE1009, 0x2FCF1009,
+            0x2FD11009, 0x2FD21009, 0x2FD31009, 0x2FD41009,
+        },
+        {
+            0x2FD51009, 0x2FD61009, 0x2FD71009, 0x2FD81009, 0x2FD91009, 0x2FDA1009,
+            0x2FDB1009, 0x2FDC1009, 0x2FDD1009, 0x2FDE1009, 0x2FDF1009, 0x2FE01009,
+            0x2FE11009, 0x2FE21009, 0x2FE31009, 0x2FE41009,
+        },
+        {
+            0x2FE51009, 0x2FE61009, 0x2FE71009, 0x2FE81009, 0x2FE91009, 0x2FEA1009,
+            0x2FEB1009, 0x2FCC1009, 0x2FCB1009, 0x2FCD1009, 0x2FEC1009, 0x00006209,
+            0x00006289, 0x2FED1009, 0x2FEE1009, 0x2FEF1009,
+        },
+        {
+            0x2FF01009, 0x2FF11009, 0x2FF21009, 0x2FF31009, 0x2FF41009, 0x2FF51009,
+            0x2FF61009, 0x00006109, 0x2FD01009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x30A51009, 0x30A61009, 0x30A71009, 0x30A81009, 0x30A91009, 0x0043D40A,
+            0x30AA1009, 0x30AB1009, 0x30AC1009, 0x30AD1009, 0x30AE1009, 0x30AF1009,
+            0x30B01009, 0x30B11009, 0x30B21009, 0x30B31009,
+        },
+        {
+            0x30B41009, 0x30B51009, 0x30B61009, 0x30B71009, 0x30B81009, 0x30B91009,
+            0x0043DC0A, 0x30BA1009, 0x30BB1009, 0x30BC1009, 0x0043E40A, 0x00000000,
+            0x00000000, 0x30C91009, 0x30CA1009, 0x30CB1009,
+        },
+        {
+            0x30BD1009, 0x30BE1009, 0x30BF1009, 0x30C01009, 0x30C11009, 0x30C21009,
+            0x30C31009, 0x30C41009, 0x30C51009, 0x30C61009, 0x30C71009, 0x30C81009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1E511009, 0x1E521009,
+            0x02C41009, 0x02C51009, 0x02F51009, 0x059E1009,
+        },
+        {
+            0x306D1009, 0x306E1009, 0x306F1009, 0x30701009, 0x30711009, 0x30721009,
+            0x30731009, 0x30741009, 0x30751009, 0x30761009, 0x30771009, 0x30781009,
+            0x30791009, 0x307A1009, 0x307B1009, 0x307C1009,
+        },
+        {
+            0x307D1009, 0x307E1009, 0x307F1009, 0x30801009, 0x30811009, 0x30821009,
+            0x30831009, 0x30841009, 0x30851009, 0x30861009, 0x30871009, 0x30881009,
+            0x30891009, 0x308A1009, 0x308B1009, 0x308C1009,
+        },
+        {
+            0x308D1009, 0x308E1009, 0x308F1009, 0x30901009, 0x30911009, 0x30921009,
+            0x30931009, 0x30941009, 0x30951009, 0x30961009, 0x30971009, 0x30981009,
+            0x30991009, 0x309A1009, 0x309B1009, 0x309C1009,
+        },
+        {
+            0x309D1009, 0x309E1009, 0x309F1009, 0x30A01009, 0x30A11009, 0x30A21009,
+            0x30A31009, 0x00006209, 0x00006289, 0x30A41009, 0x00006109, 0x04A31009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x49AF1021, 0x49B01021, 0x49B11021, 0x49B21021, 0x49B31021, 0x49B41021,
+            0x49B51021, 0x49B61021, 0x49B71021, 0x49B81021, 0x49B91021, 0x49BA1021,
+            0x49BB1021, 0x49BC1021, 0x49BD1021, 0x49BE1021,
+        },
+        {
+            0x49BF1021, 0x49C01021, 0x49C11021, 0x49C21021, 0x49C31021, 0x49C41021,
+            0x49C51021, 0x49C61021, 0x49C71021, 0x49C81021, 0x49C91021, 0x49CA1021,
+            0x49CB1021, 0x49CC1021, 0x49CD1021, 0x49CE1021,
+        },
+        {
+            0x49AF1009, 0x49B01009, 0x49B11009, 0x49B21009, 0x49B31009, 0x49B41009,
+            0x49B51009, 0x49B61009, 0x49B71009, 0x49B81009, 0x49B91009, 0x49BA1009,
+            0x49BB1009, 0x49BC1009, 0x49BD1009, 0x49BE1009,
+        },
+        {
+            0x49BF1009, 0x49C01009, 0x49C11009, 0x49C21009, 0x49C31009, 0x49C41009,
+            0x49C51009, 0x49C61009, 0x49C71009, 0x49C81009, 0x49C91009, 0x49CA1009,
+            0x49CB1009, 0x49CC1009, 0x49CD1009, 0x49CE1009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1E781009, 0x1E791009,
+            0x1E7A1009, 0x1E7B1009, 0x1E7C1009, 0x1E7D1009,
+        },
+        {
+            0x1E7E1009, 0x1E7F1009, 0x1E801009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x49AE1009,
+        },
+        {
+            0x2FF71009, 0x2FF81009, 0x2FF91009, 0x2FFA1009, 0x2FFB1009, 0x2FFC1009,
+            0x2FFD1009, 0x00000000, 0x00000000, 0x2FFE1009, 0x00000000, 0x00000000,
+            0x2FFF1009, 0x30001009, 0x30011009, 0x30021009,
+        },
+        {
+            0x30031009, 0x30051009, 0x30061009, 0x30071009, 0x00000000, 0x30081009,
+            0x30091009, 0x00000000, 0x300A1009, 0x300B1009, 0x300C1009, 0x300D1009,
+            0x300E1009, 0x300F1009, 0x30101009, 0x30111009,
+        },
+        {
+            0x30121009, 0x30131009, 0x30141009, 0x30151009, 0x30161009, 0x30171009,
+            0x30191009, 0x301B1009, 0x301D1009, 0x301E1009, 0x301F1009, 0x30201009,
+            0x30211009, 0x30221009, 0x30231009, 0x30241009,
+        },
+        {
+            0x30251009, 0x30261009, 0x30271009, 0x30281009, 0x30291009, 0x000000F3,
+            0x00000000, 0x302B1009, 0x00000000, 0x00000000, 0x00000000, 0x00006209,
+            0x00006189, 0x302D1009, 0x302E1009, 0x30041009,
+        },
+        {
+            0x30181009, 0x301A1009, 0x301C1009, 0x00006109, 0x02C61009, 0x04A41009,
+            0x02F61009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x302F1009, 0x30301009, 0x30311009, 0x30321009, 0x30331009, 0x30341009,
+            0x30351009, 0x30361009, 0x00000000, 0x00000000, 0x30371009, 0x30381009,
+            0x30391009, 0x303A1009, 0x303B1009, 0x303C1009,
+        },
+        {
+            0x303D1009, 0x303E1009, 0x303F1009, 0x30401009, 0x30411009, 0x30421009,
+            0x30431009, 0x30441009, 0x30451009, 0x30461009, 0x30471009, 0x30481009,
+            0x30491009, 0x304A1009, 0x304B1009, 0x304C1009,
+        },
+        {
+            0x304D1009, 0x304E1009, 0x304F1009, 0x30501009, 0x30511009, 0x30521009,
+            0x30531009, 0x30541009, 0x30551009, 0x30561009, 0x30571009, 0x30581009,
+            0x30591009, 0x305A1009, 0x305B1009, 0x305C1009,
+        },
+        {
+            0x305D1009, 0x30601009, 0x30611009, 0x30621009, 0x30631009, 0x30641009,
+            0x30651009, 0x30661009, 0x00000000, 0x00000000, 0x30671009, 0x30691009,
+            0x306A1009, 0x306B1009, 0x00006209, 0x00006289,
+        },
+        {
+            0x306C1009, 0x305E1009, 0x04A51009, 0x305F1009, 0x30681009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x33611009, 0x33621009, 0x33631009, 0x33641009, 0x33651009, 0x33661009,
+            0x33671009, 0x33681009, 0x33691009, 0x336A1009, 0x336B1009, 0x33391009,
+            0x333B1009, 0x333C1009, 0x333D1009, 0x333E1009,
+        },
+        {
+            0x333F1009, 0x33401009, 0x33411009, 0x33421009, 0x33431009, 0x33441009,
+            0x33451009, 0x33461009, 0x33471009, 0x33481009, 0x33491009, 0x334A1009,
+            0x334B1009, 0x334C1009, 0x334D1009, 0x334E1009,
+        },
+        {
+            0x334F1009, 0x33501009, 0x33511009, 0x33521009, 0x33531009, 0x33541009,
+            0x33551009, 0x33561009, 0x33571009, 0x33581009, 0x33591009, 0x335A1009,
+            0x335B1009, 0x335C1009, 0x335D1009, 0x335E1009,
+        },
+        {
+            0x335F1009, 0x33601009, 0x333A1009, 0x00006109, 0x336C1009, 0x00006189,
+            0x00006189, 0x00006189, 0x00006209, 0x00006289, 0x335A105D, 0x33591065,
+            0x335A1065, 0x335B1065, 0x335C1065, 0x04261009,
+        },
+        {
+            0x04271009, 0x04281009, 0x04291009, 0x042A1009, 0x042B1009, 0x042C1009,
+            0x042D1009, 0x336D1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x336E1009, 0x336F1009, 0x33701009, 0x33711009, 0x33741009, 0x33761009,
+            0x33751009, 0x33771009, 0x33781009, 0x33721009, 0x33731009, 0x33791009,
+            0x337A1009, 0x337C1009, 0x337D1009, 0x337E1009,
+        },
+        {
+            0x337F1009, 0x33801009, 0x33811009, 0x33821009, 0x33831009, 0x33841009,
+            0x33851009, 0x33861009, 0x33871009, 0x33881009, 0x33891009, 0x338A1009,
+            0x338B1009, 0x338C1009, 0x338D1009, 0x338E1009,
+        },
+        {
+            0x338F1009, 0x33901009, 0x33911009, 0x33921009, 0x33931009, 0x33941009,
+            0x33951009, 0x33961009, 0x33971009, 0x33981009, 0x33991009, 0x339A1009,
+            0x339B1009, 0x339C1009, 0x339D1009, 0x339E1009,
+        },
+        {
+            0x339F1009, 0x33A01009, 0x33A11009, 0x337B1009, 0x33A21009, 0x33A31009,
+            0x339B105D, 0x339C105D, 0x339E105D, 0x33A0105D, 0x337A1065, 0x337C1065,
+            0x337F1065, 0x338A1065, 0x338E1065, 0x338F1065,
+        },
+        {
+            0x33931065, 0x339B1065, 0x339C1065, 0x339E1065, 0x33A01065, 0x33991065,
+            0x00006209, 0x00006289, 0x00006909, 0x33A41009, 0x042E1009, 0x042F1009,
+            0x04301009, 0x33A51009, 0x04311009, 0x04321009,
+        },
+        {
+            0x04331009, 0x04341009, 0x04351009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x49D61009, 0x49D71009, 0x49D81009, 0x49D91009, 0x49DA1009, 0x49DB1009,
+            0x49DC1009, 0x49DD1009, 0x49DE1009, 0x49DF1009, 0x49E01009, 0x49E11009,
+            0x49E21009, 0x49E31009, 0x49E41009, 0x49E51009,
+        },
+        {
+            0x49E61009, 0x49E71009, 0x49E81009, 0x49E91009, 0x49EA1009, 0x49CF1009,
+            0x49D01009, 0x49D11009, 0x49D21009, 0x49D31009, 0x49D41009, 0x49D51009,
+            0x49EB1009, 0x49EC1009, 0x49F21009, 0x49ED1009,
+        },
+        {
+            0x49EE1009, 0x49EF1009, 0x49F01009, 0x49F11009, 0x49F31009, 0x49F91009,
+            0x49F71009, 0x4A051009, 0x49FA1009, 0x49F81009, 0x4A061009, 0x4A011009,
+            0x49FF1009, 0x4A021009, 0x4A001009, 0x49F41009,
+        },
+        {
+            0x4A071009, 0x49F61009, 0x49F51009, 0x49FD1009, 0x49FB1009, 0x4A031009,
+            0x49FE1009, 0x49FC1009, 0x4A041009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x31DB1009, 0x31DC1009, 0x31DD1009, 0x31DE1009, 0x31DF1009, 0x31E01009,
+            0x31E11009, 0x31E21009, 0x31E31009, 0x00000000, 0x31E41009, 0x31E51009,
+            0x31E61009, 0x31E71009, 0x31E81009, 0x31E91009,
+        },
+        {
+            0x31EA1009, 0x31EB1009, 0x31EC1009, 0x31ED1009, 0x31EE1009, 0x31EF1009,
+            0x31F01009, 0x31F11009, 0x31F21009, 0x31F31009, 0x31F41009, 0x31F51009,
+            0x31F61009, 0x31F71009, 0x31F81009, 0x31F91009,
+        },
+        {
+            0x31FA1009, 0x31FB1009, 0x31FC1009, 0x31FD1009, 0x31FE1009, 0x31FF1009,
+            0x32001009, 0x32011009, 0x32021009, 0x32031009, 0x32041009, 0x32051009,
+            0x32061009, 0x32071009, 0x32081009, 0x320A1009,
+        },
+        {
+            0x320B1009, 0x320C1009, 0x320D1009, 0x320E1009, 0x320F1009, 0x32101009,
+            0x32111009, 0x00000000, 0x32121009, 0x32131009, 0x32141009, 0x32151009,
+            0x00006189, 0x00006209, 0x00006289, 0x32161009,
+        },
+        {
+            0x32091009, 0x02C71009, 0x02C81009, 0x046B1009, 0x046C1009, 0x046D1009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1F991009, 0x1F9A1009,
+            0x1F9B1009, 0x1F9C1009, 0x1F9D1009, 0x1F9E1009,
+        },
+        {
+            0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1E631009, 0x1E641009, 0x1E651009,
+            0x1E661009, 0x1E671009, 0x1E681009, 0x1E691009, 0x1E6A1009, 0x1E6B1009,
+            0x1E6C1009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x04361009, 0x04371009, 0x33A61009, 0x33A81009, 0x33AA1009, 0x33AC1009,
+            0x33AE1009, 0x33B01009, 0x33B21009, 0x33B41009, 0x33B61009, 0x33B81009,
+            0x33BA1009, 0x33BC1009, 0x33BE1009, 0x33C01009,
+        },
+        {
+            0x33C21009, 0x33C41009, 0x33C61009, 0x33C81009, 0x33CA1009, 0x33CC1009,
+            0x33CE1009, 0x33D01009, 0x33D21009, 0x33D31009, 0x33D51009, 0x33D71009,
+            0x33D91009, 0x33DB1009, 0x33DD1009, 0x33DF1009,
+        },
+        {
+            0x00000000, 0x00000000, 0x33A71009, 0x33A91009, 0x33AB1009, 0x33AD1009,
+            0x33AF1009, 0x33B11009, 0x33B31009, 0x33B51009, 0x33B71009, 0x33B91009,
+            0x33BB1009, 0x33BD1009, 0x33BF1009, 0x33C11009,
+        },
+        {
+            0x33C31009, 0x33C51009, 0x33C71009, 0x33C91009, 0x33CB1009, 0x33CD1009,
+            0x33CF1009, 0x33D11009, 0x00000000, 0x33D41009, 0x33D61009, 0x33D81009,
+            0x33DA1009, 0x33DC1009, 0x33DE1009, 0x33E01009,
+        },
+        {
+            0x33E11009, 0x33E21009, 0x33E31009, 0x33E41009, 0x33E51009, 0x00006209,
+            0x00006189, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x30CC1009, 0x30CD1009, 0x30CE1009, 0x30CF1009, 0x30D01009, 0x30D11009,
+            0x30D21009, 0x00000000, 0x30D31009, 0x30D41009, 0x00000000, 0x30D51009,
+            0x30D61009, 0x30D71009, 0x30D81009, 0x30D91009,
+        },
+        {
+            0x30DA1009, 0x30DB1009, 0x30DC1009, 0x30DD1009, 0x30DE1009, 0x30DF1009,
+            0x30E01009, 0x30E11009, 0x30E21009, 0x30E31009, 0x30E41009, 0x30E51009,
+            0x30E61009, 0x30E71009, 0x30E81009, 0x30E91009,
+        },
+        {
+            0x30EA1009, 0x30EB1009, 0x30EC1009, 0x30ED1009, 0x30EE1009, 0x30EF1009,
+            0x30F01009, 0x30F11009, 0x30F21009, 0x30F31009, 0x30F41009, 0x30F51009,
+            0x30F61009, 0x30F71009, 0x30F81009, 0x30F91009,
+        },
+        {
+            0x30FA1009, 0x30FB1009, 0x30FC1009, 0x30FD1009, 0x30FE1009, 0x30FF1009,
+            0x31001009, 0x00000000, 0x00000000, 0x00000000, 0x31011009, 0x00000000,
+            0x31021009, 0x31031009, 0x00000000, 0x31041009,
+        },
+        {
+            0x00006209, 0x00006289, 0x00006109, 0x00006189, 0x31051009, 0x31061009,
+            0x30F0105D, 0x30F01065, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x31081009, 0x31091009, 0x310A1009, 0x310B1009, 0x310C1009, 0x310D1009,
+            0x00000000, 0x310E1009, 0x310F1009, 0x00000000, 0x31101009, 0x31111009,
+            0x31121009, 0x31131009, 0x31141009, 0x31151009,
+        },
+        {
+            0x31161009, 0x31171009, 0x31181009, 0x31191009, 0x311A1009, 0x311B1009,
+            0x311C1009, 0x311D1009, 0x311E1009, 0x311F1009, 0x31201009, 0x31211009,
+            0x31221009, 0x31231009, 0x31241009, 0x31251009,
+        },
+        {
+            0x31261009, 0x31271009, 0x31281009, 0x31291009, 0x312A1009, 0x312B1009,
+            0x312C1009, 0x312D1009, 0x312E1009, 0x312F1009, 0x31301009, 0x31311009,
+            0x31321009, 0x31331009, 0x31341009, 0x00000000,
+        },
+        {
+            0x31351009, 0x31361009, 0x00000000, 0x31371009, 0x31381009, 0x00006209,
+            0x00006289, 0x31391009, 0x31071009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x34F11009, 0x34F21009, 0x34F31009, 0x34F41009, 0x34F51009, 0x34F61009,
+            0x34F71009, 0x34F81009, 0x34F91009, 0x34FA1009, 0x34FB1009, 0x34FC1009,
+            0x34FD1009, 0x34FE1009, 0x34FF1009, 0x35001009,
+        },
+        {
+            0x35011009, 0x35021009, 0x35031009, 0x35041009, 0x35051009, 0x35061009,
+            0x35071009, 0x02F71009, 0x02F81009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x49121009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1D6B1009, 0x1D6C1009, 0x1D6D1009, 0x1D6E1009, 0x1D6F1009, 0x1D701009,
+            0x1D711009, 0x1D721009, 0x1D731009, 0x1D741009, 0x1D751009, 0x1D761009,
+            0x1D771009, 0x1D781009, 0x1D791009, 0x1D7A1009,
+        },
+        {
+            0x1D7B1009, 0x1D7C1009, 0x1D7D1009, 0x1D7E1009, 0x1D7F1009, 0x05501009,
+            0x05511009, 0x05521009, 0x05531009, 0x05541009, 0x05551009, 0x05561009,
+            0x05571009, 0x1F711009, 0x1F721009, 0x1F731009,
+        },
+        {
+            0x1F741009, 0x05581009, 0x05591009, 0x055A1009, 0x055B1009, 0x055C1009,
+            0x055D1009, 0x055E1009, 0x055F1009, 0x05601009, 0x05611009, 0x05621009,
+            0x05631009, 0x05641009, 0x05651009, 0x05661009,
+        },
+        {
+            0x05671009, 0x05681009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x04A61009,
+        },
+        {
+            0x51491009, 0x514A1009, 0x514B1009, 0x514C1009, 0x514D1009, 0x514E1009,
+            0x514F1009, 0x51501009, 0x51511009, 0x51521009, 0x51531009, 0x51541009,
+            0x51551009, 0x51561009, 0x51571009, 0x51581009,
+        },
+        {
+            0x51591009, 0x515A1009, 0x515B1009, 0x515C1009, 0x515D1009, 0x515E1009,
+            0x515F1009, 0x51601009, 0x51611009, 0x51621009, 0x51631009, 0x51641009,
+            0x51651009, 0x51661009, 0x51671009, 0x51681009,
+        },
+        {
+            0x51691009, 0x516A1009, 0x516B1009, 0x516C1009, 0x516D1009, 0x516E1009,
+            0x516F1009, 0x51701009, 0x51711009, 0x51721009, 0x51731009, 0x51741009,
+            0x51751009, 0x51761009, 0x51771009, 0x51781009,
+        },
+        {
+            0x51791009, 0x517A1009, 0x517B1009, 0x517C1009, 0x517D1009, 0x517E1009,
+            0x517F1009, 0x51801009, 0x51811009, 0x51821009, 0x51831009, 0x51841009,
+            0x51851009, 0x51861009, 0x51871009, 0x51881009,
+        },
+        {
+            0x51891009, 0x518A1009, 0x518B1009, 0x518C1009, 0x518D1009, 0x518E1009,
+            0x518F1009, 0x51901009, 0x51911009, 0x51921009, 0x51931009, 0x51941009,
+            0x51951009, 0x51961009, 0x51971009, 0x51981009,
+        },
+        {
+            0x51991009, 0x519A1009, 0x519B1009, 0x519C1009, 0x519D1009, 0x519E1009,
+            0x519F1009, 0x51A01009, 0x51A11009, 0x51A21009, 0x51A31009, 0x51A41009,
+            0x51A51009, 0x51A61009, 0x51A71009, 0x51A81009,
+        },
+        {
+            0x51A91009, 0x51AA1009, 0x51AB1009, 0x51AC1009, 0x51AD1009, 0x51AE1009,
+            0x51AF1009, 0x51B01009, 0x51B11009, 0x51B21009, 0x51B31009, 0x51B41009,
+            0x51B51009, 0x51B61009, 0x51B71009, 0x51B81009,
+        },
+        {
+            0x51B91009, 0x51BA1009, 0x51BB1009, 0x51BC1009, 0x51BD1009, 0x51BE1009,
+            0x51BF1009, 0x51C01009, 0x51C11009, 0x51C21009, 0x51C31009, 0x51C41009,
+            0x51C51009, 0x51C61009, 0x51C71009, 0x51C81009,
+        },
+        {
+            0x51C91009, 0x51CA1009, 0x51CB1009, 0x51CC1009, 0x51CD1009, 0x51CE1009,
+            0x51CF1009, 0x51D01009, 0x51D11009, 0x51D21009, 0x51D31009, 0x51D41009,
+            0x51D51009, 0x51D61009, 0x51D71009, 0x51D81009,
+        },
+        {
+            0x51D91009, 0x51DA1009, 0x51DB1009, 0x51DC1009, 0x51DD1009, 0x51DE1009,
+            0x51DF1009, 0x51E01009, 0x51E11009, 0x51E21009, 0x51E31009, 0x51E41009,
+            0x51E51009, 0x51E61009, 0x51E71009, 0x51E81009,
+        },
+        {
+            0x51E91009, 0x51EA1009, 0x51EB1009, 0x51EC1009, 0x51ED1009, 0x51EE1009,
+            0x51EF1009, 0x51F01009, 0x51F11009, 0x51F21009, 0x51F31009, 0x51F41009,
+            0x51F51009, 0x51F61009, 0x51F71009, 0x51F81009,
+        },
+        {
+            0x51F91009, 0x51FA1009, 0x51FB1009, 0x51FC1009, 0x51FD1009, 0x51FE1009,
+            0x51FF1009, 0x52001009, 0x52011009, 0x52021009, 0x52031009, 0x52041009,
+            0x52051009, 0x52061009, 0x52071009, 0x52081009,
+        },
+        {
+            0x52091009, 0x520A1009, 0x520B1009, 0x520C1009, 0x520D1009, 0x520E1009,
+            0x520F1009, 0x52101009, 0x52111009, 0x52121009, 0x52131009, 0x52141009,
+            0x52151009, 0x52161009, 0x52171009, 0x52181009,
+        },
+        {
+            0x52191009, 0x521A1009, 0x521B1009, 0x521C1009, 0x521D1009, 0x521E1009,
+            0x521F1009, 0x52201009, 0x52211009, 0x52221009, 0x52231009, 0x52241009,
+            0x52251009, 0x52261009, 0x52271009, 0x52281009,
+        },
+        {
+            0x52291009, 0x522A1009, 0x522B1009, 0x522C1009, 0x522D1009, 0x522E1009,
+            0x522F1009, 0x52301009, 0x52311009, 0x52321009, 0x52331009, 0x52341009,
+            0x52351009, 0x52361009, 0x52371009, 0x52381009,
+        },
+        {
+            0x52391009, 0x523A1009, 0x523B1009, 0x523C1009, 0x523D1009, 0x523E1009,
+            0x523F1009, 0x52401009, 0x52411009, 0x52421009, 0x52431009, 0x52441009,
+            0x52451009, 0x52461009, 0x52471009, 0x52481009,
+        },
+        {
+            0x52491009, 0x524A1009, 0x524B1009, 0x524C1009, 0x524D1009, 0x524E1009,
+            0x524F1009, 0x52501009, 0x52511009, 0x52521009, 0x52531009, 0x52541009,
+            0x52551009, 0x52561009, 0x52571009, 0x52581009,
+        },
+        {
+            0x52591009, 0x525A1009, 0x525B1009, 0x525C1009, 0x525D1009, 0x525E1009,
+            0x525F1009, 0x52601009, 0x52611009, 0x52621009, 0x52631009, 0x52641009,
+            0x52651009, 0x52661009, 0x52671009, 0x52681009,
+        },
+        {
+            0x52691009, 0x526A1009, 0x526B1009, 0x526C1009, 0x526D1009, 0x526E1009,
+            0x526F1009, 0x52701009, 0x52711009, 0x52721009, 0x52731009, 0x52741009,
+            0x52751009, 0x52761009, 0x52771009, 0x52781009,
+        },
+        {
+            0x52791009, 0x527A1009, 0x527B1009, 0x527C1009, 0x527D1009, 0x527E1009,
+            0x527F1009, 0x52801009, 0x52811009, 0x52821009, 0x52831009, 0x52841009,
+            0x52851009, 0x52861009, 0x52871009, 0x52881009,
+        },
+        {
+            0x52891009, 0x528A1009, 0x528B1009, 0x528C1009, 0x528D1009, 0x528E1009,
+            0x528F1009, 0x52901009, 0x52911009, 0x52921009, 0x52931009, 0x52941009,
+            0x52951009, 0x52961009, 0x52971009, 0x52981009,
+        },
+        {
+            0x52991009, 0x529A1009, 0x529B1009, 0x529C1009, 0x529D1009, 0x529E1009,
+            0x529F1009, 0x52A01009, 0x52A11009, 0x52A21009, 0x52A31009, 0x52A41009,
+            0x52A51009, 0x52A61009, 0x52A71009, 0x52A81009,
+        },
+        {
+            0x52A91009, 0x52AA1009, 0x52AB1009, 0x52AC1009, 0x52AD1009, 0x52AE1009,
+            0x52AF1009, 0x52B01009, 0x52B11009, 0x52B21009, 0x52B31009, 0x52B41009,
+            0x52B51009, 0x52B61009, 0x52B71009, 0x52B81009,
+        },
+        {
+            0x52B91009, 0x52BA1009, 0x52BB1009, 0x52BC1009, 0x52BD1009, 0x52BE1009,
+            0x52BF1009, 0x52C01009, 0x52C11009, 0x52C21009, 0x52C31009, 0x52C41009,
+            0x52C51009, 0x52C61009, 0x52C71009, 0x52C81009,
+        },
+        {
+            0x52C91009, 0x52CA1009, 0x52CB1009, 0x52CC1009, 0x52CD1009, 0x52CE1009,
+            0x52CF1009, 0x52D01009, 0x52D11009, 0x52D21009, 0x52D31009, 0x52D41009,
+            0x52D51009, 0x52D61009, 0x52D71009, 0x52D81009,
+        },
+        {
+            0x52D91009, 0x52DA1009, 0x52DB1009, 0x52DC1009, 0x52DD1009, 0x52DE1009,
+            0x52DF1009, 0x52E01009, 0x52E11009, 0x52E21009, 0x52E31009, 0x52E41009,
+            0x52E51009, 0x52E61009, 0x52E71009, 0x52E81009,
+        },
+        {
+            0x52E91009, 0x52EA1009, 0x52EB1009, 0x52EC1009, 0x52ED1009, 0x52EE1009,
+            0x52EF1009, 0x52F01009, 0x52F11009, 0x52F21009, 0x52F31009, 0x52F41009,
+            0x52F51009, 0x52F61009, 0x52F71009, 0x52F81009,
+        },
+        {
+            0x52F91009, 0x52FA1009, 0x52FB1009, 0x52FC1009, 0x52FD1009, 0x52FE1009,
+            0x52FF1009, 0x53001009, 0x53011009, 0x53021009, 0x53031009, 0x53041009,
+            0x53051009, 0x53061009, 0x53071009, 0x53081009,
+        },
+        {
+            0x53091009, 0x530A1009, 0x530B1009, 0x530C1009, 0x530D1009, 0x530E1009,
+            0x530F1009, 0x53101009, 0x53111009, 0x53121009, 0x53131009, 0x53141009,
+            0x53151009, 0x53161009, 0x53171009, 0x53181009,
+        },
+        {
+            0x53191009, 0x531A1009, 0x531B1009, 0x531C1009, 0x531D1009, 0x531E1009,
+            0x531F1009, 0x53201009, 0x53211009, 0x53221009, 0x53231009, 0x53241009,
+            0x53251009, 0x53261009, 0x53271009, 0x53281009,
+        },
+        {
+            0x53291009, 0x532A1009, 0x532B1009, 0x532C1009, 0x532D1009, 0x532E1009,
+            0x532F1009, 0x53301009, 0x53311009, 0x53321009, 0x53331009, 0x53341009,
+            0x53351009, 0x53361009, 0x53371009, 0x53381009,
+        },
+        {
+            0x53391009, 0x533A1009, 0x533B1009, 0x533C1009, 0x533D1009, 0x533E1009,
+            0x533F1009, 0x53401009, 0x53411009, 0x53421009, 0x53431009, 0x53441009,
+            0x53451009, 0x53461009, 0x53471009, 0x53481009,
+        },
+        {
+            0x53491009, 0x534A1009, 0x534B1009, 0x534C1009, 0x534D1009, 0x534E1009,
+            0x534F1009, 0x53501009, 0x53511009, 0x53521009, 0x53531009, 0x53541009,
+            0x53551009, 0x53561009, 0x53571009, 0x53581009,
+        },
+        {
+            0x53591009, 0x535A1009, 0x535B1009, 0x535C1009, 0x535D1009, 0x535E1009,
+            0x535F1009, 0x53601009, 0x53611009, 0x53621009, 0x53631009, 0x53641009,
+            0x53651009, 0x53661009, 0x53671009, 0x53681009,
+        },
+        {
+            0x53691009, 0x536A1009, 0x536B1009, 0x536C1009, 0x536D1009, 0x536E1009,
+            0x536F1009, 0x53701009, 0x53711009, 0x53721009, 0x53731009, 0x53741009,
+            0x53751009, 0x53761009, 0x53771009, 0x53781009,
+        },
+        {
+            0x53791009, 0x537A1009, 0x537B1009, 0x537C1009, 0x537D1009, 0x537E1009,
+            0x537F1009, 0x53801009, 0x53811009, 0x53821009, 0x53831009, 0x53841009,
+            0x53851009, 0x53861009, 0x53871009, 0x53881009,
+        },
+        {
+            0x53891009, 0x538A1009, 0x538B1009, 0x538C1009, 0x538D1009, 0x538E1009,
+            0x538F1009, 0x53901009, 0x53911009, 0x53921009, 0x53931009, 0x53941009,
+            0x53951009, 0x53961009, 0x53971009, 0x53981009,
+        },
+        {
+            0x53991009, 0x539A1009, 0x539B1009, 0x539C1009, 0x539D1009, 0x539E1009,
+            0x539F1009, 0x53A01009, 0x53A11009, 0x53A21009, 0x53A31009, 0x53A41009,
+            0x53A51009, 0x53A61009, 0x53A71009, 0x53A81009,
+        },
+        {
+            0x53A91009, 0x53AA1009, 0x53AB1009, 0x53AE1009, 0x53AF1009, 0x53B01009,
+            0x53B11009, 0x53B21009, 0x53B31009, 0x53B41009, 0x53B51009, 0x53B61009,
+            0x53B71009, 0x53B81009, 0x53B91009, 0x53BA1009,
+        },
+        {
+            0x53BB1009, 0x53BC1009, 0x53BD1009, 0x53BE1009, 0x53BF1009, 0x53C01009,
+            0x53C11009, 0x53C21009, 0x53C31009, 0x53C41009, 0x53C51009, 0x53C61009,
+            0x53C71009, 0x53C81009, 0x53C91009, 0x53CA1009,
+        },
+        {
+            0x53CB1009, 0x53CC1009, 0x53CD1009, 0x53CE1009, 0x53CF1009, 0x53D01009,
+            0x53D11009, 0x53D21009, 0x53D31009, 0x53D41009, 0x53D51009, 0x53D61009,
+            0x53D71009, 0x53D81009, 0x53D91009, 0x53DA1009,
+        },
+        {
+            0x53DB1009, 0x53DC1009, 0x53DD1009, 0x53DE1009, 0x53DF1009, 0x53E01009,
+            0x53E11009, 0x53E21009, 0x53E31009, 0x53E41009, 0x53E51009, 0x53E61009,
+            0x53E71009, 0x53E81009, 0x53E91009, 0x53EA1009,
+        },
+        {
+            0x53EB1009, 0x53EC1009, 0x53ED1009, 0x53EE1009, 0x53EF1009, 0x53F01009,
+            0x53F11009, 0x53F21009, 0x53F31009, 0x53F41009, 0x53F51009, 0x53F61009,
+            0x53F71009, 0x53F81009, 0x53F91009, 0x53FA1009,
+        },
+        {
+            0x53FB1009, 0x53FC1009, 0x53FD1009, 0x53FE1009, 0x53FF1009, 0x54001009,
+            0x54011009, 0x54021009, 0x54031009, 0x54041009, 0x54051009, 0x54061009,
+            0x54071009, 0x54081009, 0x54091009, 0x540A1009,
+        },
+        {
+            0x540B1009, 0x540C1009, 0x540D1009, 0x540E1009, 0x540F1009, 0x54101009,
+            0x54111009, 0x54121009, 0x54131009, 0x54141009, 0x54151009, 0x54161009,
+            0x54171009, 0x54181009, 0x54191009, 0x541A1009,
+        },
+        {
+            0x541B1009, 0x541C1009, 0x541D1009, 0x541E1009, 0x53AC1009, 0x53AD1009,
+            0x541F1009, 0x54201009, 0x54211009, 0x54221009, 0x54231009, 0x54241009,
+            0x54251009, 0x54261009, 0x54271009, 0x54281009,
+        },
+        {
+            0x54291009, 0x542A1009, 0x542B1009, 0x542C1009, 0x542D1009, 0x542E1009,
+            0x542F1009, 0x54301009, 0x54311009, 0x54321009, 0x54331009, 0x54341009,
+            0x54351009, 0x54361009, 0x54371009, 0x54381009,
+        },
+        {
+            0x54391009, 0x543A1009, 0x543B1009, 0x543C1009, 0x543D1009, 0x543E1009,
+            0x543F1009, 0x54401009, 0x54411009, 0x54421009, 0x54431009, 0x54441009,
+            0x54451009, 0x54461009, 0x54471009, 0x54481009,
+        },
+        {
+            0x54491009, 0x544A1009, 0x544B1009, 0x544C1009, 0x544D1009, 0x544E1009,
+            0x544F1009, 0x54501009, 0x54511009, 0x54521009, 0x54531009, 0x54541009,
+            0x54551009, 0x54561009, 0x54571009, 0x54581009,
+        },
+        {
+            0x54591009, 0x545A1009, 0x545B1009, 0x545C1009, 0x545D1009, 0x545E1009,
+            0x545F1009, 0x54601009, 0x54611009, 0x54621009, 0x54631009, 0x54641009,
+            0x54651009, 0x54661009, 0x54671009, 0x54681009,
+        },
+        {
+            0x54691009, 0x546A1009, 0x546B1009, 0x546C1009, 0x546D1009, 0x546E1009,
+            0x546F1009, 0x54701009, 0x54711009, 0x54721009, 0x54731009, 0x54741009,
+            0x54751009, 0x54761009, 0x54771009, 0x54781009,
+        },
+        {
+            0x54791009, 0x547A1009, 0x547B1009, 0x547C1009, 0x547D1009, 0x547E1009,
+            0x547F1009, 0x54801009, 0x54811009, 0x54821009, 0x54831009, 0x54841009,
+            0x54851009, 0x54861009, 0x54871009, 0x54881009,
+        },
+        {
+            0x54891009, 0x548A1009, 0x548B1009, 0x548C1009, 0x548D1009, 0x548E1009,
+            0x548F1009, 0x54901009, 0x54911009, 0x54921009, 0x54931009, 0x54941009,
+            0x54951009, 0x54961009, 0x54971009, 0x54981009,
+        },
+        {
+            0x54991009, 0x549A1009, 0x549B1009, 0x549C1009, 0x549D1009, 0x549E1009,
+            0x549F1009, 0x54A01009, 0x54A11009, 0x54A21009, 0x54A31009, 0x54A41009,
+            0x54A51009, 0x54A61009, 0x54A71009, 0x54A81009,
+        },
+        {
+            0x54A91009, 0x54AA1009, 0x54AB1009, 0x54AC1009, 0x54AD1009, 0x54AE1009,
+            0x54AF1009, 0x54B01009, 0x54B11009, 0x54B21009, 0x54B31009, 0x54B41009,
+            0x54B51009, 0x54B61009, 0x54B71009, 0x54B81009,
+        },
+        {
+            0x54B91009, 0x54BA1009, 0x54BB1009, 0x54BC1009, 0x54BD1009, 0x54BE1009,
+            0x54BF1009, 0x54C01009, 0x54C11009, 0x54C21009, 0x54C31009, 0x54C41009,
+            0x54C51009, 0x54C61009, 0x54C71009, 0x54C81009,
+        },
+        {
+            0x54C91009, 0x54CA1009, 0x54CB1009, 0x54CC1009, 0x54CD1009, 0x54CE1009,
+            0x54CF1009, 0x54D01009, 0x54D11009, 0x54D21009, 0x54D31009, 0x54D41009,
+            0x54D51009, 0x54D61009, 0x54D71009, 0x54D81009,
+        },
+        {
+            0x54D91009, 0x54DA1009, 0x54DB1009, 0x54DC1009, 0x54DD1009, 0x54DE1009,
+            0x54DF1009, 0x54E01009, 0x54E11009, 0x54E21009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009, 0x1F9E1009, 0x1F9F1009,
+            0x1FA01009, 0x1FA11009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009, 0x1F9E1009,
+            0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1F9C1009,
+        },
+        {
+            0x1F9D1009, 0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1F991009,
+            0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009, 0x1F9E1009, 0x1F9F1009,
+            0x1FA01009, 0x1FA11009, 0x1F991009, 0x1F9A1009,
+        },
+        {
+            0x1F9B1009, 0x1F9C1009, 0x1F9D1009, 0x1F9A1009, 0x1F9B1009, 0x1F9B1009,
+            0x1F9C1009, 0x1F9D1009, 0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+            0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9B1009,
+        },
+        {
+            0x1F9C1009, 0x1F9D1009, 0x1F2C1009, 0x1F2D1009, 0x1F991009, 0x1F9A1009,
+            0x1F9B1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009, 0x1F9B1009, 0x1F9B1009,
+            0x1F9C1009, 0x1F9C1009, 0x1F9C1009, 0x1F9C1009,
+        },
+        {
+            0x1F9E1009, 0x1F9F1009, 0x1F9F1009, 0x1F9F1009, 0x1FA01009, 0x1FA01009,
+            0x1FA11009, 0x1FA11009, 0x1FA11009, 0x1FA11009, 0x1F9A1009, 0x1F9B1009,
+            0x1F9C1009, 0x1F9D1009, 0x1F9E1009, 0x1F991009,
+        },
+        {
+            0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9C1009, 0x1F9D1009, 0x1F9D1009,
+            0x1F9A1009, 0x1F9B1009, 0x1F991009, 0x1F9A1009, 0x1F2E1009, 0x1F2F1009,
+            0x1F301009, 0x1F311009, 0x1F321009, 0x1F331009,
+        },
+        {
+            0x1F341009, 0x1F351009, 0x1F361009, 0x1F371009, 0x1F381009, 0x1F391009,
+            0x1F3A1009, 0x1F3B1009, 0x1F3C1009, 0x1F9C1009, 0x1F9D1009, 0x1F9E1009,
+            0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00000000,
+        },
+        {
+            0x03111009, 0x03121009, 0x03131009, 0x03141009, 0x03151009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x54E31009, 0x54E41009, 0x54E51009, 0x54E61009, 0x54E71009, 0x54E81009,
+            0x54E91009, 0x54EA1009, 0x54EB1009, 0x54EC1009, 0x54ED1009, 0x54EE1009,
+            0x54EF1009, 0x54F01009, 0x54F11009, 0x54F21009,
+        },
+        {
+            0x54F31009, 0x54F41009, 0x54F51009, 0x54F61009, 0x54F71009, 0x54F81009,
+            0x54F91009, 0x54FA1009, 0x54FB1009, 0x54FC1009, 0x54FD1009, 0x54FE1009,
+            0x54FF1009, 0x55001009, 0x55011009, 0x55021009,
+        },
+        {
+            0x55031009, 0x55041009, 0x55051009, 0x55061009, 0x55071009, 0x55081009,
+            0x55091009, 0x550A1009, 0x550B1009, 0x550C1009, 0x550D1009, 0x550E1009,
+            0x550F1009, 0x55101009, 0x55111009, 0x55121009,
+        },
+        {
+            0x55131009, 0x55141009, 0x55151009, 0x55161009, 0x55171009, 0x55181009,
+            0x55191009, 0x551A1009, 0x551B1009, 0x551C1009, 0x551D1009, 0x551E1009,
+            0x551F1009, 0x55201009, 0x55211009, 0x55221009,
+        },
+        {
+            0x55231009, 0x55241009, 0x55251009, 0x55261009, 0x55271009, 0x55281009,
+            0x55291009, 0x552A1009, 0x552B1009, 0x552C1009, 0x552D1009, 0x552E1009,
+            0x552F1009, 0x55301009, 0x55311009, 0x55321009,
+        },
+        {
+            0x55331009, 0x55341009, 0x55351009, 0x55361009, 0x55371009, 0x55381009,
+            0x55391009, 0x553A1009, 0x553B1009, 0x553C1009, 0x553D1009, 0x553E1009,
+            0x553F1009, 0x55401009, 0x55411009, 0x55421009,
+        },
+        {
+            0x55431009, 0x55441009, 0x55451009, 0x55461009, 0x55471009, 0x55481009,
+            0x55491009, 0x554A1009, 0x554B1009, 0x554C1009, 0x554D1009, 0x554E1009,
+            0x554F1009, 0x55501009, 0x55511009, 0x55521009,
+        },
+        {
+            0x55531009, 0x55541009, 0x55551009, 0x55561009, 0x55571009, 0x55581009,
+            0x55591009, 0x555A1009, 0x555B1009, 0x555C1009, 0x555D1009, 0x555E1009,
+            0x555F1009, 0x55601009, 0x55611009, 0x55621009,
+        },
+        {
+            0x55631009, 0x55641009, 0x55651009, 0x55661009, 0x55671009, 0x55681009,
+            0x55691009, 0x556A1009, 0x556B1009, 0x556C1009, 0x556D1009, 0x556E1009,
+            0x556F1009, 0x55701009, 0x55711009, 0x55721009,
+        },
+        {
+            0x55731009, 0x55741009, 0x55751009, 0x55761009, 0x55771009, 0x55781009,
+            0x55791009, 0x557A1009, 0x557B1009, 0x557C1009, 0x557D1009, 0x557E1009,
+            0x557F1009, 0x55801009, 0x55811009, 0x55821009,
+        },
+        {
+            0x55831009, 0x55841009, 0x55851009, 0x55861009, 0x55871009, 0x55881009,
+            0x55891009, 0x558A1009, 0x558B1009, 0x558C1009, 0x558D1009, 0x558E1009,
+            0x558F1009, 0x55901009, 0x55911009, 0x55921009,
+        },
+        {
+            0x55931009, 0x55941009, 0x55951009, 0x55961009, 0x55971009, 0x55981009,
+            0x55991009, 0x559A1009, 0x559B1009, 0x559C1009, 0x559D1009, 0x559E1009,
+            0x559F1009, 0x55A01009, 0x55A11009, 0x55A21009,
+        },
+        {
+            0x55A31009, 0x55A41009, 0x55A51009, 0x55A61009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x55A71009, 0x55A81009, 0x55A91009, 0x55AA1009, 0x55AB1009, 0x55AC1009,
+            0x55AD1009, 0x55AE1009, 0x55AF1009, 0x55B01009, 0x55B11009, 0x55B21009,
+            0x55B31009, 0x55B41009, 0x55B51009, 0x55B61009,
+        },
+        {
+            0x55B71009, 0x55B81009, 0x55B91009, 0x55BA1009, 0x55BB1009, 0x55BC1009,
+            0x55BD1009, 0x55BE1009, 0x55BF1009, 0x55C01009, 0x55C11009, 0x55C21009,
+            0x55C31009, 0x55C41009, 0x55C51009, 0x55C61009,
+        },
+        {
+            0x55C71009, 0x55C81009, 0x55C91009, 0x55CA1009, 0x55CB1009, 0x55CC1009,
+            0x55CD1009, 0x55CE1009, 0x55CF1009, 0x55D01009, 0x55D11009, 0x55D21009,
+            0x55D31009, 0x55D41009, 0x55D51009, 0x55D61009,
+        },
+        {
+            0x55D71009, 0x55D81009, 0x55D91009, 0x55DA1009, 0x55DB1009, 0x55DC1009,
+            0x55DD1009, 0x55DE1009, 0x55DF1009, 0x55E01009, 0x55E11009, 0x55E21009,
+            0x55E31009, 0x55E41009, 0x55E51009, 0x55E61009,
+        },
+        {
+            0x55E71009, 0x55E81009, 0x55E91009, 0x55EA1009, 0x55EB1009, 0x55EC1009,
+            0x55ED1009, 0x55EE1009, 0x55EF1009, 0x55F01009, 0x55F11009, 0x55F21009,
+            0x55F31009, 0x55F41009, 0x55F51009, 0x55F61009,
+        },
+        {
+            0x55F71009, 0x55F81009, 0x55F91009, 0x55FA1009, 0x55FB1009, 0x55FC1009,
+            0x55FD1009, 0x55FE1009, 0x55FF1009, 0x56001009, 0x56011009, 0x56021009,
+            0x56031009, 0x56041009, 0x56051009, 0x56061009,
+        },
+        {
+            0x56071009, 0x56081009, 0x56091009, 0x560A1009, 0x560B1009, 0x560C1009,
+            0x560D1009, 0x560E1009, 0x560F1009, 0x56101009, 0x56111009, 0x56121009,
+            0x56131009, 0x56141009, 0x56151009, 0x56161009,
+        },
+        {
+            0x56171009, 0x56181009, 0x56191009, 0x561A1009, 0x561B1009, 0x561C1009,
+            0x561D1009, 0x561E1009, 0x561F1009, 0x56201009, 0x56211009, 0x56221009,
+            0x56231009, 0x56241009, 0x56251009, 0x56261009,
+        },
+        {
+            0x56271009, 0x56281009, 0x56291009, 0x562A1009, 0x562B1009, 0x562C1009,
+            0x562D1009, 0x562E1009, 0x562F1009, 0x56301009, 0x56311009, 0x56321009,
+            0x56331009, 0x56341009, 0x56351009, 0x56361009,
+        },
+        {
+            0x56371009, 0x56381009, 0x56391009, 0x563A1009, 0x563B1009, 0x563C1009,
+            0x563D1009, 0x563E1009, 0x563F1009, 0x56401009, 0x56411009, 0x56421009,
+            0x56431009, 0x56441009, 0x56451009, 0x56461009,
+        },
+        {
+            0x56471009, 0x56481009, 0x56491009, 0x564A1009, 0x564B1009, 0x564C1009,
+            0x564D1009, 0x564E1009, 0x564F1009, 0x56501009, 0x56511009, 0x56521009,
+            0x56531009, 0x56541009, 0x56551009, 0x56561009,
+        },
+        {
+            0x56571009, 0x56581009, 0x56591009, 0x565A1009, 0x565B1009, 0x565C1009,
+            0x565D1009, 0x565E1009, 0x565F1009, 0x56601009, 0x56611009, 0x56621009,
+            0x56631009, 0x56641009, 0x56651009, 0x56661009,
+        },
+        {
+            0x56671009, 0x56681009, 0x56691009, 0x566A1009, 0x566B1009, 0x566C1009,
+            0x566D1009, 0x566E1009, 0x566F1009, 0x56701009, 0x56711009, 0x56721009,
+            0x56731009, 0x56741009, 0x56751009, 0x56761009,
+        },
+        {
+            0x56771009, 0x56781009, 0x56791009, 0x567A1009, 0x567B1009, 0x567C1009,
+            0x567D1009, 0x567E1009, 0x567F1009, 0x56801009, 0x56811009, 0x56821009,
+            0x56831009, 0x56841009, 0x56851009, 0x56861009,
+        },
+        {
+            0x56871009, 0x56881009, 0x56891009, 0x568A1009, 0x568B1009, 0x568C1009,
+            0x568D1009, 0x568E1009, 0x568F1009, 0x56901009, 0x56911009, 0x56921009,
+            0x56931009, 0x56941009, 0x56951009, 0x56961009,
+        },
+        {
+            0x56971009, 0x56981009, 0x56991009, 0x569A1009, 0x569B1009, 0x569C1009,
+            0x569D1009, 0x569E1009, 0x569F1009, 0x56A01009, 0x56A11009, 0x56A21009,
+            0x56A31009, 0x56A41009, 0x56A51009, 0x56A61009,
+        },
+        {
+            0x56A71009, 0x56A81009, 0x56A91009, 0x56AA1009, 0x56AB1009, 0x56AC1009,
+            0x56AD1009, 0x56AE1009, 0x56AF1009, 0x56B01009, 0x56B11009, 0x56B21009,
+            0x56B31009, 0x56B41009, 0x56B51009, 0x56B61009,
+        },
+        {
+            0x56B71009, 0x56B81009, 0x56B91009, 0x56BA1009, 0x56BB1009, 0x56BC1009,
+            0x56BD1009, 0x56BE1009, 0x56BF1009, 0x56C01009, 0x56C11009, 0x56C21009,
+            0x56C31009, 0x56C41009, 0x56C51009, 0x56C61009,
+        },
+        {
+            0x56C71009, 0x56C81009, 0x56C91009, 0x56CA1009, 0x56CB1009, 0x56CC1009,
+            0x56CD1009, 0x56CE1009, 0x56CF1009, 0x56D01009, 0x56D11009, 0x56D21009,
+            0x56D31009, 0x56D41009, 0x56D51009, 0x56D61009,
+        },
+        {
+            0x56D71009, 0x56D81009, 0x56D91009, 0x56DA1009, 0x56DB1009, 0x56DC1009,
+            0x56DD1009, 0x56DE1009, 0x56DF1009, 0x56E01009, 0x56E11009, 0x56E21009,
+            0x56E31009, 0x56E41009, 0x56E51009, 0x56E61009,
+        },
+        {
+            0x56E71009, 0x56E81009, 0x56E91009, 0x56EA1009, 0x56EB1009, 0x56EC1009,
+            0x56ED1009, 0x56EE1009, 0x56EF1009, 0x56F01009, 0x56F11009, 0x56F21009,
+            0x56F31009, 0x56F41009, 0x56F51009, 0x56F61009,
+        },
+        {
+            0x56F71009, 0x56F81009, 0x56F91009, 0x56FA1009, 0x56FB1009, 0x56FC1009,
+            0x56FD1009, 0x56FE1009, 0x56FF1009, 0x57001009, 0x57011009, 0x57021009,
+            0x57031009, 0x57041009, 0x57051009, 0x57061009,
+        },
+        {
+            0x57071009, 0x57081009, 0x57091009, 0x570A1009, 0x570B1009, 0x570C1009,
+            0x570D1009, 0x570E1009, 0x570F1009, 0x57101009, 0x57111009, 0x57121009,
+            0x57131009, 0x57141009, 0x57151009, 0x57161009,
+        },
+        {
+            0x57171009, 0x57181009, 0x57191009, 0x571A1009, 0x571B1009, 0x571C1009,
+            0x571D1009, 0x571E1009, 0x571F1009, 0x57201009, 0x57211009, 0x57221009,
+            0x57231009, 0x57241009, 0x57251009, 0x57261009,
+        },
+        {
+            0x57271009, 0x57281009, 0x57291009, 0x572A1009, 0x572B1009, 0x572C1009,
+            0x572D1009, 0x572E1009, 0x572F1009, 0x57301009, 0x57311009, 0x57321009,
+            0x57331009, 0x57341009, 0x57351009, 0x57361009,
+        },
+        {
+            0x57371009, 0x57381009, 0x57391009, 0x573A1009, 0x573B1009, 0x573C1009,
+            0x573D1009, 0x573E1009, 0x573F1009, 0x57401009, 0x57411009, 0x57421009,
+            0x57431009, 0x57441009, 0x57451009, 0x57461009,
+        },
+        {
+            0x57471009, 0x57481009, 0x57491009, 0x574A1009, 0x574B1009, 0x574C1009,
+            0x574D1009, 0x574E1009, 0x574F1009, 0x57501009, 0x57511009, 0x57521009,
+            0x57531009, 0x57541009, 0x57551009, 0x57561009,
+        },
+        {
+            0x57571009, 0x57581009, 0x57591009, 0x575A1009, 0x575B1009, 0x575C1009,
+            0x575D1009, 0x575E1009, 0x575F1009, 0x57601009, 0x57611009, 0x57621009,
+            0x57631009, 0x57641009, 0x57651009, 0x57661009,
+        },
+        {
+            0x57671009, 0x57681009, 0x57691009, 0x576A1009, 0x576B1009, 0x576C1009,
+            0x576D1009, 0x576E1009, 0x576F1009, 0x57701009, 0x57711009, 0x57721009,
+            0x57731009, 0x57741009, 0x57751009, 0x57761009,
+        },
+        {
+            0x57771009, 0x57781009, 0x57791009, 0x577A1009, 0x577B1009, 0x577C1009,
+            0x577D1009, 0x577E1009, 0x577F1009, 0x57801009, 0x57811009, 0x57821009,
+            0x57831009, 0x57841009, 0x57851009, 0x57861009,
+        },
+        {
+            0x57871009, 0x57881009, 0x57891009, 0x578A1009, 0x578B1009, 0x578C1009,
+            0x578D1009, 0x578E1009, 0x578F1009, 0x57901009, 0x57911009, 0x57921009,
+            0x57931009, 0x57941009, 0x57951009, 0x57961009,
+        },
+        {
+            0x57971009, 0x57981009, 0x57991009, 0x579A1009, 0x579B1009, 0x579C1009,
+            0x579D1009, 0x579E1009, 0x579F1009, 0x57A01009, 0x57A11009, 0x57A21009,
+            0x57A31009, 0x57A41009, 0x57A51009, 0x57A61009,
+        },
+        {
+            0x57A71009, 0x57A81009, 0x57A91009, 0x57AA1009, 0x57AB1009, 0x57AC1009,
+            0x57AD1009, 0x57AE1009, 0x57AF1009, 0x57B01009, 0x57B11009, 0x57B21009,
+            0x57B31009, 0x57B41009, 0x57B51009, 0x57B61009,
+        },
+        {
+            0x57B71009, 0x57B81009, 0x57B91009, 0x57BA1009, 0x57BB1009, 0x57BC1009,
+            0x57BD1009, 0x57BE1009, 0x57BF1009, 0x57C01009, 0x57C11009, 0x57C21009,
+            0x57C31009, 0x57C41009, 0x57C51009, 0x57C61009,
+        },
+        {
+            0x57C71009, 0x57C81009, 0x57C91009, 0x57CA1009, 0x57CB1009, 0x57CC1009,
+            0x57CD1009, 0x57CE1009, 0x57CF1009, 0x57D01009, 0x57D11009, 0x57D21009,
+            0x57D31009, 0x57D41009, 0x57D51009, 0x57D61009,
+        },
+        {
+            0x57D71009, 0x57D81009, 0x57D91009, 0x57DA1009, 0x57DB1009, 0x57DC1009,
+            0x57DD1009, 0x57DE1009, 0x57DF1009, 0x57E01009, 0x57E11009, 0x57E21009,
+            0x57E31009, 0x57E41009, 0x57E51009, 0x57E61009,
+        },
+        {
+            0x57E71009, 0x57E81009, 0x57E91009, 0x57EA1009, 0x57EB1009, 0x57EC1009,
+            0x57ED1009, 0x57EE1009, 0x57EF1009, 0x57F01009, 0x57F11009, 0x57F21009,
+            0x57F31009, 0x57F41009, 0x57F51009, 0x57F61009,
+        },
+        {
+            0x57F71009, 0x57F81009, 0x57F91009, 0x57FA1009, 0x57FB1009, 0x57FC1009,
+            0x57FD1009, 0x57FE1009, 0x57FF1009, 0x58001009, 0x58011009, 0x58021009,
+            0x58031009, 0x58041009, 0x58051009, 0x58061009,
+        },
+        {
+            0x58071009, 0x58081009, 0x58091009, 0x580A1009, 0x580B1009, 0x580C1009,
+            0x580D1009, 0x580E1009, 0x580F1009, 0x58101009, 0x58111009, 0x58121009,
+            0x58131009, 0x58141009, 0x58151009, 0x58161009,
+        },
+        {
+            0x58171009, 0x58181009, 0x58191009, 0x581A1009, 0x581B1009, 0x581C1009,
+            0x581D1009, 0x581E1009, 0x581F1009, 0x58201009, 0x58211009, 0x58221009,
+            0x58231009, 0x58241009, 0x58251009, 0x58261009,
+        },
+        {
+            0x58271009, 0x58281009, 0x58291009, 0x582A1009, 0x582B1009, 0x582C1009,
+            0x582D1009, 0x582E1009, 0x582F1009, 0x58301009, 0x58311009, 0x58321009,
+            0x58331009, 0x58341009, 0x58351009, 0x58361009,
+        },
+        {
+            0x58371009, 0x58381009, 0x58391009, 0x583A1009, 0x583B1009, 0x583C1009,
+            0x583D1009, 0x583E1009, 0x583F1009, 0x58401009, 0x58411009, 0x58421009,
+            0x58431009, 0x58441009, 0x58451009, 0x58461009,
+        },
+        {
+            0x58471009, 0x58481009, 0x58491009, 0x584A1009, 0x584B1009, 0x584C1009,
+            0x584D1009, 0x584E1009, 0x584F1009, 0x58501009, 0x58511009, 0x58521009,
+            0x58531009, 0x58541009, 0x58551009, 0x58561009,
+        },
+        {
+            0x58571009, 0x58581009, 0x58591009, 0x585A1009, 0x585B1009, 0x585C1009,
+            0x585D1009, 0x585E1009, 0x585F1009, 0x58601009, 0x58611009, 0x58621009,
+            0x58631009, 0x58641009, 0x58651009, 0x58661009,
+        },
+        {
+            0x58671009, 0x58681009, 0x58691009, 0x586A1009, 0x586B1009, 0x586C1009,
+            0x586D1009, 0x586E1009, 0x586F1009, 0x58701009, 0x58711009, 0x58721009,
+            0x58731009, 0x58741009, 0x58751009, 0x58761009,
+        },
+        {
+            0x58771009, 0x58781009, 0x58791009, 0x587A1009, 0x587B1009, 0x587C1009,
+            0x587D1009, 0x587E1009, 0x587F1009, 0x58801009, 0x58811009, 0x58821009,
+            0x58831009, 0x58841009, 0x58851009, 0x58861009,
+        },
+        {
+            0x58871009, 0x58881009, 0x58891009, 0x588A1009, 0x588B1009, 0x588C1009,
+            0x588D1009, 0x588E1009, 0x588F1009, 0x58901009, 0x58911009, 0x58921009,
+            0x58931009, 0x58941009, 0x58951009, 0x58961009,
+        },
+        {
+            0x58971009, 0x58981009, 0x58991009, 0x589A1009, 0x589B1009, 0x589C1009,
+            0x589D1009, 0x589E1009, 0x589F1009, 0x58A01009, 0x58A11009, 0x58A21009,
+            0x58A31009, 0x58A41009, 0x58A51009, 0x58A61009,
+        },
+        {
+            0x58A71009, 0x58A81009, 0x58A91009, 0x58AA1009, 0x58AB1009, 0x58AC1009,
+            0x58AD1009, 0x58AE1009, 0x58AF1009, 0x58B01009, 0x58B11009, 0x58B21009,
+            0x58B31009, 0x58B41009, 0x58B51009, 0x58B61009,
+        },
+        {
+            0x58B71009, 0x58B81009, 0x58B91009, 0x58BA1009, 0x58BB1009, 0x58BC1009,
+            0x58BD1009, 0x58BE1009, 0x58BF1009, 0x58C01009, 0x58C11009, 0x58C21009,
+            0x58C31009, 0x58C41009, 0x58C51009, 0x58C61009,
+        },
+        {
+            0x58C71009, 0x58C81009, 0x58C91009, 0x58CA1009, 0x58CB1009, 0x58CC1009,
+            0x58CD1009, 0x58CE1009, 0x58CF1009, 0x58D01009, 0x58D11009, 0x58D21009,
+            0x58D31009, 0x58D41009, 0x58D51009, 0x58D61009,
+        },
+        {
+            0x58D71009, 0x58D81009, 0x58D91009, 0x58DA1009, 0x58DB1009, 0x58DC1009,
+            0x58DD1009, 0x58DE1009, 0x58DF1009, 0x58E01009, 0x58E11009, 0x58E21009,
+            0x58E31009, 0x58E41009, 0x58E51009, 0x58E61009,
+        },
+        {
+            0x58E71009, 0x58E81009, 0x58E91009, 0x58EA1009, 0x58EB1009, 0x58EC1009,
+            0x58ED1009, 0x58EE1009, 0x58EF1009, 0x58F01009, 0x58F11009, 0x58F21009,
+            0x58F31009, 0x58F41009, 0x58F51009, 0x58F61009,
+        },
+        {
+            0x58F71009, 0x58F81009, 0x58F91009, 0x58FA1009, 0x58FB1009, 0x58FC1009,
+            0x58FD1009, 0x58FE1009, 0x58FF1009, 0x59001009, 0x59011009, 0x59021009,
+            0x59031009, 0x59041009, 0x59051009, 0x59061009,
+        },
+        {
+            0x59071009, 0x59081009, 0x59091009, 0x590A1009, 0x590B1009, 0x590C1009,
+            0x590D1009, 0x590E1009, 0x590F1009, 0x59101009, 0x59111009, 0x59121009,
+            0x59131009, 0x59141009, 0x59151009, 0x59161009,
+        },
+        {
+            0x59171009, 0x59181009, 0x59191009, 0x591A1009, 0x591B1009, 0x591C1009,
+            0x591D1009, 0x591E1009, 0x591F1009, 0x59201009, 0x59211009, 0x59221009,
+            0x59231009, 0x59241009, 0x59251009, 0x59261009,
+        },
+        {
+            0x59271009, 0x59281009, 0x59291009, 0x592A1009, 0x592B1009, 0x592C1009,
+            0x592D1009, 0x592E1009, 0x592F1009, 0x59301009, 0x59311009, 0x59321009,
+            0x59331009, 0x59341009, 0x59351009, 0x59361009,
+        },
+        {
+            0x59371009, 0x59381009, 0x59391009, 0x593A1009, 0x593B1009, 0x593C1009,
+            0x593D1009, 0x593E1009, 0x593F1009, 0x59401009, 0x59411009, 0x59421009,
+            0x59431009, 0x59441009, 0x59451009, 0x59461009,
+        },
+        {
+            0x59471009, 0x59481009, 0x59491009, 0x594A1009, 0x594B1009, 0x594C1009,
+            0x594D1009, 0x594E1009, 0x594F1009, 0x59501009, 0x59511009, 0x59521009,
+            0x59531009, 0x59541009, 0x59551009, 0x59561009,
+        },
+        {
+            0x59571009, 0x59581009, 0x59591009, 0x595A1009, 0x595B1009, 0x595C1009,
+            0x595D1009, 0x595E1009, 0x595F1009, 0x59601009, 0x59611009, 0x59621009,
+            0x59631009, 0x59641009, 0x59651009, 0x59661009,
+        },
+        {
+            0x59671009, 0x59681009, 0x59691009, 0x596A1009, 0x596B1009, 0x596C1009,
+            0x596D1009, 0x596E1009, 0x596F1009, 0x59701009, 0x59711009, 0x59721009,
+            0x59731009, 0x59741009, 0x59751009, 0x59761009,
+        },
+        {
+            0x59771009, 0x59781009, 0x59791009, 0x597A1009, 0x597B1009, 0x597C1009,
+            0x597D1009, 0x597E1009, 0x597F1009, 0x59801009, 0x59811009, 0x59821009,
+            0x59831009, 0x59841009, 0x59851009, 0x59861009,
+        },
+        {
+            0x59871009, 0x59881009, 0x59891009, 0x598A1009, 0x598B1009, 0x598C1009,
+            0x598D1009, 0x598E1009, 0x598F1009, 0x59901009, 0x59911009, 0x59921009,
+            0x59931009, 0x59941009, 0x59951009, 0x59961009,
+        },
+        {
+            0x59971009, 0x59981009, 0x59991009, 0x599A1009, 0x599B1009, 0x599C1009,
+            0x599D1009, 0x599E1009, 0x599F1009, 0x59A01009, 0x59A11009, 0x59A21009,
+            0x59A31009, 0x59A41009, 0x59A51009, 0x59A61009,
+        },
+        {
+            0x59A71009, 0x59A81009, 0x59A91009, 0x59AA1009, 0x59AB1009, 0x59AC1009,
+            0x59AD1009, 0x59AE1009, 0x59AF1009, 0x59B01009, 0x59B11009, 0x59B21009,
+            0x59B31009, 0x59B41009, 0x59B51009, 0x59B61009,
+        },
+        {
+            0x59B71009, 0x59B81009, 0x59B91009, 0x59BA1009, 0x59BB1009, 0x59BC1009,
+            0x59BD1009, 0x59BE1009, 0x59BF1009, 0x59C01009, 0x59C11009, 0x59C21009,
+            0x59C31009, 0x59C41009, 0x59C51009, 0x59C61009,
+        },
+        {
+            0x59C71009, 0x59C81009, 0x59C91009, 0x59CA1009, 0x59CB1009, 0x59CC1009,
+            0x59CD1009, 0x59CE1009, 0x59CF1009, 0x59D01009, 0x59D11009, 0x59D21009,
+            0x59D31009, 0x59D41009, 0x59D51009, 0x00000000,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x59F11009, 0x59F21009, 0x59F31009, 0x59F41009, 0x59F51009, 0x59F61009,
+            0x59F71009, 0x59F81009, 0x59F91009, 0x59FA1009, 0x59FB1009, 0x59FC1009,
+            0x59FD1009, 0x59FE1009, 0x59FF1009, 0x5A001009,
+        },
+        {
+            0x5A011009, 0x5A021009, 0x5A031009, 0x5A041009, 0x5A051009, 0x5A061009,
+            0x5A071009, 0x5A081009, 0x5A091009, 0x5A0A1009, 0x5A0B1009, 0x5A0C1009,
+            0x5A0D1009, 0x5A0E1009, 0x5A0F1009, 0x5A101009,
+        },
+        {
+            0x5A111009, 0x5A121009, 0x5A131009, 0x5A141009, 0x5A151009, 0x5A161009,
+            0x5A171009, 0x5A181009, 0x5A191009, 0x5A1A1009, 0x5A1B1009, 0x5A1C1009,
+            0x5A1D1009, 0x5A1E1009, 0x5A1F1009, 0x5A201009,
+        },
+        {
+            0x5A211009, 0x5A221009, 0x5A231009, 0x5A241009, 0x5A251009, 0x5A261009,
+            0x5A271009, 0x5A281009, 0x5A291009, 0x5A2A1009, 0x5A2B1009, 0x5A2C1009,
+            0x5A2D1009, 0x5A2E1009, 0x5A2F1009, 0x5A301009,
+        },
+        {
+            0x5A311009, 0x5A321009, 0x5A331009, 0x5A341009, 0x5A351009, 0x5A361009,
+            0x5A371009, 0x5A381009, 0x5A391009, 0x5A3A1009, 0x5A3B1009, 0x5A3C1009,
+            0x5A3D1009, 0x5A3E1009, 0x5A3F1009, 0x5A401009,
+        },
+        {
+            0x5A411009, 0x5A421009, 0x5A431009, 0x5A441009, 0x5A451009, 0x5A461009,
+            0x5A471009, 0x5A481009, 0x5A491009, 0x5A4A1009, 0x5A4B1009, 0x5A4C1009,
+            0x5A4D1009, 0x5A4E1009, 0x5A4F1009, 0x5A501009,
+        },
+        {
+            0x5A511009, 0x5A521009, 0x5A531009, 0x5A541009, 0x5A551009, 0x5A561009,
+            0x5A571009, 0x5A581009, 0x5A591009, 0x5A5A1009, 0x5A5B1009, 0x5A5C1009,
+            0x5A5D1009, 0x5A5E1009, 0x5A5F1009, 0x5A601009,
+        },
+        {
+            0x5A611009, 0x5A621009, 0x5A631009, 0x5A641009, 0x5A651009, 0x5A661009,
+            0x5A671009, 0x5A681009, 0x5A691009, 0x5A6A1009, 0x5A6B1009, 0x5A6C1009,
+            0x5A6D1009, 0x5A6E1009, 0x5A6F1009, 0x5A701009,
+        },
+        {
+            0x5A711009, 0x5A721009, 0x5A731009, 0x5A741009, 0x5A751009, 0x5A761009,
+            0x5A771009, 0x5A781009, 0x5A791009, 0x5A7A1009, 0x5A7B1009, 0x5A7C1009,
+            0x5A7D1009, 0x5A7E1009, 0x5A7F1009, 0x5A801009,
+        },
+        {
+            0x5A811009, 0x5A821009, 0x5A831009, 0x5A841009, 0x5A851009, 0x5A861009,
+            0x5A871009, 0x5A881009, 0x5A891009, 0x5A8A1009, 0x5A8B1009, 0x5A8C1009,
+            0x5A8D1009, 0x5A8E1009, 0x5A8F1009, 0x5A901009,
+        },
+        {
+            0x5A911009, 0x5A921009, 0x5A931009, 0x5A941009, 0x5A951009, 0x5A961009,
+            0x5A971009, 0x5A981009, 0x5A991009, 0x5A9A1009, 0x5A9B1009, 0x5A9C1009,
+            0x5A9D1009, 0x5A9E1009, 0x5A9F1009, 0x5AA01009,
+        },
+        {
+            0x5AA11009, 0x5AA21009, 0x5AA31009, 0x5AA41009, 0x5AA51009, 0x5AA61009,
+            0x5AA71009, 0x5AA81009, 0x5AA91009, 0x5AAA1009, 0x5AAB1009, 0x5AAC1009,
+            0x5AAD1009, 0x5AAE1009, 0x5AAF1009, 0x5AB01009,
+        },
+        {
+            0x5AB11009, 0x5AB21009, 0x5AB31009, 0x5AB41009, 0x5AB51009, 0x5AB61009,
+            0x5AB71009, 0x5AB81009, 0x5AB91009, 0x5ABA1009, 0x5ABB1009, 0x5ABC1009,
+            0x5ABD1009, 0x5ABE1009, 0x5ABF1009, 0x5AC01009,
+        },
+        {
+            0x5AC11009, 0x5AC21009, 0x5AC31009, 0x5AC41009, 0x5AC51009, 0x5AC61009,
+            0x5AC71009, 0x5AC81009, 0x5AC91009, 0x5ACA1009, 0x5ACB1009, 0x5ACC1009,
+            0x5ACD1009, 0x5ACE1009, 0x5ACF1009, 0x5AD01009,
+        },
+        {
+            0x5AD11009, 0x5AD21009, 0x5AD31009, 0x5AD41009, 0x5AD51009, 0x5AD61009,
+            0x5AD71009, 0x5AD81009, 0x5AD91009, 0x5ADA1009, 0x5ADB1009, 0x5ADC1009,
+            0x5ADD1009, 0x5ADE1009, 0x5ADF1009, 0x5AE01009,
+        },
+        {
+            0x5AE11009, 0x5AE21009, 0x5AE31009, 0x5AE41009, 0x5AE51009, 0x5AE61009,
+            0x5AE71009, 0x5AE81009, 0x5AE91009, 0x5AEA1009, 0x5AEB1009, 0x5AEC1009,
+            0x5AED1009, 0x5AEE1009, 0x5AEF1009, 0x5AF01009,
+        },
+        {
+            0x5AF11009, 0x5AF21009, 0x5AF31009, 0x5AF41009, 0x5AF51009, 0x5AF61009,
+            0x5AF71009, 0x5AF81009, 0x5AF91009, 0x5AFA1009, 0x5AFB1009, 0x5AFC1009,
+            0x5AFD1009, 0x5AFE1009, 0x5AFF1009, 0x5B001009,
+        },
+        {
+            0x5B011009, 0x5B021009, 0x5B031009, 0x5B041009, 0x5B051009, 0x5B061009,
+            0x5B071009, 0x5B081009, 0x5B091009, 0x5B0A1009, 0x5B0B1009, 0x5B0C1009,
+            0x5B0D1009, 0x5B0E1009, 0x5B0F1009, 0x5B101009,
+        },
+        {
+            0x5B111009, 0x5B121009, 0x5B131009, 0x5B141009, 0x5B151009, 0x5B161009,
+            0x5B171009, 0x5B181009, 0x5B191009, 0x5B1A1009, 0x5B1B1009, 0x5B1C1009,
+            0x5B1D1009, 0x5B1E1009, 0x5B1F1009, 0x5B201009,
+        },
+        {
+            0x5B211009, 0x5B221009, 0x5B231009, 0x5B241009, 0x5B251009, 0x5B261009,
+            0x5B271009, 0x5B281009, 0x5B291009, 0x5B2A1009, 0x5B2B1009, 0x5B2C1009,
+            0x5B2D1009, 0x5B2E1009, 0x5B2F1009, 0x5B301009,
+        },
+        {
+            0x5B311009, 0x5B321009, 0x5B331009, 0x5B341009, 0x5B351009, 0x5B361009,
+            0x5B371009, 0x5B381009, 0x5B391009, 0x5B3A1009, 0x5B3B1009, 0x5B3C1009,
+            0x5B3D1009, 0x5B3E1009, 0x5B3F1009, 0x5B401009,
+        },
+        {
+            0x5B411009, 0x5B421009, 0x5B431009, 0x5B441009, 0x5B451009, 0x5B461009,
+            0x5B471009, 0x5B481009, 0x5B491009, 0x5B4A1009, 0x5B4B1009, 0x5B4C1009,
+            0x5B4D1009, 0x5B4E1009, 0x5B4F1009, 0x5B501009,
+        },
+        {
+            0x5B511009, 0x5B521009, 0x5B531009, 0x5B541009, 0x5B551009, 0x5B561009,
+            0x5B571009, 0x5B581009, 0x5B591009, 0x5B5A1009, 0x5B5B1009, 0x5B5C1009,
+            0x5B5D1009, 0x5B5E1009, 0x5B5F1009, 0x5B601009,
+        },
+        {
+            0x5B611009, 0x5B621009, 0x5B631009, 0x5B641009, 0x5B651009, 0x5B661009,
+            0x5B671009, 0x5B681009, 0x5B691009, 0x5B6A1009, 0x5B6B1009, 0x5B6C1009,
+            0x5B6D1009, 0x5B6E1009, 0x5B6F1009, 0x5B701009,
+        },
+        {
+            0x5B711009, 0x5B721009, 0x5B731009, 0x5B741009, 0x5B751009, 0x5B761009,
+            0x5B771009, 0x5B781009, 0x5B791009, 0x5B7A1009, 0x5B7B1009, 0x5B7C1009,
+            0x5B7D1009, 0x5B7E1009, 0x5B7F1009, 0x5B801009,
+        },
+        {
+            0x5B811009, 0x5B821009, 0x5B831009, 0x5B841009, 0x5B851009, 0x5B861009,
+            0x5B871009, 0x5B881009, 0x5B891009, 0x5B8A1009, 0x5B8B1009, 0x5B8C1009,
+            0x5B8D1009, 0x5B8E1009, 0x5B8F1009, 0x5B901009,
+        },
+        {
+            0x5B911009, 0x5B921009, 0x5B931009, 0x5B941009, 0x5B951009, 0x5B961009,
+            0x5B971009, 0x5B981009, 0x5B991009, 0x5B9A1009, 0x5B9B1009, 0x5B9C1009,
+            0x5B9D1009, 0x5B9E1009, 0x5B9F1009, 0x5BA01009,
+        },
+        {
+            0x5BA11009, 0x5BA21009, 0x5BA31009, 0x5BA41009, 0x5BA51009, 0x5BA61009,
+            0x5BA71009, 0x5BA81009, 0x5BA91009, 0x5BAA1009, 0x5BAB1009, 0x5BAC1009,
+            0x5BAD1009, 0x5BAE1009, 0x5BAF1009, 0x5BB01009,
+        },
+        {
+            0x5BB11009, 0x5BB21009, 0x5BB31009, 0x5BB41009, 0x5BB51009, 0x5BB61009,
+            0x5BB71009, 0x5BB81009, 0x5BB91009, 0x5BBA1009, 0x5BBB1009, 0x5BBC1009,
+            0x5BBD1009, 0x5BBE1009, 0x5BBF1009, 0x5BC01009,
+        },
+        {
+            0x5BC11009, 0x5BC21009, 0x5BC31009, 0x5BC41009, 0x5BC51009, 0x5BC61009,
+            0x5BC71009, 0x5BC81009, 0x5BC91009, 0x5BCA1009, 0x5BCB1009, 0x5BCC1009,
+            0x5BCD1009, 0x5BCE1009, 0x5BCF1009, 0x5BD01009,
+        },
+        {
+            0x5BD11009, 0x5BD21009, 0x5BD31009, 0x5BD41009, 0x5BD51009, 0x5BD61009,
+            0x5BD71009, 0x5BD81009, 0x5BD91009, 0x5BDA1009, 0x5BDB1009, 0x5BDC1009,
+            0x5BDD1009, 0x5BDE1009, 0x5BDF1009, 0x5BE01009,
+        },
+        {
+            0x5BE11009, 0x5BE21009, 0x5BE31009, 0x5BE41009, 0x5BE51009, 0x5BE61009,
+            0x5BE71009, 0x5BE81009, 0x5BE91009, 0x5BEA1009, 0x5BEB1009, 0x5BEC1009,
+            0x5BED1009, 0x5BEE1009, 0x5BEF1009, 0x5BF01009,
+        },
+        {
+            0x5BF11009, 0x5BF21009, 0x5BF31009, 0x5BF41009, 0x5BF51009, 0x5BF61009,
+            0x5BF71009, 0x5BF81009, 0x5BF91009, 0x5BFA1009, 0x5BFB1009, 0x5BFC1009,
+            0x5BFD1009, 0x5BFE1009, 0x5BFF1009, 0x5C001009,
+        },
+        {
+            0x5C011009, 0x5C021009, 0x5C031009, 0x5C041009, 0x5C051009, 0x5C061009,
+            0x5C071009, 0x5C081009, 0x5C091009, 0x5C0A1009, 0x5C0B1009, 0x5C0C1009,
+            0x5C0D1009, 0x5C0E1009, 0x5C0F1009, 0x5C101009,
+        },
+        {
+            0x5C111009, 0x5C121009, 0x5C131009, 0x5C141009, 0x5C151009, 0x5C161009,
+            0x5C171009, 0x5C181009, 0x5C191009, 0x5C1A1009, 0x5C1B1009, 0x5C1C1009,
+            0x5C1D1009, 0x5C1E1009, 0x5C1F1009, 0x5C201009,
+        },
+        {
+            0x5C211009, 0x5C221009, 0x5C231009, 0x5C241009, 0x5C251009, 0x5C261009,
+            0x5C271009, 0x5C281009, 0x5C291009, 0x5C2A1009, 0x5C2B1009, 0x5C2C1009,
+            0x5C2D1009, 0x5C2E1009, 0x5C2F1009, 0x5C301009,
+        },
+        {
+            0x5C311009, 0x5C321009, 0x5C331009, 0x5C341009, 0x5C351009, 0x5C361009,
+            0x5C371009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x3E161009, 0x3E171009, 0x3E181009, 0x3E191009, 0x3E1A1009, 0x3E1B1009,
+            0x3E1C1009, 0x3E1D1009, 0x3E1E1009, 0x3E1F1009, 0x3E201009, 0x3E211009,
+            0x3E221009, 0x3E231009, 0x3E241009, 0x3E251009,
+        },
+        {
+            0x3E261009, 0x3E271009, 0x3E281009, 0x3E291009, 0x3E2A1009, 0x3E2B1009,
+            0x3E2C1009, 0x3E2D1009, 0x3E2E1009, 0x3E2F1009, 0x3E301009, 0x3E311009,
+            0x3E321009, 0x3E331009, 0x3E341009, 0x3E351009,
+        },
+        {
+            0x3E361009, 0x3E371009, 0x3E381009, 0x3E391009, 0x3E3A1009, 0x3E3B1009,
+            0x3E3C1009, 0x3E3D1009, 0x3E3E1009, 0x3E3F1009, 0x3E401009, 0x3E411009,
+            0x3E421009, 0x3E431009, 0x3E441009, 0x3E451009,
+        },
+        {
+            0x3E461009, 0x3E471009, 0x3E481009, 0x3E491009, 0x3E4A1009, 0x3E4B1009,
+            0x3E4C1009, 0x3E4D1009, 0x3E4E1009, 0x3E4F1009, 0x3E501009, 0x3E511009,
+            0x3E521009, 0x3E531009, 0x3E541009, 0x3E551009,
+        },
+        {
+            0x3E561009, 0x3E571009, 0x3E581009, 0x3E591009, 0x3E5A1009, 0x3E5B1009,
+            0x3E5C1009, 0x3E5D1009, 0x3E5E1009, 0x3E5F1009, 0x3E601009, 0x3E611009,
+            0x3E621009, 0x3E631009, 0x3E641009, 0x3E651009,
+        },
+        {
+            0x3E661009, 0x3E671009, 0x3E681009, 0x3E691009, 0x3E6A1009, 0x3E6B1009,
+            0x3E6C1009, 0x3E6D1009, 0x3E6E1009, 0x3E6F1009, 0x3E701009, 0x3E711009,
+            0x3E721009, 0x3E731009, 0x3E741009, 0x3E751009,
+        },
+        {
+            0x3E761009, 0x3E771009, 0x3E781009, 0x3E791009, 0x3E7A1009, 0x3E7B1009,
+            0x3E7C1009, 0x3E7D1009, 0x3E7E1009, 0x3E7F1009, 0x3E801009, 0x3E811009,
+            0x3E821009, 0x3E831009, 0x3E841009, 0x3E851009,
+        },
+        {
+            0x3E861009, 0x3E871009, 0x3E881009, 0x3E891009, 0x3E8A1009, 0x3E8B1009,
+            0x3E8C1009, 0x3E8D1009, 0x3E8E1009, 0x3E8F1009, 0x3E901009, 0x3E911009,
+            0x3E921009, 0x3E931009, 0x3E941009, 0x3E951009,
+        },
+        {
+            0x3E961009, 0x3E971009, 0x3E981009, 0x3E991009, 0x3E9A1009, 0x3E9B1009,
+            0x3E9C1009, 0x3E9D1009, 0x3E9E1009, 0x3E9F1009, 0x3EA01009, 0x3EA11009,
+            0x3EA21009, 0x3EA31009, 0x3EA41009, 0x3EA51009,
+        },
+        {
+            0x3EA61009, 0x3EA71009, 0x3EA81009, 0x3EA91009, 0x3EAA1009, 0x3EAB1009,
+            0x3EAC1009, 0x3EAD1009, 0x3EAE1009, 0x3EAF1009, 0x3EB01009, 0x3EB11009,
+            0x3EB21009, 0x3EB31009, 0x3EB41009, 0x3EB51009,
+        },
+        {
+            0x3EB61009, 0x3EB71009, 0x3EB81009, 0x3EB91009, 0x3EBA1009, 0x3EBB1009,
+            0x3EBC1009, 0x3EBD1009, 0x3EBE1009, 0x3EBF1009, 0x3EC01009, 0x3EC11009,
+            0x3EC21009, 0x3EC31009, 0x3EC41009, 0x3EC51009,
+        },
+        {
+            0x3EC61009, 0x3EC71009, 0x3EC81009, 0x3EC91009, 0x3ECA1009, 0x3ECB1009,
+            0x3ECC1009, 0x3ECD1009, 0x3ECE1009, 0x3ECF1009, 0x3ED01009, 0x3ED11009,
+            0x3ED21009, 0x3ED31009, 0x3ED41009, 0x3ED51009,
+        },
+        {
+            0x3ED61009, 0x3ED71009, 0x3ED81009, 0x3ED91009, 0x3EDA1009, 0x3EDB1009,
+            0x3EDC1009, 0x3EDD1009, 0x3EDE1009, 0x3EDF1009, 0x3EE01009, 0x3EE11009,
+            0x3EE21009, 0x3EE31009, 0x3EE41009, 0x3EE51009,
+        },
+        {
+            0x3EE61009, 0x3EE71009, 0x3EE81009, 0x3EE91009, 0x3EEA1009, 0x3EEB1009,
+            0x3EEC1009, 0x3EED1009, 0x3EEE1009, 0x3EEF1009, 0x3EF01009, 0x3EF11009,
+            0x3EF21009, 0x3EF31009, 0x3EF41009, 0x3EF51009,
+        },
+        {
+            0x3EF61009, 0x3EF71009, 0x3EF81009, 0x3EF91009, 0x3EFA1009, 0x3EFB1009,
+            0x3EFC1009, 0x3EFD1009, 0x3EFE1009, 0x3EFF1009, 0x3F001009, 0x3F011009,
+            0x3F021009, 0x3F031009, 0x3F041009, 0x3F051009,
+        },
+        {
+            0x3F061009, 0x3F071009, 0x3F081009, 0x3F091009, 0x3F0A1009, 0x3F0B1009,
+            0x3F0C1009, 0x3F0D1009, 0x3F0E1009, 0x3F0F1009, 0x3F101009, 0x3F111009,
+            0x3F121009, 0x3F131009, 0x3F141009, 0x3F151009,
+        },
+        {
+            0x3F161009, 0x3F171009, 0x3F181009, 0x3F191009, 0x3F1A1009, 0x3F1B1009,
+            0x3F1C1009, 0x3F1D1009, 0x3F1E1009, 0x3F1F1009, 0x3F201009, 0x3F211009,
+            0x3F221009, 0x3F231009, 0x3F241009, 0x3F251009,
+        },
+        {
+            0x3F261009, 0x3F271009, 0x3F281009, 0x3F291009, 0x3F2A1009, 0x3F2B1009,
+            0x3F2C1009, 0x3F2D1009, 0x3F2E1009, 0x3F2F1009, 0x3F301009, 0x3F311009,
+            0x3F321009, 0x3F331009, 0x3F341009, 0x3F351009,
+        },
+        {
+            0x3F361009, 0x3F371009, 0x3F381009, 0x3F391009, 0x3F3A1009, 0x3F3B1009,
+            0x3F3C1009, 0x3F3D1009, 0x3F3E1009, 0x3F3F1009, 0x3F401009, 0x3F411009,
+            0x3F421009, 0x3F431009, 0x3F441009, 0x3F451009,
+        },
+        {
+            0x3F461009, 0x3F471009, 0x3F481009, 0x3F491009, 0x3F4A1009, 0x3F4B1009,
+            0x3F4C1009, 0x3F4D1009, 0x3F4E1009, 0x3F4F1009, 0x3F501009, 0x3F511009,
+            0x3F521009, 0x3F531009, 0x3F541009, 0x3F551009,
+        },
+        {
+            0x3F561009, 0x3F571009, 0x3F581009, 0x3F591009, 0x3F5A1009, 0x3F5B1009,
+            0x3F5C1009, 0x3F5D1009, 0x3F5E1009, 0x3F5F1009, 0x3F601009, 0x3F611009,
+            0x3F621009, 0x3F631009, 0x3F641009, 0x3F651009,
+        },
+        {
+            0x3F661009, 0x3F671009, 0x3F681009, 0x3F691009, 0x3F6A1009, 0x3F6B1009,
+            0x3F6C1009, 0x3F6D1009, 0x3F6E1009, 0x3F6F1009, 0x3F701009, 0x3F711009,
+            0x3F721009, 0x3F731009, 0x3F741009, 0x3F751009,
+        },
+        {
+            0x3F761009, 0x3F771009, 0x3F781009, 0x3F791009, 0x3F7A1009, 0x3F7B1009,
+            0x3F7C1009, 0x3F7D1009, 0x3F7E1009, 0x3F7F1009, 0x3F801009, 0x3F811009,
+            0x3F821009, 0x3F831009, 0x3F841009, 0x3F851009,
+        },
+        {
+            0x3F861009, 0x3F871009, 0x3F881009, 0x3F891009, 0x3F8A1009, 0x3F8B1009,
+            0x3F8C1009, 0x3F8D1009, 0x3F8E1009, 0x3F8F1009, 0x3F901009, 0x3F911009,
+            0x3F921009, 0x3F931009, 0x3F941009, 0x3F951009,
+        },
+        {
+            0x3F961009, 0x3F971009, 0x3F981009, 0x3F991009, 0x3F9A1009, 0x3F9B1009,
+            0x3F9C1009, 0x3F9D1009, 0x3F9E1009, 0x3F9F1009, 0x3FA01009, 0x3FA11009,
+            0x3FA21009, 0x3FA31009, 0x3FA41009, 0x3FA51009,
+        },
+        {
+            0x3FA61009, 0x3FA71009, 0x3FA81009, 0x3FA91009, 0x3FAA1009, 0x3FAB1009,
+            0x3FAC1009, 0x3FAD1009, 0x3FAE1009, 0x3FAF1009, 0x3FB01009, 0x3FB11009,
+            0x3FB21009, 0x3FB31009, 0x3FB41009, 0x3FB51009,
+        },
+        {
+            0x3FB61009, 0x3FB71009, 0x3FB81009, 0x3FB91009, 0x3FBA1009, 0x3FBB1009,
+            0x3FBC1009, 0x3FBD1009, 0x3FBE1009, 0x3FBF1009, 0x3FC01009, 0x3FC11009,
+            0x3FC21009, 0x3FC31009, 0x3FC41009, 0x3FC51009,
+        },
+        {
+            0x3FC61009, 0x3FC71009, 0x3FC81009, 0x3FC91009, 0x3FCA1009, 0x3FCB1009,
+            0x3FCC1009, 0x3FCD1009, 0x3FCE1009, 0x3FCF1009, 0x3FD01009, 0x3FD11009,
+            0x3FD21009, 0x3FD31009, 0x3FD41009, 0x3FD51009,
+        },
+        {
+            0x3FD61009, 0x3FD71009, 0x3FD81009, 0x3FD91009, 0x3FDA1009, 0x3FDB1009,
+            0x3FDC1009, 0x3FDD1009, 0x3FDE1009, 0x3FDF1009, 0x3FE01009, 0x3FE11009,
+            0x3FE21009, 0x3FE31009, 0x3FE41009, 0x3FE51009,
+        },
+        {
+            0x3FE61009, 0x3FE71009, 0x3FE81009, 0x3FE91009, 0x3FEA1009, 0x3FEB1009,
+            0x3FEC1009, 0x3FED1009, 0x3FEE1009, 0x3FEF1009, 0x3FF01009, 0x3FF11009,
+            0x3FF21009, 0x3FF31009, 0x3FF41009, 0x3FF51009,
+        },
+        {
+            0x3FF61009, 0x3FF71009, 0x3FF81009, 0x3FF91009, 0x3FFA1009, 0x3FFB1009,
+            0x3FFC1009, 0x3FFD1009, 0x3FFE1009, 0x3FFF1009, 0x40001009, 0x40011009,
+            0x40021009, 0x40031009, 0x40041009, 0x40051009,
+        },
+        {
+            0x40061009, 0x40071009, 0x40081009, 0x40091009, 0x400A1009, 0x400B1009,
+            0x400C1009, 0x400D1009, 0x400E1009, 0x400F1009, 0x40101009, 0x40111009,
+            0x40121009, 0x40131009, 0x40141009, 0x40151009,
+        },
+        {
+            0x40161009, 0x40171009, 0x40181009, 0x40191009, 0x401A1009, 0x401B1009,
+            0x401C1009, 0x401D1009, 0x401E1009, 0x401F1009, 0x40201009, 0x40211009,
+            0x40221009, 0x40231009, 0x40241009, 0x40251009,
+        },
+        {
+            0x40261009, 0x40271009, 0x40281009, 0x40291009, 0x402A1009, 0x402B1009,
+            0x402C1009, 0x402D1009, 0x402E1009, 0x402F1009, 0x40301009, 0x40311009,
+            0x40321009, 0x40331009, 0x40341009, 0x40351009,
+        },
+        {
+            0x40361009, 0x40371009, 0x40381009, 0x40391009, 0x403A1009, 0x403B1009,
+            0x403C1009, 0x403D1009, 0x403E1009, 0x403F1009, 0x40401009, 0x40411009,
+            0x40421009, 0x40431009, 0x40441009, 0x40451009,
+        },
+        {
+            0x40461009, 0x40471009, 0x40481009, 0x40491009, 0x404A1009, 0x404B1009,
+            0x404C1009, 0x404D1009, 0x404E1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4CDD1009, 0x4CDE1009, 0x4CDF1009, 0x4CE01009, 0x4CE11009, 0x4CE21009,
+            0x4CE31009, 0x4CE41009, 0x4CE51009, 0x4CE61009, 0x4CE71009, 0x4CE81009,
+            0x4CE91009, 0x4CEA1009, 0x4CEB1009, 0x4CEC1009,
+        },
+        {
+            0x4CED1009, 0x4CEE1009, 0x4CEF1009, 0x4CF01009, 0x4CF11009, 0x4CF21009,
+            0x4CF31009, 0x4CF41009, 0x4CF51009, 0x4CF61009, 0x4CF71009, 0x4CF81009,
+            0x4CF91009, 0x4CFA1009, 0x4CFB1009, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x02C91009, 0x02CA1009,
+        },
+        {
+            0x404F1009, 0x40501009, 0x40511009, 0x40521009, 0x40531009, 0x40541009,
+            0x40551009, 0x40561009, 0x40571009, 0x40581009, 0x40591009, 0x405A1009,
+            0x405B1009, 0x405C1009, 0x405D1009, 0x405E1009,
+        },
+        {
+            0x405F1009, 0x40601009, 0x40611009, 0x40621009, 0x40631009, 0x40641009,
+            0x40651009, 0x40661009, 0x40671009, 0x40681009, 0x40691009, 0x406A1009,
+            0x406B1009, 0x406C1009, 0x00000000, 0x00000000,
+        },
+        {
+            0x00005C09, 0x00005C89, 0x00005D09, 0x00005D89, 0x00005E09, 0x028F1009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4A081009, 0x4A091009, 0x4A0A1009, 0x4A0B1009, 0x4A0C1009, 0x4A0D1009,
+            0x4A0E1009, 0x4A0F1009, 0x4A101009, 0x4A111009, 0x4A121009, 0x4A131009,
+            0x4A141009, 0x4A151009, 0x4A161009, 0x4A171009,
+        },
+        {
+            0x4A181009, 0x4A191009, 0x4A1A1009, 0x4A1B1009, 0x4A1C1009, 0x4A1D1009,
+            0x4A1E1009, 0x4A1F1009, 0x4A201009, 0x4A211009, 0x4A221009, 0x4A231009,
+            0x4A241009, 0x4A251009, 0x4A261009, 0x4A271009,
+        },
+        {
+            0x4A281009, 0x4A291009, 0x4A2A1009, 0x4A2B1009, 0x4A2C1009, 0x4A2D1009,
+            0x4A2E1009, 0x4A2F1009, 0x4A301009, 0x4A311009, 0x4A321009, 0x4A331009,
+            0x4A341009, 0x4A351009, 0x4A361009, 0x4A371009,
+        },
+        {
+            0x00007B09, 0x00007B89, 0x00007C09, 0x00007C89, 0x00007D09, 0x00007D89,
+            0x00007E09, 0x04A71009, 0x04A81009, 0x04A91009, 0x04AA1009, 0x04AB1009,
+            0x111E1009, 0x111F1009, 0x11201009, 0x11211009,
+        },
+        {
+            0x4A381009, 0x4A391009, 0x1F531009, 0x1F541009, 0x04AC1009, 0x11221009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00000000, 0x1E811009,
+            0x1E821009, 0x1E831009, 0x1E841009, 0x1E851009,
+        },
+        {
+            0x1E861009, 0x1E871009, 0x00000000, 0x4A3A1009, 0x4A3B1009, 0x4A3C1009,
+            0x4A3D1009, 0x4A3E1009, 0x4A3F1009, 0x4A401009, 0x4A411009, 0x4A421009,
+            0x4A431009, 0x4A441009, 0x4A451009, 0x4A461009,
+        },
+        {
+            0x4A471009, 0x4A481009, 0x4A491009, 0x4A4A1009, 0x4A4B1009, 0x4A4C1009,
+            0x4A4D1009, 0x4A4E1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x4A4F1009, 0x4A501009, 0x4A511009,
+        },
+        {
+            0x4A521009, 0x4A531009, 0x4A541009, 0x4A551009, 0x4A561009, 0x4A571009,
+            0x4A581009, 0x4A591009, 0x4A5A1009, 0x4A5B1009, 0x4A5C1009, 0x4A5D1009,
+            0x4A5E1009, 0x4A5F1009, 0x4A601009, 0x4A611009,
+        },
+        {
+            0x41321021, 0x41331021, 0x41341021, 0x41351021, 0x41361021, 0x41371021,
+            0x41381021, 0x41391021, 0x413A1021, 0x413B1021, 0x413C1021, 0x413D1021,
+            0x413E1021, 0x413F1021, 0x41401021, 0x41411021,
+        },
+        {
+            0x41421021, 0x41431021, 0x41441021, 0x41451021, 0x41461021, 0x41471021,
+            0x41481021, 0x41491021, 0x414A1021, 0x414B1021, 0x414C1021, 0x414D1021,
+            0x414E1021, 0x414F1021, 0x41501021, 0x41511021,
+        },
+        {
+            0x41321009, 0x41331009, 0x41341009, 0x41351009, 0x41361009, 0x41371009,
+            0x41381009, 0x41391009, 0x413A1009, 0x413B1009, 0x413C1009, 0x413D1009,
+            0x413E1009, 0x413F1009, 0x41401009, 0x41411009,
+        },
+        {
+            0x41421009, 0x41431009, 0x41441009, 0x41451009, 0x41461009, 0x41471009,
+            0x41481009, 0x41491009, 0x414A1009, 0x414B1009, 0x414C1009, 0x414D1009,
+            0x414E1009, 0x414F1009, 0x41501009, 0x41511009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1E881009, 0x1E891009,
+            0x1E8A1009, 0x1E8B1009, 0x1E8C1009, 0x1E8D1009,
+        },
+        {
+            0x1E8E1009, 0x1E8F1009, 0x1E901009, 0x1E911009, 0x0043EC0A, 0x0043F40A,
+            0x0043FC0A, 0x02351009, 0x02901009, 0x04AD1009, 0x04AE1009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x491D1009, 0x491E1009, 0x491F1009, 0x49201009, 0x49221009, 0x49231009,
+            0x49221011, 0x49241009, 0x49251009, 0x49261009, 0x49271009, 0x49281009,
+            0x49291009, 0x492A1009, 0x492C1009, 0x492D1009,
+        },
+        {
+            0x492F1009, 0x49301009, 0x49311009, 0x492F1011, 0x49321009, 0x49331009,
+            0x49341009, 0x49351009, 0x49361009, 0x49371009, 0x49381009, 0x49391009,
+            0x493A1009, 0x493B1009, 0x493C1009, 0x493D1009,
+        },
+        {
+            0x493E1009, 0x493F1009, 0x49401009, 0x49411009, 0x49421009, 0x49411011,
+            0x49431009, 0x49441009, 0x49451009, 0x49461009, 0x49471009, 0x49481009,
+            0x49491009, 0x494A1009, 0x494B1009, 0x494C1009,
+        },
+        {
+            0x494D1009, 0x494E1009, 0x494F1009, 0x49511009, 0x49531009, 0x49541009,
+            0x49551009, 0x49561009, 0x49571009, 0x49581009, 0x495A1009, 0x495B1009,
+            0x495C1009, 0x495D1009, 0x495E1009, 0x495D1011,
+        },
+        {
+            0x495F1009, 0x49601009, 0x49611009, 0x49621009, 0x49631009, 0x49211009,
+            0x49521009, 0x49501009, 0x492B1009, 0x49591009, 0x492E1009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x49681009,
+        },
+        {
+            0x49641009, 0x49651009, 0x49661009, 0x49671009, 0x49691009, 0x496A1009,
+            0x496B1009, 0x496C1009, 0x496D1009, 0x496F1009, 0x49701009, 0x49711009,
+            0x49721009, 0x49741009, 0x49751009, 0x49761009,
+        },
+        {
+            0x49771009, 0x49791009, 0x497A1009, 0x497B1009, 0x497C1009, 0x497D1009,
+            0x497F1009, 0x49801009, 0x49811009, 0x49821009, 0x49831009, 0x49841009,
+            0x49851009, 0x49861009, 0x49891009, 0x498A1009,
+        },
+        {
+            0x498B1009, 0x498C1009, 0x498D1009, 0x498F1009, 0x49901009, 0x49931009,
+            0x49941009, 0x49951009, 0x49961009, 0x49971009, 0x49981009, 0x49991009,
+            0x499A1009, 0x499B1009, 0x499C1009, 0x49871009,
+        },
+        {
+            0x498E1009, 0x496E1009, 0x49921009, 0x49731009, 0x49781009, 0x49911009,
+            0x497E1009, 0x49881009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x499D1009,
+        },
+        {
+            0x499E1009, 0x499F1009, 0x49A01009, 0x49A11009, 0x49A21009, 0x49A31009,
+            0x49A41009, 0x49A51009, 0x49A61009, 0x49A71009, 0x49A81009, 0x49A91009,
+            0x49AA1009, 0x49AB1009, 0x49AC1009, 0x49AD1009,
+        },
+        {
+            0x1F591009, 0x1F5A1009, 0x02391009, 0x1F5B1009, 0x00000001, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00008389, 0x00008409, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x42DD1045, 0x43181009, 0x430B1009, 0x430C1009, 0x430D1009, 0x430E1009,
+            0x430F1009, 0x43101009, 0x43111009, 0x43121009, 0x43131009, 0x43141009,
+            0x43151009, 0x43161009, 0x43171009, 0x43191009,
+        },
+        {
+            0x431A1009, 0x431B1009, 0x431C1009, 0x431D1009, 0x431E1009, 0x431F1009,
+            0x43201009, 0x43211009, 0x43221009, 0x43231009, 0x43241009, 0x43251009,
+            0x43261009, 0x43271009, 0x43281009, 0x43291009,
+        },
+        {
+            0x432A1009, 0x432B1009, 0x432C1009, 0x432D1009, 0x432E1009, 0x432F1009,
+            0x43301009, 0x43311009, 0x43321009, 0x43331009, 0x43341009, 0x43351009,
+            0x43361009, 0x43371009, 0x43381009, 0x43391009,
+        },
+        {
+            0x433A1009, 0x433B1009, 0x433C1009, 0x433D1009, 0x433E1009, 0x433F1009,
+            0x43401009, 0x43411009, 0x43421009, 0x43431009, 0x43441009, 0x43451009,
+            0x43461009, 0x43471009, 0x43481009, 0x43491009,
+        },
+        {
+            0x434A1009, 0x434B1009, 0x434C1009, 0x434D1009, 0x434E1009, 0x434F1009,
+            0x43501009, 0x43511009, 0x43521009, 0x43531009, 0x43541009, 0x43551009,
+            0x43561009, 0x43571009, 0x43581009, 0x43591009,
+        },
+        {
+            0x435A1009, 0x435B1009, 0x435C1009, 0x435D1009, 0x435E1009, 0x435F1009,
+            0x43601009, 0x43611009, 0x43621009, 0x43631009, 0x43641009, 0x43651009,
+            0x43661009, 0x43671009, 0x43681009, 0x43691009,
+        },
+        {
+            0x436A1009, 0x436B1009, 0x436C1009, 0x436D1009, 0x436E1009, 0x436F1009,
+            0x43701009, 0x43711009, 0x43721009, 0x43731009, 0x43741009, 0x43751009,
+            0x43761009, 0x43771009, 0x43781009, 0x43791009,
+        },
+        {
+            0x437A1009, 0x437B1009, 0x437C1009, 0x437D1009, 0x437E1009, 0x437F1009,
+            0x43801009, 0x43811009, 0x43821009, 0x43831009, 0x43841009, 0x43851009,
+            0x43861009, 0x43871009, 0x43881009, 0x43891009,
+        },
+        {
+            0x438A1009, 0x438B1009, 0x438C1009, 0x438D1009, 0x438E1009, 0x438F1009,
+            0x43901009, 0x43911009, 0x43921009, 0x43931009, 0x43941009, 0x43951009,
+            0x43961009, 0x43971009, 0x43981009, 0x43991009,
+        },
+        {
+            0x439A1009, 0x439B1009, 0x439C1009, 0x439D1009, 0x439E1009, 0x439F1009,
+            0x43A01009, 0x43A11009, 0x43A21009, 0x43A31009, 0x43A41009, 0x43A51009,
+            0x43A61009, 0x43A71009, 0x43A81009, 0x43A91009,
+        },
+        {
+            0x43AA1009, 0x43AB1009, 0x43AC1009, 0x43AD1009, 0x43AE1009, 0x43AF1009,
+            0x43B01009, 0x43B11009, 0x43B21009, 0x43B31009, 0x43B41009, 0x43B51009,
+            0x43B61009, 0x43B71009, 0x43B81009, 0x43B91009,
+        },
+        {
+            0x43BA1009, 0x43BB1009, 0x43BC1009, 0x43BD1009, 0x43BE1009, 0x43BF1009,
+            0x43C01009, 0x43C11009, 0x43C21009, 0x43C31009, 0x43C41009, 0x43C51009,
+            0x43C61009, 0x43C71009, 0x43C81009, 0x43C91009,
+        },
+        {
+            0x43CA1009, 0x43CB1009, 0x43CC1009, 0x43CD1009, 0x43CE1009, 0x43CF1009,
+            0x43D01009, 0x43D11009, 0x43D21009, 0x43D31009, 0x43D41009, 0x43D51009,
+            0x43D61009, 0x43D71009, 0x43D81009, 0x43D91009,
+        },
+        {
+            0x43DA1009, 0x43DB1009, 0x43DC1009, 0x43DD1009, 0x43DE1009, 0x43DF1009,
+            0x43E01009, 0x43E11009, 0x43E21009, 0x43E31009, 0x43E41009, 0x43E51009,
+            0x43E61009, 0x43E71009, 0x43E81009, 0x43E91009,
+        },
+        {
+            0x43EA1009, 0x43EB1009, 0x43EC1009, 0x43ED1009, 0x43EE1009, 0x43EF1009,
+            0x43F01009, 0x43F11009, 0x43F21009, 0x43F31009, 0x43F41009, 0x43F51009,
+            0x43F61009, 0x43F71009, 0x43F81009, 0x43F91009,
+        },
+        {
+            0x43FA1009, 0x43FB1009, 0x43FC1009, 0x43FD1009, 0x43FE1009, 0x43FF1009,
+            0x44001009, 0x44011009, 0x44021009, 0x44031009, 0x44041009, 0x44051009,
+            0x44061009, 0x44071009, 0x44081009, 0x44091009,
+        },
+        {
+            0x440A1009, 0x440B1009, 0x440C1009, 0x440D1009, 0x440E1009, 0x440F1009,
+            0x44101009, 0x44111009, 0x44121009, 0x44131009, 0x44141009, 0x44151009,
+            0x44161009, 0x44171009, 0x44181009, 0x44191009,
+        },
+        {
+            0x441A1009, 0x441B1009, 0x441C1009, 0x441D1009, 0x441E1009, 0x441F1009,
+            0x44201009, 0x44211009, 0x44221009, 0x44231009, 0x44241009, 0x44251009,
+            0x44261009, 0x44271009, 0x44281009, 0x00000000,
+        },
+        {
+            0x43071035, 0x43081035, 0x43091035, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4307103D, 0x4308103D,
+            0x4309103D, 0x430A103D, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4BBF1009, 0x4BC01009, 0x4BC11009, 0x4BC21009, 0x4BC31009, 0x4BC41009,
+            0x4BC51009, 0x4BC61009, 0x4BC71009, 0x4BC81009, 0x4BC91009, 0x4BCA1009,
+            0x4BCB1009, 0x4BCC1009, 0x4BCD1009, 0x4BCE1009,
+        },
+        {
+            0x4BCF1009, 0x4BD01009, 0x4BD11009, 0x4BD21009, 0x4BD31009, 0x4BD41009,
+            0x4BD51009, 0x4BD61009, 0x4BD71009, 0x4BD81009, 0x4BD91009, 0x4BDA1009,
+            0x4BDB1009, 0x4BDC1009, 0x4BDD1009, 0x4BDE1009,
+        },
+        {
+            0x4BDF1009, 0x4BE01009, 0x4BE11009, 0x4BE21009, 0x4BE31009, 0x4BE41009,
+            0x4BE51009, 0x4BE61009, 0x4BE71009, 0x4BE81009, 0x4BE91009, 0x4BEA1009,
+            0x4BEB1009, 0x4BEC1009, 0x4BED1009, 0x4BEE1009,
+        },
+        {
+            0x4BEF1009, 0x4BF01009, 0x4BF11009, 0x4BF21009, 0x4BF31009, 0x4BF41009,
+            0x4BF51009, 0x4BF61009, 0x4BF71009, 0x4BF81009, 0x4BF91009, 0x4BFA1009,
+            0x4BFB1009, 0x4BFC1009, 0x4BFD1009, 0x4BFE1009,
+        },
+        {
+            0x4BFF1009, 0x4C001009, 0x4C011009, 0x4C021009, 0x4C031009, 0x4C041009,
+            0x4C051009, 0x4C061009, 0x4C071009, 0x4C081009, 0x4C091009, 0x4C0A1009,
+            0x4C0B1009, 0x4C0C1009, 0x4C0D1009, 0x4C0E1009,
+        },
+        {
+            0x4C0F1009, 0x4C101009, 0x4C111009, 0x4C121009, 0x4C131009, 0x4C141009,
+            0x4C151009, 0x4C161009, 0x4C171009, 0x4C181009, 0x4C191009, 0x4C1A1009,
+            0x4C1B1009, 0x4C1C1009, 0x4C1D1009, 0x4C1E1009,
+        },
+        {
+            0x4C1F1009, 0x4C201009, 0x4C211009, 0x4C221009, 0x4C231009, 0x4C241009,
+            0x4C251009, 0x4C261009, 0x4C271009, 0x4C281009, 0x4C291009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4C2A1009, 0x4C2B1009, 0x4C2C1009, 0x4C2D1009, 0x4C2E1009, 0x4C2F1009,
+            0x4C301009, 0x4C311009, 0x4C321009, 0x4C331009, 0x4C341009, 0x4C351009,
+            0x4C361009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4C371009, 0x4C381009, 0x4C391009, 0x4C3A1009, 0x4C3B1009, 0x4C3C1009,
+            0x4C3D1009, 0x4C3E1009, 0x4C3F1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4C401009, 0x4C411009, 0x4C421009, 0x4C431009, 0x4C441009, 0x4C451009,
+            0x4C461009, 0x4C471009, 0x4C481009, 0x4C491009, 0x00000000, 0x00000000,
+            0x13141009, 0x00001989, 0x00001A89, 0x02911009,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x11241009, 0x11251009, 0x11261009, 0x11271009, 0x11281009, 0x11291009,
+            0x112A1009, 0x112B1009, 0x112C1009, 0x112D1009, 0x112E1009, 0x112F1009,
+            0x11301009, 0x11311009, 0x11321009, 0x11331009,
+        },
+        {
+            0x11341009, 0x11351009, 0x11361009, 0x11371009, 0x11381009, 0x11391009,
+            0x113A1009, 0x113B1009, 0x113C1009, 0x113D1009, 0x113E1009, 0x113F1009,
+            0x11401009, 0x11411009, 0x11421009, 0x11431009,
+        },
+        {
+            0x11441009, 0x11451009, 0x11461009, 0x11471009, 0x11481009, 0x11491009,
+            0x114A1009, 0x114B1009, 0x114C1009, 0x114D1009, 0x114E1009, 0x114F1009,
+            0x11501009, 0x11511009, 0x11521009, 0x11531009,
+        },
+        {
+            0x11541009, 0x11551009, 0x11561009, 0x11571009, 0x11581009, 0x11591009,
+            0x115A1009, 0x115B1009, 0x115C1009, 0x115D1009, 0x115E1009, 0x115F1009,
+            0x11601009, 0x11611009, 0x11621009, 0x11631009,
+        },
+        {
+            0x11641009, 0x11651009, 0x11661009, 0x11671009, 0x11681009, 0x11691009,
+            0x116A1009, 0x116B1009, 0x116C1009, 0x116D1009, 0x116E1009, 0x116F1009,
+            0x11701009, 0x11711009, 0x11721009, 0x11731009,
+        },
+        {
+            0x11741009, 0x11751009, 0x11761009, 0x11771009, 0x11781009, 0x11791009,
+            0x117A1009, 0x117B1009, 0x117C1009, 0x117D1009, 0x117E1009, 0x117F1009,
+            0x11801009, 0x11811009, 0x11821009, 0x11831009,
+        },
+        {
+            0x11841009, 0x11851009, 0x11861009, 0x11871009, 0x11881009, 0x11891009,
+            0x118A1009, 0x118B1009, 0x118C1009, 0x118D1009, 0x118E1009, 0x118F1009,
+            0x11901009, 0x11911009, 0x11921009, 0x11931009,
+        },
+        {
+            0x11941009, 0x11951009, 0x11961009, 0x11971009, 0x11981009, 0x11991009,
+            0x119A1009, 0x119B1009, 0x119C1009, 0x119D1009, 0x119E1009, 0x119F1009,
+            0x11A01009, 0x11A11009, 0x11A21009, 0x11A31009,
+        },
+        {
+            0x11A41009, 0x11A51009, 0x11A61009, 0x11A71009, 0x11A81009, 0x11A91009,
+            0x11AA1009, 0x11AB1009, 0x11AC1009, 0x11AD1009, 0x11AE1009, 0x11AF1009,
+            0x11B01009, 0x11B11009, 0x11B21009, 0x11B31009,
+        },
+        {
+            0x11B41009, 0x11B51009, 0x11B61009, 0x11B71009, 0x11B81009, 0x11B91009,
+            0x11BA1009, 0x11BB1009, 0x11BC1009, 0x11BD1009, 0x11BE1009, 0x11BF1009,
+            0x11C01009, 0x11C11009, 0x11C21009, 0x11C31009,
+        },
+        {
+            0x11C41009, 0x11C51009, 0x11C61009, 0x11C71009, 0x11C81009, 0x11C91009,
+            0x11CA1009, 0x11CB1009, 0x11CC1009, 0x11CD1009, 0x11CE1009, 0x11CF1009,
+            0x11D01009, 0x11D11009, 0x11D21009, 0x11D31009,
+        },
+        {
+            0x11D41009, 0x11D51009, 0x11D61009, 0x11D71009, 0x11D81009, 0x11D91009,
+            0x11DA1009, 0x11DB1009, 0x11DC1009, 0x11DD1009, 0x11DE1009, 0x11DF1009,
+            0x11E01009, 0x11E11009, 0x11E21009, 0x11E31009,
+        },
+        {
+            0x11E41009, 0x11E51009, 0x11E61009, 0x11E71009, 0x11E81009, 0x11E91009,
+            0x11EA1009, 0x11EB1009, 0x11EC1009, 0x11ED1009, 0x11EE1009, 0x11EF1009,
+            0x11F01009, 0x11F11009, 0x11F21009, 0x11F31009,
+        },
+        {
+            0x11F41009, 0x11F51009, 0x11F61009, 0x11F71009, 0x11F81009, 0x11F91009,
+            0x11FA1009, 0x11FB1009, 0x11FC1009, 0x11FD1009, 0x11FE1009, 0x11FF1009,
+            0x12001009, 0x12011009, 0x12021009, 0x12031009,
+        },
+        {
+            0x12041009, 0x12051009, 0x12061009, 0x12071009, 0x12081009, 0x12091009,
+            0x120A1009, 0x120B1009, 0x120C1009, 0x120D1009, 0x120E1009, 0x120F1009,
+            0x12101009, 0x12111009, 0x12121009, 0x12131009,
+        },
+        {
+            0x12141009, 0x12151009, 0x12161009, 0x12171009, 0x12181009, 0x12191009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x121A1009, 0x121B1009, 0x121C1009, 0x121D1009, 0x121E1009, 0x121F1009,
+            0x12201009, 0x12211009, 0x12221009, 0x12231009, 0x12241009, 0x12251009,
+            0x12261009, 0x12271009, 0x12281009, 0x12291009,
+        },
+        {
+            0x122A1009, 0x122B1009, 0x122C1009, 0x122D1009, 0x122E1009, 0x122F1009,
+            0x12301009, 0x12311009, 0x12321009, 0x12331009, 0x12341009, 0x12351009,
+            0x12361009, 0x12371009, 0x12381009, 0x12391009,
+        },
+        {
+            0x123A1009, 0x123B1009, 0x123C1009, 0x123D1009, 0x123E1009, 0x123F1009,
+            0x12401009, 0x00000000, 0x00000000, 0x12541009, 0x12441009, 0x12451009,
+            0x12461009, 0x12471009, 0x12481009, 0x12491009,
+        },
+        {
+            0x124A1009, 0x124B1009, 0x124C1009, 0x124D1009, 0x124E1009, 0x124F1009,
+            0x12501009, 0x12511009, 0x12521009, 0x12531009, 0x12551009, 0x12561009,
+            0x12571009, 0x12581009, 0x12591009, 0x125A1009,
+        },
+        {
+            0x125B1009, 0x125C1009, 0x125D1009, 0x125E1009, 0x125F1009, 0x12601009,
+            0x12611009, 0x12621009, 0x12631009, 0x12641009, 0x12651009, 0x12661009,
+            0x12671009, 0x12681009, 0x12691009, 0x126A1009,
+        },
+        {
+            0x126B1009, 0x126C1009, 0x126D1009, 0x126E1009, 0x126F1009, 0x12701009,
+            0x12711009, 0x12721009, 0x12731009, 0x12741009, 0x12751009, 0x12761009,
+            0x12771009, 0x12781009, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x12791009, 0x127A1009,
+            0x127B1009, 0x00000001, 0x00000001, 0x00000001,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x127C1009, 0x127D1009, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x127E1009, 0x127F1009, 0x12801009, 0x12811009,
+        },
+        {
+            0x12821009, 0x12831009, 0x12841009, 0x12851009, 0x12861009, 0x12871009,
+            0x12881009, 0x12891009, 0x128A1009, 0x128B1009, 0x128C1009, 0x128D1009,
+            0x128E1009, 0x128F1009, 0x12901009, 0x12911009,
+        },
+        {
+            0x12921009, 0x12931009, 0x12941009, 0x12951009, 0x12961009, 0x12971009,
+            0x12981009, 0x12991009, 0x129A1009, 0x129B1009, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x129C1009, 0x129D1009,
+        },
+        {
+            0x129E1009, 0x129F1009, 0x12A01009, 0x12A11009, 0x12A21009, 0x12A31009,
+            0x12A41009, 0x12A51009, 0x12A61009, 0x12A71009, 0x12A81009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x12A91009, 0x12AA1009, 0x12AB1009, 0x12AC1009, 0x12AD1009,
+            0x12AE1009, 0x12AF1009, 0x12B01009, 0x12B11009, 0x12B21009, 0x12B31009,
+            0x12B41009, 0x12B51009, 0x12B61009, 0x12B71009,
+        },
+        {
+            0x12B81009, 0x12B91009, 0x12BA1009, 0x12BB1009, 0x12BC1009, 0x12BD1009,
+            0x12BE1009, 0x12BF1009, 0x12C01009, 0x12C11009, 0x12C21009, 0x12C31009,
+            0x12C41009, 0x12C51009, 0x12C61009, 0x12C71009,
+        },
+        {
+            0x12C81009, 0x12C91009, 0x12CA1009, 0x12CB1009, 0x12CC1009, 0x12CD1009,
+            0x12CE1009, 0x12CF1009, 0x12D01009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x12D11009, 0x12D21009, 0x12D31009, 0x12D41009, 0x12D51009, 0x12D61009,
+            0x12D71009, 0x12D81009, 0x12D91009, 0x12DA1009, 0x12DB1009, 0x12DC1009,
+            0x12DD1009, 0x12DE1009, 0x12DF1009, 0x12E01009,
+        },
+        {
+            0x12E11009, 0x12E21009, 0x12E31009, 0x12E41009, 0x12E51009, 0x12E61009,
+            0x12E71009, 0x12E81009, 0x12E91009, 0x12EA1009, 0x12EB1009, 0x12EC1009,
+            0x12ED1009, 0x12EE1009, 0x12EF1009, 0x12F01009,
+        },
+        {
+            0x12F11009, 0x12F21009, 0x12F31009, 0x12F41009, 0x12F51009, 0x12F61009,
+            0x12F71009, 0x12F81009, 0x12F91009, 0x12FA1009, 0x12FB1009, 0x12FC1009,
+            0x12FD1009, 0x12FE1009, 0x12FF1009, 0x13001009,
+        },
+        {
+            0x13011009, 0x13021009, 0x13031009, 0x13041009, 0x13051009, 0x13061009,
+            0x13071009, 0x13081009, 0x13091009, 0x130A1009, 0x130B1009, 0x130C1009,
+            0x130D1009, 0x130E1009, 0x130F1009, 0x13101009,
+        },
+        {
+            0x13111009, 0x13121009, 0x00000001, 0x00000001, 0x00000001, 0x13131009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1E921009, 0x1E931009,
+            0x1E941009, 0x1E951009, 0x1E961009, 0x1E971009,
+        },
+        {
+            0x1E981009, 0x1E991009, 0x1E9A1009, 0x1E9B1009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x10361009, 0x10371009, 0x10381009, 0x10391009, 0x103A1009, 0x103B1009,
+            0x103C1009, 0x103D1009, 0x103E1009, 0x103F1009, 0x10401009, 0x10411009,
+            0x10421009, 0x10431009, 0x10441009, 0x10451009,
+        },
+        {
+            0x10461009, 0x10471009, 0x10481009, 0x10491009, 0x104A1009, 0x104B1009,
+            0x104C1009, 0x104D1009, 0x104E1009, 0x104F1009, 0x10501009, 0x10511009,
+            0x10521009, 0x10531009, 0x10541009, 0x10551009,
+        },
+        {
+            0x10561009, 0x10571009, 0x10581009, 0x10591009, 0x105A1009, 0x105B1009,
+            0x105C1009, 0x105D1009, 0x105E1009, 0x105F1009, 0x10601009, 0x10611009,
+            0x10621009, 0x10631009, 0x10641009, 0x10651009,
+        },
+        {
+            0x10661009, 0x10671009, 0x10681009, 0x10691009, 0x106A1009, 0x106B1009,
+            0x106C1009, 0x106D1009, 0x106E1009, 0x106F1009, 0x10701009, 0x10711009,
+            0x10721009, 0x10731009, 0x10741009, 0x10751009,
+        },
+        {
+            0x10761009, 0x10771009, 0x10781009, 0x10791009, 0x107A1009, 0x107B1009,
+            0x107C1009, 0x107D1009, 0x107E1009, 0x107F1009, 0x10801009, 0x10811009,
+            0x10821009, 0x10831009, 0x10841009, 0x10851009,
+        },
+        {
+            0x10861009, 0x10871009, 0x10881009, 0x10891009, 0x108A1009, 0x108B1009,
+            0x108C1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009, 0x1F9E1009,
+            0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1F3D1009, 0x1F3E1009, 0x1F3F1009,
+            0x1F401009, 0x1F411009, 0x1F421009, 0x1F431009,
+        },
+        {
+            0x1F441009, 0x1F451009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009,
+            0x1F9D1009, 0x1F991009, 0x1F9D1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1FA2102D, 0x1FBC102D, 0x1FD6102D, 0x1FEB102D, 0x2007102D, 0x2042102D,
+            0x2051102D, 0x2075102D, 0x2090102D, 0x20AB102D, 0x20C4102D, 0x20D6102D,
+            0x2109102D, 0x2118102D, 0x213C102D, 0x216B102D,
+        },
+        {
+            0x2180102D, 0x2193102D, 0x21D2102D, 0x21F7102D, 0x2217102D, 0x2247102D,
+            0x2259102D, 0x2264102D, 0x2270102D, 0x2286102D, 0x1FA21015, 0x1FBC1015,
+            0x1FD61015, 0x1FEB1015, 0x20071015, 0x20421015,
+        },
+        {
+            0x20511015, 0x20751015, 0x20901015, 0x20AB1015, 0x20C41015, 0x20D61015,
+            0x21091015, 0x21181015, 0x213C1015, 0x216B1015, 0x21801015, 0x21931015,
+            0x21D21015, 0x21F71015, 0x22171015, 0x22471015,
+        },
+        {
+            0x22591015, 0x22641015, 0x22701015, 0x22861015, 0x1FA2102D, 0x1FBC102D,
+            0x1FD6102D, 0x1FEB102D, 0x2007102D, 0x2042102D, 0x2051102D, 0x2075102D,
+            0x2090102D, 0x20AB102D, 0x20C4102D, 0x20D6102D,
+        },
+        {
+            0x2109102D, 0x2118102D, 0x213C102D, 0x216B102D, 0x2180102D, 0x2193102D,
+            0x21D2102D, 0x21F7102D, 0x2217102D, 0x2247102D, 0x2259102D, 0x2264102D,
+            0x2270102D, 0x2286102D, 0x1FA21015, 0x1FBC1015,
+        },
+        {
+            0x1FD61015, 0x1FEB1015, 0x20071015, 0x20421015, 0x20511015, 0x00000000,
+            0x20901015, 0x20AB1015, 0x20C41015, 0x20D61015, 0x21091015, 0x21181015,
+            0x213C1015, 0x216B1015, 0x21801015, 0x21931015,
+        },
+        {
+            0x21D21015, 0x21F71015, 0x22171015, 0x22471015, 0x22591015, 0x22641015,
+            0x22701015, 0x22861015, 0x1FA2102D, 0x1FBC102D, 0x1FD6102D, 0x1FEB102D,
+            0x2007102D, 0x2042102D, 0x2051102D, 0x2075102D,
+        },
+        {
+            0x2090102D, 0x20AB102D, 0x20C4102D, 0x20D6102D, 0x2109102D, 0x2118102D,
+            0x213C102D, 0x216B102D, 0x2180102D, 0x2193102D, 0x21D2102D, 0x21F7102D,
+            0x2217102D, 0x2247102D, 0x2259102D, 0x2264102D,
+        },
+        {
+            0x2270102D, 0x2286102D, 0x1FA21015, 0x1FBC1015, 0x1FD61015, 0x1FEB1015,
+            0x20071015, 0x20421015, 0x20511015, 0x20751015, 0x20901015, 0x20AB1015,
+            0x20C41015, 0x20D61015, 0x21091015, 0x21181015,
+        },
+        {
+            0x213C1015, 0x216B1015, 0x21801015, 0x21931015, 0x21D21015, 0x21F71015,
+            0x22171015, 0x22471015, 0x22591015, 0x22641015, 0x22701015, 0x22861015,
+            0x1FA2102D, 0x00000000, 0x1FD6102D, 0x1FEB102D,
+        },
+        {
+            0x00000000, 0x00000000, 0x2051102D, 0x00000000, 0x00000000, 0x20AB102D,
+            0x20C4102D, 0x00000000, 0x00000000, 0x2118102D, 0x213C102D, 0x216B102D,
+            0x2180102D, 0x00000000, 0x21D2102D, 0x21F7102D,
+        },
+        {
+            0x2217102D, 0x2247102D, 0x2259102D, 0x2264102D, 0x2270102D, 0x2286102D,
+            0x1FA21015, 0x1FBC1015, 0x1FD61015, 0x1FEB1015, 0x00000000, 0x20421015,
+            0x00000000, 0x20751015, 0x20901015, 0x20AB1015,
+        },
+        {
+            0x20C41015, 0x20D61015, 0x21091015, 0x21181015, 0x00000000, 0x216B1015,
+            0x21801015, 0x21931015, 0x21D21015, 0x21F71015, 0x22171015, 0x22471015,
+            0x22591015, 0x22641015, 0x22701015, 0x22861015,
+        },
+        {
+            0x22591015, 0x22641015, 0x22701015, 0x22861015, 0x1FA2102D, 0x1FBC102D,
+            0x00000000, 0x1FEB102D, 0x2007102D, 0x2042102D, 0x2051102D, 0x00000000,
+            0x00000000, 0x20AB102D, 0x20C4102D, 0x20D6102D,
+        },
+        {
+            0x2109102D, 0x2118102D, 0x213C102D, 0x216B102D, 0x2180102D, 0x00000000,
+            0x21D2102D, 0x21F7102D, 0x2217102D, 0x2247102D, 0x2259102D, 0x2264102D,
+            0x2270102D, 0x00000000, 0x1FA21015, 0x1FBC1015,
+        },
+        {
+            0x1FD61015, 0x1FEB1015, 0x20071015, 0x20421015, 0x20511015, 0x20751015,
+            0x20901015, 0x20AB1015, 0x20C41015, 0x20D61015, 0x21091015, 0x21181015,
+            0x213C1015, 0x216B1015, 0x21801015, 0x21931015,
+        },
+        {
+            0x21D21015, 0x21F71015, 0x22171015, 0x22471015, 0x22591015, 0x22641015,
+            0x22701015, 0x22861015, 0x1FA2102D, 0x1FBC102D, 0x00000000, 0x1FEB102D,
+            0x2007102D, 0x2042102D, 0x2051102D, 0x00000000,
+        },
+        {
+            0x2090102D, 0x20AB102D, 0x20C4102D, 0x20D6102D, 0x2109102D, 0x00000000,
+            0x213C102D, 0x00000000, 0x00000000, 0x00000000, 0x21D2102D, 0x21F7102D,
+            0x2217102D, 0x2247102D, 0x2259102D, 0x2264102D,
+        },
+        {
+            0x2270102D, 0x00000000, 0x1FA21015, 0x1FBC1015, 0x1FD61015, 0x1FEB1015,
+            0x20071015, 0x20421015, 0x20511015, 0x20751015, 0x20901015, 0x20AB1015,
+            0x20C41015, 0x20D61015, 0x21091015, 0x21181015,
+        },
+        {
+            0x213C1015, 0x216B1015, 0x21801015, 0x21931015, 0x21D21015, 0x21F71015,
+            0x22171015, 0x22471015, 0x22591015, 0x22641015, 0x22701015, 0x22861015,
+            0x1FA2102D, 0x1FBC102D, 0x1FD6102D, 0x1FEB102D,
+        },
+        {
+            0x2007102D, 0x2042102D, 0x2051102D, 0x2075102D, 0x2090102D, 0x20AB102D,
+            0x20C4102D, 0x20D6102D, 0x2109102D, 0x2118102D, 0x213C102D, 0x216B102D,
+            0x2180102D, 0x2193102D, 0x21D2102D, 0x21F7102D,
+        },
+        {
+            0x2217102D, 0x2247102D, 0x2259102D, 0x2264102D, 0x2270102D, 0x2286102D,
+            0x1FA21015, 0x1FBC1015, 0x1FD61015, 0x1FEB1015, 0x20071015, 0x20421015,
+            0x20511015, 0x20751015, 0x20901015, 0x20AB1015,
+        },
+        {
+            0x20C41015, 0x20D61015, 0x21091015, 0x21181015, 0x213C1015, 0x216B1015,
+            0x21801015, 0x21931015, 0x21D21015, 0x21F71015, 0x22171015, 0x22471015,
+            0x22591015, 0x22641015, 0x22701015, 0x22861015,
+        },
+        {
+            0x22591015, 0x22641015, 0x22701015, 0x22861015, 0x20941015, 0x20AF1015,
+            0x00000000, 0x00000000, 0x231E102D, 0x231F102D, 0x2320102D, 0x2322102D,
+            0x2323102D, 0x2327102D, 0x2329102D, 0x232A102D,
+        },
+        {
+            0x232B102D, 0x232D102D, 0x232E102D, 0x2330102D, 0x2331102D, 0x2332102D,
+            0x2333102D, 0x2334102D, 0x2339102D, 0x232A102D, 0x233C102D, 0x2340102D,
+            0x2341102D, 0x2342102D, 0x2343102D, 0x2344102D,
+        },
+        {
+            0x2346102D, 0x065C1015, 0x231E1015, 0x231F1015, 0x23201015, 0x23221015,
+            0x23231015, 0x23271015, 0x23291015, 0x232A1015, 0x232B1015, 0x232D1015,
+            0x232E1015, 0x23301015, 0x23311015, 0x23321015,
+        },
+        {
+            0x23331015, 0x23341015, 0x23391015, 0x233C1015, 0x233C1015, 0x23401015,
+            0x23411015, 0x23421015, 0x23431015, 0x23441015, 0x23461015, 0x06581015,
+            0x23231015, 0x232A1015, 0x232D1015, 0x23421015,
+        },
+        {
+            0x23391015, 0x23341015, 0x231E102D, 0x231F102D, 0x2320102D, 0x2322102D,
+            0x2323102D, 0x2327102D, 0x2329102D, 0x232A102D, 0x232B102D, 0x232D102D,
+            0x232E102D, 0x2330102D, 0x2331102D, 0x2332102D,
+        },
+        {
+            0x2333102D, 0x2334102D, 0x2339102D, 0x232A102D, 0x233C102D, 0x2340102D,
+            0x2341102D, 0x2342102D, 0x2343102D, 0x2344102D, 0x2346102D, 0x065C1015,
+            0x231E1015, 0x231F1015, 0x23201015, 0x23221015,
+        },
+        {
+            0x23231015, 0x23271015, 0x23291015, 0x232A1015, 0x232B1015, 0x232D1015,
+            0x232E1015, 0x23301015, 0x23311015, 0x23321015, 0x23331015, 0x23341015,
+            0x23391015, 0x233C1015, 0x233C1015, 0x23401015,
+        },
+        {
+            0x23411015, 0x23421015, 0x23431015, 0x23441015, 0x23461015, 0x06581015,
+            0x23231015, 0x232A1015, 0x232D1015, 0x23421015, 0x23391015, 0x23341015,
+            0x231E102D, 0x231F102D, 0x2320102D, 0x2322102D,
+        },
+        {
+            0x2323102D, 0x2327102D, 0x2329102D, 0x232A102D, 0x232B102D, 0x232D102D,
+            0x232E102D, 0x2330102D, 0x2331102D, 0x2332102D, 0x2333102D, 0x2334102D,
+            0x2339102D, 0x232A102D, 0x233C102D, 0x2340102D,
+        },
+        {
+            0x2341102D, 0x2342102D, 0x2343102D, 0x2344102D, 0x2346102D, 0x065C1015,
+            0x231E1015, 0x231F1015, 0x23201015, 0x23221015, 0x23231015, 0x23271015,
+            0x23291015, 0x232A1015, 0x232B1015, 0x232D1015,
+        },
+        {
+            0x232E1015, 0x23301015, 0x23311015, 0x23321015, 0x23331015, 0x23341015,
+            0x23391015, 0x233C1015, 0x233C1015, 0x23401015, 0x23411015, 0x23421015,
+            0x23431015, 0x23441015, 0x23461015, 0x06581015,
+        },
+        {
+            0x23231015, 0x232A1015, 0x232D1015, 0x23421015, 0x23391015, 0x23341015,
+            0x231E102D, 0x231F102D, 0x2320102D, 0x2322102D, 0x2323102D, 0x2327102D,
+            0x2329102D, 0x232A102D, 0x232B102D, 0x232D102D,
+        },
+        {
+            0x232E102D, 0x2330102D, 0x2331102D, 0x2332102D, 0x2333102D, 0x2334102D,
+            0x2339102D, 0x232A102D, 0x233C102D, 0x2340102D, 0x2341102D, 0x2342102D,
+            0x2343102D, 0x2344102D, 0x2346102D, 0x065C1015,
+        },
+        {
+            0x231E1015, 0x231F1015, 0x23201015, 0x23221015, 0x23231015, 0x23271015,
+            0x23291015, 0x232A1015, 0x232B1015, 0x232D1015, 0x232E1015, 0x23301015,
+            0x23311015, 0x23321015, 0x23331015, 0x23341015,
+        },
+        {
+            0x23391015, 0x233C1015, 0x233C1015, 0x23401015, 0x23411015, 0x23421015,
+            0x23431015, 0x23441015, 0x23461015, 0x06581015, 0x23231015, 0x232A1015,
+            0x232D1015, 0x23421015, 0x23391015, 0x23341015,
+        },
+        {
+            0x231E102D, 0x231F102D, 0x2320102D, 0x2322102D, 0x2323102D, 0x2327102D,
+            0x2329102D, 0x232A102D, 0x232B102D, 0x232D102D, 0x232E102D, 0x2330102D,
+            0x2331102D, 0x2332102D, 0x2333102D, 0x2334102D,
+        },
+        {
+            0x2339102D, 0x232A102D, 0x233C102D, 0x2340102D, 0x2341102D, 0x2342102D,
+            0x2343102D, 0x2344102D, 0x2346102D, 0x065C1015, 0x231E1015, 0x231F1015,
+            0x23201015, 0x23221015, 0x23231015, 0x23271015,
+        },
+        {
+            0x23291015, 0x232A1015, 0x232B1015, 0x232D1015, 0x232E1015, 0x23301015,
+            0x23311015, 0x23321015, 0x23331015, 0x23341015, 0x23391015, 0x233C1015,
+            0x233C1015, 0x23401015, 0x23411015, 0x23421015,
+        },
+        {
+            0x23431015, 0x23441015, 0x23461015, 0x06581015, 0x23231015, 0x232A1015,
+            0x232D1015, 0x23421015, 0x23391015, 0x23341015, 0x2324102D, 0x23241015,
+            0x00000000, 0x00000000, 0x1F981015, 0x1F991015,
+        },
+        {
+            0x1F9A1015, 0x1F9B1015, 0x1F9C1015, 0x1F9D1015, 0x1F9E1015, 0x1F9F1015,
+            0x1FA01015, 0x1FA11015, 0x1F981015, 0x1F991015, 0x1F9A1015, 0x1F9B1015,
+            0x1F9C1015, 0x1F9D1015, 0x1F9E1015, 0x1F9F1015,
+        },
+        {
+            0x1FA01015, 0x1FA11015, 0x1F981015, 0x1F991015, 0x1F9A1015, 0x1F9B1015,
+            0x1F9C1015, 0x1F9D1015, 0x1F9E1015, 0x1F9F1015, 0x1FA01015, 0x1FA11015,
+            0x1F981015, 0x1F991015, 0x1F9A1015, 0x1F9B1015,
+        },
+        {
+            0x1F9C1015, 0x1F9D1015, 0x1F9E1015, 0x1F9F1015, 0x1FA01015, 0x1FA11015,
+            0x1F981015, 0x1F991015, 0x1F9A1015, 0x1F9B1015, 0x1F9C1015, 0x1F9D1015,
+            0x1F9E1015, 0x1F9F1015, 0x1FA01015, 0x1FA11015,
+        },
+        {
+            0x1AFF1009, 0x1B001009, 0x1B011009, 0x1B021009, 0x1B031009, 0x1B041009,
+            0x1B051009, 0x1B061009, 0x1B071009, 0x1B081009, 0x1B091009, 0x1B0A1009,
+            0x1B0B1009, 0x1B0C1009, 0x1B0D1009, 0x1B0E1009,
+        },
+        {
+            0x1B0F1009, 0x1B101009, 0x1B111009, 0x1B121009, 0x1B131009, 0x1B141009,
+            0x1B151009, 0x1B161009, 0x1B171009, 0x1B181009, 0x1B191009, 0x1B1A1009,
+            0x1B1B1009, 0x1B1C1009, 0x1B1D1009, 0x1B1E1009,
+        },
+        {
+            0x1B1F1009, 0x1B201009, 0x1B211009, 0x1B221009, 0x1B231009, 0x1B241009,
+            0x1B251009, 0x1B261009, 0x1B271009, 0x1B281009, 0x1B291009, 0x1B2A1009,
+            0x1B2B1009, 0x1B2C1009, 0x1B2D1009, 0x1B2E1009,
+        },
+        {
+            0x1B2F1009, 0x1B301009, 0x1B311009, 0x1B321009, 0x1B331009, 0x1B341009,
+            0x1B351009, 0x1B361009, 0x1B371009, 0x1B381009, 0x1B391009, 0x1B3A1009,
+            0x1B3B1009, 0x1B3C1009, 0x1B3D1009, 0x1B3E1009,
+        },
+        {
+            0x1B3F1009, 0x1B401009, 0x1B411009, 0x1B421009, 0x1B431009, 0x1B441009,
+            0x1B451009, 0x1B461009, 0x1B471009, 0x1B481009, 0x1B491009, 0x1B4A1009,
+            0x1B4B1009, 0x1B4C1009, 0x1B4D1009, 0x1B4E1009,
+        },
+        {
+            0x1B4F1009, 0x1B501009, 0x1B511009, 0x1B521009, 0x1B531009, 0x1B541009,
+            0x1B551009, 0x1B561009, 0x1B571009, 0x1B581009, 0x1B591009, 0x1B5A1009,
+            0x1B5B1009, 0x1B5C1009, 0x1B5D1009, 0x1B5E1009,
+        },
+        {
+            0x1B5F1009, 0x1B601009, 0x1B611009, 0x1B621009, 0x1B631009, 0x1B641009,
+            0x1B651009, 0x1B661009, 0x1B671009, 0x1B681009, 0x1B691009, 0x1B6A1009,
+            0x1B6B1009, 0x1B6C1009, 0x1B6D1009, 0x1B6E1009,
+        },
+        {
+            0x1B6F1009, 0x1B701009, 0x1B711009, 0x1B721009, 0x1B731009, 0x1B741009,
+            0x1B751009, 0x1B761009, 0x1B771009, 0x1B781009, 0x1B791009, 0x1B7A1009,
+            0x1B7B1009, 0x1B7C1009, 0x1B7D1009, 0x1B7E1009,
+        },
+        {
+            0x1B7F1009, 0x1B801009, 0x1B811009, 0x1B821009, 0x1B831009, 0x1B841009,
+            0x1B851009, 0x1B861009, 0x1B871009, 0x1B881009, 0x1B891009, 0x1B8A1009,
+            0x1B8B1009, 0x1B8C1009, 0x1B8D1009, 0x1B8E1009,
+        },
+        {
+            0x1B8F1009, 0x1B901009, 0x1B911009, 0x1B921009, 0x1B931009, 0x1B941009,
+            0x1B951009, 0x1B961009, 0x1B971009, 0x1B981009, 0x1B991009, 0x1B9A1009,
+            0x1B9B1009, 0x1B9C1009, 0x1B9D1009, 0x1B9E1009,
+        },
+        {
+            0x1B9F1009, 0x1BA01009, 0x1BA11009, 0x1BA21009, 0x1BA31009, 0x1BA41009,
+            0x1BA51009, 0x1BA61009, 0x1BA71009, 0x1BA81009, 0x1BA91009, 0x1BAA1009,
+            0x1BAB1009, 0x1BAC1009, 0x1BAD1009, 0x1BAE1009,
+        },
+        {
+            0x1BAF1009, 0x1BB01009, 0x1BB11009, 0x1BB21009, 0x1BB31009, 0x1BB41009,
+            0x1BB51009, 0x1BB61009, 0x1BB71009, 0x1BB81009, 0x1BB91009, 0x1BBA1009,
+            0x1BBB1009, 0x1BBC1009, 0x1BBD1009, 0x1BBE1009,
+        },
+        {
+            0x1BBF1009, 0x1BC01009, 0x1BC11009, 0x1BC21009, 0x1BC31009, 0x1BC41009,
+            0x1BC51009, 0x1BC61009, 0x1BC71009, 0x1BC81009, 0x1BC91009, 0x1BCA1009,
+            0x1BCB1009, 0x1BCC1009, 0x1BCD1009, 0x1BCE1009,
+        },
+        {
+            0x1BCF1009, 0x1BD01009, 0x1BD11009, 0x1BD21009, 0x1BD31009, 0x1BD41009,
+            0x1BD51009, 0x1BD61009, 0x1BD71009, 0x1BD81009, 0x1BD91009, 0x1BDA1009,
+            0x1BDB1009, 0x1BDC1009, 0x1BDD1009, 0x1BDE1009,
+        },
+        {
+            0x1BDF1009, 0x1BE01009, 0x1BE11009, 0x1BE21009, 0x1BE31009, 0x1BE41009,
+            0x1BE51009, 0x1BE61009, 0x1BE71009, 0x1BE81009, 0x1BE91009, 0x1BEA1009,
+            0x1BEB1009, 0x1BEC1009, 0x1BED1009, 0x1BEE1009,
+        },
+        {
+            0x1BEF1009, 0x1BF01009, 0x1BF11009, 0x1BF21009, 0x1BF31009, 0x1BF41009,
+            0x1BF51009, 0x1BF61009, 0x1BF71009, 0x1BF81009, 0x1BF91009, 0x1BFA1009,
+            0x1BFB1009, 0x1BFC1009, 0x1BFD1009, 0x1BFE1009,
+        },
+        {
+            0x1BFF1009, 0x1C001009, 0x1C011009, 0x1C021009, 0x1C031009, 0x1C041009,
+            0x1C051009, 0x1C061009, 0x1C071009, 0x1C081009, 0x1C091009, 0x1C0A1009,
+            0x1C0B1009, 0x1C0C1009, 0x1C0D1009, 0x1C0E1009,
+        },
+        {
+            0x1C0F1009, 0x1C101009, 0x1C111009, 0x1C121009, 0x1C131009, 0x1C141009,
+            0x1C151009, 0x1C161009, 0x1C171009, 0x1C181009, 0x1C191009, 0x1C1A1009,
+            0x1C1B1009, 0x1C1C1009, 0x1C1D1009, 0x1C1E1009,
+        },
+        {
+            0x1C1F1009, 0x1C201009, 0x1C211009, 0x1C221009, 0x1C231009, 0x1C241009,
+            0x1C251009, 0x1C261009, 0x1C271009, 0x1C281009, 0x1C291009, 0x1C2A1009,
+            0x1C2B1009, 0x1C2C1009, 0x1C2D1009, 0x1C2E1009,
+        },
+        {
+            0x1C2F1009, 0x1C301009, 0x1C311009, 0x1C321009, 0x1C331009, 0x1C341009,
+            0x1C351009, 0x1C361009, 0x1C371009, 0x1C381009, 0x1C391009, 0x1C3A1009,
+            0x1C3B1009, 0x1C3C1009, 0x1C3D1009, 0x1C3E1009,
+        },
+        {
+            0x1C3F1009, 0x1C401009, 0x1C411009, 0x1C421009, 0x1C431009, 0x1C441009,
+            0x1C451009, 0x1C461009, 0x1C471009, 0x1C481009, 0x1C491009, 0x1C4A1009,
+            0x1C4B1009, 0x1C4C1009, 0x1C4D1009, 0x1C4E1009,
+        },
+        {
+            0x1C4F1009, 0x1C501009, 0x1C511009, 0x1C521009, 0x1C531009, 0x1C541009,
+            0x1C551009, 0x1C561009, 0x1C571009, 0x1C581009, 0x1C591009, 0x1C5A1009,
+            0x1C5B1009, 0x1C5C1009, 0x1C5D1009, 0x1C5E1009,
+        },
+        {
+            0x1C5F1009, 0x1C601009, 0x1C611009, 0x1C621009, 0x1C631009, 0x1C641009,
+            0x1C651009, 0x1C661009, 0x1C671009, 0x1C681009, 0x1C691009, 0x1C6A1009,
+            0x1C6B1009, 0x1C6C1009, 0x1C6D1009, 0x1C6E1009,
+        },
+        {
+            0x1C6F1009, 0x1C701009, 0x1C711009, 0x1C721009, 0x1C731009, 0x1C741009,
+            0x1C751009, 0x1C761009, 0x1C771009, 0x1C781009, 0x1C791009, 0x1C7A1009,
+            0x1C7B1009, 0x1C7C1009, 0x1C7D1009, 0x1C7E1009,
+        },
+        {
+            0x1C7F1009, 0x1C801009, 0x1C811009, 0x1C821009, 0x1C831009, 0x1C841009,
+            0x1C851009, 0x1C861009, 0x1C871009, 0x1C881009, 0x1C891009, 0x1C8A1009,
+            0x1C8B1009, 0x1C8C1009, 0x1C8D1009, 0x1C8E1009,
+        },
+        {
+            0x1C8F1009, 0x1C901009, 0x1C911009, 0x1C921009, 0x1C931009, 0x1C941009,
+            0x1C951009, 0x1C961009, 0x1C971009, 0x1C981009, 0x1C991009, 0x1C9A1009,
+            0x1C9B1009, 0x1C9C1009, 0x1C9D1009, 0x1C9E1009,
+        },
+        {
+            0x1C9F1009, 0x1CA01009, 0x1CA11009, 0x1CA21009, 0x1CA31009, 0x1CA41009,
+            0x1CA51009, 0x1CA61009, 0x1CA71009, 0x1CA81009, 0x1CA91009, 0x1CAA1009,
+            0x1CAB1009, 0x1CAC1009, 0x1CAD1009, 0x1CAE1009,
+        },
+        {
+            0x1CAF1009, 0x1CB01009, 0x1CB11009, 0x1CB21009, 0x1CB31009, 0x1CB41009,
+            0x1CB51009, 0x1CB61009, 0x1CB71009, 0x1CB81009, 0x1CB91009, 0x1CBA1009,
+            0x1CBB1009, 0x1CBC1009, 0x1CBD1009, 0x1CBE1009,
+        },
+        {
+            0x1CBF1009, 0x1CC01009, 0x1CC11009, 0x1CC21009, 0x1CC31009, 0x1CC41009,
+            0x1CC51009, 0x1CC61009, 0x1CC71009, 0x1CC81009, 0x1CC91009, 0x1CCA1009,
+            0x1CCB1009, 0x1CCC1009, 0x1CCD1009, 0x1CCE1009,
+        },
+        {
+            0x1CCF1009, 0x1CD01009, 0x1CD11009, 0x1CD21009, 0x1CD31009, 0x1CD41009,
+            0x1CD51009, 0x1CD61009, 0x1CD71009, 0x1CD81009, 0x1CD91009, 0x1CDA1009,
+            0x1CDB1009, 0x1CDC1009, 0x1CDD1009, 0x1CDE1009,
+        },
+        {
+            0x1CDF1009, 0x1CE01009, 0x1CE11009, 0x1CE21009, 0x1CE31009, 0x1CE41009,
+            0x1CE51009, 0x1CE61009, 0x1CE71009, 0x1CE81009, 0x1CE91009, 0x1CEA1009,
+            0x1CEB1009, 0x1CEC1009, 0x1CED1009, 0x1CEE1009,
+        },
+        {
+            0x1CEF1009, 0x1CF01009, 0x1CF11009, 0x1CF21009, 0x1CF31009, 0x1CF41009,
+            0x1CF51009, 0x1CF61009, 0x1CF71009, 0x1CF81009, 0x1CF91009, 0x1CFA1009,
+            0x1CFB1009, 0x1CFC1009, 0x1CFD1009, 0x1CFE1009,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x1CFF1009, 0x1D001009, 0x1D011009, 0x1D021009, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x1D031009, 0x1D041009, 0x1D051009,
+        },
+        {
+            0x1D061009, 0x1D071009, 0x1D081009, 0x1D091009, 0x1D0A1009, 0x00000001,
+            0x1D0B1009, 0x1D0C1009, 0x1D0D1009, 0x1D0E1009, 0x1D0F1009, 0x1D101009,
+            0x1D111009, 0x1D121009, 0x1D131009, 0x1D141009,
+        },
+        {
+            0x1D151009, 0x1D161009, 0x1D171009, 0x1D181009, 0x00000001, 0x1D191009,
+            0x1D1A1009, 0x04AF1009, 0x04B01009, 0x04B11009, 0x04B21009, 0x04B31009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
+            0x00000001, 0x00000001, 0x00000001, 0x00000001,
+        },
+        {
+            0x254A1011, 0x254B1011, 0x254C1011, 0x254D1011, 0x254E1011, 0x254F1011,
+            0x25501011, 0x00000000, 0x25521011, 0x25531011, 0x25541011, 0x25551011,
+            0x25561011, 0x25571011, 0x25581011, 0x25591011,
+        },
+        {
+            0x255A1011, 0x255B1011, 0x255C1011, 0x255D1011, 0x255E1011, 0x255F1011,
+            0x25601011, 0x25611011, 0x25621011, 0x00000000, 0x00000000, 0x25651011,
+            0x25661011, 0x25671011, 0x25681011, 0x25691011,
+        },
+        {
+            0x256A1011, 0x256B1011, 0x00000000, 0x256D1011, 0x256E1011, 0x00000000,
+            0x25701011, 0x25711011, 0x25721011, 0x25731011, 0x25741011, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x4A621009, 0x4A631009, 0x4A641009, 0x4A651009, 0x4A661009, 0x4A671009,
+            0x4A681009, 0x4A691009, 0x4A6A1009, 0x4A6B1009, 0x4A6C1009, 0x4A6D1009,
+            0x4A6E1009, 0x4A6F1009, 0x4A701009, 0x4A711009,
+        },
+        {
+            0x4A721009, 0x4A731009, 0x4A741009, 0x4A751009, 0x4A761009, 0x4A771009,
+            0x4A781009, 0x4A791009, 0x4A7A1009, 0x4A7B1009, 0x4A7C1009, 0x4A7D1009,
+            0x4A7E1009, 0x4A7F1009, 0x4A801009, 0x4A811009,
+        },
+        {
+            0x4A821009, 0x4A831009, 0x4A841009, 0x4A851009, 0x4A861009, 0x4A871009,
+            0x4A881009, 0x4A891009, 0x4A8A1009, 0x4A8B1009, 0x4A8C1009, 0x4A8D1009,
+            0x4A8E1009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00007D09, 0x00007B09, 0x00007C09, 0x00007C89, 0x00007D89, 0x00007E09,
+            0x00007B89, 0x4A8F1009, 0x4A901009, 0x4A911009, 0x4A921009, 0x4A931009,
+            0x1F551009, 0x1F561009, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x4A941009, 0x11231009,
+        },
+        {
+            0x4A951009, 0x4A961009, 0x4A971009, 0x4A981009, 0x4A991009, 0x4A9A1009,
+            0x4A9B1009, 0x4A9C1009, 0x4A9D1009, 0x4A9E1009, 0x4A9F1009, 0x4AA01009,
+            0x4AA11009, 0x4AA21009, 0x4AA31009, 0x4AA41009,
+        },
+        {
+            0x4AA51009, 0x4AA61009, 0x4AA71009, 0x4AA81009, 0x4AA91009, 0x4AAA1009,
+            0x4AAB1009, 0x4AAC1009, 0x4AAD1009, 0x4AAE1009, 0x4AAF1009, 0x4AB01009,
+            0x4AB11009, 0x4AB21009, 0x4AB31009, 0x4AB41009,
+        },
+        {
+            0x4AB51009, 0x4AB61009, 0x4AB71009, 0x4AB81009, 0x4AB91009, 0x4ABA1009,
+            0x4ABB1009, 0x4ABC1009, 0x4ABD1009, 0x4ABE1009, 0x4ABF1009, 0x4AC01009,
+            0x00007E89, 0x00007F09, 0x00007F89, 0x00008009,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x1F771009,
+        },
+        {
+            0x406D1009, 0x406E1009, 0x406F1009, 0x40701009, 0x40711009, 0x40721009,
+            0x40731009, 0x40741009, 0x40751009, 0x40761009, 0x40771009, 0x40781009,
+            0x40791009, 0x407A1009, 0x407B1009, 0x407C1009,
+        },
+        {
+            0x407D1009, 0x407E1009, 0x407F1009, 0x40801009, 0x40811009, 0x40821009,
+            0x40831009, 0x40841009, 0x40851009, 0x40861009, 0x40871009, 0x40881009,
+            0x40891009, 0x408A1009, 0x408B1009, 0x408C1009,
+        },
+        {
+            0x408D1009, 0x408E1009, 0x408F1009, 0x40901009, 0x40911009, 0x40921009,
+            0x40931009, 0x40941009, 0x40951009, 0x40961009, 0x40971009, 0x40981009,
+            0x40991009, 0x409A1009, 0x409B1009, 0x409C1009,
+        },
+        {
+            0x409D1009, 0x409E1009, 0x409F1009, 0x40A01009, 0x40A11009, 0x40A21009,
+            0x40A31009, 0x40A41009, 0x40A51009, 0x40A61009, 0x40A71009, 0x40A81009,
+            0x40A91009, 0x40AA1009, 0x40AB1009, 0x40AC1009,
+        },
+        {
+            0x40AD1009, 0x40AE1009, 0x40AF1009, 0x40B01009, 0x40B11009, 0x40B21009,
+            0x40B31009, 0x40B41009, 0x40B51009, 0x40B61009, 0x40B71009, 0x40B81009,
+            0x40B91009, 0x40BA1009, 0x40BB1009, 0x40BC1009,
+        },
+        {
+            0x40BD1009, 0x40BE1009, 0x40BF1009, 0x40C01009, 0x40C11009, 0x40C21009,
+            0x40C31009, 0x40C41009, 0x40C51009, 0x40C61009, 0x40C71009, 0x40C81009,
+            0x40C91009, 0x40CA1009, 0x40CB1009, 0x40CC1009,
+        },
+        {
+            0x40CD1009, 0x40CE1009, 0x40CF1009, 0x40D01009, 0x40D11009, 0x40D21009,
+            0x40D31009, 0x40D41009, 0x40D51009, 0x40D61009, 0x40D71009, 0x40D81009,
+            0x40D91009, 0x40DA1009, 0x40DB1009, 0x40DC1009,
+        },
+        {
+            0x40DD1009, 0x40DE1009, 0x40DF1009, 0x40E01009, 0x40E11009, 0x40E21009,
+            0x40E31009, 0x40E41009, 0x40E51009, 0x40E61009, 0x40E71009, 0x40E81009,
+            0x40E91009, 0x40EA1009, 0x40EB1009, 0x40EC1009,
+        },
+        {
+            0x40ED1009, 0x40EE1009, 0x40EF1009, 0x40F01009, 0x40F11009, 0x40F21009,
+            0x40F31009, 0x40F41009, 0x40F51009, 0x40F61009, 0x40F71009, 0x40F81009,
+            0x40F91009, 0x40FA1009, 0x40FB1009, 0x40FC1009,
+        },
+        {
+            0x40FD1009, 0x40FE1009, 0x40FF1009, 0x41001009, 0x41011009, 0x41021009,
+            0x41031009, 0x41041009, 0x41051009, 0x41061009, 0x41071009, 0x41081009,
+            0x41091009, 0x410A1009, 0x410B1009, 0x410C1009,
+        },
+        {
+            0x410D1009, 0x410E1009, 0x410F1009, 0x41101009, 0x41111009, 0x41121009,
+            0x41131009, 0x41141009, 0x41151009, 0x41161009, 0x41171009, 0x41181009,
+            0x41191009, 0x411A1009, 0x411B1009, 0x411C1009,
+        },
+        {
+            0x411D1009, 0x411E1009, 0x411F1009, 0x41201009, 0x41211009, 0x41221009,
+            0x41231009, 0x41241009, 0x41251009, 0x41261009, 0x41271009, 0x41281009,
+            0x41291009, 0x412A1009, 0x412B1009, 0x412C1009,
+        },
+        {
+            0x412D1009, 0x412E1009, 0x412F1009, 0x41301009, 0x41311009, 0x00000000,
+            0x00000000, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+        },
+        {
+            0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+            0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x41521021, 0x41531021, 0x41541021, 0x41551021, 0x41561021, 0x41571021,
+            0x41581021, 0x41591021, 0x415A1021, 0x415B1021, 0x415C1021, 0x415D1021,
+            0x415E1021, 0x415F1021, 0x41601021, 0x41611021,
+        },
+        {
+            0x41621021, 0x41631021, 0x41641021, 0x41651021, 0x41661021, 0x41671021,
+            0x41681021, 0x41691021, 0x416A1021, 0x416B1021, 0x416C1021, 0x416D1021,
+            0x416E1021, 0x416F1021, 0x41701021, 0x41711021,
+        },
+        {
+            0x41721021, 0x41731021, 0x41521009, 0x41531009, 0x41541009, 0x41551009,
+            0x41561009, 0x41571009, 0x41581009, 0x41591009, 0x415A1009, 0x415B1009,
+            0x415C1009, 0x415D1009, 0x415E1009, 0x415F1009,
+        },
+        {
+            0x41601009, 0x41611009, 0x41621009, 0x41631009, 0x41641009, 0x41651009,
+            0x41661009, 0x41671009, 0x41681009, 0x41691009, 0x416A1009, 0x416B1009,
+            0x416C1009, 0x416D1009, 0x416E1009, 0x416F1009,
+        },
+        {
+            0x41701009, 0x41711009, 0x41721009, 0x41731009, 0x00005E89, 0x00005E89,
+            0x00005E89, 0x00005F89, 0x00006009, 0x00006089, 0x00005F09, 0x41741009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981009, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x026C1009, 0x027B1009,
+        },
+        {
+            0x00000000, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1E9C1009, 0x1E9D1009,
+            0x1E9E1009, 0x1E9F1009, 0x1EA01009, 0x1EA11009,
+        },
+        {
+            0x1EA21009, 0x1EA31009, 0x1EA41009, 0x1EA51009, 0x1EA61009, 0x1EA71009,
+            0x1EA81009, 0x1EA91009, 0x1EAA1009, 0x1EAB1009, 0x1EAC1009, 0x1EAD1009,
+            0x1EAE1009, 0x1EAF1009, 0x1EB01009, 0x1EB11009,
+        },
+        {
+            0x1EB21009, 0x1EB31009, 0x1EB41009, 0x1EB51009, 0x1EB61009, 0x1EB71009,
+            0x1EB81009, 0x1EB91009, 0x1EBA1009, 0x1EBB1009, 0x1EBC1009, 0x1EBD1009,
+            0x1EBE1009, 0x1EBF1009, 0x1EC01009, 0x1EC11009,
+        },
+        {
+            0x1EC21009, 0x1EC31009, 0x1EC41009, 0x1F991009, 0x1F9A1009, 0x1F9B1009,
+            0x1F9C1009, 0x1F9D1009, 0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009,
+            0x13151009, 0x1EC51009, 0x1EC61009, 0x1EC71009,
+        },
+        {
+            0x1F911009, 0x0043EC0A, 0x0043F40A, 0x1EC81009, 0x1EC91009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x1F991009, 0x1F9A1009, 0x1F9B1009, 0x1F9C1009, 0x1F9D1009,
+            0x1F9E1009, 0x1F9F1009, 0x1FA01009, 0x1FA11009, 0x1ECA1009, 0x1ECB1009,
+            0x1ECC1009, 0x1ECD1009, 0x1ECE1009, 0x1ECF1009,
+        },
+        {
+            0x1ED01009, 0x1ED11009, 0x1ED21009, 0x1ED31009, 0x1ED41009, 0x1ED51009,
+            0x1ED61009, 0x1ED71009, 0x1ED81009, 0x1ED91009, 0x1EDA1009, 0x1EDB1009,
+            0x1EDC1009, 0x1EDD1009, 0x1EDE1009, 0x1EDF1009,
+        },
+        {
+            0x1EE01009, 0x1EE11009, 0x1EE21009, 0x1EE31009, 0x1EE41009, 0x1EE51009,
+            0x1EE61009, 0x1EE71009, 0x1EE81009, 0x1EE91009, 0x1EEA1009, 0x1EEB1009,
+            0x1EEC1009, 0x1EED1009, 0x13161009, 0x0043F40A,
+        },
+        {
+            0x0044040A, 0x00440C0A, 0x0044140A, 0x00441C0A, 0x0044240A, 0x00442C0A,
+            0x0044340A, 0x1EEE1009, 0x1EEF1009, 0x1EF01009, 0x1EF11009, 0x1EF21009,
+            0x1EF31009, 0x1EF41009, 0x00000000, 0x00000000,
+        },
+        {
+            0x26721015, 0x26741015, 0x268F1015, 0x26A41015, 0x00000000, 0x27281015,
+            0x26B41015, 0x26991015, 0x26D71015, 0x27371015, 0x26F61015, 0x270C1015,
+            0x27141015, 0x27181015, 0x26C61015, 0x26DB1015,
+        },
+        {
+            0x26E41015, 0x26D11015, 0x26F01015, 0x26B31015, 0x26C71015, 0x26851015,
+            0x26861015, 0x269A1015, 0x26A51015, 0x26D21015, 0x26D81015, 0x26DC1015,
+            0x26731015, 0x27191015, 0x26E51015, 0x26EF1015,
+        },
+        {
+            0x00000000, 0x26741015, 0x268F1015, 0x00000000, 0x27221015, 0x00000000,
+            0x00000000, 0x26991015, 0x00000000, 0x27371015, 0x26F61015, 0x270C1015,
+            0x27141015, 0x27181015, 0x26C61015, 0x26DB1015,
+        },
+        {
+            0x26E41015, 0x26D11015, 0x26F01015, 0x00000000, 0x26C71015, 0x26851015,
+            0x26861015, 0x269A1015, 0x00000000, 0x26D21015, 0x00000000, 0x26DC1015,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x268F1015, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x26991015, 0x00000000, 0x27371015, 0x00000000, 0x270C1015,
+            0x00000000, 0x27181015, 0x26C61015, 0x26DB1015,
+        },
+        {
+            0x00000000, 0x26D11015, 0x26F01015, 0x00000000, 0x26C71015, 0x00000000,
+            0x00000000, 0x269A1015, 0x00000000, 0x26D21015, 0x00000000, 0x26DC1015,
+            0x00000000, 0x27191015, 0x00000000, 0x26EF1015,
+        },
+        {
+            0x00000000, 0x26741015, 0x268F1015, 0x00000000, 0x27221015, 0x00000000,
+            0x00000000, 0x26991015, 0x26D71015, 0x27371015, 0x26F61015, 0x00000000,
+            0x27141015, 0x27181015, 0x26C61015, 0x26DB1015,
+        },
+        {
+            0x26E41015, 0x26D11015, 0x26F01015, 0x00000000, 0x26C71015, 0x26851015,
+            0x26861015, 0x269A1015, 0x00000000, 0x26D21015, 0x26D81015, 0x26DC1015,
+            0x26731015, 0x00000000, 0x26E51015, 0x00000000,
+        },
+        {
+            0x26721015, 0x26741015, 0x268F1015, 0x26A41015, 0x27221015, 0x27281015,
+            0x26B41015, 0x26991015, 0x26D71015, 0x27371015, 0x00000000, 0x270C1015,
+            0x27141015, 0x27181015, 0x26C61015, 0x26DB1015,
+        },
+        {
+            0x26E41015, 0x26D11015, 0x26F01015, 0x26B31015, 0x26C71015, 0x26851015,
+            0x26861015, 0x269A1015, 0x26A51015, 0x26D21015, 0x26D81015, 0x26DC1015,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x26741015, 0x268F1015, 0x26A41015, 0x00000000, 0x27281015,
+            0x26B41015, 0x26991015, 0x26D71015, 0x27371015, 0x00000000, 0x270C1015,
+            0x27141015, 0x27181015, 0x26C61015, 0x26DB1015,
+        },
+        {
+            0x052F1009, 0x05301009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x13171009, 0x13181009, 0x13191009, 0x131A1009, 0x131B1009, 0x131C1009,
+            0x131D1009, 0x131E1009, 0x131F1009, 0x13201009, 0x13211009, 0x13221009,
+            0x13231009, 0x13241009, 0x13251009, 0x13261009,
+        },
+        {
+            0x13271009, 0x13281009, 0x13291009, 0x132A1009, 0x132B1009, 0x132C1009,
+            0x132D1009, 0x132E1009, 0x132F1009, 0x13301009, 0x13311009, 0x13321009,
+            0x13331009, 0x13341009, 0x13351009, 0x13361009,
+        },
+        {
+            0x13371009, 0x13381009, 0x13391009, 0x133A1009, 0x133B1009, 0x133C1009,
+            0x133D1009, 0x133E1009, 0x133F1009, 0x13401009, 0x13411009, 0x13421009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x13431009, 0x13441009, 0x13451009, 0x13461009, 0x13471009, 0x13481009,
+            0x13491009, 0x134A1009, 0x134B1009, 0x134C1009, 0x134D1009, 0x134E1009,
+            0x134F1009, 0x13501009, 0x13511009, 0x13521009,
+        },
+        {
+            0x13531009, 0x13541009, 0x13551009, 0x13561009, 0x13571009, 0x13581009,
+            0x13591009, 0x135A1009, 0x135B1009, 0x135C1009, 0x135D1009, 0x135E1009,
+            0x135F1009, 0x13601009, 0x13611009, 0x13621009,
+        },
+        {
+            0x13631009, 0x13641009, 0x13651009, 0x13661009, 0x13671009, 0x13681009,
+            0x13691009, 0x136A1009, 0x136B1009, 0x136C1009, 0x136D1009, 0x136E1009,
+            0x136F1009, 0x13701009, 0x13711009, 0x13721009,
+        },
+        {
+            0x13731009, 0x13741009, 0x13751009, 0x13761009, 0x13771009, 0x13781009,
+            0x13791009, 0x137A1009, 0x137B1009, 0x137C1009, 0x137D1009, 0x137E1009,
+            0x137F1009, 0x13801009, 0x13811009, 0x13821009,
+        },
+        {
+            0x13831009, 0x13841009, 0x13851009, 0x13861009, 0x13871009, 0x13881009,
+            0x13891009, 0x138A1009, 0x138B1009, 0x138C1009, 0x138D1009, 0x138E1009,
+            0x138F1009, 0x13901009, 0x13911009, 0x13921009,
+        },
+        {
+            0x13931009, 0x13941009, 0x13951009, 0x13961009, 0x13971009, 0x13981009,
+            0x13991009, 0x139A1009, 0x139B1009, 0x139C1009, 0x139D1009, 0x139E1009,
+            0x139F1009, 0x13A01009, 0x13A11009, 0x13A21009,
+        },
+        {
+            0x13A31009, 0x13A41009, 0x13A51009, 0x13A61009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x13A71009, 0x13A81009, 0x13A91009, 0x13AA1009, 0x13AB1009, 0x13AC1009,
+            0x13AD1009, 0x13AE1009, 0x13AF1009, 0x13B01009, 0x13B11009, 0x13B21009,
+            0x13B31009, 0x13B41009, 0x13B51009, 0x00000000,
+        },
+        {
+            0x00000000, 0x13B61009, 0x13B71009, 0x13B81009, 0x13B91009, 0x13BA1009,
+            0x13BB1009, 0x13BC1009, 0x13BD1009, 0x13BE1009, 0x13BF1009, 0x13C01009,
+            0x13C11009, 0x13C21009, 0x13C31009, 0x13C41009,
+        },
+        {
+            0x00000000, 0x13C51009, 0x13C61009, 0x13C71009, 0x13C81009, 0x13C91009,
+            0x13CA1009, 0x13CB1009, 0x13CC1009, 0x13CD1009, 0x13CE1009, 0x13CF1009,
+            0x13D01009, 0x13D11009, 0x13D21009, 0x13D31009,
+        },
+        {
+            0x00000000, 0x13D41009, 0x13D51009, 0x13D61009, 0x13D71009, 0x13D81009,
+            0x13D91009, 0x13DA1009, 0x13DB1009, 0x13DC1009, 0x13DD1009, 0x13DE1009,
+            0x13DF1009, 0x13E01009, 0x13E11009, 0x13E21009,
+        },
+        {
+            0x13E31009, 0x13E41009, 0x13E51009, 0x13E61009, 0x13E71009, 0x13E81009,
+            0x13E91009, 0x13EA1009, 0x13EB1009, 0x13EC1009, 0x13ED1009, 0x13EE1009,
+            0x13EF1009, 0x13F01009, 0x13F11009, 0x13F21009,
+        },
+        {
+            0x13F31009, 0x13F41009, 0x13F51009, 0x13F61009, 0x13F71009, 0x13F81009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00443C0A, 0x0044440A, 0x00444C0A, 0x0044540A, 0x00445C0A, 0x0044640A,
+            0x00446C0A, 0x0044740A, 0x00447C0A, 0x0044840A, 0x00448C0A, 0x1F981019,
+            0x1F981019, 0x145B1009, 0x145C1009, 0x145D1009,
+        },
+        {
+            0x0044940E, 0x0044A00E, 0x0044AC0E, 0x0044B80E, 0x0044C40E, 0x0044D00E,
+            0x0044DC0E, 0x0044E80E, 0x0044F40E, 0x0045000E, 0x00450C0E, 0x0045180E,
+            0x0045240E, 0x0045300E, 0x00453C0E, 0x0045480E,
+        },
+        {
+            0x0045540E, 0x0045600E, 0x00456C0E, 0x0045780E, 0x0045840E, 0x0045900E,
+            0x00459C0E, 0x0045A80E, 0x0045B40E, 0x0045C00E, 0x0045CC0E, 0x1FD61031,
+            0x21931031, 0x0045D80A, 0x0045E00A, 0x05D31009,
+        },
+        {
+            0x1FA21075, 0x1FBC1075, 0x1FD61075, 0x1FEB1075, 0x20071075, 0x20421075,
+            0x20511075, 0x20751075, 0x20901075, 0x20AB1075, 0x20C41075, 0x20D61075,
+            0x21091075, 0x21181075, 0x213C1075, 0x216B1075,
+        },
+        {
+            0x21801075, 0x21931075, 0x21D21075, 0x21F71075, 0x22171075, 0x22471075,
+            0x22591075, 0x22641075, 0x22701075, 0x22861075, 0x0045E80A, 0x0029800A,
+            0x0045F00A, 0x0045F80A, 0x0046000E, 0x00460C0A,
+        },
+        {
+            0x1FA21031, 0x1FBC1031, 0x1FD61031, 0x1FEB1031, 0x20071031, 0x20421031,
+            0x20511031, 0x20751031, 0x20901031, 0x20AB1031, 0x20C41031, 0x20D61031,
+            0x21091031, 0x21181031, 0x213C1031, 0x216B1031,
+        },
+        {
+            0x21801031, 0x21931031, 0x21D21031, 0x21F71031, 0x22171031, 0x22471031,
+            0x22591031, 0x22641031, 0x22701031, 0x22861031, 0x0046140A, 0x00461C0A,
+            0x0046240A, 0x145E1009, 0x145F1009, 0x14601009,
+        },
+        {
+            0x21801075, 0x21931075, 0x21D21075, 0x21F71075, 0x22171075, 0x22471075,
+            0x22591075, 0x22641075, 0x22701075, 0x22861075, 0x216B1075, 0x00462C0A,
+            0x0046340A, 0x00463C0A, 0x0046440A, 0x00460C0A,
+        },
+        {
+            0x00464C0A, 0x0046540A, 0x00465C12, 0x00466C12, 0x00467C0A, 0x0046840E,
+            0x0046900A, 0x0046980A, 0x0046A00E, 0x0046AC0E, 0x0046B80A, 0x0046C00A,
+            0x0046C81E, 0x0046E40A, 0x0046EC0A, 0x0046F40A,
+        },
+        {
+            0x0046FC0E, 0x0047080E, 0x00471412, 0x0047240E, 0x00473012, 0x1FEB1071,
+            0x0047400A, 0x0047480E, 0x0047541A, 0x00476C22, 0x00478C0E, 0x0047980E,
+            0x0047A40E, 0x05D51009, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x0B221009, 0x0B231009, 0x0B241009, 0x0B251009, 0x0B261009, 0x0B271009,
+            0x0B281009, 0x0B291009, 0x0B2A1009, 0x0B2B1009,
+        },
+        {
+            0x0B2C1009, 0x0B2D1009, 0x0B2E1009, 0x0B2F1009, 0x0B301009, 0x0B311009,
+            0x0B321009, 0x0B331009, 0x0B341009, 0x0B351009, 0x0B361009, 0x0B371009,
+            0x0B381009, 0x0B391009, 0x0B3A1009, 0x0B3B1009,
+        },
+        {
+            0x0047B00A, 0x0047B80A, 0x42E51071, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x0047C00A, 0x0047C80A, 0x0047D00A, 0x0047D80A, 0x0047E00A, 0x0047E80A,
+            0x0047F00A, 0x0047F80A, 0x0048000A, 0x0048080A, 0x0048100A, 0x0048180A,
+            0x0048200A, 0x0048280A, 0x0048300A, 0x0048380A,
+        },
+        {
+            0x0048400A, 0x0048480A, 0x0048500A, 0x0048580A, 0x0048600A, 0x0048680A,
+            0x0048700A, 0x0048780A, 0x0048800A, 0x0048880A, 0x0048900A, 0x0048980A,
+            0x0048A00A, 0x0048A80A, 0x0048B00A, 0x0048B80A,
+        },
+        {
+            0x0048C00A, 0x0048C80A, 0x0048D00A, 0x0048D80A, 0x0048E00A, 0x0048E80A,
+            0x0048F00A, 0x0048F80A, 0x0049000A, 0x0049080A, 0x0049100A, 0x0049180A,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00492012, 0x00493012, 0x00494012, 0x00495012, 0x00496012, 0x00497012,
+            0x00498012, 0x00499012, 0x0049A012, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x0049B00A, 0x0049B80A, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x14611009, 0x14621009, 0x14631009, 0x14641009, 0x14651009, 0x14661009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x14671009, 0x14681009, 0x14691009, 0x146A1009, 0x146B1009, 0x146C1009,
+            0x146D1009, 0x146E1009, 0x146F1009, 0x14701009, 0x14711009, 0x14721009,
+            0x14731009, 0x14741009, 0x14751009, 0x14761009,
+        },
+        {
+            0x14771009, 0x14781009, 0x14791009, 0x147A1009, 0x147B1009, 0x147C1009,
+            0x147D1009, 0x147E1009, 0x147F1009, 0x14801009, 0x14811009, 0x14821009,
+            0x14831009, 0x14841009, 0x14851009, 0x14861009,
+        },
+        {
+            0x14871009, 0x14881009, 0x14891009, 0x148A1009, 0x148B1009, 0x148C1009,
+            0x148D1009, 0x148E1009, 0x148F1009, 0x14901009, 0x14911009, 0x14921009,
+            0x14931009, 0x14941009, 0x14951009, 0x14961009,
+        },
+        {
+            0x14971009, 0x14981009, 0x14991009, 0x149A1009, 0x149B1009, 0x149C1009,
+            0x149D1009, 0x149E1009, 0x149F1009, 0x14A01009, 0x14A11009, 0x14A21009,
+            0x14A31009, 0x14A41009, 0x14A51009, 0x14A61009,
+        },
+        {
+            0x14A71009, 0x14A81009, 0x14A91009, 0x14AA1009, 0x14AB1009, 0x14AC1009,
+            0x14AD1009, 0x14AE1009, 0x14AF1009, 0x14B01009, 0x14B11009, 0x14B21009,
+            0x14B31009, 0x14B41009, 0x14B51009, 0x14B61009,
+        },
+        {
+            0x14B71009, 0x14B81009, 0x14B91009, 0x14BA1009, 0x14BB1009, 0x14BC1009,
+            0x14BD1009, 0x14BE1009, 0x14BF1009, 0x14C01009, 0x14C11009, 0x14C21009,
+            0x14C31009, 0x14C41009, 0x14C51009, 0x14C61009,
+        },
+        {
+            0x14C71009, 0x14C81009, 0x14C91009, 0x14CA1009, 0x14CB1009, 0x14CC1009,
+            0x14CD1009, 0x14CE1009, 0x14CF1009, 0x14D01009, 0x14D11009, 0x14D21009,
+            0x14D31009, 0x14D41009, 0x14D51009, 0x14D61009,
+        },
+        {
+            0x14D71009, 0x14D81009, 0x14D91009, 0x14DA1009, 0x14DB1009, 0x14DC1009,
+            0x14DD1009, 0x14DE1009, 0x14DF1009, 0x14E01009, 0x14E11009, 0x14E21009,
+            0x14E31009, 0x14E41009, 0x14E51009, 0x14E61009,
+        },
+        {
+            0x14E71009, 0x14E81009, 0x14E91009, 0x14EA1009, 0x14EB1009, 0x14EC1009,
+            0x14ED1009, 0x14EE1009, 0x14EF1009, 0x14F01009, 0x14F11009, 0x14F21009,
+            0x14F31009, 0x14F41009, 0x14F51009, 0x14F61009,
+        },
+        {
+            0x14F71009, 0x14F81009, 0x14F91009, 0x14FA1009, 0x14FB1009, 0x14FC1009,
+            0x14FD1009, 0x14FE1009, 0x14FF1009, 0x15001009, 0x15011009, 0x15021009,
+            0x15031009, 0x15041009, 0x15051009, 0x15061009,
+        },
+        {
+            0x15071009, 0x15081009, 0x15091009, 0x150A1009, 0x150B1009, 0x150C1009,
+            0x150D1009, 0x150E1009, 0x150F1009, 0x15101009, 0x15111009, 0x15121009,
+            0x15131009, 0x15141009, 0x15151009, 0x15161009,
+        },
+        {
+            0x15171009, 0x15181009, 0x15191009, 0x151A1009, 0x151B1009, 0x151C1009,
+            0x151D1009, 0x151E1009, 0x151F1009, 0x15201009, 0x15211009, 0x15221009,
+            0x15231009, 0x15241009, 0x15251009, 0x15261009,
+        },
+        {
+            0x15271009, 0x15281009, 0x15291009, 0x152A1009, 0x152B1009, 0x152C1009,
+            0x152D1009, 0x152E1009, 0x152F1009, 0x15301009, 0x15311009, 0x15321009,
+            0x15331009, 0x15341009, 0x15351009, 0x15361009,
+        },
+        {
+            0x15371009, 0x15381009, 0x15391009, 0x153A1009, 0x153B1009, 0x153C1009,
+            0x153D1009, 0x153E1009, 0x153F1009, 0x15401009, 0x15411009, 0x15421009,
+            0x15431009, 0x15441009, 0x15451009, 0x15461009,
+        },
+        {
+            0x15471009, 0x15481009, 0x15491009, 0x154A1009, 0x154B1009, 0x154C1009,
+            0x154D1009, 0x154E1009, 0x154F1009, 0x15501009, 0x15511009, 0x15521009,
+            0x15531009, 0x15541009, 0x15551009, 0x15561009,
+        },
+        {
+            0x15571009, 0x15581009, 0x15591009, 0x155A1009, 0x155B1009, 0x155C1009,
+            0x155D1009, 0x155E1009, 0x155F1009, 0x15601009, 0x15611009, 0x15621009,
+            0x15631009, 0x15641009, 0x15651009, 0x15661009,
+        },
+        {
+            0x15671009, 0x15681009, 0x15691009, 0x156A1009, 0x156B1009, 0x156C1009,
+            0x156D1009, 0x156E1009, 0x156F1009, 0x15701009, 0x15711009, 0x15721009,
+            0x15731009, 0x15741009, 0x15751009, 0x15761009,
+        },
+        {
+            0x15771009, 0x15781009, 0x15791009, 0x157A1009, 0x157B1009, 0x157C1009,
+            0x157D1009, 0x157E1009, 0x157F1009, 0x15801009, 0x15811009, 0x15821009,
+            0x15831009, 0x15841009, 0x15851009, 0x15861009,
+        },
+        {
+            0x15871009, 0x15881009, 0x15891009, 0x158A1009, 0x158B1009, 0x158C1009,
+            0x158D1009, 0x158E1009, 0x158F1009, 0x15901009, 0x15911009, 0x15921009,
+            0x15931009, 0x15941009, 0x15951009, 0x15961009,
+        },
+        {
+            0x15971009, 0x15981009, 0x15991009, 0x159A1009, 0x159B1009, 0x159C1009,
+            0x159D1009, 0x159E1009, 0x159F1009, 0x15A01009, 0x15A11009, 0x15A21009,
+            0x15A31009, 0x15A41009, 0x15A51009, 0x15A61009,
+        },
+        {
+            0x15A71009, 0x15A81009, 0x15A91009, 0x15AA1009, 0x15AB1009, 0x15AC1009,
+            0x15AD1009, 0x15AE1009, 0x15AF1009, 0x15B01009, 0x15B11009, 0x15B21009,
+            0x15B31009, 0x15B41009, 0x15B51009, 0x15B61009,
+        },
+        {
+            0x15B71009, 0x15B81009, 0x15B91009, 0x15BA1009, 0x15BB1009, 0x15BC1009,
+            0x15BD1009, 0x15BE1009, 0x15BF1009, 0x15C01009, 0x15C11009, 0x15C21009,
+            0x15C31009, 0x15C41009, 0x15C51009, 0x15C61009,
+        },
+        {
+            0x15C71009, 0x15C81009, 0x15C91009, 0x15CA1009, 0x15CB1009, 0x15CC1009,
+            0x15CD1009, 0x15CE1009, 0x15CF1009, 0x15D01009, 0x15D11009, 0x15D21009,
+            0x15D31009, 0x15D41009, 0x15D51009, 0x15D61009,
+        },
+        {
+            0x15D71009, 0x15D81009, 0x15D91009, 0x15DA1009, 0x15DB1009, 0x15DC1009,
+            0x15DD1009, 0x15DE1009, 0x15DF1009, 0x15E01009, 0x15E11009, 0x15E21009,
+            0x15E31009, 0x15E41009, 0x15E51009, 0x15E61009,
+        },
+        {
+            0x15E71009, 0x15E81009, 0x15E91009, 0x15EA1009, 0x15EB1009, 0x15EC1009,
+            0x15ED1009, 0x15EE1009, 0x15EF1009, 0x15F01009, 0x15F11009, 0x15F21009,
+            0x15F31009, 0x15F41009, 0x15F51009, 0x15F61009,
+        },
+        {
+            0x15F71009, 0x15F81009, 0x15F91009, 0x15FA1009, 0x15FB1009, 0x15FC1009,
+            0x15FD1009, 0x15FE1009, 0x15FF1009, 0x16001009, 0x16011009, 0x16021009,
+            0x16031009, 0x16041009, 0x16051009, 0x16061009,
+        },
+        {
+            0x16071009, 0x16081009, 0x16091009, 0x160A1009, 0x160B1009, 0x160C1009,
+            0x160D1009, 0x160E1009, 0x160F1009, 0x16101009, 0x16111009, 0x16121009,
+            0x16131009, 0x16141009, 0x16151009, 0x16161009,
+        },
+        {
+            0x16171009, 0x16181009, 0x16191009, 0x161A1009, 0x161B1009, 0x161C1009,
+            0x161D1009, 0x161E1009, 0x161F1009, 0x16201009, 0x16211009, 0x16221009,
+            0x16231009, 0x16241009, 0x16251009, 0x16261009,
+        },
+        {
+            0x16271009, 0x16281009, 0x16291009, 0x162A1009, 0x162B1009, 0x162C1009,
+            0x162D1009, 0x162E1009, 0x162F1009, 0x16301009, 0x16311009, 0x16321009,
+            0x16331009, 0x16341009, 0x16351009, 0x16361009,
+        },
+        {
+            0x16371009, 0x16381009, 0x16391009, 0x163A1009, 0x163B1009, 0x163C1009,
+            0x163D1009, 0x163E1009, 0x163F1009, 0x16401009, 0x16411009, 0x16421009,
+            0x16431009, 0x16441009, 0x16451009, 0x16461009,
+        },
+        {
+            0x16471009, 0x16481009, 0x16491009, 0x164A1009, 0x164B1009, 0x164C1009,
+            0x164D1009, 0x164E1009, 0x164F1009, 0x16501009, 0x16511009, 0x16521009,
+            0x16531009, 0x16541009, 0x16551009, 0x16561009,
+        },
+        {
+            0x16571009, 0x16581009, 0x16591009, 0x165A1009, 0x165B1009, 0x165C1009,
+            0x165D1009, 0x165E1009, 0x165F1009, 0x16601009, 0x16611009, 0x16621009,
+            0x16631009, 0x16641009, 0x16651009, 0x16661009,
+        },
+        {
+            0x16671009, 0x16681009, 0x16691009, 0x166A1009, 0x166B1009, 0x166C1009,
+            0x166D1009, 0x166E1009, 0x166F1009, 0x16701009, 0x16711009, 0x16721009,
+            0x16731009, 0x16741009, 0x16751009, 0x16761009,
+        },
+        {
+            0x16771009, 0x16781009, 0x16791009, 0x167A1009, 0x167B1009, 0x167C1009,
+            0x167D1009, 0x167E1009, 0x167F1009, 0x16801009, 0x16811009, 0x16821009,
+            0x16831009, 0x16841009, 0x16851009, 0x16861009,
+        },
+        {
+            0x16871009, 0x16881009, 0x16891009, 0x168A1009, 0x168B1009, 0x168C1009,
+            0x168D1009, 0x168E1009, 0x168F1009, 0x16901009, 0x16911009, 0x16921009,
+            0x16931009, 0x16941009, 0x16951009, 0x16961009,
+        },
+        {
+            0x16971009, 0x16981009, 0x16991009, 0x169A1009, 0x169B1009, 0x169C1009,
+            0x169D1009, 0x169E1009, 0x169F1009, 0x16A01009, 0x16A11009, 0x16A21009,
+            0x16A31009, 0x16A41009, 0x16A51009, 0x16A61009,
+        },
+        {
+            0x16A71009, 0x16A81009, 0x16A91009, 0x16AA1009, 0x16AB1009, 0x16AC1009,
+            0x16AD1009, 0x16AE1009, 0x16AF1009, 0x16B01009, 0x16B11009, 0x16B21009,
+            0x16B31009, 0x16B41009, 0x16B51009, 0x16B61009,
+        },
+        {
+            0x16B71009, 0x16B81009, 0x16B91009, 0x16BA1009, 0x16BB1009, 0x16BC1009,
+            0x16BD1009, 0x16BE1009, 0x16BF1009, 0x16C01009, 0x16C11009, 0x16C21009,
+            0x16C31009, 0x16C41009, 0x16C51009, 0x16C61009,
+        },
+        {
+            0x16C71009, 0x16C81009, 0x16C91009, 0x16CA1009, 0x16CB1009, 0x16CC1009,
+            0x16CD1009, 0x16CE1009, 0x16CF1009, 0x16D01009, 0x16D11009, 0x16D21009,
+            0x16D31009, 0x16D41009, 0x16D51009, 0x16D61009,
+        },
+        {
+            0x16D71009, 0x16D81009, 0x16D91009, 0x16DA1009, 0x16DB1009, 0x16DC1009,
+            0x16DD1009, 0x16DE1009, 0x16DF1009, 0x16E01009, 0x16E11009, 0x16E21009,
+            0x16E31009, 0x16E41009, 0x16E51009, 0x16E61009,
+        },
+        {
+            0x16E71009, 0x16E81009, 0x16E91009, 0x16EA1009, 0x16EB1009, 0x16EC1009,
+            0x16ED1009, 0x16EE1009, 0x16EF1009, 0x16F01009, 0x16F11009, 0x16F21009,
+            0x16F31009, 0x16F41009, 0x16F51009, 0x16F61009,
+        },
+        {
+            0x16F71009, 0x16F81009, 0x16F91009, 0x16FA1009, 0x16FB1009, 0x16FC1009,
+            0x16FD1009, 0x16FE1009, 0x16FF1009, 0x17001009, 0x17011009, 0x17021009,
+            0x17031009, 0x17041009, 0x17051009, 0x17061009,
+        },
+        {
+            0x17071009, 0x17081009, 0x17091009, 0x170A1009, 0x170B1009, 0x170C1009,
+            0x170D1009, 0x170E1009, 0x170F1009, 0x17101009, 0x17111009, 0x17121009,
+            0x17131009, 0x17141009, 0x17151009, 0x17161009,
+        },
+        {
+            0x17171009, 0x17181009, 0x17191009, 0x171A1009, 0x171B1009, 0x171C1009,
+            0x171D1009, 0x171E1009, 0x171F1009, 0x17201009, 0x17211009, 0x17221009,
+            0x17231009, 0x17241009, 0x17251009, 0x17261009,
+        },
+        {
+            0x17271009, 0x17281009, 0x17291009, 0x172A1009, 0x172B1009, 0x172C1009,
+            0x172D1009, 0x172E1009, 0x172F1009, 0x17301009, 0x17311009, 0x17321009,
+            0x17331009, 0x17341009, 0x17351009, 0x17361009,
+        },
+        {
+            0x17371009, 0x17381009, 0x17391009, 0x173A1009, 0x173B1009, 0x173C1009,
+            0x173D1009, 0x173E1009, 0x173F1009, 0x17401009, 0x17411009, 0x17421009,
+            0x17431009, 0x17441009, 0x17451009, 0x17461009,
+        },
+        {
+            0x17471009, 0x17481009, 0x17491009, 0x174A1009, 0x174B1009, 0x174C1009,
+            0x174D1009, 0x174E1009, 0x174F1009, 0x17501009, 0x17511009, 0x17521009,
+            0x17531009, 0x17541009, 0x17551009, 0x17561009,
+        },
+        {
+            0x17571009, 0x17581009, 0x17591009, 0x175A1009, 0x175B1009, 0x175C1009,
+            0x175D1009, 0x175E1009, 0x175F1009, 0x17601009, 0x17611009, 0x17621009,
+            0x17631009, 0x17641009, 0x17651009, 0x17661009,
+        },
+        {
+            0x189E1009, 0x189F1009, 0x18A01009, 0x18A11009, 0x18A21009, 0x18A31009,
+            0x18A41009, 0x18A51009, 0x18A61009, 0x18A71009, 0x18A81009, 0x18A91009,
+            0x18AA1009, 0x18AB1009, 0x18AC1009, 0x18AD1009,
+        },
+        {
+            0x18AE1009, 0x18AF1009, 0x18B01009, 0x18B11009, 0x18B21009, 0x18B31009,
+            0x18B41009, 0x18B51009, 0x18B61009, 0x18B71009, 0x18B81009, 0x18B91009,
+            0x18BA1009, 0x18BB1009, 0x18BC1009, 0x18BD1009,
+        },
+        {
+            0x18BE1009, 0x18BF1009, 0x18C01009, 0x18C11009, 0x18C21009, 0x18C31009,
+            0x18C41009, 0x18C51009, 0x18C61009, 0x18C71009, 0x18C81009, 0x18C91009,
+            0x18CA1009, 0x18CB1009, 0x18CC1009, 0x18CD1009,
+        },
+        {
+            0x18CE1009, 0x18CF1009, 0x18D01009, 0x18D11009, 0x18D21009, 0x18D31009,
+            0x18D41009, 0x18D51009, 0x18D61009, 0x18D71009, 0x18D81009, 0x18D91009,
+            0x18DA1009, 0x18DB1009, 0x18DC1009, 0x18DD1009,
+        },
+        {
+            0x18DE1009, 0x18DF1009, 0x18E01009, 0x18E11009, 0x18E21009, 0x18E31009,
+            0x18E41009, 0x18E51009, 0x18E61009, 0x18E71009, 0x18E81009, 0x18E91009,
+            0x18EA1009, 0x18EB1009, 0x18EC1009, 0x18ED1009,
+        },
+        {
+            0x18EE1009, 0x18EF1009, 0x18F01009, 0x18F11009, 0x18F21009, 0x18F31009,
+            0x18F41009, 0x18F51009, 0x18F61009, 0x18F71009, 0x18F81009, 0x18F91009,
+            0x18FA1009, 0x18FB1009, 0x18FC1009, 0x18FD1009,
+        },
+        {
+            0x18FE1009, 0x18FF1009, 0x19001009, 0x19011009, 0x19021009, 0x19031009,
+            0x19041009, 0x19051009, 0x19061009, 0x19071009, 0x19081009, 0x19091009,
+            0x190A1009, 0x190B1009, 0x190C1009, 0x190D1009,
+        },
+        {
+            0x190E1009, 0x190F1009, 0x19101009, 0x19111009, 0x19121009, 0x19131009,
+            0x19141009, 0x19151009, 0x19161009, 0x19171009, 0x19181009, 0x19191009,
+            0x191A1009, 0x191B1009, 0x191C1009, 0x191D1009,
+        },
+        {
+            0x191E1009, 0x191F1009, 0x19201009, 0x19211009, 0x19221009, 0x19231009,
+            0x19241009, 0x19251009, 0x19261009, 0x19271009, 0x19281009, 0x19291009,
+            0x192A1009, 0x192B1009, 0x192C1009, 0x192D1009,
+        },
+        {
+            0x192E1009, 0x192F1009, 0x19301009, 0x19311009, 0x19321009, 0x19331009,
+            0x19341009, 0x19351009, 0x19361009, 0x19371009, 0x19381009, 0x19391009,
+            0x193A1009, 0x193B1009, 0x193C1009, 0x193D1009,
+        },
+        {
+            0x193E1009, 0x193F1009, 0x19401009, 0x19411009, 0x19421009, 0x19431009,
+            0x19441009, 0x19451009, 0x19461009, 0x19471009, 0x19481009, 0x19491009,
+            0x194A1009, 0x194B1009, 0x194C1009, 0x194D1009,
+        },
+        {
+            0x194E1009, 0x194F1009, 0x19501009, 0x19511009, 0x19521009, 0x19531009,
+            0x19541009, 0x19551009, 0x19561009, 0x19571009, 0x19581009, 0x19591009,
+            0x195A1009, 0x195B1009, 0x195C1009, 0x195D1009,
+        },
+        {
+            0x195E1009, 0x195F1009, 0x19601009, 0x19611009, 0x19621009, 0x19631009,
+            0x19641009, 0x19651009, 0x19661009, 0x19671009, 0x19681009, 0x19691009,
+            0x196A1009, 0x196B1009, 0x196C1009, 0x196D1009,
+        },
+        {
+            0x196E1009, 0x196F1009, 0x19701009, 0x19711009, 0x19721009, 0x19731009,
+            0x19741009, 0x19751009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x19761009, 0x19771009, 0x19781009, 0x19791009, 0x197A1009, 0x197B1009,
+            0x197C1009, 0x197D1009, 0x197E1009, 0x197F1009, 0x19801009, 0x19811009,
+            0x19821009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x19831009, 0x19841009, 0x19851009, 0x19861009, 0x19871009, 0x19881009,
+            0x19891009, 0x198A1009, 0x198B1009, 0x198C1009, 0x198D1009, 0x198E1009,
+            0x198F1009, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x19901009, 0x19911009, 0x19921009, 0x19931009, 0x19941009, 0x19951009,
+            0x19961009, 0x19971009, 0x19981009, 0x19991009, 0x199A1009, 0x199B1009,
+            0x199C1009, 0x199D1009, 0x199E1009, 0x199F1009,
+        },
+        {
+            0x19A01009, 0x19A11009, 0x19A21009, 0x19A31009, 0x19A41009, 0x19A51009,
+            0x19A61009, 0x19A71009, 0x19A81009, 0x19A91009, 0x19AA1009, 0x19AB1009,
+            0x19AC1009, 0x19AD1009, 0x19AE1009, 0x19AF1009,
+        },
+        {
+            0x19B01009, 0x19B11009, 0x19B21009, 0x19B31009, 0x19B41009, 0x19B51009,
+            0x19B61009, 0x19B71009, 0x19B81009, 0x19B91009, 0x19BA1009, 0x19BB1009,
+            0x19BC1009, 0x19BD1009, 0x19BE1009, 0x19BF1009,
+        },
+        {
+            0x19C01009, 0x19C11009, 0x19C21009, 0x19C31009, 0x19C41009, 0x19C51009,
+            0x19C61009, 0x19C71009, 0x19C81009, 0x19C91009, 0x19CA1009, 0x19CB1009,
+            0x19CC1009, 0x19CD1009, 0x19CE1009, 0x19CF1009,
+        },
+        {
+            0x19D01009, 0x19D11009, 0x19D21009, 0x19D31009, 0x19D41009, 0x19D51009,
+            0x19D61009, 0x19D71009, 0x19D81009, 0x19D91009, 0x19DA1009, 0x19DB1009,
+            0x19DC1009, 0x19DD1009, 0x19DE1009, 0x19DF1009,
+        },
+        {
+            0x19E01009, 0x19E11009, 0x19E21009, 0x19E31009, 0x19E41009, 0x19E51009,
+            0x19E61009, 0x19E71009, 0x19E81009, 0x19E91009, 0x19EA1009, 0x19EB1009,
+            0x19EC1009, 0x19ED1009, 0x19EE1009, 0x19EF1009,
+        },
+        {
+            0x19F01009, 0x19F11009, 0x19F21009, 0x19F31009, 0x19F41009, 0x19F51009,
+            0x19F61009, 0x19F71009, 0x19F81009, 0x19F91009, 0x19FA1009, 0x19FB1009,
+            0x19FC1009, 0x19FD1009, 0x19FE1009, 0x19FF1009,
+        },
+        {
+            0x1A001009, 0x1A011009, 0x1A021009, 0x1A031009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1A041009, 0x1A051009, 0x1A061009, 0x1A071009, 0x1A081009, 0x1A091009,
+            0x1A0A1009, 0x1A0B1009, 0x1A0C1009, 0x1A0D1009, 0x1A0E1009, 0x1A0F1009,
+            0x1A101009, 0x1A111009, 0x1A121009, 0x1A131009,
+        },
+        {
+            0x1A141009, 0x1A151009, 0x1A161009, 0x1A171009, 0x1A181009, 0x1A191009,
+            0x1A1A1009, 0x1A1B1009, 0x1A1C1009, 0x1A1D1009, 0x1A1E1009, 0x1A1F1009,
+            0x1A201009, 0x1A211009, 0x1A221009, 0x1A231009,
+        },
+        {
+            0x1A241009, 0x1A251009, 0x1A261009, 0x1A271009, 0x1A281009, 0x1A291009,
+            0x1A2A1009, 0x1A2B1009, 0x1A2C1009, 0x1A2D1009, 0x1A2E1009, 0x1A2F1009,
+            0x1A301009, 0x1A311009, 0x1A321009, 0x1A331009,
+        },
+        {
+            0x1A341009, 0x1A351009, 0x1A361009, 0x1A371009, 0x1A381009, 0x1A391009,
+            0x1A3A1009, 0x1A3B1009, 0x1A3C1009, 0x1A3D1009, 0x1A3E1009, 0x1A3F1009,
+            0x1A401009, 0x1A411009, 0x1A421009, 0x1A431009,
+        },
+        {
+            0x1A441009, 0x1A451009, 0x1A461009, 0x1A471009, 0x1A481009, 0x1A491009,
+            0x1A4A1009, 0x1A4B1009, 0x1A4C1009, 0x1A4D1009, 0x1A4E1009, 0x1A4F1009,
+            0x1A501009, 0x1A511009, 0x1A521009, 0x1A531009,
+        },
+        {
+            0x1A541009, 0x1A551009, 0x1A561009, 0x1A571009, 0x1A581009, 0x1A591009,
+            0x1A5A1009, 0x1A5B1009, 0x1A5C1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1A5D1009, 0x1A5E1009, 0x1A5F1009, 0x1A601009, 0x1A611009, 0x1A621009,
+            0x1A631009, 0x1A641009, 0x1A651009, 0x1A661009, 0x1A671009, 0x1A681009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1A691009, 0x1A6A1009, 0x1A6B1009, 0x1A6C1009, 0x1A6D1009, 0x1A6E1009,
+            0x1A6F1009, 0x1A701009, 0x1A711009, 0x1A721009, 0x1A731009, 0x1A741009,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1A751009, 0x1A761009, 0x1A771009, 0x1A781009, 0x1A791009, 0x1A7A1009,
+            0x1A7B1009, 0x1A7C1009, 0x1A7D1009, 0x1A7E1009, 0x1A7F1009, 0x1A801009,
+            0x1A811009, 0x1A821009, 0x1A831009, 0x1A841009,
+        },
+        {
+            0x1A851009, 0x1A861009, 0x1A871009, 0x1A881009, 0x1A891009, 0x1A8A1009,
+            0x1A8B1009, 0x1A8C1009, 0x1A8D1009, 0x1A8E1009, 0x1A8F1009, 0x1A901009,
+            0x1A911009, 0x1A921009, 0x1A931009, 0x1A941009,
+        },
+        {
+            0x1A951009, 0x1A961009, 0x1A971009, 0x1A981009, 0x1A991009, 0x1A9A1009,
+            0x1A9B1009, 0x1A9C1009, 0x1A9D1009, 0x1A9E1009, 0x1A9F1009, 0x1AA01009,
+            0x1AA11009, 0x1AA21009, 0x1AA31009, 0x1AA41009,
+        },
+        {
+            0x1AA51009, 0x1AA61009, 0x1AA71009, 0x1AA81009, 0x1AA91009, 0x1AAA1009,
+            0x1AAB1009, 0x1AAC1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1AAD1009, 0x1AAE1009, 0x1AAF1009, 0x1AB01009, 0x1AB11009, 0x1AB21009,
+            0x1AB31009, 0x1AB41009, 0x1AB51009, 0x1AB61009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1AB71009, 0x1AB81009, 0x1AB91009, 0x1ABA1009, 0x1ABB1009, 0x1ABC1009,
+            0x1ABD1009, 0x1ABE1009, 0x1ABF1009, 0x1AC01009, 0x1AC11009, 0x1AC21009,
+            0x1AC31009, 0x1AC41009, 0x1AC51009, 0x1AC61009,
+        },
+        {
+            0x1AC71009, 0x1AC81009, 0x1AC91009, 0x1ACA1009, 0x1ACB1009, 0x1ACC1009,
+            0x1ACD1009, 0x1ACE1009, 0x1ACF1009, 0x1AD01009, 0x1AD11009, 0x1AD21009,
+            0x1AD31009, 0x1AD41009, 0x1AD51009, 0x1AD61009,
+        },
+        {
+            0x1AD71009, 0x1AD81009, 0x1AD91009, 0x1ADA1009, 0x1ADB1009, 0x1ADC1009,
+            0x1ADD1009, 0x1ADE1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1ADF1009, 0x1AE01009, 0x1AE11009, 0x1AE21009, 0x1AE31009, 0x1AE41009,
+            0x1AE51009, 0x1AE61009, 0x1AE71009, 0x1AE81009, 0x1AE91009, 0x1AEA1009,
+            0x1AEB1009, 0x1AEC1009, 0x1AED1009, 0x1AEE1009,
+        },
+        {
+            0x1AEF1009, 0x1AF01009, 0x1AF11009, 0x1AF21009, 0x1AF31009, 0x1AF41009,
+            0x1AF51009, 0x1AF61009, 0x1AF71009, 0x1AF81009, 0x1AF91009, 0x1AFA1009,
+            0x1AFB1009, 0x1AFC1009, 0x00000000, 0x00000000,
+        },
+        {
+            0x1AFD1009, 0x1AFE1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x17671009, 0x17681009, 0x17691009, 0x176A1009, 0x176B1009, 0x176C1009,
+            0x176D1009, 0x176E1009, 0x176F1009, 0x17701009, 0x17711009, 0x17721009,
+            0x17731009, 0x17741009, 0x17751009, 0x17761009,
+        },
+        {
+            0x17771009, 0x17781009, 0x17791009, 0x177A1009, 0x177B1009, 0x177C1009,
+            0x177D1009, 0x177E1009, 0x177F1009, 0x17801009, 0x17811009, 0x17821009,
+            0x17831009, 0x17841009, 0x17851009, 0x17861009,
+        },
+        {
+            0x17871009, 0x17881009, 0x17891009, 0x178A1009, 0x178B1009, 0x178C1009,
+            0x178D1009, 0x178E1009, 0x178F1009, 0x17901009, 0x17911009, 0x17921009,
+            0x17931009, 0x17941009, 0x17951009, 0x17961009,
+        },
+        {
+            0x17971009, 0x17981009, 0x17991009, 0x179A1009, 0x179B1009, 0x179C1009,
+            0x179D1009, 0x179E1009, 0x179F1009, 0x17A01009, 0x17A11009, 0x17A21009,
+            0x17A31009, 0x17A41009, 0x17A51009, 0x17A61009,
+        },
+        {
+            0x17A71009, 0x17A81009, 0x17A91009, 0x17AA1009, 0x17AB1009, 0x17AC1009,
+            0x17AD1009, 0x17AE1009, 0x17AF1009, 0x17B01009, 0x17B11009, 0x17B21009,
+            0x17B31009, 0x17B41009, 0x17B51009, 0x17B61009,
+        },
+        {
+            0x17B71009, 0x17B81009, 0x17B91009, 0x17BA1009, 0x17BB1009, 0x17BC1009,
+            0x17BD1009, 0x17BE1009, 0x17BF1009, 0x17C01009, 0x17C11009, 0x17C21009,
+            0x17C31009, 0x17C41009, 0x17C51009, 0x17C61009,
+        },
+        {
+            0x17C71009, 0x17C81009, 0x17C91009, 0x17CA1009, 0x17CB1009, 0x17CC1009,
+            0x17CD1009, 0x17CE1009, 0x17CF1009, 0x17D01009, 0x17D11009, 0x17D21009,
+            0x17D31009, 0x17D41009, 0x17D51009, 0x17D61009,
+        },
+        {
+            0x17D71009, 0x17D81009, 0x17D91009, 0x17DA1009, 0x17DB1009, 0x17DC1009,
+            0x17DD1009, 0x17DE1009, 0x17DF1009, 0x00000000, 0x17E01009, 0x17E11009,
+            0x17E21009, 0x17E31009, 0x17E41009, 0x17E51009,
+        },
+        {
+            0x17E61009, 0x17E71009, 0x17E81009, 0x17E91009, 0x17EA1009, 0x17EB1009,
+            0x17EC1009, 0x17ED1009, 0x17EE1009, 0x17EF1009, 0x17F01009, 0x17F11009,
+            0x17F21009, 0x17F31009, 0x17F41009, 0x17F51009,
+        },
+        {
+            0x17F61009, 0x17F71009, 0x17F81009, 0x17F91009, 0x17FA1009, 0x17FB1009,
+            0x17FC1009, 0x17FD1009, 0x17FE1009, 0x17FF1009, 0x18001009, 0x18011009,
+            0x18021009, 0x18031009, 0x18041009, 0x18051009,
+        },
+        {
+            0x18061009, 0x18071009, 0x18081009, 0x18091009, 0x180A1009, 0x180B1009,
+            0x180C1009, 0x180D1009, 0x180E1009, 0x180F1009, 0x18101009, 0x18111009,
+            0x18121009, 0x18131009, 0x18141009, 0x18151009,
+        },
+        {
+            0x18161009, 0x18171009, 0x18181009, 0x18191009, 0x181A1009, 0x181B1009,
+            0x181C1009, 0x181D1009, 0x181E1009, 0x181F1009, 0x18201009, 0x18211009,
+            0x18221009, 0x18231009, 0x18241009, 0x18251009,
+        },
+        {
+            0x18261009, 0x18271009, 0x18281009, 0x18291009, 0x182A1009, 0x182B1009,
+            0x182C1009, 0x182D1009, 0x182E1009, 0x182F1009, 0x18301009, 0x18311009,
+            0x00000000, 0x18321009, 0x18331009, 0x18341009,
+        },
+        {
+            0x18351009, 0x18361009, 0x18371009, 0x18381009, 0x18391009, 0x183A1009,
+            0x183B1009, 0x183C1009, 0x183D1009, 0x183E1009, 0x183F1009, 0x18401009,
+            0x18411009, 0x18421009, 0x18431009, 0x18441009,
+        },
+        {
+            0x18451009, 0x18461009, 0x18471009, 0x18481009, 0x18491009, 0x184A1009,
+            0x184B1009, 0x184C1009, 0x184D1009, 0x184E1009, 0x184F1009, 0x18501009,
+            0x18511009, 0x18521009, 0x18531009, 0x18541009,
+        },
+        {
+            0x18551009, 0x18561009, 0x18571009, 0x18581009, 0x18591009, 0x185A1009,
+            0x185B1009, 0x185C1009, 0x185D1009, 0x185E1009, 0x185F1009, 0x18601009,
+            0x18611009, 0x18621009, 0x18631009, 0x18641009,
+        },
+        {
+            0x13F91009, 0x13FA1009, 0x13FB1009, 0x13FC1009, 0x13FD1009, 0x13FE1009,
+            0x13FF1009, 0x14001009, 0x14011009, 0x14021009, 0x14031009, 0x14041009,
+            0x14051009, 0x14061009, 0x14071009, 0x14081009,
+        },
+        {
+            0x14091009, 0x140A1009, 0x140B1009, 0x140C1009, 0x140D1009, 0x140E1009,
+            0x140F1009, 0x14101009, 0x14111009, 0x14121009, 0x14131009, 0x14141009,
+            0x14151009, 0x14161009, 0x14171009, 0x14181009,
+        },
+        {
+            0x14191009, 0x141A1009, 0x141B1009, 0x141C1009, 0x141D1009, 0x141E1009,
+            0x141F1009, 0x14201009, 0x14211009, 0x14221009, 0x14231009, 0x14241009,
+            0x14251009, 0x14261009, 0x14271009, 0x14281009,
+        },
+        {
+            0x14291009, 0x142A1009, 0x142B1009, 0x142C1009, 0x142D1009, 0x142E1009,
+            0x142F1009, 0x14301009, 0x14311009, 0x14321009, 0x14331009, 0x14341009,
+            0x14351009, 0x14361009, 0x14371009, 0x14381009,
+        },
+        {
+            0x14391009, 0x143A1009, 0x143B1009, 0x143C1009, 0x143D1009, 0x143E1009,
+            0x143F1009, 0x14401009, 0x14411009, 0x14421009, 0x14431009, 0x14441009,
+            0x14451009, 0x14461009, 0x14471009, 0x14481009,
+        },
+        {
+            0x14491009, 0x144A1009, 0x144B1009, 0x144C1009, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x144D1009, 0x144E1009, 0x144F1009, 0x14501009, 0x14511009, 0x14521009,
+            0x14531009, 0x14541009, 0x14551009, 0x14561009, 0x14571009, 0x14581009,
+            0x14591009, 0x145A1009, 0x00000000, 0x00000000,
+        },
+        {
+            0x18651009, 0x18661009, 0x18671009, 0x18681009, 0x18691009, 0x00000000,
+            0x00000000, 0x00000000, 0x186A1009, 0x186B1009, 0x186C1009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x186D1009, 0x186E1009, 0x186F1009, 0x18701009, 0x18711009, 0x18721009,
+            0x18731009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x18741009, 0x18751009, 0x18761009, 0x18771009, 0x18781009, 0x18791009,
+            0x187A1009, 0x187B1009, 0x187C1009, 0x187D1009, 0x187E1009, 0x187F1009,
+            0x18801009, 0x18811009, 0x18821009, 0x18831009,
+        },
+        {
+            0x18841009, 0x18851009, 0x18861009, 0x18871009, 0x18881009, 0x18891009,
+            0x188A1009, 0x188B1009, 0x188C1009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x188D1009, 0x188E1009, 0x188F1009, 0x18901009, 0x18911009, 0x18921009,
+            0x18931009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x18941009, 0x18951009, 0x18961009, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x18971009, 0x18981009, 0x18991009, 0x189A1009, 0x189B1009, 0x189C1009,
+            0x189D1009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x09691009, 0x096A1009, 0x096B1009, 0x096C1009, 0x096D1009, 0x096E1009,
+            0x096F1009, 0x09701009, 0x09711009, 0x09721009, 0x09731009, 0x09741009,
+            0x09751009, 0x09761009, 0x09771009, 0x09781009,
+        },
+        {
+            0x09791009, 0x097A1009, 0x097B1009, 0x097C1009, 0x097D1009, 0x097E1009,
+            0x097F1009, 0x09801009, 0x09811009, 0x09821009, 0x09831009, 0x09841009,
+            0x09851009, 0x09861009, 0x09871009, 0x09881009,
+        },
+        {
+            0x09891009, 0x098A1009, 0x098B1009, 0x098C1009, 0x098D1009, 0x098E1009,
+            0x098F1009, 0x09901009, 0x09911009, 0x09921009, 0x09931009, 0x09941009,
+            0x09951009, 0x09961009, 0x09971009, 0x09981009,
+        },
+        {
+            0x09991009, 0x099A1009, 0x099B1009, 0x099C1009, 0x099D1009, 0x099E1009,
+            0x099F1009, 0x09A01009, 0x09A11009, 0x09A21009, 0x09A31009, 0x09A41009,
+            0x09A51009, 0x09A61009, 0x09A71009, 0x09A81009,
+        },
+        {
+            0x09A91009, 0x09AA1009, 0x09AB1009, 0x09AC1009, 0x09AD1009, 0x09AE1009,
+            0x09AF1009, 0x09B01009, 0x09B11009, 0x09B21009, 0x09B31009, 0x09B41009,
+            0x09B51009, 0x09B61009, 0x09B71009, 0x09B81009,
+        },
+        {
+            0x09B91009, 0x09BA1009, 0x09BB1009, 0x09BC1009, 0x09BD1009, 0x09BE1009,
+            0x09BF1009, 0x09C01009, 0x09C11009, 0x09C21009, 0x09C31009, 0x09C41009,
+            0x09C51009, 0x09C61009, 0x09C71009, 0x09C81009,
+        },
+        {
+            0x09C91009, 0x09CA1009, 0x09CB1009, 0x09CC1009, 0x09CD1009, 0x09CE1009,
+            0x09CF1009, 0x09D01009, 0x09D11009, 0x09D21009, 0x09D31009, 0x09D41009,
+            0x09D51009, 0x09D61009, 0x09D71009, 0x09D81009,
+        },
+        {
+            0x09D91009, 0x09DA1009, 0x09DB1009, 0x09DC1009, 0x09DD1009, 0x09DE1009,
+            0x09DF1009, 0x09E01009, 0x09E11009, 0x09E21009, 0x09E31009, 0x09E41009,
+            0x09E51009, 0x09E61009, 0x09E71009, 0x09E81009,
+        },
+        {
+            0x09E91009, 0x09EA1009, 0x09EB1009, 0x09EC1009, 0x09ED1009, 0x09EE1009,
+            0x09EF1009, 0x09F01009, 0x09F11009, 0x09F21009, 0x09F31009, 0x09F41009,
+            0x09F51009, 0x09F61009, 0x09F71009, 0x09F81009,
+        },
+        {
+            0x09F91009, 0x09FA1009, 0x09FB1009, 0x00000000, 0x09FC1009, 0x09FD1009,
+            0x09FE1009, 0x09FF1009, 0x0A001009, 0x0A011009, 0x0A021009, 0x0A031009,
+            0x0A041009, 0x0A051009, 0x0A061009, 0x0A071009,
+        },
+        {
+            0x0A081009, 0x0A091009, 0x0A0A1009, 0x0A0B1009, 0x0A0C1009, 0x0A0D1009,
+            0x0A0E1009, 0x0A0F1009, 0x0A101009, 0x0A111009, 0x0A121009, 0x0A131009,
+            0x0A141009, 0x0A151009, 0x0A161009, 0x0A171009,
+        },
+        {
+            0x0A181009, 0x0A191009, 0x0A1A1009, 0x0A1B1009, 0x0A1C1009, 0x0A1D1009,
+            0x0A1E1009, 0x0A1F1009, 0x0A201009, 0x0A211009, 0x0A221009, 0x0A231009,
+            0x0A241009, 0x0A251009, 0x0A261009, 0x0A271009,
+        },
+        {
+            0x0A281009, 0x0A291009, 0x0A2A1009, 0x0A2B1009, 0x0A2C1009, 0x0A2D1009,
+            0x0A2E1009, 0x0A2F1009, 0x0A301009, 0x0A311009, 0x0A321009, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x1F981015, 0x1F991015, 0x1F9A1015, 0x1F9B1015, 0x1F9C1015, 0x1F9D1015,
+            0x1F9E1015, 0x1F9F1015, 0x1FA01015, 0x1FA11015, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+        {
+            0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+        },
+    };
+};
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_UNICODE_COLLATION_TABLES_HPP
@@ -0,0 +1,6760 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+// This file is generated by tools/gen_property_tables.py from the Unicode
+// Character Database, version 14.0.0.  Do not edit.
+
+#if !defined(TEXT_VIEW_UNICODE_PROPERTY_TABLES_HPP) // {
+#define TEXT_VIEW_UNICODE_PROPERTY_TABLES_HPP
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * Unicode property table
+ * Each record holds the General_Category (gc), Script (sc), and
+ * East_Asian_Width (ea) of a code point, flags for its binary properties, and
+ * the index in numeric_values of its Numeric_Value (nv); index zero denotes
+ * that the code point has no numeric value.  general_category_names and
+ * script_names hold the property value aliases of the enumerators.  The
+ * three-stage trie holds the index of the record for each code point.
+ */
+struct unicode_property_table {
+    enum class general_category : unsigned char {
+        cn,
+        lu,
+        ll,
+        lt,
+        lm,
+        lo,
+        mn,
+        mc,
+        me,
+        nd,
+        nl,
+        no,
+        pc,
+        pd,
+        ps,
+        pe,
+        pi,
+        pf,
+        po,
+        sm,
+        sc,
+        sk,
+        so,
+        zs,
+        zl,
+        zp,
+        cc,
+        cf,
+        cs,
+        co,
+    };
+    enum class script : unsigned char {
+        unknown,
+        common,
+        inherited,
+        adlam,
+        ahom,
+        anatolian_hieroglyphs,
+        arabic,
+        armenian,
+        avestan,
+        balinese,
+        bamum,
+        bassa_vah,
+        batak,
+        bengali,
+        bhaiksuki,
+        bopomofo,
+        brahmi,
+        braille,
+        buginese,
+        buhid,
+        canadian_aboriginal,
+        carian,
+        caucasian_albanian,
+        chakma,
+        cham,
+        cherokee,
+        chorasmian,
+        coptic,
+        cuneiform,
+        cypriot,
+        cypro_minoan,
+        cyrillic,
+        deseret,
+        devanagari,
+        dives_akuru,
+        dogra,
+        duployan,
+        egyptian_hieroglyphs,
+        elbasan,
+        elymaic,
+        ethiopic,
+        georgian,
+        glagolitic,
+        gothic,
+        grantha,
+        greek,
+        gujarati,
+        gunjala_gondi,
+        gurmukhi,
+        han,
+        hangul,
+        hanifi_rohingya,
+        hanunoo,
+        hatran,
+        hebrew,
+        hiragana,
+        imperial_aramaic,
+        inscriptional_pahlavi,
+        inscriptional_parthian,
+        javanese,
+        kaithi,
+        kannada,
+        katakana,
+        kayah_li,
+        kharoshthi,
+        khitan_small_script,
+        khmer,
+        khojki,
+        khudawadi,
+        lao,
+        latin,
+        lepcha,
+        limbu,
+        linear_a,
+        linear_b,
+        lisu,
+        lycian,
+        lydian,
+        mahajani,
+        makasar,
+        malayalam,
+        mandaic,
+        manichaean,
+        marchen,
+        masaram_gondi,
+        medefaidrin,
+        meetei_mayek,
+        mende_kikakui,
+        meroitic_cursive,
+        meroitic_hieroglyphs,
+        miao,
+        modi,
+        mongolian,
+        mro,
+        multani,
+        myanmar,
+        nabataean,
+        nandinagari,
+        new_tai_lue,
+        newa,
+        nko,
+        nushu,
+        nyiakeng_puachue_hmong,
+        ogham,
+        ol_chiki,
+        old_hungarian,
+        old_italic,
+        old_north_arabian,
+        old_permic,
+        old_persian,
+        old_sogdian,
+        old_south_arabian,
+        old_turkic,
+        old_uyghur,
+        oriya,
+        osage,
+        osmanya,
+        pahawh_hmong,
+        palmyrene,
+        pau_cin_hau,
+        phags_pa,
+        phoenician,
+        psalter_pahlavi,
+        rejang,
+        runic,
+        samaritan,
+        saurashtra,
+        sharada,
+        shavian,
+        siddham,
+        signwriting,
+        sinhala,
+        sogdian,
+        sora_sompeng,
+        soyombo,
+        sundanese,
+        syloti_nagri,
+        syriac,
+        tagalog,
+        tagbanwa,
+        tai_le,
+        tai_tham,
+        tai_viet,
+        takri,
+        tamil,
+        tangsa,
+        tangut,
+        telugu,
+        thaana,
+        thai,
+        tibetan,
+        tifinagh,
+        tirhuta,
+        toto,
+        ugaritic,
+        vai,
+        vithkuqi,
+        wancho,
+        warang_citi,
+        yezidi,
+        yi,
+        zanabazar_square,
+    };
+    enum class east_asian_width : unsigned char {
+        n,
+        a,
+        f,
+        h,
+        na,
+        w,
+    };
+    struct record {
+        general_category gc;
+        script sc;
+        east_asian_width ea;
+        unsigned char flags;
+        unsigned short nv;
+    };
+    struct numeric_value {
+        long long numerator;
+        long long denominator;
+    };
+    static constexpr unsigned short default_value = 0;
+    static constexpr unsigned char alphabetic = 0x01;
+    static constexpr unsigned char lowercase = 0x02;
+    static constexpr unsigned char uppercase = 0x04;
+    static constexpr unsigned char white_space = 0x08;
+    static constexpr unsigned char math = 0x10;
+    static constexpr unsigned char default_ignorable = 0x20;
+    static constexpr record records[1967] = {
+        { general_category::cn, script::unknown, east_asian_width::n, 0x00, 0 },
+        { general_category::cc, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::cc, script::common, east_asian_width::n, 0x08, 0 },
+        { general_category::zs, script::common, east_asian_width::na, 0x08, 0 },
+        { general_category::po, script::common, east_asian_width::na, 0x00, 0 },
+        { general_category::sc, script::common, east_asian_width::na, 0x00, 0 },
+        { general_category::ps, script::common, east_asian_width::na, 0x00, 0 },
+        { general_category::pe, script::common, east_asian_width::na, 0x00, 0 },
+        { general_category::sm, script::common, east_asian_width::na, 0x10, 0 },
+        { general_category::pd, script::common, east_asian_width::na, 0x00, 0 },
+        { general_category::nd, script::common, east_asian_width::na, 0x00, 1 },
+        { general_category::nd, script::common, east_asian_width::na, 0x00, 2 },
+        { general_category::nd, script::common, east_asian_width::na, 0x00, 3 },
+        { general_category::nd, script::common, east_asian_width::na, 0x00, 4 },
+        { general_category::nd, script::common, east_asian_width::na, 0x00, 5 },
+        { general_category::nd, script::common, east_asian_width::na, 0x00, 6 },
+        { general_category::nd, script::common, east_asian_width::na, 0x00, 7 },
+        { general_category::nd, script::common, east_asian_width::na, 0x00, 8 },
+        { general_category::nd, script::common, east_asian_width::na, 0x00, 9 },
+        { general_category::nd, script::common, east_asian_width::na, 0x00, 10 },
+        { general_category::lu, script::latin, east_asian_width::na, 0x05, 0 },
+        { general_category::sk, script::common, east_asian_width::na, 0x10, 0 },
+        { general_category::pc, script::common, east_asian_width::na, 0x00, 0 },
+        { general_category::sk, script::common, east_asian_width::na, 0x00, 0 },
+        { general_category::ll, script::latin, east_asian_width::na, 0x03, 0 },
+        { general_category::zs, script::common, east_asian_width::n, 0x08, 0 },
+        { general_category::po, script::common, east_asian_width::a, 0x00, 0 },
+        { general_category::sc, script::common, east_asian_width::a, 0x00, 0 },
+        { general_category::so, script::common, east_asian_width::na, 0x00, 0 },
+        { general_category::sk, script::common, east_asian_width::a, 0x00, 0 },
+        { general_category::so, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::latin, east_asian_width::a, 0x03, 0 },
+        { general_category::pi, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::cf, script::common, east_asian_width::a, 0x20, 0 },
+        { general_category::so, script::common, east_asian_width::a, 0x00, 0 },
+        { general_category::sm, script::common, east_asian_width::a, 0x10, 0 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 3 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 4 },
+        { general_category::ll, script::common, east_asian_width::n, 0x03, 0 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 2 },
+        { general_category::pf, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 11 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 12 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 13 },
+        { general_category::lu, script::latin, east_asian_width::n, 0x05, 0 },
+        { general_category::lu, script::latin, east_asian_width::a, 0x05, 0 },
+        { general_category::ll, script::latin, east_asian_width::a, 0x03, 0 },
+        { general_category::ll, script::latin, east_asian_width::n, 0x03, 0 },
+        { general_category::lo, script::latin, east_asian_width::n, 0x01, 0 },
+        { general_category::lt, script::latin, east_asian_width::n, 0x01, 0 },
+        { general_category::lm, script::latin, east_asian_width::n, 0x03, 0 },
+        { general_category::lm, script::common, east_asian_width::n, 0x01, 0 },
+        { general_category::lm, script::common, east_asian_width::n, 0x03, 0 },
+        { general_category::sk, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::common, east_asian_width::a, 0x01, 0 },
+        { general_category::sk, script::bopomofo, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::inherited, east_asian_width::a, 0x00, 0 },
+        { general_category::mn, script::inherited, east_asian_width::a, 0x03, 0 },
+        { general_category::mn, script::inherited, east_asian_width::a, 0x20, 0 },
+        { general_category::lu, script::greek, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::greek, east_asian_width::n, 0x03, 0 },
+        { general_category::sk, script::greek, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::greek, east_asian_width::n, 0x03, 0 },
+        { general_category::po, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::lu, script::greek, east_asian_width::a, 0x05, 0 },
+        { general_category::ll, script::greek, east_asian_width::a, 0x03, 0 },
+        { general_category::ll, script::greek, east_asian_width::n, 0x13, 0 },
+        { general_category::lu, script::greek, east_asian_width::n, 0x15, 0 },
+        { general_category::lu, script::coptic, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::coptic, east_asian_width::n, 0x03, 0 },
+        { general_category::sm, script::greek, east_asian_width::n, 0x10, 0 },
+        { general_category::lu, script::cyrillic, east_asian_width::n, 0x05, 0 },
+        { general_category::lu, script::cyrillic, east_asian_width::a, 0x05, 0 },
+        { general_category::ll, script::cyrillic, east_asian_width::a, 0x03, 0 },
+        { general_category::ll, script::cyrillic, east_asian_width::n, 0x03, 0 },
+        { general_category::so, script::cyrillic, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::cyrillic, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::inherited, east_asian_width::n, 0x00, 0 },
+        { general_category::me, script::cyrillic, east_asian_width::n, 0x00, 0 },
+        { general_category::lu, script::armenian, east_asian_width::n, 0x05, 0 },
+        { general_category::lm, script::armenian, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::armenian, east_asian_width::n, 0x00, 0 },
+        { general_category::ll, script::armenian, east_asian_width::n, 0x03, 0 },
+        { general_category::pd, script::armenian, east_asian_width::n, 0x00, 0 },
+        { general_category::so, script::armenian, east_asian_width::n, 0x00, 0 },
+        { general_category::sc, script::armenian, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::hebrew, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::hebrew, east_asian_width::n, 0x01, 0 },
+        { general_category::pd, script::hebrew, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::hebrew, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::hebrew, east_asian_width::n, 0x01, 0 },
+        { general_category::cf, script::arabic, east_asian_width::n, 0x00, 0 },
+        { general_category::cf, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::sm, script::arabic, east_asian_width::n, 0x10, 0 },
+        { general_category::po, script::arabic, east_asian_width::n, 0x00, 0 },
+        { general_category::sc, script::arabic, east_asian_width::n, 0x00, 0 },
+        { general_category::so, script::arabic, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::arabic, east_asian_width::n, 0x01, 0 },
+        { general_category::cf, script::arabic, east_asian_width::n, 0x20, 0 },
+        { general_category::lo, script::arabic, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::inherited, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::arabic, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::arabic, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::arabic, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::arabic, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::arabic, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::arabic, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::arabic, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::arabic, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::arabic, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::arabic, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::arabic, east_asian_width::n, 0x00, 10 },
+        { general_category::lm, script::arabic, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::syriac, east_asian_width::n, 0x00, 0 },
+        { general_category::cf, script::syriac, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::syriac, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::syriac, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::syriac, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::thaana, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::thaana, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::nko, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::nko, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::nko, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::nko, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::nko, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::nko, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::nko, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::nko, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::nko, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::nko, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::nko, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::nko, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::nko, east_asian_width::n, 0x01, 0 },
+        { general_category::so, script::nko, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::nko, east_asian_width::n, 0x00, 0 },
+        { general_category::sc, script::nko, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::samaritan, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::samaritan, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::samaritan, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::samaritan, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::samaritan, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::mandaic, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::mandaic, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::mandaic, east_asian_width::n, 0x00, 0 },
+        { general_category::sk, script::arabic, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::devanagari, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::devanagari, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::devanagari, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::devanagari, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::devanagari, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::devanagari, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::devanagari, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::devanagari, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::devanagari, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::devanagari, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::devanagari, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::devanagari, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::devanagari, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::devanagari, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::devanagari, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::devanagari, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::bengali, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::bengali, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::bengali, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::bengali, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::bengali, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::bengali, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::bengali, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::bengali, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::bengali, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::bengali, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::bengali, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::bengali, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::bengali, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::bengali, east_asian_width::n, 0x00, 10 },
+        { general_category::sc, script::bengali, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::bengali, east_asian_width::n, 0x00, 14 },
+        { general_category::no, script::bengali, east_asian_width::n, 0x00, 15 },
+        { general_category::no, script::bengali, east_asian_width::n, 0x00, 16 },
+        { general_category::no, script::bengali, east_asian_width::n, 0x00, 11 },
+        { general_category::no, script::bengali, east_asian_width::n, 0x00, 13 },
+        { general_category::no, script::bengali, east_asian_width::n, 0x00, 17 },
+        { general_category::so, script::bengali, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::bengali, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::gurmukhi, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::gurmukhi, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::gurmukhi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::gurmukhi, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::gurmukhi, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::gurmukhi, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::gurmukhi, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::gurmukhi, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::gurmukhi, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::gurmukhi, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::gurmukhi, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::gurmukhi, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::gurmukhi, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::gurmukhi, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::gurmukhi, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::gujarati, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::gujarati, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::gujarati, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::gujarati, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::gujarati, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::gujarati, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::gujarati, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::gujarati, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::gujarati, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::gujarati, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::gujarati, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::gujarati, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::gujarati, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::gujarati, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::gujarati, east_asian_width::n, 0x00, 0 },
+        { general_category::sc, script::gujarati, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::oriya, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::oriya, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::oriya, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::oriya, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::oriya, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::oriya, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::oriya, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::oriya, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::oriya, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::oriya, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::oriya, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::oriya, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::oriya, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::oriya, east_asian_width::n, 0x00, 10 },
+        { general_category::so, script::oriya, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::oriya, east_asian_width::n, 0x00, 11 },
+        { general_category::no, script::oriya, east_asian_width::n, 0x00, 12 },
+        { general_category::no, script::oriya, east_asian_width::n, 0x00, 13 },
+        { general_category::no, script::oriya, east_asian_width::n, 0x00, 14 },
+        { general_category::no, script::oriya, east_asian_width::n, 0x00, 15 },
+        { general_category::no, script::oriya, east_asian_width::n, 0x00, 16 },
+        { general_category::mn, script::tamil, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::tamil, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::tamil, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::tamil, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::tamil, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::tamil, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::tamil, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::tamil, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::tamil, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::tamil, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::tamil, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::tamil, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::tamil, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::tamil, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 20 },
+        { general_category::so, script::tamil, east_asian_width::n, 0x00, 0 },
+        { general_category::sc, script::tamil, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::telugu, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::telugu, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::telugu, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::telugu, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::telugu, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::telugu, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::telugu, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::telugu, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::telugu, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::telugu, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::telugu, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::telugu, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::telugu, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::telugu, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::telugu, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::telugu, east_asian_width::n, 0x00, 1 },
+        { general_category::no, script::telugu, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::telugu, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::telugu, east_asian_width::n, 0x00, 4 },
+        { general_category::so, script::telugu, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::kannada, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::kannada, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::kannada, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::kannada, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::kannada, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::kannada, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::kannada, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::kannada, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::kannada, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::kannada, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::kannada, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::kannada, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::kannada, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::kannada, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::kannada, east_asian_width::n, 0x00, 10 },
+        { general_category::mn, script::malayalam, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::malayalam, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::malayalam, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::malayalam, east_asian_width::n, 0x00, 0 },
+        { general_category::so, script::malayalam, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 21 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 22 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 23 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 24 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 25 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 26 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 27 },
+        { general_category::nd, script::malayalam, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::malayalam, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::malayalam, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::malayalam, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::malayalam, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::malayalam, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::malayalam, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::malayalam, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::malayalam, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::malayalam, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 20 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 11 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 12 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 13 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 14 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 15 },
+        { general_category::no, script::malayalam, east_asian_width::n, 0x00, 16 },
+        { general_category::mn, script::sinhala, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::sinhala, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::sinhala, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::sinhala, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::sinhala, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::sinhala, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::sinhala, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::sinhala, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::sinhala, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::sinhala, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::sinhala, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::sinhala, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::sinhala, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::sinhala, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::sinhala, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::thai, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::thai, east_asian_width::n, 0x01, 0 },
+        { general_category::sc, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::thai, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::thai, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::thai, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::thai, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::thai, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::thai, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::thai, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::thai, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::thai, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::thai, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::thai, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::thai, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::thai, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::lao, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::lao, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::lao, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::lao, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::lao, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::lao, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::lao, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::lao, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::lao, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::lao, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::lao, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::lao, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::lao, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::lao, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::tibetan, east_asian_width::n, 0x01, 0 },
+        { general_category::so, script::tibetan, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::tibetan, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::tibetan, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::tibetan, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::tibetan, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::tibetan, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::tibetan, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::tibetan, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::tibetan, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::tibetan, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::tibetan, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::tibetan, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::tibetan, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::tibetan, east_asian_width::n, 0x00, 12 },
+        { general_category::no, script::tibetan, east_asian_width::n, 0x00, 28 },
+        { general_category::no, script::tibetan, east_asian_width::n, 0x00, 29 },
+        { general_category::no, script::tibetan, east_asian_width::n, 0x00, 30 },
+        { general_category::no, script::tibetan, east_asian_width::n, 0x00, 31 },
+        { general_category::no, script::tibetan, east_asian_width::n, 0x00, 32 },
+        { general_category::no, script::tibetan, east_asian_width::n, 0x00, 33 },
+        { general_category::no, script::tibetan, east_asian_width::n, 0x00, 34 },
+        { general_category::no, script::tibetan, east_asian_width::n, 0x00, 35 },
+        { general_category::no, script::tibetan, east_asian_width::n, 0x00, 36 },
+        { general_category::ps, script::tibetan, east_asian_width::n, 0x00, 0 },
+        { general_category::pe, script::tibetan, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::tibetan, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::tibetan, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::tibetan, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::myanmar, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::myanmar, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::myanmar, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::myanmar, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::myanmar, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::myanmar, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::myanmar, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::myanmar, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::myanmar, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::myanmar, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::myanmar, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::myanmar, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::myanmar, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::myanmar, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::myanmar, east_asian_width::n, 0x00, 0 },
+        { general_category::so, script::myanmar, east_asian_width::n, 0x00, 0 },
+        { general_category::lu, script::georgian, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::georgian, east_asian_width::n, 0x03, 0 },
+        { general_category::lm, script::georgian, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::hangul, east_asian_width::w, 0x01, 0 },
+        { general_category::lo, script::hangul, east_asian_width::w, 0x21, 0 },
+        { general_category::lo, script::hangul, east_asian_width::n, 0x21, 0 },
+        { general_category::lo, script::hangul, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::ethiopic, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::ethiopic, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::ethiopic, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 7 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 8 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 9 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 38 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 39 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 40 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 41 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 42 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 43 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 44 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::ethiopic, east_asian_width::n, 0x00, 45 },
+        { general_category::so, script::ethiopic, east_asian_width::n, 0x00, 0 },
+        { general_category::lu, script::cherokee, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::cherokee, east_asian_width::n, 0x03, 0 },
+        { general_category::pd, script::canadian_aboriginal, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::canadian_aboriginal, east_asian_width::n, 0x01, 0 },
+        { general_category::so, script::canadian_aboriginal, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::canadian_aboriginal, east_asian_width::n, 0x00, 0 },
+        { general_category::zs, script::ogham, east_asian_width::n, 0x08, 0 },
+        { general_category::lo, script::ogham, east_asian_width::n, 0x01, 0 },
+        { general_category::ps, script::ogham, east_asian_width::n, 0x00, 0 },
+        { general_category::pe, script::ogham, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::runic, east_asian_width::n, 0x01, 0 },
+        { general_category::nl, script::runic, east_asian_width::n, 0x01, 46 },
+        { general_category::nl, script::runic, east_asian_width::n, 0x01, 47 },
+        { general_category::nl, script::runic, east_asian_width::n, 0x01, 48 },
+        { general_category::lo, script::tagalog, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::tagalog, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::tagalog, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::tagalog, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::hanunoo, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::hanunoo, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::hanunoo, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::buhid, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::buhid, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::tagbanwa, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::tagbanwa, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::khmer, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::khmer, east_asian_width::n, 0x20, 0 },
+        { general_category::mc, script::khmer, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::khmer, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::khmer, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::khmer, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::khmer, east_asian_width::n, 0x01, 0 },
+        { general_category::sc, script::khmer, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::khmer, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::khmer, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::khmer, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::khmer, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::khmer, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::khmer, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::khmer, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::khmer, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::khmer, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::khmer, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::khmer, east_asian_width::n, 0x00, 1 },
+        { general_category::no, script::khmer, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::khmer, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::khmer, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::khmer, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::khmer, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::khmer, east_asian_width::n, 0x00, 7 },
+        { general_category::no, script::khmer, east_asian_width::n, 0x00, 8 },
+        { general_category::no, script::khmer, east_asian_width::n, 0x00, 9 },
+        { general_category::no, script::khmer, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::mongolian, east_asian_width::n, 0x00, 0 },
+        { general_category::pd, script::mongolian, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::mongolian, east_asian_width::n, 0x20, 0 },
+        { general_category::cf, script::mongolian, east_asian_width::n, 0x20, 0 },
+        { general_category::nd, script::mongolian, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::mongolian, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::mongolian, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::mongolian, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::mongolian, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::mongolian, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::mongolian, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::mongolian, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::mongolian, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::mongolian, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::mongolian, east_asian_width::n, 0x01, 0 },
+        { general_category::lm, script::mongolian, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::mongolian, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::limbu, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::limbu, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::limbu, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::limbu, east_asian_width::n, 0x00, 0 },
+        { general_category::so, script::limbu, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::limbu, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::limbu, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::limbu, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::limbu, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::limbu, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::limbu, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::limbu, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::limbu, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::limbu, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::limbu, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::limbu, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::tai_le, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::new_tai_lue, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::new_tai_lue, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::new_tai_lue, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::new_tai_lue, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::new_tai_lue, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::new_tai_lue, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::new_tai_lue, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::new_tai_lue, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::new_tai_lue, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::new_tai_lue, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::new_tai_lue, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::new_tai_lue, east_asian_width::n, 0x00, 2 },
+        { general_category::so, script::new_tai_lue, east_asian_width::n, 0x00, 0 },
+        { general_category::so, script::khmer, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::buginese, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::buginese, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::buginese, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::buginese, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::tai_tham, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::tai_tham, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::tai_tham, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::tai_tham, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::tai_tham, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::tai_tham, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::tai_tham, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::tai_tham, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::tai_tham, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::tai_tham, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::tai_tham, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::tai_tham, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::tai_tham, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::tai_tham, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::tai_tham, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::tai_tham, east_asian_width::n, 0x01, 0 },
+        { general_category::me, script::inherited, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::balinese, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::balinese, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::balinese, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::balinese, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::balinese, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::balinese, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::balinese, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::balinese, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::balinese, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::balinese, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::balinese, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::balinese, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::balinese, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::balinese, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::balinese, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::balinese, east_asian_width::n, 0x00, 0 },
+        { general_category::so, script::balinese, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::sundanese, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::sundanese, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::sundanese, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::sundanese, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::sundanese, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::sundanese, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::sundanese, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::sundanese, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::sundanese, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::sundanese, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::sundanese, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::sundanese, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::sundanese, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::sundanese, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::sundanese, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::batak, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::batak, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::batak, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::batak, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::batak, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::batak, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::lepcha, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::lepcha, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::lepcha, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::lepcha, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::lepcha, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::lepcha, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::lepcha, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::lepcha, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::lepcha, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::lepcha, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::lepcha, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::lepcha, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::lepcha, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::lepcha, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::lepcha, east_asian_width::n, 0x00, 10 },
+        { general_category::nd, script::ol_chiki, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::ol_chiki, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::ol_chiki, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::ol_chiki, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::ol_chiki, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::ol_chiki, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::ol_chiki, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::ol_chiki, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::ol_chiki, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::ol_chiki, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::ol_chiki, east_asian_width::n, 0x01, 0 },
+        { general_category::lm, script::ol_chiki, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::ol_chiki, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::sundanese, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::common, east_asian_width::n, 0x01, 0 },
+        { general_category::lm, script::cyrillic, east_asian_width::n, 0x03, 0 },
+        { general_category::lt, script::greek, east_asian_width::n, 0x01, 0 },
+        { general_category::cf, script::common, east_asian_width::n, 0x20, 0 },
+        { general_category::cf, script::inherited, east_asian_width::n, 0x20, 0 },
+        { general_category::pd, script::common, east_asian_width::a, 0x00, 0 },
+        { general_category::pd, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::common, east_asian_width::a, 0x10, 0 },
+        { general_category::pi, script::common, east_asian_width::a, 0x00, 0 },
+        { general_category::pf, script::common, east_asian_width::a, 0x00, 0 },
+        { general_category::ps, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::zl, script::common, east_asian_width::n, 0x08, 0 },
+        { general_category::zp, script::common, east_asian_width::n, 0x08, 0 },
+        { general_category::po, script::common, east_asian_width::n, 0x10, 0 },
+        { general_category::pc, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::pc, script::common, east_asian_width::n, 0x10, 0 },
+        { general_category::sm, script::common, east_asian_width::n, 0x10, 0 },
+        { general_category::pe, script::common, east_asian_width::n, 0x00, 0 },
+        { general_category::cf, script::common, east_asian_width::n, 0x30, 0 },
+        { general_category::cn, script::unknown, east_asian_width::n, 0x20, 0 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 1 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 5 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 7 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 8 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 9 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 10 },
+        { general_category::ps, script::common, east_asian_width::n, 0x10, 0 },
+        { general_category::pe, script::common, east_asian_width::n, 0x10, 0 },
+        { general_category::lm, script::latin, east_asian_width::a, 0x03, 0 },
+        { general_category::sc, script::common, east_asian_width::h, 0x00, 0 },
+        { general_category::mn, script::inherited, east_asian_width::n, 0x10, 0 },
+        { general_category::lu, script::common, east_asian_width::n, 0x15, 0 },
+        { general_category::ll, script::common, east_asian_width::n, 0x13, 0 },
+        { general_category::ll, script::common, east_asian_width::a, 0x13, 0 },
+        { general_category::so, script::common, east_asian_width::n, 0x10, 0 },
+        { general_category::lo, script::common, east_asian_width::n, 0x11, 0 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 49 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 50 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 25 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 51 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 52 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 27 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 53 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 54 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 55 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 56 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 57 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 15 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 58 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 59 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 60 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 2 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 2 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 3 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 4 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 5 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 6 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 7 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 8 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 9 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 10 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 18 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 61 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x05, 62 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x05, 40 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x05, 19 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x05, 63 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x05, 20 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x03, 2 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x03, 3 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x03, 4 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x03, 5 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x03, 6 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x03, 7 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x03, 8 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x03, 9 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x03, 10 },
+        { general_category::nl, script::latin, east_asian_width::a, 0x03, 18 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x03, 61 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x03, 62 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x03, 40 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x03, 19 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x03, 63 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x03, 20 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x01, 20 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x01, 64 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x01, 45 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x01, 7 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x01, 40 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x01, 65 },
+        { general_category::nl, script::latin, east_asian_width::n, 0x01, 66 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 1 },
+        { general_category::so, script::common, east_asian_width::a, 0x10, 0 },
+        { general_category::so, script::common, east_asian_width::w, 0x00, 0 },
+        { general_category::ps, script::common, east_asian_width::w, 0x00, 0 },
+        { general_category::pe, script::common, east_asian_width::w, 0x00, 0 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 6 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 7 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 8 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 9 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 10 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 18 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 61 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 62 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 67 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 68 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 69 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 17 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 46 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 47 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 48 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 37 },
+        { general_category::so, script::common, east_asian_width::a, 0x05, 0 },
+        { general_category::so, script::common, east_asian_width::a, 0x03, 0 },
+        { general_category::sm, script::common, east_asian_width::w, 0x10, 0 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 18 },
+        { general_category::ps, script::common, east_asian_width::na, 0x10, 0 },
+        { general_category::pe, script::common, east_asian_width::na, 0x10, 0 },
+        { general_category::so, script::braille, east_asian_width::n, 0x00, 0 },
+        { general_category::lu, script::glagolitic, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::glagolitic, east_asian_width::n, 0x03, 0 },
+        { general_category::so, script::coptic, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::coptic, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::coptic, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::coptic, east_asian_width::n, 0x00, 12 },
+        { general_category::lo, script::tifinagh, east_asian_width::n, 0x01, 0 },
+        { general_category::lm, script::tifinagh, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::tifinagh, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::tifinagh, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::cyrillic, east_asian_width::n, 0x01, 0 },
+        { general_category::so, script::han, east_asian_width::w, 0x00, 0 },
+        { general_category::zs, script::common, east_asian_width::f, 0x08, 0 },
+        { general_category::po, script::common, east_asian_width::w, 0x00, 0 },
+        { general_category::lm, script::han, east_asian_width::w, 0x01, 0 },
+        { general_category::lo, script::common, east_asian_width::w, 0x01, 0 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 1 },
+        { general_category::pd, script::common, east_asian_width::w, 0x00, 0 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 2 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 3 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 4 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 5 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 6 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 7 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 8 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 9 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 10 },
+        { general_category::mn, script::inherited, east_asian_width::w, 0x00, 0 },
+        { general_category::mc, script::hangul, east_asian_width::w, 0x00, 0 },
+        { general_category::lm, script::common, east_asian_width::w, 0x01, 0 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 18 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 37 },
+        { general_category::nl, script::han, east_asian_width::w, 0x01, 38 },
+        { general_category::lo, script::hiragana, east_asian_width::w, 0x01, 0 },
+        { general_category::sk, script::common, east_asian_width::w, 0x00, 0 },
+        { general_category::lm, script::hiragana, east_asian_width::w, 0x01, 0 },
+        { general_category::lo, script::katakana, east_asian_width::w, 0x01, 0 },
+        { general_category::lm, script::katakana, east_asian_width::w, 0x01, 0 },
+        { general_category::lo, script::bopomofo, east_asian_width::w, 0x01, 0 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 2 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 3 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 4 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 5 },
+        { general_category::so, script::hangul, east_asian_width::w, 0x00, 0 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 6 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 7 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 8 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 9 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 10 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 18 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 38 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 39 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 40 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 41 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 42 },
+        { general_category::no, script::common, east_asian_width::a, 0x00, 43 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 70 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 71 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 72 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 73 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 74 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 75 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 76 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 77 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 78 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 38 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 79 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 80 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 81 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 82 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 83 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 84 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 85 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 86 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 87 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 39 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 88 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 89 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 90 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 91 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 92 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 93 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 94 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 95 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 96 },
+        { general_category::no, script::common, east_asian_width::w, 0x00, 40 },
+        { general_category::so, script::katakana, east_asian_width::w, 0x00, 0 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 0 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 6 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 3 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 8 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 2 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 45 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 4 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 10 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 5 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 97 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 18 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 20 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 19 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 98 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 9 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 7 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 37 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 38 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 39 },
+        { general_category::lo, script::han, east_asian_width::w, 0x01, 1 },
+        { general_category::lo, script::yi, east_asian_width::w, 0x01, 0 },
+        { general_category::lm, script::yi, east_asian_width::w, 0x01, 0 },
+        { general_category::so, script::yi, east_asian_width::w, 0x00, 0 },
+        { general_category::lo, script::lisu, east_asian_width::n, 0x01, 0 },
+        { general_category::lm, script::lisu, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::lisu, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::vai, east_asian_width::n, 0x01, 0 },
+        { general_category::lm, script::vai, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::vai, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::vai, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::vai, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::vai, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::vai, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::vai, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::vai, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::vai, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::vai, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::vai, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::vai, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::cyrillic, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::cyrillic, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::cyrillic, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::bamum, east_asian_width::n, 0x01, 0 },
+        { general_category::nl, script::bamum, east_asian_width::n, 0x01, 2 },
+        { general_category::nl, script::bamum, east_asian_width::n, 0x01, 3 },
+        { general_category::nl, script::bamum, east_asian_width::n, 0x01, 4 },
+        { general_category::nl, script::bamum, east_asian_width::n, 0x01, 5 },
+        { general_category::nl, script::bamum, east_asian_width::n, 0x01, 6 },
+        { general_category::nl, script::bamum, east_asian_width::n, 0x01, 7 },
+        { general_category::nl, script::bamum, east_asian_width::n, 0x01, 8 },
+        { general_category::nl, script::bamum, east_asian_width::n, 0x01, 9 },
+        { general_category::nl, script::bamum, east_asian_width::n, 0x01, 10 },
+        { general_category::nl, script::bamum, east_asian_width::n, 0x01, 1 },
+        { general_category::mn, script::bamum, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::bamum, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::latin, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::syloti_nagri, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::syloti_nagri, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::syloti_nagri, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::syloti_nagri, east_asian_width::n, 0x01, 0 },
+        { general_category::so, script::syloti_nagri, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 11 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 12 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 13 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 14 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 15 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 16 },
+        { general_category::lo, script::phags_pa, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::phags_pa, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::saurashtra, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::saurashtra, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::saurashtra, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::saurashtra, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::saurashtra, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::saurashtra, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::saurashtra, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::saurashtra, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::saurashtra, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::saurashtra, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::saurashtra, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::saurashtra, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::saurashtra, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::saurashtra, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::saurashtra, east_asian_width::n, 0x00, 10 },
+        { general_category::nd, script::kayah_li, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::kayah_li, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::kayah_li, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::kayah_li, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::kayah_li, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::kayah_li, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::kayah_li, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::kayah_li, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::kayah_li, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::kayah_li, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::kayah_li, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::kayah_li, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::kayah_li, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::kayah_li, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::rejang, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::rejang, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::rejang, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::rejang, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::rejang, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::javanese, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::javanese, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::javanese, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::javanese, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::javanese, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::javanese, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::javanese, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::javanese, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::javanese, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::javanese, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::javanese, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::javanese, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::javanese, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::javanese, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::javanese, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::javanese, east_asian_width::n, 0x00, 10 },
+        { general_category::lm, script::myanmar, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::cham, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::cham, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::cham, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::cham, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::cham, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::cham, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::cham, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::cham, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::cham, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::cham, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::cham, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::cham, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::cham, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::cham, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::tai_viet, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::tai_viet, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::tai_viet, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::tai_viet, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::tai_viet, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::meetei_mayek, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::meetei_mayek, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::meetei_mayek, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::meetei_mayek, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::meetei_mayek, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::meetei_mayek, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::meetei_mayek, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::meetei_mayek, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::meetei_mayek, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::meetei_mayek, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::meetei_mayek, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::meetei_mayek, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::meetei_mayek, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::meetei_mayek, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::meetei_mayek, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::meetei_mayek, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::meetei_mayek, east_asian_width::n, 0x00, 10 },
+        { general_category::cs, script::unknown, east_asian_width::n, 0x00, 0 },
+        { general_category::co, script::unknown, east_asian_width::a, 0x00, 0 },
+        { general_category::cn, script::unknown, east_asian_width::w, 0x00, 0 },
+        { general_category::sm, script::hebrew, east_asian_width::n, 0x10, 0 },
+        { general_category::pc, script::common, east_asian_width::w, 0x00, 0 },
+        { general_category::po, script::common, east_asian_width::w, 0x10, 0 },
+        { general_category::pd, script::common, east_asian_width::w, 0x10, 0 },
+        { general_category::sc, script::common, east_asian_width::w, 0x00, 0 },
+        { general_category::po, script::common, east_asian_width::f, 0x00, 0 },
+        { general_category::sc, script::common, east_asian_width::f, 0x00, 0 },
+        { general_category::ps, script::common, east_asian_width::f, 0x00, 0 },
+        { general_category::pe, script::common, east_asian_width::f, 0x00, 0 },
+        { general_category::sm, script::common, east_asian_width::f, 0x10, 0 },
+        { general_category::pd, script::common, east_asian_width::f, 0x00, 0 },
+        { general_category::nd, script::common, east_asian_width::f, 0x00, 1 },
+        { general_category::nd, script::common, east_asian_width::f, 0x00, 2 },
+        { general_category::nd, script::common, east_asian_width::f, 0x00, 3 },
+        { general_category::nd, script::common, east_asian_width::f, 0x00, 4 },
+        { general_category::nd, script::common, east_asian_width::f, 0x00, 5 },
+        { general_category::nd, script::common, east_asian_width::f, 0x00, 6 },
+        { general_category::nd, script::common, east_asian_width::f, 0x00, 7 },
+        { general_category::nd, script::common, east_asian_width::f, 0x00, 8 },
+        { general_category::nd, script::common, east_asian_width::f, 0x00, 9 },
+        { general_category::nd, script::common, east_asian_width::f, 0x00, 10 },
+        { general_category::lu, script::latin, east_asian_width::f, 0x05, 0 },
+        { general_category::po, script::common, east_asian_width::f, 0x10, 0 },
+        { general_category::sk, script::common, east_asian_width::f, 0x10, 0 },
+        { general_category::pc, script::common, east_asian_width::f, 0x00, 0 },
+        { general_category::sk, script::common, east_asian_width::f, 0x00, 0 },
+        { general_category::ll, script::latin, east_asian_width::f, 0x03, 0 },
+        { general_category::po, script::common, east_asian_width::h, 0x00, 0 },
+        { general_category::ps, script::common, east_asian_width::h, 0x00, 0 },
+        { general_category::pe, script::common, east_asian_width::h, 0x00, 0 },
+        { general_category::lo, script::katakana, east_asian_width::h, 0x01, 0 },
+        { general_category::lm, script::common, east_asian_width::h, 0x01, 0 },
+        { general_category::lo, script::hangul, east_asian_width::h, 0x21, 0 },
+        { general_category::lo, script::hangul, east_asian_width::h, 0x01, 0 },
+        { general_category::so, script::common, east_asian_width::f, 0x00, 0 },
+        { general_category::so, script::common, east_asian_width::h, 0x00, 0 },
+        { general_category::sm, script::common, east_asian_width::h, 0x10, 0 },
+        { general_category::lo, script::linear_b, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 38 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 39 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 40 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 41 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 42 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 43 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 44 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 99 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 100 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 101 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 63 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 102 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 103 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 104 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 105 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 20 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 106 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 107 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 108 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 64 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 109 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 110 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 111 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 112 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 45 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 113 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 114 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 115 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 65 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 116 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 117 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 118 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 119 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 11 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 12 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 2 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 6 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 40 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 63 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 64 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 65 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 18 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 19 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 20 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 45 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 3 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 38 },
+        { general_category::nl, script::greek, east_asian_width::n, 0x01, 100 },
+        { general_category::no, script::greek, east_asian_width::n, 0x00, 12 },
+        { general_category::no, script::greek, east_asian_width::n, 0x00, 52 },
+        { general_category::no, script::greek, east_asian_width::n, 0x00, 13 },
+        { general_category::so, script::greek, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::greek, east_asian_width::n, 0x00, 1 },
+        { general_category::no, script::greek, east_asian_width::n, 0x00, 11 },
+        { general_category::lo, script::lycian, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::carian, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::old_italic, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::old_italic, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::old_italic, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::old_italic, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::old_italic, east_asian_width::n, 0x00, 40 },
+        { general_category::lo, script::gothic, east_asian_width::n, 0x01, 0 },
+        { general_category::nl, script::gothic, east_asian_width::n, 0x01, 44 },
+        { general_category::nl, script::gothic, east_asian_width::n, 0x01, 105 },
+        { general_category::lo, script::old_permic, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::old_permic, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::ugaritic, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::ugaritic, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::old_persian, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::old_persian, east_asian_width::n, 0x00, 0 },
+        { general_category::nl, script::old_persian, east_asian_width::n, 0x01, 2 },
+        { general_category::nl, script::old_persian, east_asian_width::n, 0x01, 3 },
+        { general_category::nl, script::old_persian, east_asian_width::n, 0x01, 18 },
+        { general_category::nl, script::old_persian, east_asian_width::n, 0x01, 37 },
+        { general_category::nl, script::old_persian, east_asian_width::n, 0x01, 19 },
+        { general_category::lu, script::deseret, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::deseret, east_asian_width::n, 0x03, 0 },
+        { general_category::lo, script::shavian, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::osmanya, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::osmanya, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::osmanya, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::osmanya, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::osmanya, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::osmanya, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::osmanya, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::osmanya, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::osmanya, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::osmanya, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::osmanya, east_asian_width::n, 0x00, 10 },
+        { general_category::lu, script::osage, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::osage, east_asian_width::n, 0x03, 0 },
+        { general_category::lo, script::elbasan, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::caucasian_albanian, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::caucasian_albanian, east_asian_width::n, 0x00, 0 },
+        { general_category::lu, script::vithkuqi, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::vithkuqi, east_asian_width::n, 0x03, 0 },
+        { general_category::lo, script::linear_a, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::cypriot, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::imperial_aramaic, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::imperial_aramaic, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::imperial_aramaic, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::imperial_aramaic, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::imperial_aramaic, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::imperial_aramaic, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::imperial_aramaic, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::imperial_aramaic, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::imperial_aramaic, east_asian_width::n, 0x00, 20 },
+        { general_category::no, script::imperial_aramaic, east_asian_width::n, 0x00, 45 },
+        { general_category::lo, script::palmyrene, east_asian_width::n, 0x01, 0 },
+        { general_category::so, script::palmyrene, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::palmyrene, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::palmyrene, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::palmyrene, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::palmyrene, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::palmyrene, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::palmyrene, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::palmyrene, east_asian_width::n, 0x00, 37 },
+        { general_category::lo, script::nabataean, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::nabataean, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::nabataean, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::nabataean, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::nabataean, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::nabataean, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::nabataean, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::nabataean, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::nabataean, east_asian_width::n, 0x00, 19 },
+        { general_category::lo, script::hatran, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::hatran, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::hatran, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::hatran, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::hatran, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::hatran, east_asian_width::n, 0x00, 19 },
+        { general_category::lo, script::phoenician, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::phoenician, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::phoenician, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::phoenician, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::phoenician, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::phoenician, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::phoenician, east_asian_width::n, 0x00, 4 },
+        { general_category::po, script::phoenician, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::lydian, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::lydian, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::meroitic_hieroglyphs, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::meroitic_cursive, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 120 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 12 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 7 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 8 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 9 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 38 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 39 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 40 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 41 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 42 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 99 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 100 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 101 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 63 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 102 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 103 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 104 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 105 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 20 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 106 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 107 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 108 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 64 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 109 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 110 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 111 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 112 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 45 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 113 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 114 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 115 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 65 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 116 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 117 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 118 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 119 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 66 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 121 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 122 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 123 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 124 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 125 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 126 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 127 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 128 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 129 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 56 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 11 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 51 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 130 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 131 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 52 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 13 },
+        { general_category::no, script::meroitic_cursive, east_asian_width::n, 0x00, 57 },
+        { general_category::lo, script::kharoshthi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::kharoshthi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::kharoshthi, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::kharoshthi, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::kharoshthi, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::kharoshthi, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::kharoshthi, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::kharoshthi, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::kharoshthi, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::kharoshthi, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::kharoshthi, east_asian_width::n, 0x00, 20 },
+        { general_category::no, script::kharoshthi, east_asian_width::n, 0x00, 12 },
+        { general_category::po, script::kharoshthi, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::old_south_arabian, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::old_south_arabian, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::old_south_arabian, east_asian_width::n, 0x00, 40 },
+        { general_category::po, script::old_south_arabian, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::old_north_arabian, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::old_north_arabian, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::old_north_arabian, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::old_north_arabian, east_asian_width::n, 0x00, 37 },
+        { general_category::lo, script::manichaean, east_asian_width::n, 0x01, 0 },
+        { general_category::so, script::manichaean, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::manichaean, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::manichaean, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::manichaean, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::manichaean, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::manichaean, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::manichaean, east_asian_width::n, 0x00, 19 },
+        { general_category::po, script::manichaean, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::avestan, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::avestan, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::inscriptional_parthian, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::inscriptional_parthian, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::inscriptional_parthian, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::inscriptional_parthian, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::inscriptional_parthian, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::inscriptional_parthian, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::inscriptional_parthian, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::inscriptional_parthian, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::inscriptional_parthian, east_asian_width::n, 0x00, 20 },
+        { general_category::lo, script::inscriptional_pahlavi, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::inscriptional_pahlavi, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::inscriptional_pahlavi, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::inscriptional_pahlavi, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::inscriptional_pahlavi, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::inscriptional_pahlavi, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::inscriptional_pahlavi, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::inscriptional_pahlavi, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::inscriptional_pahlavi, east_asian_width::n, 0x00, 20 },
+        { general_category::lo, script::psalter_pahlavi, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::psalter_pahlavi, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::psalter_pahlavi, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::psalter_pahlavi, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::psalter_pahlavi, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::psalter_pahlavi, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::psalter_pahlavi, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::psalter_pahlavi, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::psalter_pahlavi, east_asian_width::n, 0x00, 19 },
+        { general_category::lo, script::old_turkic, east_asian_width::n, 0x01, 0 },
+        { general_category::lu, script::old_hungarian, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::old_hungarian, east_asian_width::n, 0x03, 0 },
+        { general_category::no, script::old_hungarian, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::old_hungarian, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::old_hungarian, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::old_hungarian, east_asian_width::n, 0x00, 40 },
+        { general_category::no, script::old_hungarian, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::old_hungarian, east_asian_width::n, 0x00, 20 },
+        { general_category::lo, script::hanifi_rohingya, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::hanifi_rohingya, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::hanifi_rohingya, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::hanifi_rohingya, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::hanifi_rohingya, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::hanifi_rohingya, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::hanifi_rohingya, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::hanifi_rohingya, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::hanifi_rohingya, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::hanifi_rohingya, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::hanifi_rohingya, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::hanifi_rohingya, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 7 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 8 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 9 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 38 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 39 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 40 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 41 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 42 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 43 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 44 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 99 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 100 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 101 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 63 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 102 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 103 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 104 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 105 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 12 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 11 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 51 },
+        { general_category::no, script::arabic, east_asian_width::n, 0x00, 52 },
+        { general_category::lo, script::yezidi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::yezidi, east_asian_width::n, 0x01, 0 },
+        { general_category::pd, script::yezidi, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::old_sogdian, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::old_sogdian, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::old_sogdian, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::old_sogdian, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::old_sogdian, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::old_sogdian, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::old_sogdian, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::old_sogdian, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::old_sogdian, east_asian_width::n, 0x00, 38 },
+        { general_category::no, script::old_sogdian, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::old_sogdian, east_asian_width::n, 0x00, 12 },
+        { general_category::lo, script::sogdian, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::sogdian, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::sogdian, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::sogdian, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::sogdian, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::sogdian, east_asian_width::n, 0x00, 19 },
+        { general_category::po, script::sogdian, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::old_uyghur, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::old_uyghur, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::old_uyghur, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::chorasmian, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::chorasmian, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::chorasmian, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::chorasmian, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::chorasmian, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::chorasmian, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::chorasmian, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::chorasmian, east_asian_width::n, 0x00, 19 },
+        { general_category::lo, script::elymaic, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::brahmi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::brahmi, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::brahmi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::brahmi, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::brahmi, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 7 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 8 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 9 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 38 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 39 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 40 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 41 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 42 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 43 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 44 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::brahmi, east_asian_width::n, 0x00, 20 },
+        { general_category::nd, script::brahmi, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::brahmi, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::brahmi, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::brahmi, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::brahmi, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::brahmi, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::brahmi, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::brahmi, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::brahmi, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::brahmi, east_asian_width::n, 0x00, 10 },
+        { general_category::mn, script::kaithi, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::kaithi, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::kaithi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::kaithi, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::kaithi, east_asian_width::n, 0x00, 0 },
+        { general_category::cf, script::kaithi, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::sora_sompeng, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::sora_sompeng, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::sora_sompeng, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::sora_sompeng, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::sora_sompeng, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::sora_sompeng, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::sora_sompeng, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::sora_sompeng, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::sora_sompeng, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::sora_sompeng, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::sora_sompeng, east_asian_width::n, 0x00, 10 },
+        { general_category::mn, script::chakma, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::chakma, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::chakma, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::chakma, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::chakma, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::chakma, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::chakma, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::chakma, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::chakma, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::chakma, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::chakma, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::chakma, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::chakma, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::chakma, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::chakma, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::mahajani, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::mahajani, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::mahajani, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::sharada, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::sharada, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::sharada, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::sharada, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::sharada, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::sharada, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::sharada, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::sharada, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::sharada, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::sharada, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::sharada, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::sharada, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::sharada, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::sharada, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::sharada, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::sharada, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 7 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 8 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 9 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 38 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 39 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 40 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 41 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 42 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 43 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 44 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::sinhala, east_asian_width::n, 0x00, 20 },
+        { general_category::lo, script::khojki, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::khojki, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::khojki, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::khojki, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::khojki, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::khojki, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::multani, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::multani, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::khudawadi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::khudawadi, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::khudawadi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::khudawadi, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::khudawadi, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::khudawadi, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::khudawadi, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::khudawadi, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::khudawadi, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::khudawadi, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::khudawadi, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::khudawadi, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::khudawadi, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::khudawadi, east_asian_width::n, 0x00, 10 },
+        { general_category::mn, script::grantha, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::grantha, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::grantha, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::grantha, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::grantha, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::newa, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::newa, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::newa, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::newa, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::newa, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::newa, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::newa, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::newa, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::newa, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::newa, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::newa, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::newa, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::newa, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::newa, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::newa, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::tirhuta, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::tirhuta, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::tirhuta, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::tirhuta, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::tirhuta, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::tirhuta, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::tirhuta, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::tirhuta, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::tirhuta, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::tirhuta, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::tirhuta, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::tirhuta, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::tirhuta, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::tirhuta, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::tirhuta, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::siddham, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::siddham, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::siddham, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::siddham, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::siddham, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::modi, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::modi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::modi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::modi, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::modi, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::modi, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::modi, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::modi, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::modi, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::modi, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::modi, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::modi, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::modi, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::modi, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::modi, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::takri, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::takri, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::takri, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::takri, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::takri, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::takri, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::takri, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::takri, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::takri, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::takri, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::takri, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::takri, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::takri, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::takri, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::takri, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::takri, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::ahom, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::ahom, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::ahom, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::ahom, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::ahom, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::ahom, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::ahom, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::ahom, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::ahom, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::ahom, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::ahom, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::ahom, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::ahom, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::ahom, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::ahom, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::ahom, east_asian_width::n, 0x00, 37 },
+        { general_category::po, script::ahom, east_asian_width::n, 0x00, 0 },
+        { general_category::so, script::ahom, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::dogra, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::dogra, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::dogra, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::dogra, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::dogra, east_asian_width::n, 0x00, 0 },
+        { general_category::lu, script::warang_citi, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::warang_citi, east_asian_width::n, 0x03, 0 },
+        { general_category::nd, script::warang_citi, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::warang_citi, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::warang_citi, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::warang_citi, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::warang_citi, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::warang_citi, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::warang_citi, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::warang_citi, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::warang_citi, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::warang_citi, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::warang_citi, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::warang_citi, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::warang_citi, east_asian_width::n, 0x00, 38 },
+        { general_category::no, script::warang_citi, east_asian_width::n, 0x00, 39 },
+        { general_category::no, script::warang_citi, east_asian_width::n, 0x00, 40 },
+        { general_category::no, script::warang_citi, east_asian_width::n, 0x00, 41 },
+        { general_category::no, script::warang_citi, east_asian_width::n, 0x00, 42 },
+        { general_category::no, script::warang_citi, east_asian_width::n, 0x00, 43 },
+        { general_category::no, script::warang_citi, east_asian_width::n, 0x00, 44 },
+        { general_category::lo, script::warang_citi, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::dives_akuru, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::dives_akuru, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::dives_akuru, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::dives_akuru, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::dives_akuru, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::dives_akuru, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::dives_akuru, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::dives_akuru, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::dives_akuru, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::dives_akuru, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::dives_akuru, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::dives_akuru, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::dives_akuru, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::dives_akuru, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::dives_akuru, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::dives_akuru, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::nandinagari, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::nandinagari, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::nandinagari, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::nandinagari, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::nandinagari, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::zanabazar_square, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::zanabazar_square, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::zanabazar_square, east_asian_width::n, 0x00, 0 },
+        { general_category::mc, script::zanabazar_square, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::zanabazar_square, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::soyombo, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::soyombo, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::soyombo, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::soyombo, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::soyombo, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::pau_cin_hau, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::bhaiksuki, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::bhaiksuki, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::bhaiksuki, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::bhaiksuki, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::bhaiksuki, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::bhaiksuki, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::bhaiksuki, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::bhaiksuki, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::bhaiksuki, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::bhaiksuki, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::bhaiksuki, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::bhaiksuki, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::bhaiksuki, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::bhaiksuki, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::bhaiksuki, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 7 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 8 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 9 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 37 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 38 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 39 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 40 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 41 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 42 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 43 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 44 },
+        { general_category::no, script::bhaiksuki, east_asian_width::n, 0x00, 19 },
+        { general_category::po, script::marchen, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::marchen, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::marchen, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::marchen, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::masaram_gondi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::masaram_gondi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::masaram_gondi, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::masaram_gondi, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::masaram_gondi, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::masaram_gondi, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::masaram_gondi, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::masaram_gondi, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::masaram_gondi, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::masaram_gondi, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::masaram_gondi, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::masaram_gondi, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::masaram_gondi, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::gunjala_gondi, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::gunjala_gondi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::gunjala_gondi, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::gunjala_gondi, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::gunjala_gondi, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::gunjala_gondi, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::gunjala_gondi, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::gunjala_gondi, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::gunjala_gondi, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::gunjala_gondi, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::gunjala_gondi, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::gunjala_gondi, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::gunjala_gondi, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::gunjala_gondi, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::makasar, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::makasar, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::makasar, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::makasar, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 132 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 21 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 133 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 134 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 22 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 135 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 23 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 136 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 24 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 14 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 25 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 15 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 26 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 16 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 27 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 11 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 12 },
+        { general_category::no, script::tamil, east_asian_width::n, 0x00, 13 },
+        { general_category::po, script::tamil, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::cuneiform, east_asian_width::n, 0x01, 0 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 3 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 4 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 5 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 6 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 7 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 8 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 9 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 10 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 2 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 137 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 138 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 51 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 52 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 57 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 15 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 11 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 56 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 12 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 39 },
+        { general_category::nl, script::cuneiform, east_asian_width::n, 0x01, 40 },
+        { general_category::po, script::cuneiform, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::cypro_minoan, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::cypro_minoan, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::egyptian_hieroglyphs, east_asian_width::n, 0x01, 0 },
+        { general_category::cf, script::egyptian_hieroglyphs, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::anatolian_hieroglyphs, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::mro, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::mro, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::mro, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::mro, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::mro, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::mro, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::mro, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::mro, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::mro, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::mro, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::mro, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::mro, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::tangsa, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::tangsa, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::tangsa, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::tangsa, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::tangsa, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::tangsa, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::tangsa, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::tangsa, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::tangsa, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::tangsa, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::tangsa, east_asian_width::n, 0x00, 10 },
+        { general_category::lo, script::bassa_vah, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::bassa_vah, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::bassa_vah, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::pahawh_hmong, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::pahawh_hmong, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::pahawh_hmong, east_asian_width::n, 0x00, 0 },
+        { general_category::so, script::pahawh_hmong, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::pahawh_hmong, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::pahawh_hmong, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::pahawh_hmong, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::pahawh_hmong, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::pahawh_hmong, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::pahawh_hmong, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::pahawh_hmong, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::pahawh_hmong, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::pahawh_hmong, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::pahawh_hmong, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::pahawh_hmong, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::pahawh_hmong, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::pahawh_hmong, east_asian_width::n, 0x00, 19 },
+        { general_category::no, script::pahawh_hmong, east_asian_width::n, 0x00, 45 },
+        { general_category::no, script::pahawh_hmong, east_asian_width::n, 0x00, 139 },
+        { general_category::no, script::pahawh_hmong, east_asian_width::n, 0x00, 97 },
+        { general_category::no, script::pahawh_hmong, east_asian_width::n, 0x00, 140 },
+        { general_category::no, script::pahawh_hmong, east_asian_width::n, 0x00, 98 },
+        { general_category::lu, script::medefaidrin, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::medefaidrin, east_asian_width::n, 0x03, 0 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 1 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 7 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 8 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 9 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 10 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 18 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 61 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 62 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 67 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 68 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 69 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 17 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 46 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 47 },
+        { general_category::no, script::medefaidrin, east_asian_width::n, 0x00, 48 },
+        { general_category::po, script::medefaidrin, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::miao, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::miao, east_asian_width::n, 0x01, 0 },
+        { general_category::mc, script::miao, east_asian_width::n, 0x01, 0 },
+        { general_category::lm, script::miao, east_asian_width::n, 0x01, 0 },
+        { general_category::lm, script::tangut, east_asian_width::w, 0x01, 0 },
+        { general_category::lm, script::nushu, east_asian_width::w, 0x01, 0 },
+        { general_category::po, script::han, east_asian_width::w, 0x00, 0 },
+        { general_category::mn, script::khitan_small_script, east_asian_width::w, 0x00, 0 },
+        { general_category::mc, script::han, east_asian_width::w, 0x01, 0 },
+        { general_category::lo, script::tangut, east_asian_width::w, 0x01, 0 },
+        { general_category::lo, script::khitan_small_script, east_asian_width::w, 0x01, 0 },
+        { general_category::lo, script::nushu, east_asian_width::w, 0x01, 0 },
+        { general_category::lo, script::duployan, east_asian_width::n, 0x01, 0 },
+        { general_category::so, script::duployan, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::duployan, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::duployan, east_asian_width::n, 0x01, 0 },
+        { general_category::po, script::duployan, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::greek, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 61 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 62 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 67 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 68 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 69 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 17 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 46 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 47 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 48 },
+        { general_category::nd, script::common, east_asian_width::n, 0x10, 1 },
+        { general_category::nd, script::common, east_asian_width::n, 0x10, 2 },
+        { general_category::nd, script::common, east_asian_width::n, 0x10, 3 },
+        { general_category::nd, script::common, east_asian_width::n, 0x10, 4 },
+        { general_category::nd, script::common, east_asian_width::n, 0x10, 5 },
+        { general_category::nd, script::common, east_asian_width::n, 0x10, 6 },
+        { general_category::nd, script::common, east_asian_width::n, 0x10, 7 },
+        { general_category::nd, script::common, east_asian_width::n, 0x10, 8 },
+        { general_category::nd, script::common, east_asian_width::n, 0x10, 9 },
+        { general_category::nd, script::common, east_asian_width::n, 0x10, 10 },
+        { general_category::so, script::signwriting, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::signwriting, east_asian_width::n, 0x00, 0 },
+        { general_category::po, script::signwriting, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::glagolitic, east_asian_width::n, 0x01, 0 },
+        { general_category::lo, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 0 },
+        { general_category::lm, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 10 },
+        { general_category::so, script::nyiakeng_puachue_hmong, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::toto, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::toto, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::wancho, east_asian_width::n, 0x01, 0 },
+        { general_category::mn, script::wancho, east_asian_width::n, 0x00, 0 },
+        { general_category::nd, script::wancho, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::wancho, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::wancho, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::wancho, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::wancho, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::wancho, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::wancho, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::wancho, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::wancho, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::wancho, east_asian_width::n, 0x00, 10 },
+        { general_category::sc, script::wancho, east_asian_width::n, 0x00, 0 },
+        { general_category::lo, script::mende_kikakui, east_asian_width::n, 0x01, 0 },
+        { general_category::no, script::mende_kikakui, east_asian_width::n, 0x00, 2 },
+        { general_category::no, script::mende_kikakui, east_asian_width::n, 0x00, 3 },
+        { general_category::no, script::mende_kikakui, east_asian_width::n, 0x00, 4 },
+        { general_category::no, script::mende_kikakui, east_asian_width::n, 0x00, 5 },
+        { general_category::no, script::mende_kikakui, east_asian_width::n, 0x00, 6 },
+        { general_category::no, script::mende_kikakui, east_asian_width::n, 0x00, 7 },
+        { general_category::no, script::mende_kikakui, east_asian_width::n, 0x00, 8 },
+        { general_category::no, script::mende_kikakui, east_asian_width::n, 0x00, 9 },
+        { general_category::no, script::mende_kikakui, east_asian_width::n, 0x00, 10 },
+        { general_category::mn, script::mende_kikakui, east_asian_width::n, 0x00, 0 },
+        { general_category::lu, script::adlam, east_asian_width::n, 0x05, 0 },
+        { general_category::ll, script::adlam, east_asian_width::n, 0x03, 0 },
+        { general_category::mn, script::adlam, east_asian_width::n, 0x00, 0 },
+        { general_category::mn, script::adlam, east_asian_width::n, 0x01, 0 },
+        { general_category::lm, script::adlam, east_asian_width::n, 0x01, 0 },
+        { general_category::nd, script::adlam, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::adlam, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::adlam, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::adlam, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::adlam, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::adlam, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::adlam, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::adlam, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::adlam, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::adlam, east_asian_width::n, 0x00, 10 },
+        { general_category::po, script::adlam, east_asian_width::n, 0x00, 0 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 66 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 121 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 141 },
+        { general_category::no, script::common, east_asian_width::n, 0x00, 142 },
+        { general_category::lo, script::arabic, east_asian_width::n, 0x11, 0 },
+        { general_category::so, script::hiragana, east_asian_width::w, 0x00, 0 },
+        { general_category::nd, script::common, east_asian_width::n, 0x00, 1 },
+        { general_category::nd, script::common, east_asian_width::n, 0x00, 2 },
+        { general_category::nd, script::common, east_asian_width::n, 0x00, 3 },
+        { general_category::nd, script::common, east_asian_width::n, 0x00, 4 },
+        { general_category::nd, script::common, east_asian_width::n, 0x00, 5 },
+        { general_category::nd, script::common, east_asian_width::n, 0x00, 6 },
+        { general_category::nd, script::common, east_asian_width::n, 0x00, 7 },
+        { general_category::nd, script::common, east_asian_width::n, 0x00, 8 },
+        { general_category::nd, script::common, east_asian_width::n, 0x00, 9 },
+        { general_category::nd, script::common, east_asian_width::n, 0x00, 10 },
+    };
+    static constexpr numeric_value numeric_values[143] = {
+        { 0, 1 },
+        { 0LL, 1 },
+        { 1LL, 1 },
+        { 2LL, 1 },
+        { 3LL, 1 },
+        { 4LL, 1 },
+        { 5LL, 1 },
+        { 6LL, 1 },
+        { 7LL, 1 },
+        { 8LL, 1 },
+        { 9LL, 1 },
+        { 1LL, 4 },
+        { 1LL, 2 },
+        { 3LL, 4 },
+        { 1LL, 16 },
+        { 1LL, 8 },
+        { 3LL, 16 },
+        { 16LL, 1 },
+        { 10LL, 1 },
+        { 100LL, 1 },
+        { 1000LL, 1 },
+        { 1LL, 160 },
+        { 1LL, 40 },
+        { 3LL, 80 },
+        { 1LL, 20 },
+        { 1LL, 10 },
+        { 3LL, 20 },
+        { 1LL, 5 },
+        { 3LL, 2 },
+        { 5LL, 2 },
+        { 7LL, 2 },
+        { 9LL, 2 },
+        { 11LL, 2 },
+        { 13LL, 2 },
+        { 15LL, 2 },
+        { 17LL, 2 },
+        { -1LL, 2 },
+        { 20LL, 1 },
+        { 30LL, 1 },
+        { 40LL, 1 },
+        { 50LL, 1 },
+        { 60LL, 1 },
+        { 70LL, 1 },
+        { 80LL, 1 },
+        { 90LL, 1 },
+        { 10000LL, 1 },
+        { 17LL, 1 },
+        { 18LL, 1 },
+        { 19LL, 1 },
+        { 1LL, 7 },
+        { 1LL, 9 },
+        { 1LL, 3 },
+        { 2LL, 3 },
+        { 2LL, 5 },
+        { 3LL, 5 },
+        { 4LL, 5 },
+        { 1LL, 6 },
+        { 5LL, 6 },
+        { 3LL, 8 },
+        { 5LL, 8 },
+        { 7LL, 8 },
+        { 11LL, 1 },
+        { 12LL, 1 },
+        { 500LL, 1 },
+        { 5000LL, 1 },
+        { 50000LL, 1 },
+        { 100000LL, 1 },
+        { 13LL, 1 },
+        { 14LL, 1 },
+        { 15LL, 1 },
+        { 21LL, 1 },
+        { 22LL, 1 },
+        { 23LL, 1 },
+        { 24LL, 1 },
+        { 25LL, 1 },
+        { 26LL, 1 },
+        { 27LL, 1 },
+        { 28LL, 1 },
+        { 29LL, 1 },
+        { 31LL, 1 },
+        { 32LL, 1 },
+        { 33LL, 1 },
+        { 34LL, 1 },
+        { 35LL, 1 },
+        { 36LL, 1 },
+        { 37LL, 1 },
+        { 38LL, 1 },
+        { 39LL, 1 },
+        { 41LL, 1 },
+        { 42LL, 1 },
+        { 43LL, 1 },
+        { 44LL, 1 },
+        { 45LL, 1 },
+        { 46LL, 1 },
+        { 47LL, 1 },
+        { 48LL, 1 },
+        { 49LL, 1 },
+        { 100000000LL, 1 },
+        { 1000000000000LL, 1 },
+        { 200LL, 1 },
+        { 300LL, 1 },
+        { 400LL, 1 },
+        { 600LL, 1 },
+        { 700LL, 1 },
+        { 800LL, 1 },
+        { 900LL, 1 },
+        { 2000LL, 1 },
+        { 3000LL, 1 },
+        { 4000LL, 1 },
+        { 6000LL, 1 },
+        { 7000LL, 1 },
+        { 8000LL, 1 },
+        { 9000LL, 1 },
+        { 20000LL, 1 },
+        { 30000LL, 1 },
+        { 40000LL, 1 },
+        { 60000LL, 1 },
+        { 70000LL, 1 },
+        { 80000LL, 1 },
+        { 90000LL, 1 },
+        { 11LL, 12 },
+        { 200000LL, 1 },
+        { 300000LL, 1 },
+        { 400000LL, 1 },
+        { 500000LL, 1 },
+        { 600000LL, 1 },
+        { 700000LL, 1 },
+        { 800000LL, 1 },
+        { 900000LL, 1 },
+        { 1LL, 12 },
+        { 5LL, 12 },
+        { 7LL, 12 },
+        { 1LL, 320 },
+        { 1LL, 80 },
+        { 1LL, 64 },
+        { 1LL, 32 },
+        { 3LL, 64 },
+        { 216000LL, 1 },
+        { 432000LL, 1 },
+        { 1000000LL, 1 },
+        { 10000000000LL, 1 },
+        { 10000000LL, 1 },
+        { 20000000LL, 1 },
+    };
+    static constexpr const char *general_category_names[30] = {
+        "Cn",
+        "Lu",
+        "Ll",
+        "Lt",
+        "Lm",
+        "Lo",
+        "Mn",
+        "Mc",
+        "Me",
+        "Nd",
+        "Nl",
+        "No",
+        "Pc",
+        "Pd",
+        "Ps",
+        "Pe",
+        "Pi",
+        "Pf",
+        "Po",
+        "Sm",
+        "Sc",
+        "Sk",
+        "So",
+        "Zs",
+        "Zl",
+        "Zp",
+        "Cc",
+        "Cf",
+        "Cs",
+        "Co",
+    };
+    static constexpr const char *script_names[162] = {
+        "Unknown",
+        "Common",
+        "Inherited",
+        "Adlam",
+        "Ahom",
+        "Anatolian_Hieroglyphs",
+        "Arabic",
+        "Armenian",
+        "Avestan",
+        "Balinese",
+        "Bamum",
+        "Bassa_Vah",
+        "Batak",
+        "Bengali",
+        "Bhaiksuki",
+        "Bopomofo",
+        "Brahmi",
+        "Braille",
+        "Buginese",
+        "Buhid",
+        "Canadian_Aboriginal",
+        "Carian",
+        "Caucasian_Albanian",
+        "Chakma",
+        "Cham",
+        "Cherokee",
+        "Chorasmian",
+        "Coptic",
+        "Cuneiform",
+        "Cypriot",
+        "Cypro_Minoan",
+        "Cyrillic",
+        "Deseret",
+        "Devanagari",
+        "Dives_Akuru",
+        "Dogra",
+        "Duployan",
+        "Egyptian_Hieroglyphs",
+        "Elbasan",
+        "Elymaic",
+        "Ethiopic",
+        "Georgian",
+        "Glagolitic",
+        "Gothic",
+        "Grantha",
+        "Greek",
+        "Gujarati",
+        "Gunjala_Gondi",
+        "Gurmukhi",
+        "Han",
+        "Hangul",
+        "Hanifi_Rohingya",
+        "Hanunoo",
+        "Hatran",
+        "Hebrew",
+        "Hiragana",
+        "Imperial_Aramaic",
+        "Inscriptional_Pahlavi",
+        "Inscriptional_Parthian",
+        "Javanese",
+        "Kaithi",
+        "Kannada",
+        "Katakana",
+        "Kayah_Li",
+        "Kharoshthi",
+        "Khitan_Small_Script",
+        "Khmer",
+        "Khojki",
+        "Khudawadi",
+        "Lao",
+        "Latin",
+        "Lepcha",
+        "Limbu",
+        "Linear_A",
+        "Linear_B",
+        "Lisu",
+        "Lycian",
+        "Lydian",
+        "Mahajani",
+        "Makasar",
+        "Malayalam",
+        "Mandaic",
+        "Manichaean",
+        "Marchen",
+        "Masaram_Gondi",
+        "Medefaidrin",
+        "Meetei_Mayek",
+        "Mende_Kikakui",
+        "Meroitic_Cursive",
+        "Meroitic_Hieroglyphs",
+        "Miao",
+        "Modi",
+        "Mongolian",
+        "Mro",
+        "Multani",
+        "Myanmar",
+        "Nabataean",
+        "Nandinagari",
+        "New_Tai_Lue",
+        "Newa",
+        "Nko",
+        "Nushu",
+        "Nyiakeng_Puachue_Hmong",
+        "Ogham",
+        "Ol_Chiki",
+        "Old_Hungarian",
+        "Old_Italic",
+        "Old_North_Arabian",
+        "Old_Permic",
+        "Old_Persian",
+        "Old_Sogdian",
+        "Old_South_Arabian",
+        "Old_Turkic",
+        "Old_Uyghur",
+        "Oriya",
+        "Osage",
+        "Osmanya",
+        "Pahawh_Hmong",
+        "Palmyrene",
+        "Pau_Cin_Hau",
+        "Phags_Pa",
+        "Phoenician",
+        "Psalter_Pahlavi",
+        "Rejang",
+        "Runic",
+        "Samaritan",
+        "Saurashtra",
+        "Sharada",
+        "Shavian",
+        "Siddham",
+        "SignWriting",
+        "Sinhala",
+        "Sogdian",
+        "Sora_Sompeng",
+        "Soyombo",
+        "Sundanese",
+        "Syloti_Nagri",
+        "Syriac",
+        "Tagalog",
+        "Tagbanwa",
+        "Tai_Le",
+        "Tai_Tham",
+        "Tai_Viet",
+        "Takri",
+        "Tamil",
+        "Tangsa",
+        "Tangut",
+        "Telugu",
+        "Thaana",
+        "Thai",
+        "Tibetan",
+        "Tifinagh",
+        "Tirhuta",
+        "Toto",
+        "Ugaritic",
+        "Vai",
+        "Vithkuqi",
+        "Wancho",
+        "Warang_Citi",
+        "Yezidi",
+        "Yi",
+        "Zanabazar_Square",
+    };
+    static constexpr int block_bits = 4;
+    static constexpr int index_block_bits = 5;
+    static constexpr unsigned char index[0x110000 >> 9] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 27, 27,
+        27, 27, 27, 27, 27, 27, 30, 31, 32, 33, 27, 34, 35, 27, 27, 36,
+        27, 37, 27, 38, 27, 27, 27, 39, 27, 40, 27, 41, 27, 27, 27, 27,
+        42, 27, 43, 27, 27, 27, 44, 27, 27, 27, 27, 45, 27, 27, 27, 27,
+        46, 47, 48, 49, 50, 51, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 53, 54, 54, 54, 54,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 56, 57, 58, 59,
+        60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+        76, 77, 78, 79, 79, 79, 79, 80, 81, 81, 82, 79, 79, 79, 79, 79,
+        79, 79, 83, 84, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 85, 86, 79, 87, 88, 88, 88, 88, 88, 88, 88, 88,
+        88, 88, 88, 89, 88, 90, 91, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 92, 93, 94, 79, 79, 79, 79, 95, 79,
+        79, 79, 79, 79, 79, 79, 79, 96, 97, 98, 99, 100, 101, 102, 79, 103,
+        104, 105, 79, 106, 107, 79, 108, 109, 110, 111, 112, 113, 114, 115, 79, 79,
+        116, 27, 27, 27, 117, 118, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+        27, 119, 27, 27, 120, 27, 27, 27, 27, 27, 27, 27, 27, 121, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+        27, 122, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 123, 27, 27, 27, 27, 27, 27, 27, 124, 125, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 126, 27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 127, 128, 128, 128, 128, 128, 128, 129, 130, 128, 131,
+        27, 27, 27, 27, 27, 27, 27, 27, 27, 132, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 131,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        133, 134, 134, 134, 134, 134, 134, 134, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 135,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 135,
+    };
+    static constexpr unsigned short index_blocks[136][32] = {
+        {
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 1, 9, 10, 11, 12, 13, 14,
+            15, 16, 17, 18, 19, 20, 17, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+        },
+        {
+            28, 28, 28, 30, 31, 32, 32, 33, 33, 34, 33, 35, 36, 37, 38, 39,
+            40, 40, 40, 40, 41, 40, 40, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+        },
+        {
+            51, 52, 52, 53, 53, 54, 55, 55, 56, 55, 55, 55, 57, 55, 55, 55,
+            55, 55, 55, 58, 59, 60, 61, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+        },
+        {
+            70, 71, 72, 72, 73, 74, 75, 76, 72, 72, 72, 72, 72, 77, 78, 79,
+            80, 81, 82, 83, 84, 72, 72, 72, 85, 85, 86, 87, 88, 89, 90, 91,
+        },
+        {
+            92, 93, 94, 95, 96, 97, 98, 72, 99, 100, 72, 72, 101, 102, 103, 104,
+            105, 106, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+        },
+        {
+            120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+            136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+        },
+        {
+            152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+            168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+        },
+        {
+            184, 185, 185, 186, 187, 188, 189, 189, 190, 191, 192, 193, 194, 195, 189, 189,
+            196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 189, 189,
+        },
+        {
+            210, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 219, 220, 221, 221, 222,
+            223, 223, 223, 223, 223, 224, 225, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+        },
+        {
+            227, 227, 227, 227, 228, 229, 227, 227, 228, 227, 227, 230, 231, 232, 227, 227,
+            227, 231, 227, 227, 227, 233, 234, 235, 227, 236, 237, 237, 237, 237, 237, 238,
+        },
+        {
+            239, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+            240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+        },
+        {
+            240, 240, 240, 240, 240, 240, 241, 240, 242, 243, 244, 244, 244, 244, 245, 246,
+            247, 248, 249, 250, 251, 252, 253, 254, 255, 255, 255, 256, 257, 258, 259, 260,
+        },
+        {
+            261, 262, 263, 263, 264, 263, 263, 265, 266, 263, 267, 240, 240, 240, 240, 268,
+            269, 270, 271, 272, 273, 274, 275, 276, 277, 277, 278, 277, 279, 280, 281, 281,
+        },
+        {
+            282, 283, 284, 284, 284, 285, 286, 287, 288, 288, 289, 290, 291, 189, 189, 189,
+            292, 293, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 303, 304, 305,
+        },
+        {
+            306, 306, 307, 308, 309, 310, 311, 312, 313, 219, 219, 314, 315, 316, 317, 318,
+            33, 33, 319, 320, 320, 321, 322, 323, 33, 324, 320, 325, 326, 326, 327, 328,
+        },
+        {
+            28, 28, 28, 28, 28, 28, 28, 28, 28, 329, 28, 28, 28, 28, 28, 28,
+            330, 331, 330, 330, 331, 332, 330, 333, 334, 334, 334, 335, 336, 337, 338, 339,
+        },
+        {
+            340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355,
+            356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371,
+        },
+        {
+            372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 379, 379, 379, 379,
+            384, 385, 386, 387, 387, 387, 387, 388, 387, 389, 379, 390, 387, 391, 392, 393,
+        },
+        {
+            387, 387, 394, 189, 395, 189, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+            400, 400, 400, 400, 406, 400, 400, 407, 400, 408, 409, 410, 411, 412, 413, 414,
+        },
+        {
+            415, 416, 387, 387, 417, 418, 419, 420, 387, 421, 422, 423, 424, 425, 426, 427,
+            428, 387, 429, 430, 431, 432, 433, 434, 435, 436, 387, 437, 438, 379, 439, 379,
+        },
+        {
+            440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+            379, 379, 379, 379, 379, 379, 379, 379, 441, 442, 379, 379, 379, 443, 379, 444,
+        },
+        {
+            379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379,
+            387, 445, 387, 379, 446, 447, 387, 448, 387, 449, 387, 387, 387, 387, 387, 387,
+        },
+        {
+            450, 450, 450, 451, 451, 451, 452, 453, 454, 454, 454, 454, 454, 454, 455, 456,
+            221, 221, 457, 458, 458, 458, 459, 460, 227, 461, 462, 462, 462, 462, 463, 463,
+        },
+        {
+            464, 465, 466, 467, 468, 469, 189, 189, 470, 471, 470, 470, 470, 470, 470, 472,
+            470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 473, 189, 474,
+        },
+        {
+            475, 476, 477, 478, 479, 480, 480, 480, 480, 481, 482, 483, 483, 483, 483, 484,
+            485, 486, 486, 487, 223, 223, 488, 223, 489, 490, 486, 486, 491, 491, 492, 483,
+        },
+        {
+            493, 494, 495, 491, 496, 497, 493, 498, 495, 491, 491, 499, 491, 500, 500, 501,
+            500, 500, 500, 500, 500, 502, 491, 491, 491, 491, 491, 491, 491, 491, 491, 491,
+        },
+        {
+            503, 504, 504, 504, 504, 504, 504, 504, 505, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 506, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 507, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 387, 387, 387, 387,
+        },
+        {
+            508, 504, 504, 504, 504, 509, 504, 504, 510, 511, 504, 512, 513, 514, 515, 504,
+            516, 504, 504, 504, 504, 504, 504, 517, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            518, 504, 504, 504, 519, 504, 520, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 521, 504, 504, 504, 504, 504, 504, 504, 522, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 523, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 524,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 525, 504, 504, 504, 504, 504, 504, 504, 526,
+            527, 528, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 529,
+            504, 504, 504, 504, 530, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 531, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            532, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 533, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 534, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 535, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 536, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 537, 505, 504, 504, 504, 504,
+            504, 504, 504, 528, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 538, 504, 539, 504, 504, 540, 504, 504, 504, 504, 504, 504, 504, 541,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            542, 543, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+            542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+        },
+        {
+            542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+            542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+        },
+        {
+            542, 542, 542, 542, 542, 542, 542, 542, 544, 545, 545, 545, 546, 547, 547, 548,
+            549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 549, 549,
+        },
+        {
+            550, 549, 551, 189, 55, 55, 552, 553, 55, 554, 555, 555, 555, 555, 556, 557,
+            39, 558, 559, 560, 28, 28, 28, 561, 562, 563, 564, 565, 566, 567, 189, 568,
+        },
+        {
+            569, 570, 571, 572, 573, 573, 573, 574, 575, 576, 576, 577, 578, 579, 580, 581,
+            582, 583, 584, 585, 586, 587, 223, 588, 589, 590, 590, 591, 592, 593, 594, 595,
+        },
+        {
+            596, 596, 597, 598, 599, 600, 210, 601, 602, 602, 602, 603, 604, 605, 606, 607,
+            608, 609, 462, 33, 33, 610, 611, 612, 612, 612, 612, 612, 613, 613, 614, 615,
+        },
+        {
+            223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+            223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+        },
+        {
+            223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+            223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 616, 226, 617, 226, 226, 618,
+        },
+        {
+            619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619,
+            619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619,
+        },
+        {
+            620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620,
+            620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620,
+        },
+        {
+            620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620,
+            504, 504, 504, 504, 504, 504, 621, 622, 504, 504, 504, 623, 504, 624, 504, 625,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 626, 504, 504, 504, 504, 504, 504, 627, 628, 628,
+            629, 630, 631, 632, 633, 72, 72, 72, 72, 72, 72, 634, 635, 636, 72, 72,
+        },
+        {
+            72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+            72, 72, 72, 637, 638, 72, 72, 72, 72, 639, 72, 72, 640, 189, 189, 641,
+        },
+        {
+            642, 643, 644, 645, 646, 647, 648, 649, 72, 72, 72, 72, 72, 72, 72, 650,
+            651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666,
+        },
+        {
+            667, 668, 669, 670, 671, 671, 189, 189, 668, 668, 668, 668, 668, 668, 668, 672,
+            673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 189, 189, 387, 387, 684,
+        },
+        {
+            189, 189, 189, 189, 189, 189, 189, 189, 685, 686, 687, 687, 687, 688, 689, 690,
+            691, 691, 692, 693, 694, 695, 695, 696, 697, 698, 699, 699, 700, 701, 189, 189,
+        },
+        {
+            702, 702, 703, 704, 704, 705, 705, 705, 706, 707, 708, 709, 709, 710, 711, 712,
+            713, 713, 714, 715, 715, 715, 716, 717, 717, 718, 719, 720, 189, 189, 189, 189,
+        },
+        {
+            721, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721,
+            721, 721, 721, 722, 721, 723, 724, 189, 725, 320, 320, 726, 189, 189, 189, 189,
+        },
+        {
+            727, 728, 728, 729, 730, 731, 732, 733, 734, 735, 736, 189, 189, 189, 737, 738,
+            739, 740, 741, 742, 189, 189, 189, 189, 743, 743, 744, 745, 746, 747, 748, 749,
+        },
+        {
+            750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 189, 189, 760, 761, 762, 763,
+            764, 764, 764, 765, 766, 767, 768, 769, 770, 771, 772, 189, 189, 189, 189, 189,
+        },
+        {
+            773, 773, 773, 773, 774, 189, 189, 189, 775, 775, 775, 776, 777, 777, 777, 778,
+            779, 779, 780, 781, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            189, 189, 189, 189, 189, 189, 782, 783, 784, 784, 785, 786, 189, 189, 189, 189,
+            787, 788, 789, 790, 791, 792, 189, 793, 794, 189, 189, 795, 796, 189, 797, 798,
+        },
+        {
+            799, 800, 800, 801, 802, 803, 804, 805, 806, 807, 807, 808, 809, 810, 811, 812,
+            813, 814, 815, 816, 817, 818, 818, 819, 820, 821, 821, 822, 823, 824, 825, 826,
+        },
+        {
+            827, 828, 829, 830, 189, 189, 189, 189, 831, 832, 833, 834, 834, 835, 836, 837,
+            838, 839, 840, 841, 842, 843, 844, 845, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            846, 846, 846, 847, 848, 849, 850, 189, 851, 851, 851, 852, 853, 854, 189, 189,
+            189, 189, 189, 189, 189, 189, 189, 189, 855, 855, 856, 857, 858, 859, 189, 189,
+        },
+        {
+            860, 860, 860, 861, 862, 863, 864, 189, 865, 865, 866, 867, 868, 189, 189, 189,
+            869, 870, 871, 872, 873, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            874, 874, 875, 876, 189, 189, 189, 189, 189, 189, 877, 877, 878, 878, 879, 880,
+            881, 882, 883, 884, 885, 886, 189, 189, 189, 189, 887, 888, 888, 889, 890, 189,
+        },
+        {
+            891, 892, 892, 893, 894, 895, 896, 896, 897, 898, 899, 240, 900, 900, 900, 901,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 189, 189, 189, 189,
+            914, 915, 915, 916, 917, 918, 919, 920, 921, 922, 923, 189, 189, 189, 189, 189,
+        },
+        {
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 924, 925,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 926, 927, 928, 929, 930,
+        },
+        {
+            931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931,
+            931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931,
+        },
+        {
+            931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931, 931,
+            931, 931, 931, 931, 931, 931, 931, 931, 931, 932, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            933, 934, 935, 936, 937, 938, 939, 940, 931, 931, 931, 931, 931, 931, 931, 931,
+            931, 931, 931, 931, 941, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 942, 942, 942, 942, 942, 942, 943,
+        },
+        {
+            944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944,
+            944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944,
+        },
+        {
+            944, 944, 945, 946, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947,
+            947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947,
+        },
+        {
+            947, 947, 947, 947, 948, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555,
+            555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555,
+        },
+        {
+            555, 555, 555, 949, 950, 951, 952, 953, 953, 953, 953, 954, 955, 956, 957, 958,
+            959, 959, 959, 960, 961, 962, 963, 964, 959, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            189, 189, 189, 189, 965, 965, 966, 966, 967, 968, 189, 189, 189, 189, 189, 189,
+            969, 969, 969, 969, 970, 971, 972, 972, 973, 974, 189, 189, 189, 189, 975, 976,
+        },
+        {
+            977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977,
+            977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977,
+        },
+        {
+            977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977,
+            977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 978,
+        },
+        {
+            977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977,
+            979, 979, 979, 979, 979, 979, 979, 979, 979, 979, 979, 979, 979, 979, 979, 979,
+        },
+        {
+            979, 979, 979, 979, 979, 979, 979, 979, 979, 979, 979, 979, 979, 980, 189, 189,
+            981, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 982,
+        },
+        {
+            983, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+            480, 480, 984, 189, 189, 985, 986, 987, 987, 987, 987, 987, 987, 987, 987, 987,
+        },
+        {
+            987, 987, 987, 987, 987, 987, 987, 987, 987, 987, 987, 987, 987, 987, 987, 988,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            989, 989, 989, 989, 989, 989, 990, 991, 992, 993, 994, 189, 189, 189, 189, 189,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+            326, 326, 995, 326, 996, 387, 387, 387, 387, 387, 387, 387, 997, 189, 189, 189,
+        },
+        {
+            387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 998,
+            387, 387, 999, 387, 387, 387, 1000, 1001, 1002, 387, 1003, 387, 387, 387, 395, 189,
+        },
+        {
+            1004, 1004, 1004, 1004, 1005, 189, 189, 189, 189, 189, 189, 189, 189, 189, 1006, 1007,
+            387, 387, 387, 387, 387, 394, 1008, 1009, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            1010, 1011, 1012, 1013, 1014, 1015, 1016, 1010, 1017, 1018, 1019, 1020, 1021, 1010, 1011, 1012,
+            1022, 1023, 1012, 1024, 1025, 1026, 1027, 1010, 1028, 1012, 1010, 1011, 1012, 1013, 1014, 1012,
+        },
+        {
+            1016, 1010, 1017, 1027, 1010, 1028, 1012, 1010, 1011, 1012, 1029, 1010, 1030, 1031, 1032, 1033,
+            1012, 1034, 1010, 1035, 1036, 1037, 1038, 1012, 1039, 1010, 1040, 1012, 1041, 1042, 1043, 1044,
+        },
+        {
+            1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+            1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+        },
+        {
+            1046, 1046, 1046, 1047, 1046, 1046, 1048, 1049, 1050, 1051, 1052, 189, 189, 189, 189, 189,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+            1053, 1054, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            1055, 1056, 1057, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+            1058, 1058, 1059, 1060, 1061, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 1062, 1063, 189, 1064, 1064, 1065, 1066,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 1067, 1068,
+        },
+        {
+            1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1070, 1071, 189, 189,
+            1072, 1072, 1073, 1074, 1075, 1076, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            189, 189, 189, 189, 189, 189, 189, 1077, 1078, 1079, 1080, 1081, 189, 189, 189, 189,
+            1077, 1078, 1082, 1083, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1093, 189, 189, 189, 1095,
+            189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+        },
+        {
+            1096, 387, 1097, 387, 387, 387, 387, 387, 387, 997, 1098, 1099, 1100, 1099, 387, 998,
+            1101, 400, 1102, 402, 1103, 402, 1104, 402, 1105, 1106, 1107, 189, 189, 189, 1108, 387,
+        },
+        {
+            1109, 491, 491, 474, 1110, 1111, 1112, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+            491, 491, 1113, 1114, 491, 491, 491, 1115, 491, 418, 491, 491, 1116, 418, 491, 1117,
+        },
+        {
+            491, 491, 491, 1118, 1119, 491, 491, 491, 491, 491, 491, 491, 491, 491, 491, 1120,
+            491, 491, 491, 1121, 1122, 491, 1123, 1124, 387, 1125, 1096, 387, 387, 387, 387, 1126,
+        },
+        {
+            491, 491, 491, 491, 491, 387, 387, 387, 491, 491, 491, 491, 1127, 1128, 1129, 1130,
+            387, 387, 387, 387, 387, 387, 387, 997, 387, 387, 387, 387, 387, 1131, 474, 1132,
+        },
+        {
+            1097, 387, 387, 387, 1133, 1134, 387, 387, 1133, 387, 1135, 1136, 189, 189, 189, 189,
+            1137, 491, 491, 1138, 1114, 491, 491, 491, 491, 491, 491, 491, 491, 491, 491, 491,
+        },
+        {
+            387, 387, 387, 387, 387, 997, 1135, 1139, 1140, 491, 1141, 1142, 1112, 1143, 1144, 1140,
+            387, 387, 387, 387, 387, 387, 387, 387, 387, 1145, 387, 387, 395, 189, 189, 1146,
+        },
+        {
+            1147, 504, 504, 504, 504, 504, 1148, 504, 504, 504, 504, 504, 504, 504, 1149, 504,
+            504, 504, 1150, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 525, 504, 504, 504, 504, 504, 1151, 1152, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 1153, 1154,
+            504, 1155, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 528, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 515, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 621, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 1156, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 628, 628,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 1157, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 626, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 1158, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 1159, 628,
+        },
+        {
+            628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+            628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 1160, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+        },
+        {
+            504, 626, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+            628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+        },
+        {
+            628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+            628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 1161,
+        },
+        {
+            504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504,
+            504, 504, 504, 504, 1162, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+        },
+        {
+            1163, 1164, 1165, 1165, 1165, 1165, 1165, 1165, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+            642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 1164,
+        },
+        {
+            1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+            1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+        },
+        {
+            620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620,
+            620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 620, 1166,
+        },
+    };
+    static constexpr unsigned short blocks[1167][16] = {
+        {
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 1, 1,
+        },
+        {
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        },
+        {
+            3, 4, 4, 4, 5, 4, 4, 4, 6, 7, 4, 8, 4, 9, 4, 4,
+        },
+        {
+            10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 4, 4, 8, 8, 8, 4,
+        },
+        {
+            4, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        },
+        {
+            20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 6, 4, 7, 21, 22,
+        },
+        {
+            23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+        },
+        {
+            24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 6, 8, 7, 8, 1,
+        },
+        {
+            1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        },
+        {
+            25, 26, 5, 5, 27, 5, 28, 26, 29, 30, 31, 32, 8, 33, 34, 23,
+        },
+        {
+            34, 35, 36, 37, 29, 38, 26, 26, 29, 39, 31, 40, 41, 42, 43, 26,
+        },
+        {
+            44, 44, 44, 44, 44, 44, 45, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+        },
+        {
+            45, 44, 44, 44, 44, 44, 44, 35, 45, 44, 44, 44, 44, 44, 45, 46,
+        },
+        {
+            46, 46, 47, 47, 47, 47, 46, 47, 46, 46, 46, 47, 46, 46, 47, 47,
+        },
+        {
+            46, 47, 46, 46, 47, 47, 47, 35, 46, 46, 46, 47, 46, 47, 46, 47,
+        },
+        {
+            44, 46, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47,
+        },
+        {
+            44, 46, 44, 46, 44, 47, 44, 47, 44, 47, 44, 46, 44, 47, 44, 47,
+        },
+        {
+            44, 47, 44, 47, 44, 47, 45, 46, 44, 47, 44, 46, 44, 47, 44, 47,
+        },
+        {
+            44, 46, 45, 46, 44, 47, 44, 47, 46, 44, 47, 44, 47, 44, 47, 45,
+        },
+        {
+            46, 45, 46, 44, 46, 44, 47, 44, 46, 46, 45, 46, 44, 46, 44, 47,
+        },
+        {
+            44, 47, 45, 46, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47,
+        },
+        {
+            44, 47, 44, 47, 44, 47, 44, 47, 44, 44, 47, 44, 47, 44, 47, 47,
+        },
+        {
+            47, 44, 44, 47, 44, 47, 44, 44, 47, 44, 44, 44, 47, 47, 44, 44,
+        },
+        {
+            44, 44, 47, 44, 44, 47, 44, 44, 44, 47, 47, 47, 44, 44, 47, 44,
+        },
+        {
+            44, 47, 44, 47, 44, 47, 44, 44, 47, 44, 47, 47, 44, 47, 44, 44,
+        },
+        {
+            47, 44, 44, 44, 47, 44, 47, 44, 44, 47, 47, 48, 44, 47, 47, 47,
+        },
+        {
+            48, 48, 48, 48, 44, 49, 47, 44, 49, 47, 44, 49, 47, 44, 46, 44,
+        },
+        {
+            46, 44, 46, 44, 46, 44, 46, 44, 46, 44, 46, 44, 46, 47, 44, 47,
+        },
+        {
+            44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47,
+        },
+        {
+            47, 44, 49, 47, 44, 47, 44, 44, 44, 47, 44, 47, 44, 47, 44, 47,
+        },
+        {
+            44, 47, 44, 47, 47, 47, 47, 47, 47, 47, 44, 44, 47, 44, 44, 47,
+        },
+        {
+            47, 44, 47, 44, 44, 44, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47,
+        },
+        {
+            47, 46, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+        },
+        {
+            47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+        },
+        {
+            47, 47, 47, 47, 48, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+        },
+        {
+            50, 50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51,
+        },
+        {
+            52, 52, 53, 53, 29, 53, 51, 54, 51, 54, 54, 54, 51, 54, 51, 51,
+        },
+        {
+            54, 51, 53, 53, 53, 53, 53, 53, 29, 29, 29, 29, 53, 29, 53, 29,
+        },
+        {
+            50, 50, 50, 50, 50, 53, 53, 53, 53, 53, 55, 55, 51, 53, 51, 53,
+        },
+        {
+            53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+        },
+        {
+            56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+        },
+        {
+            56, 56, 56, 56, 56, 57, 56, 56, 56, 56, 56, 56, 56, 56, 56, 58,
+        },
+        {
+            59, 60, 59, 60, 51, 61, 59, 60, 0, 0, 62, 60, 60, 60, 63, 59,
+        },
+        {
+            0, 0, 0, 0, 61, 53, 59, 63, 59, 59, 59, 0, 59, 0, 59, 59,
+        },
+        {
+            60, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+        },
+        {
+            64, 64, 0, 64, 64, 64, 64, 64, 64, 64, 59, 59, 60, 60, 60, 60,
+        },
+        {
+            60, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+        },
+        {
+            65, 65, 60, 65, 65, 65, 65, 65, 65, 65, 60, 60, 60, 60, 60, 59,
+        },
+        {
+            66, 66, 67, 59, 59, 66, 60, 60, 59, 60, 59, 60, 59, 60, 59, 60,
+        },
+        {
+            59, 60, 68, 69, 68, 69, 68, 69, 68, 69, 68, 69, 68, 69, 68, 69,
+        },
+        {
+            66, 66, 60, 60, 67, 66, 70, 59, 60, 59, 59, 60, 60, 59, 59, 59,
+        },
+        {
+            71, 72, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+        },
+        {
+            72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+        },
+        {
+            73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        },
+        {
+            74, 73, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        },
+        {
+            71, 74, 71, 74, 71, 74, 71, 74, 71, 74, 71, 74, 71, 74, 71, 74,
+        },
+        {
+            71, 74, 75, 76, 76, 77, 77, 76, 78, 78, 71, 74, 71, 74, 71, 74,
+        },
+        {
+            71, 71, 74, 71, 74, 71, 74, 71, 74, 71, 74, 71, 74, 71, 74, 74,
+        },
+        {
+            0, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        },
+        {
+            79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        },
+        {
+            79, 79, 79, 79, 79, 79, 79, 0, 0, 80, 81, 81, 81, 81, 81, 81,
+        },
+        {
+            82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+        },
+        {
+            82, 82, 82, 82, 82, 82, 82, 82, 82, 81, 83, 0, 0, 84, 84, 85,
+        },
+        {
+            0, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+        },
+        {
+            86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+        },
+        {
+            87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 87,
+        },
+        {
+            89, 87, 87, 89, 87, 87, 89, 87, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+        },
+        {
+            90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 0, 0, 0, 0, 90,
+        },
+        {
+            90, 90, 90, 89, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            91, 91, 91, 91, 91, 92, 93, 93, 93, 94, 94, 95, 63, 94, 96, 96,
+        },
+        {
+            97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 63, 98, 94, 94, 63,
+        },
+        {
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        },
+        {
+            51, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 100, 100, 100, 100, 100,
+        },
+        {
+            100, 100, 100, 100, 100, 100, 97, 97, 101, 97, 97, 97, 97, 97, 97, 97,
+        },
+        {
+            102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 94, 94, 94, 94, 99, 99,
+        },
+        {
+            100, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        },
+        {
+            99, 99, 99, 99, 94, 99, 97, 97, 97, 97, 97, 97, 97, 92, 96, 101,
+        },
+        {
+            101, 97, 97, 97, 97, 112, 112, 97, 97, 96, 101, 101, 101, 97, 99, 99,
+        },
+        {
+            102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 99, 99, 99, 96, 96, 99,
+        },
+        {
+            113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 0, 114,
+        },
+        {
+            115, 116, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+        },
+        {
+            115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+        },
+        {
+            116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+        },
+        {
+            117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 0, 0, 115, 115, 115,
+        },
+        {
+            118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+        },
+        {
+            118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+        },
+        {
+            119, 118, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 130, 130, 130, 130, 130,
+        },
+        {
+            130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+        },
+        {
+            130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131,
+        },
+        {
+            131, 131, 131, 131, 132, 132, 133, 134, 134, 134, 132, 0, 0, 131, 135, 135,
+        },
+        {
+            136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+        },
+        {
+            136, 136, 136, 136, 136, 136, 137, 137, 138, 138, 139, 137, 137, 137, 137, 137,
+        },
+        {
+            137, 137, 137, 137, 139, 137, 137, 137, 139, 137, 137, 137, 137, 138, 0, 0,
+        },
+        {
+            140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 0,
+        },
+        {
+            141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+        },
+        {
+            141, 141, 141, 141, 141, 141, 141, 141, 141, 142, 142, 142, 0, 0, 143, 0,
+        },
+        {
+            115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 0, 0, 0, 0,
+        },
+        {
+            99, 99, 99, 99, 99, 99, 99, 99, 144, 99, 99, 99, 99, 99, 99, 0,
+        },
+        {
+            91, 91, 0, 0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101,
+        },
+        {
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 112, 101, 101, 101, 101, 101, 101,
+        },
+        {
+            101, 101, 101, 101, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+        },
+        {
+            101, 101, 92, 97, 97, 97, 97, 97, 97, 97, 101, 101, 101, 101, 101, 101,
+        },
+        {
+            97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+        },
+        {
+            145, 145, 145, 146, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+        },
+        {
+            147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+        },
+        {
+            147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 145, 146, 148, 147, 146, 146,
+        },
+        {
+            146, 145, 145, 145, 145, 145, 145, 145, 145, 146, 146, 146, 146, 148, 146, 146,
+        },
+        {
+            147, 77, 77, 77, 77, 145, 145, 145, 147, 147, 147, 147, 147, 147, 147, 147,
+        },
+        {
+            147, 147, 145, 145, 63, 63, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+        },
+        {
+            159, 160, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+        },
+        {
+            161, 162, 163, 163, 0, 161, 161, 161, 161, 161, 161, 161, 161, 0, 0, 161,
+        },
+        {
+            161, 0, 0, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+        },
+        {
+            161, 161, 161, 161, 161, 161, 161, 161, 161, 0, 161, 161, 161, 161, 161, 161,
+        },
+        {
+            161, 0, 161, 0, 0, 0, 161, 161, 161, 161, 0, 0, 164, 161, 163, 163,
+        },
+        {
+            163, 162, 162, 162, 162, 0, 0, 163, 163, 0, 0, 163, 163, 164, 161, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 163, 0, 0, 0, 0, 161, 161, 0, 161,
+        },
+        {
+            161, 161, 162, 162, 0, 0, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+        },
+        {
+            161, 161, 175, 175, 176, 177, 178, 179, 180, 181, 182, 175, 161, 183, 164, 0,
+        },
+        {
+            0, 184, 184, 185, 0, 186, 186, 186, 186, 186, 186, 0, 0, 0, 0, 186,
+        },
+        {
+            186, 0, 0, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+        },
+        {
+            186, 186, 186, 186, 186, 186, 186, 186, 186, 0, 186, 186, 186, 186, 186, 186,
+        },
+        {
+            186, 0, 186, 186, 0, 186, 186, 0, 186, 186, 0, 0, 187, 0, 185, 185,
+        },
+        {
+            185, 184, 184, 0, 0, 0, 0, 184, 184, 0, 0, 184, 184, 187, 0, 0,
+        },
+        {
+            0, 184, 0, 0, 0, 0, 0, 0, 0, 186, 186, 186, 186, 0, 186, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197,
+        },
+        {
+            184, 184, 186, 186, 186, 184, 198, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 199, 199, 200, 0, 201, 201, 201, 201, 201, 201, 201, 201, 201, 0, 201,
+        },
+        {
+            201, 201, 0, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+        },
+        {
+            201, 201, 201, 201, 201, 201, 201, 201, 201, 0, 201, 201, 201, 201, 201, 201,
+        },
+        {
+            201, 0, 201, 201, 0, 201, 201, 201, 201, 201, 0, 0, 202, 201, 200, 200,
+        },
+        {
+            200, 199, 199, 199, 199, 199, 0, 199, 199, 200, 0, 200, 200, 202, 0, 0,
+        },
+        {
+            201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            201, 201, 199, 199, 0, 0, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+        },
+        {
+            213, 214, 0, 0, 0, 0, 0, 0, 0, 201, 199, 199, 199, 202, 202, 202,
+        },
+        {
+            0, 215, 216, 216, 0, 217, 217, 217, 217, 217, 217, 217, 217, 0, 0, 217,
+        },
+        {
+            217, 0, 0, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+        },
+        {
+            217, 217, 217, 217, 217, 217, 217, 217, 217, 0, 217, 217, 217, 217, 217, 217,
+        },
+        {
+            217, 0, 217, 217, 0, 217, 217, 217, 217, 217, 0, 0, 218, 217, 216, 215,
+        },
+        {
+            216, 215, 215, 215, 215, 0, 0, 216, 216, 0, 0, 216, 216, 218, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 218, 215, 216, 0, 0, 0, 0, 217, 217, 0, 217,
+        },
+        {
+            217, 217, 215, 215, 0, 0, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+        },
+        {
+            229, 217, 230, 231, 232, 233, 234, 235, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 236, 237, 0, 237, 237, 237, 237, 237, 237, 0, 0, 0, 237, 237,
+        },
+        {
+            237, 0, 237, 237, 237, 237, 0, 0, 0, 237, 237, 0, 237, 0, 237, 237,
+        },
+        {
+            0, 0, 0, 237, 237, 0, 0, 0, 237, 237, 237, 0, 0, 0, 237, 237,
+        },
+        {
+            237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 0, 0, 0, 0, 238, 238,
+        },
+        {
+            236, 238, 238, 0, 0, 0, 238, 238, 238, 0, 238, 238, 238, 239, 0, 0,
+        },
+        {
+            237, 0, 0, 0, 0, 0, 0, 238, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249,
+        },
+        {
+            250, 251, 252, 253, 253, 253, 253, 253, 253, 254, 253, 0, 0, 0, 0, 0,
+        },
+        {
+            255, 256, 256, 256, 257, 258, 258, 258, 258, 258, 258, 258, 258, 0, 258, 258,
+        },
+        {
+            258, 0, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+        },
+        {
+            258, 258, 258, 258, 258, 258, 258, 258, 258, 0, 258, 258, 258, 258, 258, 258,
+        },
+        {
+            258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 0, 0, 257, 258, 255, 255,
+        },
+        {
+            255, 256, 256, 256, 256, 0, 255, 255, 255, 0, 255, 255, 255, 257, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 255, 255, 0, 258, 258, 258, 0, 0, 258, 0, 0,
+        },
+        {
+            258, 258, 255, 255, 0, 0, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 269, 270, 271, 272, 273, 271, 272, 273, 274,
+        },
+        {
+            275, 276, 277, 277, 278, 275, 275, 275, 275, 275, 275, 275, 275, 0, 275, 275,
+        },
+        {
+            275, 0, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+        },
+        {
+            275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 275, 275, 275, 275, 275, 275,
+        },
+        {
+            275, 275, 275, 275, 0, 275, 275, 275, 275, 275, 0, 0, 279, 275, 277, 276,
+        },
+        {
+            277, 277, 277, 277, 277, 0, 276, 277, 277, 0, 277, 277, 276, 279, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 277, 277, 0, 0, 0, 0, 0, 0, 275, 275, 0,
+        },
+        {
+            275, 275, 276, 276, 0, 0, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+        },
+        {
+            0, 275, 275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            290, 290, 291, 291, 292, 292, 292, 292, 292, 292, 292, 292, 292, 0, 292, 292,
+        },
+        {
+            292, 0, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292,
+        },
+        {
+            292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292,
+        },
+        {
+            292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 293, 293, 292, 291, 291,
+        },
+        {
+            291, 290, 290, 290, 290, 0, 291, 291, 291, 0, 291, 291, 291, 293, 292, 294,
+        },
+        {
+            0, 0, 0, 0, 292, 292, 292, 291, 295, 296, 297, 298, 299, 300, 301, 292,
+        },
+        {
+            292, 292, 290, 290, 0, 0, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311,
+        },
+        {
+            312, 313, 314, 315, 316, 317, 318, 319, 320, 294, 292, 292, 292, 292, 292, 292,
+        },
+        {
+            0, 321, 322, 322, 0, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323,
+        },
+        {
+            323, 323, 323, 323, 323, 323, 323, 0, 0, 0, 323, 323, 323, 323, 323, 323,
+        },
+        {
+            323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323,
+        },
+        {
+            323, 323, 0, 323, 323, 323, 323, 323, 323, 323, 323, 323, 0, 323, 0, 0,
+        },
+        {
+            323, 323, 323, 323, 323, 323, 323, 0, 0, 0, 324, 0, 0, 0, 0, 322,
+        },
+        {
+            322, 322, 321, 321, 321, 0, 321, 0, 322, 322, 322, 322, 322, 322, 322, 322,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334,
+        },
+        {
+            0, 0, 322, 322, 335, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336,
+        },
+        {
+            336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336,
+        },
+        {
+            336, 337, 336, 336, 337, 337, 337, 337, 337, 337, 337, 0, 0, 0, 0, 338,
+        },
+        {
+            336, 336, 336, 336, 336, 336, 339, 340, 340, 340, 340, 340, 340, 337, 340, 341,
+        },
+        {
+            342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 341, 341, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 352, 352, 0, 352, 0, 352, 352, 352, 352, 352, 0, 352, 352, 352, 352,
+        },
+        {
+            352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+        },
+        {
+            352, 352, 352, 352, 0, 352, 0, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+        },
+        {
+            352, 353, 352, 352, 353, 353, 353, 353, 353, 353, 354, 353, 353, 352, 0, 0,
+        },
+        {
+            352, 352, 352, 352, 352, 0, 355, 0, 354, 354, 354, 354, 354, 353, 0, 0,
+        },
+        {
+            356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 0, 0, 352, 352, 352, 352,
+        },
+        {
+            366, 367, 367, 367, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368,
+        },
+        {
+            368, 368, 368, 367, 368, 367, 367, 367, 369, 369, 367, 367, 367, 367, 367, 367,
+        },
+        {
+            370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+        },
+        {
+            386, 387, 388, 389, 367, 369, 367, 369, 367, 369, 390, 391, 390, 391, 392, 392,
+        },
+        {
+            366, 366, 366, 366, 366, 366, 366, 366, 0, 366, 366, 366, 366, 366, 366, 366,
+        },
+        {
+            366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366,
+        },
+        {
+            366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 0, 0, 0,
+        },
+        {
+            0, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 394,
+        },
+        {
+            393, 393, 369, 369, 369, 368, 369, 369, 366, 366, 366, 366, 366, 393, 393, 393,
+        },
+        {
+            393, 393, 393, 393, 393, 393, 393, 393, 0, 393, 393, 393, 393, 393, 393, 393,
+        },
+        {
+            393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393,
+        },
+        {
+            393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 0, 367, 367,
+        },
+        {
+            367, 367, 367, 367, 367, 367, 369, 367, 367, 367, 367, 367, 367, 0, 367, 367,
+        },
+        {
+            368, 368, 368, 368, 368, 30, 30, 30, 30, 368, 368, 0, 0, 0, 0, 0,
+        },
+        {
+            395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+        },
+        {
+            395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 396, 396, 397, 397, 397,
+        },
+        {
+            397, 396, 397, 397, 397, 397, 397, 398, 396, 398, 398, 396, 396, 397, 397, 395,
+        },
+        {
+            399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 409, 409, 409, 409, 409,
+        },
+        {
+            395, 395, 395, 395, 395, 395, 396, 396, 397, 397, 395, 395, 395, 395, 397, 397,
+        },
+        {
+            397, 395, 396, 396, 396, 395, 395, 396, 396, 396, 396, 396, 396, 396, 395, 395,
+        },
+        {
+            395, 397, 397, 397, 397, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+        },
+        {
+            395, 395, 397, 396, 396, 397, 397, 396, 396, 396, 396, 396, 396, 397, 395, 396,
+        },
+        {
+            399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 396, 396, 396, 397, 410, 410,
+        },
+        {
+            411, 411, 411, 411, 411, 411, 411, 411, 411, 411, 411, 411, 411, 411, 411, 411,
+        },
+        {
+            411, 411, 411, 411, 411, 411, 0, 411, 0, 0, 0, 0, 0, 411, 0, 0,
+        },
+        {
+            412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+        },
+        {
+            412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 63, 413, 412, 412, 412,
+        },
+        {
+            414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+        },
+        {
+            414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 415,
+        },
+        {
+            416, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417,
+        },
+        {
+            417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417,
+        },
+        {
+            418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+        },
+        {
+            418, 418, 418, 418, 418, 418, 418, 418, 418, 0, 418, 418, 418, 418, 0, 0,
+        },
+        {
+            418, 418, 418, 418, 418, 418, 418, 0, 418, 0, 418, 418, 418, 418, 0, 0,
+        },
+        {
+            418, 0, 418, 418, 418, 418, 0, 0, 418, 418, 418, 418, 418, 418, 418, 0,
+        },
+        {
+            418, 0, 418, 418, 418, 418, 0, 0, 418, 418, 418, 418, 418, 418, 418, 418,
+        },
+        {
+            418, 418, 418, 418, 418, 418, 418, 0, 418, 418, 418, 418, 418, 418, 418, 418,
+        },
+        {
+            418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 0, 0, 419, 419, 419,
+        },
+        {
+            420, 420, 420, 420, 420, 420, 420, 420, 420, 421, 422, 423, 424, 425, 426, 427,
+        },
+        {
+            428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 0, 0, 0,
+        },
+        {
+            441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442,
+        },
+        {
+            442, 442, 442, 442, 442, 442, 0, 0, 443, 443, 443, 443, 443, 443, 0, 0,
+        },
+        {
+            444, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445,
+        },
+        {
+            445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445,
+        },
+        {
+            445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 446, 447, 445,
+        },
+        {
+            448, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449,
+        },
+        {
+            449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 450, 451, 0, 0, 0,
+        },
+        {
+            452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452,
+        },
+        {
+            452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 63, 63, 63, 453, 454,
+        },
+        {
+            455, 452, 452, 452, 452, 452, 452, 452, 452, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+        },
+        {
+            456, 456, 457, 457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456,
+        },
+        {
+            460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460,
+        },
+        {
+            460, 460, 461, 461, 462, 63, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463,
+        },
+        {
+            463, 463, 464, 464, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 0, 465, 465,
+        },
+        {
+            465, 0, 466, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467,
+        },
+        {
+            467, 467, 467, 467, 468, 468, 469, 470, 470, 470, 470, 470, 470, 470, 469, 469,
+        },
+        {
+            469, 469, 469, 469, 469, 469, 470, 469, 469, 471, 471, 471, 471, 471, 471, 471,
+        },
+        {
+            471, 471, 471, 471, 472, 472, 472, 473, 472, 472, 472, 474, 467, 471, 0, 0,
+        },
+        {
+            475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            495, 495, 63, 63, 495, 63, 496, 495, 495, 495, 495, 497, 497, 497, 498, 497,
+        },
+        {
+            499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509,
+        },
+        {
+            509, 509, 509, 510, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509,
+        },
+        {
+            509, 509, 509, 509, 509, 509, 509, 509, 509, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            509, 509, 509, 509, 509, 511, 511, 509, 509, 509, 509, 509, 509, 509, 509, 509,
+        },
+        {
+            509, 509, 509, 509, 509, 509, 509, 509, 509, 511, 509, 0, 0, 0, 0, 0,
+        },
+        {
+            445, 445, 445, 445, 445, 445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512,
+        },
+        {
+            512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 0,
+        },
+        {
+            513, 513, 513, 514, 514, 514, 514, 513, 513, 514, 514, 514, 0, 0, 0, 0,
+        },
+        {
+            514, 514, 513, 514, 514, 514, 514, 514, 514, 515, 515, 515, 0, 0, 0, 0,
+        },
+        {
+            516, 0, 0, 0, 517, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+        },
+        {
+            528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528,
+        },
+        {
+            528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 0, 0,
+        },
+        {
+            528, 528, 528, 528, 528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529,
+        },
+        {
+            529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 0, 0, 0, 0,
+        },
+        {
+            529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 0, 0, 0, 541, 541,
+        },
+        {
+            542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+        },
+        {
+            543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543,
+        },
+        {
+            543, 543, 543, 543, 543, 543, 543, 544, 544, 545, 545, 544, 0, 0, 546, 546,
+        },
+        {
+            547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+        },
+        {
+            547, 547, 547, 547, 547, 548, 549, 548, 549, 549, 549, 549, 549, 549, 549, 0,
+        },
+        {
+            550, 548, 549, 548, 548, 549, 549, 549, 549, 549, 549, 549, 549, 548, 548, 548,
+        },
+        {
+            548, 548, 548, 549, 549, 550, 550, 550, 550, 550, 550, 550, 550, 0, 0, 550,
+        },
+        {
+            551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            561, 561, 561, 561, 561, 561, 561, 562, 561, 561, 561, 561, 561, 561, 0, 0,
+        },
+        {
+            77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 563, 100,
+        },
+        {
+            100, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 100, 100, 100, 0,
+        },
+        {
+            564, 564, 564, 564, 565, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566,
+        },
+        {
+            566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566,
+        },
+        {
+            566, 566, 566, 566, 567, 565, 564, 564, 564, 564, 564, 565, 564, 565, 565, 565,
+        },
+        {
+            565, 565, 564, 565, 568, 566, 566, 566, 566, 566, 566, 566, 566, 0, 0, 0,
+        },
+        {
+            569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 579, 579, 579, 579, 579,
+        },
+        {
+            579, 580, 580, 580, 580, 580, 580, 580, 580, 580, 580, 567, 567, 567, 567, 567,
+        },
+        {
+            567, 567, 567, 567, 580, 580, 580, 580, 580, 580, 580, 580, 580, 579, 579, 0,
+        },
+        {
+            581, 581, 582, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+        },
+        {
+            583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+        },
+        {
+            583, 582, 581, 581, 581, 581, 582, 582, 581, 581, 584, 585, 581, 581, 583, 583,
+        },
+        {
+            586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 583, 583, 583, 583, 583, 583,
+        },
+        {
+            596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596, 596,
+        },
+        {
+            596, 596, 596, 596, 596, 596, 597, 598, 599, 599, 598, 598, 598, 599, 598, 599,
+        },
+        {
+            599, 599, 600, 600, 0, 0, 0, 0, 0, 0, 0, 0, 601, 601, 601, 601,
+        },
+        {
+            602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+        },
+        {
+            602, 602, 602, 602, 603, 603, 603, 603, 603, 603, 603, 603, 604, 604, 604, 604,
+        },
+        {
+            604, 604, 604, 604, 603, 603, 604, 605, 0, 0, 0, 606, 606, 606, 606, 606,
+        },
+        {
+            607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 0, 0, 0, 602, 602, 602,
+        },
+        {
+            617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 627, 627, 627, 627, 627,
+        },
+        {
+            627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 627,
+        },
+        {
+            627, 627, 627, 627, 627, 627, 627, 627, 628, 628, 628, 628, 628, 628, 629, 629,
+        },
+        {
+            74, 74, 74, 74, 74, 74, 74, 74, 74, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            411, 411, 411, 411, 411, 411, 411, 411, 411, 411, 411, 0, 0, 411, 411, 411,
+        },
+        {
+            630, 630, 630, 630, 630, 630, 630, 630, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            77, 77, 77, 63, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+        },
+        {
+            77, 631, 77, 77, 77, 77, 77, 77, 77, 632, 632, 632, 632, 77, 632, 632,
+        },
+        {
+            632, 632, 632, 632, 77, 632, 632, 631, 77, 77, 632, 0, 0, 0, 0, 0,
+        },
+        {
+            47, 47, 47, 47, 47, 47, 60, 60, 60, 60, 60, 74, 50, 50, 50, 50,
+        },
+        {
+            50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        },
+        {
+            50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 62, 62, 62,
+        },
+        {
+            62, 62, 50, 50, 50, 50, 62, 62, 62, 62, 62, 47, 47, 47, 47, 47,
+        },
+        {
+            47, 47, 47, 47, 47, 47, 47, 47, 633, 47, 47, 47, 47, 47, 47, 47,
+        },
+        {
+            47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 50, 50, 50, 50, 50,
+        },
+        {
+            50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 62,
+        },
+        {
+            77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+        },
+        {
+            77, 77, 77, 77, 77, 77, 77, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        },
+        {
+            100, 100, 100, 100, 100, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+        },
+        {
+            44, 47, 44, 47, 44, 47, 47, 47, 47, 47, 47, 47, 47, 47, 44, 47,
+        },
+        {
+            60, 60, 60, 60, 60, 60, 60, 60, 59, 59, 59, 59, 59, 59, 59, 59,
+        },
+        {
+            60, 60, 60, 60, 60, 60, 0, 0, 59, 59, 59, 59, 59, 59, 0, 0,
+        },
+        {
+            60, 60, 60, 60, 60, 60, 60, 60, 0, 59, 0, 59, 0, 59, 0, 59,
+        },
+        {
+            60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 0, 0,
+        },
+        {
+            60, 60, 60, 60, 60, 60, 60, 60, 634, 634, 634, 634, 634, 634, 634, 634,
+        },
+        {
+            60, 60, 60, 60, 60, 0, 60, 60, 59, 59, 59, 59, 634, 61, 60, 61,
+        },
+        {
+            61, 61, 60, 60, 60, 0, 60, 60, 59, 59, 59, 59, 634, 61, 61, 61,
+        },
+        {
+            60, 60, 60, 60, 0, 0, 60, 60, 59, 59, 59, 59, 0, 61, 61, 61,
+        },
+        {
+            60, 60, 60, 60, 60, 60, 60, 60, 59, 59, 59, 59, 59, 61, 61, 61,
+        },
+        {
+            0, 0, 60, 60, 60, 0, 60, 60, 59, 59, 59, 59, 634, 61, 61, 0,
+        },
+        {
+            25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 635, 636, 636, 635, 635,
+        },
+        {
+            637, 638, 638, 637, 637, 637, 639, 63, 640, 641, 642, 32, 640, 641, 642, 32,
+        },
+        {
+            26, 26, 26, 63, 26, 26, 26, 26, 643, 644, 635, 635, 635, 635, 635, 25,
+        },
+        {
+            26, 63, 639, 639, 645, 26, 63, 63, 63, 32, 40, 26, 63, 63, 26, 646,
+        },
+        {
+            647, 63, 63, 63, 648, 642, 649, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+        },
+        {
+            63, 63, 648, 63, 646, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 25,
+        },
+        {
+            635, 650, 650, 650, 650, 651, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635,
+        },
+        {
+            652, 50, 0, 0, 653, 654, 655, 656, 657, 658, 648, 648, 648, 659, 660, 661,
+        },
+        {
+            652, 39, 36, 37, 653, 654, 655, 656, 657, 658, 648, 648, 648, 659, 660, 0,
+        },
+        {
+            50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0,
+        },
+        {
+            338, 338, 338, 338, 338, 338, 338, 338, 338, 662, 338, 338, 27, 338, 338, 338,
+        },
+        {
+            338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+        },
+        {
+            338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            663, 663, 663, 663, 663, 663, 663, 663, 663, 663, 663, 663, 663, 563, 563, 563,
+        },
+        {
+            563, 663, 563, 563, 563, 663, 663, 77, 77, 77, 77, 663, 663, 663, 663, 663,
+        },
+        {
+            77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 664, 34, 30, 34, 30, 664, 30, 34, 665, 664, 664, 664, 665, 665,
+        },
+        {
+            664, 664, 664, 666, 30, 664, 34, 30, 648, 664, 664, 664, 664, 664, 30, 30,
+        },
+        {
+            30, 34, 34, 30, 664, 30, 64, 30, 664, 667, 44, 45, 664, 664, 30, 665,
+        },
+        {
+            664, 664, 44, 664, 665, 668, 668, 668, 668, 38, 30, 30, 665, 665, 664, 664,
+        },
+        {
+            648, 648, 648, 648, 648, 664, 665, 665, 665, 665, 30, 648, 30, 30, 47, 30,
+        },
+        {
+            669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684,
+        },
+        {
+            685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700,
+        },
+        {
+            701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716,
+        },
+        {
+            717, 718, 719, 44, 47, 720, 721, 722, 723, 724, 30, 30, 0, 0, 0, 0,
+        },
+        {
+            35, 35, 35, 35, 35, 725, 725, 725, 725, 725, 648, 648, 667, 667, 667, 667,
+        },
+        {
+            648, 667, 667, 648, 667, 667, 648, 667, 30, 667, 667, 667, 667, 667, 648, 30,
+        },
+        {
+            667, 667, 30, 30, 30, 30, 667, 667, 34, 34, 30, 30, 667, 667, 667, 667,
+        },
+        {
+            667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 648, 648,
+        },
+        {
+            667, 667, 35, 667, 35, 667, 667, 667, 667, 667, 667, 667, 30, 667, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 667, 667, 30, 34, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+        },
+        {
+            35, 648, 35, 35, 648, 648, 648, 35, 35, 648, 648, 35, 648, 648, 648, 35,
+        },
+        {
+            648, 35, 648, 648, 648, 35, 648, 648, 648, 648, 35, 648, 648, 35, 35, 35,
+        },
+        {
+            35, 648, 648, 35, 648, 35, 648, 35, 35, 35, 35, 35, 35, 648, 35, 648,
+        },
+        {
+            648, 648, 648, 648, 35, 35, 35, 35, 648, 648, 648, 648, 35, 35, 648, 648,
+        },
+        {
+            648, 648, 648, 648, 648, 648, 648, 648, 35, 648, 648, 648, 35, 648, 648, 648,
+        },
+        {
+            648, 648, 35, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+        },
+        {
+            35, 35, 648, 648, 35, 35, 35, 35, 648, 648, 35, 35, 648, 648, 35, 35,
+        },
+        {
+            648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+        },
+        {
+            648, 648, 35, 35, 648, 648, 35, 35, 648, 648, 648, 648, 648, 648, 648, 648,
+        },
+        {
+            648, 648, 648, 648, 648, 35, 648, 648, 648, 35, 648, 648, 648, 648, 648, 648,
+        },
+        {
+            648, 648, 648, 648, 648, 35, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+        },
+        {
+            648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 35,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 659, 660, 659, 660, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 34, 30, 30, 30, 30, 30, 30, 30, 726, 726, 30, 30, 30, 30,
+        },
+        {
+            648, 648, 30, 30, 30, 30, 30, 30, 30, 727, 728, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 648, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 648, 648, 648, 648, 648,
+        },
+        {
+            648, 648, 648, 648, 667, 667, 30, 667, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            667, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 648, 648, 648, 648,
+        },
+        {
+            648, 648, 667, 30, 30, 30, 30, 30, 30, 726, 726, 726, 726, 30, 30, 30,
+        },
+        {
+            726, 30, 30, 726, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 0, 0, 0, 0, 0,
+        },
+        {
+            39, 36, 37, 653, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740,
+        },
+        {
+            741, 742, 743, 744, 39, 36, 37, 653, 729, 730, 731, 732, 733, 734, 735, 736,
+        },
+        {
+            737, 738, 739, 740, 741, 742, 743, 744, 39, 36, 37, 653, 729, 730, 731, 732,
+        },
+        {
+            733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 34, 34, 34, 34,
+        },
+        {
+            34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        },
+        {
+            34, 34, 34, 34, 34, 34, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745,
+        },
+        {
+            745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 745,
+        },
+        {
+            746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746,
+        },
+        {
+            746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 652, 735, 736, 737, 738, 739,
+        },
+        {
+            740, 741, 742, 743, 744, 39, 36, 37, 653, 729, 730, 731, 732, 733, 734, 724,
+        },
+        {
+            34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 30, 30, 30, 30,
+        },
+        {
+            34, 34, 34, 34, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 34, 34, 34, 34, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            725, 725, 30, 34, 34, 34, 34, 34, 34, 34, 30, 30, 30, 30, 667, 667,
+        },
+        {
+            667, 667, 725, 725, 667, 667, 725, 35, 30, 30, 30, 30, 725, 725, 667, 667,
+        },
+        {
+            725, 35, 30, 30, 30, 30, 725, 725, 34, 30, 667, 725, 30, 30, 34, 725,
+        },
+        {
+            725, 725, 667, 667, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 725, 34, 725, 34, 30, 667, 667, 667, 667, 667, 667, 30, 30, 34,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 648, 648, 648, 648, 648, 747, 747, 648,
+        },
+        {
+            30, 30, 30, 30, 30, 725, 725, 30, 30, 34, 30, 30, 30, 30, 34, 34,
+        },
+        {
+            30, 30, 30, 30, 726, 726, 30, 30, 30, 30, 30, 30, 34, 30, 34, 30,
+        },
+        {
+            725, 30, 725, 30, 30, 30, 30, 30, 726, 726, 726, 726, 726, 726, 726, 726,
+        },
+        {
+            726, 726, 726, 726, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            725, 725, 667, 725, 34, 34, 30, 34, 34, 34, 34, 30, 34, 725, 667, 35,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726,
+        },
+        {
+            30, 30, 30, 726, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 34, 34,
+        },
+        {
+            30, 726, 30, 30, 30, 30, 30, 30, 30, 30, 726, 726, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726, 726, 34,
+        },
+        {
+            30, 30, 30, 30, 726, 726, 34, 34, 34, 34, 34, 34, 34, 34, 726, 34,
+        },
+        {
+            34, 34, 34, 34, 726, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        },
+        {
+            34, 34, 30, 34, 30, 30, 30, 30, 34, 34, 726, 34, 34, 34, 34, 34,
+        },
+        {
+            34, 34, 726, 726, 34, 726, 34, 34, 34, 34, 726, 34, 34, 726, 34, 34,
+        },
+        {
+            30, 30, 30, 30, 30, 726, 30, 30, 30, 30, 726, 726, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 726, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 34, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726, 30, 726, 30,
+        },
+        {
+            30, 30, 30, 726, 726, 726, 30, 726, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 642, 649, 642, 649, 642, 649, 642, 649,
+        },
+        {
+            642, 649, 642, 649, 642, 649, 39, 36, 37, 653, 729, 730, 731, 732, 733, 734,
+        },
+        {
+            684, 748, 749, 750, 654, 655, 656, 657, 658, 751, 684, 748, 749, 750, 654, 655,
+        },
+        {
+            656, 657, 658, 751, 30, 726, 726, 726, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            726, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726,
+        },
+        {
+            648, 648, 648, 648, 648, 659, 660, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+        },
+        {
+            648, 648, 648, 648, 648, 648, 752, 753, 752, 753, 752, 753, 752, 753, 659, 660,
+        },
+        {
+            754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754,
+        },
+        {
+            648, 648, 648, 659, 660, 752, 753, 659, 660, 659, 660, 659, 660, 659, 660, 659,
+        },
+        {
+            660, 659, 660, 659, 660, 659, 660, 659, 660, 648, 648, 648, 648, 648, 648, 648,
+        },
+        {
+            648, 648, 648, 648, 648, 648, 648, 648, 659, 660, 659, 660, 648, 648, 648, 648,
+        },
+        {
+            648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 659, 660, 648, 648,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726, 726, 30, 30, 30,
+        },
+        {
+            648, 648, 648, 648, 648, 30, 30, 648, 648, 648, 648, 648, 648, 30, 30, 30,
+        },
+        {
+            726, 30, 30, 30, 30, 726, 34, 34, 34, 34, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 0, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755,
+        },
+        {
+            756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756,
+        },
+        {
+            44, 47, 44, 44, 44, 47, 47, 44, 47, 44, 47, 44, 47, 44, 44, 44,
+        },
+        {
+            44, 47, 44, 47, 47, 44, 47, 47, 47, 47, 47, 47, 50, 50, 44, 44,
+        },
+        {
+            68, 69, 68, 69, 68, 69, 68, 69, 68, 69, 68, 69, 68, 69, 68, 69,
+        },
+        {
+            68, 69, 68, 69, 69, 757, 757, 757, 757, 757, 757, 68, 69, 68, 69, 758,
+        },
+        {
+            758, 758, 68, 69, 0, 0, 0, 0, 0, 759, 759, 759, 759, 760, 759, 759,
+        },
+        {
+            412, 412, 412, 412, 412, 412, 0, 412, 0, 0, 0, 0, 0, 412, 0, 0,
+        },
+        {
+            761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761, 761,
+        },
+        {
+            761, 761, 761, 761, 761, 761, 761, 761, 0, 0, 0, 0, 0, 0, 0, 762,
+        },
+        {
+            763, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 764,
+        },
+        {
+            418, 418, 418, 418, 418, 418, 418, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            418, 418, 418, 418, 418, 418, 418, 0, 418, 418, 418, 418, 418, 418, 418, 0,
+        },
+        {
+            765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765,
+        },
+        {
+            63, 63, 32, 40, 32, 40, 63, 63, 63, 32, 40, 63, 32, 40, 63, 63,
+        },
+        {
+            63, 63, 63, 63, 63, 63, 63, 638, 63, 63, 638, 63, 32, 40, 63, 63,
+        },
+        {
+            32, 40, 642, 649, 642, 649, 642, 649, 642, 649, 63, 63, 63, 63, 63, 51,
+        },
+        {
+            63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 638, 638, 63, 63, 63, 63,
+        },
+        {
+            638, 63, 642, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+        },
+        {
+            30, 30, 63, 63, 63, 642, 649, 642, 649, 642, 649, 642, 649, 638, 0, 0,
+        },
+        {
+            766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766,
+        },
+        {
+            766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 0, 766, 766, 766, 766, 766,
+        },
+        {
+            766, 766, 766, 766, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            766, 766, 766, 766, 766, 766, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 0, 0, 0, 0,
+        },
+        {
+            767, 768, 768, 768, 726, 769, 770, 771, 727, 728, 727, 728, 727, 728, 727, 728,
+        },
+        {
+            727, 728, 726, 726, 727, 728, 727, 728, 727, 728, 727, 728, 772, 727, 728, 728,
+        },
+        {
+            726, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 782, 782, 782, 783, 783,
+        },
+        {
+            772, 784, 784, 784, 784, 784, 726, 726, 785, 786, 787, 769, 770, 768, 726, 30,
+        },
+        {
+            0, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788,
+        },
+        {
+            788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788,
+        },
+        {
+            788, 788, 788, 788, 788, 788, 788, 0, 0, 782, 782, 789, 789, 790, 790, 788,
+        },
+        {
+            772, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791,
+        },
+        {
+            791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791,
+        },
+        {
+            791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 791, 768, 784, 792, 792, 791,
+        },
+        {
+            0, 0, 0, 0, 0, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793,
+        },
+        {
+            793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793,
+        },
+        {
+            0, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+        },
+        {
+            414, 414, 414, 414, 415, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+        },
+        {
+            414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 0,
+        },
+        {
+            726, 726, 794, 795, 796, 797, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+        },
+        {
+            726, 726, 726, 726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798,
+        },
+        {
+            798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 0,
+        },
+        {
+            794, 795, 796, 797, 799, 800, 801, 802, 803, 804, 726, 726, 726, 726, 726, 726,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 734, 744, 805, 806, 807, 808, 809, 810,
+        },
+        {
+            726, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825,
+        },
+        {
+            798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 726,
+        },
+        {
+            726, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840,
+        },
+        {
+            841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841,
+        },
+        {
+            841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 726,
+        },
+        {
+            841, 841, 841, 841, 841, 841, 841, 841, 726, 726, 726, 726, 726, 726, 726, 726,
+        },
+        {
+            842, 842, 842, 842, 842, 843, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 844, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 843, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 845, 842, 842,
+        },
+        {
+            846, 842, 842, 845, 842, 842, 842, 847, 842, 848, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 849, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 844, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 843, 842, 850, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 851,
+        },
+        {
+            852, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 853,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 848, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 843, 842, 842,
+        },
+        {
+            854, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 851, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 855, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 844, 842, 856, 842, 857, 842, 842,
+        },
+        {
+            842, 852, 842, 853, 858, 859, 842, 842, 842, 842, 842, 842, 860, 842, 842, 842,
+        },
+        {
+            842, 848, 848, 848, 848, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 850, 842, 842, 842, 842,
+        },
+        {
+            842, 846, 842, 842, 842, 842, 842, 842, 842, 846, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 846, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 849, 858,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 846, 844, 848, 842,
+        },
+        {
+            844, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 852, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 856, 842, 842, 842,
+        },
+        {
+            842, 842, 845, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 845, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 849, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 854, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 850, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 847, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 844, 842,
+        },
+        {
+            842, 853, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 857, 842, 842, 842, 842, 842, 854, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 857, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 861, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862,
+        },
+        {
+            862, 862, 862, 862, 862, 863, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862,
+        },
+        {
+            862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 0, 0, 0,
+        },
+        {
+            864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864,
+        },
+        {
+            864, 864, 864, 864, 864, 864, 864, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            865, 865, 865, 865, 865, 865, 865, 865, 865, 865, 865, 865, 865, 865, 865, 865,
+        },
+        {
+            865, 865, 865, 865, 865, 865, 865, 865, 866, 866, 866, 866, 866, 866, 867, 867,
+        },
+        {
+            868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868,
+        },
+        {
+            868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 869, 870, 870, 870,
+        },
+        {
+            871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 868, 868, 0, 0, 0, 0,
+        },
+        {
+            71, 74, 71, 74, 71, 74, 71, 74, 71, 74, 71, 74, 71, 74, 881, 76,
+        },
+        {
+            78, 78, 78, 882, 765, 765, 765, 765, 765, 765, 765, 765, 76, 76, 882, 883,
+        },
+        {
+            71, 74, 71, 74, 71, 74, 71, 74, 71, 74, 71, 74, 633, 633, 765, 765,
+        },
+        {
+            884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884,
+        },
+        {
+            884, 884, 884, 884, 884, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894,
+        },
+        {
+            895, 895, 896, 896, 896, 896, 896, 896, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            53, 53, 53, 53, 53, 53, 53, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+        },
+        {
+            53, 53, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47,
+        },
+        {
+            47, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47,
+        },
+        {
+            50, 47, 47, 47, 47, 47, 47, 47, 47, 44, 47, 44, 47, 44, 44, 47,
+        },
+        {
+            44, 47, 44, 47, 44, 47, 44, 47, 51, 53, 53, 44, 47, 44, 47, 48,
+        },
+        {
+            44, 47, 44, 47, 47, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47,
+        },
+        {
+            44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 44, 44, 44, 44, 47,
+        },
+        {
+            44, 44, 44, 44, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47, 44, 47,
+        },
+        {
+            44, 47, 44, 47, 44, 44, 44, 44, 47, 44, 47, 0, 0, 0, 0, 0,
+        },
+        {
+            44, 47, 0, 47, 0, 47, 44, 47, 44, 47, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 897, 897, 897, 44, 47, 48, 50, 50, 47, 48, 48, 48, 48, 48,
+        },
+        {
+            898, 898, 899, 898, 898, 898, 900, 898, 898, 898, 898, 899, 898, 898, 898, 898,
+        },
+        {
+            898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898,
+        },
+        {
+            898, 898, 898, 901, 901, 899, 899, 901, 902, 902, 902, 902, 900, 0, 0, 0,
+        },
+        {
+            903, 904, 905, 906, 907, 908, 30, 30, 338, 30, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 909, 909,
+        },
+        {
+            909, 909, 909, 909, 910, 910, 910, 910, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            911, 911, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912,
+        },
+        {
+            912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912,
+        },
+        {
+            912, 912, 912, 912, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911,
+        },
+        {
+            911, 911, 911, 911, 913, 914, 0, 0, 0, 0, 0, 0, 0, 0, 915, 915,
+        },
+        {
+            916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+        },
+        {
+            148, 148, 147, 147, 147, 147, 147, 147, 159, 159, 159, 147, 159, 147, 147, 145,
+        },
+        {
+            926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 936, 936, 936, 936, 936,
+        },
+        {
+            936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936,
+        },
+        {
+            936, 936, 936, 936, 936, 936, 937, 937, 937, 937, 937, 938, 938, 938, 63, 939,
+        },
+        {
+            940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940,
+        },
+        {
+            940, 940, 940, 940, 940, 940, 940, 941, 941, 941, 941, 941, 941, 941, 941, 941,
+        },
+        {
+            941, 941, 942, 943, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 944,
+        },
+        {
+            414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 0, 0, 0,
+        },
+        {
+            945, 945, 945, 946, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947,
+        },
+        {
+            947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947,
+        },
+        {
+            947, 947, 947, 948, 946, 946, 945, 945, 945, 945, 946, 946, 945, 945, 946, 946,
+        },
+        {
+            949, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 0, 51,
+        },
+        {
+            951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 0, 0, 0, 0, 950, 950,
+        },
+        {
+            395, 395, 395, 395, 395, 397, 961, 395, 395, 395, 395, 395, 395, 395, 395, 395,
+        },
+        {
+            399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 395, 395, 395, 395, 395, 0,
+        },
+        {
+            962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962,
+        },
+        {
+            962, 962, 962, 962, 962, 962, 962, 962, 962, 963, 963, 963, 963, 963, 963, 964,
+        },
+        {
+            964, 963, 963, 964, 964, 963, 963, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            962, 962, 962, 963, 962, 962, 962, 962, 962, 962, 962, 962, 963, 964, 0, 0,
+        },
+        {
+            965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 0, 0, 975, 975, 975, 975,
+        },
+        {
+            961, 395, 395, 395, 395, 395, 395, 410, 410, 410, 395, 396, 397, 396, 395, 395,
+        },
+        {
+            976, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976,
+        },
+        {
+            977, 976, 977, 977, 977, 976, 976, 977, 977, 976, 976, 976, 976, 976, 977, 978,
+        },
+        {
+            976, 978, 976, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 976, 976, 979, 980, 980,
+        },
+        {
+            981, 981, 981, 981, 981, 981, 981, 981, 981, 981, 981, 982, 983, 983, 982, 982,
+        },
+        {
+            984, 984, 981, 985, 985, 982, 986, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 418, 418, 418, 418, 418, 418, 0, 0, 418, 418, 418, 418, 418, 418, 0,
+        },
+        {
+            0, 418, 418, 418, 418, 418, 418, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 53, 50, 50, 50, 50,
+        },
+        {
+            47, 47, 47, 47, 47, 60, 47, 47, 47, 897, 53, 53, 0, 0, 0, 0,
+        },
+        {
+            443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443,
+        },
+        {
+            981, 981, 981, 981, 981, 981, 981, 981, 981, 981, 981, 981, 981, 981, 981, 981,
+        },
+        {
+            981, 981, 981, 982, 982, 983, 982, 982, 983, 982, 982, 984, 987, 986, 0, 0,
+        },
+        {
+            988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            414, 414, 414, 414, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            417, 417, 417, 417, 417, 417, 417, 0, 0, 0, 0, 417, 417, 417, 417, 417,
+        },
+        {
+            417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 0, 0, 0, 0,
+        },
+        {
+            998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998,
+        },
+        {
+            999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 848, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 852, 842, 842, 842, 842, 844, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 861, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 857, 842, 857, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 852, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 1000, 1000,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 1000, 1000, 1000, 1000, 1000, 1000,
+        },
+        {
+            1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000,
+        },
+        {
+            47, 47, 47, 47, 47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 82, 82, 82, 82, 82, 0, 0, 0, 0, 0, 90, 87, 90,
+        },
+        {
+            90, 90, 90, 90, 90, 90, 90, 90, 90, 1001, 90, 90, 90, 90, 90, 90,
+        },
+        {
+            90, 90, 90, 90, 90, 90, 90, 0, 90, 90, 90, 90, 90, 0, 90, 0,
+        },
+        {
+            90, 90, 0, 90, 90, 0, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+        },
+        {
+            99, 99, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+        },
+        {
+            144, 144, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        },
+        {
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 649, 642,
+        },
+        {
+            96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+        },
+        {
+            0, 0, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        },
+        {
+            99, 99, 99, 99, 99, 99, 99, 99, 0, 0, 0, 0, 0, 0, 0, 96,
+        },
+        {
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 95, 96, 96, 96,
+        },
+        {
+            58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        },
+        {
+            768, 768, 768, 768, 768, 768, 768, 727, 728, 768, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 76, 76,
+        },
+        {
+            768, 772, 772, 1002, 1002, 727, 728, 727, 728, 727, 728, 727, 728, 727, 728, 727,
+        },
+        {
+            728, 727, 728, 727, 728, 768, 768, 727, 728, 768, 768, 768, 768, 1002, 1002, 1002,
+        },
+        {
+            768, 768, 768, 0, 768, 768, 768, 768, 772, 727, 728, 727, 728, 727, 728, 768,
+        },
+        {
+            768, 1003, 747, 1004, 747, 747, 747, 0, 1003, 1005, 768, 768, 0, 0, 0, 0,
+        },
+        {
+            99, 99, 99, 99, 99, 0, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        },
+        {
+            99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 0, 0, 635,
+        },
+        {
+            0, 1006, 1006, 1006, 1007, 1006, 1006, 1006, 1008, 1009, 1006, 1010, 1006, 1011, 1006, 1006,
+        },
+        {
+            1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1006, 1006, 1010, 1010, 1010, 1006,
+        },
+        {
+            1006, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022,
+        },
+        {
+            1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1008, 1023, 1009, 1024, 1025,
+        },
+        {
+            1026, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+        },
+        {
+            1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1008, 1010, 1009, 1010, 1008,
+        },
+        {
+            1009, 1028, 1029, 1030, 1028, 1028, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+        },
+        {
+            1032, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+        },
+        {
+            1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+        },
+        {
+            1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1032, 1032,
+        },
+        {
+            1033, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034,
+        },
+        {
+            1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 0,
+        },
+        {
+            0, 0, 1034, 1034, 1034, 1034, 1034, 1034, 0, 0, 1034, 1034, 1034, 1034, 1034, 1034,
+        },
+        {
+            0, 0, 1034, 1034, 1034, 1034, 1034, 1034, 0, 0, 1034, 1034, 1034, 0, 0, 0,
+        },
+        {
+            1007, 1007, 1010, 1026, 1035, 1007, 1007, 0, 1036, 1037, 1037, 1037, 1037, 1036, 1036, 0,
+        },
+        {
+            651, 651, 651, 651, 651, 651, 651, 651, 651, 92, 92, 92, 30, 34, 0, 0,
+        },
+        {
+            1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 0, 1038, 1038, 1038,
+        },
+        {
+            1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+        },
+        {
+            1038, 1038, 1038, 1038, 1038, 1038, 1038, 0, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+        },
+        {
+            1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 0, 1038, 1038, 0, 1038,
+        },
+        {
+            1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 0, 0,
+        },
+        {
+            1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 0, 0, 0, 0, 0,
+        },
+        {
+            63, 63, 63, 0, 0, 0, 0, 684, 748, 749, 750, 654, 655, 656, 657, 658,
+        },
+        {
+            751, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+        },
+        {
+            1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+        },
+        {
+            1070, 1071, 1072, 1073, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1077, 1082, 1078, 1083, 1079, 1084, 1080, 1077,
+        },
+        {
+            1082, 1078, 1083, 1079, 1084, 1085, 1081, 1082, 1076, 1076, 1076, 1086, 1086, 1086, 1086, 1077,
+        },
+        {
+            1082, 1082, 1082, 1082, 1082, 1087, 1078, 1078, 1078, 1078, 1083, 1088, 1079, 1079, 1079, 1079,
+        },
+        {
+            1079, 1084, 1080, 1077, 1078, 1089, 1089, 1090, 1091, 1092, 1092, 1092, 1092, 1092, 1092, 1092,
+        },
+        {
+            1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1093, 1094, 1092, 1092, 1092, 0,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 0, 0, 0,
+        },
+        {
+            1092, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 77, 0, 0,
+        },
+        {
+            1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095,
+        },
+        {
+            1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 0, 0, 0,
+        },
+        {
+            1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+        },
+        {
+            1096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            77, 684, 748, 749, 750, 654, 655, 656, 657, 658, 751, 1039, 1040, 1041, 1042, 1043,
+        },
+        {
+            1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 0, 0, 0, 0,
+        },
+        {
+            1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097,
+        },
+        {
+            1098, 1099, 1100, 1101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1097, 1097, 1097,
+        },
+        {
+            1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+        },
+        {
+            1102, 1103, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1104, 0, 0, 0, 0, 0,
+        },
+        {
+            1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105,
+        },
+        {
+            1105, 1105, 1105, 1105, 1105, 1105, 1106, 1106, 1106, 1106, 1106, 0, 0, 0, 0, 0,
+        },
+        {
+            1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107,
+        },
+        {
+            1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 0, 1108,
+        },
+        {
+            1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+        },
+        {
+            1109, 1109, 1109, 1109, 0, 0, 0, 0, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+        },
+        {
+            1110, 1111, 1112, 1113, 1114, 1115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+        },
+        {
+            1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
+        },
+        {
+            1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
+        },
+        {
+            1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+        },
+        {
+            1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119,
+        },
+        {
+            1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 0, 0,
+        },
+        {
+            1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130,
+        },
+        {
+            1130, 1130, 1130, 1130, 0, 0, 0, 0, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+        },
+        {
+            1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+        },
+        {
+            1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 0, 0, 0, 0,
+        },
+        {
+            1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132,
+        },
+        {
+            1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133,
+        },
+        {
+            1133, 1133, 1133, 1133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1134,
+        },
+        {
+            1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 0, 1135, 1135, 1135, 1135,
+        },
+        {
+            1135, 1135, 1135, 0, 1135, 1135, 0, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136,
+        },
+        {
+            1136, 1136, 0, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136,
+        },
+        {
+            1136, 1136, 0, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 0, 1136, 1136, 0, 0, 0,
+        },
+        {
+            1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137,
+        },
+        {
+            1137, 1137, 1137, 1137, 1137, 1137, 1137, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1137, 1137, 1137, 1137, 1137, 1137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            50, 897, 897, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        },
+        {
+            50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0,
+        },
+        {
+            1138, 1138, 1138, 1138, 1138, 1138, 0, 0, 1138, 0, 1138, 1138, 1138, 1138, 1138, 1138,
+        },
+        {
+            1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138,
+        },
+        {
+            1138, 1138, 1138, 1138, 1138, 1138, 0, 1138, 1138, 0, 0, 0, 1138, 0, 0, 1138,
+        },
+        {
+            1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139,
+        },
+        {
+            1139, 1139, 1139, 1139, 1139, 1139, 0, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148,
+        },
+        {
+            1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149,
+        },
+        {
+            1149, 1149, 1149, 1149, 1149, 1149, 1149, 1150, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157,
+        },
+        {
+            1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158,
+        },
+        {
+            1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 1159, 1160, 1161, 1162, 1162, 1163, 1164, 1165, 1166,
+        },
+        {
+            1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
+        },
+        {
+            1167, 1167, 1167, 0, 1167, 1167, 0, 0, 0, 0, 0, 1168, 1169, 1170, 1171, 1172,
+        },
+        {
+            1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173,
+        },
+        {
+            1173, 1173, 1173, 1173, 1173, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 0, 0, 0, 1180,
+        },
+        {
+            1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181,
+        },
+        {
+            1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 0, 0, 0, 0, 0, 1182,
+        },
+        {
+            1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183,
+        },
+        {
+            1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184,
+        },
+        {
+            1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 0, 0, 0, 0, 1185, 1186, 1184, 1184,
+        },
+        {
+            1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202,
+        },
+        {
+            0, 0, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216,
+        },
+        {
+            1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232,
+        },
+        {
+            1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1186, 1244, 1245, 1246, 1247,
+        },
+        {
+            1248, 1249, 1249, 1249, 0, 1249, 1249, 0, 0, 0, 0, 0, 1249, 1249, 1249, 1249,
+        },
+        {
+            1248, 1248, 1248, 1248, 0, 1248, 1248, 1248, 0, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+        },
+        {
+            1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+        },
+        {
+            1248, 1248, 1248, 1248, 1248, 1248, 0, 0, 1250, 1250, 1250, 0, 0, 0, 0, 1250,
+        },
+        {
+            1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+        },
+        {
+            1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1262, 1263, 1264,
+        },
+        {
+            1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
+        },
+        {
+            1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1267, 1268,
+        },
+        {
+            1269, 1269, 1269, 1269, 1269, 1269, 1269, 1269, 1270, 1269, 1269, 1269, 1269, 1269, 1269, 1269,
+        },
+        {
+            1269, 1269, 1269, 1269, 1269, 1269, 1269, 1269, 1269, 1269, 1269, 1269, 1269, 1269, 1269, 1269,
+        },
+        {
+            1269, 1269, 1269, 1269, 1269, 1271, 1271, 0, 0, 0, 0, 1272, 1273, 1274, 1275, 1276,
+        },
+        {
+            1277, 1277, 1277, 1277, 1277, 1277, 1277, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278,
+        },
+        {
+            1278, 1278, 1278, 1278, 1278, 1278, 0, 0, 0, 1279, 1279, 1279, 1279, 1279, 1279, 1279,
+        },
+        {
+            1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+        },
+        {
+            1280, 1280, 1280, 1280, 1280, 1280, 0, 0, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288,
+        },
+        {
+            1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289,
+        },
+        {
+            1289, 1289, 1289, 0, 0, 0, 0, 0, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297,
+        },
+        {
+            1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
+        },
+        {
+            1298, 1298, 0, 0, 0, 0, 0, 0, 0, 1299, 1299, 1299, 1299, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 1300, 1301, 1302, 1303, 1304, 1305, 1306,
+        },
+        {
+            1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,
+        },
+        {
+            1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308,
+        },
+        {
+            1308, 1308, 1308, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309,
+        },
+        {
+            1309, 1309, 1309, 0, 0, 0, 0, 0, 0, 0, 1310, 1311, 1312, 1313, 1314, 1315,
+        },
+        {
+            1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316,
+        },
+        {
+            1316, 1316, 1316, 1316, 1317, 1317, 1317, 1317, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+        },
+        {
+            1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 0,
+        },
+        {
+            1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359,
+        },
+        {
+            1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 0, 1360, 1360, 1361, 0, 0,
+        },
+        {
+            1359, 1359, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362,
+        },
+        {
+            1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1363, 1364, 1365,
+        },
+        {
+            1366, 1367, 1368, 1369, 1370, 1371, 1372, 1362, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373,
+        },
+        {
+            1373, 1373, 1373, 1373, 1373, 1373, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
+        },
+        {
+            1374, 1375, 1376, 1377, 1378, 1379, 1379, 1379, 1379, 1379, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380,
+        },
+        {
+            1380, 1380, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383,
+        },
+        {
+            1383, 1383, 1383, 1383, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 0, 0, 0, 0,
+        },
+        {
+            1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391,
+        },
+        {
+            1391, 1391, 1391, 1391, 1391, 1391, 1391, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1392, 1393, 1392, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394,
+        },
+        {
+            1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394,
+        },
+        {
+            1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
+        },
+        {
+            1393, 1393, 1393, 1393, 1393, 1393, 1395, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 0, 0,
+        },
+        {
+            0, 0, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410,
+        },
+        {
+            1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426,
+        },
+        {
+            1395, 1394, 1394, 1393, 1393, 1394, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1395,
+        },
+        {
+            1427, 1427, 1428, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
+        },
+        {
+            1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
+        },
+        {
+            1428, 1428, 1428, 1430, 1430, 1430, 1430, 1428, 1428, 1427, 1427, 1431, 1431, 1432, 1431, 1431,
+        },
+        {
+            1431, 1431, 1430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1432, 0, 0,
+        },
+        {
+            1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
+        },
+        {
+            1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1444, 1444, 1444, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+        },
+        {
+            1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+        },
+        {
+            1445, 1445, 1445, 1445, 1445, 1445, 1445, 1444, 1444, 1444, 1444, 1444, 1446, 1444, 1444, 1444,
+        },
+        {
+            1444, 1444, 1444, 1447, 1447, 0, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457,
+        },
+        {
+            1458, 1458, 1458, 1458, 1445, 1446, 1446, 1445, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+        },
+        {
+            1459, 1459, 1459, 1460, 1461, 1461, 1459, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1462, 1462, 1463, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
+        },
+        {
+            1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
+        },
+        {
+            1464, 1464, 1464, 1463, 1463, 1463, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463,
+        },
+        {
+            1465, 1464, 1464, 1464, 1464, 1466, 1466, 1466, 1466, 1467, 1467, 1467, 1467, 1466, 1463, 1462,
+        },
+        {
+            1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1464, 1466, 1464, 1466, 1466, 1466,
+        },
+        {
+            0, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492,
+        },
+        {
+            1493, 1494, 1495, 1496, 1497, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
+        },
+        {
+            1498, 1498, 0, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
+        },
+        {
+            1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1499, 1499, 1499, 1500,
+        },
+        {
+            1500, 1500, 1499, 1499, 1500, 1501, 1502, 1500, 1503, 1503, 1503, 1503, 1503, 1503, 1500, 0,
+        },
+        {
+            1504, 1504, 1504, 1504, 1504, 1504, 1504, 0, 1504, 0, 1504, 1504, 1504, 1504, 0, 1504,
+        },
+        {
+            1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 0, 1504,
+        },
+        {
+            1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1505, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
+        },
+        {
+            1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1507,
+        },
+        {
+            1508, 1508, 1508, 1507, 1507, 1507, 1507, 1507, 1507, 1509, 1509, 0, 0, 0, 0, 0,
+        },
+        {
+            1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1520, 1520, 1521, 1521, 0, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 0, 0, 1522,
+        },
+        {
+            1522, 0, 0, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522,
+        },
+        {
+            1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 0, 1522, 1522, 1522, 1522, 1522, 1522,
+        },
+        {
+            1522, 0, 1522, 1522, 0, 1522, 1522, 1522, 1522, 1522, 0, 77, 1523, 1522, 1521, 1521,
+        },
+        {
+            1520, 1521, 1521, 1521, 1521, 0, 0, 1521, 1521, 0, 0, 1521, 1521, 1524, 0, 0,
+        },
+        {
+            1522, 0, 0, 0, 0, 0, 0, 1521, 0, 0, 0, 0, 0, 1522, 1522, 1522,
+        },
+        {
+            1522, 1522, 1521, 1521, 0, 0, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 0, 0, 0,
+        },
+        {
+            1523, 1523, 1523, 1523, 1523, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+        },
+        {
+            1525, 1525, 1525, 1525, 1525, 1526, 1526, 1526, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527,
+        },
+        {
+            1526, 1526, 1528, 1527, 1527, 1526, 1528, 1525, 1525, 1525, 1525, 1529, 1529, 1529, 1529, 1529,
+        },
+        {
+            1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1529, 1529, 0, 1529, 1528, 1525,
+        },
+        {
+            1525, 1525, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540,
+        },
+        {
+            1541, 1541, 1541, 1542, 1542, 1542, 1542, 1542, 1542, 1541, 1542, 1541, 1541, 1541, 1541, 1542,
+        },
+        {
+            1542, 1541, 1543, 1543, 1540, 1540, 1544, 1540, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555,
+        },
+        {
+            1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556,
+        },
+        {
+            1556, 1556, 1557, 1557, 1557, 1557, 0, 0, 1556, 1556, 1556, 1556, 1557, 1557, 1556, 1558,
+        },
+        {
+            1558, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
+        },
+        {
+            1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1555, 1555, 1555, 1555, 1557, 1557, 0, 0,
+        },
+        {
+            1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560,
+        },
+        {
+            1561, 1561, 1561, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1561, 1561, 1562, 1561, 1563,
+        },
+        {
+            1562, 1564, 1564, 1564, 1560, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 0, 0, 0,
+        },
+        {
+            1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575,
+        },
+        {
+            1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1576, 1577, 1576, 1577, 1577,
+        },
+        {
+            1576, 1576, 1576, 1576, 1576, 1576, 1578, 1579, 1575, 1580, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591,
+        },
+        {
+            1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 0, 0, 1592, 1592, 1592,
+        },
+        {
+            1593, 1593, 1592, 1592, 1592, 1592, 1593, 1592, 1592, 1592, 1592, 1594, 0, 0, 0, 0,
+        },
+        {
+            1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1607, 1607, 1608,
+        },
+        {
+            1591, 1591, 1591, 1591, 1591, 1591, 1591, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609,
+        },
+        {
+            1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1610, 1610, 1610, 1611,
+        },
+        {
+            1611, 1611, 1611, 1611, 1611, 1611, 1611, 1611, 1610, 1612, 1612, 1613, 0, 0, 0, 0,
+        },
+        {
+            1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
+        },
+        {
+            1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615,
+        },
+        {
+            1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631,
+        },
+        {
+            1632, 1633, 1634, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1635,
+        },
+        {
+            1636, 1636, 1636, 1636, 1636, 1636, 1636, 0, 0, 1636, 0, 0, 1636, 1636, 1636, 1636,
+        },
+        {
+            1636, 1636, 1636, 1636, 0, 1636, 1636, 0, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636,
+        },
+        {
+            1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636,
+        },
+        {
+            1637, 1637, 1637, 1637, 1637, 1637, 0, 1637, 1637, 0, 0, 1638, 1638, 1639, 1640, 1636,
+        },
+        {
+            1637, 1636, 1637, 1640, 1641, 1641, 1641, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 0, 0, 1652, 1652, 1652, 1652, 1652, 1652,
+        },
+        {
+            1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+        },
+        {
+            1652, 1653, 1653, 1653, 1654, 1654, 1654, 1654, 0, 0, 1654, 1654, 1653, 1653, 1653, 1653,
+        },
+        {
+            1655, 1652, 1656, 1652, 1653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1657, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1657, 1657, 1657, 1657, 1657,
+        },
+        {
+            1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657,
+        },
+        {
+            1657, 1657, 1657, 1659, 1659, 1658, 1658, 1658, 1658, 1660, 1657, 1658, 1658, 1658, 1658, 1661,
+        },
+        {
+            1661, 1661, 1661, 1661, 1661, 1661, 1661, 1659, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1662, 1663, 1663, 1663, 1663, 1663, 1663, 1664, 1664, 1663, 1663, 1663, 1662, 1662, 1662, 1662,
+        },
+        {
+            1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662,
+        },
+        {
+            1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1663, 1663, 1663, 1663, 1663, 1663,
+        },
+        {
+            1663, 1663, 1663, 1663, 1663, 1663, 1663, 1664, 1665, 1665, 1666, 1666, 1666, 1662, 1666, 1666,
+        },
+        {
+            1666, 1666, 1666, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667,
+        },
+        {
+            1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 0, 1668, 1668, 1668, 1668, 1668, 1668,
+        },
+        {
+            1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668,
+        },
+        {
+            1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1669,
+        },
+        {
+            1670, 1670, 1670, 1670, 1670, 1670, 1670, 0, 1670, 1670, 1670, 1670, 1670, 1670, 1669, 1671,
+        },
+        {
+            1668, 1672, 1672, 1672, 1672, 1672, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688,
+        },
+        {
+            1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 0, 0, 0,
+        },
+        {
+            1702, 1702, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703,
+        },
+        {
+            1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703,
+        },
+        {
+            0, 0, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704,
+        },
+        {
+            1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 0, 1705, 1704, 1704, 1704, 1704, 1704, 1704,
+        },
+        {
+            1704, 1705, 1704, 1704, 1705, 1704, 1704, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1706, 1706, 1706, 1706, 1706, 1706, 1706, 0, 1706, 1706, 0, 1706, 1706, 1706, 1706, 1706,
+        },
+        {
+            1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706,
+        },
+        {
+            1706, 1707, 1707, 1707, 1707, 1707, 1707, 0, 0, 0, 1707, 0, 1707, 1707, 0, 1707,
+        },
+        {
+            1707, 1707, 1708, 1707, 1708, 1708, 1706, 1707, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1719, 1719, 1719, 1719, 1719, 1719, 0, 1719, 1719, 0, 1719, 1719, 1719, 1719, 1719, 1719,
+        },
+        {
+            1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719,
+        },
+        {
+            1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1720, 1720, 1720, 1720, 1720, 0,
+        },
+        {
+            1721, 1721, 0, 1720, 1720, 1721, 1720, 1722, 1719, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733,
+        },
+        {
+            1733, 1733, 1733, 1734, 1734, 1735, 1735, 1736, 1736, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1746, 1747, 1748, 1749, 1750, 1751,
+        },
+        {
+            1752, 1753, 1753, 1754, 1737, 253, 253, 253, 253, 253, 253, 253, 253, 254, 254, 254,
+        },
+        {
+            254, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+        },
+        {
+            253, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1755,
+        },
+        {
+            1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756,
+        },
+        {
+            1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 1756, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1759,
+        },
+        {
+            1760, 1761, 1762, 1763, 1764, 1765, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1757,
+        },
+        {
+            1758, 1759, 1760, 1757, 1758, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1757, 1758, 1758,
+        },
+        {
+            1759, 1760, 1766, 1767, 1765, 1757, 1758, 1758, 1759, 1760, 1758, 1758, 1759, 1759, 1759, 1759,
+        },
+        {
+            1761, 1762, 1762, 1762, 1763, 1763, 1764, 1764, 1764, 1764, 1757, 1758, 1759, 1760, 1761, 1765,
+        },
+        {
+            1757, 1758, 1759, 1759, 1760, 1760, 1757, 1758, 1765, 1757, 1768, 1769, 1770, 1768, 1769, 1771,
+        },
+        {
+            1772, 1773, 1772, 1772, 1774, 1768, 1769, 1775, 1776, 1759, 1760, 1761, 1762, 1763, 1764, 0,
+        },
+        {
+            1777, 1777, 1777, 1777, 1777, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1756, 1756, 1756, 1756, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778,
+        },
+        {
+            1778, 1779, 1779, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
+        },
+        {
+            1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 0,
+        },
+        {
+            1781, 1781, 1781, 1781, 1781, 1781, 1781, 1781, 1781, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782,
+        },
+        {
+            1782, 1782, 1782, 1782, 1782, 1782, 1782, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            884, 884, 884, 884, 884, 884, 884, 884, 884, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783,
+        },
+        {
+            1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 0,
+        },
+        {
+            1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 0, 0, 0, 0, 1794, 1794,
+        },
+        {
+            1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795,
+        },
+        {
+            1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 0,
+        },
+        {
+            1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806,
+        },
+        {
+            1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 0, 0,
+        },
+        {
+            1807, 1807, 1807, 1807, 1807, 1808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809,
+        },
+        {
+            1810, 1810, 1810, 1810, 1810, 1810, 1810, 1811, 1811, 1811, 1811, 1811, 1812, 1812, 1812, 1812,
+        },
+        {
+            1813, 1813, 1813, 1813, 1811, 1812, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 0, 1824, 1825, 1826, 1827, 1828,
+        },
+        {
+            1829, 1830, 0, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809,
+        },
+        {
+            1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 0, 0, 0, 0, 0, 1809, 1809, 1809,
+        },
+        {
+            1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831,
+        },
+        {
+            1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832,
+        },
+        {
+            1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848,
+        },
+        {
+            1849, 1850, 1851, 1852, 1834, 1835, 1836, 1853, 1853, 1853, 1853, 0, 0, 0, 0, 0,
+        },
+        {
+            1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+        },
+        {
+            1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 0, 0, 0, 0, 1855,
+        },
+        {
+            1854, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856,
+        },
+        {
+            1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856,
+        },
+        {
+            1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 0, 0, 0, 0, 0, 0, 0, 1855,
+        },
+        {
+            1855, 1855, 1855, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857,
+        },
+        {
+            1858, 1859, 1860, 769, 1861, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1862, 1862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863,
+        },
+        {
+            1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1864, 1864, 1864, 1864, 1864, 1864, 1864, 1864, 1864, 1864, 1864, 1864, 1864, 1864, 1864, 1864,
+        },
+        {
+            1864, 1864, 1864, 1864, 1864, 1864, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 1863, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            792, 792, 792, 792, 0, 792, 792, 792, 792, 792, 792, 792, 0, 792, 792, 0,
+        },
+        {
+            791, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788,
+        },
+        {
+            791, 791, 791, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            788, 788, 788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 791, 791, 791, 791, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865,
+        },
+        {
+            1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 0, 0, 0, 0,
+        },
+        {
+            1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866,
+        },
+        {
+            1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 0, 0, 0, 0, 0,
+        },
+        {
+            1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 0, 0, 0,
+        },
+        {
+            1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 1866, 0, 0, 1867, 1868, 1869, 1870,
+        },
+        {
+            635, 635, 635, 635, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 0, 0,
+        },
+        {
+            77, 77, 77, 77, 77, 77, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 0, 0, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 631, 631, 77, 77, 77, 30, 30, 30, 631, 631, 631,
+        },
+        {
+            631, 631, 631, 635, 635, 635, 635, 635, 635, 635, 635, 77, 77, 77, 77, 77,
+        },
+        {
+            77, 77, 77, 30, 30, 77, 77, 77, 77, 77, 77, 77, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 77, 77, 77, 77, 30, 30,
+        },
+        {
+            1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092,
+        },
+        {
+            1092, 1092, 1871, 1871, 1871, 1092, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            652, 684, 748, 749, 750, 654, 655, 656, 657, 658, 751, 1872, 1873, 1874, 1875, 1876,
+        },
+        {
+            1877, 1878, 1879, 1880, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            684, 748, 749, 750, 654, 655, 656, 657, 658, 751, 1039, 1040, 1041, 1042, 1043, 1044,
+        },
+        {
+            1045, 1046, 684, 748, 749, 750, 654, 684, 654, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664,
+        },
+        {
+            664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 665, 665, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664,
+        },
+        {
+            664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 665, 0, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 665, 665, 665, 665, 664, 664, 664, 664, 664, 664, 664, 664,
+        },
+        {
+            664, 664, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 664, 0, 664, 664,
+        },
+        {
+            0, 0, 664, 0, 0, 664, 664, 0, 0, 664, 664, 664, 664, 0, 664, 664,
+        },
+        {
+            664, 664, 664, 664, 664, 664, 665, 665, 665, 665, 0, 665, 0, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 0, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 664, 664, 0, 664, 664, 664, 664, 0, 0, 664, 664, 664,
+        },
+        {
+            664, 664, 664, 664, 664, 0, 664, 664, 664, 664, 664, 664, 664, 0, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 665, 665, 665, 665, 664, 664, 0, 664, 664, 664, 664, 0,
+        },
+        {
+            664, 664, 664, 664, 664, 0, 664, 0, 0, 0, 664, 664, 664, 664, 664, 664,
+        },
+        {
+            664, 0, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 664, 664, 664, 664,
+        },
+        {
+            664, 664, 664, 664, 664, 664, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 665, 665, 0, 0, 664, 664, 664, 664, 664, 664, 664, 664,
+        },
+        {
+            664, 648, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 648, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664,
+        },
+        {
+            664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 648, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 665, 648, 665, 665, 665, 665, 665, 665, 664, 664, 664, 664,
+        },
+        {
+            664, 664, 664, 664, 664, 648, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 648,
+        },
+        {
+            665, 665, 665, 665, 665, 665, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664,
+        },
+        {
+            664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 664, 648,
+        },
+        {
+            665, 665, 665, 665, 665, 665, 665, 665, 665, 648, 665, 665, 665, 665, 665, 665,
+        },
+        {
+            664, 664, 664, 664, 664, 664, 664, 664, 664, 648, 665, 665, 665, 665, 665, 665,
+        },
+        {
+            665, 665, 665, 648, 665, 665, 665, 665, 665, 665, 664, 665, 0, 0, 1881, 1882,
+        },
+        {
+            1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888,
+        },
+        {
+            1889, 1890, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1881, 1882, 1883, 1884,
+        },
+        {
+            1885, 1886, 1887, 1888, 1889, 1890, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890,
+        },
+        {
+            1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891,
+        },
+        {
+            1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892,
+        },
+        {
+            1892, 1892, 1892, 1892, 1892, 1892, 1892, 1891, 1891, 1891, 1891, 1892, 1892, 1892, 1892, 1892,
+        },
+        {
+            1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1891, 1891, 1891,
+        },
+        {
+            1891, 1891, 1891, 1891, 1891, 1892, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891, 1891,
+        },
+        {
+            1891, 1891, 1891, 1891, 1892, 1891, 1891, 1893, 1893, 1893, 1893, 1893, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1892, 1892, 1892, 1892, 1892,
+        },
+        {
+            0, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892, 1892,
+        },
+        {
+            47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 48, 47, 47, 47, 47, 47,
+        },
+        {
+            47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 0,
+        },
+        {
+            1894, 1894, 1894, 1894, 1894, 1894, 1894, 0, 1894, 1894, 1894, 1894, 1894, 1894, 1894, 1894,
+        },
+        {
+            1894, 1894, 1894, 1894, 1894, 1894, 1894, 1894, 1894, 0, 0, 1894, 1894, 1894, 1894, 1894,
+        },
+        {
+            1894, 1894, 0, 1894, 1894, 0, 1894, 1894, 1894, 1894, 1894, 0, 0, 0, 0, 0,
+        },
+        {
+            1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895,
+        },
+        {
+            1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 1895, 0, 0, 0,
+        },
+        {
+            1896, 1896, 1896, 1896, 1896, 1896, 1896, 1897, 1897, 1897, 1897, 1897, 1897, 1897, 0, 0,
+        },
+        {
+            1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 0, 0, 0, 0, 1895, 1908,
+        },
+        {
+            1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909,
+        },
+        {
+            1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1910, 0,
+        },
+        {
+            1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911,
+        },
+        {
+            1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1911, 1912, 1912, 1912, 1912,
+        },
+        {
+            1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 0, 0, 0, 0, 0, 1923,
+        },
+        {
+            418, 418, 418, 418, 418, 418, 418, 0, 418, 418, 418, 418, 0, 418, 418, 0,
+        },
+        {
+            418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 0,
+        },
+        {
+            1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924, 1924,
+        },
+        {
+            1924, 1924, 1924, 1924, 1924, 0, 0, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933,
+        },
+        {
+            1934, 1934, 1934, 1934, 1934, 1934, 1934, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935, 1935,
+        },
+        {
+            1935, 1935, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936,
+        },
+        {
+            1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936,
+        },
+        {
+            1936, 1936, 1936, 1936, 1937, 1937, 1937, 1938, 1937, 1937, 1937, 1939, 0, 0, 0, 0,
+        },
+        {
+            1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 0, 0, 0, 0, 1950, 1950,
+        },
+        {
+            0, 684, 748, 749, 750, 654, 655, 656, 657, 658, 751, 1039, 1040, 1041, 1042, 1043,
+        },
+        {
+            1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059,
+        },
+        {
+            1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1951, 1952,
+        },
+        {
+            1951, 1953, 1954, 684, 748, 749, 750, 654, 655, 656, 657, 658, 30, 903, 904, 905,
+        },
+        {
+            338, 684, 748, 1065, 1951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 30, 748,
+        },
+        {
+            749, 750, 654, 655, 656, 657, 658, 751, 1050, 1052, 1057, 1065, 904, 678, 0, 0,
+        },
+        {
+            1955, 1955, 1955, 1955, 0, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955,
+        },
+        {
+            1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955,
+        },
+        {
+            0, 1955, 1955, 0, 1955, 0, 0, 1955, 0, 1955, 1955, 1955, 1955, 1955, 1955, 1955,
+        },
+        {
+            1955, 1955, 1955, 0, 1955, 1955, 1955, 1955, 0, 1955, 0, 1955, 0, 0, 0, 0,
+        },
+        {
+            0, 0, 1955, 0, 0, 0, 0, 1955, 0, 1955, 0, 1955, 0, 1955, 1955, 1955,
+        },
+        {
+            0, 1955, 1955, 0, 1955, 0, 0, 1955, 0, 1955, 0, 1955, 0, 1955, 0, 1955,
+        },
+        {
+            0, 1955, 1955, 0, 1955, 0, 0, 1955, 1955, 1955, 1955, 0, 1955, 1955, 1955, 1955,
+        },
+        {
+            1955, 1955, 1955, 0, 1955, 1955, 1955, 1955, 0, 1955, 1955, 1955, 1955, 0, 1955, 0,
+        },
+        {
+            1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 0, 1955, 1955, 1955, 1955, 1955,
+        },
+        {
+            1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 1955, 0, 0, 0, 0,
+        },
+        {
+            0, 1955, 1955, 1955, 0, 1955, 1955, 1955, 1955, 1955, 0, 1955, 1955, 1955, 1955, 1955,
+        },
+        {
+            93, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 726, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 0,
+        },
+        {
+            0, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            0, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726,
+        },
+        {
+            724, 724, 39, 36, 37, 653, 729, 730, 731, 732, 733, 652, 652, 30, 30, 30,
+        },
+        {
+            34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 30, 30,
+        },
+        {
+            745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 34, 34, 34, 34, 34, 34,
+        },
+        {
+            745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            745, 745, 745, 745, 745, 745, 745, 745, 745, 745, 34, 34, 34, 34, 726, 34,
+        },
+        {
+            34, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 34, 34, 34, 34, 34,
+        },
+        {
+            34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 30, 0, 0,
+        },
+        {
+            0, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            1956, 726, 726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            726, 726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            726, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726, 726, 726,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 30, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 30, 726, 726,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 30, 30, 30, 30, 726,
+        },
+        {
+            726, 30, 30, 30, 726, 30, 30, 30, 726, 726, 726, 789, 789, 789, 789, 789,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 30,
+        },
+        {
+            726, 30, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 30, 30, 726,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726, 726, 726, 726, 30,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 726, 726, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726, 726, 726, 726, 726,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 30, 30, 30, 30, 30, 30, 726, 30, 30, 30,
+        },
+        {
+            726, 726, 726, 30, 30, 726, 726, 726, 0, 0, 0, 0, 0, 726, 726, 726,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726, 726, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 726, 726, 726, 726, 726, 726, 726, 726, 726, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 0, 0,
+        },
+        {
+            30, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 726, 726, 726, 726,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 30, 726, 726, 726, 726,
+        },
+        {
+            726, 726, 726, 726, 726, 0, 0, 0, 726, 726, 726, 726, 726, 0, 0, 0,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 0, 0, 0,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 0, 0, 0, 0, 0,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            726, 726, 726, 726, 726, 726, 726, 726, 0, 0, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            30, 30, 30, 0, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        },
+        {
+            1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 0, 0, 0, 0, 0, 0,
+        },
+        {
+            842, 845, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 850, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 850, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 843, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 859, 842, 842, 842, 842, 842, 842, 842, 842, 860, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 860, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 857, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 848, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 848, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 850, 842, 842,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 1000, 1000, 1000, 1000, 1000, 1000, 1000,
+        },
+        {
+            842, 842, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000,
+        },
+        {
+            842, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000,
+        },
+        {
+            849, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842,
+        },
+        {
+            1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 0, 0,
+        },
+        {
+            842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 842, 1000, 1000, 1000, 1000, 1000,
+        },
+        {
+            651, 635, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651,
+        },
+        {
+            651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651,
+        },
+        {
+            635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635,
+        },
+        {
+            999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 0, 0,
+        },
+    };
+};
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_UNICODE_PROPERTY_TABLES_HPP
@@ -0,0 +1,66 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_UNICODE_UNICODE_TRIE_HPP) // {
+#define TEXT_VIEW_UNICODE_UNICODE_TRIE_HPP
+
+
+#include <type_traits>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * Unicode property trie lookup
+ * Looks up the property value for a code point in a two-stage trie generated
+ * by tools/ucd.py.  'Table' provides block_bits, index, blocks, and
+ * default_value members; code points above U+10FFFF have the default value.
+ */
+template<typename Table>
+constexpr auto trie_lookup(char32_t cp) noexcept {
+    using value_type =
+        std::remove_cv_t<std::remove_all_extents_t<decltype(Table::blocks)>>;
+    if (cp > 0x10FFFF)
+        return value_type(Table::default_value);
+    return Table::blocks
+        [Table::index[cp >> Table::block_bits]]
+        [cp & ((char32_t(1) << Table::block_bits) - 1)];
+}
+
+
+/*
+ * Unicode property three-stage trie lookup
+ * As above, for a trie generated by tools/ucd.py in which the index of the
+ * blocks of values is itself stored as a two-stage trie.  'Table' provides
+ * block_bits, index_block_bits, index, index_blocks, blocks, and
+ * default_value members.
+ */
+template<typename Table>
+constexpr auto trie3_lookup(char32_t cp) noexcept {
+    using value_type =
+        std::remove_cv_t<std::remove_all_extents_t<decltype(Table::blocks)>>;
+    if (cp > 0x10FFFF)
+        return value_type(Table::default_value);
+    char32_t block = cp >> Table::block_bits;
+    return Table::blocks
+        [Table::index_blocks
+            [Table::index[block >> Table::index_block_bits]]
+            [block & ((char32_t(1) << Table::index_block_bits) - 1)]]
+        [cp & ((char32_t(1) << Table::block_bits) - 1)];
+}
+
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_UNICODE_UNICODE_TRIE_HPP
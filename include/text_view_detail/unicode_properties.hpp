@@ -0,0 +1,138 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_UNICODE_PROPERTIES_HPP) // {
+#define TEXT_VIEW_UNICODE_PROPERTIES_HPP
+
+
+#include <text_view_detail/character.hpp>
+#include <text_view_detail/charsets.hpp>
+#include <text_view_detail/unicode/unicode_trie.hpp>
+#include <text_view_detail/unicode/property_tables.hpp>
+#include <limits>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+/*
+ * Unicode property values
+ * The values of the General_Category, Script, and East_Asian_Width
+ * properties.  Enumerators are the lowercase short property value aliases of
+ * the general categories and East Asian widths, e.g. general_category::lu and
+ * east_asian_width::na, and the lowercase long property value aliases of the
+ * scripts, e.g. script::latin and script::old_italic.
+ */
+using general_category = text_detail::unicode_property_table::general_category;
+using script = text_detail::unicode_property_table::script;
+using east_asian_width = text_detail::unicode_property_table::east_asian_width;
+
+
+/*
+ * unicode_properties
+ * The properties of a Unicode code point, as returned by
+ * get_unicode_properties().  All properties are found with a single table
+ * lookup, and the lookup and every accessor may be evaluated at compile time.
+ */
+class unicode_properties {
+public:
+    using table_type = text_detail::unicode_property_table;
+
+    unicode_properties() = delete;
+
+    constexpr general_category get_general_category() const noexcept {
+        return record->gc;
+    }
+
+    constexpr script get_script() const noexcept {
+        return record->sc;
+    }
+
+    constexpr east_asian_width get_east_asian_width() const noexcept {
+        return record->ea;
+    }
+
+    constexpr bool has_numeric_value() const noexcept {
+        return record->nv != 0;
+    }
+    // Returns the Numeric_Value property as a fraction in lowest terms with
+    // a positive denominator; 0/1 if the code point has no numeric value.
+    constexpr long long get_numeric_value_numerator() const noexcept {
+        return table_type::numeric_values[record->nv].numerator;
+    }
+    constexpr long long get_numeric_value_denominator() const noexcept {
+        return table_type::numeric_values[record->nv].denominator;
+    }
+    // Returns the Numeric_Value property, or NaN if the code point has no
+    // numeric value.
+    constexpr double get_numeric_value() const noexcept {
+        return has_numeric_value()
+             ? double(get_numeric_value_numerator())
+               / double(get_numeric_value_denominator())
+             : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    constexpr bool is_alphabetic() const noexcept {
+        return record->flags & table_type::alphabetic;
+    }
+    constexpr bool is_lowercase() const noexcept {
+        return record->flags & table_type::lowercase;
+    }
+    constexpr bool is_uppercase() const noexcept {
+        return record->flags & table_type::uppercase;
+    }
+    constexpr bool is_white_space() const noexcept {
+        return record->flags & table_type::white_space;
+    }
+    constexpr bool is_math() const noexcept {
+        return record->flags & table_type::math;
+    }
+    constexpr bool is_default_ignorable() const noexcept {
+        return record->flags & table_type::default_ignorable;
+    }
+
+private:
+    friend constexpr unicode_properties
+    get_unicode_properties(char32_t cp) noexcept;
+
+    constexpr explicit unicode_properties(
+        const table_type::record *record) noexcept
+    :
+        record{record}
+    {}
+
+    const table_type::record *record;
+};
+
+
+/*
+ * Unicode property retrieval functions.
+ */
+// Returns the properties of the code point 'cp'.  Code points above U+10FFFF
+// have the properties of unassigned code points.
+constexpr unicode_properties
+get_unicode_properties(char32_t cp) noexcept {
+    return unicode_properties{
+        &text_detail::unicode_property_table::records[
+            text_detail::trie3_lookup<text_detail::unicode_property_table>(
+                cp)]};
+}
+
+// Returns the properties of the code point of the character 'c'.
+constexpr unicode_properties
+get_unicode_properties(const character<unicode_character_set> &c) noexcept {
+    return get_unicode_properties(c.get_code_point());
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_UNICODE_PROPERTIES_HPP
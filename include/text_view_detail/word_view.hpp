@@ -0,0 +1,378 @@
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+#if !defined(TEXT_VIEW_WORD_VIEW_HPP) // {
+#define TEXT_VIEW_WORD_VIEW_HPP
+
+
+#include <text_view_detail/adl_customization.hpp>
+#include <text_view_detail/boundary_view.hpp>
+#include <text_view_detail/concepts.hpp>
+#include <text_view_detail/unicode/unicode_trie.hpp>
+#include <text_view_detail/unicode/word_break_tables.hpp>
+#include <origin/core/traits.hpp>
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+
+
+namespace text_detail {
+
+// Returns the word_break_table entry for 'cp'; the Word_Break property and
+// the Extended_Pictographic flag.  Code points below U+0300 are classified
+// with a single table lookup that bypasses the trie.
+inline unsigned char
+word_break_entry(char32_t cp) noexcept {
+    if (cp < word_break_table::latin_limit) {
+        return word_break_table::latin[cp];
+    }
+    return trie_lookup<word_break_table>(cp);
+}
+
+inline word_break_table::property
+word_break_property(char32_t cp) noexcept {
+    return word_break_table::property(
+        word_break_entry(cp) & word_break_table::property_mask);
+}
+
+// Returns the bit that represents the Word_Break property 'p' in a set of
+// properties.
+constexpr unsigned word_break_bit(word_break_table::property p) {
+    return 1u << p;
+}
+
+/*
+ * Word boundary rules
+ * Implements the word boundary rules of UAX #29 (WB3 through WB16 and WB999).
+ * A word_break_context holds the properties of the characters seen so far
+ * that the rules depend on: the previous character, and the previous two
+ * characters other than those ignored by WB4, along with the parity of the
+ * preceding run of regional indicators.  Rules that only depend on the
+ * properties of the characters adjacent to a potential boundary are encoded
+ * in a table of property sets; rules WB6, WB7b, and WB12 also depend on the
+ * property of the character that follows, which is obtained from a lookahead
+ * function only when one of those rules might apply.
+ */
+class word_break_context {
+public:
+    using property = word_break_table::property;
+
+    explicit word_break_context(unsigned char first) noexcept
+    :
+        raw_previous{property(first & word_break_table::property_mask)},
+        previous{raw_previous},
+        before_previous{property::other},
+        odd_regional_indicators{raw_previous == property::regional_indicator}
+    {}
+
+    // Returns true if there is a word boundary between the previous character
+    // and a following character with word_break_table entry 'next_entry'.
+    // 'lookahead' is a function object that returns the property of the
+    // first character after the following character that is not ignored by
+    // WB4, or property::other if there is none.  The context is then updated
+    // to reflect the following character as the previous character.
+    template<typename F>
+    bool is_boundary_before(unsigned char next_entry, F lookahead) {
+        property next =
+            property(next_entry & word_break_table::property_mask);
+        property raw = raw_previous;
+        raw_previous = next;
+
+        if (raw == property::cr && next == property::lf) {
+            return false;                                       // WB3
+        }
+        if (is_newline(raw) || is_newline(next)) {
+            shift(next);
+            return true;                                        // WB3a, WB3b
+        }
+        if (raw == property::zwj
+            && (next_entry & word_break_table::extended_pictographic))
+        {
+            shift(next);
+            return false;                                       // WB3c
+        }
+        if (raw == property::wsegspace && next == property::wsegspace) {
+            shift(next);
+            return false;                                       // WB3d
+        }
+        if (next == property::extend || next == property::format
+            || next == property::zwj)
+        {
+            return false;                                       // WB4
+        }
+
+        bool boundary = true;
+        if ((joins[previous] >> next) & 1) {
+            boundary = false;
+        } else if (previous == property::regional_indicator
+                   && next == property::regional_indicator)
+        {
+            boundary = ! odd_regional_indicators;               // WB15, WB16
+        } else if (is_ahletter(before_previous)
+                   && is_midletter(previous)
+                   && is_ahletter(next))
+        {
+            boundary = false;                                   // WB7
+        } else if (before_previous == property::hebrew_letter
+                   && previous == property::double_quote
+                   && next == property::hebrew_letter)
+        {
+            boundary = false;                                   // WB7c
+        } else if (before_previous == property::numeric
+                   && is_midnum(previous)
+                   && next == property::numeric)
+        {
+            boundary = false;                                   // WB11
+        } else if (is_ahletter(previous) && is_midletter(next)) {
+            boundary = ! is_ahletter(lookahead());              // WB6
+        } else if (previous == property::hebrew_letter
+                   && next == property::double_quote)
+        {
+            boundary = lookahead() != property::hebrew_letter;  // WB7b
+        } else if (previous == property::numeric && is_midnum(next)) {
+            boundary = lookahead() != property::numeric;        // WB12
+        }
+        shift(next);
+        return boundary;
+    }
+
+private:
+    static constexpr bool is_newline(property p) {
+        return p == property::newline || p == property::cr
+            || p == property::lf;
+    }
+    static constexpr bool is_ahletter(property p) {
+        return p == property::aletter || p == property::hebrew_letter;
+    }
+    // MidLetter or MidNumLetQ.
+    static constexpr bool is_midletter(property p) {
+        return p == property::midletter || p == property::midnumlet
+            || p == property::single_quote;
+    }
+    // MidNum or MidNumLetQ.
+    static constexpr bool is_midnum(property p) {
+        return p == property::midnum || p == property::midnumlet
+            || p == property::single_quote;
+    }
+
+    void shift(property next) noexcept {
+        odd_regional_indicators =
+            next == property::regional_indicator && ! odd_regional_indicators;
+        before_previous = previous;
+        previous = next;
+    }
+
+    static constexpr unsigned ahletter =
+        word_break_bit(property::aletter) |
+        word_break_bit(property::hebrew_letter);
+    static constexpr unsigned numeric = word_break_bit(property::numeric);
+    static constexpr unsigned katakana = word_break_bit(property::katakana);
+    static constexpr unsigned extendnumlet =
+        word_break_bit(property::extendnumlet);
+    // For each property of a previous character, the set of properties of a
+    // following character that are not separated by a boundary under rules
+    // WB5, WB7a, WB8, WB9, WB10, WB13, WB13a, and WB13b.
+    static constexpr unsigned joins[property::wsegspace + 1] = {
+        // other, cr, lf, newline, extend, zwj, regional_indicator, format
+        0, 0, 0, 0, 0, 0, 0, 0,
+        // katakana (WB13, WB13a)
+        katakana | extendnumlet,
+        // hebrew_letter (WB5, WB7a, WB9, WB13a)
+        ahletter | word_break_bit(property::single_quote) | numeric |
+        extendnumlet,
+        // aletter (WB5, WB9, WB13a)
+        ahletter | numeric | extendnumlet,
+        // single_quote, double_quote, midnumlet, midletter, midnum
+        0, 0, 0, 0, 0,
+        // numeric (WB8, WB10, WB13a)
+        numeric | ahletter | extendnumlet,
+        // extendnumlet (WB13a, WB13b)
+        extendnumlet | ahletter | numeric | katakana,
+        // wsegspace
+        0,
+    };
+
+    property raw_previous;
+    property previous;
+    property before_previous;
+    bool odd_regional_indicators;
+};
+
+// Boundary rules for boundary_view that locate word boundaries.
+class word_break_rules {
+public:
+    template<typename TIT, typename TST, typename RT>
+    static TIT next_boundary(TIT first, TST last, const RT *range) {
+        if (ascii_next_boundary(first, last, range)) {
+            return first;
+        }
+        word_break_context context{
+            word_break_entry((*first).get_code_point())};
+        for (++first; first != last; ++first) {
+            auto lookahead = [&first, &last] {
+                return next_property(first, last);
+            };
+            if (context.is_boundary_before(
+                    word_break_entry((*first).get_code_point()),
+                    lookahead))
+            {
+                break;
+            }
+        }
+        return first;
+    }
+
+private:
+    // Returns the property of the first character after 'it' that is not
+    // ignored by WB4.
+    template<typename TIT, typename TST>
+    static word_break_table::property next_property(TIT it, TST last) {
+        for (++it; it != last; ++it) {
+            word_break_table::property p =
+                word_break_property((*it).get_code_point());
+            if (p != word_break_table::extend
+                && p != word_break_table::format
+                && p != word_break_table::zwj)
+            {
+                return p;
+            }
+        }
+        return word_break_table::other;
+    }
+
+    // In general, the word boundary that follows a segment is located by
+    // decoding each character.  See below for text in ASCII transparent
+    // encodings.
+    template<typename TIT, typename TST, typename RT>
+    static bool ascii_next_boundary(TIT &, TST, const RT *) {
+        return false;
+    }
+
+    // For text in ASCII transparent encodings, a segment that begins with an
+    // ASCII character is classified by examining code units directly.  In
+    // ASCII, letters, digits, and '_' join with each other (WB5, WB8, WB9,
+    // WB10, WB13a, WB13b), spaces join with each other (WB3d), and other
+    // characters stand alone, except for CR LF (WB3).  Since the segment
+    // begins at a boundary, no rule that depends on the characters before
+    // the segment can apply.  Only when such a run is followed by a non-ASCII
+    // character, or by punctuation that might join it with the characters
+    // that follow (WB6, WB7b, WB12), are the remaining characters decoded.
+    // In that case, 'first' is updated to the last character of the run, from
+    // which the segment continues as if it began there, and false is
+    // returned.  Otherwise, 'first' is updated to the following boundary and
+    // true is returned.
+    template<typename TIT, typename TST, typename RT>
+    requires is_ascii_transparent_encoding<encoding_type_t<TIT>>
+    static bool ascii_next_boundary(TIT &first, TST, const RT *range) {
+        using property = word_break_table::property;
+        auto cu_first = first.base();
+        auto cu_last = text_detail::adl_end(*range);
+        unsigned char cu = *cu_first;
+        if (cu >= 0x80) {
+            return false;
+        }
+
+        auto run_last = cu_first;
+        property p = property(word_break_table::latin[cu]);
+        if (p == property::cr) {
+            ++run_last;
+            if (run_last != cu_last && *run_last == '\n') {
+                ++run_last;
+            }
+            first = TIT{first.state(), range, run_last};
+            return true;
+        }
+
+        unsigned run = 0;
+        if (p == property::aletter || p == property::numeric
+            || p == property::extendnumlet)
+        {
+            run = word_break_bit(property::aletter) |
+                  word_break_bit(property::numeric) |
+                  word_break_bit(property::extendnumlet);
+        } else if (p == property::wsegspace) {
+            run = word_break_bit(property::wsegspace);
+        }
+        auto run_back = run_last;
+        ++run_last;
+        if (run) {
+            for (; run_last != cu_last; run_back = run_last++) {
+                cu = *run_last;
+                if (cu >= 0x80
+                    || ! ((run >> word_break_table::latin[cu]) & 1))
+                {
+                    break;
+                }
+            }
+        }
+        if (run_last != cu_last) {
+            cu = *run_last;
+            if (cu >= 0x80 || (run && joins_following(
+                                   property(word_break_table::latin[cu]))))
+            {
+                first = TIT{first.state(), range, run_back};
+                return false;
+            }
+        }
+        first = TIT{first.state(), range, run_last};
+        return true;
+    }
+
+    // Returns true if an ASCII character with property 'p' might join the
+    // letters or digits that precede it with characters that follow it.
+    static constexpr bool joins_following(word_break_table::property p) {
+        return p == word_break_table::single_quote
+            || p == word_break_table::double_quote
+            || p == word_break_table::midnumlet
+            || p == word_break_table::midletter
+            || p == word_break_table::midnum;
+    }
+};
+
+} // namespace text_detail
+
+
+/*
+ * word_view
+ * A view adapter over a text view that presents the text between adjacent
+ * word boundaries (UAX #29) as a range of text views.  Segments include
+ * words as well as runs of spaces and individual punctuation characters.
+ * The underlying text view must provide forward iterators and its characters
+ * must have Unicode code points.  For text in UTF-8 and related encodings,
+ * segments that consist of ASCII characters are located without decoding.
+ */
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+class word_view
+    : public text_detail::boundary_view<TVT, text_detail::word_break_rules>
+{
+public:
+    using text_detail::boundary_view<
+        TVT, text_detail::word_break_rules>::boundary_view;
+};
+
+
+/*
+ * make_word_view
+ */
+// Constructs a word view over an existing text view.
+template<TextView TVT>
+requires origin::Forward_iterator<origin::Iterator_type<const TVT>>()
+auto make_word_view(
+    TVT tv)
+{
+    return word_view<TVT>{tv};
+}
+
+
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_WORD_VIEW_HPP
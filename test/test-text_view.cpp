@@ -422,6 +422,7 @@ void test_text_encoding_state_models() {
     static_assert(TextEncodingState<utf8bom_encoding_state>());
     static_assert(TextEncodingState<utf16bom_encoding_state>());
     static_assert(TextEncodingState<utf32bom_encoding_state>());
+    static_assert(TextEncodingState<iso_2022_jp_encoding_state>());
 }
 
 void test_text_encoding_state_transition_models() {
@@ -432,6 +433,7 @@ void test_text_encoding_state_transition_models() {
     static_assert(TextEncodingStateTransition<utf8bom_encoding_state_transition>());
     static_assert(TextEncodingStateTransition<utf16bom_encoding_state_transition>());
     static_assert(TextEncodingStateTransition<utf32bom_encoding_state_transition>());
+    static_assert(TextEncodingStateTransition<iso_2022_jp_encoding_state_transition>());
 }
 
 void test_text_encoding_models() {
@@ -455,6 +457,16 @@ void test_text_encoding_models() {
     static_assert(TextEncoding<char8_character_encoding>());
     static_assert(TextEncoding<char16_character_encoding>());
     static_assert(TextEncoding<char32_character_encoding>());
+    static_assert(TextEncoding<iso_8859_1_encoding>());
+    static_assert(TextEncoding<iso_8859_15_encoding>());
+    static_assert(TextEncoding<windows_1252_encoding>());
+    static_assert(TextEncoding<gb18030_encoding>());
+    static_assert(TextEncoding<shift_jis_encoding>());
+    static_assert(TextEncoding<iso_2022_jp_encoding>());
+    static_assert(TextEncoding<cesu8_encoding>());
+    static_assert(TextEncoding<modified_utf8_encoding>());
+    static_assert(TextEncoding<wtf8_encoding>());
+    static_assert(TextEncoding<utf16_lossless_encoding>());
 }
 
 void test_text_encoder_models() {
@@ -520,6 +532,36 @@ void test_text_encoder_models() {
     static_assert(TextEncoder<
                       utf32bom_encoding,
                       char*>());
+    static_assert(TextEncoder<
+                      iso_8859_1_encoding,
+                      char*>());
+    static_assert(TextEncoder<
+                      iso_8859_15_encoding,
+                      char*>());
+    static_assert(TextEncoder<
+                      windows_1252_encoding,
+                      char*>());
+    static_assert(TextEncoder<
+                      gb18030_encoding,
+                      char*>());
+    static_assert(TextEncoder<
+                      shift_jis_encoding,
+                      char*>());
+    static_assert(TextEncoder<
+                      iso_2022_jp_encoding,
+                      char*>());
+    static_assert(TextEncoder<
+                      cesu8_encoding,
+                      char*>());
+    static_assert(TextEncoder<
+                      modified_utf8_encoding,
+                      char*>());
+    static_assert(TextEncoder<
+                      wtf8_encoding,
+                      char*>());
+    static_assert(TextEncoder<
+                      utf16_lossless_encoding,
+                      char16_t*>());
 }
 
 void test_text_decoder_models() {
@@ -585,6 +627,45 @@ void test_text_decoder_models() {
     static_assert(TextBidirectionalDecoder<
                       utf32bom_encoding,
                       char*>());
+    static_assert(TextRandomAccessDecoder<
+                      iso_8859_1_encoding,
+                      char*>());
+    static_assert(TextRandomAccessDecoder<
+                      iso_8859_15_encoding,
+                      char*>());
+    static_assert(TextRandomAccessDecoder<
+                      windows_1252_encoding,
+                      char*>());
+    static_assert(TextForwardDecoder<
+                      gb18030_encoding,
+                      char*>());
+    static_assert(! TextBidirectionalDecoder<
+                      gb18030_encoding,
+                      char*>());
+    static_assert(TextForwardDecoder<
+                      shift_jis_encoding,
+                      char*>());
+    static_assert(! TextBidirectionalDecoder<
+                      shift_jis_encoding,
+                      char*>());
+    static_assert(TextForwardDecoder<
+                      iso_2022_jp_encoding,
+                      char*>());
+    static_assert(! TextBidirectionalDecoder<
+                      iso_2022_jp_encoding,
+                      char*>());
+    static_assert(TextBidirectionalDecoder<
+                      cesu8_encoding,
+                      char*>());
+    static_assert(TextBidirectionalDecoder<
+                      modified_utf8_encoding,
+                      char*>());
+    static_assert(TextBidirectionalDecoder<
+                      wtf8_encoding,
+                      char*>());
+    static_assert(TextBidirectionalDecoder<
+                      utf16_lossless_encoding,
+                      char16_t*>());
 }
 
 void test_text_iterator_models() {
@@ -604,6 +685,14 @@ void test_text_iterator_models() {
     static_assert(TextIterator<itext_iterator<utf32_encoding, char32_t(&)[5]>>());
     static_assert(TextIterator<itext_iterator<utf32be_encoding, char(&)[5]>>());
     static_assert(TextIterator<itext_iterator<utf32le_encoding, char(&)[5]>>());
+    static_assert(TextIterator<itext_iterator<windows_1252_encoding, char(&)[5]>>());
+    static_assert(TextIterator<itext_iterator<gb18030_encoding, char(&)[5]>>());
+    static_assert(TextIterator<itext_iterator<shift_jis_encoding, char(&)[5]>>());
+    static_assert(TextIterator<itext_iterator<iso_2022_jp_encoding, char(&)[5]>>());
+    static_assert(TextIterator<itext_iterator<cesu8_encoding, char(&)[5]>>());
+    static_assert(TextIterator<itext_iterator<modified_utf8_encoding, char(&)[5]>>());
+    static_assert(TextIterator<itext_iterator<wtf8_encoding, char(&)[5]>>());
+    static_assert(TextIterator<itext_iterator<utf16_lossless_encoding, char16_t(&)[5]>>());
 }
 
 void test_text_output_iterator_models() {
@@ -623,6 +712,14 @@ void test_text_output_iterator_models() {
     static_assert(TextOutputIterator<otext_iterator<utf32_encoding, char32_t*>>());
     static_assert(TextOutputIterator<otext_iterator<utf32be_encoding, char*>>());
     static_assert(TextOutputIterator<otext_iterator<utf32le_encoding, char*>>());
+    static_assert(TextOutputIterator<otext_iterator<windows_1252_encoding, char*>>());
+    static_assert(TextOutputIterator<otext_iterator<gb18030_encoding, char*>>());
+    static_assert(TextOutputIterator<otext_iterator<shift_jis_encoding, char*>>());
+    static_assert(TextOutputIterator<otext_iterator<iso_2022_jp_encoding, char*>>());
+    static_assert(TextOutputIterator<otext_iterator<cesu8_encoding, char*>>());
+    static_assert(TextOutputIterator<otext_iterator<modified_utf8_encoding, char*>>());
+    static_assert(TextOutputIterator<otext_iterator<wtf8_encoding, char*>>());
+    static_assert(TextOutputIterator<otext_iterator<utf16_lossless_encoding, char16_t*>>());
 }
 
 void test_text_view_models() {
@@ -1092,6 +1189,38 @@ void test_random_decode(
     assert(tvit == end(tv));
 }
 
+// Test decoding of the code unit sequences present in the 'code_unit_maps'
+// sequence using an input text iterator with an underlying input iterator.
+// Encodings that must look ahead to decode a character, and so do not model
+// TextDecoder for input iterators, are not tested.
+template<TextEncoding ET>
+void test_input_iterator_decode(
+    const code_unit_map_sequence<ET> &code_unit_maps)
+{}
+
+template<TextEncoding ET>
+requires TextDecoder<
+             ET,
+             input_iterator<
+                 typename forward_list<code_unit_type_t<ET>>::const_iterator>>()
+void test_input_iterator_decode(
+    const code_unit_map_sequence<ET> &code_unit_maps)
+{
+    using code_unit_type = code_unit_type_t<ET>;
+
+    forward_list<code_unit_type> container;
+    auto insert_it = container.before_begin();
+    for (const auto &cum : code_unit_maps) {
+        for (const auto &cu : cum.code_units) {
+            insert_it = container.insert_after(insert_it, cu);
+        }
+    }
+    auto input_container =
+        input_range_view<forward_list<code_unit_type>>{container};
+    auto tv = make_text_view<ET>(input_container);
+    test_forward_decode(code_unit_maps, input_container, tv);
+}
+
 // Test forward encoding and decoding of the state transitions, characters, and
 // code unit sequences present in the 'code_unit_maps' sequence for the
 // character encoding specified by 'ET'.  This test exercises encoding and
@@ -1153,19 +1282,7 @@ void test_forward_encoding(
 
 
     // Test itext_iterator with an underlying input iterator.
-    {
-    forward_list<code_unit_type> container;
-    auto insert_it = container.before_begin();
-    for (const auto &cum : code_unit_maps) {
-        for (const auto &cu : cum.code_units) {
-            insert_it = container.insert_after(insert_it, cu);
-        }
-    }
-    auto input_container =
-        input_range_view<forward_list<code_unit_type>>{container};
-    auto tv = make_text_view<ET>(input_container);
-    test_forward_decode(code_unit_maps, input_container, tv);
-    }
+    test_input_iterator_decode<ET>(code_unit_maps);
 
     // Test itext_iterator with an underlying forward iterator.
     {
@@ -2309,6 +2426,1721 @@ void test_utf32bom_encoding() {
     }
 }
 
+void test_iso_8859_1_encoding() {
+    using ET = iso_8859_1_encoding;
+    using CT = character_type_t<ET>;
+    using CUT = code_unit_type_t<ET>;
+    using CUMS = code_unit_map_sequence<ET>;
+
+    // Test an empty code unit sequence.
+    CUMS code_unit_maps_empty{};
+    test_random_access_encoding<ET>(code_unit_maps_empty);
+
+    // Test a non-empty code unit sequence.
+    CUMS code_unit_maps{
+        { {}, { CT{U'\U00000041'} }, { CUT(0x41) } },
+        { {}, { CT{U'\U00000080'} }, { CUT(0x80) } },
+        { {}, { CT{U'\U000000A4'} }, { CUT(0xA4) } },
+        { {}, { CT{U'\U000000FF'} }, { CUT(0xFF) } },
+        { {}, { CT{U'\0'} },         { CUT(0x00) } } };
+    test_random_access_encoding<ET>(code_unit_maps);
+
+    // Code points outside of Latin-1 are not encodable.
+    string encoded_string(1, '\0');
+    auto it = make_otext_iterator<ET>(begin(encoded_string));
+    bool caught = false;
+    try {
+        *it++ = CT{U'\U00000141'};
+    } catch (const text_encode_error&) {
+        caught = true;
+    }
+    assert(caught);
+}
+
+void test_iso_8859_15_encoding() {
+    using ET = iso_8859_15_encoding;
+    using CT = character_type_t<ET>;
+    using CUT = code_unit_type_t<ET>;
+    using CUMS = code_unit_map_sequence<ET>;
+
+    // Test a non-empty code unit sequence.  0xA4 encodes the euro sign rather
+    // than the currency sign of ISO-8859-1.
+    CUMS code_unit_maps{
+        { {}, { CT{U'\U00000041'} }, { CUT(0x41) } },
+        { {}, { CT{U'\U000020AC'} }, { CUT(0xA4) } },
+        { {}, { CT{U'\U00000160'} }, { CUT(0xA6) } },
+        { {}, { CT{U'\U00000178'} }, { CUT(0xBE) } },
+        { {}, { CT{U'\U000000FF'} }, { CUT(0xFF) } },
+        { {}, { CT{U'\0'} },         { CUT(0x00) } } };
+    test_random_access_encoding<ET>(code_unit_maps);
+
+    string encoded_string("a\xA4z");
+    auto tv = make_text_view<ET>(encoded_string);
+    static_assert(origin::Iterator<decltype(end(tv))>());
+    auto tvit = find(begin(tv), end(tv), CT{U'\U000020AC'});
+    assert(begin(tvit.base_range()) == begin(encoded_string) + 1);
+    assert(end(tvit.base_range()) == begin(encoded_string) + 2);
+}
+
+void test_windows_1252_encoding() {
+    using ET = windows_1252_encoding;
+    using CT = character_type_t<ET>;
+    using CUT = code_unit_type_t<ET>;
+    using CUMS = code_unit_map_sequence<ET>;
+
+    // Test an empty code unit sequence.
+    CUMS code_unit_maps_empty{};
+    test_random_access_encoding<ET>(code_unit_maps_empty);
+
+    // Test a non-empty code unit sequence.
+    CUMS code_unit_maps{
+        { {}, { CT{U'\U00000041'} }, { CUT(0x41) } },
+        { {}, { CT{U'\U000020AC'} }, { CUT(0x80) } },
+        { {}, { CT{U'\U00002122'} }, { CUT(0x99) } },
+        { {}, { CT{U'\U000000E9'} }, { CUT(0xE9) } },
+        { {}, { CT{U'\0'} },         { CUT(0x00) } } };
+    test_random_access_encoding<ET>(code_unit_maps);
+
+    // 0x81 is not mapped by Windows-1252.
+    {
+    string encoded_string("a\x81");
+    auto tv = make_text_view<ET>(encoded_string);
+    bool caught = false;
+    try {
+        for (auto tvit = begin(tv); tvit != end(tv); ++tvit) {}
+    } catch (const text_decode_error&) {
+        caught = true;
+    }
+    assert(caught);
+    }
+
+    // Test bulk decoding with inputs long enough to exercise vectorized code
+    // paths, including blocks with and without non-ASCII code units.
+    {
+    string encoded_string;
+    u32string expected_utf32;
+    for (int i = 0; i < 40; ++i) {
+        encoded_string += "ASCII only text!";
+        expected_utf32 += U"ASCII only text!";
+        encoded_string += "caf\xE9 \x80 \x93quoted\x94";
+        expected_utf32 += U"caf\u00E9 \u20AC \u201Cquoted\u201D";
+    }
+    u32string utf32(encoded_string.size(), U'\0');
+    char32_t *utf32_end = ET::decode_to_utf32(
+        encoded_string.data(),
+        encoded_string.data() + encoded_string.size(),
+        &utf32[0]);
+    utf32.resize(utf32_end - utf32.data());
+    assert(utf32 == expected_utf32);
+
+    string utf8(3 * encoded_string.size(), '\0');
+    char *utf8_end = ET::decode_to_utf8(
+        encoded_string.data(),
+        encoded_string.data() + encoded_string.size(),
+        &utf8[0]);
+    utf8.resize(utf8_end - utf8.data());
+    string expected_utf8;
+    auto expected_it = make_otext_iterator<utf8_encoding>(
+        back_inserter(expected_utf8));
+    for (auto c : expected_utf32) {
+        *expected_it++ = CT{c};
+    }
+    assert(utf8 == expected_utf8);
+
+    encoded_string += "\x81";
+    bool caught = false;
+    try {
+        ET::decode_to_utf8(
+            encoded_string.data(),
+            encoded_string.data() + encoded_string.size(),
+            &utf8[0]);
+    } catch (const text_decode_error&) {
+        caught = true;
+    }
+    assert(caught);
+    }
+}
+
+void test_gb18030_encoding() {
+    using ET = gb18030_encoding;
+    using CT = character_type_t<ET>;
+    using CUT = code_unit_type_t<ET>;
+    using CUMS = code_unit_map_sequence<ET>;
+
+    // Test an empty code unit sequence.
+    CUMS code_unit_maps_empty{};
+    test_forward_encoding<ET>(code_unit_maps_empty);
+
+    // Test a non-empty code unit sequence.  Each of the one, two, and four
+    // code unit forms is represented, including the bounds of the four code
+    // unit BMP ranges and of the supplementary planes.
+    CUMS code_unit_maps{
+        { {}, { CT{U'\U00000041'} }, { CUT(0x41) } },
+        { {}, { CT{U'\U00004E2D'} }, { CUT(0xD6), CUT(0xD0) } },
+        { {}, { CT{U'\U000020AC'} }, { CUT(0xA2), CUT(0xE3) } },
+        { {}, { CT{U'\U000000E9'} }, { CUT(0xA8), CUT(0xA6) } },
+        { {}, { CT{U'\U00000080'} }, { CUT(0x81), CUT(0x30), CUT(0x81), CUT(0x30) } },
+        { {}, { CT{U'\U0000FFFF'} }, { CUT(0x84), CUT(0x31), CUT(0xA4), CUT(0x39) } },
+        { {}, { CT{U'\U00010000'} }, { CUT(0x90), CUT(0x30), CUT(0x81), CUT(0x30) } },
+        { {}, { CT{U'\U0010FFFF'} }, { CUT(0xE3), CUT(0x32), CUT(0x9A), CUT(0x35) } },
+        { {}, { CT{U'\0'} },         { CUT(0x00) } } };
+    test_forward_encoding<ET>(code_unit_maps);
+
+    // Four code unit sequences between the BMP and supplementary ranges are
+    // not mapped.
+    {
+    string encoded_string("a\x85\x30\x81\x30");
+    auto tv = make_text_view<ET>(encoded_string);
+    bool caught = false;
+    try {
+        for (auto tvit = begin(tv); tvit != end(tv); ++tvit) {}
+    } catch (const text_decode_error&) {
+        caught = true;
+    }
+    assert(caught);
+    }
+
+    // Test bulk decoding to UTF-8.
+    {
+    string encoded_string;
+    u32string expected_utf32;
+    for (int i = 0; i < 40; ++i) {
+        encoded_string += "ASCII only text!";
+        expected_utf32 += U"ASCII only text!";
+        encoded_string += "\xD6\xD0\xCE\xC4 \xA2\xE3\x81\x30\x81\x30\x90\x30\x81\x30.";
+        expected_utf32 += U"\u4E2D\u6587 \u20AC\u0080\U00010000.";
+    }
+    string utf8(2 * encoded_string.size(), '\0');
+    char *utf8_end = ET::decode_to_utf8(
+        encoded_string.data(),
+        encoded_string.data() + encoded_string.size(),
+        &utf8[0]);
+    utf8.resize(utf8_end - utf8.data());
+    string expected_utf8;
+    auto expected_it = make_otext_iterator<utf8_encoding>(
+        back_inserter(expected_utf8));
+    for (auto c : expected_utf32) {
+        *expected_it++ = CT{c};
+    }
+    assert(utf8 == expected_utf8);
+
+    // A truncated trailing sequence is an underflow.
+    encoded_string += "\x81\x30";
+    bool caught = false;
+    try {
+        ET::decode_to_utf8(
+            encoded_string.data(),
+            encoded_string.data() + encoded_string.size(),
+            &utf8[0]);
+    } catch (const text_decode_underflow_error&) {
+        caught = true;
+    }
+    assert(caught);
+    }
+}
+
+void test_shift_jis_encoding() {
+    using ET = shift_jis_encoding;
+    using CT = character_type_t<ET>;
+    using CUT = code_unit_type_t<ET>;
+    using CUMS = code_unit_map_sequence<ET>;
+
+    // Test an empty code unit sequence.
+    CUMS code_unit_maps_empty{};
+    test_forward_encoding<ET>(code_unit_maps_empty);
+
+    // Test a non-empty code unit sequence.
+    CUMS code_unit_maps{
+        { {}, { CT{U'\U00000041'} }, { CUT(0x41) } },
+        { {}, { CT{U'\U0000FF71'} }, { CUT(0xB1) } },
+        { {}, { CT{U'\U00003042'} }, { CUT(0x82), CUT(0xA0) } },
+        { {}, { CT{U'\U00006F22'} }, { CUT(0x8A), CUT(0xBF) } },
+        { {}, { CT{U'\U0000FF3C'} }, { CUT(0x81), CUT(0x5F) } },
+        { {}, { CT{U'\U00007199'} }, { CUT(0xEA), CUT(0xA4) } },
+        { {}, { CT{U'\0'} },         { CUT(0x00) } } };
+    test_forward_encoding<ET>(code_unit_maps);
+
+    // Code points outside of JIS X 0201 and JIS X 0208 are not encodable.
+    {
+    string encoded_string(2, '\0');
+    auto it = make_otext_iterator<ET>(begin(encoded_string));
+    bool caught = false;
+    try {
+        *it++ = CT{U'\U00009ED1'};
+    } catch (const text_encode_error&) {
+        caught = true;
+    }
+    assert(caught);
+    }
+
+    // Test bulk decoding to UTF-8.
+    {
+    string encoded_string;
+    u32string expected_utf32;
+    for (int i = 0; i < 40; ++i) {
+        encoded_string += "ASCII only text!";
+        expected_utf32 += U"ASCII only text!";
+        encoded_string += "\x82\xA0\x8A\xBF \xB1\xDF.";
+        expected_utf32 += U"\u3042\u6F22 \uFF71\uFF9F.";
+    }
+    string utf8(3 * encoded_string.size(), '\0');
+    char *utf8_end = ET::decode_to_utf8(
+        encoded_string.data(),
+        encoded_string.data() + encoded_string.size(),
+        &utf8[0]);
+    utf8.resize(utf8_end - utf8.data());
+    string expected_utf8;
+    auto expected_it = make_otext_iterator<utf8_encoding>(
+        back_inserter(expected_utf8));
+    for (auto c : expected_utf32) {
+        *expected_it++ = CT{c};
+    }
+    assert(utf8 == expected_utf8);
+
+    // 0xA0 is neither a single code unit nor a lead code unit.
+    encoded_string += "\xA0";
+    bool caught = false;
+    try {
+        ET::decode_to_utf8(
+            encoded_string.data(),
+            encoded_string.data() + encoded_string.size(),
+            &utf8[0]);
+    } catch (const text_decode_error&) {
+        caught = true;
+    }
+    assert(caught);
+    }
+}
+
+void test_iso_2022_jp_encoding() {
+    using ET = iso_2022_jp_encoding;
+    using CT = character_type_t<ET>;
+    using CUT = code_unit_type_t<ET>;
+    using STT = ET::state_transition_type;
+    using CUMS = code_unit_map_sequence<ET>;
+
+    // Test an empty code unit sequence.
+    CUMS code_unit_maps_empty{};
+    test_forward_encoding<ET>(code_unit_maps_empty);
+
+    // Test a code unit sequence containing only escape sequences.  State
+    // transitions to the current state do not encode an escape sequence.
+    CUMS code_unit_maps_only_escapes{
+        { { STT::to_initial_state() },
+              {}, {} },
+        { { STT::to_jis_x_0208_state() },
+              {}, { CUT(0x1B), CUT(0x24), CUT(0x42) } },
+        { { STT::to_initial_state() },
+              {}, { CUT(0x1B), CUT(0x28), CUT(0x42) } } };
+    test_forward_encoding<ET>(code_unit_maps_only_escapes);
+
+    // Test a code unit sequence that switches between each character set.
+    CUMS code_unit_maps{
+        { {}, { CT{U'\U00000041'} }, { CUT(0x41) } },
+        { { STT::to_jis_x_0208_state() },
+              {},                    { CUT(0x1B), CUT(0x24), CUT(0x42) } },
+        { {}, { CT{U'\U00003042'} }, { CUT(0x24), CUT(0x22) } },
+        { {}, { CT{U'\U00006F22'} }, { CUT(0x34), CUT(0x41) } },
+        { { STT::to_jis_x_0201_roman_state() },
+              {},                    { CUT(0x1B), CUT(0x28), CUT(0x4A) } },
+        { {}, { CT{U'\U000000A5'} }, { CUT(0x5C) } },
+        { {}, { CT{U'\U00000061'} }, { CUT(0x61) } },
+        { { STT::to_initial_state() },
+              {},                    { CUT(0x1B), CUT(0x28), CUT(0x42) } },
+        { {}, { CT{U'\U0000005C'} }, { CUT(0x5C) } },
+        { {}, { CT{U'\0'} },         { CUT(0x00) } } };
+    test_forward_encoding<ET>(code_unit_maps);
+
+    // Encoding a character that is not in the current character set writes
+    // an escape sequence first.
+    {
+    string encoded_string;
+    auto it = make_otext_iterator<ET>(back_inserter(encoded_string));
+    *it++ = CT{U'a'};
+    *it++ = CT{U'\U00003042'};
+    *it++ = CT{U'\U00003044'};
+    *it++ = CT{U'\n'};
+    *it++ = CT{U'\U000000A5'};
+    *it++ = STT::to_initial_state();
+    assert(encoded_string == "a\x1B$B$\"$$\x1B(B\n\x1B(J\\\x1B(B");
+    }
+
+    // Escape sequences decode to no character and are not included in the
+    // code unit range of the following character.
+    {
+    string encoded_string("a\x1B$B$\"\x1B(Bz");
+    auto tv = make_text_view<ET>(encoded_string);
+    static_assert(! origin::Iterator<decltype(end(tv))>());
+    auto tvend = text_detail::advance_to(begin(tv), end(tv));
+    auto tvit = find(begin(tv), tvend, CT{U'\U00003042'});
+    assert(begin(tvit.base_range()) == begin(encoded_string) + 4);
+    assert(end(tvit.base_range()) == begin(encoded_string) + 6);
+    tvit = find(begin(tv), tvend, CT{U'z'});
+    assert(begin(tvit.base_range()) == begin(encoded_string) + 9);
+    assert(end(tvit.base_range()) == begin(encoded_string) + 10);
+    }
+
+    // Unrecognized escape sequences are invalid.
+    {
+    string encoded_string("a\x1B$Ab");
+    auto tv = make_text_view<ET>(encoded_string);
+    bool caught = false;
+    try {
+        for (auto tvit = begin(tv); tvit != end(tv); ++tvit) {}
+    } catch (const text_decode_error&) {
+        caught = true;
+    }
+    assert(caught);
+    }
+
+    // Test bulk decoding to UTF-8, including resuming in the state left by a
+    // previous call.
+    {
+    string encoded_string;
+    u32string expected_utf32;
+    for (int i = 0; i < 40; ++i) {
+        encoded_string += "ASCII only text!";
+        expected_utf32 += U"ASCII only text!";
+        encoded_string += "\x1B$B$\"4A$\"4A$\"4A$\"4A\x1B(J\\~\x1B(B.\n";
+        expected_utf32 += U"\u3042\u6F22\u3042\u6F22\u3042\u6F22\u3042\u6F22"
+                          U"\u00A5\u203E.\n";
+    }
+    string expected_utf8;
+    auto expected_it = make_otext_iterator<utf8_encoding>(
+        back_inserter(expected_utf8));
+    for (auto c : expected_utf32) {
+        *expected_it++ = CT{c};
+    }
+
+    string utf8(3 * encoded_string.size(), '\0');
+    char *utf8_end = ET::decode_to_utf8(
+        encoded_string.data(),
+        encoded_string.data() + encoded_string.size(),
+        &utf8[0]);
+    utf8.resize(utf8_end - utf8.data());
+    assert(utf8 == expected_utf8);
+
+    ET::state_type state = ET::initial_state();
+    std::size_t split = encoded_string.find('4') + 1;
+    utf8.assign(3 * encoded_string.size(), '\0');
+    utf8_end = ET::decode_to_utf8(
+        state,
+        encoded_string.data(),
+        encoded_string.data() + split - 1,
+        &utf8[0]);
+    assert(state.charset == ET::state_type::jis_x_0208);
+    utf8_end = ET::decode_to_utf8(
+        state,
+        encoded_string.data() + split - 1,
+        encoded_string.data() + encoded_string.size(),
+        utf8_end);
+    utf8.resize(utf8_end - utf8.data());
+    assert(utf8 == expected_utf8);
+    assert(state.charset == ET::state_type::ascii);
+    }
+
+    // JIS X 0201 Roman 0x7E decodes to three UTF-8 code units; a run of them
+    // fills a buffer of exactly the documented size.
+    {
+    string encoded_string = "\x1B(J";
+    string expected_utf8;
+    for (int i = 0; i < 100; ++i) {
+        encoded_string += '~';
+        expected_utf8 += "\xE2\x80\xBE";
+    }
+    encoded_string += "\x1B(B";
+    vector<char> utf8(3 * encoded_string.size());
+    char *utf8_end = ET::decode_to_utf8(
+        encoded_string.data(),
+        encoded_string.data() + encoded_string.size(),
+        utf8.data());
+    assert(string(utf8.data(), utf8_end) == expected_utf8);
+    }
+}
+
+void test_cesu8_encoding() {
+    using ET = cesu8_encoding;
+    using CT = character_type_t<ET>;
+    using CUT = code_unit_type_t<ET>;
+    using CUMS = code_unit_map_sequence<ET>;
+
+    // Test an empty code unit sequence.
+    CUMS code_unit_maps_empty{};
+    test_bidirectional_encoding<ET>(code_unit_maps_empty);
+
+    // Test a non-empty code unit sequence.
+    CUMS code_unit_maps{
+        { {}, { CT{U'\U00000041'} }, { CUT(0x41) } },
+        { {}, { CT{U'\U00000141'} }, { CUT(0xC5), CUT(0x81) } },
+        { {}, { CT{U'\U00001141'} }, { CUT(0xE1), CUT(0x85), CUT(0x81) } },
+        { {}, { CT{U'\U00011141'} }, { CUT(0xED), CUT(0xA0), CUT(0x84),
+                                       CUT(0xED), CUT(0xB5), CUT(0x81) } },
+        { {}, { CT{U'\0'} },         { CUT(0x00) } } };
+    test_bidirectional_encoding<ET>(code_unit_maps);
+
+    // Unpaired surrogates, four code unit sequences, and overlong sequences
+    // are not decodable in either direction.
+    for (string invalid : { "\xED\xA0\x84", "\xED\xB5\x81",
+                            "\xF0\x91\x85\x81", "\xC0\x80" })
+    {
+        string encoded_string = invalid + ".";
+        bool caught = false;
+        try {
+            auto tv = make_text_view<ET>(encoded_string);
+            *begin(tv);
+        } catch (const text_decode_error&) {
+            caught = true;
+        }
+        assert(caught);
+        encoded_string = "." + invalid;
+        caught = false;
+        try {
+            auto tv = make_text_view<ET>(encoded_string);
+            auto it = end(tv);
+            *--it;
+        } catch (const text_decode_error&) {
+            caught = true;
+        }
+        assert(caught);
+    }
+
+    // Test bulk transcoding to and from UTF-8.
+    {
+    u32string utf32;
+    for (int i = 0; i < 40; ++i) {
+        utf32 += U"ASCII only text!";
+        utf32 += U"\u00E9\u3042 \U00011141.";
+    }
+    string utf8;
+    auto utf8_it = make_otext_iterator<utf8_encoding>(back_inserter(utf8));
+    string encoded_string;
+    auto encoded_it = make_otext_iterator<ET>(back_inserter(encoded_string));
+    for (auto c : utf32) {
+        *utf8_it++ = CT{c};
+        *encoded_it++ = CT{c};
+    }
+
+    string encoded(2 * utf8.size(), '\0');
+    char *encoded_end = ET::encode_from_utf8(
+        utf8.data(), utf8.data() + utf8.size(), &encoded[0]);
+    encoded.resize(encoded_end - encoded.data());
+    assert(encoded == encoded_string);
+
+    // Transcode to UTF-8 in place.
+    char *decoded_end = ET::decode_to_utf8(
+        encoded.data(), encoded.data() + encoded.size(), &encoded[0]);
+    encoded.resize(decoded_end - encoded.data());
+    assert(encoded == utf8);
+
+    // A high surrogate must be followed by a low surrogate.
+    encoded_string += "\xED\xA0\x84.";
+    bool caught = false;
+    try {
+        ET::decode_to_utf8(
+            encoded_string.data(),
+            encoded_string.data() + encoded_string.size(),
+            &encoded_string[0]);
+    } catch (const text_decode_error&) {
+        caught = true;
+    }
+    assert(caught);
+    }
+}
+
+void test_modified_utf8_encoding() {
+    using ET = modified_utf8_encoding;
+    using CT = character_type_t<ET>;
+    using CUT = code_unit_type_t<ET>;
+    using CUMS = code_unit_map_sequence<ET>;
+
+    // Test an empty code unit sequence.
+    CUMS code_unit_maps_empty{};
+    test_bidirectional_encoding<ET>(code_unit_maps_empty);
+
+    // Test a non-empty code unit sequence.
+    CUMS code_unit_maps{
+        { {}, { CT{U'\U00000041'} }, { CUT(0x41) } },
+        { {}, { CT{U'\0'} },         { CUT(0xC0), CUT(0x80) } },
+        { {}, { CT{U'\U00000141'} }, { CUT(0xC5), CUT(0x81) } },
+        { {}, { CT{U'\U00001141'} }, { CUT(0xE1), CUT(0x85), CUT(0x81) } },
+        { {}, { CT{U'\U00011141'} }, { CUT(0xED), CUT(0xA0), CUT(0x84),
+                                       CUT(0xED), CUT(0xB5), CUT(0x81) } } };
+    test_bidirectional_encoding<ET>(code_unit_maps);
+
+    // A lone 0x00 code unit is accepted when decoding.
+    {
+    string encoded_string("a\0z", 3);
+    auto tv = make_text_view<ET>(encoded_string);
+    auto tvit = next(begin(tv));
+    assert(*tvit == CT{U'\0'});
+    assert(begin(tvit.base_range()) == begin(encoded_string) + 1);
+    assert(end(tvit.base_range()) == begin(encoded_string) + 2);
+    }
+
+    // Test bulk transcoding to and from UTF-8; NUL code units within
+    // otherwise ASCII blocks are encoded as two code units.
+    {
+    string utf8;
+    string expected;
+    for (int i = 0; i < 40; ++i) {
+        utf8 += string("ASCII\0only text!", 16);
+        expected += string("ASCII\xC0\x80only text!", 17);
+        utf8 += "\xC3\xA9\xF0\x91\x85\x81";
+        expected += "\xC3\xA9\xED\xA0\x84\xED\xB5\x81";
+    }
+    string encoded(2 * utf8.size(), '\0');
+    char *encoded_end = ET::encode_from_utf8(
+        utf8.data(), utf8.data() + utf8.size(), &encoded[0]);
+    encoded.resize(encoded_end - encoded.data());
+    assert(encoded == expected);
+
+    char *decoded_end = ET::decode_to_utf8(
+        encoded.data(), encoded.data() + encoded.size(), &encoded[0]);
+    encoded.resize(decoded_end - encoded.data());
+    assert(encoded == utf8);
+
+    // Invalid UTF-8 is rejected when encoding.
+    utf8 += "\xC0\x80";
+    bool caught = false;
+    try {
+        ET::encode_from_utf8(
+            utf8.data(), utf8.data() + utf8.size(), &encoded[0]);
+    } catch (const text_decode_error&) {
+        caught = true;
+    }
+    assert(caught);
+    }
+}
+
+void test_wtf8_encoding() {
+    using ET = wtf8_encoding;
+    using CT = character_type_t<ET>;
+    using CUT = code_unit_type_t<ET>;
+    using CUMS = code_unit_map_sequence<ET>;
+
+    // Test an empty code unit sequence.
+    CUMS code_unit_maps_empty{};
+    test_bidirectional_encoding<ET>(code_unit_maps_empty);
+
+    // Test a non-empty code unit sequence including unpaired surrogates.
+    CUMS code_unit_maps{
+        { {}, { CT{U'\U00000041'} }, { CUT(0x41) } },
+        { {}, { CT{U'\U00000141'} }, { CUT(0xC5), CUT(0x81) } },
+        { {}, { CT{0xD800} },         { CUT(0xED), CUT(0xA0), CUT(0x80) } },
+        { {}, { CT{U'\U00001141'} }, { CUT(0xE1), CUT(0x85), CUT(0x81) } },
+        { {}, { CT{0xDFFF} },         { CUT(0xED), CUT(0xBF), CUT(0xBF) } },
+        { {}, { CT{U'\U00011141'} }, { CUT(0xF0), CUT(0x91), CUT(0x85), CUT(0x81) } },
+        { {}, { CT{U'\0'} },         { CUT(0x00) } } };
+    test_bidirectional_encoding<ET>(code_unit_maps);
+
+    // Overlong sequences and code points above U+10FFFF are not decodable in
+    // either direction.
+    for (string invalid : { "\xC0\x80", "\xE0\x80\x80",
+                            "\xF0\x80\x80\x80", "\xF4\x90\x80\x80" })
+    {
+        bool caught = false;
+        try {
+            auto tv = make_text_view<ET>(invalid);
+            *begin(tv);
+        } catch (const text_decode_error&) {
+            caught = true;
+        }
+        assert(caught);
+        caught = false;
+        try {
+            auto tv = make_text_view<ET>(invalid);
+            auto it = end(tv);
+            *--it;
+        } catch (const text_decode_error&) {
+            caught = true;
+        }
+        assert(caught);
+    }
+
+    // Test bulk transcoding to and from UTF-16 with unpaired surrogates.
+    {
+    u16string utf16;
+    for (int i = 0; i < 40; ++i) {
+        utf16 += u"ASCII only text!";
+        utf16 += u"\u00E9\U00011141";
+        utf16 += char16_t(0xD800);
+        utf16 += u"x";
+        utf16 += char16_t(0xDC00);
+    }
+    string expected;
+    auto expected_it = make_otext_iterator<ET>(back_inserter(expected));
+    for (auto c : make_text_view<utf16_lossless_encoding>(utf16)) {
+        *expected_it++ = c;
+    }
+    string encoded(3 * utf16.size(), '\0');
+    char *encoded_end = ET::encode_from_utf16(
+        utf16.data(), utf16.data() + utf16.size(), &encoded[0]);
+    encoded.resize(encoded_end - encoded.data());
+    assert(encoded == expected);
+
+    u16string decoded(encoded.size(), u'\0');
+    char16_t *decoded_end = ET::decode_to_utf16(
+        encoded.data(), encoded.data() + encoded.size(), &decoded[0]);
+    decoded.resize(decoded_end - decoded.data());
+    assert(decoded == utf16);
+    }
+}
+
+void test_utf16_lossless_encoding() {
+    using ET = utf16_lossless_encoding;
+    using CT = character_type_t<ET>;
+    using CUT = code_unit_type_t<ET>;
+    using CUMS = code_unit_map_sequence<ET>;
+
+    // Test an empty code unit sequence.
+    CUMS code_unit_maps_empty{};
+    test_bidirectional_encoding<ET>(code_unit_maps_empty);
+
+    // Test a non-empty code unit sequence including unpaired surrogates.
+    CUMS code_unit_maps{
+        { {}, { CT{U'\U00000041'} }, { CUT(0x0041) } },
+        { {}, { CT{0xDC00} },         { CUT(0xDC00) } },
+        { {}, { CT{U'\U00011141'} }, { CUT(0xD804), CUT(0xDD41) } },
+        { {}, { CT{0xD800} },         { CUT(0xD800) } },
+        { {}, { CT{U'\U0000FFFF'} }, { CUT(0xFFFF) } },
+        { {}, { CT{0xDBFF} },         { CUT(0xDBFF) } } };
+    test_bidirectional_encoding<ET>(code_unit_maps);
+
+    // Runs of surrogate code units decode identically in both directions and
+    // re-encode to the original code units.
+    u16string encoded_string{
+        char16_t(0xD800), char16_t(0xD800), char16_t(0xDC00),
+        char16_t(0xDC00), char16_t(0xDBFF) };
+    auto tv = make_text_view<ET>(encoded_string);
+    u32string forward;
+    for (auto c : tv) {
+        forward += c.get_code_point();
+    }
+    assert(forward == (u32string{ 0xD800, 0x10000, 0xDC00, 0xDBFF }));
+    u32string reverse;
+    for (auto it = end(tv); it != begin(tv); ) {
+        reverse.insert(reverse.begin(), (*--it).get_code_point());
+    }
+    assert(reverse == forward);
+    u16string reencoded;
+    auto out = make_otext_iterator<ET>(back_inserter(reencoded));
+    for (auto c : tv) {
+        *out++ = c;
+    }
+    assert(reencoded == encoded_string);
+}
+
+// Returns the code points of each segment of the segmentation view 'sv'.
+template<typename SVT>
+vector<u32string> segment_code_points(const SVT &sv) {
+    vector<u32string> segments;
+    for (auto segment : sv) {
+        u32string code_points;
+        for (auto c : segment) {
+            code_points += c.get_code_point();
+        }
+        segments.push_back(code_points);
+    }
+    return segments;
+}
+
+// Returns the code points of each grapheme cluster of 'text'.
+vector<u32string> grapheme_clusters(const u32string &text) {
+    return segment_code_points(make_grapheme_view(u32text_view{text}));
+}
+
+// Returns the code points of each word segment of 'text'.
+vector<u32string> word_segments(const u32string &text) {
+    return segment_code_points(make_word_view(u32text_view{text}));
+}
+
+// Returns the code points of each sentence of 'text'.
+vector<u32string> sentences(const u32string &text) {
+    return segment_code_points(make_sentence_view(u32text_view{text}));
+}
+
+// Returns the code points of the text between the line break opportunities
+// of 'text'.
+vector<u32string> line_break_segments(const u32string &text) {
+    return segment_code_points(make_line_break_view(u32text_view{text}));
+}
+
+void test_grapheme_view() {
+    using clusters = vector<u32string>;
+
+    // Empty text has no grapheme clusters.
+    assert(grapheme_clusters(U"").empty());
+
+    // GB3, GB4, GB5: CR LF is a single cluster; controls stand alone.
+    assert(grapheme_clusters(U"a\r\n\n\r\u0301b")
+           == (clusters{ U"a", U"\r\n", U"\n", U"\r", U"\u0301", U"b" }));
+
+    // GB6, GB7, GB8: Hangul syllable sequences.
+    assert(grapheme_clusters(U"\u1100\u1161\u11A8\uAC00\u11A8\uAC01\u1100\u11A8")
+           == (clusters{ U"\u1100\u1161\u11A8", U"\uAC00\u11A8",
+                         U"\uAC01", U"\u1100", U"\u11A8" }));
+
+    // GB9, GB9a, GB9b: extenders, spacing marks, and prepended concatenation
+    // marks.
+    assert(grapheme_clusters(U"e\u0301\u200Dx\u0915\u093F\u0600\u0661\u0600")
+           == (clusters{ U"e\u0301\u200D", U"x", U"\u0915\u093F",
+                         U"\u0600\u0661", U"\u0600" }));
+
+    // GB11: emoji ZWJ sequences join; a ZWJ not preceded by a pictograph
+    // does not.
+    assert(grapheme_clusters(
+               U"\U0001F469\u200D\u2764\uFE0F\u200D\U0001F48B"
+               U"a\u200D\U0001F48B")
+           == (clusters{
+                   U"\U0001F469\u200D\u2764\uFE0F\u200D\U0001F48B",
+                   U"a\u200D", U"\U0001F48B" }));
+
+    // GB12, GB13: regional indicators pair up.
+    assert(grapheme_clusters(
+               U"\U0001F1FA\U0001F1F8\U0001F1EB\U0001F1F7\U0001F1E9"
+               U"\u0301\U0001F1EA")
+           == (clusters{ U"\U0001F1FA\U0001F1F8", U"\U0001F1EB\U0001F1F7",
+                         U"\U0001F1E9\u0301", U"\U0001F1EA" }));
+
+    // Grapheme clusters of a UTF-8 text view are text views over the
+    // underlying code units.
+    string encoded_string{u8"n\u0303o\U0001F44D\U0001F3FD!"};
+    auto tv = make_text_view<utf8_encoding>(encoded_string);
+    vector<string> code_units;
+    for (auto cluster : make_grapheme_view(tv)) {
+        code_units.emplace_back(begin(cluster).base(), end(cluster).base());
+    }
+    assert(code_units == (vector<string>{
+               u8"n\u0303", u8"o", u8"\U0001F44D\U0001F3FD", u8"!" }));
+}
+
+void test_word_view() {
+    using segments = vector<u32string>;
+
+    assert(word_segments(U"").empty());
+
+    // WB3 - WB3d: line breaks, emoji ZWJ sequences, and runs of spaces.
+    assert(word_segments(U"a\r\n\r\n  \u200D\U0001F6D1\n\u0301")
+           == (segments{ U"a", U"\r\n", U"\r\n", U"  \u200D\U0001F6D1",
+                         U"\n", U"\u0301" }));
+
+    // WB4 - WB13b: letters, digits, and connecting punctuation.
+    assert(word_segments(
+               U"Can't stop 3.14 e.g. \u05D0\"\u05D1 a_1 a\u00AD:b.")
+           == (segments{ U"Can't", U" ", U"stop", U" ", U"3.14", U" ",
+                         U"e.g", U".", U" ", U"\u05D0\"\u05D1", U" ",
+                         U"a_1", U" ", U"a\u00AD:b", U"." }));
+    assert(word_segments(U"\u30A2\u30FC\u30C8\u6F22\u5B57")
+           == (segments{ U"\u30A2\u30FC\u30C8", U"\u6F22", U"\u5B57" }));
+
+    // WB15, WB16: regional indicators pair up.
+    assert(word_segments(U"\U0001F1FA\U0001F1F8\U0001F1EB")
+           == (segments{ U"\U0001F1FA\U0001F1F8", U"\U0001F1EB" }));
+
+    // Word segments of UTF-8 text, including segments that are located
+    // without decoding, match those of the same text in UTF-32.
+    u32string text{U"Hi, caf\u00E9 don't 1,000.5 \u00E9t\u00E9--x\r\n"
+                   U"\U0001F44D\U0001F3FD ok\u0301 a:\u05D0 z"};
+    string encoded_string;
+    auto out = make_otext_iterator<utf8_encoding>(
+        back_inserter(encoded_string));
+    for (char32_t cp : text) {
+        *out++ = character_type_t<utf8_encoding>{cp};
+    }
+    assert(segment_code_points(make_word_view(
+               make_text_view<utf8_encoding>(encoded_string)))
+           == word_segments(text));
+    assert(word_segments(text)
+           == (segments{ U"Hi", U",", U" ", U"caf\u00E9", U" ", U"don't",
+                         U" ", U"1,000.5", U" ", U"\u00E9t\u00E9", U"-",
+                         U"-", U"x", U"\r\n", U"\U0001F44D\U0001F3FD",
+                         U" ", U"ok\u0301", U" ", U"a:\u05D0", U" ",
+                         U"z" }));
+}
+
+void test_sentence_view() {
+    using segments = vector<u32string>;
+
+    assert(sentences(U"").empty());
+
+    // SB3, SB4: paragraph separators end sentences.
+    assert(sentences(U"One\r\nTwo\u2029Three")
+           == (segments{ U"One\r\n", U"Two\u2029", U"Three" }));
+
+    // SB6 - SB11: terminators, closing punctuation, and spaces.
+    assert(sentences(U"He said \"Stop.\" Then left! Is 3.5 \"ok?\"  Yes")
+           == (segments{ U"He said \"Stop.\" ", U"Then left! ",
+                         U"Is 3.5 \"ok?\"  ", U"Yes" }));
+    assert(sentences(U"U.S.A. is big. etc. and more.\u3002Next")
+           == (segments{ U"U.S.A. is big. etc. and more.\u3002", U"Next" }));
+}
+
+void test_line_break_view() {
+    using segments = vector<u32string>;
+
+    assert(line_break_segments(U"").empty());
+
+    // LB4 - LB8: mandatory breaks, spaces, and zero width spaces.
+    assert(line_break_segments(U"a\r\nb\nc  \u2028d\u200B  e\u200Bf")
+           == (segments{ U"a\r\n", U"b\n", U"c  \u2028", U"d\u200B  ",
+                         U"e\u200B", U"f" }));
+
+    // LB9, LB10: combining marks attach to their base, except after spaces.
+    assert(line_break_segments(U"a\u0301 \u0301b \u200D\u0301")
+           == (segments{ U"a\u0301 ", U"\u0301b ", U"\u200D\u0301" }));
+
+    // LB11 - LB19: punctuation, quotation marks, and glue.
+    assert(line_break_segments(
+               U"The quick (\"brown\") fox can't jump 32.3 feet, right?")
+           == (segments{ U"The ", U"quick ", U"(\"brown\") ", U"fox ",
+                         U"can't ", U"jump ", U"32.3 ", U"feet, ",
+                         U"right?" }));
+    assert(line_break_segments(U"a\u00A0b ( c ) \u2014 \u2014d")
+           == (segments{ U"a\u00A0b ", U"( c ) ", U"\u2014 \u2014",
+                         U"d" }));
+
+    // LB21 - LB25: hyphens and numbers.
+    assert(line_break_segments(U"well-known \u05D0-\u05D1 $-12.5% x")
+           == (segments{ U"well-", U"known ", U"\u05D0-\u05D1 ",
+                         U"$-12.5% ", U"x" }));
+
+    // Ideographs allow a break between each character, but not before
+    // closing punctuation.
+    assert(line_break_segments(U"\u65E5\u672C\u8A9E\u3002\u300C\u6F22\u300D")
+           == (segments{ U"\u65E5", U"\u672C", U"\u8A9E\u3002",
+                         U"\u300C\u6F22\u300D" }));
+
+    // LB30: parentheses join letters, unless they are East Asian wide.
+    assert(line_break_segments(U"f(x)y g\uFF08x\uFF09y")
+           == (segments{ U"f(x)y ", U"g", U"\uFF08x\uFF09", U"y" }));
+
+    // LB30a, LB30b: regional indicators pair up; emoji modifiers attach.
+    assert(line_break_segments(
+               U"\U0001F1FA\U0001F1F8\U0001F1EB\U0001F1F7"
+               U"\U0001F466\U0001F3FB")
+           == (segments{ U"\U0001F1FA\U0001F1F8", U"\U0001F1EB\U0001F1F7",
+                         U"\U0001F466\U0001F3FB" }));
+
+    // Break opportunities in UTF-8 text match those of the same text in
+    // UTF-32.
+    u32string text{U"Na\u00EFve caf\u00E9\u2014\u65E5\u672C \"ok\"\r\n"};
+    string encoded_string;
+    auto out = make_otext_iterator<utf8_encoding>(
+        back_inserter(encoded_string));
+    for (char32_t cp : text) {
+        *out++ = character_type_t<utf8_encoding>{cp};
+    }
+    assert(segment_code_points(make_line_break_view(
+               make_text_view<utf8_encoding>(encoded_string)))
+           == line_break_segments(text));
+}
+
+// Returns the code points of the normalization of 'text' in normalization
+// form 'NF'.
+template<normalization_form NF>
+u32string normalized(const u32string &text) {
+    u32string code_points;
+    for (auto c : make_normalization_view<NF>(u32text_view{text})) {
+        code_points += c.get_code_point();
+    }
+    return code_points;
+}
+
+void test_normalization_view() {
+    constexpr normalization_form nfc = normalization_form::nfc;
+    constexpr normalization_form nfd = normalization_form::nfd;
+    constexpr normalization_form nfkc = normalization_form::nfkc;
+    constexpr normalization_form nfkd = normalization_form::nfkd;
+
+    assert(normalized<nfc>(U"").empty());
+
+    // Canonical decomposition, ordering, and composition.
+    u32string text{U"A\u030A\u212B\u1E9B\u0323q\u0307\u0323\u0958"};
+    assert(normalized<nfd>(text)
+           == U"A\u030AA\u030A\u017F\u0323\u0307q\u0323\u0307"
+              U"\u0915\u093C");
+    assert(normalized<nfc>(text)
+           == U"\u00C5\u00C5\u1E9B\u0323q\u0323\u0307\u0915\u093C");
+    assert(normalized<nfkd>(text)
+           == U"A\u030AA\u030As\u0323\u0307q\u0323\u0307\u0915\u093C");
+    assert(normalized<nfkc>(text)
+           == U"\u00C5\u00C5\u1E69q\u0323\u0307\u0915\u093C");
+
+    // Compatibility decompositions.
+    assert(normalized<nfkc>(U"\uFB01\u00BD\u2460\uFF76\uFF9E")
+           == U"fi1\u20442" U"1\u30AC");
+    assert(normalized<nfc>(U"\uFB01\u00BD") == U"\uFB01\u00BD");
+
+    // Hangul syllables and conjoining jamo.
+    assert(normalized<nfd>(U"\uAC01\uD7A3") ==
+           U"\u1100\u1161\u11A8\u1112\u1175\u11C2");
+    assert(normalized<nfc>(U"\u1100\u1161\u11A8\u1112\u1175x")
+           == U"\uAC01\uD788x");
+
+    // Composition across starters and blocked combining marks.
+    assert(normalized<nfc>(U"\u0B47\u0B3E\u0B47\u0301\u0B3E")
+           == U"\u0B4B\u0B47\u0301\u0B3E");
+
+    // Quick check and is_normalized.
+    u32string nfc_text{U"caf\u00E9 \uAC01"};
+    u32string nfd_text{U"cafe\u0301"};
+    u32string maybe_text{U"e\u0301"};
+    assert(quick_check<nfc>(u32text_view{nfc_text}) == quick_check_result::yes);
+    assert(quick_check<nfd>(u32text_view{nfc_text}) == quick_check_result::no);
+    assert(quick_check<nfc>(u32text_view{maybe_text})
+           == quick_check_result::maybe);
+    assert(quick_check<nfd>(u32text_view{nfd_text}) == quick_check_result::yes);
+    assert(is_normalized<nfc>(u32text_view{nfc_text}));
+    assert(! is_normalized<nfc>(u32text_view{maybe_text}));
+    assert(is_normalized<nfc>(u32text_view{u32string{U"\u0B47\u0301\u0B3E"}}));
+    assert(! is_normalized<nfd>(u32text_view{u32string{U"a\u0301\u0323"}}));
+
+    // Normalization of UTF-8 text.
+    string encoded_string{u8"Ame\u0301lie \u212B"};
+    u32string code_points;
+    for (auto c : make_nfc_view(make_text_view<utf8_encoding>(encoded_string))) {
+        code_points += c.get_code_point();
+    }
+    assert(code_points == U"Am\u00E9lie \u00C5");
+}
+
+template<case_mapping CM>
+u32string case_mapped(const u32string &text) {
+    u32string code_points;
+    for (auto c : make_case_mapping_view<CM>(u32text_view{text})) {
+        code_points += c.get_code_point();
+    }
+    return code_points;
+}
+
+void test_case_mapping_view() {
+    constexpr case_mapping lower = case_mapping::lower;
+    constexpr case_mapping upper = case_mapping::upper;
+    constexpr case_mapping fold = case_mapping::fold;
+
+    assert(case_mapped<lower>(U"").empty());
+
+    // Simple and full mappings.
+    u32string text{U"Stra\u00DFe \u0130 \u01C5 \uFB03 \u1E9E \u0149"};
+    assert(case_mapped<lower>(text)
+           == U"stra\u00DFe i\u0307 \u01C6 \uFB03 \u00DF \u0149");
+    assert(case_mapped<upper>(text)
+           == U"STRASSE \u0130 \u01C4 FFI \u1E9E \u02BCN");
+    assert(case_mapped<fold>(text)
+           == U"strasse i\u0307 \u01C6 ffi ss \u02BCn");
+    assert(case_mapped<upper>(U"\U00010428\u0390")
+           == U"\U00010400\u0399\u0308\u0301");
+    assert(case_mapped<fold>(U"\u00B5\u03A3\u212A") == U"\u03BC\u03C3k");
+
+    // Final_Sigma.
+    assert(case_mapped<lower>(U"\u039F\u0394\u03A5\u03A3\u03A3\u0395\u03A5\u03A3")
+           == U"\u03BF\u03B4\u03C5\u03C3\u03C3\u03B5\u03C5\u03C2");
+    assert(case_mapped<lower>(U"A\u03A3'. \u03A3 A\u03A3'B")
+           == U"a\u03C2'. \u03C3 a\u03C3'b");
+    assert(case_mapped<fold>(U"A\u03A3") == U"a\u03C3");
+
+    // Mapping UTF-8 text into an output text iterator, including blocks of
+    // ASCII characters.
+    string encoded_string{u8"The quick brown fox jumps over the lazy dog; "
+                          u8"Stra\u00DFe \u039F\u0394\u03A5\u03A3\u03A3\u0395\u03A5\u03A3 "
+                          u8"ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`@{|}~0123456789"};
+    auto tv = make_text_view<utf8_encoding>(encoded_string);
+    string mapped_string;
+    to_upper(tv, make_otext_iterator<utf8_encoding>(
+        back_inserter(mapped_string)));
+    assert(mapped_string
+           == u8"THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG; "
+              u8"STRASSE \u039F\u0394\u03A5\u03A3\u03A3\u0395\u03A5\u03A3 "
+              u8"ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`@{|}~0123456789");
+    mapped_string.clear();
+    to_lower(tv, make_otext_iterator<utf8_encoding>(
+        back_inserter(mapped_string)));
+    assert(mapped_string
+           == u8"the quick brown fox jumps over the lazy dog; "
+              u8"stra\u00DFe \u03BF\u03B4\u03C5\u03C3\u03C3\u03B5\u03C5\u03C2 "
+              u8"abcdefghijklmnopqrstuvwxyz[\\]^_`@{|}~0123456789");
+
+    // Modified UTF-8 output encodes U+0000 as C0 80, even within a block of
+    // 16 or more ASCII characters.
+    string nul_string{"ABCDEFGH\0IJKLMNOPQRSTUVWXYZ", 27};
+    mapped_string.clear();
+    to_lower(make_text_view<utf8_encoding>(nul_string),
+             make_otext_iterator<modified_utf8_encoding>(
+                 back_inserter(mapped_string)));
+    assert(mapped_string == "abcdefgh\xC0\x80" "ijklmnopqrstuvwxyz");
+    vector<character<unicode_character_set>> folded;
+    case_fold(tv, back_inserter(folded));
+    auto folded_it = folded.begin();
+    for (auto c : make_case_fold_view(tv)) {
+        assert(folded_it != folded.end() && *folded_it++ == c);
+    }
+    assert(folded_it == folded.end());
+    assert(folded[49].get_code_point() == U's'
+           && folded[50].get_code_point() == U's');
+}
+
+void test_unicode_properties() {
+    // Properties may be queried at compile time.
+    static_assert(get_unicode_properties(U'A').get_general_category()
+                  == general_category::lu, "");
+    static_assert(get_unicode_properties(
+                      character<unicode_character_set>{U'\u0915'})
+                  .get_script() == script::devanagari, "");
+    static_assert(get_unicode_properties(U'\u00BD').get_numeric_value() == 0.5,
+                  "");
+
+    auto a = get_unicode_properties(character<unicode_character_set>{U'a'});
+    assert(a.get_general_category() == general_category::ll);
+    assert(a.get_script() == script::latin);
+    assert(a.get_east_asian_width() == east_asian_width::na);
+    assert(a.is_alphabetic() && a.is_lowercase() && ! a.is_uppercase());
+    assert(! a.has_numeric_value());
+    assert(a.get_numeric_value() != a.get_numeric_value());
+
+    auto han = get_unicode_properties(U'\u5146');
+    assert(han.get_general_category() == general_category::lo);
+    assert(han.get_script() == script::han);
+    assert(han.get_east_asian_width() == east_asian_width::w);
+    assert(han.get_numeric_value_numerator() == 1000000000000LL);
+    assert(han.get_numeric_value_denominator() == 1);
+
+    auto half = get_unicode_properties(U'\u0F33');
+    assert(half.get_general_category() == general_category::no);
+    assert(half.get_script() == script::tibetan);
+    assert(half.get_numeric_value_numerator() == -1);
+    assert(half.get_numeric_value_denominator() == 2);
+
+    auto combining = get_unicode_properties(U'\u0301');
+    assert(combining.get_general_category() == general_category::mn);
+    assert(combining.get_script() == script::inherited);
+    assert(combining.get_east_asian_width() == east_asian_width::a);
+
+    assert(get_unicode_properties(U' ').is_white_space());
+    assert(get_unicode_properties(U'\u3000').get_east_asian_width()
+           == east_asian_width::f);
+    assert(get_unicode_properties(U'\uFF61').get_east_asian_width()
+           == east_asian_width::h);
+    assert(get_unicode_properties(U'+').is_math());
+    assert(get_unicode_properties(U'\u00AD').is_default_ignorable());
+    assert(get_unicode_properties(U'\u00AD').get_general_category()
+           == general_category::cf);
+    assert(get_unicode_properties(U'\U00010300').get_script()
+           == script::old_italic);
+
+    // Unassigned, private use, and out of range code points.
+    auto unassigned = get_unicode_properties(U'\U000E0080');
+    assert(unassigned.get_general_category() == general_category::cn);
+    assert(unassigned.get_script() == script::unknown);
+    assert(get_unicode_properties(U'\U0003FFFD').get_east_asian_width()
+           == east_asian_width::w);
+    assert(get_unicode_properties(U'\uE000').get_general_category()
+           == general_category::co);
+    assert(get_unicode_properties(char32_t(0x110000)).get_general_category()
+           == general_category::cn);
+}
+
+void test_display_width() {
+    assert(display_width(u32text_view{U""}) == 0);
+    assert(display_width(u32text_view{U"abc"}) == 3);
+    assert(display_width(u32text_view{U"\t\r\n\u007F"}) == 0);
+
+    // Wide and fullwidth characters, combining marks, and format characters.
+    assert(display_width(u32text_view{U"\u65E5\u672C\u8A9E"}) == 6);
+    assert(display_width(u32text_view{U"\uFF21\uFF61"}) == 3);
+    assert(display_width(u32text_view{U"e\u0301\u20DD"}) == 1);
+    assert(display_width(u32text_view{U"a\u200Bb\u00AD"}) == 2);
+    assert(display_width(u32text_view{U"\u1100\u1161\u11A8"}) == 2);
+
+    // Emoji, emoji presentation, and flags.
+    assert(display_width(u32text_view{U"\U0001F44D\U0001F3FD"}) == 2);
+    assert(display_width(u32text_view{U"\u2764"}) == 1);
+    assert(display_width(u32text_view{U"\u2764\uFE0F"}) == 2);
+    assert(display_width(u32text_view{
+               U"\U0001F468\u200D\U0001F469\u200D\U0001F467"}) == 2);
+    assert(display_width(u32text_view{U"\U0001F1EF\U0001F1F5\U0001F1FA"})
+           == 3);
+
+    // UTF-8 text, in which runs of ASCII characters are measured directly.
+    string encoded_string{u8"log: \u65E5\u672C e\u0301 #\uFE0F\u20E3 "
+                          u8"\U0001F600\tdone"};
+    assert(display_width(make_text_view<utf8_encoding>(encoded_string))
+           == 21);
+    assert(display_width(make_text_view<utf16_encoding>(
+               u"log: \u65E5\u672C e\u0301 #\uFE0F\u20E3 \U0001F600\tdone"))
+           == 21);
+    assert(display_width(make_text_view<utf8_encoding>(u8"\u0301")) == 0);
+}
+
+string sort_key_of(const u32string &text) {
+    return make_sort_key(u32text_view{text});
+}
+
+void test_collation() {
+    // Primary, secondary, and tertiary differences.
+    auto order = [&](const u32string &a, const u32string &b) {
+        return sort_key_of(a).compare(sort_key_of(b));
+    };
+    assert(order(U"", U"a") < 0);
+    assert(order(U"a", U"A") < 0);
+    assert(order(U"A", U"\u00E1") < 0);
+    assert(order(U"cote", U"cot\u00E9") < 0);
+    assert(order(U"cot\u00E9", U"c\u00F4te") < 0);
+    assert(order(U"co-op", U"coop") < 0);
+    assert(order(U"angstrom", U"\u00C5ngstr\u00F6m") < 0);
+    assert(order(U"\u00C5ngstr\u00F6m", U"azimuth") < 0);
+    assert(order(U"z", U"\u0101") > 0);
+    assert(order(U"\u03B1", U"z") > 0);
+    assert(order(U"\uAC00", U"\u4E00") < 0);
+    assert(order(U"\u4E00", U"\u3400") < 0);
+    assert(order(U"\u3400", U"\U000E0080") < 0);
+
+    // Characters first assigned in Unicode 14.0, which the DUCET 13.0.0
+    // tables do not list, have the implicit weights of unassigned code
+    // points, ideographs included.
+    assert(sort_key_of(U"\u0870").compare(0, 4, "\xFB\xC0\x88\x70") == 0);
+    assert(order(U"\u0627", U"\u0870") < 0);
+    assert(sort_key_of(U"\u9FFC").compare(0, 4, "\xFB\x41\x9F\xFC") == 0);
+    assert(sort_key_of(U"\u9FFD").compare(0, 4, "\xFB\xC1\x9F\xFD") == 0);
+    assert(sort_key_of(U"\U0002A6DE").compare(0, 4, "\xFB\xC5\xA6\xDE")
+           == 0);
+
+    // Canonically equivalent text has the same sort key, and ignorable
+    // characters do not affect it.
+    assert(sort_key_of(U"\u00C5") == sort_key_of(U"A\u030A"));
+    assert(sort_key_of(U"\u212B") == sort_key_of(U"A\u030A"));
+    assert(sort_key_of(U"a\u0323\u0302") == sort_key_of(U"a\u0302\u0323"));
+    assert(sort_key_of(U"a\u0001b\u200B") == sort_key_of(U"ab"));
+
+    // Contractions, including a discontiguous match across a non-starter.
+    assert(order(U"l\u00B7m", U"lm") > 0);
+    assert(order(U"l\u00B7m", U"lz") < 0);
+    assert(sort_key_of(U"\u0419\u0323")
+           == sort_key_of(U"\u0418\u0323\u0306"));
+    assert(order(U"\u0419", U"\u0418\u0308") != 0);
+
+    // UTF-8 text, including text that is entirely ASCII, has the same sort
+    // keys as its code points.
+    string encoded_string{u8"Ame\u0301lie"};
+    assert(make_sort_key(make_text_view<utf8_encoding>(encoded_string))
+           == sort_key_of(U"Am\u00E9lie"));
+    assert(make_sort_key(make_text_view<utf8_encoding>(u8"co-op"))
+           == sort_key_of(U"co-op"));
+    string key;
+    make_sort_key(make_text_view<utf16_encoding>(u"\u00C5ngstr\u00F6m"),
+                  back_inserter(key));
+    assert(key == sort_key_of(U"\u00C5ngstr\u00F6m"));
+}
+
+template<caseless_matching CM = caseless_matching::default_caseless>
+u32string caseless_match_of(const u32string &text, const u32string &pattern) {
+    auto match =
+        caseless_search<CM>(u32text_view{text}, u32text_view{pattern});
+    u32string s;
+    for (auto c : match) {
+        s += c.get_code_point();
+    }
+    return s;
+}
+
+void test_caseless_search() {
+    constexpr auto canonical = caseless_matching::canonical_caseless;
+
+    // Default caseless matching compares full case foldings.
+    assert(caseless_match_of(U"xAbAB", U"ab") == U"Ab");
+    assert(caseless_match_of(U"300 \u212A", U"k") == U"\u212A");
+    assert(caseless_match_of(U"STRASSE", U"stra\u00DFe") == U"STRASSE");
+    assert(caseless_match_of(U"Stra\u00DFe", U"strasse") == U"Stra\u00DFe");
+    assert(caseless_match_of(U"\u1FB3", U"\u0391\u0399") == U"\u1FB3");
+    assert(caseless_match_of(U"Ma\u00DF", U"s") == U"");
+    assert(caseless_match_of(U"abc", U"abd") == U"");
+    u32string text{U"abc"}, empty;
+    u32text_view abc{text};
+    auto match = caseless_search(abc, u32text_view{empty});
+    assert(match.begin().base() == abc.begin().base()
+           && match.begin() == match.end());
+    match = caseless_search(abc, u32text_view{U"x"});
+    assert(match.begin().base() == abc.end().base()
+           && match.begin() == match.end());
+
+    // Canonical caseless matching also matches canonically equivalent text.
+    assert(caseless_match_of(U"Caf\u00C9", U"cafe\u0301") == U"");
+    assert(caseless_match_of<canonical>(U"Caf\u00C9", U"cafe\u0301")
+           == U"Caf\u00C9");
+    assert(caseless_match_of<canonical>(U"a\u0301\u0323", U"A\u0323\u0301")
+           == U"a\u0301\u0323");
+    assert(caseless_match_of<canonical>(U"\u212B", U"\u00E5") == U"\u212B");
+    assert(caseless_match_of<canonical>(U"e\u0301", U"\u0301")
+           == U"\u0301");
+    assert(caseless_match_of<canonical>(U"\u00C9", U"e") == U"");
+
+    // UTF-8 and UTF-16 text, in which ASCII characters that cannot begin a
+    // match are skipped by examining code units.
+    string encoded_string{u8"Gr\u00FC\u00DFe aus K\u00F6ln und der "
+                          u8"Umgebung, GR\u00DC\u1E9EE"};
+    auto tv = make_text_view<utf8_encoding>(encoded_string);
+    string gruesse{u8"gr\u00FCsse"}, koeln{u8"K\u00D6LN"};
+    string umgebung{"umgebunG"}, xyz{"xyz"};
+    auto pattern = make_text_view<utf8_encoding>(gruesse);
+    auto found = caseless_search(tv, pattern);
+    assert(found.begin().base() - encoded_string.cbegin() == 0);
+    assert(found.end().base() - encoded_string.cbegin() == 7);
+    found = caseless_search(make_text_view(found.end(), tv.end()), pattern);
+    assert(found.begin().base() - encoded_string.cbegin() == 36);
+    assert(found.end() == tv.end());
+    found = caseless_search(tv, make_text_view<utf8_encoding>(koeln));
+    assert(found.begin().base() - encoded_string.cbegin() == 12);
+    found = caseless_search(tv, make_text_view<utf8_encoding>(umgebung));
+    assert(found.begin().base() - encoded_string.cbegin() == 26);
+    found = caseless_search(tv, make_text_view<utf8_encoding>(xyz));
+    assert(found.begin() == tv.end());
+    u16string encoded_u16string{u"Gr\u00FC\u00DFe aus K\u00F6ln"};
+    string decomposed_koeln{u8"ko\u0308ln"};
+    auto match16 = caseless_search<canonical>(
+        make_text_view<utf16_encoding>(encoded_u16string),
+        make_text_view<utf8_encoding>(decomposed_koeln));
+    assert(match16.begin().base() - encoded_u16string.cbegin() == 10);
+    assert(match16.end().base() == encoded_u16string.cend());
+}
+
+void test_hash_text() {
+    // Hashes are those of the 64-bit xxHash algorithm over UTF-8.
+    string empty, abc{"abc"};
+    assert(hash_text(make_text_view<utf8_encoding>(empty))
+           == std::size_t(0xEF46DB3751D8E999));
+    assert(hash_text(make_text_view<utf8_encoding>(abc))
+           == std::size_t(0x44BC2CF5AD770999));
+    assert(hash_text(make_text_view<utf8_encoding>(abc), 1)
+           == std::size_t(0xBEA9CA8199328908));
+
+    // Text hashes equally in every encoding, whether its code units are
+    // hashed in place, through a buffer, or after decoding.
+    string encoded_string{u8"caf\u00E9 \u65E5\u672C\u8A9E \U0001F600 and "
+                          u8"some more text to exceed 32 bytes"};
+    u16string encoded_u16string{u"caf\u00E9 \u65E5\u672C\u8A9E "
+                                u"\U0001F600 and some more text to exceed "
+                                u"32 bytes"};
+    u32string encoded_u32string{U"caf\u00E9 \u65E5\u672C\u8A9E \U0001F600 "
+                                U"and some more text to exceed 32 bytes"};
+    std::size_t h = hash_text(make_text_view<utf8_encoding>(encoded_string));
+    assert(h == std::size_t(0x124CC79CA51AC5BB));
+    assert(hash_text(make_text_view<utf8_encoding>(
+               encoded_string.data(),
+               encoded_string.data() + encoded_string.size())) == h);
+    assert(hash_text(make_text_view<utf16_encoding>(encoded_u16string)) == h);
+    assert(hash_text(make_text_view<utf32_encoding>(encoded_u32string)) == h);
+    assert(hash_text(make_text_view<utf8_encoding>(encoded_string), 1) != h);
+    assert(text_hash{}(u32text_view{encoded_u32string}) == h);
+}
+
+u32string regex_match_of(const u32string &text, const u32string &pattern) {
+    text_regex re{u32text_view{pattern}};
+    auto match = regex_search(u32text_view{text}, re);
+    u32string s;
+    for (auto c : match) {
+        s += c.get_code_point();
+    }
+    return s;
+}
+
+void test_regex() {
+    // Matches are leftmost, and of those, longest.
+    assert(regex_match_of(U"xxabcxx", U"abc") == U"abc");
+    assert(regex_match_of(U"abcd", U"(a|ab)(c|bcd)") == U"abcd");
+    assert(regex_match_of(U"the color", U"colou?r") == U"color");
+    assert(regex_match_of(U"a12345", U"\\d{2,3}") == U"123");
+    assert(regex_match_of(U"ab\ncd", U".+") == U"ab");
+    assert(regex_match_of(U"xabab", U"(?:ab)*$") == U"abab");
+    assert(regex_match_of(U"ab", U"^b") == U"");
+    assert(regex_match_of(U"abcdefabc", U"[^a-c]+") == U"def");
+
+    // Unicode properties and code points beyond the BMP.
+    assert(regex_match_of(U"abc \u03B1\u03B2\u03B3 d", U"\\p{Greek}+")
+           == U"\u03B1\u03B2\u03B3");
+    assert(regex_match_of(U"  h\u00E9llo w\u00F6rld", U"\\w+")
+           == U"h\u00E9llo");
+    assert(regex_match_of(U"ab12-c", U"\\P{L}+") == U"12-");
+    assert(regex_match_of(U"x\U0001F600\U0001F600y", U"\\x{1F600}+")
+           == U"\U0001F600\U0001F600");
+    assert(regex_match_of(U"\u00E9\u00E8e", U"\\p{Lowercase_Letter}{2}")
+           == U"\u00E9\u00E8");
+
+    // An empty match, and no match, in a text view.
+    u32string text{U"abc"}, star{U"x*"}, x{U"x"};
+    u32text_view abc{text};
+    text_regex empty_re{u32text_view{star}}, x_re{u32text_view{x}};
+    auto match = regex_search(abc, empty_re);
+    assert(match.begin().base() == abc.begin().base()
+           && match.begin() == match.end());
+    match = regex_search(abc, x_re);
+    assert(match.begin().base() == abc.end().base()
+           && match.begin() == match.end());
+    assert(! regex_match(abc, x_re));
+
+    // UTF-8 and UTF-16 text is matched on its code units.
+    string encoded_string{u8"caf\u00E9 \u65E5\u672C\u8A9E \U0001F600 42"};
+    u16string encoded_u16string{u"caf\u00E9 \u65E5\u672C\u8A9E \U0001F600 42"};
+    string han_pattern{"\\p{Han}+ \\P{L}"}, all_pattern{"\\w+ .+ \\S+ \\d+"};
+    text_regex han{make_text_view<utf8_encoding>(han_pattern)};
+    text_regex all{make_text_view<utf8_encoding>(all_pattern)};
+    auto tv = make_text_view<utf8_encoding>(encoded_string);
+    auto found = regex_search(tv, han);
+    assert(found.begin().base() - encoded_string.cbegin() == 6);
+    assert(found.end().base() - encoded_string.cbegin() == 20);
+    assert(regex_match(tv, all));
+    auto tv16 = make_text_view<utf16_encoding>(encoded_u16string);
+    auto found16 = regex_search(tv16, han);
+    assert(found16.begin().base() - encoded_u16string.cbegin() == 5);
+    assert(found16.end().base() - encoded_u16string.cbegin() == 11);
+    assert(regex_match(tv16, all));
+
+    // Invalid patterns.
+    for (string pattern : {"a(b", "a)", "*a", "[a-", "a{2,1}", "\\p{Nope}",
+                           "a*?", "\\q"})
+    {
+        bool thrown = false;
+        try {
+            text_regex re{make_text_view<utf8_encoding>(pattern)};
+        } catch (const text_regex_error &) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+}
+
+void test_edit_distance() {
+    // Distances between code points, in any combination of encodings.
+    string kitten{"kitten"}, sitting{"sitting"}, empty;
+    u16string caf{u"caf\u00E9"}, cafe{u"cafe"};
+    u32string cafes{U"caf\u00E9s"};
+    assert(edit_distance(make_text_view<utf8_encoding>(kitten),
+                         make_text_view<utf8_encoding>(sitting)) == 3);
+    assert(edit_distance(make_text_view<utf8_encoding>(sitting),
+                         make_text_view<utf8_encoding>(kitten)) == 3);
+    assert(edit_distance(make_text_view<utf8_encoding>(empty),
+                         make_text_view<utf8_encoding>(kitten)) == 6);
+    assert(edit_distance(make_text_view<utf16_encoding>(caf),
+                         make_text_view<utf16_encoding>(cafe)) == 1);
+    assert(edit_distance(make_text_view<utf16_encoding>(caf),
+                         u32text_view{cafes}) == 1);
+    assert(edit_distance(make_text_view<utf8_encoding>(kitten),
+                         make_text_view<utf8_encoding>(kitten)) == 0);
+
+    // Modified UTF-8 encodes U+0000 as C0 80, which is one code point.
+    string modified_nul{"a\xC0\x80" "b"};
+    u32string nul{U"a\0b", 3};
+    assert(edit_distance(make_text_view<modified_utf8_encoding>(modified_nul),
+                         u32text_view{nul}) == 0);
+
+    // Texts of more than 64 code points are compared a block at a time.
+    string long_text, edited_text;
+    for (int i = 0; i < 20; ++i) {
+        long_text += u8"abc\u00E9\u65E5";
+        edited_text += i == 3 ? u8"abc\u65E5"
+                     : i == 9 ? u8"abcxy\u00E9\u65E5"
+                     : i == 15 ? u8"abz\u00E9\u65E5"
+                     : u8"abc\u00E9\u65E5";
+    }
+    assert(edit_distance(make_text_view<utf8_encoding>(long_text),
+                         make_text_view<utf8_encoding>(edited_text)) == 4);
+
+    // Fuzzy search finds the first match that is within a distance, extended
+    // while the distance decreases.
+    string text{u8"name: Zo\u00EB Smith, city: Z\u00FCrich"};
+    string zoe{"Zoe"}, zurich{"Zurich"}, smyth{"Smyth"}, xyz{"xyz"};
+    auto tv = make_text_view<utf8_encoding>(text);
+    auto match = fuzzy_search(tv, make_text_view<utf8_encoding>(zoe), 1);
+    assert(match.begin().base() - text.cbegin() == 6);
+    assert(match.end().base() - text.cbegin() == 10);
+    match = fuzzy_search(tv, make_text_view<utf8_encoding>(smyth), 1);
+    assert(match.begin().base() - text.cbegin() == 11);
+    assert(match.end().base() - text.cbegin() == 16);
+    match = fuzzy_search(tv, make_text_view<utf8_encoding>(zurich), 1);
+    assert(match.begin().base() - text.cbegin() == 24);
+    assert(match.end() == tv.end());
+    match = fuzzy_search(tv, make_text_view<utf8_encoding>(zurich), 0);
+    assert(match.begin() == tv.end() && match.end() == tv.end());
+    match = fuzzy_search(tv, make_text_view<utf8_encoding>(xyz), 3);
+    assert(match.begin() == tv.begin() && match.end() == tv.begin());
+    u32string u32text{U"xx" U"abcabcabcabcabcabcabcabcabcabcabcabcabcabcabc"
+                      U"abcabcabcabcabcabcabcabcabcXabcabc" U"yy"};
+    u32string pattern{U"abcabcabcabcabcabcabcabcabcabcabcabcabcabcabc"
+                      U"abcabcabcabcabcabcabcabcabcabcabc"};
+    u32text_view u32tv{u32text};
+    auto u32match = fuzzy_search(u32tv, u32text_view{pattern}, 2);
+    assert(u32match.begin().base() == u32tv.begin().base() + 2);
+    assert(u32match.end().base() == u32tv.end().base() - 2);
+}
+
+// Returns the code points of the text view 'old_tv' with the hunks of a diff
+// against the text view 'new_tv' applied, which must be those of 'new_tv'.
+template<TextView TVT1, TextView TVT2, typename Hunks>
+u32string apply_diff(const TVT1 &old_tv, const TVT2 &new_tv,
+                     const Hunks &hunks)
+{
+    u32string s;
+    auto old_first = old_tv.begin();
+    for (const auto &h : hunks) {
+        for (; old_first != h.old_first; ++old_first) {
+            s += (*old_first).get_code_point();
+        }
+        for (auto it = h.new_first; it != h.new_last; ++it) {
+            s += (*it).get_code_point();
+        }
+        old_first = h.old_last;
+    }
+    for (; old_first != old_tv.end(); ++old_first) {
+        s += (*old_first).get_code_point();
+    }
+    for (auto c : new_tv) {
+        assert(! s.empty() && s.front() == c.get_code_point());
+        s.erase(0, 1);
+    }
+    return s;
+}
+
+void test_diff() {
+    // Identical texts have no differences.
+    string text{"one\ntwo\nthree\n"}, edited{"one\ntwice\nthree\nfour\n"};
+    auto tv = make_text_view<utf8_encoding>(text);
+    auto etv = make_text_view<utf8_encoding>(edited);
+    assert(diff_text(tv, tv).empty());
+
+    // Lines that differ, and lines that are inserted.
+    auto hunks = diff_text(tv, etv);
+    assert(hunks.size() == 2);
+    assert(hunks[0].old_first.base() - text.cbegin() == 4);
+    assert(hunks[0].old_last.base() - text.cbegin() == 8);
+    assert(hunks[0].new_first.base() - edited.cbegin() == 4);
+    assert(hunks[0].new_last.base() - edited.cbegin() == 10);
+    assert(hunks[1].old_first == tv.end() && hunks[1].old_last == tv.end());
+    assert(hunks[1].new_first.base() - edited.cbegin() == 16);
+    assert(hunks[1].new_last == etv.end());
+    assert(apply_diff(tv, etv, hunks).empty());
+
+    // Code points that differ within those lines.
+    hunks = diff_text(tv, etv, diff_granularity::code_point);
+    assert(hunks.size() == 2);
+    assert(hunks[0].old_first.base() - text.cbegin() == 6);
+    assert(hunks[0].old_last.base() - text.cbegin() == 7);
+    assert(hunks[0].new_first.base() - edited.cbegin() == 6);
+    assert(hunks[0].new_last.base() - edited.cbegin() == 9);
+    assert(apply_diff(tv, etv, hunks).empty());
+
+    // Texts in different encodings are compared by their code points.
+    u16string u16text{u"caf\u00E9 au lait\nfin\n"};
+    auto u16tv = make_text_view<utf16_encoding>(u16text);
+    string u8text{u8"caf\u00E8 au lait\nfin\n"};
+    auto u8tv = make_text_view<utf8_encoding>(u8text);
+    auto mixed = diff_text(u16tv, u8tv, diff_granularity::code_point);
+    assert(mixed.size() == 1);
+    assert(mixed[0].old_first.base() - u16text.cbegin() == 3);
+    assert(mixed[0].old_last.base() - u16text.cbegin() == 4);
+    assert(mixed[0].new_first.base() - u8text.cbegin() == 3);
+    assert(mixed[0].new_last.base() - u8text.cbegin() == 5);
+    assert(apply_diff(u16tv, u8tv, mixed).empty());
+
+    // Grapheme clusters that differ are reported whole.
+    string acute{u8"ne\u0301e\n"}, grave{u8"ne\u0300e\n"};
+    auto atv = make_text_view<utf8_encoding>(acute);
+    auto gtv = make_text_view<utf8_encoding>(grave);
+    hunks = diff_text(atv, gtv, diff_granularity::code_point);
+    assert(hunks.size() == 1);
+    assert(hunks[0].old_first.base() - acute.cbegin() == 2);
+    hunks = diff_text(atv, gtv, diff_granularity::grapheme);
+    assert(hunks.size() == 1);
+    assert(hunks[0].old_first.base() - acute.cbegin() == 1);
+    assert(hunks[0].old_last.base() - acute.cbegin() == 4);
+    assert(hunks[0].new_last.base() - grave.cbegin() == 4);
+
+    // Empty texts, and texts that have no lines in common.
+    string empty, other{"x\ny"};
+    auto empty_tv = make_text_view<utf8_encoding>(empty);
+    auto other_tv = make_text_view<utf8_encoding>(other);
+    hunks = diff_text(empty_tv, other_tv);
+    assert(hunks.size() == 1 && hunks[0].new_last == other_tv.end());
+    hunks = diff_text(tv, other_tv, diff_granularity::code_point);
+    assert(apply_diff(tv, other_tv, hunks).empty());
+
+    // Edits of texts generated from a small alphabet.
+    unsigned seed = 1;
+    auto random = [&seed](unsigned n) {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) % n;
+    };
+    const char *words[] = { "a", "b", "\n", u8"\u00E9", u8"\u0301", "e\n" };
+    for (int i = 0; i < 200; ++i) {
+        string s1, s2;
+        for (unsigned n = random(40); n > 0; --n) {
+            s1 += words[random(6)];
+        }
+        for (unsigned n = random(40); n > 0; --n) {
+            s2 += words[random(6)];
+        }
+        auto tv1 = make_text_view<utf8_encoding>(s1);
+        auto tv2 = make_text_view<utf8_encoding>(s2);
+        for (auto g : { diff_granularity::line, diff_granularity::code_point,
+                        diff_granularity::grapheme })
+        {
+            assert(apply_diff(tv1, tv2, diff_text(tv1, tv2, g)).empty());
+        }
+    }
+}
+
+void test_bpe_tokenizer() {
+    // Merges apply within pieces: "hello", " world", and the contraction
+    // "'s" are single tokens, but "o " is not merged across pieces.
+    bpe_tokenizer tokenizer{{
+        {"h", "e"}, {"l", "l"}, {"he", "ll"}, {"hell", "o"}, {"o", " "},
+        {" ", "w"}, {" w", "o"}, {"r", "l"}, {" wo", "rl"}, {" worl", "d"},
+        {"'", "s"}, {"o", "'"}, {" ", " "}, {" ", "x"},
+        {"\xC3", "\xA9"}, {u8"\u00E9", "s"}, {"s", "1"}, {"a", "a"},
+        {"aa", "aa"}}};
+    assert(tokenizer.vocabulary_size() == 256 + 19);
+    auto tokens_of = [&](const string &s) {
+        vector<string> tokens;
+        for (unsigned id : tokenizer.encode(u8text_view{s})) {
+            tokens.push_back(tokenizer.token(id));
+        }
+        return tokens;
+    };
+    assert((tokens_of("hello world") == vector<string>{"hello", " world"}));
+    assert((tokens_of("hello's") == vector<string>{"hello", "'s"}));
+    assert((tokens_of("o x") == vector<string>{"o", " x"}));
+
+    // White space leaves its last character to a following piece.
+    assert((tokens_of("o   x") == vector<string>{"o", "  ", " x"}));
+    assert((tokens_of("o\n\n") == vector<string>{"o", "\n", "\n"}));
+
+    // Letters and numbers of any script form separate pieces, and bytes
+    // that are not well formed UTF-8 are tokens of their own.
+    assert((tokens_of(u8"\u00E9s1") == vector<string>{u8"\u00E9s", "1"}));
+    assert((tokens_of("\xFFs") == vector<string>{"\xFF", "s"}));
+
+    // Long pieces are merged in the same order as short ones.
+    vector<string> expected(16, "aaaa");
+    expected.push_back("aa");
+    assert(tokens_of(string(66, 'a')) == expected);
+
+    // Tokens decode to the bytes of the text.
+    string text{u8"hello w\u00F6rld's \u65E5\u672C 123\xC3"};
+    auto ids = tokenizer.encode(u8text_view{text});
+    assert(tokenizer.decode(ids.begin(), ids.end()) == text);
+
+    // Documents are encoded concurrently.
+    vector<string> documents{"hello world", text, string(100, 'a'), ""};
+    vector<u8text_view> views;
+    for (const string &d : documents) {
+        views.push_back(u8text_view{d});
+    }
+    auto batch = tokenizer.encode_batch(views, 3);
+    assert(batch.size() == documents.size());
+    for (size_t i = 0; i < documents.size(); ++i) {
+        assert(batch[i] == tokenizer.encode(views[i]));
+    }
+
+    // Merges of tokens that do not exist are rejected.
+    try {
+        bpe_tokenizer{{{"a", "bc"}}};
+        assert(false);
+    } catch (const text_tokenizer_error &) {
+    }
+}
+
+void test_line_index() {
+    // LF and CR LF end lines, columns are counted in code points, and the
+    // end of the text follows the last character.
+    string text{u8"one\r\nt\u00E9o\n\u00E9\u2028x"};
+    u8text_view tv{text};
+    auto index = make_line_index(tv);
+    assert(index.size() == text.size());
+    assert(index.line_count() == 3);
+    assert(index.line_offset(2) == 5);
+    assert((index.position(tv, 0) == text_position{1, 1}));
+    assert((index.position(tv, 3) == text_position{1, 4}));
+    assert((index.position(tv, 5) == text_position{2, 1}));
+    assert((index.position(tv, 6) == text_position{2, 2}));
+    assert((index.position(tv, 10) == text_position{3, 1}));
+    assert((index.position(tv, text.size()) == text_position{3, 4}));
+    assert(index.offset(tv, {2, 3}) == 8);
+    assert(index.offset(tv, {3, 2}) == 12);
+    assert(index.offset(tv, {3, 4}) == text.size());
+
+    // An offset within a character has the column that follows it.
+    assert((index.position(tv, 7) == text_position{2, 3}));
+    assert((index.position(tv, 11) == text_position{3, 2}));
+
+    // Positions that are not in the text are rejected.
+    for (text_position p : { text_position{0, 1}, text_position{1, 0},
+                             text_position{1, 6}, text_position{4, 1} })
+    {
+        try {
+            index.offset(tv, p);
+            assert(false);
+        } catch (const out_of_range &) {
+        }
+    }
+    try {
+        index.position(tv, text.size() + 1);
+        assert(false);
+    } catch (const out_of_range &) {
+    }
+
+    // U+2028 and U+2029 optionally end lines too.
+    auto unicode_index = make_line_index(tv, line_separators::unicode);
+    assert(unicode_index.line_count() == 4);
+    assert((unicode_index.position(tv, 13) == text_position{3, 3}));
+    assert((unicode_index.position(tv, 15) == text_position{4, 1}));
+    assert(unicode_index.offset(tv, {3, 2}) == 12);
+
+    // Appended text is indexed incrementally, including characters and
+    // line separators split between appends.
+    string appended;
+    line_index<utf8_encoding> incremental{line_separators::unicode};
+    for (char c : text) {
+        appended += c;
+        incremental.update(u8text_view{appended});
+    }
+    assert(incremental.line_count() == unicode_index.line_count());
+    for (size_t i = 0; i <= text.size(); ++i) {
+        assert(incremental.position(tv, i) == unicode_index.position(tv, i));
+    }
+
+    // Long lines are looked up from checkpoints.
+    string long_text = "a\n";
+    for (int i = 0; i < 2000; ++i) {
+        long_text += u8"\u00E9";
+    }
+    long_text += "\nb";
+    u8text_view long_tv{long_text};
+    auto long_index = make_line_index(long_tv);
+    assert((long_index.position(long_tv, 2 + 2 * 1500)
+            == text_position{2, 1501}));
+    assert(long_index.offset(long_tv, {2, 1999}) == 2 + 2 * 1998);
+    assert(long_index.offset(long_tv, {3, 1}) == long_text.size() - 1);
+
+    // Other encodings are decoded, and the encoding state is recorded at
+    // each checkpoint.
+    u16string u16_text{u"a\r\n\U0001F600b\u2029c"};
+    u16text_view u16_tv{u16_text};
+    auto u16_index = make_line_index(u16_tv, line_separators::unicode);
+    assert(u16_index.line_count() == 3);
+    assert((u16_index.position(u16_tv, 6) == text_position{2, 3}));
+    assert(u16_index.offset(u16_tv, {3, 1}) == 7);
+
+    string jis_text{"\x1B$B"};
+    for (int i = 0; i < 600; ++i) {
+        jis_text += "$\"";
+    }
+    jis_text += "\x1B(Bx\n";
+    auto jis_tv = make_text_view<iso_2022_jp_encoding>(jis_text);
+    auto jis_index = make_line_index(jis_tv);
+    assert(jis_index.line_count() == 2);
+    assert((jis_index.position(jis_tv, 3 + 2 * 550)
+            == text_position{1, 551}));
+    assert(jis_index.offset(jis_tv, {1, 551}) == 3 + 2 * 550);
+    assert(jis_index.offset(jis_tv, {2, 1}) == jis_text.size());
+}
+
 int main() {
     test_code_unit_models();
     test_code_point_models();
@@ -2343,6 +4175,33 @@ int main() {
     test_utf32be_encoding();
     test_utf32le_encoding();
     test_utf32bom_encoding();
+    test_iso_8859_1_encoding();
+    test_iso_8859_15_encoding();
+    test_windows_1252_encoding();
+    test_gb18030_encoding();
+    test_shift_jis_encoding();
+    test_iso_2022_jp_encoding();
+    test_cesu8_encoding();
+    test_modified_utf8_encoding();
+    test_wtf8_encoding();
+    test_utf16_lossless_encoding();
+
+    test_grapheme_view();
+    test_word_view();
+    test_sentence_view();
+    test_line_break_view();
+    test_normalization_view();
+    test_case_mapping_view();
+    test_unicode_properties();
+    test_display_width();
+    test_collation();
+    test_caseless_search();
+    test_hash_text();
+    test_regex();
+    test_edit_distance();
+    test_diff();
+    test_bpe_tokenizer();
+    test_line_index();
 
     return 0;
 }
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016, Tom Honermann
+#
+# This file is distributed under the MIT License. See the accompanying file
+# LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+# and conditions.
+
+# Generates include/text_view_detail/unicode/case_tables.hpp.
+#
+# The simple lowercase and uppercase mappings are read from UnicodeData.txt,
+# the unconditional full mappings from SpecialCasing.txt, the simple and full
+# case foldings (status C, S, and F) from CaseFolding.txt, and the Cased and
+# Case_Ignorable properties from DerivedCoreProperties.txt.  Simple mappings
+# are stored as deltas from the code point; since most cased letters share
+# the same few deltas, each distinct combination of deltas and flags is
+# stored once and the trie holds its index.  The few code points with a full
+# mapping of more than one code point are listed separately.  Language
+# sensitive mappings and the Turkic foldings (status T) are not included; the
+# Final_Sigma condition is evaluated by the case mapping views.
+#
+# usage: gen_case_tables.py <ucd directory> > case_tables.hpp
+
+import os
+import sys
+
+import ucd
+
+CASED = 0x01
+CASE_IGNORABLE = 0x02
+SPECIAL = 0x04
+
+MAX_MAPPING = 3
+
+COMMENT = '''
+Case mapping table
+Each entry holds the deltas that map a code point to its simple lowercase,
+uppercase, and case folded forms, and the cased, case_ignorable, and special
+flags.  The trie holds the index of the entry for each code point.  The full
+mappings of code points with the special flag are found in special_mappings,
+ordered by code point; mappings shorter than max_mapping code points are
+padded with zeros.
+'''
+
+GUARD = 'TEXT_VIEW_UNICODE_CASE_TABLES_HPP'
+
+
+def read_simple_mappings(ucd_dir):
+    """Returns dictionaries mapping code points to their simple uppercase and
+    lowercase mappings in UnicodeData.txt."""
+    upper = {}
+    lower = {}
+    path = os.path.join(ucd_dir, 'UnicodeData.txt')
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            fields = line.split(';')
+            if len(fields) < 14:
+                continue
+            cp = int(fields[0], 16)
+            if fields[12].strip():
+                upper[cp] = int(fields[12], 16)
+            if fields[13].strip():
+                lower[cp] = int(fields[13], 16)
+    return upper, lower
+
+
+def read_special_casing(ucd_dir):
+    """Returns dictionaries mapping code points to their unconditional full
+    lowercase and uppercase mappings in SpecialCasing.txt."""
+    upper = {}
+    lower = {}
+    path = os.path.join(ucd_dir, 'SpecialCasing.txt')
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            fields = [field.strip() for field in line.split('#')[0].split(';')]
+            if len(fields) < 5 or fields[4]:
+                continue
+            cp = int(fields[0], 16)
+            lower[cp] = [int(m, 16) for m in fields[1].split()]
+            upper[cp] = [int(m, 16) for m in fields[3].split()]
+    return upper, lower
+
+
+def read_case_folding(ucd_dir):
+    """Returns dictionaries mapping code points to their simple and full case
+    foldings in CaseFolding.txt."""
+    simple = {}
+    full = {}
+    path = os.path.join(ucd_dir, 'CaseFolding.txt')
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            fields = [field.strip() for field in line.split('#')[0].split(';')]
+            if len(fields) < 3:
+                continue
+            cp = int(fields[0], 16)
+            mapping = [int(m, 16) for m in fields[2].split()]
+            if fields[1] in ('C', 'S'):
+                simple[cp] = mapping[0]
+            if fields[1] in ('C', 'F'):
+                full[cp] = mapping
+    return simple, full
+
+
+def main():
+    ucd_dir = sys.argv[1]
+    simple_upper, simple_lower = read_simple_mappings(ucd_dir)
+    full_upper, full_lower = read_special_casing(ucd_dir)
+    simple_fold, full_fold = read_case_folding(ucd_dir)
+    cased = ucd.read_code_points(
+        ucd_dir, 'DerivedCoreProperties.txt', 'Cased')
+    case_ignorable = ucd.read_code_points(
+        ucd_dir, 'DerivedCoreProperties.txt', 'Case_Ignorable')
+
+    entries = {}
+    values = []
+    special_mappings = []
+    for cp in range(ucd.CODE_POINTS):
+        lower = simple_lower.get(cp, cp)
+        upper = simple_upper.get(cp, cp)
+        fold = simple_fold.get(cp, cp)
+        flags = 0
+        if cp in cased:
+            flags |= CASED
+        if cp in case_ignorable:
+            flags |= CASE_IGNORABLE
+        full = (full_lower.get(cp, [lower]), full_upper.get(cp, [upper]),
+                full_fold.get(cp, [fold]))
+        if full != ([lower], [upper], [fold]):
+            assert all(len(m) <= MAX_MAPPING for m in full)
+            flags |= SPECIAL
+            special_mappings.append((cp, full))
+        entry = (lower - cp, upper - cp, fold - cp, flags)
+        values.append(entries.setdefault(entry, len(entries)))
+    # The case mappings of ASCII characters are computed directly.
+    ordered = sorted(entries, key=entries.get)
+    for cp in range(0x80):
+        lower, upper, fold, flags = ordered[values[cp]]
+        is_upper = ord('A') <= cp <= ord('Z')
+        is_lower = ord('a') <= cp <= ord('z')
+        assert lower == fold == (0x20 if is_upper else 0)
+        assert upper == (-0x20 if is_lower else 0)
+        assert bool(flags & CASED) == (is_upper or is_lower)
+        assert not flags & SPECIAL
+    value_type = 'unsigned char' if len(entries) <= 256 else 'unsigned short'
+
+    out = sys.stdout
+    out.write(ucd.HEADER.format(
+        generator='gen_case_tables.py',
+        version=ucd.version(ucd_dir, 'CaseFolding.txt'),
+        guard=GUARD))
+    ucd.emit_comment(out, COMMENT)
+    out.write('struct case_table {\n')
+    out.write('    struct entry {\n')
+    out.write('        int lower;\n')
+    out.write('        int upper;\n')
+    out.write('        int fold;\n')
+    out.write('        unsigned char flags;\n')
+    out.write('    };\n')
+    out.write('    struct special_mapping {\n')
+    out.write('        char32_t code_point;\n')
+    out.write('        char32_t lower[%d];\n' % MAX_MAPPING)
+    out.write('        char32_t upper[%d];\n' % MAX_MAPPING)
+    out.write('        char32_t fold[%d];\n' % MAX_MAPPING)
+    out.write('    };\n')
+    out.write('    static constexpr %s default_value = 0;\n' % value_type)
+    for name, value in [('cased', CASED), ('case_ignorable', CASE_IGNORABLE),
+                        ('special', SPECIAL)]:
+        out.write('    static constexpr unsigned char %s = 0x%02X;\n'
+                  % (name, value))
+    out.write('    static constexpr int max_mapping = %d;\n' % MAX_MAPPING)
+    out.write('    static constexpr entry entries[%d] = {\n' % len(entries))
+    for lower, upper, fold, flags in ordered:
+        out.write('        { %d, %d, %d, 0x%02X },\n'
+                  % (lower, upper, fold, flags))
+    out.write('    };\n')
+    ucd.emit_trie(out, values, ucd.best_block_bits(values), value_type)
+    out.write('    static constexpr special_mapping special_mappings[%d] = {\n'
+              % len(special_mappings))
+    for cp, mappings in special_mappings:
+        out.write('        { 0x%04X, %s },\n' % (cp, ', '.join(
+            '{ %s }' % ', '.join('0x%04X' % m for m in mapping)
+            for mapping in mappings)))
+    out.write('    };\n')
+    out.write('};\n')
+    out.write(ucd.FOOTER.format(guard=GUARD))
+
+
+if __name__ == '__main__':
+    main()
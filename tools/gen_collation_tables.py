@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016, Tom Honermann
+#
+# This file is distributed under the MIT License. See the accompanying file
+# LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+# and conditions.
+
+# Generates include/text_view_detail/unicode/collation_tables.hpp.
+#
+# Collation elements are read from the Default Unicode Collation Element Table
+# (DUCET), uca/allkeys.txt, which the Makefile ucd target downloads alongside
+# the UCD files.  Its version, UCA_VERSION in the Makefile, is set apart from
+# that of the UCD and is named in the generated table.  Since text is
+# converted to NFD before collation elements are looked up, entries for code
+# points with a canonical decomposition (NFD_QC=N in
+# DerivedNormalizationProps.txt) are omitted.  The ranges of unified
+# ideographs, which are assigned implicit weights, are read from PropList.txt
+# and limited to the code points that DerivedAge.txt shows were assigned by
+# the version of the DUCET, so that ideographs the DUCET does not know of have
+# the implicit weights of unassigned code points like other new characters.
+#
+# A collation element is packed into 32 bits as the primary weight in bits
+# 16-31, the secondary weight in bits 7-15, the tertiary weight in bits 2-6,
+# and a tag of 1 in bits 0-1.  The trie holds, for each code point, either its
+# collation element if it has exactly one (tag 1), the index and count of its
+# collation elements in 'elements' (tag 2), the index of its node in
+# 'contractions' if it begins a contraction (tag 3), or zero if it has
+# implicit weights.  The nodes of the contraction trie that follow a node are
+# stored contiguously and ordered by code point.
+#
+# usage: gen_collation_tables.py <ucd directory> > collation_tables.hpp
+
+import re
+import sys
+
+import ucd
+
+SINGLE = 1
+EXPANSION = 2
+CONTRACTION = 3
+
+# Implicit weight bases (UTS #10 section 10.1.3).
+CORE_HAN_BASE = 0xFB40
+OTHER_HAN_BASE = 0xFB80
+UNASSIGNED_BASE = 0xFBC0
+CORE_HAN_BLOCKS = [(0x4E00, 0x9FFF), (0xF900, 0xFAFF)]
+
+COMMENT = '''
+Collation element table
+The collation elements of the DUCET, version {version}, packed as
+described in tools/gen_collation_tables.py.  'ascii' holds the collation
+element of each ASCII character when it does not begin a contraction.  Code
+points without an entry have implicit weights computed from the first
+implicit range that contains them; the primary weight of the first
+collation element is base + ((cp - origin) >> 15) and that of the second is
+((cp - origin) & 0x7FFF) | 0x8000.  Code points in no range have the base
+unassigned_base and origin zero.
+'''
+
+GUARD = 'TEXT_VIEW_UNICODE_COLLATION_TABLES_HPP'
+
+_ELEMENT = re.compile(r'\[[.*]([0-9A-F]{4})\.([0-9A-F]{4})\.([0-9A-F]{4})\]')
+
+
+def read_allkeys(ucd_dir):
+    """Returns a dictionary mapping tuples of code points to lists of
+    (primary, secondary, tertiary) collation elements, and a list of the
+    (first, last, base) implicit weight ranges named by @implicitweights."""
+    table = {}
+    implicit = []
+    with open(ucd_dir + '/uca/allkeys.txt', encoding='utf-8') as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if line.startswith('@implicitweights'):
+                cps, base = line.split(None, 1)[1].split(';')
+                first, last = cps.strip().split('..')
+                implicit.append((int(first, 16), int(last, 16),
+                                 int(base, 16)))
+            elif line and not line.startswith('@'):
+                cps, elements = line.split(';')
+                table[tuple(int(cp, 16) for cp in cps.split())] = [
+                    tuple(int(w, 16) for w in m)
+                    for m in _ELEMENT.findall(elements)]
+    return table, implicit
+
+
+def pack(element):
+    primary, secondary, tertiary = element
+    # Sort keys store primary weights as two bytes with a non-zero first byte,
+    # secondary weights as one byte, less 0x1F, and tertiary weights as one
+    # byte; zero bytes separate the levels.
+    assert primary == 0 or 0x100 <= primary <= 0xFFFF
+    assert secondary == 0 or 0x20 <= secondary <= 0x11E
+    assert tertiary <= 0x1F
+    return primary << 16 | secondary << 7 | tertiary << 2 | SINGLE
+
+
+def implicit_ranges(ucd_dir, implicit, uca_version):
+    """Returns the (first, last, origin, base) implicit weight ranges, ordered
+    by code point."""
+    ranges = [(first, last, first, base) for first, last, base in implicit]
+    for first, last in sorted(_unified_ideographs(ucd_dir, uca_version)):
+        core = any(block_first <= first and last <= block_last
+                   for block_first, block_last in CORE_HAN_BLOCKS)
+        ranges.append((first, last, 0,
+                       CORE_HAN_BASE if core else OTHER_HAN_BASE))
+    return sorted(ranges)
+
+
+def _unified_ideographs(ucd_dir, uca_version):
+    """Returns the ranges of unified ideographs assigned by Unicode version
+    'uca_version'."""
+    major, minor = (int(v) for v in uca_version.split('.')[:2])
+    assigned = set()
+    for first, last, age in ucd.parse(ucd_dir, 'DerivedAge.txt'):
+        if tuple(int(v) for v in age.split('.')) <= (major, minor):
+            assigned.update(range(first, last + 1))
+    ranges = []
+    for first, last, value in ucd.parse(ucd_dir, 'PropList.txt'):
+        if value != 'Unified_Ideograph':
+            continue
+        cps = [cp for cp in range(first, last + 1) if cp in assigned]
+        for cp in cps:
+            if ranges and ranges[-1][1] == cp - 1 and ranges[-1][0] >= first:
+                ranges[-1] = (ranges[-1][0], cp)
+            else:
+                ranges.append((cp, cp))
+    return ranges
+
+
+def main():
+    ucd_dir = sys.argv[1]
+    table, implicit = read_allkeys(ucd_dir)
+    decomposable = ucd.read_code_points(
+        ucd_dir, 'DerivedNormalizationProps.txt', 'NFD_QC')
+    table = {cps: elements for cps, elements in table.items()
+             if not decomposable.intersection(cps)}
+
+    elements = []
+    sequences = {}
+
+    def add_elements(sequence):
+        """Returns the index of 'sequence' in 'elements'."""
+        packed = tuple(pack(element) for element in sequence)
+        if packed not in sequences:
+            sequences[packed] = len(elements)
+            elements.extend(packed)
+        return sequences[packed]
+
+    # Lay out the contraction trie breadth first, so that the nodes that
+    # follow each node are contiguous; the nodes of the starters come first.
+    contractions = [cps for cps in table if len(cps) > 1]
+    starters = sorted({cps[0] for cps in contractions})
+    nodes = [(cp,) for cp in starters]
+    children = {}
+    i = 0
+    while i < len(nodes):
+        prefix = nodes[i]
+        following = sorted({cps[:len(prefix) + 1] for cps in contractions
+                             if cps[:len(prefix)] == prefix
+                             and len(cps) > len(prefix)})
+        children[prefix] = (len(nodes), len(following))
+        nodes.extend(following)
+        i += 1
+    node_numbers = {cps: n for n, cps in enumerate(nodes)}
+
+    values = []
+    for cp in range(ucd.CODE_POINTS):
+        sequence = table.get((cp,))
+        if (cp,) in node_numbers:
+            values.append(node_numbers[(cp,)] << 2 | CONTRACTION)
+        elif sequence is None:
+            values.append(0)
+        elif len(sequence) == 1:
+            values.append(pack(sequence[0]))
+        else:
+            assert len(sequence) < 0x100
+            values.append((add_elements(sequence) << 8 | len(sequence)) << 2
+                          | EXPANSION)
+    node_elements = []
+    for cps in nodes:
+        sequence = table.get(cps, [])
+        node_elements.append(
+            (add_elements(sequence) if sequence else 0, len(sequence)))
+    assert len(elements) <= 0x10000 and len(nodes) <= 0x10000
+    ascii = []
+    for cp in range(0x80):
+        assert len(table[(cp,)]) == 1
+        ascii.append(pack(table[(cp,)][0]))
+    uca_version = ucd.version(ucd_dir, 'uca/allkeys.txt')
+    ranges = implicit_ranges(ucd_dir, implicit, uca_version)
+
+    out = sys.stdout
+    # The header names the versions of both the UCD and the DUCET.
+    ucd_version = ucd.version(ucd_dir, 'PropList.txt')
+    out.write(ucd.HEADER.format(
+        generator='gen_collation_tables.py', version=ucd_version,
+        guard=GUARD).replace(
+            'version %s.' % ucd_version,
+            'version %s, and the Default\n// Unicode Collation Element '
+            'Table, version %s.' % (ucd_version, uca_version)))
+    ucd.emit_comment(out, COMMENT.format(version=uca_version))
+    out.write('struct collation_table {\n')
+    out.write('    struct contraction {\n')
+    out.write('        char32_t code_point;\n')
+    out.write('        unsigned short elements;\n')
+    out.write('        unsigned char element_count;\n')
+    out.write('        unsigned short children;\n')
+    out.write('        unsigned short child_count;\n')
+    out.write('    };\n')
+    out.write('    struct implicit_range {\n')
+    out.write('        char32_t first;\n')
+    out.write('        char32_t last;\n')
+    out.write('        char32_t origin;\n')
+    out.write('        unsigned short base;\n')
+    out.write('    };\n')
+    out.write('    static constexpr unsigned default_value = 0;\n')
+    for name, value in [('single', SINGLE), ('expansion', EXPANSION),
+                        ('contraction_tag', CONTRACTION)]:
+        out.write('    static constexpr unsigned %s = %d;\n' % (name, value))
+    out.write('    static constexpr unsigned short unassigned_base = 0x%04X;\n'
+              % UNASSIGNED_BASE)
+    out.write('    static constexpr unsigned ascii[0x80] = {\n')
+    ucd.emit_array(out, ascii, '0x%08X', 6, '        ')
+    out.write('    };\n')
+    out.write('    static constexpr unsigned elements[%d] = {\n'
+              % max(len(elements), 1))
+    ucd.emit_array(out, elements or [0], '0x%08X', 6, '        ')
+    out.write('    };\n')
+    out.write('    static constexpr contraction contractions[%d] = {\n'
+              % len(nodes))
+    for cps, (index, count) in zip(nodes, node_elements):
+        first, child_count = children[cps]
+        out.write('        { 0x%04X, %d, %d, %d, %d },\n'
+                  % (cps[-1], index, count, first if child_count else 0,
+                     child_count))
+    out.write('    };\n')
+    out.write('    static constexpr implicit_range implicit_ranges[%d] = {\n'
+              % len(ranges))
+    for first, last, origin, base in ranges:
+        out.write('        { 0x%04X, 0x%04X, 0x%04X, 0x%04X },\n'
+                  % (first, last, origin, base))
+    out.write('    };\n')
+    ucd.emit_trie3(out, values, *ucd.best_trie3_bits(values, value_size=4),
+                   value_type='unsigned', value_fmt='0x%08X', per_line=6)
+    out.write('};\n')
+    out.write(ucd.FOOTER.format(guard=GUARD))
+
+
+if __name__ == '__main__':
+    main()
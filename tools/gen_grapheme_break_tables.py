@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016, Tom Honermann
+#
+# This file is distributed under the MIT License. See the accompanying file
+# LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+# and conditions.
+
+# Generates include/text_view_detail/unicode/grapheme_break_tables.hpp.
+#
+# The Grapheme_Cluster_Break property from auxiliary/GraphemeBreakProperty.txt
+# is combined with the Extended_Pictographic property from emoji/emoji-data.txt
+# (all Extended_Pictographic code points have a Grapheme_Cluster_Break value
+# of Other) into a single property used by the UAX #29 rules.  Code points
+# below latin_limit are additionally stored in a flat table so that Latin
+# text never consults the trie.
+#
+# usage: gen_grapheme_break_tables.py <ucd directory> > grapheme_break_tables.hpp
+
+import sys
+
+import ucd
+
+PROPERTIES = [
+    ('other', 'Other'),
+    ('cr', 'CR'),
+    ('lf', 'LF'),
+    ('control', 'Control'),
+    ('extend', 'Extend'),
+    ('zwj', 'ZWJ'),
+    ('regional_indicator', 'Regional_Indicator'),
+    ('prepend', 'Prepend'),
+    ('spacing_mark', 'SpacingMark'),
+    ('l', 'L'),
+    ('v', 'V'),
+    ('t', 'T'),
+    ('lv', 'LV'),
+    ('lvt', 'LVT'),
+    ('extended_pictographic', None),
+]
+
+LATIN_LIMIT = 0x300
+
+COMMENT = '''
+Grapheme_Cluster_Break property table
+The Grapheme_Cluster_Break property of UAX #29, with Extended_Pictographic
+code points given a property value of their own.  Code points below
+latin_limit are looked up in 'latin'; all others in the two-stage trie.
+'''
+
+GUARD = 'TEXT_VIEW_UNICODE_GRAPHEME_BREAK_TABLES_HPP'
+
+
+def grapheme_break_values(ucd_dir):
+    numbers = {ucd_name: i for i, (_, ucd_name) in enumerate(PROPERTIES)
+               if ucd_name}
+    names = ucd.read_property(
+        ucd_dir, 'auxiliary/GraphemeBreakProperty.txt', 'Other')
+    values = [numbers[name] for name in names]
+    extended_pictographic = len(PROPERTIES) - 1
+    for cp in ucd.read_code_points(
+            ucd_dir, 'emoji/emoji-data.txt', 'Extended_Pictographic'):
+        assert values[cp] == numbers['Other']
+        values[cp] = extended_pictographic
+    return values
+
+
+def main():
+    ucd_dir = sys.argv[1]
+    values = grapheme_break_values(ucd_dir)
+
+    out = sys.stdout
+    out.write(ucd.HEADER.format(
+        generator='gen_grapheme_break_tables.py',
+        version=ucd.version(ucd_dir, 'auxiliary/GraphemeBreakProperty.txt'),
+        guard=GUARD))
+    ucd.emit_property_struct(
+        out, 'grapheme_break_table', COMMENT,
+        [name for name, _ in PROPERTIES], values, LATIN_LIMIT)
+    out.write(ucd.FOOTER.format(guard=GUARD))
+
+
+if __name__ == '__main__':
+    main()
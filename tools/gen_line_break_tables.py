@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016, Tom Honermann
+#
+# This file is distributed under the MIT License. See the accompanying file
+# LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+# and conditions.
+
+# Generates include/text_view_detail/unicode/line_break_tables.hpp.
+#
+# The Line_Break property from LineBreak.txt is stored in the low bits of each
+# table entry after the classes AI, SG, XX, SA, and CJ are resolved as
+# specified by rule LB1 of UAX #14; SA resolves to CM or AL according to the
+# General_Category from extracted/DerivedGeneralCategory.txt.  Rule LB30 also
+# depends on the East_Asian_Width property from EastAsianWidth.txt, and rule
+# LB30b on unassigned Extended_Pictographic code points from
+# emoji/emoji-data.txt; both are stored as flag bits.  The enumerators are
+# the short property value aliases used in the rules of UAX #14.
+#
+# usage: gen_line_break_tables.py <ucd directory> > line_break_tables.hpp
+
+import sys
+
+import ucd
+
+PROPERTIES = [
+    'AL', 'BK', 'CR', 'LF', 'NL', 'SP', 'ZW', 'ZWJ', 'CM', 'WJ', 'GL', 'BA',
+    'HY', 'BB', 'B2', 'CB', 'CL', 'CP', 'EX', 'IS', 'SY', 'OP', 'QU', 'NS',
+    'IN', 'NU', 'PR', 'PO', 'HL', 'ID', 'EB', 'EM', 'H2', 'H3', 'JL', 'JV',
+    'JT', 'RI',
+]
+
+# LB1
+RESOLVED = {'AI': 'AL', 'SG': 'AL', 'XX': 'AL', 'CJ': 'NS'}
+
+PROPERTY_MASK = 0x3F
+EAST_ASIAN = 0x40
+PICTOGRAPHIC_UNASSIGNED = 0x80
+
+LATIN_LIMIT = 0x300
+
+COMMENT = '''
+Line_Break property table
+The Line_Break property of UAX #14, resolved as specified by rule LB1, in
+the bits selected by property_mask.  The east_asian bit is set for code
+points with an East_Asian_Width of F, W, or H (LB30), and the
+pictographic_unassigned bit for unassigned Extended_Pictographic code points
+(LB30b).  Code points below latin_limit are looked up in 'latin'; all others
+in the two-stage trie.
+'''
+
+GUARD = 'TEXT_VIEW_UNICODE_LINE_BREAK_TABLES_HPP'
+
+
+def line_break_values(ucd_dir):
+    numbers = {name: i for i, name in enumerate(PROPERTIES)}
+    assert len(numbers) <= PROPERTY_MASK + 1
+    names = ucd.read_property(ucd_dir, 'LineBreak.txt', 'XX')
+    categories = ucd.read_property(
+        ucd_dir, 'extracted/DerivedGeneralCategory.txt', 'Cn')
+    values = []
+    for name, category in zip(names, categories):
+        if name == 'SA':
+            name = 'CM' if category in ('Mn', 'Mc') else 'AL'
+        values.append(numbers[RESOLVED.get(name, name)])
+    widths = ucd.read_property(ucd_dir, 'EastAsianWidth.txt', 'N')
+    for cp, width in enumerate(widths):
+        if width in ('F', 'W', 'H'):
+            values[cp] |= EAST_ASIAN
+    for cp in ucd.read_code_points(
+            ucd_dir, 'emoji/emoji-data.txt', 'Extended_Pictographic'):
+        if categories[cp] == 'Cn':
+            values[cp] |= PICTOGRAPHIC_UNASSIGNED
+    return values
+
+
+def main():
+    ucd_dir = sys.argv[1]
+    values = line_break_values(ucd_dir)
+
+    out = sys.stdout
+    out.write(ucd.HEADER.format(
+        generator='gen_line_break_tables.py',
+        version=ucd.version(ucd_dir, 'LineBreak.txt'),
+        guard=GUARD))
+    ucd.emit_property_struct(
+        out, 'line_break_table', COMMENT,
+        [name.lower() for name in PROPERTIES], values, LATIN_LIMIT,
+        [('property_mask', PROPERTY_MASK),
+         ('east_asian', EAST_ASIAN),
+         ('pictographic_unassigned', PICTOGRAPHIC_UNASSIGNED)])
+    out.write(ucd.FOOTER.format(guard=GUARD))
+
+
+if __name__ == '__main__':
+    main()
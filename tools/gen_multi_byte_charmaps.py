@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016, Tom Honermann
+#
+# This file is distributed under the MIT License. See the accompanying file
+# LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+# and conditions.
+
+# Generates include/text_view_detail/codecs/multi_byte_charmaps.hpp.
+#
+# Two character maps are generated:
+#
+# - gb18030_charmap: a dense table for the 126x190 two-byte region, a block
+#   table mapping BMP code points back to two-byte sequences, and a range
+#   table for the four-byte BMP region.  The four-byte region is assigned to
+#   the BMP code points not covered by the two-byte region in code point
+#   order, so it compresses to a couple hundred (linear index, code point)
+#   pairs.  The supplementary planes are mapped algorithmically by the codec.
+#
+# - jis_x_0208_charmap: a row/cell table for JIS X 0208 and a block table
+#   mapping BMP code points back to row/cell pairs.  Shift_JIS is an
+#   arithmetic transformation of the row/cell pairs.
+#
+# Mappings are taken from the Python codec registry.  Only mappings that
+# round trip are included in the encoding tables.
+#
+# usage: gen_multi_byte_charmaps.py > multi_byte_charmaps.hpp
+
+import sys
+
+UNMAPPED = 0xFFFF
+BLOCK_BITS = 6
+BLOCK_SIZE = 1 << BLOCK_BITS
+
+
+def decode(octets, codec):
+    try:
+        s = octets.decode(codec)
+    except UnicodeDecodeError:
+        return None
+    if len(s) != 1:
+        return None
+    return ord(s)
+
+
+def gb18030_trail_bytes():
+    return list(range(0x40, 0x7F)) + list(range(0x80, 0xFF))
+
+
+def gb18030_two_byte_table():
+    table = []
+    for lead in range(0x81, 0xFF):
+        for trail in gb18030_trail_bytes():
+            cp = decode(bytes([lead, trail]), 'gb18030')
+            if cp is None:
+                table.append(UNMAPPED)
+            else:
+                assert cp < UNMAPPED
+                table.append(cp)
+    return table
+
+
+def gb18030_four_byte_ranges():
+    # Four-byte sequences b1 b2 b3 b4 are numbered by their linear index
+    # (((b1 - 0x81) * 10 + (b2 - 0x30)) * 126 + (b3 - 0x81)) * 10 + (b4 - 0x30).
+    ranges = []
+    linear = 0
+    for b1 in range(0x81, 0x85):
+        for b2 in range(0x30, 0x3A):
+            for b3 in range(0x81, 0xFF):
+                for b4 in range(0x30, 0x3A):
+                    cp = decode(bytes([b1, b2, b3, b4]), 'gb18030')
+                    if cp is not None:
+                        assert cp <= 0xFFFF
+                        if (ranges and
+                            ranges[-1][0] + ranges[-1][2] == linear and
+                            ranges[-1][1] + ranges[-1][2] == cp):
+                            ranges[-1][2] += 1
+                        else:
+                            # The codec derives range lengths from the start
+                            # of the following range, so ranges must be
+                            # contiguous in linear index.
+                            assert not ranges or \
+                                ranges[-1][0] + ranges[-1][2] == linear
+                            ranges.append([linear, cp, 1])
+                    linear += 1
+    for a, b in zip(ranges, ranges[1:]):
+        assert a[1] + a[2] <= b[1]
+    return ranges
+
+
+def jis_x_0208_table():
+    # Row/cell pairs are derived from the Shift_JIS codec.
+    table = [[UNMAPPED] * 94 for _ in range(94)]
+    rows = 0
+    for row in range(94):
+        for cell in range(94):
+            lead = (row >> 1) + (0x81 if row < 62 else 0xC1)
+            if row & 1:
+                trail = cell + 0x9F
+            else:
+                trail = cell + 0x40 + (1 if cell >= 0x3F else 0)
+            cp = decode(bytes([lead, trail]), 'shift_jis')
+            if cp is not None:
+                assert cp < UNMAPPED
+                table[row][cell] = cp
+                rows = max(rows, row + 1)
+    return table[:rows]
+
+
+def block_table(mapping):
+    # Maps BMP code points to values via an index of BLOCK_SIZE entry blocks.
+    # Block 0 is always empty so that unmapped code points resolve to 0.
+    blocks = {tuple([0] * BLOCK_SIZE): 0}
+    index = []
+    for b in range(0x10000 >> BLOCK_BITS):
+        block = tuple(mapping.get((b << BLOCK_BITS) + i, 0)
+                      for i in range(BLOCK_SIZE))
+        index.append(blocks.setdefault(block, len(blocks)))
+    ordered = sorted(blocks.items(), key=lambda kv: kv[1])
+    return index, [list(block) for block, _ in ordered]
+
+
+def emit_array(out, values, fmt, per_line, indent):
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        out.write(indent + ', '.join(fmt % v for v in chunk) + ',\n')
+
+
+def emit_blocks(out, index, blocks):
+    out.write('    static constexpr unsigned short '
+              'from_unicode_index[0x10000 >> %d] = {\n' % BLOCK_BITS)
+    emit_array(out, index, '%d', 16, '        ')
+    out.write('    };\n')
+    out.write('    static constexpr unsigned short '
+              'from_unicode_blocks[%d][%d] = {\n' % (len(blocks), BLOCK_SIZE))
+    for block in blocks:
+        out.write('        {\n')
+        emit_array(out, block, '0x%04X', 8, '            ')
+        out.write('        },\n')
+    out.write('    };\n')
+
+
+def emit_gb18030(out):
+    table = gb18030_two_byte_table()
+    mapping = {}
+    for i, cp in enumerate(table):
+        if cp == UNMAPPED:
+            continue
+        lead = 0x81 + i // 190
+        trail = gb18030_trail_bytes()[i % 190]
+        mapping.setdefault(cp, (lead << 8) | trail)
+    index, blocks = block_table(mapping)
+    ranges = gb18030_four_byte_ranges()
+    end = ranges[-1][0] + ranges[-1][2]
+
+    out.write('\n// GB18030\n')
+    out.write('struct gb18030_charmap {\n')
+    out.write('    static constexpr int block_bits = %d;\n' % BLOCK_BITS)
+    out.write('    static constexpr char16_t two_byte_to_unicode[126 * 190] = {\n')
+    emit_array(out, table, '0x%04X', 8, '        ')
+    out.write('    };\n')
+    emit_blocks(out, index, blocks)
+    out.write('    struct four_byte_range {\n')
+    out.write('        unsigned short linear;\n')
+    out.write('        char16_t code_point;\n')
+    out.write('    };\n')
+    out.write('    static constexpr int four_byte_range_count = %d;\n'
+              % len(ranges))
+    out.write('    static constexpr four_byte_range '
+              'four_byte_ranges[%d + 1] = {\n' % len(ranges))
+    for linear, cp, _ in ranges:
+        out.write('        { %5d, 0x%04X },\n' % (linear, cp))
+    out.write('        { %5d, 0xFFFF },\n' % end)
+    out.write('    };\n')
+    out.write('};\n')
+
+
+def emit_jis_x_0208(out):
+    table = jis_x_0208_table()
+    mapping = {}
+    for row, cells in enumerate(table):
+        for cell, cp in enumerate(cells):
+            if cp != UNMAPPED:
+                mapping.setdefault(cp, ((row + 0x21) << 8) | (cell + 0x21))
+    index, blocks = block_table(mapping)
+
+    out.write('\n// JIS X 0208\n')
+    out.write('struct jis_x_0208_charmap {\n')
+    out.write('    static constexpr int block_bits = %d;\n' % BLOCK_BITS)
+    out.write('    static constexpr int rows = %d;\n' % len(table))
+    out.write('    static constexpr char16_t to_unicode[%d][94] = {\n'
+              % len(table))
+    for cells in table:
+        out.write('        {\n')
+        emit_array(out, cells, '0x%04X', 8, '            ')
+        out.write('        },\n')
+    out.write('    };\n')
+    emit_blocks(out, index, blocks)
+    out.write('};\n')
+
+
+def main():
+    out = sys.stdout
+    out.write('''\
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+// This file is generated by tools/gen_multi_byte_charmaps.py.  Do not edit.
+
+#if !defined(TEXT_VIEW_CODECS_MULTI_BYTE_CHARMAPS_HPP) // {
+#define TEXT_VIEW_CODECS_MULTI_BYTE_CHARMAPS_HPP
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * Multi-byte character maps
+ * Decoding tables map a two-byte (or row/cell) index to a BMP code point;
+ * 0xFFFF denotes an unmapped sequence.  from_unicode_index maps the high bits
+ * of a BMP code point to an entry of from_unicode_blocks which in turn maps
+ * the low block_bits bits to an encoded two-byte value; 0 denotes a code
+ * point without a two-byte mapping.
+ */
+''')
+    emit_gb18030(out)
+    emit_jis_x_0208(out)
+    out.write('''
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CODECS_MULTI_BYTE_CHARMAPS_HPP
+''')
+
+
+if __name__ == '__main__':
+    main()
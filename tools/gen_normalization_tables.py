@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016, Tom Honermann
+#
+# This file is distributed under the MIT License. See the accompanying file
+# LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+# and conditions.
+
+# Generates include/text_view_detail/unicode/normalization_tables.hpp.
+#
+# The Canonical_Combining_Class property and decomposition mappings are read
+# from UnicodeData.txt; the quick check properties and Full_Composition_
+# Exclusion from DerivedNormalizationProps.txt.  Decomposition mappings are
+# stored fully decomposed so that a single lookup yields the complete
+# canonical or compatibility decomposition of a code point.  Hangul syllables
+# are decomposed and composed algorithmically and so do not appear in the
+# tables.
+#
+# usage: gen_normalization_tables.py <ucd directory> > normalization_tables.hpp
+
+import os
+import sys
+
+import ucd
+
+# Quick check flag bits, stored above the combining class.
+NFD_NO = 0x01
+NFKD_NO = 0x02
+NFC_NO = 0x04
+NFC_MAYBE = 0x08
+NFKC_NO = 0x10
+NFKC_MAYBE = 0x20
+
+QUICK_CHECK_FLAGS = {
+    ('NFD_QC', 'N'): NFD_NO,
+    ('NFKD_QC', 'N'): NFKD_NO,
+    ('NFC_QC', 'N'): NFC_NO,
+    ('NFC_QC', 'M'): NFC_MAYBE,
+    ('NFKC_QC', 'N'): NFKC_NO,
+    ('NFKC_QC', 'M'): NFKC_MAYBE,
+}
+
+PROPERTY_COMMENT = '''
+Normalization property table
+The Canonical_Combining_Class property in the low eight bits of each entry
+and the quick check properties in the bits above them: nfd_no, nfkd_no,
+nfc_no, nfc_maybe, nfkc_no, and nfkc_maybe are shifted left by
+quick_check_shift.
+'''
+
+DECOMPOSITION_COMMENT = '''
+Decomposition table
+For each code point that has a decomposition mapping, other than Hangul
+syllables, the trie holds the index in 'mappings' of an entry that consists
+of a header followed by the full canonical decomposition and then the full
+compatibility decomposition.  The low eight bits of the header are the length
+of the canonical decomposition, which is zero if there is none; the high bits
+are the length of the compatibility decomposition, which is zero if it is
+the same as the canonical decomposition.  Index zero denotes no mapping.
+'''
+
+COMPOSITION_COMMENT = '''
+Composition table
+The primary composites: pairs of code points that canonically compose, other
+than Hangul syllables, ordered by the first and then the second code point.
+'''
+
+GUARD = 'TEXT_VIEW_UNICODE_NORMALIZATION_TABLES_HPP'
+
+
+def read_unicode_data(ucd_dir):
+    """Returns dictionaries mapping code points to their canonical combining
+    class and to their decomposition mapping as a (compatibility, list of
+    code points) pair, for code points listed in UnicodeData.txt."""
+    combining = {}
+    decompositions = {}
+    path = os.path.join(ucd_dir, 'UnicodeData.txt')
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            fields = line.split(';')
+            if len(fields) < 6:
+                continue
+            cp = int(fields[0], 16)
+            if int(fields[3]):
+                combining[cp] = int(fields[3])
+            mapping = fields[5].split()
+            if mapping:
+                compatibility = mapping[0].startswith('<')
+                if compatibility:
+                    mapping = mapping[1:]
+                decompositions[cp] = (
+                    compatibility, [int(m, 16) for m in mapping])
+    return combining, decompositions
+
+
+def read_normalization_props(ucd_dir):
+    """Returns a list of the quick check flags of every code point and the
+    set of code points with the Full_Composition_Exclusion property."""
+    flags = [0] * ucd.CODE_POINTS
+    exclusions = set()
+    path = os.path.join(ucd_dir, 'DerivedNormalizationProps.txt')
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            fields = [field.strip() for field in line.split('#')[0].split(';')]
+            if len(fields) < 2:
+                continue
+            first, _, last = fields[0].partition('..')
+            code_points = range(int(first, 16), int(last or first, 16) + 1)
+            if fields[1] == 'Full_Composition_Exclusion':
+                exclusions.update(code_points)
+            elif tuple(fields[1:3]) in QUICK_CHECK_FLAGS:
+                flag = QUICK_CHECK_FLAGS[tuple(fields[1:3])]
+                for cp in code_points:
+                    flags[cp] |= flag
+    return flags, exclusions
+
+
+def full_decomposition(cp, decompositions, compatibility):
+    if cp not in decompositions:
+        return [cp]
+    is_compatibility, mapping = decompositions[cp]
+    if is_compatibility and not compatibility:
+        return [cp]
+    result = []
+    for m in mapping:
+        result.extend(full_decomposition(m, decompositions, compatibility))
+    return result
+
+
+def main():
+    ucd_dir = sys.argv[1]
+    combining, decompositions = read_unicode_data(ucd_dir)
+    flags, exclusions = read_normalization_props(ucd_dir)
+
+    properties = [combining.get(cp, 0) | flags[cp] << 8
+                  for cp in range(ucd.CODE_POINTS)]
+    # Code points below U+0300 all have a combining class of zero, which the
+    # lookup functions rely on.
+    assert all(combining.get(cp, 0) == 0 for cp in range(0x300))
+
+    mappings = [0]
+    indices = [0] * ucd.CODE_POINTS
+    for cp in sorted(decompositions):
+        canonical = full_decomposition(cp, decompositions, False)
+        compatibility = full_decomposition(cp, decompositions, True)
+        if canonical == [cp]:
+            canonical = []
+        if compatibility == (canonical or [cp]):
+            compatibility = []
+        indices[cp] = len(mappings)
+        mappings.append(len(canonical) | len(compatibility) << 8)
+        mappings.extend(canonical)
+        mappings.extend(compatibility)
+    assert len(mappings) < 0x10000
+
+    compositions = []
+    for cp, (compatibility, mapping) in decompositions.items():
+        if not compatibility and len(mapping) == 2 and cp not in exclusions:
+            compositions.append((mapping[0], mapping[1], cp))
+    compositions.sort()
+
+    out = sys.stdout
+    out.write(ucd.HEADER.format(
+        generator='gen_normalization_tables.py',
+        version=ucd.version(ucd_dir, 'DerivedNormalizationProps.txt'),
+        guard=GUARD))
+
+    ucd.emit_comment(out, PROPERTY_COMMENT)
+    out.write('struct normalization_property_table {\n')
+    out.write('    static constexpr unsigned short default_value = 0;\n')
+    out.write('    static constexpr int quick_check_shift = 8;\n')
+    for name, value in [('nfd_no', NFD_NO), ('nfkd_no', NFKD_NO),
+                        ('nfc_no', NFC_NO), ('nfc_maybe', NFC_MAYBE),
+                        ('nfkc_no', NFKC_NO), ('nfkc_maybe', NFKC_MAYBE)]:
+        out.write('    static constexpr unsigned char %s = 0x%02X;\n'
+                  % (name, value))
+    ucd.emit_trie(out, properties, ucd.best_block_bits(properties),
+                  'unsigned short', '0x%04X', 8)
+    out.write('};\n')
+
+    ucd.emit_comment(out, DECOMPOSITION_COMMENT)
+    out.write('struct decomposition_table {\n')
+    out.write('    static constexpr unsigned short default_value = 0;\n')
+    ucd.emit_trie(out, indices, ucd.best_block_bits(indices),
+                  'unsigned short', '%d', 8)
+    out.write('    static constexpr char32_t mappings[%d] = {\n'
+              % len(mappings))
+    ucd.emit_array(out, mappings, '0x%04X', 8, '        ')
+    out.write('    };\n')
+    out.write('};\n')
+
+    ucd.emit_comment(out, COMPOSITION_COMMENT)
+    out.write('struct composition_table {\n')
+    out.write('    struct composition {\n')
+    out.write('        char32_t first;\n')
+    out.write('        char32_t second;\n')
+    out.write('        char32_t composite;\n')
+    out.write('    };\n')
+    out.write('    static constexpr composition compositions[%d] = {\n'
+              % len(compositions))
+    for first, second, composite in compositions:
+        out.write('        { 0x%04X, 0x%04X, 0x%04X },\n'
+                  % (first, second, composite))
+    out.write('    };\n')
+    out.write('};\n')
+    out.write(ucd.FOOTER.format(guard=GUARD))
+
+
+if __name__ == '__main__':
+    main()
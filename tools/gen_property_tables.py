@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016, Tom Honermann
+#
+# This file is distributed under the MIT License. See the accompanying file
+# LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+# and conditions.
+
+# Generates include/text_view_detail/unicode/property_tables.hpp.
+#
+# The General_Category property is read from
+# extracted/DerivedGeneralCategory.txt, Script from Scripts.txt,
+# East_Asian_Width from EastAsianWidth.txt, Numeric_Value from
+# extracted/DerivedNumericValues.txt, White_Space from PropList.txt, and the
+# remaining binary properties from DerivedCoreProperties.txt.  The properties
+# of a code point are stored together in a record; the few thousand distinct
+# records are stored once and a three-stage trie holds the index of the record
+# for each code point, so that all properties of a code point are found with a
+# single lookup in tables small enough to remain in a second level cache.
+# Enumerators are the lowercase short property value aliases for the general
+# category and East Asian width, and the lowercase long property value aliases
+# for scripts; the aliases themselves are emitted, in enumerator order, for
+# looking up property values by name.
+#
+# usage: gen_property_tables.py <ucd directory> > property_tables.hpp
+
+import fractions
+import sys
+
+import ucd
+
+GENERAL_CATEGORIES = [
+    'Cn', 'Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Mn', 'Mc', 'Me', 'Nd', 'Nl', 'No',
+    'Pc', 'Pd', 'Ps', 'Pe', 'Pi', 'Pf', 'Po', 'Sm', 'Sc', 'Sk', 'So', 'Zs',
+    'Zl', 'Zp', 'Cc', 'Cf', 'Cs', 'Co',
+]
+
+EAST_ASIAN_WIDTHS = ['N', 'A', 'F', 'H', 'Na', 'W']
+
+# Unassigned code points in these ranges default to an East_Asian_Width of W
+# as documented in EastAsianWidth.txt.
+WIDE_RANGES = [
+    (0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF),
+    (0x20000, 0x2FFFD), (0x30000, 0x3FFFD),
+]
+
+BINARY_PROPERTIES = [
+    ('alphabetic', 'DerivedCoreProperties.txt', 'Alphabetic'),
+    ('lowercase', 'DerivedCoreProperties.txt', 'Lowercase'),
+    ('uppercase', 'DerivedCoreProperties.txt', 'Uppercase'),
+    ('white_space', 'PropList.txt', 'White_Space'),
+    ('math', 'DerivedCoreProperties.txt', 'Math'),
+    ('default_ignorable', 'DerivedCoreProperties.txt',
+     'Default_Ignorable_Code_Point'),
+]
+
+COMMENT = '''
+Unicode property table
+Each record holds the General_Category (gc), Script (sc), and
+East_Asian_Width (ea) of a code point, flags for its binary properties, and
+the index in numeric_values of its Numeric_Value (nv); index zero denotes
+that the code point has no numeric value.  general_category_names and
+script_names hold the property value aliases of the enumerators.  The
+three-stage trie holds the index of the record for each code point.
+'''
+
+GUARD = 'TEXT_VIEW_UNICODE_PROPERTY_TABLES_HPP'
+
+
+def read_numeric_values(ucd_dir):
+    """Returns a dictionary mapping code points to their Numeric_Value as a
+    fraction."""
+    values = {}
+    for first, last, _, _, rational in ucd.parse_fields(
+            ucd_dir, 'extracted/DerivedNumericValues.txt'):
+        for cp in range(first, last + 1):
+            values[cp] = fractions.Fraction(rational)
+    return values
+
+
+def enumerator(name):
+    return name.lower()
+
+
+def main():
+    ucd_dir = sys.argv[1]
+    categories = ucd.read_property(
+        ucd_dir, 'extracted/DerivedGeneralCategory.txt', 'Cn')
+    scripts = ucd.read_property(ucd_dir, 'Scripts.txt', 'Unknown')
+    widths = ucd.read_property(ucd_dir, 'EastAsianWidth.txt', None)
+    for first, last in WIDE_RANGES:
+        for cp in range(first, last + 1):
+            if widths[cp] is None:
+                widths[cp] = 'W'
+    widths = [width or 'N' for width in widths]
+    numeric_values = read_numeric_values(ucd_dir)
+    binary = [ucd.read_code_points(ucd_dir, path, value)
+              for _, path, value in BINARY_PROPERTIES]
+
+    script_names = ['Unknown', 'Common', 'Inherited'] + sorted(
+        set(scripts) - {'Unknown', 'Common', 'Inherited'})
+    script_numbers = {name: i for i, name in enumerate(script_names)}
+    category_numbers = {name: i for i, name in enumerate(GENERAL_CATEGORIES)}
+    width_numbers = {name: i for i, name in enumerate(EAST_ASIAN_WIDTHS)}
+    assert len(script_names) <= 256
+
+    numbers = {None: 0}
+    # Record zero, the default value, holds the properties of unassigned code
+    # points.
+    records = {(category_numbers['Cn'], script_numbers['Unknown'],
+                width_numbers['N'], 0, 0): 0}
+    values = []
+    for cp in range(ucd.CODE_POINTS):
+        flags = 0
+        for i, code_points in enumerate(binary):
+            if cp in code_points:
+                flags |= 1 << i
+        nv = numeric_values.get(cp)
+        record = (category_numbers[categories[cp]], script_numbers[scripts[cp]],
+                  width_numbers[widths[cp]], flags,
+                  numbers.setdefault(nv, len(numbers)))
+        values.append(records.setdefault(record, len(records)))
+    assert len(records) <= 0x10000
+
+    out = sys.stdout
+    out.write(ucd.HEADER.format(
+        generator='gen_property_tables.py',
+        version=ucd.version(ucd_dir, 'Scripts.txt'),
+        guard=GUARD))
+    ucd.emit_comment(out, COMMENT)
+    out.write('struct unicode_property_table {\n')
+    for name, enumerators in [
+            ('general_category', GENERAL_CATEGORIES),
+            ('script', script_names),
+            ('east_asian_width', EAST_ASIAN_WIDTHS)]:
+        out.write('    enum class %s : unsigned char {\n' % name)
+        for e in enumerators:
+            out.write('        %s,\n' % enumerator(e))
+        out.write('    };\n')
+    out.write('    struct record {\n')
+    out.write('        general_category gc;\n')
+    out.write('        script sc;\n')
+    out.write('        east_asian_width ea;\n')
+    out.write('        unsigned char flags;\n')
+    out.write('        unsigned short nv;\n')
+    out.write('    };\n')
+    out.write('    struct numeric_value {\n')
+    out.write('        long long numerator;\n')
+    out.write('        long long denominator;\n')
+    out.write('    };\n')
+    out.write('    static constexpr unsigned short default_value = 0;\n')
+    for i, (name, _, _) in enumerate(BINARY_PROPERTIES):
+        out.write('    static constexpr unsigned char %s = 0x%02X;\n'
+                  % (name, 1 << i))
+    out.write('    static constexpr record records[%d] = {\n' % len(records))
+    for gc, sc, ea, flags, nv in sorted(records, key=records.get):
+        out.write('        { general_category::%s, script::%s, '
+                  'east_asian_width::%s, 0x%02X, %d },\n'
+                  % (enumerator(GENERAL_CATEGORIES[gc]),
+                     enumerator(script_names[sc]),
+                     enumerator(EAST_ASIAN_WIDTHS[ea]), flags, nv))
+    out.write('    };\n')
+    out.write('    static constexpr numeric_value numeric_values[%d] = {\n'
+              % len(numbers))
+    out.write('        { 0, 1 },\n')
+    for nv in sorted((v for v in numbers if v is not None), key=numbers.get):
+        out.write('        { %dLL, %d },\n' % (nv.numerator, nv.denominator))
+    out.write('    };\n')
+    for name, aliases in [('general_category_names', GENERAL_CATEGORIES),
+                          ('script_names', script_names)]:
+        out.write('    static constexpr const char *%s[%d] = {\n'
+                  % (name, len(aliases)))
+        for alias in aliases:
+            out.write('        "%s",\n' % alias)
+        out.write('    };\n')
+    ucd.emit_trie3(out, values, *ucd.best_trie3_bits(values))
+    out.write('};\n')
+    out.write(ucd.FOOTER.format(guard=GUARD))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016, Tom Honermann
+#
+# This file is distributed under the MIT License. See the accompanying file
+# LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+# and conditions.
+
+# Generates include/text_view_detail/unicode/sentence_break_tables.hpp from
+# auxiliary/SentenceBreakProperty.txt.
+#
+# usage: gen_sentence_break_tables.py <ucd directory> > sentence_break_tables.hpp
+
+import sys
+
+import ucd
+
+PROPERTIES = [
+    ('other', 'Other'),
+    ('cr', 'CR'),
+    ('lf', 'LF'),
+    ('extend', 'Extend'),
+    ('sep', 'Sep'),
+    ('format', 'Format'),
+    ('sp', 'Sp'),
+    ('lower', 'Lower'),
+    ('upper', 'Upper'),
+    ('oletter', 'OLetter'),
+    ('numeric', 'Numeric'),
+    ('aterm', 'ATerm'),
+    ('scontinue', 'SContinue'),
+    ('sterm', 'STerm'),
+    ('close', 'Close'),
+]
+
+LATIN_LIMIT = 0x300
+
+COMMENT = '''
+Sentence_Break property table
+The Sentence_Break property of UAX #29.  Code points below latin_limit are
+looked up in 'latin'; all others in the two-stage trie.
+'''
+
+GUARD = 'TEXT_VIEW_UNICODE_SENTENCE_BREAK_TABLES_HPP'
+
+
+def main():
+    ucd_dir = sys.argv[1]
+    numbers = {ucd_name: i for i, (_, ucd_name) in enumerate(PROPERTIES)}
+    names = ucd.read_property(
+        ucd_dir, 'auxiliary/SentenceBreakProperty.txt', 'Other')
+    values = [numbers[name] for name in names]
+
+    out = sys.stdout
+    out.write(ucd.HEADER.format(
+        generator='gen_sentence_break_tables.py',
+        version=ucd.version(ucd_dir, 'auxiliary/SentenceBreakProperty.txt'),
+        guard=GUARD))
+    ucd.emit_property_struct(
+        out, 'sentence_break_table', COMMENT,
+        [name for name, _ in PROPERTIES], values, LATIN_LIMIT)
+    out.write(ucd.FOOTER.format(guard=GUARD))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016, Tom Honermann
+#
+# This file is distributed under the MIT License. See the accompanying file
+# LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+# and conditions.
+
+# Generates include/text_view_detail/codecs/single_byte_charmaps.hpp.
+#
+# Each single-byte character map consists of a 256 entry table that maps code
+# unit values to Unicode code points and a two-level page table that maps
+# Unicode code points in the BMP back to code unit values.  Mappings are taken
+# from the Python codec registry, which tracks the unicode.org and Microsoft
+# published mapping files.
+#
+# usage: gen_single_byte_charmaps.py > single_byte_charmaps.hpp
+
+import codecs
+import sys
+
+# (C++ identifier prefix, Python codec name, description)
+CHARMAPS = [
+    ('iso_8859_1',   'iso8859_1',  'ISO/IEC 8859-1 (Latin-1)'),
+    ('iso_8859_2',   'iso8859_2',  'ISO/IEC 8859-2 (Latin-2)'),
+    ('iso_8859_3',   'iso8859_3',  'ISO/IEC 8859-3 (Latin-3)'),
+    ('iso_8859_4',   'iso8859_4',  'ISO/IEC 8859-4 (Latin-4)'),
+    ('iso_8859_5',   'iso8859_5',  'ISO/IEC 8859-5 (Latin/Cyrillic)'),
+    ('iso_8859_6',   'iso8859_6',  'ISO/IEC 8859-6 (Latin/Arabic)'),
+    ('iso_8859_7',   'iso8859_7',  'ISO/IEC 8859-7 (Latin/Greek)'),
+    ('iso_8859_8',   'iso8859_8',  'ISO/IEC 8859-8 (Latin/Hebrew)'),
+    ('iso_8859_9',   'iso8859_9',  'ISO/IEC 8859-9 (Latin-5)'),
+    ('iso_8859_10',  'iso8859_10', 'ISO/IEC 8859-10 (Latin-6)'),
+    ('iso_8859_11',  'iso8859_11', 'ISO/IEC 8859-11 (Latin/Thai)'),
+    ('iso_8859_13',  'iso8859_13', 'ISO/IEC 8859-13 (Latin-7)'),
+    ('iso_8859_14',  'iso8859_14', 'ISO/IEC 8859-14 (Latin-8)'),
+    ('iso_8859_15',  'iso8859_15', 'ISO/IEC 8859-15 (Latin-9)'),
+    ('iso_8859_16',  'iso8859_16', 'ISO/IEC 8859-16 (Latin-10)'),
+    ('windows_1250', 'cp1250',     'Windows-1250 (Central European)'),
+    ('windows_1251', 'cp1251',     'Windows-1251 (Cyrillic)'),
+    ('windows_1252', 'cp1252',     'Windows-1252 (Western European)'),
+    ('windows_1253', 'cp1253',     'Windows-1253 (Greek)'),
+    ('windows_1254', 'cp1254',     'Windows-1254 (Turkish)'),
+    ('windows_1255', 'cp1255',     'Windows-1255 (Hebrew)'),
+    ('windows_1256', 'cp1256',     'Windows-1256 (Arabic)'),
+    ('windows_1257', 'cp1257',     'Windows-1257 (Baltic)'),
+    ('windows_1258', 'cp1258',     'Windows-1258 (Vietnamese)'),
+]
+
+UNMAPPED = 0xFFFF
+
+
+def decode_table(codec):
+    table = []
+    for b in range(256):
+        try:
+            s = bytes([b]).decode(codec)
+        except UnicodeDecodeError:
+            table.append(UNMAPPED)
+            continue
+        assert len(s) == 1 and ord(s) < UNMAPPED
+        table.append(ord(s))
+    return table
+
+
+def encode_pages(table):
+    # Page 0 of the generated page array is always empty so that code points
+    # in pages without any mapping resolve to an unmapped (0) entry without a
+    # branch.  Code unit 0 is only ever produced for U+0000.
+    page_numbers = sorted(set(cp >> 8 for cp in table if cp != UNMAPPED))
+    index = [0] * 256
+    pages = [[0] * 256]
+    for page in page_numbers:
+        index[page] = len(pages)
+        pages.append([0] * 256)
+    for b, cp in enumerate(table):
+        if cp == UNMAPPED:
+            continue
+        pages[index[cp >> 8]][cp & 0xFF] = b
+    return index, pages
+
+
+def emit_array(out, values, fmt, per_line, indent):
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        out.write(indent + ', '.join(fmt % v for v in chunk) + ',\n')
+
+
+def main():
+    out = sys.stdout
+    out.write('''\
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+// This file is generated by tools/gen_single_byte_charmaps.py.  Do not edit.
+
+#if !defined(TEXT_VIEW_CODECS_SINGLE_BYTE_CHARMAPS_HPP) // {
+#define TEXT_VIEW_CODECS_SINGLE_BYTE_CHARMAPS_HPP
+
+
+namespace std {
+namespace experimental {
+inline namespace text {
+namespace text_detail {
+
+
+/*
+ * Single-byte character maps
+ * to_unicode maps each code unit value to a Unicode code point; 0xFFFF denotes
+ * an unmapped code unit.  A trailing padding element permits 32-bit gathers of
+ * any entry.  from_unicode_index maps the high octet of a BMP code point to an
+ * entry of from_unicode_pages which in turn maps the low octet to a code unit
+ * value; 0 denotes an unmapped code point (other than U+0000).
+ */
+''')
+    for ident, codec, description in CHARMAPS:
+        table = decode_table(codec)
+        index, pages = encode_pages(table)
+        out.write('\n// %s\n' % description)
+        out.write('struct %s_charmap {\n' % ident)
+        out.write('    static constexpr char16_t to_unicode[256 + 1] = {\n')
+        emit_array(out, table + [UNMAPPED], '0x%04X', 8, '        ')
+        out.write('    };\n')
+        out.write('    static constexpr unsigned char from_unicode_index[256] = {\n')
+        emit_array(out, index, '%d', 16, '        ')
+        out.write('    };\n')
+        out.write('    static constexpr unsigned char '
+                  'from_unicode_pages[%d][256] = {\n' % len(pages))
+        for page in pages:
+            out.write('        {\n')
+            emit_array(out, page, '0x%02X', 16, '            ')
+            out.write('        },\n')
+        out.write('    };\n')
+        out.write('};\n')
+    out.write('''
+
+} // namespace text_detail
+} // inline namespace text
+} // namespace experimental
+} // namespace std
+
+
+#endif // } TEXT_VIEW_CODECS_SINGLE_BYTE_CHARMAPS_HPP
+''')
+
+
+if __name__ == '__main__':
+    main()
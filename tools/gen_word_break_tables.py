@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+# Copyright (c) 2016, Tom Honermann
+#
+# This file is distributed under the MIT License. See the accompanying file
+# LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+# and conditions.
+
+# Generates include/text_view_detail/unicode/word_break_tables.hpp.
+#
+# The Word_Break property from auxiliary/WordBreakProperty.txt is stored in
+# the low bits of each table entry.  Extended_Pictographic, from
+# emoji/emoji-data.txt, is needed only by rule WB3c and overlaps other
+# Word_Break values, so it is stored as a flag bit.
+#
+# usage: gen_word_break_tables.py <ucd directory> > word_break_tables.hpp
+
+import sys
+
+import ucd
+
+PROPERTIES = [
+    ('other', 'Other'),
+    ('cr', 'CR'),
+    ('lf', 'LF'),
+    ('newline', 'Newline'),
+    ('extend', 'Extend'),
+    ('zwj', 'ZWJ'),
+    ('regional_indicator', 'Regional_Indicator'),
+    ('format', 'Format'),
+    ('katakana', 'Katakana'),
+    ('hebrew_letter', 'Hebrew_Letter'),
+    ('aletter', 'ALetter'),
+    ('single_quote', 'Single_Quote'),
+    ('double_quote', 'Double_Quote'),
+    ('midnumlet', 'MidNumLet'),
+    ('midletter', 'MidLetter'),
+    ('midnum', 'MidNum'),
+    ('numeric', 'Numeric'),
+    ('extendnumlet', 'ExtendNumLet'),
+    ('wsegspace', 'WSegSpace'),
+]
+
+PROPERTY_MASK = 0x1F
+EXTENDED_PICTOGRAPHIC = 0x20
+
+LATIN_LIMIT = 0x300
+
+COMMENT = '''
+Word_Break property table
+The Word_Break property of UAX #29 in the bits selected by property_mask,
+and the Extended_Pictographic property in the extended_pictographic bit.
+Code points below latin_limit are looked up in 'latin'; all others in the
+two-stage trie.
+'''
+
+GUARD = 'TEXT_VIEW_UNICODE_WORD_BREAK_TABLES_HPP'
+
+
+def word_break_values(ucd_dir):
+    numbers = {ucd_name: i for i, (_, ucd_name) in enumerate(PROPERTIES)}
+    assert len(numbers) <= PROPERTY_MASK + 1
+    names = ucd.read_property(
+        ucd_dir, 'auxiliary/WordBreakProperty.txt', 'Other')
+    values = [numbers[name] for name in names]
+    for cp in ucd.read_code_points(
+            ucd_dir, 'emoji/emoji-data.txt', 'Extended_Pictographic'):
+        values[cp] |= EXTENDED_PICTOGRAPHIC
+    return values
+
+
+def main():
+    ucd_dir = sys.argv[1]
+    values = word_break_values(ucd_dir)
+
+    out = sys.stdout
+    out.write(ucd.HEADER.format(
+        generator='gen_word_break_tables.py',
+        version=ucd.version(ucd_dir, 'auxiliary/WordBreakProperty.txt'),
+        guard=GUARD))
+    ucd.emit_property_struct(
+        out, 'word_break_table', COMMENT,
+        [name for name, _ in PROPERTIES], values, LATIN_LIMIT,
+        [('property_mask', PROPERTY_MASK),
+         ('extended_pictographic', EXTENDED_PICTOGRAPHIC)])
+    out.write(ucd.FOOTER.format(guard=GUARD))
+
+
+if __name__ == '__main__':
+    main()
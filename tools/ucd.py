@@ -0,0 +1,243 @@
+# Copyright (c) 2016, Tom Honermann
+#
+# This file is distributed under the MIT License. See the accompanying file
+# LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+# and conditions.
+
+# Helpers shared by the generators of Unicode property tables.
+#
+# Property values are read from Unicode Character Database (UCD) files in the
+# directory given on the command line, laid out as in
+# https://www.unicode.org/Public/<version>/ucd/ (e.g. auxiliary/ and emoji/
+# subdirectories).  The Makefile ucd target downloads them.
+#
+# Tables are emitted as two-stage tries: 'index' maps the high bits of a code
+# point to an entry of 'blocks' which in turn maps the low block_bits bits to
+# a value.  Identical blocks are shared, so tables for properties that are
+# constant over large ranges of code points are small.
+
+import os
+import re
+
+CODE_POINTS = 0x110000
+
+HEADER = '''\
+// Copyright (c) 2016, Tom Honermann
+//
+// This file is distributed under the MIT License. See the accompanying file
+// LICENSE.txt or http://www.opensource.org/licenses/mit-license.php for terms
+// and conditions.
+
+// This file is generated by tools/{generator} from the Unicode
+// Character Database, version {version}.  Do not edit.
+
+#if !defined({guard}) // {{
+#define {guard}
+
+
+namespace std {{
+namespace experimental {{
+inline namespace text {{
+namespace text_detail {{
+
+'''
+
+FOOTER = '''
+
+}} // namespace text_detail
+}} // inline namespace text
+}} // namespace experimental
+}} // namespace std
+
+
+#endif // }} {guard}
+'''
+
+_LINE = re.compile(r'^([0-9A-Fa-f]+)(?:\.\.([0-9A-Fa-f]+))?\s*;\s*([^#;]*?)\s*(?:[#;].*)?$')
+_VERSION = re.compile(r'^#.*-(\d+\.\d+\.\d+)\.txt')
+
+
+def read_property(ucd_dir, path, default, values=None):
+    """Returns a list of the property values assigned to every code point by
+    the UCD file 'path'.  Code points not listed are assigned 'default'.  If
+    'values' is given, only the listed values are assigned."""
+    table = [default] * CODE_POINTS
+    for first, last, value in parse(ucd_dir, path):
+        if values is None or value in values:
+            for cp in range(first, last + 1):
+                table[cp] = value
+    return table
+
+
+def read_code_points(ucd_dir, path, value):
+    """Returns the set of code points assigned 'value' by the UCD file
+    'path'."""
+    result = set()
+    for first, last, v in parse(ucd_dir, path):
+        if v == value:
+            result.update(range(first, last + 1))
+    return result
+
+
+def parse(ucd_dir, path):
+    with open(os.path.join(ucd_dir, path), encoding='utf-8') as f:
+        for line in f:
+            m = _LINE.match(line.strip())
+            if m:
+                first = int(m.group(1), 16)
+                last = int(m.group(2), 16) if m.group(2) else first
+                yield first, last, m.group(3)
+
+
+def parse_fields(ucd_dir, path):
+    """Yields the first and last code point and the remaining fields of each
+    line of the UCD file 'path'."""
+    with open(os.path.join(ucd_dir, path), encoding='utf-8') as f:
+        for line in f:
+            fields = [field.strip() for field in line.split('#')[0].split(';')]
+            if len(fields) < 2:
+                continue
+            first, _, last = fields[0].partition('..')
+            yield (int(first, 16), int(last or first, 16)) + tuple(fields[1:])
+
+
+def version(ucd_dir, path):
+    """Returns the Unicode version named in the header line of the UCD file
+    'path', e.g. "# GraphemeBreakProperty-14.0.0.txt"."""
+    with open(os.path.join(ucd_dir, path), encoding='utf-8') as f:
+        m = _VERSION.match(f.readline())
+    if not m:
+        raise ValueError('%s: no version in header line' % path)
+    return m.group(1)
+
+
+def build_trie(values, block_bits):
+    """Returns (index, blocks) for the list of integer 'values'."""
+    blocks = {}
+    index = []
+    for b in range(len(values) >> block_bits):
+        block = tuple(values[b << block_bits:(b + 1) << block_bits])
+        index.append(blocks.setdefault(block, len(blocks)))
+    ordered = sorted(blocks.items(), key=lambda kv: kv[1])
+    return index, [list(block) for block, _ in ordered]
+
+
+def best_block_bits(values, candidates=(5, 6, 7, 8)):
+    """Returns the block size from 'candidates' that minimizes table size."""
+    def size(bits):
+        index, blocks = build_trie(values, bits)
+        index_size = 1 if len(blocks) <= 256 else 2
+        return len(index) * index_size + len(blocks) * (1 << bits)
+    return min(candidates, key=size)
+
+
+def emit_array(out, values, fmt, per_line, indent):
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        out.write(indent + ', '.join(fmt % v for v in chunk) + ',\n')
+
+
+def emit_trie(out, values, block_bits, value_type='unsigned char',
+              value_fmt='%d', per_line=16):
+    """Writes the index, blocks, and block_bits members of a struct that
+    models a two-stage trie."""
+    index, blocks = build_trie(values, block_bits)
+    index_type = 'unsigned char' if len(blocks) <= 256 else 'unsigned short'
+    out.write('    static constexpr int block_bits = %d;\n' % block_bits)
+    out.write('    static constexpr %s index[0x110000 >> %d] = {\n'
+              % (index_type, block_bits))
+    emit_array(out, index, '%d', 16, '        ')
+    out.write('    };\n')
+    out.write('    static constexpr %s blocks[%d][%d] = {\n'
+              % (value_type, len(blocks), 1 << block_bits))
+    for block in blocks:
+        out.write('        {\n')
+        emit_array(out, block, value_fmt, per_line, '            ')
+        out.write('        },\n')
+    out.write('    };\n')
+
+
+def best_trie3_bits(values, candidates=(4, 5, 6), index_candidates=(3, 4, 5, 6),
+                    value_size=2):
+    """Returns the (block_bits, index_block_bits) pair from 'candidates' and
+    'index_candidates' that minimizes the size of a three-stage trie of
+    'values' with values of 'value_size' bytes."""
+    def size(bits):
+        block_bits, index_block_bits = bits
+        index, blocks = build_trie(values, block_bits)
+        index1, index_blocks = build_trie(index, index_block_bits)
+        index_size = 1 if len(blocks) <= 256 else 2
+        index1_size = 1 if len(index_blocks) <= 256 else 2
+        return (len(index1) * index1_size +
+                len(index_blocks) * (1 << index_block_bits) * index_size +
+                len(blocks) * (1 << block_bits) * value_size)
+    return min(((b, i) for b in candidates for i in index_candidates),
+               key=size)
+
+
+def emit_trie3(out, values, block_bits, index_block_bits,
+               value_type='unsigned short', value_fmt='%d', per_line=16):
+    """Writes the index, index_blocks, blocks, block_bits, and
+    index_block_bits members of a struct that models a three-stage trie; the
+    second stage of a two-stage trie is itself stored as a two-stage trie."""
+    index, blocks = build_trie(values, block_bits)
+    index1, index_blocks = build_trie(index, index_block_bits)
+    index_type = 'unsigned char' if len(blocks) <= 256 else 'unsigned short'
+    index1_type = ('unsigned char' if len(index_blocks) <= 256
+                   else 'unsigned short')
+    out.write('    static constexpr int block_bits = %d;\n' % block_bits)
+    out.write('    static constexpr int index_block_bits = %d;\n'
+              % index_block_bits)
+    out.write('    static constexpr %s index[0x110000 >> %d] = {\n'
+              % (index1_type, block_bits + index_block_bits))
+    emit_array(out, index1, '%d', 16, '        ')
+    out.write('    };\n')
+    out.write('    static constexpr %s index_blocks[%d][%d] = {\n'
+              % (index_type, len(index_blocks), 1 << index_block_bits))
+    for block in index_blocks:
+        out.write('        {\n')
+        emit_array(out, block, '%d', 16, '            ')
+        out.write('        },\n')
+    out.write('    };\n')
+    out.write('    static constexpr %s blocks[%d][%d] = {\n'
+              % (value_type, len(blocks), 1 << block_bits))
+    for block in blocks:
+        out.write('        {\n')
+        emit_array(out, block, value_fmt, per_line, '            ')
+        out.write('        },\n')
+    out.write('    };\n')
+
+
+def emit_comment(out, comment):
+    """Writes 'comment' as a block comment."""
+    out.write('\n/*\n')
+    for line in comment.strip('\n').split('\n'):
+        out.write((' * ' + line).rstrip() + '\n')
+    out.write(' */\n')
+
+
+def emit_property_struct(out, name, comment, enumerators, values,
+                         latin_limit=0x300, constants=()):
+    """Writes a struct named 'name' holding an enumeration of property values
+    named 'enumerators', any additional integer 'constants' given as (name,
+    value) pairs, a flat table of the values of code points below
+    'latin_limit', and a trie of all values.  'comment' is the text of the
+    block comment that precedes the struct."""
+    emit_comment(out, comment)
+    out.write('struct %s {\n' % name)
+    out.write('    enum property : unsigned char {\n')
+    for enumerator in enumerators:
+        out.write('        %s,\n' % enumerator)
+    out.write('    };\n')
+    out.write('    static constexpr property default_value = %s;\n'
+              % enumerators[0])
+    for constant, value in constants:
+        out.write('    static constexpr unsigned char %s = 0x%02X;\n'
+                  % (constant, value))
+    out.write('    static constexpr char32_t latin_limit = 0x%X;\n'
+              % latin_limit)
+    out.write('    static constexpr unsigned char latin[latin_limit] = {\n')
+    emit_array(out, values[:latin_limit], '%d', 16, '        ')
+    out.write('    };\n')
+    emit_trie(out, values, best_block_bits(values))
+    out.write('};\n')